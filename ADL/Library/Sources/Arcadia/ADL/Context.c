@@ -18,6 +18,12 @@
 
 #include "Arcadia/ADL/Definitions.h"
 #include "Arcadia/ADL/Reader.h"
+#include "Arcadia/ADL/Pack/PackEntry.h"
+#include "Arcadia/ADL/Pack/PackFormat.h"
+
+#include "Arcadia/ADL/Definitions/Audials/SampleBufferDefinition.h"
+#include "Arcadia/ADL/Definitions/Visuals/MeshDefinition.h"
+#include "Arcadia/ADL/Definitions/Visuals/PixelBufferDefinition.h"
 
 #include "Arcadia/ADL/Definitions/Audials/SampleBufferReader.module.h"
 
@@ -272,8 +278,7 @@ readFromString
   )
 {
   Arcadia_DDL_DefaultReader* reader = (Arcadia_DDL_DefaultReader*)Arcadia_DDL_DefaultReader_create(thread);
-  Arcadia_UnicodeCodePointReader* x = (Arcadia_UnicodeCodePointReader*)Arcadia_ByteReader_UnicodeCodePointReader_create(thread, (Arcadia_ByteReader*)Arcadia_ByteArray_ByteReader_create(thread, Arcadia_String_toByteArray(thread, input)));
-  Arcadia_DDL_Node* node = Arcadia_DDL_DefaultReader_run(thread, reader, x);
+  Arcadia_DDL_Node* node = Arcadia_DDL_DefaultReader_runBytes(thread, reader, Arcadia_String_toByteArray(thread, input));
   if (!Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)node, _Arcadia_DDL_MapNode_getType(thread))) {
     Arcadia_logf(Arcadia_LogFlags_Error, u8"argument input is not a of type Arcadia.DDL.MapNode\n");
     Arcadia_Thread_setStatus(thread, Arcadia_Status_SemanticalError);
@@ -310,13 +315,14 @@ readFromNode
   // (2) Read the definition.
   Arcadia_ADL_Definition* definition = Arcadia_ADL_Reader_read(thread, reader, self, definitions, (Arcadia_DDL_Node*)input);
   // (3) Assert there is no definition of the same name in the definitions already.
-  Arcadia_Value temporary = Arcadia_Map_get(thread, definitions->definitions, Arcadia_Value_makeObjectReferenceValue(definition->name));
-  if (!Arcadia_Value_isVoidValue(&temporary)) {
+  // This includes the definitions of the mounted packs such that baked definitions take precedence.
+  Arcadia_ADL_Definition* existing = Arcadia_ADL_Definitions_getDefinitionOrNull(thread, definitions, definition->name);
+  if (existing) {
     if (!skipExisting) {
       Arcadia_Thread_setStatus(thread, Arcadia_Status_Exists);
       Arcadia_Thread_jump(thread);
     }
-    return (Arcadia_ADL_Definition*)Arcadia_Value_getObjectReferenceValueChecked(thread, temporary, _Arcadia_ADL_Definition_getType(thread));
+    return existing;
   } else {
     // (4) Register the definition.
     Arcadia_Map_set(thread, definitions->definitions, Arcadia_Value_makeObjectReferenceValue(definition->name), Arcadia_Value_makeObjectReferenceValue(definition), NULL, NULL);
@@ -389,3 +395,90 @@ Arcadia_ADL_Context_readFromString
   }
   return readFromString(thread, self, definitions, input, skipExisting);
 }
+
+// Split the interleaved vertices of a mesh pack entry into the vertex positions, the vertex ambient colors, and the vertex ambient texture coordinates.
+static Arcadia_RuntimeByteArray*
+getMeshVertexAttribute
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Real32ArrayList* values,
+    Arcadia_ADL_PackEntry* entry,
+    Arcadia_SizeValue offset,
+    Arcadia_SizeValue numberOfComponents
+  )
+{
+  Arcadia_SizeValue numberOfVertices = entry->parameters[0];
+  Arcadia_Real32ArrayList_clear(thread, values);
+  for (Arcadia_SizeValue i = 0; i < numberOfVertices; ++i) {
+    Arcadia_Natural8Value const* p = entry->bytes + i * Arcadia_ADL_PackFormat_MeshVertexStride + offset;
+    for (Arcadia_SizeValue j = 0; j < numberOfComponents; ++j) {
+      Arcadia_Real32Value v;
+      Arcadia_Memory_copy(thread, &v, p + j * sizeof(Arcadia_Real32Value), sizeof(Arcadia_Real32Value));
+      Arcadia_Real32ArrayList_insertBack(thread, values, v);
+    }
+  }
+  return Arcadia_RuntimeByteArray_create(thread, (Arcadia_Natural8Value const*)Arcadia_Real32ArrayList_getElements(thread, values), Arcadia_Real32ArrayList_getSize(thread, values) * sizeof(Arcadia_Real32Value));
+}
+
+Arcadia_ADL_Definition*
+Arcadia_ADL_Context_readFromPackEntry
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Context* self,
+    Arcadia_ADL_Definitions* definitions,
+    Arcadia_ADL_PackEntry* entry
+  )
+{
+  if (!entry) {
+    Arcadia_logf(Arcadia_LogFlags_Error, u8"argument entry is a null pointer\n");
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  // (1) Assert there is no definition of the same name in the definitions already.
+  Arcadia_Value temporary = Arcadia_Map_get(thread, definitions->definitions, Arcadia_Value_makeObjectReferenceValue(entry->name));
+  if (!Arcadia_Value_isVoidValue(&temporary)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Exists);
+    Arcadia_Thread_jump(thread);
+  }
+  // (2) Create the definition.
+  // The pack has validated that the parameters of the entry describe its data.
+  Arcadia_ADL_Definition* definition = NULL;
+  switch (entry->kind) {
+    case Arcadia_ADL_PackFormat_Kind_PixelBuffer: {
+      Arcadia_ADL_PixelBufferDefinition* pixelBufferDefinition =
+        Arcadia_ADL_PixelBufferDefinition_create(thread, definitions, entry->name, entry->parameters[0], entry->parameters[1], (Arcadia_ADL_PixelFormat)entry->parameters[2]);
+      pixelBufferDefinition->pixels = entry;
+      definition = (Arcadia_ADL_Definition*)pixelBufferDefinition;
+    } break;
+    case Arcadia_ADL_PackFormat_Kind_SampleBuffer: {
+      // Sample buffers have a single channel.
+      if (entry->parameters[3] != 1) {
+        Arcadia_Thread_setStatus(thread, Arcadia_Status_SemanticalError);
+        Arcadia_Thread_jump(thread);
+      }
+      Arcadia_ADL_SampleBufferDefinition* sampleBufferDefinition =
+        Arcadia_ADL_SampleBufferDefinition_create(thread, definitions, entry->name, entry->parameters[0], entry->parameters[1], (Arcadia_ADL_SampleFormat)entry->parameters[2], NULL);
+      sampleBufferDefinition->samples = entry;
+      definition = (Arcadia_ADL_Definition*)sampleBufferDefinition;
+    } break;
+    case Arcadia_ADL_PackFormat_Kind_Mesh: {
+      Arcadia_SizeValue numberOfVertices = entry->parameters[0];
+      Arcadia_Real32ArrayList* values = Arcadia_Real32ArrayList_create(thread);
+      Arcadia_RuntimeByteArray* vertexPositions = getMeshVertexAttribute(thread, values, entry, 0, 3);
+      Arcadia_RuntimeByteArray* vertexAmbientColors = getMeshVertexAttribute(thread, values, entry, 3 * sizeof(Arcadia_Real32Value), 4);
+      Arcadia_RuntimeByteArray* vertexAmbientTextureCoordinates = getMeshVertexAttribute(thread, values, entry, 7 * sizeof(Arcadia_Real32Value), 2);
+      Arcadia_String* ambientColorName =
+        Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_create(thread, entry->bytes + numberOfVertices * Arcadia_ADL_PackFormat_MeshVertexStride, entry->parameters[2])));
+      definition = (Arcadia_ADL_Definition*)Arcadia_ADL_MeshDefinition_create(thread, definitions, entry->name, numberOfVertices, vertexPositions, vertexAmbientColors,
+                                                                              vertexAmbientTextureCoordinates, ambientColorName);
+    } break;
+    default: {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_SemanticalError);
+      Arcadia_Thread_jump(thread);
+    } break;
+  }
+  // (3) Register the definition.
+  Arcadia_Map_set(thread, definitions->definitions, Arcadia_Value_makeObjectReferenceValue(definition->name), Arcadia_Value_makeObjectReferenceValue(definition), NULL, NULL);
+  // (4) Return the definition.
+  return definition;
+}
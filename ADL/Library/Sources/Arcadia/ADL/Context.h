@@ -23,6 +23,7 @@
 #include "Arcadia/DDL/Include.h"
 typedef struct Arcadia_ADL_Definition Arcadia_ADL_Definition;
 typedef struct Arcadia_ADL_Definitions Arcadia_ADL_Definitions;
+typedef struct Arcadia_ADL_PackEntry Arcadia_ADL_PackEntry;
 
 /**
  * The ADL context is a singleton providing access to ADL functionality including but not restricted to
@@ -91,4 +92,24 @@ Arcadia_ADL_Context_readFromString
     Arcadia_BooleanValue skipExisting
   );
 
+/**
+ * @brief Read a definition from an entry of an asset pack.
+ * The definition refers to the Bytes of the entry instead of copying them where possible.
+ * @param thread A pointer to this thread.
+ * @param self A pointer to this ADL context.
+ * @param definitions A pointer to the ADL definitions to add the definition to.
+ * @param entry A pointer to the pack entry.
+ * @return A pointer to the ADL definition.
+ * @error Arcadia_Status_Exists an ADL definition of the same name is already loaded
+ * @error Arcadia_Status_SemanticalError the kind of the pack entry is not supported
+ */
+Arcadia_ADL_Definition*
+Arcadia_ADL_Context_readFromPackEntry
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Context* self,
+    Arcadia_ADL_Definitions* definitions,
+    Arcadia_ADL_PackEntry* entry
+  );
+
 #endif  // ARCADIA_ADL_CONTEXT_H_INCLUDED
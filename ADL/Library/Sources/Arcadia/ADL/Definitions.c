@@ -16,7 +16,9 @@
 #define ARCADIA_ADL_MODULE (1)
 #include "Arcadia/ADL/Definitions.h"
 
+#include "Arcadia/ADL/Context.h"
 #include "Arcadia/ADL/Definition.h"
+#include "Arcadia/ADL/Pack/Pack.h"
 
 static void
 Arcadia_ADL_Definitions_visitImpl
@@ -65,6 +67,9 @@ Arcadia_ADL_Definitions_visitImpl
   if (self->definitions) {
     Arcadia_Object_visit(thread, (Arcadia_Object*)self->definitions);
   }
+  if (self->packs) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->packs);
+  }
 }
 
 static void
@@ -84,6 +89,7 @@ Arcadia_ADL_Definitions_constructImpl
     Arcadia_Thread_jump(thread);
   }
   self->definitions = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
+  self->packs = (Arcadia_List*)Arcadia_ArrayList_create(thread);
   Arcadia_LeaveConstructor(Arcadia_ADL_Definitions);
 }
 
@@ -106,6 +112,21 @@ Arcadia_ADL_Definitions_create
   ARCADIA_CREATEOBJECT(Arcadia_ADL_Definitions);
 }
 
+void
+Arcadia_ADL_Definitions_addPack
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Definitions* self,
+    Arcadia_ADL_Pack* pack
+  )
+{
+  if (!pack) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_List_insertBackObjectReferenceValue(thread, self->packs, (Arcadia_Object*)pack);
+}
+
 Arcadia_ADL_Definition*
 Arcadia_ADL_Definitions_getDefinitionOrNull
   (
@@ -116,6 +137,13 @@ Arcadia_ADL_Definitions_getDefinitionOrNull
 {
   Arcadia_Value v = Arcadia_Map_get(thread, self->definitions, Arcadia_Value_makeObjectReferenceValue(name));
   if (Arcadia_Value_isVoidValue(&v)) {
+    for (Arcadia_SizeValue i = 0, n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)self->packs); i < n; ++i) {
+      Arcadia_ADL_Pack* pack = (Arcadia_ADL_Pack*)Arcadia_List_getObjectReferenceValueCheckedAt(thread, self->packs, i, _Arcadia_ADL_Pack_getType(thread));
+      Arcadia_ADL_PackEntry* entry = Arcadia_ADL_Pack_getEntryOrNull(thread, pack, name);
+      if (entry) {
+        return Arcadia_ADL_Context_readFromPackEntry(thread, Arcadia_ADL_Context_getOrCreate(thread), self, entry);
+      }
+    }
     return NULL;
   }
   return (Arcadia_ADL_Definition*)Arcadia_Value_getObjectReferenceValueChecked(thread, v, _Arcadia_ADL_Definition_getType(thread));
@@ -22,17 +22,26 @@
 #include "Arcadia/Ring2/Include.h"
 #include "Arcadia/Collections/Include.h"
 typedef struct Arcadia_ADL_Definition Arcadia_ADL_Definition;
+typedef struct Arcadia_ADL_Pack Arcadia_ADL_Pack;
 
 // @brief A set of definitions.
 //
+// Asset packs can be mounted into a set of definitions.
+// If a definition is looked up which is not in the set, then the mounted packs are searched in the order in which they were mounted.
+// A definition is created from the first entry of that name and added to the set.
+//
 // @code
 // class Arcadia.ADL.Definitions extends Arcadia.Object {
 //
 //   field definitions : Arcadia.Map;
 //
+//   field packs : Arcadia.List;
+//
 //   constructor();
 //
-//   method getQualifiedName(name : Arcadia.String) : Arcadia.ADL.Definition
+//   method addPack(pack : Arcadia.ADL.Pack)
+//
+//   method getDefinitionOrNull(name : Arcadia.String) : Arcadia.ADL.Definition
 //
 // };
 // @endcode
@@ -46,6 +55,7 @@ struct Arcadia_ADL_DefinitionsDispatch {
 struct Arcadia_ADL_Definitions {
   Arcadia_Object _parent;
   Arcadia_Map* definitions;
+  Arcadia_List* packs;
 };
 
 Arcadia_ADL_Definitions*
@@ -54,6 +64,24 @@ Arcadia_ADL_Definitions_create
     Arcadia_Thread* thread
   );
 
+/// @brief Mount a pack into this set of definitions.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this set of definitions.
+/// @param pack A pointer to the pack.
+void
+Arcadia_ADL_Definitions_addPack
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Definitions* self,
+    Arcadia_ADL_Pack* pack
+  );
+
+/// @brief Get a definition by its name.
+/// If the definition is not in this set, then it is created from an entry of a mounted pack.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this set of definitions.
+/// @param name The name of the definition.
+/// @return A pointer to the definition if it exists, the null pointer otherwise.
 Arcadia_ADL_Definition*
 Arcadia_ADL_Definitions_getDefinitionOrNull
   (
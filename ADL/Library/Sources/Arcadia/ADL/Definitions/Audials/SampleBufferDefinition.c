@@ -19,6 +19,7 @@
 #include "Arcadia/ADL/Context.h"
 #include "Arcadia/ADL/Reader.module.h"
 #include "Arcadia/ADL/Reference.h"
+#include "Arcadia/ADL/Pack/PackEntry.h"
 #include "Arcadia/ADL/Definitions/Audials/Include.h"
 
 static void
@@ -72,8 +73,10 @@ Arcadia_ADL_SampleBufferDefinition_linkImpl
     Arcadia_ADL_SampleBufferDefinition* self
   )
 {
-  Arcadia_ADL_Reference_resolve(thread, self->dsp);
-  Arcadia_ADL_Definition_link(thread, self->dsp->definition);
+  if (self->dsp) {
+    Arcadia_ADL_Reference_resolve(thread, self->dsp);
+    Arcadia_ADL_Definition_link(thread, self->dsp->definition);
+  }
 }
 
 static void
@@ -86,6 +89,9 @@ Arcadia_ADL_SampleBufferDefinition_visitImpl
   if (self->dsp) {
     Arcadia_Object_visit(thread, (Arcadia_Object*)self->dsp);
   }
+  if (self->samples) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->samples);
+  }
 }
 
 static void
@@ -98,19 +104,35 @@ Arcadia_ADL_SampleBufferDefinition_constructImpl
   Arcadia_EnterConstructor(Arcadia_ADL_SampleBufferDefinition);
   {
     Arcadia_Value definitions, name;
-    definitions = Arcadia_ValueStack_getValue(thread, 4);
-    name = Arcadia_ValueStack_getValue(thread, 3);
+    definitions = Arcadia_ValueStack_getValue(thread, 6);
+    name = Arcadia_ValueStack_getValue(thread, 5);
     Arcadia_ValueStack_pushValue(thread, &definitions);
     Arcadia_ValueStack_pushValue(thread, &name);
     Arcadia_ValueStack_pushNatural8Value(thread, 2);
     Arcadia_superTypeConstructor(thread, _type, self);
   }
-  if (4 != _numberOfArguments) {
+  if (6 != _numberOfArguments) {
     Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
     Arcadia_Thread_jump(thread);
   }
-  self->duration = Arcadia_ValueStack_getNatural32Value(thread, 2);
-  self->dsp = Arcadia_ValueStack_getObjectReferenceValueChecked(thread, 1, _Arcadia_ADL_Reference_getType(thread));
+  self->duration = Arcadia_ValueStack_getNatural32Value(thread, 4);
+  self->sampleRate = Arcadia_ValueStack_getNatural32Value(thread, 3);
+  Arcadia_EnumerationValue sampleFormat = Arcadia_ValueStack_getEnumerationValue(thread, 2);
+  if (!Arcadia_Type_isDescendantType(thread, sampleFormat.type, _Arcadia_ADL_SampleFormat_getType(thread))) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentTypeInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->sampleFormat = sampleFormat.value;
+  if (!self->sampleRate) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  if (Arcadia_ValueStack_isVoidValue(thread, 1)) {
+    self->dsp = NULL;
+  } else {
+    self->dsp = Arcadia_ValueStack_getObjectReferenceValueChecked(thread, 1, _Arcadia_ADL_Reference_getType(thread));
+  }
+  self->samples = NULL;
   Arcadia_LeaveConstructor(Arcadia_ADL_SampleBufferDefinition);
 }
 
@@ -131,6 +153,8 @@ Arcadia_ADL_SampleBufferDefinition_create
     Arcadia_ADL_Definitions* definitions,
     Arcadia_String* name,
     Arcadia_Natural32Value duration,
+    Arcadia_Natural32Value sampleRate,
+    Arcadia_ADL_SampleFormat sampleFormat,
     Arcadia_ADL_Reference* dsp
   )
 {
@@ -138,7 +162,13 @@ Arcadia_ADL_SampleBufferDefinition_create
   Arcadia_ValueStack_pushObjectReferenceValue(thread, (Arcadia_Object*)definitions);
   Arcadia_ValueStack_pushObjectReferenceValue(thread, (Arcadia_Object*)name);
   Arcadia_ValueStack_pushNatural32Value(thread, duration);
-  Arcadia_ValueStack_pushObjectReferenceValue(thread, (Arcadia_Object*)dsp);
-  Arcadia_ValueStack_pushNatural8Value(thread, 4);
+  Arcadia_ValueStack_pushNatural32Value(thread, sampleRate);
+  Arcadia_ValueStack_pushEnumerationValue(thread, Arcadia_EnumerationValue_make(_Arcadia_ADL_SampleFormat_getType(thread), sampleFormat));
+  if (dsp) {
+    Arcadia_ValueStack_pushObjectReferenceValue(thread, (Arcadia_Object*)dsp);
+  } else {
+    Arcadia_ValueStack_pushVoidValue(thread, Arcadia_VoidValue_Void);
+  }
+  Arcadia_ValueStack_pushNatural8Value(thread, 6);
   ARCADIA_CREATEOBJECT(Arcadia_ADL_SampleBufferDefinition);
 }
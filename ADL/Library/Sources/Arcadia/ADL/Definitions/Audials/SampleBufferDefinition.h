@@ -21,6 +21,8 @@
 #endif
 #include "Arcadia/ADL/Definition.h"
 #include "Arcadia/ADL/Reference.h"
+#include "Arcadia/ADL/Definitions/Audials/SampleFormat.h"
+typedef struct Arcadia_ADL_PackEntry Arcadia_ADL_PackEntry;
 
 // A definition of a sample buffer.
 //
@@ -28,11 +30,19 @@
 // {
 //   type  : "SampleBuffer",
 //   name  : "MyGame.MyScene.MySampleBuffer",
-//   length : 2,
+//   duration : 2,
+//   sampleRate : 44100,
+//   sampleFormat : "Integer16",
 //   dsp : "MyGame.MyScene.MyDSP",
 // }
 // @endcode
 //
+// The sample format is the name of an element of Arcadia.ADL.SampleFormat.
+// Sample buffers have a single channel.
+//
+// Sample buffer definitions loaded from an asset pack have no DSP.
+// Their samples were baked into the pack, see Arcadia.ADL.SampleBufferDefinition.samples.
+//
 // @code
 // class Arcadia.ADL.SampleBufferDefinition extends Arcadia.ADL.Definition {
 //
@@ -51,8 +61,15 @@ struct Arcadia_ADL_SampleBufferDefinition {
   Arcadia_ADL_Definition _parent;
   /// The duration, in seconds, of the sample buffer.
   Arcadia_Natural32Value duration;
-  /// Reference to the DSP to fill the sample buffer. 
+  /// The sample rate, in Hz, of the sample buffer.
+  Arcadia_Natural32Value sampleRate;
+  /// The sample format of the sample buffer.
+  Arcadia_ADL_SampleFormat sampleFormat;
+  /// Reference to the DSP to fill the sample buffer.
+  /// Null if this definition was loaded from an asset pack.
   Arcadia_ADL_Reference* dsp;
+  /// The baked samples if this definition was loaded from an asset pack, null otherwise.
+  Arcadia_ADL_PackEntry* samples;
 };
 
 Arcadia_ADL_SampleBufferDefinition*
@@ -62,6 +79,8 @@ Arcadia_ADL_SampleBufferDefinition_create
     Arcadia_ADL_Definitions* definitions,
     Arcadia_String* name,
     Arcadia_Natural32Value duration,
+    Arcadia_Natural32Value sampleRate,
+    Arcadia_ADL_SampleFormat sampleFormat,
     Arcadia_ADL_Reference* dsp
   );
 
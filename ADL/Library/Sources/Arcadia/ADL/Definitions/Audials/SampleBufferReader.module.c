@@ -52,6 +52,20 @@ static const char* SCHEMA =
 "      },\n"
 "      {\n"
 "        kind : \"MapEntry\",\n"
+"        name : \"sampleRate\",\n"
+"        type : {\n"
+"          kind : \"Number\",\n"
+"        },\n"
+"      },\n"
+"      {\n"
+"        kind : \"MapEntry\",\n"
+"        name : \"sampleFormat\",\n"
+"        type : {\n"
+"          kind : \"String\",\n"
+"        },\n"
+"      },\n"
+"      {\n"
+"        kind : \"MapEntry\",\n"
 "        name : \"dsp\",\n"
 "        type : {\n"
 "          kind : \"String\",\n"
@@ -69,6 +83,15 @@ Arcadia_ADL_SampleBufferReader_getTypeName
     Arcadia_ADL_SampleBufferReader* self
   );
 
+static Arcadia_ADL_SampleFormat
+getSampleFormatValue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_SampleBufferReader* self,
+    Arcadia_DDL_MapNode* mapNode,
+    Arcadia_String* key
+  );
+
 static Arcadia_ADL_SampleBufferDefinition*
 Arcadia_ADL_SampleBufferReader_read
   (
@@ -124,6 +147,35 @@ Arcadia_ADL_SampleBufferReader_getTypeName
   )
 { return self->TYPENAME; }
 
+static Arcadia_ADL_SampleFormat
+getSampleFormatValue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_SampleBufferReader* self,
+    Arcadia_DDL_MapNode* mapNode,
+    Arcadia_String* key
+  )
+{
+  static const struct {
+    const char* name;
+    Arcadia_ADL_SampleFormat value;
+  } SAMPLEFORMATS[] = {
+    { u8"Integer16", Arcadia_ADL_SampleFormat_Integer16 },
+    { u8"Integer8", Arcadia_ADL_SampleFormat_Integer8 },
+    { u8"Natural16", Arcadia_ADL_SampleFormat_Natural16 },
+    { u8"Natural8", Arcadia_ADL_SampleFormat_Natural8 },
+    { u8"Real32", Arcadia_ADL_SampleFormat_Real32 },
+  };
+  Arcadia_String* a = Arcadia_ADL_Reader_getStringValue(thread, mapNode, key);
+  for (Arcadia_SizeValue i = 0; i < sizeof(SAMPLEFORMATS) / sizeof(SAMPLEFORMATS[0]); ++i) {
+    if (Arcadia_String_isEqualTo_pn(thread, a, SAMPLEFORMATS[i].name, strlen(SAMPLEFORMATS[i].name))) {
+      return SAMPLEFORMATS[i].value;
+    }
+  }
+  Arcadia_Thread_setStatus(thread, Arcadia_Status_SemanticalError);
+  Arcadia_Thread_jump(thread);
+}
+
 static Arcadia_ADL_SampleBufferDefinition*
 Arcadia_ADL_SampleBufferReader_read
   (
@@ -139,6 +191,8 @@ Arcadia_ADL_SampleBufferReader_read
   Arcadia_String* type = Arcadia_ADL_Reader_getStringValue(thread, (Arcadia_DDL_MapNode*)input, self->TYPE);
   Arcadia_String* name = Arcadia_ADL_Reader_getStringValue(thread, (Arcadia_DDL_MapNode*)input, self->NAME);
   Arcadia_Natural32Value duration = Arcadia_ADL_Reader_getNatural32Value(thread, (Arcadia_DDL_MapNode*)input, self->DURATION);
+  Arcadia_Natural32Value sampleRate = Arcadia_ADL_Reader_getNatural32Value(thread, (Arcadia_DDL_MapNode*)input, self->SAMPLERATE);
+  Arcadia_ADL_SampleFormat sampleFormat = getSampleFormatValue(thread, self, (Arcadia_DDL_MapNode*)input, self->SAMPLEFORMAT);
   Arcadia_String* dsp = Arcadia_ADL_Reader_getStringValue(thread, (Arcadia_DDL_MapNode*)input, self->DSP);
 
   // Assert the definition has the correct type.
@@ -148,7 +202,7 @@ Arcadia_ADL_SampleBufferReader_read
     Arcadia_Thread_jump(thread);
   }
 
-  Arcadia_ADL_SampleBufferDefinition* definition = Arcadia_ADL_SampleBufferDefinition_create(thread, definitions, name, duration, Arcadia_ADL_Reference_create(thread, definitions, dsp));
+  Arcadia_ADL_SampleBufferDefinition* definition = Arcadia_ADL_SampleBufferDefinition_create(thread, definitions, name, duration, sampleRate, sampleFormat, Arcadia_ADL_Reference_create(thread, definitions, dsp));
 
   return definition;
 }
@@ -187,6 +241,8 @@ Arcadia_ADL_SampleBufferReader_constructImpl
   self->TYPENAME = Arcadia_Languages_StringTable_getOrCreateStringFromCxxString(thread, Arcadia_Languages_StringTable_getOrCreate(thread), u8"SampleBuffer");
   self->DSP = Arcadia_Languages_StringTable_getOrCreateStringFromCxxString(thread, Arcadia_Languages_StringTable_getOrCreate(thread), u8"dsp");
   self->DURATION = Arcadia_Languages_StringTable_getOrCreateStringFromCxxString(thread, Arcadia_Languages_StringTable_getOrCreate(thread), u8"duration");
+  self->SAMPLERATE = Arcadia_Languages_StringTable_getOrCreateStringFromCxxString(thread, Arcadia_Languages_StringTable_getOrCreate(thread), u8"sampleRate");
+  self->SAMPLEFORMAT = Arcadia_Languages_StringTable_getOrCreateStringFromCxxString(thread, Arcadia_Languages_StringTable_getOrCreate(thread), u8"sampleFormat");
   //
   Arcadia_LeaveConstructor(Arcadia_ADL_SampleBufferReader);
 }
@@ -231,6 +287,12 @@ Arcadia_ADL_SampleBufferReader_visitImpl
   if (self->DURATION) {
     Arcadia_Object_visit(thread, (Arcadia_Object*)self->DURATION);
   }
+  if (self->SAMPLERATE) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->SAMPLERATE);
+  }
+  if (self->SAMPLEFORMAT) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->SAMPLEFORMAT);
+  }
 }
 
 Arcadia_ADL_SampleBufferReader*
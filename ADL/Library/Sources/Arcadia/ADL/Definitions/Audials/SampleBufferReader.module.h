@@ -44,6 +44,10 @@ struct Arcadia_ADL_SampleBufferReader {
   Arcadia_String* DSP;
   // The string `duration` cached here.
   Arcadia_String* DURATION;
+  // The string `sampleRate` cached here.
+  Arcadia_String* SAMPLERATE;
+  // The string `sampleFormat` cached here.
+  Arcadia_String* SAMPLEFORMAT;
 
   // The validation context. Cached here.
   Arcadia_DDLS_ValidationContext* validationContext;
@@ -0,0 +1,47 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_ADL_DEFINITIONS_AUDIALS_SAMPLEFORMAT_H_INCLUDED)
+#define ARCADIA_ADL_DEFINITIONS_AUDIALS_SAMPLEFORMAT_H_INCLUDED
+
+#if !defined(ARCADIA_ADL_MODULE)
+  #error("do not include directly, include `Arcadia/ADL/Include.h` instead")
+#endif
+#include "Arcadia/ADL/Definition.h"
+
+// Enumeration of sample formats.
+// The values are the values of the Arcadia.Media.SampleFormat elements of the same names.
+// Keep in sync with Arcadia_Media_SampleFormat.
+//
+// @code
+// enumeration Arcadia.ADL.SampleFormat {
+//   Integer16,
+//   Integer8,
+//   Natural16,
+//   Natural8,
+//   Real32,
+// };
+// @endcode
+Arcadia_declareEnumerationType(u8"Arcadia.ADL.SampleFormat", Arcadia_ADL_SampleFormat);
+
+enum Arcadia_ADL_SampleFormat {
+  Arcadia_ADL_SampleFormat_Integer16,
+  Arcadia_ADL_SampleFormat_Integer8,
+  Arcadia_ADL_SampleFormat_Natural16,
+  Arcadia_ADL_SampleFormat_Natural8,
+  Arcadia_ADL_SampleFormat_Real32,
+};
+
+#endif  // ARCADIA_ADL_DEFINITIONS_AUDIALS_SAMPLEFORMAT_H_INCLUDED
@@ -163,7 +163,7 @@ Arcadia_ADL_MeshReader_read
   Arcadia_String* name = Arcadia_ADL_Reader_getStringValue(thread, (Arcadia_DDL_MapNode*)input, self->NAME);
   Arcadia_String* ambientColorName = Arcadia_ADL_Reader_getStringValue(thread, (Arcadia_DDL_MapNode*)input, self->AMBIENTCOLOR);
 
-  Arcadia_ByteArrayBuilder* byteBuffer = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_Real32ArrayList* values = Arcadia_Real32ArrayList_create(thread);
   Arcadia_List* list; Arcadia_SizeValue numberOfVertices, n;
 
   // (1) The number of position tuples / ambient color tuples / ambient texture coordinate tuples must be the same.
@@ -171,7 +171,7 @@ Arcadia_ADL_MeshReader_read
   numberOfVertices = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)list) / 3; // Not divisible by 3 erorr is handled below.
 
   // (1) read the positions
-  Arcadia_ByteArrayBuilder_clear(thread, byteBuffer);
+  Arcadia_Real32ArrayList_clear(thread, values);
   list = Arcadia_ADL_Reader_getListValue(thread, (Arcadia_DDL_MapNode*)input, self->VERTEXPOSITIONS);
   n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)list);
   if (n % 3 != 0 || numberOfVertices != n / 3) {
@@ -181,11 +181,11 @@ Arcadia_ADL_MeshReader_read
   for (Arcadia_SizeValue i = 0; i < n; ++i) {
     Arcadia_DDL_NumberNode* listElement = (Arcadia_DDL_NumberNode*)Arcadia_List_getObjectReferenceValueCheckedAt(thread, list, i, _Arcadia_DDL_NumberNode_getType(thread));
     Arcadia_Real32Value v = Arcadia_String_toReal32(thread, listElement->value);
-    Arcadia_ByteArrayBuilder_insertBackBytes(thread, byteBuffer, &v, sizeof(Arcadia_Real32Value));
+    Arcadia_Real32ArrayList_insertBack(thread, values, v);
   }
-  Arcadia_RuntimeByteArray* vertexPositions = Arcadia_RuntimeByteArray_create(thread, Arcadia_ByteArrayBuilder_getBytes(thread, byteBuffer), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, byteBuffer));
+  Arcadia_RuntimeByteArray* vertexPositions = Arcadia_RuntimeByteArray_create(thread, (Arcadia_Natural8Value const*)Arcadia_Real32ArrayList_getElements(thread, values), Arcadia_Real32ArrayList_getSize(thread, values) * sizeof(Arcadia_Real32Value));
   // (2) read the ambient colors
-  Arcadia_ByteArrayBuilder_clear(thread, byteBuffer);
+  Arcadia_Real32ArrayList_clear(thread, values);
   list = Arcadia_ADL_Reader_getListValue(thread, (Arcadia_DDL_MapNode*)input, self->VERTEXAMBIENTCOLORS);
   n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)list);
   if (n % 4 != 0 || numberOfVertices != n / 4) {
@@ -195,11 +195,11 @@ Arcadia_ADL_MeshReader_read
   for (Arcadia_SizeValue i = 0; i < n; ++i) {
     Arcadia_DDL_NumberNode* listElement = (Arcadia_DDL_NumberNode*)Arcadia_List_getObjectReferenceValueCheckedAt(thread, list, i, _Arcadia_DDL_NumberNode_getType(thread));
     Arcadia_Real32Value v = Arcadia_String_toReal32(thread, listElement->value);
-    Arcadia_ByteArrayBuilder_insertBackBytes(thread, byteBuffer, &v, sizeof(Arcadia_Real32Value));
+    Arcadia_Real32ArrayList_insertBack(thread, values, v);
   }
-  Arcadia_RuntimeByteArray* vertexAmbientColors = Arcadia_RuntimeByteArray_create(thread, Arcadia_ByteArrayBuilder_getBytes(thread, byteBuffer), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, byteBuffer));
+  Arcadia_RuntimeByteArray* vertexAmbientColors = Arcadia_RuntimeByteArray_create(thread, (Arcadia_Natural8Value const*)Arcadia_Real32ArrayList_getElements(thread, values), Arcadia_Real32ArrayList_getSize(thread, values) * sizeof(Arcadia_Real32Value));
   // (3) read the ambient color texutre coordinates
-  Arcadia_ByteArrayBuilder_clear(thread, byteBuffer);
+  Arcadia_Real32ArrayList_clear(thread, values);
   list = Arcadia_ADL_Reader_getListValue(thread, (Arcadia_DDL_MapNode*)input, self->VERTEXAMBIENTCOLORTEXTURECOORDINATES);
   n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)list);
   if (n % 2 != 0 || numberOfVertices != n / 2) {
@@ -209,10 +209,10 @@ Arcadia_ADL_MeshReader_read
   for (Arcadia_SizeValue i = 0; i < n; ++i) {
     Arcadia_DDL_NumberNode* listElement = (Arcadia_DDL_NumberNode*)Arcadia_List_getObjectReferenceValueCheckedAt(thread, list, i, _Arcadia_DDL_NumberNode_getType(thread));
     Arcadia_Real32Value v = Arcadia_String_toReal32(thread, listElement->value);
-    Arcadia_ByteArrayBuilder_insertBackBytes(thread, byteBuffer, &v, sizeof(Arcadia_Real32Value));
+    Arcadia_Real32ArrayList_insertBack(thread, values, v);
   }
 
-  Arcadia_RuntimeByteArray* vertexAmbientColorTextureCoordinates = Arcadia_RuntimeByteArray_create(thread, Arcadia_ByteArrayBuilder_getBytes(thread, byteBuffer), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, byteBuffer));
+  Arcadia_RuntimeByteArray* vertexAmbientColorTextureCoordinates = Arcadia_RuntimeByteArray_create(thread, (Arcadia_Natural8Value const*)Arcadia_Real32ArrayList_getElements(thread, values), Arcadia_Real32ArrayList_getSize(thread, values) * sizeof(Arcadia_Real32Value));
 
 
   // Assert the definition has the correct type.
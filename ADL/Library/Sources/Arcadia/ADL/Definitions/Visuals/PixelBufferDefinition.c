@@ -19,6 +19,7 @@
 #include "Arcadia/ADL/Context.h"
 #include "Arcadia/ADL/Reader.module.h"
 #include "Arcadia/ADL/Reference.h"
+#include "Arcadia/ADL/Pack/PackEntry.h"
 #include "Arcadia/ADL/Definitions/Visuals/Include.h"
 
 static void
@@ -89,6 +90,9 @@ Arcadia_ADL_PixelBufferDefinition_visitImpl
   if (self->operations) {
     Arcadia_Object_visit(thread, (Arcadia_Object*)self->operations);
   }
+  if (self->pixels) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->pixels);
+  }
 }
 
 static void
@@ -101,20 +105,27 @@ Arcadia_ADL_PixelBufferDefinition_constructImpl
   Arcadia_EnterConstructor(Arcadia_ADL_PixelBufferDefinition);
   {
     Arcadia_Value definitions, name;
-    definitions = Arcadia_ValueStack_getValue(thread, 4);
-    name = Arcadia_ValueStack_getValue(thread, 3);
+    definitions = Arcadia_ValueStack_getValue(thread, 5);
+    name = Arcadia_ValueStack_getValue(thread, 4);
     Arcadia_ValueStack_pushValue(thread, &definitions);
     Arcadia_ValueStack_pushValue(thread, &name);
     Arcadia_ValueStack_pushNatural8Value(thread, 2);
     Arcadia_superTypeConstructor(thread, _type, self);
   }
-  if (4 != _numberOfArguments) {
+  if (5 != _numberOfArguments) {
     Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
     Arcadia_Thread_jump(thread);
   }
   self->operations = (Arcadia_List*)Arcadia_ArrayList_create(thread);
-  self->width = Arcadia_ValueStack_getNatural32Value(thread, 2);
-  self->height = Arcadia_ValueStack_getNatural32Value(thread, 1);
+  self->pixels = NULL;
+  self->width = Arcadia_ValueStack_getNatural32Value(thread, 3);
+  self->height = Arcadia_ValueStack_getNatural32Value(thread, 2);
+  Arcadia_EnumerationValue pixelFormat = Arcadia_ValueStack_getEnumerationValue(thread, 1);
+  if (!Arcadia_Type_isDescendantType(thread, pixelFormat.type, _Arcadia_ADL_PixelFormat_getType(thread))) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentTypeInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->pixelFormat = pixelFormat.value;
   Arcadia_LeaveConstructor(Arcadia_ADL_PixelBufferDefinition);
 }
 
@@ -135,7 +146,8 @@ Arcadia_ADL_PixelBufferDefinition_create
     Arcadia_ADL_Definitions* definitions,
     Arcadia_String* name,
     Arcadia_Natural32Value width,
-    Arcadia_Natural32Value height
+    Arcadia_Natural32Value height,
+    Arcadia_ADL_PixelFormat pixelFormat
   )
 {
   Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
@@ -143,6 +155,7 @@ Arcadia_ADL_PixelBufferDefinition_create
   Arcadia_ValueStack_pushObjectReferenceValue(thread, (Arcadia_Object*)name);
   Arcadia_ValueStack_pushNatural32Value(thread,width);
   Arcadia_ValueStack_pushNatural32Value(thread, height);
-  Arcadia_ValueStack_pushNatural8Value(thread, 4);
+  Arcadia_ValueStack_pushEnumerationValue(thread, Arcadia_EnumerationValue_make(_Arcadia_ADL_PixelFormat_getType(thread), pixelFormat));
+  Arcadia_ValueStack_pushNatural8Value(thread, 5);
   ARCADIA_CREATEOBJECT(Arcadia_ADL_PixelBufferDefinition);
 }
@@ -20,7 +20,9 @@
   #error("do not include directly, include `Arcadia/ADL/Include.h` instead")
 #endif
 #include "Arcadia/ADL/Definition.h"
+#include "Arcadia/ADL/Definitions/Visuals/PixelFormat.h"
 #include "Arcadia/Collections/Include.h"
+typedef struct Arcadia_ADL_PackEntry Arcadia_ADL_PackEntry;
 
 // A definition of a pixel buffer.
 //
@@ -30,10 +32,16 @@
 //   name  : "MyGame.CheckerboardPixelBuffer",
 //   width : 320,
 //   height : 240,
+//   pixelFormat : "RedGreenBlueAlphaNatural8",
 //   operations : [ ... ],
 // }
 // @endcode
 //
+// The pixel format is the name of an element of Arcadia.ADL.PixelFormat.
+//
+// Pixel buffer definitions loaded from an asset pack have no operations.
+// Their pixels were baked into the pack, see Arcadia.ADL.PixelBufferDefinition.pixels.
+//
 // @code
 // class Arcadia.ADL.PixelBufferDefinition extends Arcadia.ADL.Definition {
 //
@@ -54,8 +62,13 @@ struct Arcadia_ADL_PixelBufferDefinition {
   Arcadia_Natural32Value width;
   /// The height, in pixels, of the pixel bufer.
   Arcadia_Natural32Value height;
+  /// The pixel format of the pixel buffer.
+  Arcadia_ADL_PixelFormat pixelFormat;
   /// The list of operations.
   Arcadia_List* operations;
+  /// The baked pixels if this definition was loaded from an asset pack, null otherwise.
+  /// The rows are stored from top to bottom without line padding.
+  Arcadia_ADL_PackEntry* pixels;
 };
 
 Arcadia_ADL_PixelBufferDefinition*
@@ -65,7 +78,8 @@ Arcadia_ADL_PixelBufferDefinition_create
     Arcadia_ADL_Definitions* definitions,
     Arcadia_String* name,
     Arcadia_Natural32Value width,
-    Arcadia_Natural32Value height
+    Arcadia_Natural32Value height,
+    Arcadia_ADL_PixelFormat pixelFormat
   );
 
 #endif  // ARCADIA_ADL_DEFINITIONS_VISUALS_PIXELBUFFERDEFINITION_H_INCLUDED
@@ -59,6 +59,13 @@ static const char* SCHEMA =
 "      },\n"
 "      {\n"
 "        kind : \"MapEntry\",\n"
+"        name : \"pixelFormat\",\n"
+"        type : {\n"
+"          kind : \"String\",\n"
+"        },\n"
+"      },\n"
+"      {\n"
+"        kind : \"MapEntry\",\n"
 "        name : \"operations\",\n"
 "        type : {\n"
 "          kind : \"List\",\n"
@@ -79,6 +86,15 @@ Arcadia_ADL_PixelBufferReader_getTypeName
     Arcadia_ADL_PixelBufferReader* self
   );
 
+static Arcadia_ADL_PixelFormat
+getPixelFormatValue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PixelBufferReader* self,
+    Arcadia_DDL_MapNode* mapNode,
+    Arcadia_String* key
+  );
+
 static Arcadia_ADL_PixelBufferDefinition*
 Arcadia_ADL_PixelBufferReader_read
   (
@@ -134,6 +150,39 @@ Arcadia_ADL_PixelBufferReader_getTypeName
   )
 { return self->TYPENAME; }
 
+static Arcadia_ADL_PixelFormat
+getPixelFormatValue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PixelBufferReader* self,
+    Arcadia_DDL_MapNode* mapNode,
+    Arcadia_String* key
+  )
+{
+  static const struct {
+    const char* name;
+    Arcadia_ADL_PixelFormat value;
+  } PIXELFORMATS[] = {
+    { u8"AlphaBlueGreenRedNatural8", Arcadia_ADL_PixelFormat_AlphaBlueGreenRedNatural8 },
+    { u8"AlphaGrayNatural8", Arcadia_ADL_PixelFormat_AlphaGrayNatural8 },
+    { u8"AlphaRedGreenBlueNatural8", Arcadia_ADL_PixelFormat_AlphaRedGreenBlueNatural8 },
+    { u8"BlueGreenRedNatural8", Arcadia_ADL_PixelFormat_BlueGreenRedNatural8 },
+    { u8"BlueGreenRedAlphaNatural8", Arcadia_ADL_PixelFormat_BlueGreenRedAlphaNatural8 },
+    { u8"GrayNatural8", Arcadia_ADL_PixelFormat_GrayNatural8 },
+    { u8"GrayAlphaNatural8", Arcadia_ADL_PixelFormat_GrayAlphaNatural8 },
+    { u8"RedGreenBlueNatural8", Arcadia_ADL_PixelFormat_RedGreenBlueNatural8 },
+    { u8"RedGreenBlueAlphaNatural8", Arcadia_ADL_PixelFormat_RedGreenBlueAlphaNatural8 },
+  };
+  Arcadia_String* a = Arcadia_ADL_Reader_getStringValue(thread, mapNode, key);
+  for (Arcadia_SizeValue i = 0; i < sizeof(PIXELFORMATS) / sizeof(PIXELFORMATS[0]); ++i) {
+    if (Arcadia_String_isEqualTo_pn(thread, a, PIXELFORMATS[i].name, strlen(PIXELFORMATS[i].name))) {
+      return PIXELFORMATS[i].value;
+    }
+  }
+  Arcadia_Thread_setStatus(thread, Arcadia_Status_SemanticalError);
+  Arcadia_Thread_jump(thread);
+}
+
 static Arcadia_ADL_PixelBufferDefinition*
 Arcadia_ADL_PixelBufferReader_read
   (
@@ -150,6 +199,7 @@ Arcadia_ADL_PixelBufferReader_read
   Arcadia_String* name = Arcadia_ADL_Reader_getStringValue(thread, (Arcadia_DDL_MapNode*)input, self->NAME);
   Arcadia_Natural32Value width = Arcadia_ADL_Reader_getNatural32Value(thread, (Arcadia_DDL_MapNode*)input, self->WIDTH);
   Arcadia_Natural32Value height = Arcadia_ADL_Reader_getNatural32Value(thread, (Arcadia_DDL_MapNode*)input, self->HEIGHT);
+  Arcadia_ADL_PixelFormat pixelFormat = getPixelFormatValue(thread, self, (Arcadia_DDL_MapNode*)input, self->PIXELFORMAT);
 
   // Assert the definition has the correct type.
   Arcadia_Value t = Arcadia_Value_makeObjectReferenceValue(self->TYPENAME);
@@ -158,7 +208,7 @@ Arcadia_ADL_PixelBufferReader_read
     Arcadia_Thread_jump(thread);
   }
 
-  Arcadia_ADL_PixelBufferDefinition* definition = Arcadia_ADL_PixelBufferDefinition_create(thread, definitions, name, width, height);
+  Arcadia_ADL_PixelBufferDefinition* definition = Arcadia_ADL_PixelBufferDefinition_create(thread, definitions, name, width, height, pixelFormat);
 
   // Get the list.
   Arcadia_List* operations = Arcadia_ADL_Reader_getListValue(thread, (Arcadia_DDL_MapNode*)input, self->OPERATIONS);
@@ -206,6 +256,7 @@ Arcadia_ADL_PixelBufferReader_constructImpl
   self->OPERATIONS = Arcadia_Languages_StringTable_getOrCreateStringFromCxxString(thread, Arcadia_Languages_StringTable_getOrCreate(thread), u8"operations");
   self->WIDTH = Arcadia_Languages_StringTable_getOrCreateStringFromCxxString(thread, Arcadia_Languages_StringTable_getOrCreate(thread), u8"width");
   self->HEIGHT = Arcadia_Languages_StringTable_getOrCreateStringFromCxxString(thread, Arcadia_Languages_StringTable_getOrCreate(thread), u8"height");
+  self->PIXELFORMAT = Arcadia_Languages_StringTable_getOrCreateStringFromCxxString(thread, Arcadia_Languages_StringTable_getOrCreate(thread), u8"pixelFormat");
   //
   Arcadia_LeaveConstructor(Arcadia_ADL_PixelBufferReader);
 }
@@ -253,6 +304,9 @@ Arcadia_ADL_PixelBufferReader_visitImpl
   if (self->HEIGHT) {
     Arcadia_Object_visit(thread, (Arcadia_Object*)self->HEIGHT);
   }
+  if (self->PIXELFORMAT) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->PIXELFORMAT);
+  }
 }
 
 Arcadia_ADL_PixelBufferReader*
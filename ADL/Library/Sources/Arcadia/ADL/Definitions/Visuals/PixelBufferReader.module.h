@@ -46,6 +46,8 @@ struct Arcadia_ADL_PixelBufferReader {
   Arcadia_String* WIDTH;
   // The string `height` cached here.
   Arcadia_String* HEIGHT;
+  // The string `pixelFormat` cached here.
+  Arcadia_String* PIXELFORMAT;
 
 
   // The validation context. Cached here.
@@ -0,0 +1,55 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_ADL_DEFINITIONS_VISUALS_PIXELFORMAT_H_INCLUDED)
+#define ARCADIA_ADL_DEFINITIONS_VISUALS_PIXELFORMAT_H_INCLUDED
+
+#if !defined(ARCADIA_ADL_MODULE)
+  #error("do not include directly, include `Arcadia/ADL/Include.h` instead")
+#endif
+#include "Arcadia/ADL/Definition.h"
+
+// Enumeration of pixel formats.
+// The values are the values of the Arcadia.Media.PixelFormat elements of the same names.
+// Keep in sync with Arcadia_Media_PixelFormat.
+//
+// @code
+// enumeration Arcadia.ADL.PixelFormat {
+//   AlphaBlueGreenRedNatural8,
+//   AlphaGrayNatural8,
+//   AlphaRedGreenBlueNatural8,
+//   BlueGreenRedNatural8,
+//   BlueGreenRedAlphaNatural8,
+//   GrayNatural8,
+//   GrayAlphaNatural8,
+//   RedGreenBlueNatural8,
+//   RedGreenBlueAlphaNatural8,
+// };
+// @endcode
+Arcadia_declareEnumerationType(u8"Arcadia.ADL.PixelFormat", Arcadia_ADL_PixelFormat);
+
+enum Arcadia_ADL_PixelFormat {
+  Arcadia_ADL_PixelFormat_AlphaBlueGreenRedNatural8,
+  Arcadia_ADL_PixelFormat_AlphaGrayNatural8,
+  Arcadia_ADL_PixelFormat_AlphaRedGreenBlueNatural8,
+  Arcadia_ADL_PixelFormat_BlueGreenRedNatural8,
+  Arcadia_ADL_PixelFormat_BlueGreenRedAlphaNatural8,
+  Arcadia_ADL_PixelFormat_GrayNatural8,
+  Arcadia_ADL_PixelFormat_GrayAlphaNatural8,
+  Arcadia_ADL_PixelFormat_RedGreenBlueNatural8,
+  Arcadia_ADL_PixelFormat_RedGreenBlueAlphaNatural8,
+};
+
+#endif  // ARCADIA_ADL_DEFINITIONS_VISUALS_PIXELFORMAT_H_INCLUDED
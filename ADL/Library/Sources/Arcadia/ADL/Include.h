@@ -34,6 +34,11 @@
 #include "Arcadia/ADL/Definitions/Audials/Include.h"
 #include "Arcadia/ADL/Definitions/Visuals/Include.h"
 
+#include "Arcadia/ADL/Pack/PackFormat.h"
+#include "Arcadia/ADL/Pack/Pack.h"
+#include "Arcadia/ADL/Pack/PackEntry.h"
+#include "Arcadia/ADL/Pack/PackWriter.h"
+
 #undef ARCADIA_ADL_EXPORT
 #pragma pop_macro("ARCADIA_ADL_EXPORT")
 
@@ -0,0 +1,424 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#define ARCADIA_ADL_MODULE (1)
+#include "Arcadia/ADL/Pack/Pack.h"
+
+#include "Arcadia/ADL/Pack/PackEntry.h"
+#include "Arcadia/ADL/Pack/PackFormat.h"
+
+static Arcadia_SizeValue
+toSize
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural64Value value
+  );
+
+static Arcadia_SizeValue
+multiply
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SizeValue x,
+    Arcadia_SizeValue y
+  );
+
+static void
+validateRange
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Pack* self,
+    Arcadia_SizeValue offset,
+    Arcadia_SizeValue length
+  );
+
+static void
+validateParameters
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural32Value kind,
+    Arcadia_Natural8Value const* parameters,
+    Arcadia_SizeValue dataLength
+  );
+
+static void
+validate
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Pack* self
+  );
+
+static void
+Arcadia_ADL_Pack_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Pack* self
+  );
+
+static void
+Arcadia_ADL_Pack_destructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Pack* self
+  );
+
+static void
+Arcadia_ADL_Pack_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackDispatch* self
+  );
+
+static void
+Arcadia_ADL_Pack_visitImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Pack* self
+  );
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_ADL_Pack_constructImpl,
+  .destruct = (Arcadia_Object_DestructCallbackFunction*)&Arcadia_ADL_Pack_destructImpl,
+  .visit = (Arcadia_Object_VisitCallbackFunction*)&Arcadia_ADL_Pack_visitImpl,
+  .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_ADL_Pack_initializeDispatchImpl,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.ADL.Pack", Arcadia_ADL_Pack,
+                         u8"Arcadia.Object", Arcadia_Object,
+                         &_typeOperations);
+
+static Arcadia_SizeValue
+toSize
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural64Value value
+  )
+{
+  if (value > Arcadia_SizeValue_Maximum) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  return (Arcadia_SizeValue)value;
+}
+
+static Arcadia_SizeValue
+multiply
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SizeValue x,
+    Arcadia_SizeValue y
+  )
+{
+  Arcadia_SizeValue high, low;
+  if (!Arcadia_safeMultiplySizeValue(thread, x, y, &high, &low)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  return low;
+}
+
+static Arcadia_SizeValue
+add
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SizeValue x,
+    Arcadia_SizeValue y
+  )
+{
+  Arcadia_SizeValue high, low;
+  Arcadia_safeAddFullSizeValue(thread, x, y, &high, &low);
+  if (high) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  return low;
+}
+
+static void
+validateRange
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Pack* self,
+    Arcadia_SizeValue offset,
+    Arcadia_SizeValue length
+  )
+{
+  if (offset > self->numberOfBytes || length > self->numberOfBytes - offset) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+}
+
+// Consumers trust the parameters of an entry to describe its data.
+// Hence the number of Bytes implied by the parameters must be the number of Bytes of the data.
+static void
+validateParameters
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural32Value kind,
+    Arcadia_Natural8Value const* parameters,
+    Arcadia_SizeValue dataLength
+  )
+{
+  Arcadia_SizeValue p0 = Arcadia_ADL_PackFormat_readNatural32(parameters + 0),
+                    p1 = Arcadia_ADL_PackFormat_readNatural32(parameters + 4),
+                    p2 = Arcadia_ADL_PackFormat_readNatural32(parameters + 8),
+                    p3 = Arcadia_ADL_PackFormat_readNatural32(parameters + 12);
+  Arcadia_SizeValue expectedDataLength;
+  switch (kind) {
+    case Arcadia_ADL_PackFormat_Kind_PixelBuffer: {
+      // width * height * bytes per pixel
+      Arcadia_SizeValue bytesPerPixel = Arcadia_ADL_PackFormat_getBytesPerPixel((Arcadia_Natural32Value)p2);
+      if (!bytesPerPixel) {
+        Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+        Arcadia_Thread_jump(thread);
+      }
+      expectedDataLength = multiply(thread, multiply(thread, p0, p1), bytesPerPixel);
+    } break;
+    case Arcadia_ADL_PackFormat_Kind_SampleBuffer: {
+      // length * sample rate * number of channels * bytes per sample
+      Arcadia_SizeValue bytesPerSample = Arcadia_ADL_PackFormat_getBytesPerSample((Arcadia_Natural32Value)p2);
+      if (!bytesPerSample) {
+        Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+        Arcadia_Thread_jump(thread);
+      }
+      expectedDataLength = multiply(thread, multiply(thread, multiply(thread, p0, p1), p3), bytesPerSample);
+    } break;
+    case Arcadia_ADL_PackFormat_Kind_Mesh: {
+      // number of vertices * vertex stride + number of Bytes of the ambient color name
+      if (p1 != Arcadia_ADL_PackFormat_MeshVertexStride || !p2) {
+        Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+        Arcadia_Thread_jump(thread);
+      }
+      expectedDataLength = add(thread, multiply(thread, p0, p1), p2);
+    } break;
+    default: {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+      Arcadia_Thread_jump(thread);
+    } break;
+  }
+  if (expectedDataLength != dataLength) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+}
+
+static void
+validate
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Pack* self
+  )
+{
+  Arcadia_Natural8Value const* p = self->bytes;
+  // Header.
+  validateRange(thread, self, 0, Arcadia_ADL_PackFormat_HeaderSize);
+  if (p[0] != Arcadia_ADL_PackFormat_Magic0 || p[1] != Arcadia_ADL_PackFormat_Magic1 ||
+      p[2] != Arcadia_ADL_PackFormat_Magic2 || p[3] != Arcadia_ADL_PackFormat_Magic3) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  if (Arcadia_ADL_PackFormat_readNatural32(p + 4) != Arcadia_ADL_PackFormat_Version) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->numberOfEntries = Arcadia_ADL_PackFormat_readNatural32(p + 8);
+  self->indexOffset = toSize(thread, Arcadia_ADL_PackFormat_readNatural64(p + 16));
+  if (self->numberOfEntries > Arcadia_SizeValue_Maximum / Arcadia_ADL_PackFormat_IndexEntrySize) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  validateRange(thread, self, self->indexOffset, self->numberOfEntries * Arcadia_ADL_PackFormat_IndexEntrySize);
+  // Index.
+  Arcadia_Natural8Value const* previousName = NULL;
+  Arcadia_SizeValue previousNameLength = 0;
+  for (Arcadia_SizeValue i = 0; i < self->numberOfEntries; ++i) {
+    Arcadia_Natural8Value const* q = p + self->indexOffset + i * Arcadia_ADL_PackFormat_IndexEntrySize;
+    Arcadia_SizeValue nameOffset = toSize(thread, Arcadia_ADL_PackFormat_readNatural64(q + 0));
+    Arcadia_SizeValue nameLength = Arcadia_ADL_PackFormat_readNatural32(q + 8);
+    Arcadia_Natural32Value kind = Arcadia_ADL_PackFormat_readNatural32(q + 12);
+    Arcadia_SizeValue dataOffset = toSize(thread, Arcadia_ADL_PackFormat_readNatural64(q + 32));
+    Arcadia_SizeValue dataLength = toSize(thread, Arcadia_ADL_PackFormat_readNatural64(q + 40));
+    validateRange(thread, self, nameOffset, nameLength);
+    validateRange(thread, self, dataOffset, dataLength);
+    if (dataOffset % Arcadia_ADL_PackFormat_DataAlignment) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+      Arcadia_Thread_jump(thread);
+    }
+    validateParameters(thread, kind, q + 16, dataLength);
+    // The entries must be sorted strictly ascending by their names for the binary search in getEntryOrNull.
+    if (i > 0 && Arcadia_ADL_PackFormat_compareNames(thread, previousName, previousNameLength, p + nameOffset, nameLength) >= 0) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+      Arcadia_Thread_jump(thread);
+    }
+    previousName = p + nameOffset;
+    previousNameLength = nameLength;
+  }
+}
+
+static void
+Arcadia_ADL_Pack_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Pack* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_ADL_Pack);
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  if (1 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  //
+  self->entries = NULL;
+  self->mapping = Arcadia_ValueStack_getObjectReferenceValueChecked(thread, 1, _Arcadia_FileMapping_getType(thread));
+  self->bytes = Arcadia_FileMapping_getBytes(thread, self->mapping);
+  self->numberOfBytes = Arcadia_FileMapping_getNumberOfBytes(thread, self->mapping);
+  self->indexOffset = 0;
+  self->numberOfEntries = 0;
+  validate(thread, self);
+  self->entries = Arcadia_Memory_allocateUnmanaged(thread, (self->numberOfEntries ? self->numberOfEntries : 1) * sizeof(Arcadia_ADL_PackEntry*));
+  for (Arcadia_SizeValue i = 0; i < self->numberOfEntries; ++i) {
+    self->entries[i] = NULL;
+  }
+  //
+  Arcadia_LeaveConstructor(Arcadia_ADL_Pack);
+}
+
+static void
+Arcadia_ADL_Pack_destructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Pack* self
+  )
+{
+  if (self->entries) {
+    Arcadia_Memory_deallocateUnmanaged(thread, self->entries);
+    self->entries = NULL;
+  }
+}
+
+static void
+Arcadia_ADL_Pack_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackDispatch* self
+  )
+{/*Intentionally empty.*/}
+
+static void
+Arcadia_ADL_Pack_visitImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Pack* self
+  )
+{
+  if (self->mapping) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->mapping);
+  }
+  if (self->entries) {
+    for (Arcadia_SizeValue i = 0; i < self->numberOfEntries; ++i) {
+      if (self->entries[i]) {
+        Arcadia_Object_visit(thread, (Arcadia_Object*)self->entries[i]);
+      }
+    }
+  }
+}
+
+Arcadia_ADL_Pack*
+Arcadia_ADL_Pack_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping* mapping
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  Arcadia_ValueStack_pushObjectReferenceValue(thread, (Arcadia_Object*)mapping);
+  Arcadia_ValueStack_pushNatural8Value(thread, 1);
+  ARCADIA_CREATEOBJECT(Arcadia_ADL_Pack);
+}
+
+Arcadia_ADL_Pack*
+Arcadia_ADL_Pack_createFromFile
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FilePath* path
+  )
+{
+  Arcadia_FileSystem* fileSystem = Arcadia_FileSystem_getOrCreate(thread);
+  return Arcadia_ADL_Pack_create(thread, Arcadia_FileSystem_mapFile(thread, fileSystem, path));
+}
+
+Arcadia_SizeValue
+Arcadia_ADL_Pack_getNumberOfEntries
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Pack* self
+  )
+{ return self->numberOfEntries; }
+
+Arcadia_ADL_PackEntry*
+Arcadia_ADL_Pack_getEntryAt
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Pack* self,
+    Arcadia_SizeValue index
+  )
+{
+  if (index >= self->numberOfEntries) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  if (!self->entries[index]) {
+    self->entries[index] = Arcadia_ADL_PackEntry_create(thread, self, index);
+  }
+  return self->entries[index];
+}
+
+Arcadia_ADL_PackEntry*
+Arcadia_ADL_Pack_getEntryOrNull
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Pack* self,
+    Arcadia_String* name
+  )
+{
+  Arcadia_Natural8Value const* nameBytes = Arcadia_String_getBytes(thread, name);
+  Arcadia_SizeValue nameLength = Arcadia_String_getNumberOfBytes(thread, name);
+  Arcadia_SizeValue l = 0, r = self->numberOfEntries;
+  while (l < r) {
+    Arcadia_SizeValue m = l + (r - l) / 2;
+    Arcadia_Natural8Value const* q = self->bytes + self->indexOffset + m * Arcadia_ADL_PackFormat_IndexEntrySize;
+    Arcadia_SizeValue otherOffset = (Arcadia_SizeValue)Arcadia_ADL_PackFormat_readNatural64(q + 0);
+    Arcadia_SizeValue otherLength = Arcadia_ADL_PackFormat_readNatural32(q + 8);
+    Arcadia_Integer32Value c = Arcadia_ADL_PackFormat_compareNames(thread, self->bytes + otherOffset, otherLength, nameBytes, nameLength);
+    if (c < 0) {
+      l = m + 1;
+    } else if (c > 0) {
+      r = m;
+    } else {
+      return Arcadia_ADL_Pack_getEntryAt(thread, self, m);
+    }
+  }
+  return NULL;
+}
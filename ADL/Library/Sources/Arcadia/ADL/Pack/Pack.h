@@ -0,0 +1,129 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_ADL_PACK_PACK_H_INCLUDED)
+#define ARCADIA_ADL_PACK_PACK_H_INCLUDED
+
+#if !defined(ARCADIA_ADL_MODULE)
+  #error("do not include directly, include `Arcadia/ADL/Include.h` instead")
+#endif
+#include "Arcadia/Ring2/Include.h"
+#include "Arcadia/FileSystem/Include.h"
+typedef struct Arcadia_ADL_PackEntry Arcadia_ADL_PackEntry;
+
+// @brief A baked asset pack in the format described in `Arcadia/ADL/Pack/PackFormat.h`.
+// The pack reads directly from a file mapping: the data of the entries is never copied.
+// The header and the index are validated when the pack is created.
+// The entry objects are created when they are first requested.
+// @code
+// class Arcadia.ADL.Pack extends Arcadia.Object {
+//
+//   constructor(mapping : Arcadia.FileMapping)
+//
+//   method getNumberOfEntries() : Arcadia.Size
+//
+//   method getEntryAt(index : Arcadia.Size) : Arcadia.ADL.PackEntry
+//
+//   method getEntryOrNull(name : Arcadia.String) : Arcadia.ADL.PackEntry
+//
+// };
+// @endcode
+Arcadia_declareObjectType(u8"Arcadia.ADL.Pack", Arcadia_ADL_Pack,
+                          u8"Arcadia.Object");
+
+struct Arcadia_ADL_PackDispatch {
+  Arcadia_ObjectDispatch _parent;
+};
+
+struct Arcadia_ADL_Pack {
+  Arcadia_Object _parent;
+  /// The file mapping providing the Bytes of this pack.
+  Arcadia_FileMapping* mapping;
+  /// The Bytes of this pack.
+  Arcadia_Natural8Value const* bytes;
+  /// The number of Bytes of this pack.
+  Arcadia_SizeValue numberOfBytes;
+  /// The offset of the index.
+  Arcadia_SizeValue indexOffset;
+  /// The number of entries.
+  Arcadia_SizeValue numberOfEntries;
+  /// The entry objects or null pointers for entry objects not created yet.
+  Arcadia_ADL_PackEntry** entries;
+};
+
+/// @brief Create a pack.
+/// @param thread A pointer to this thread.
+/// @param mapping A pointer to the file mapping providing the Bytes of the pack.
+/// @return A pointer to the pack.
+/// @error Arcadia_Status_EncodingInvalid the header or the index of the pack is invalid
+Arcadia_ADL_Pack*
+Arcadia_ADL_Pack_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping* mapping
+  );
+
+/// @brief Create a pack from a file.
+/// @param thread A pointer to this thread.
+/// @param path The path of the file.
+/// @return A pointer to the pack.
+/// @error Arcadia_Status_EncodingInvalid the header or the index of the pack is invalid
+/// @error see Arcadia_FileSystem_mapFile
+Arcadia_ADL_Pack*
+Arcadia_ADL_Pack_createFromFile
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FilePath* path
+  );
+
+/// @brief Get the number of entries of this pack.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this pack.
+/// @return The number of entries.
+Arcadia_SizeValue
+Arcadia_ADL_Pack_getNumberOfEntries
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Pack* self
+  );
+
+/// @brief Get an entry of this pack by its index.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this pack.
+/// @param index The index of the entry. The entries are ordered by their names.
+/// @return A pointer to the entry.
+/// @error Arcadia_Status_ArgumentValueInvalid @a index is greater than or equal to the number of entries
+Arcadia_ADL_PackEntry*
+Arcadia_ADL_Pack_getEntryAt
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Pack* self,
+    Arcadia_SizeValue index
+  );
+
+/// @brief Get an entry of this pack by its name.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this pack.
+/// @param name The name of the entry.
+/// @return A pointer to the entry if it exists, the null pointer otherwise.
+Arcadia_ADL_PackEntry*
+Arcadia_ADL_Pack_getEntryOrNull
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Pack* self,
+    Arcadia_String* name
+  );
+
+#endif // ARCADIA_ADL_PACK_PACK_H_INCLUDED
@@ -0,0 +1,178 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#define ARCADIA_ADL_MODULE (1)
+#include "Arcadia/ADL/Pack/PackEntry.h"
+
+#include "Arcadia/ADL/Pack/Pack.h"
+#include "Arcadia/ADL/Pack/PackFormat.h"
+
+static void
+Arcadia_ADL_PackEntry_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackEntry* self
+  );
+
+static void
+Arcadia_ADL_PackEntry_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackEntryDispatch* self
+  );
+
+static void
+Arcadia_ADL_PackEntry_visitImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackEntry* self
+  );
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_ADL_PackEntry_constructImpl,
+  .visit = (Arcadia_Object_VisitCallbackFunction*)&Arcadia_ADL_PackEntry_visitImpl,
+  .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_ADL_PackEntry_initializeDispatchImpl,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.ADL.PackEntry", Arcadia_ADL_PackEntry,
+                         u8"Arcadia.Object", Arcadia_Object,
+                         &_typeOperations);
+
+static void
+Arcadia_ADL_PackEntry_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackEntry* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_ADL_PackEntry);
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  if (2 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->pack = Arcadia_ValueStack_getObjectReferenceValueChecked(thread, 2, _Arcadia_ADL_Pack_getType(thread));
+  Arcadia_SizeValue index = Arcadia_ValueStack_getSizeValue(thread, 1);
+  if (index >= self->pack->numberOfEntries) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  // The index entry was validated when the pack was created.
+  Arcadia_Natural8Value const* q = self->pack->bytes + self->pack->indexOffset + index * Arcadia_ADL_PackFormat_IndexEntrySize;
+  Arcadia_SizeValue nameOffset = (Arcadia_SizeValue)Arcadia_ADL_PackFormat_readNatural64(q + 0);
+  Arcadia_SizeValue nameLength = Arcadia_ADL_PackFormat_readNatural32(q + 8);
+  self->name = Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_create(thread, self->pack->bytes + nameOffset, nameLength)));
+  self->kind = Arcadia_ADL_PackFormat_readNatural32(q + 12);
+  for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+    self->parameters[i] = Arcadia_ADL_PackFormat_readNatural32(q + 16 + i * 4);
+  }
+  self->bytes = self->pack->bytes + (Arcadia_SizeValue)Arcadia_ADL_PackFormat_readNatural64(q + 32);
+  self->numberOfBytes = (Arcadia_SizeValue)Arcadia_ADL_PackFormat_readNatural64(q + 40);
+  Arcadia_LeaveConstructor(Arcadia_ADL_PackEntry);
+}
+
+static void
+Arcadia_ADL_PackEntry_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackEntryDispatch* self
+  )
+{/*Intentionally empty.*/}
+
+static void
+Arcadia_ADL_PackEntry_visitImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackEntry* self
+  )
+{
+  if (self->pack) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->pack);
+  }
+  if (self->name) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->name);
+  }
+}
+
+Arcadia_ADL_PackEntry*
+Arcadia_ADL_PackEntry_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Pack* pack,
+    Arcadia_SizeValue index
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  Arcadia_ValueStack_pushObjectReferenceValue(thread, (Arcadia_Object*)pack);
+  Arcadia_ValueStack_pushSizeValue(thread, index);
+  Arcadia_ValueStack_pushNatural8Value(thread, 2);
+  ARCADIA_CREATEOBJECT(Arcadia_ADL_PackEntry);
+}
+
+Arcadia_String*
+Arcadia_ADL_PackEntry_getName
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackEntry* self
+  )
+{ return self->name; }
+
+Arcadia_Natural32Value
+Arcadia_ADL_PackEntry_getKind
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackEntry* self
+  )
+{ return self->kind; }
+
+Arcadia_Natural32Value
+Arcadia_ADL_PackEntry_getParameter
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackEntry* self,
+    Arcadia_SizeValue index
+  )
+{
+  if (index >= 4) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  return self->parameters[index];
+}
+
+Arcadia_Natural8Value const*
+Arcadia_ADL_PackEntry_getBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackEntry* self
+  )
+{ return self->bytes; }
+
+Arcadia_SizeValue
+Arcadia_ADL_PackEntry_getNumberOfBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackEntry* self
+  )
+{ return self->numberOfBytes; }
@@ -0,0 +1,116 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_ADL_PACK_PACKENTRY_H_INCLUDED)
+#define ARCADIA_ADL_PACK_PACKENTRY_H_INCLUDED
+
+#if !defined(ARCADIA_ADL_MODULE)
+  #error("do not include directly, include `Arcadia/ADL/Include.h` instead")
+#endif
+#include "Arcadia/Ring2/Include.h"
+typedef struct Arcadia_ADL_Pack Arcadia_ADL_Pack;
+
+// @brief An entry of a baked asset pack.
+// The Bytes of the entry point into the file mapping of its pack.
+// They remain valid as long as the entry is alive.
+// @code
+// class Arcadia.ADL.PackEntry extends Arcadia.Object {
+//
+//   constructor(pack : Arcadia.ADL.Pack, index : Arcadia.Size)
+//
+// };
+// @endcode
+Arcadia_declareObjectType(u8"Arcadia.ADL.PackEntry", Arcadia_ADL_PackEntry,
+                          u8"Arcadia.Object");
+
+struct Arcadia_ADL_PackEntryDispatch {
+  Arcadia_ObjectDispatch _parent;
+};
+
+struct Arcadia_ADL_PackEntry {
+  Arcadia_Object _parent;
+  /// The pack of this entry.
+  Arcadia_ADL_Pack* pack;
+  /// The name of this entry.
+  Arcadia_String* name;
+  /// The kind of this entry. One of Arcadia_ADL_PackFormat_Kind_*.
+  Arcadia_Natural32Value kind;
+  /// The parameters of this entry.
+  Arcadia_Natural32Value parameters[4];
+  /// A pointer to the Bytes of this entry.
+  Arcadia_Natural8Value const* bytes;
+  /// The number of Bytes of this entry.
+  Arcadia_SizeValue numberOfBytes;
+};
+
+/// @brief Create a pack entry.
+/// @param thread A pointer to this thread.
+/// @param pack A pointer to the pack.
+/// @param index The index of the entry in the pack.
+/// @return A pointer to the pack entry.
+Arcadia_ADL_PackEntry*
+Arcadia_ADL_PackEntry_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Pack* pack,
+    Arcadia_SizeValue index
+  );
+
+/// @brief Get the name of this pack entry.
+Arcadia_String*
+Arcadia_ADL_PackEntry_getName
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackEntry* self
+  );
+
+/// @brief Get the kind of this pack entry.
+/// @return One of Arcadia_ADL_PackFormat_Kind_*.
+Arcadia_Natural32Value
+Arcadia_ADL_PackEntry_getKind
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackEntry* self
+  );
+
+/// @brief Get a parameter of this pack entry.
+/// @param index The index of the parameter. Must be smaller than 4.
+/// @error Arcadia_Status_ArgumentValueInvalid @a index is greater than or equal to 4
+Arcadia_Natural32Value
+Arcadia_ADL_PackEntry_getParameter
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackEntry* self,
+    Arcadia_SizeValue index
+  );
+
+/// @brief Get a pointer to the Bytes of this pack entry.
+/// The pointer is aligned to Arcadia_ADL_PackFormat_DataAlignment Bytes.
+Arcadia_Natural8Value const*
+Arcadia_ADL_PackEntry_getBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackEntry* self
+  );
+
+/// @brief Get the number of Bytes of this pack entry.
+Arcadia_SizeValue
+Arcadia_ADL_PackEntry_getNumberOfBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackEntry* self
+  );
+
+#endif // ARCADIA_ADL_PACK_PACKENTRY_H_INCLUDED
@@ -0,0 +1,170 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_ADL_PACK_PACKFORMAT_H_INCLUDED)
+#define ARCADIA_ADL_PACK_PACKFORMAT_H_INCLUDED
+
+#if !defined(ARCADIA_ADL_MODULE)
+  #error("do not include directly, include `Arcadia/ADL/Include.h` instead")
+#endif
+#include "Arcadia/Ring2/Include.h"
+
+// The layout of a baked ADL asset pack.
+// All integers are unsigned and stored in little endian Byte order.
+// All offsets are Natural64 values relative to the first Byte of the pack.
+//
+// header
+//   Natural8[4] magic             'A', 'P', 'A', 'K'
+//   Natural32   version           Arcadia_ADL_PackFormat_Version
+//   Natural32   numberOfEntries
+//   Natural32   reserved          0
+//   Natural64   index             offset of the index
+//   Natural64   names             offset of the names
+//
+// index
+//   Arcadia_ADL_PackFormat_IndexEntrySize Bytes per entry, sorted strictly ascending by the Bytes of their names
+//   (see Arcadia_ADL_PackFormat_compareNames) such that entries can be binary searched.
+//   Natural64    name             offset of the UTF-8 Bytes of the name
+//   Natural32    nameLength       number of Bytes of the name
+//   Natural32    kind             one of Arcadia_ADL_PackFormat_Kind_*
+//   Natural32[4] parameters       interpretation depends on the kind
+//   Natural64    data             offset of the data, a multiple of Arcadia_ADL_PackFormat_DataAlignment
+//   Natural64    dataLength       number of Bytes of the data
+//
+// names
+//   the UTF-8 Bytes of the names
+//
+// data
+//   the data of the entries, each aligned to Arcadia_ADL_PackFormat_DataAlignment Bytes
+
+#define Arcadia_ADL_PackFormat_Magic0 ('A')
+#define Arcadia_ADL_PackFormat_Magic1 ('P')
+#define Arcadia_ADL_PackFormat_Magic2 ('A')
+#define Arcadia_ADL_PackFormat_Magic3 ('K')
+
+#define Arcadia_ADL_PackFormat_Version (2)
+
+#define Arcadia_ADL_PackFormat_HeaderSize (32)
+
+#define Arcadia_ADL_PackFormat_IndexEntrySize (48)
+
+#define Arcadia_ADL_PackFormat_DataAlignment (16)
+
+// A pixel buffer.
+// parameters are width, height, pixel format (an Arcadia_ADL_PixelFormat value), 0.
+// data are the pixels, rows from top to bottom, without line padding.
+#define Arcadia_ADL_PackFormat_Kind_PixelBuffer (1)
+
+// A sample buffer.
+// parameters are length (in seconds), sample rate (in Hz), sample format (an Arcadia_ADL_SampleFormat value), number of channels.
+// data are the samples.
+#define Arcadia_ADL_PackFormat_Kind_SampleBuffer (2)
+
+// A mesh.
+// parameters are number of vertices, vertex stride (in Bytes), number of Bytes of the ambient color name, 0.
+// data are the vertices followed by the UTF-8 Bytes of the name of the ambient color definition.
+// Each vertex is the position (3 x Real32), the ambient color (4 x Real32), and the ambient texture coordinates (2 x Real32).
+// Real32 values are stored in the representation of the baking platform.
+#define Arcadia_ADL_PackFormat_Kind_Mesh (3)
+
+// The stride, in Bytes, of a vertex of an Arcadia_ADL_PackFormat_Kind_Mesh entry.
+#define Arcadia_ADL_PackFormat_MeshVertexStride (36)
+
+// Get the number of Bytes of a pixel of the specified pixel format (an Arcadia_Media_PixelFormat value).
+// Return 0 if the pixel format is not known.
+// Keep in sync with Arcadia_Media_PixelFormat_getNumberOfBytes.
+static inline Arcadia_SizeValue
+Arcadia_ADL_PackFormat_getBytesPerPixel
+  (
+    Arcadia_Natural32Value pixelFormat
+  )
+{
+  static const Arcadia_SizeValue bytesPerPixel[] = {
+    4, // AlphaBlueGreenRedNatural8
+    2, // AlphaGrayNatural8
+    4, // AlphaRedGreenBlueNatural8
+    3, // BlueGreenRedNatural8
+    4, // BlueGreenRedAlphaNatural8
+    1, // GrayNatural8
+    2, // GrayAlphaNatural8
+    3, // RedGreenBlueNatural8
+    4, // RedGreenBlueAlphaNatural8
+  };
+  return pixelFormat < sizeof(bytesPerPixel) / sizeof(bytesPerPixel[0]) ? bytesPerPixel[pixelFormat] : 0;
+}
+
+// Get the number of Bytes of a sample of the specified sample format (an Arcadia_Media_SampleFormat value).
+// Return 0 if the sample format is not known.
+// Keep in sync with Arcadia_Media_SampleFormat_getNumberOfBytes.
+static inline Arcadia_SizeValue
+Arcadia_ADL_PackFormat_getBytesPerSample
+  (
+    Arcadia_Natural32Value sampleFormat
+  )
+{
+  static const Arcadia_SizeValue bytesPerSample[] = {
+    2, // Integer16
+    1, // Integer8
+    2, // Natural16
+    1, // Natural8
+    4, // Real32
+  };
+  return sampleFormat < sizeof(bytesPerSample) / sizeof(bytesPerSample[0]) ? bytesPerSample[sampleFormat] : 0;
+}
+
+// Read a Natural32 value stored in little endian Byte order.
+static inline Arcadia_Natural32Value
+Arcadia_ADL_PackFormat_readNatural32
+  (
+    Arcadia_Natural8Value const* p
+  )
+{
+  return ((Arcadia_Natural32Value)p[0] << 0)
+       | ((Arcadia_Natural32Value)p[1] << 8)
+       | ((Arcadia_Natural32Value)p[2] << 16)
+       | ((Arcadia_Natural32Value)p[3] << 24);
+}
+
+// Read a Natural64 value stored in little endian Byte order.
+static inline Arcadia_Natural64Value
+Arcadia_ADL_PackFormat_readNatural64
+  (
+    Arcadia_Natural8Value const* p
+  )
+{
+  return ((Arcadia_Natural64Value)Arcadia_ADL_PackFormat_readNatural32(p + 0) << 0)
+       | ((Arcadia_Natural64Value)Arcadia_ADL_PackFormat_readNatural32(p + 4) << 32);
+}
+
+// Compare two names.
+// The names are ordered by their Bytes first and by their lengths second.
+static inline Arcadia_Integer32Value
+Arcadia_ADL_PackFormat_compareNames
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value const* p,
+    Arcadia_SizeValue n,
+    Arcadia_Natural8Value const* q,
+    Arcadia_SizeValue m
+  )
+{
+  Arcadia_Integer32Value result = Arcadia_Memory_compare(thread, p, q, n < m ? n : m);
+  if (result) {
+    return result;
+  }
+  return n < m ? -1 : (n > m ? +1 : 0);
+}
+
+#endif // ARCADIA_ADL_PACK_PACKFORMAT_H_INCLUDED
@@ -0,0 +1,405 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#define ARCADIA_ADL_MODULE (1)
+#include "Arcadia/ADL/Pack/PackWriter.h"
+
+#include "Arcadia/ADL/Pack/PackFormat.h"
+
+struct Arcadia_ADL_PackWriter_Entry {
+  Arcadia_Natural32Value kind;
+  Arcadia_Natural32Value parameters[4];
+  // The offset of the data relative to the start of the data of the pack.
+  Arcadia_SizeValue dataOffset;
+  Arcadia_SizeValue dataLength;
+};
+
+static void
+writeNatural32
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_Natural32Value value
+  );
+
+static void
+writeNatural64
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_Natural64Value value
+  );
+
+static void
+writePadding
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_SizeValue numberOfBytes
+  );
+
+static Arcadia_SizeValue
+alignUp
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SizeValue value
+  );
+
+static Arcadia_Natural32Value
+toNatural32
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SizeValue value
+  );
+
+static void
+Arcadia_ADL_PackWriter_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackWriter* self
+  );
+
+static void
+Arcadia_ADL_PackWriter_destructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackWriter* self
+  );
+
+static void
+Arcadia_ADL_PackWriter_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackWriterDispatch* self
+  );
+
+static void
+Arcadia_ADL_PackWriter_visitImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackWriter* self
+  );
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_ADL_PackWriter_constructImpl,
+  .destruct = (Arcadia_Object_DestructCallbackFunction*)&Arcadia_ADL_PackWriter_destructImpl,
+  .visit = (Arcadia_Object_VisitCallbackFunction*)&Arcadia_ADL_PackWriter_visitImpl,
+  .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_ADL_PackWriter_initializeDispatchImpl,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.ADL.PackWriter", Arcadia_ADL_PackWriter,
+                         u8"Arcadia.Object", Arcadia_Object,
+                         &_typeOperations);
+
+static void
+writeNatural32
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_Natural32Value value
+  )
+{
+  Arcadia_Natural8Value bytes[4];
+  for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+    bytes[i] = (Arcadia_Natural8Value)(value >> (i * 8));
+  }
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, bytes, 4);
+}
+
+static void
+writeNatural64
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_Natural64Value value
+  )
+{
+  Arcadia_Natural8Value bytes[8];
+  for (Arcadia_SizeValue i = 0; i < 8; ++i) {
+    bytes[i] = (Arcadia_Natural8Value)(value >> (i * 8));
+  }
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, bytes, 8);
+}
+
+static void
+writePadding
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  static const Arcadia_Natural8Value zeroes[Arcadia_ADL_PackFormat_DataAlignment] = { 0 };
+  while (numberOfBytes > 0) {
+    Arcadia_SizeValue n = numberOfBytes < Arcadia_ADL_PackFormat_DataAlignment ? numberOfBytes : Arcadia_ADL_PackFormat_DataAlignment;
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, zeroes, n);
+    numberOfBytes -= n;
+  }
+}
+
+static Arcadia_SizeValue
+alignUp
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SizeValue value
+  )
+{
+  if (value > Arcadia_SizeValue_Maximum - (Arcadia_ADL_PackFormat_DataAlignment - 1)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  return (value + (Arcadia_ADL_PackFormat_DataAlignment - 1)) & ~(Arcadia_SizeValue)(Arcadia_ADL_PackFormat_DataAlignment - 1);
+}
+
+static Arcadia_Natural32Value
+toNatural32
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SizeValue value
+  )
+{
+  if (value > Arcadia_Natural32Value_Maximum) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  return (Arcadia_Natural32Value)value;
+}
+
+static void
+Arcadia_ADL_PackWriter_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackWriter* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_ADL_PackWriter);
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  if (0 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  //
+  self->indices = NULL;
+  self->names = NULL;
+  self->data = NULL;
+  self->entries = NULL;
+  self->numberOfEntries = 0;
+  self->entriesCapacity = 0;
+  //
+  self->indices = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
+  self->names = (Arcadia_List*)Arcadia_ArrayList_create(thread);
+  self->data = Arcadia_ByteArrayBuilder_create(thread);
+  self->entriesCapacity = 8;
+  self->entries = Arcadia_Memory_allocateUnmanaged(thread, self->entriesCapacity * sizeof(Arcadia_ADL_PackWriter_Entry));
+  //
+  Arcadia_LeaveConstructor(Arcadia_ADL_PackWriter);
+}
+
+static void
+Arcadia_ADL_PackWriter_destructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackWriter* self
+  )
+{
+  if (self->entries) {
+    Arcadia_Memory_deallocateUnmanaged(thread, self->entries);
+    self->entries = NULL;
+  }
+}
+
+static void
+Arcadia_ADL_PackWriter_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackWriterDispatch* self
+  )
+{/*Intentionally empty.*/}
+
+static void
+Arcadia_ADL_PackWriter_visitImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackWriter* self
+  )
+{
+  if (self->indices) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->indices);
+  }
+  if (self->names) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->names);
+  }
+  if (self->data) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->data);
+  }
+}
+
+Arcadia_ADL_PackWriter*
+Arcadia_ADL_PackWriter_create
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  Arcadia_ValueStack_pushNatural8Value(thread, 0);
+  ARCADIA_CREATEOBJECT(Arcadia_ADL_PackWriter);
+}
+
+void
+Arcadia_ADL_PackWriter_addEntry
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackWriter* self,
+    Arcadia_String* name,
+    Arcadia_Natural32Value kind,
+    Arcadia_Natural32Value const parameters[4],
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  if (kind != Arcadia_ADL_PackFormat_Kind_PixelBuffer && kind != Arcadia_ADL_PackFormat_Kind_SampleBuffer && kind != Arcadia_ADL_PackFormat_Kind_Mesh) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Value key = Arcadia_Value_makeObjectReferenceValue(name);
+  Arcadia_Value existing = Arcadia_Map_get(thread, self->indices, key);
+  if (!Arcadia_Value_isVoidValue(&existing)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  toNatural32(thread, self->numberOfEntries + 1);
+  toNatural32(thread, Arcadia_String_getNumberOfBytes(thread, name));
+  if (self->numberOfEntries == self->entriesCapacity) {
+    if (self->entriesCapacity > Arcadia_SizeValue_Maximum / sizeof(Arcadia_ADL_PackWriter_Entry) / 2) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_AllocationFailed);
+      Arcadia_Thread_jump(thread);
+    }
+    Arcadia_SizeValue newCapacity = self->entriesCapacity * 2;
+    Arcadia_Memory_reallocateUnmanaged(thread, (void**)&self->entries, newCapacity * sizeof(Arcadia_ADL_PackWriter_Entry));
+    self->entriesCapacity = newCapacity;
+  }
+  // Pad the data such that the data of this entry is aligned.
+  Arcadia_SizeValue dataOffset = alignUp(thread, Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, self->data));
+  writePadding(thread, self->data, dataOffset - Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, self->data));
+  if (numberOfBytes) {
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, self->data, bytes, numberOfBytes);
+  }
+  Arcadia_ADL_PackWriter_Entry* entry = &self->entries[self->numberOfEntries];
+  entry->kind = kind;
+  for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+    entry->parameters[i] = parameters[i];
+  }
+  entry->dataOffset = dataOffset;
+  entry->dataLength = numberOfBytes;
+  Arcadia_List_insertBackObjectReferenceValue(thread, self->names, (Arcadia_Object*)name);
+  Arcadia_Map_set(thread, self->indices, key, Arcadia_Value_makeSizeValue(self->numberOfEntries), NULL, NULL);
+  self->numberOfEntries++;
+}
+
+void
+Arcadia_ADL_PackWriter_write
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackWriter* self,
+    Arcadia_ByteArrayBuilder* target
+  )
+{
+  Arcadia_SizeValue n = self->numberOfEntries;
+  // The indices of the entries sorted by their names.
+  Arcadia_List* order = (Arcadia_List*)Arcadia_ArrayList_create(thread);
+  for (Arcadia_SizeValue i = 0; i < n; ++i) {
+    Arcadia_String* name = (Arcadia_String*)Arcadia_List_getObjectReferenceValueAt(thread, self->names, i);
+    // Binary insertion into the sorted sequence of entry indices.
+    Arcadia_SizeValue l = 0, r = i;
+    while (l < r) {
+      Arcadia_SizeValue m = l + (r - l) / 2;
+      Arcadia_String* other = (Arcadia_String*)Arcadia_List_getObjectReferenceValueAt(thread, self->names, Arcadia_List_getNatural32ValueAt(thread, order, m));
+      Arcadia_Integer32Value c = Arcadia_ADL_PackFormat_compareNames(thread, Arcadia_String_getBytes(thread, other), Arcadia_String_getNumberOfBytes(thread, other),
+                                                                     Arcadia_String_getBytes(thread, name), Arcadia_String_getNumberOfBytes(thread, name));
+      if (c < 0) {
+        l = m + 1;
+      } else {
+        r = m;
+      }
+    }
+    Arcadia_List_insertNatural32ValueAt(thread, order, l, (Arcadia_Natural32Value)i);
+  }
+
+  Arcadia_SizeValue indexOffset = Arcadia_ADL_PackFormat_HeaderSize;
+  Arcadia_SizeValue namesOffset = indexOffset + n * Arcadia_ADL_PackFormat_IndexEntrySize;
+  Arcadia_SizeValue namesLength = 0;
+  for (Arcadia_SizeValue i = 0; i < n; ++i) {
+    Arcadia_String* name = (Arcadia_String*)Arcadia_List_getObjectReferenceValueAt(thread, self->names, i);
+    namesLength += Arcadia_String_getNumberOfBytes(thread, name);
+  }
+  Arcadia_SizeValue dataOffset = alignUp(thread, namesOffset + namesLength);
+
+  // Header.
+  Arcadia_SizeValue start = Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, target);
+  Arcadia_Natural8Value const magic[] = {
+    Arcadia_ADL_PackFormat_Magic0,
+    Arcadia_ADL_PackFormat_Magic1,
+    Arcadia_ADL_PackFormat_Magic2,
+    Arcadia_ADL_PackFormat_Magic3,
+  };
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, magic, 4);
+  writeNatural32(thread, target, Arcadia_ADL_PackFormat_Version);
+  writeNatural32(thread, target, toNatural32(thread, n));
+  writeNatural32(thread, target, 0);
+  writeNatural64(thread, target, indexOffset);
+  writeNatural64(thread, target, namesOffset);
+
+  // Index.
+  Arcadia_SizeValue nameOffset = namesOffset;
+  for (Arcadia_SizeValue i = 0; i < n; ++i) {
+    Arcadia_SizeValue j = Arcadia_List_getNatural32ValueAt(thread, order, i);
+    Arcadia_String* name = (Arcadia_String*)Arcadia_List_getObjectReferenceValueAt(thread, self->names, j);
+    Arcadia_ADL_PackWriter_Entry* entry = &self->entries[j];
+    writeNatural64(thread, target, nameOffset);
+    writeNatural32(thread, target, toNatural32(thread, Arcadia_String_getNumberOfBytes(thread, name)));
+    writeNatural32(thread, target, entry->kind);
+    for (Arcadia_SizeValue k = 0; k < 4; ++k) {
+      writeNatural32(thread, target, entry->parameters[k]);
+    }
+    writeNatural64(thread, target, dataOffset + entry->dataOffset);
+    writeNatural64(thread, target, entry->dataLength);
+    nameOffset += Arcadia_String_getNumberOfBytes(thread, name);
+  }
+
+  // Names.
+  for (Arcadia_SizeValue i = 0; i < n; ++i) {
+    Arcadia_SizeValue j = Arcadia_List_getNatural32ValueAt(thread, order, i);
+    Arcadia_String* name = (Arcadia_String*)Arcadia_List_getObjectReferenceValueAt(thread, self->names, j);
+    if (Arcadia_String_getNumberOfBytes(thread, name)) {
+      Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, Arcadia_String_getBytes(thread, name), Arcadia_String_getNumberOfBytes(thread, name));
+    }
+  }
+
+  // Data.
+  writePadding(thread, target, dataOffset - (Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, target) - start));
+  if (Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, self->data)) {
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, Arcadia_ByteArrayBuilder_getBytes(thread, self->data),
+                                             Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, self->data));
+  }
+}
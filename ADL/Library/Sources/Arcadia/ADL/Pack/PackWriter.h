@@ -0,0 +1,105 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_ADL_PACK_PACKWRITER_H_INCLUDED)
+#define ARCADIA_ADL_PACK_PACKWRITER_H_INCLUDED
+
+#if !defined(ARCADIA_ADL_MODULE)
+  #error("do not include directly, include `Arcadia/ADL/Include.h` instead")
+#endif
+#include "Arcadia/Ring2/Include.h"
+#include "Arcadia/Collections/Include.h"
+
+// @brief Writes baked asset packs in the format described in `Arcadia/ADL/Pack/PackFormat.h`.
+// Entries can be added in any order, they are written sorted by their names.
+// @code
+// class Arcadia.ADL.PackWriter extends Arcadia.Object {
+//
+//   constructor()
+//
+//   method addEntry(name : Arcadia.String, kind : Arcadia.Natural32, parameters : Arcadia.Natural32[4], data : Arcadia.Natural8[])
+//
+//   method write(target : Arcadia.ByteArrayBuilder)
+//
+// };
+// @endcode
+Arcadia_declareObjectType(u8"Arcadia.ADL.PackWriter", Arcadia_ADL_PackWriter,
+                          u8"Arcadia.Object");
+
+struct Arcadia_ADL_PackWriterDispatch {
+  Arcadia_ObjectDispatch _parent;
+};
+
+typedef struct Arcadia_ADL_PackWriter_Entry Arcadia_ADL_PackWriter_Entry;
+
+struct Arcadia_ADL_PackWriter {
+  Arcadia_Object _parent;
+  /// Map from the names of the entries to the indices of the entries.
+  Arcadia_Map* indices;
+  /// The names of the entries in the order of their indices.
+  Arcadia_List* names;
+  /// The data of the entries.
+  /// The data of each entry starts at a multiple of Arcadia_ADL_PackFormat_DataAlignment.
+  Arcadia_ByteArrayBuilder* data;
+  /// The entries in the order of their indices.
+  Arcadia_ADL_PackWriter_Entry* entries;
+  Arcadia_SizeValue numberOfEntries;
+  Arcadia_SizeValue entriesCapacity;
+};
+
+/// @brief Create a pack writer.
+/// @param thread A pointer to this thread.
+/// @return A pointer to the pack writer.
+Arcadia_ADL_PackWriter*
+Arcadia_ADL_PackWriter_create
+  (
+    Arcadia_Thread* thread
+  );
+
+/// @brief Add an entry.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this pack writer.
+/// @param name The name of the entry.
+/// @param kind The kind of the entry. One of Arcadia_ADL_PackFormat_Kind_*.
+/// @param parameters The four parameters of the entry.
+/// @param bytes, numberOfBytes The data of the entry.
+/// @error Arcadia_Status_ArgumentValueInvalid an entry of the same name was already added
+/// @error Arcadia_Status_ArgumentValueInvalid @a kind is not one of Arcadia_ADL_PackFormat_Kind_*
+void
+Arcadia_ADL_PackWriter_addEntry
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackWriter* self,
+    Arcadia_String* name,
+    Arcadia_Natural32Value kind,
+    Arcadia_Natural32Value const parameters[4],
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
+  );
+
+/// @brief Write the pack.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this pack writer.
+/// @param target The Byte array builder to which the pack is appended to.
+/// @error Arcadia_Status_ArgumentValueInvalid the output would exceed the limits of the format
+void
+Arcadia_ADL_PackWriter_write
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackWriter* self,
+    Arcadia_ByteArrayBuilder* target
+  );
+
+#endif // ARCADIA_ADL_PACK_PACKWRITER_H_INCLUDED
@@ -41,6 +41,8 @@ Arcadia_ADL_Tests_Audials_SampleBufferDefinitionTest1
       "  type  : \"SampleBuffer\",\n"
       "  name  : \"MyGame.MyScene.MySampleBuffer\",\n"
       "  duration: 2,\n"
+      "  sampleRate: 44100,\n"
+      "  sampleFormat: \"Integer16\",\n"
       "  dsp: \"MyGame.MyScene.MySineWaveDSP\",\n"
       "}\n"
       ;
@@ -69,6 +69,7 @@ makeTexture
       "  name  : \"MyGame.PixelBuffers.MyPixelBuffer\",\n"
       "  width: 256,\n"
       "  height: 256,\n"
+      "  pixelFormat: \"RedGreenBlueAlphaNatural8\",\n"
       "  operations : [\n"
       "    \"MyGame.PixelBufferOperations.MyPixelBufferFillOperation\",\n"
       "  ],\n"
@@ -150,6 +150,7 @@ Arcadia_ADL_Tests_Visuals_PixelBufferDefinitionTest3
       "  name : \"MyPixelBuffer\",\n"
       "  width: 256,\n"
       "  height: 256,\n"
+      "  pixelFormat: \"RedGreenBlueAlphaNatural8\",\n"
       "  operations : [\n"
       "    \"MyGame.PixelBufferOperations.MyCheckerboardFillOperation\"\n"
       "  ],\n"
@@ -69,6 +69,7 @@ Arcadia_ADL_Tests_Visuals_TextureDefinitionTest1
       "  name  : \"MyGame.PixelBuffers.MyPixelBuffer\",\n"
       "  width: 256,\n"
       "  height: 256,\n"
+      "  pixelFormat: \"RedGreenBlueAlphaNatural8\",\n"
       "  operations : [\n"
       "    \"MyGame.PixelBufferOperations.MyPixelBufferFillOperation\",\n"
       "  ],\n"
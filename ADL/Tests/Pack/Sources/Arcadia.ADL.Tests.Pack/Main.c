@@ -0,0 +1,380 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/ADL/Include.h"
+
+#include "Arcadia/Ring2/Include.h"
+
+#include <string.h>
+
+static Arcadia_FilePath*
+getPackPath
+  (
+    Arcadia_Thread* thread
+  )
+{ return Arcadia_FilePath_parseGeneric(thread, Arcadia_String_createFromCxxString(thread, u8"Pack.apak")); }
+
+static void
+writePack
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* contents
+  )
+{
+  Arcadia_FileSystem* fileSystem = Arcadia_FileSystem_getOrCreate(thread);
+  Arcadia_FileSystem_setFileContents(thread, fileSystem, getPackPath(thread), contents);
+}
+
+static void
+assertEntry
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Pack* pack,
+    const char* name,
+    Arcadia_Natural32Value kind,
+    Arcadia_Natural32Value const parameters[4],
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  Arcadia_ADL_PackEntry* entry = Arcadia_ADL_Pack_getEntryOrNull(thread, pack, Arcadia_String_createFromCxxString(thread, name));
+  Arcadia_Tests_assertTrue(thread, NULL != entry);
+  // Entries are created once.
+  Arcadia_Tests_assertTrue(thread, entry == Arcadia_ADL_Pack_getEntryOrNull(thread, pack, Arcadia_String_createFromCxxString(thread, name)));
+  Arcadia_Tests_assertTrue(thread, Arcadia_String_isEqualTo_pn(thread, Arcadia_ADL_PackEntry_getName(thread, entry), name, strlen(name)));
+  Arcadia_Tests_assertTrue(thread, kind == Arcadia_ADL_PackEntry_getKind(thread, entry));
+  for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+    Arcadia_Tests_assertTrue(thread, parameters[i] == Arcadia_ADL_PackEntry_getParameter(thread, entry, i));
+  }
+  Arcadia_Tests_assertTrue(thread, numberOfBytes == Arcadia_ADL_PackEntry_getNumberOfBytes(thread, entry));
+  Arcadia_Tests_assertTrue(thread, 0 == ((uintptr_t)Arcadia_ADL_PackEntry_getBytes(thread, entry)) % Arcadia_ADL_PackFormat_DataAlignment);
+  if (numberOfBytes) {
+    Arcadia_Tests_assertTrue(thread, !Arcadia_Memory_compare(thread, Arcadia_ADL_PackEntry_getBytes(thread, entry), bytes, numberOfBytes));
+  }
+}
+
+// Write a pack with entries added in no particular order, map it, and look up every entry.
+static void
+testRoundTrip
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Natural8Value pixels[2 * 3 * 4];
+  for (Arcadia_SizeValue i = 0; i < sizeof(pixels); ++i) {
+    pixels[i] = (Arcadia_Natural8Value)i;
+  }
+  Arcadia_Natural32Value const pixelParameters[4] = { 2, 3, 0, 0 };
+
+  Arcadia_Natural8Value samples[1 * 7 * 2 * 1];
+  for (Arcadia_SizeValue i = 0; i < sizeof(samples); ++i) {
+    samples[i] = (Arcadia_Natural8Value)(255 - i);
+  }
+  Arcadia_Natural32Value const sampleParameters[4] = { 1, 7, 0, 1 };
+
+  Arcadia_Natural8Value const mesh[] = { 'c' };
+  Arcadia_Natural32Value const meshParameters[4] = { 0, Arcadia_ADL_PackFormat_MeshVertexStride, sizeof(mesh), 0 };
+
+  Arcadia_ADL_PackWriter* writer = Arcadia_ADL_PackWriter_create(thread);
+  Arcadia_ADL_PackWriter_addEntry(thread, writer, Arcadia_String_createFromCxxString(thread, u8"MyGame.SampleBuffers.MySampleBuffer"), Arcadia_ADL_PackFormat_Kind_SampleBuffer, sampleParameters, samples, sizeof(samples));
+  Arcadia_ADL_PackWriter_addEntry(thread, writer, Arcadia_String_createFromCxxString(thread, u8"MyGame.Meshes.MyMesh"), Arcadia_ADL_PackFormat_Kind_Mesh, meshParameters, mesh, sizeof(mesh));
+  Arcadia_ADL_PackWriter_addEntry(thread, writer, Arcadia_String_createFromCxxString(thread, u8"MyGame.PixelBuffers.MyPixelBuffer"), Arcadia_ADL_PackFormat_Kind_PixelBuffer, pixelParameters, pixels, sizeof(pixels));
+  Arcadia_ByteArrayBuilder* contents = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ADL_PackWriter_write(thread, writer, contents);
+  writePack(thread, contents);
+
+  Arcadia_ADL_Pack* pack = Arcadia_ADL_Pack_createFromFile(thread, getPackPath(thread));
+  Arcadia_Tests_assertTrue(thread, 3 == Arcadia_ADL_Pack_getNumberOfEntries(thread, pack));
+  // The entries are ordered by their names.
+  Arcadia_Tests_assertTrue(thread, Arcadia_String_isEqualTo_pn(thread, Arcadia_ADL_PackEntry_getName(thread, Arcadia_ADL_Pack_getEntryAt(thread, pack, 0)), u8"MyGame.Meshes.MyMesh", sizeof(u8"MyGame.Meshes.MyMesh") - 1));
+  Arcadia_Tests_assertTrue(thread, Arcadia_String_isEqualTo_pn(thread, Arcadia_ADL_PackEntry_getName(thread, Arcadia_ADL_Pack_getEntryAt(thread, pack, 2)), u8"MyGame.SampleBuffers.MySampleBuffer", sizeof(u8"MyGame.SampleBuffers.MySampleBuffer") - 1));
+  assertEntry(thread, pack, u8"MyGame.PixelBuffers.MyPixelBuffer", Arcadia_ADL_PackFormat_Kind_PixelBuffer, pixelParameters, pixels, sizeof(pixels));
+  assertEntry(thread, pack, u8"MyGame.SampleBuffers.MySampleBuffer", Arcadia_ADL_PackFormat_Kind_SampleBuffer, sampleParameters, samples, sizeof(samples));
+  assertEntry(thread, pack, u8"MyGame.Meshes.MyMesh", Arcadia_ADL_PackFormat_Kind_Mesh, meshParameters, mesh, sizeof(mesh));
+  Arcadia_Tests_assertTrue(thread, NULL == Arcadia_ADL_Pack_getEntryOrNull(thread, pack, Arcadia_String_createFromCxxString(thread, u8"MyGame.Meshes")));
+  Arcadia_Tests_assertTrue(thread, NULL == Arcadia_ADL_Pack_getEntryOrNull(thread, pack, Arcadia_String_createFromCxxString(thread, u8"MyGame.Meshes.MyMesh2")));
+  Arcadia_Tests_assertTrue(thread, NULL == Arcadia_ADL_Pack_getEntryOrNull(thread, pack, Arcadia_String_createFromCxxString(thread, u8"")));
+}
+
+// Adding two entries of the same name must fail.
+static void
+testDuplicateName
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Natural32Value const parameters[4] = { 0, Arcadia_ADL_PackFormat_MeshVertexStride, 0, 0 };
+  Arcadia_ADL_PackWriter* writer = Arcadia_ADL_PackWriter_create(thread);
+  Arcadia_ADL_PackWriter_addEntry(thread, writer, Arcadia_String_createFromCxxString(thread, u8"x"), Arcadia_ADL_PackFormat_Kind_Mesh, parameters, NULL, 0);
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_ADL_PackWriter_addEntry(thread, writer, Arcadia_String_createFromCxxString(thread, u8"x"), Arcadia_ADL_PackFormat_Kind_Mesh, parameters, NULL, 0);
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+    Arcadia_Thread_jump(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_Status_ArgumentValueInvalid == Arcadia_Thread_getStatus(thread));
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+}
+
+static void
+onInvalidPack
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* contents
+  )
+{
+  writePack(thread, contents);
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_ADL_Pack_createFromFile(thread, getPackPath(thread));
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+    Arcadia_Thread_jump(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_Status_EncodingInvalid == Arcadia_Thread_getStatus(thread));
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+}
+
+// Truncated or corrupted packs must be rejected when the pack is created.
+static void
+testInvalid
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Natural8Value const pixels[4] = { 1, 2, 3, 4 };
+  Arcadia_Natural32Value const parameters[4] = { 1, 1, 0, 0 };
+  Arcadia_ADL_PackWriter* writer = Arcadia_ADL_PackWriter_create(thread);
+  Arcadia_ADL_PackWriter_addEntry(thread, writer, Arcadia_String_createFromCxxString(thread, u8"a"), Arcadia_ADL_PackFormat_Kind_PixelBuffer, parameters, pixels, sizeof(pixels));
+  Arcadia_ADL_PackWriter_addEntry(thread, writer, Arcadia_String_createFromCxxString(thread, u8"b"), Arcadia_ADL_PackFormat_Kind_PixelBuffer, parameters, pixels, sizeof(pixels));
+  Arcadia_ByteArrayBuilder* valid = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ADL_PackWriter_write(thread, writer, valid);
+  Arcadia_Natural8Value const* p = Arcadia_ByteArrayBuilder_getBytes(thread, valid);
+  Arcadia_SizeValue n = Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, valid);
+
+  // Empty file.
+  onInvalidPack(thread, Arcadia_ByteArrayBuilder_create(thread));
+  // Truncated data.
+  {
+    Arcadia_ByteArrayBuilder* contents = Arcadia_ByteArrayBuilder_create(thread);
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, contents, p, n - 1);
+    onInvalidPack(thread, contents);
+  }
+  // Invalid magic.
+  {
+    Arcadia_ByteArrayBuilder* contents = Arcadia_ByteArrayBuilder_create(thread);
+    Arcadia_Natural8Value const x = 'X';
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, contents, &x, 1);
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, contents, p + 1, n - 1);
+    onInvalidPack(thread, contents);
+  }
+  // Names not sorted: swap the names "a" and "b".
+  {
+    Arcadia_SizeValue namesOffset = (Arcadia_SizeValue)Arcadia_ADL_PackFormat_readNatural64(p + 24);
+    Arcadia_ByteArrayBuilder* contents = Arcadia_ByteArrayBuilder_create(thread);
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, contents, p, namesOffset);
+    Arcadia_Natural8Value const names[2] = { 'b', 'a' };
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, contents, names, 2);
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, contents, p + namesOffset + 2, n - namesOffset - 2);
+    onInvalidPack(thread, contents);
+  }
+}
+
+// Create a pack with a single entry and assert that it is rejected when the pack is created.
+static void
+onInvalidEntry
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural32Value kind,
+    Arcadia_Natural32Value const parameters[4],
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  Arcadia_ADL_PackWriter* writer = Arcadia_ADL_PackWriter_create(thread);
+  Arcadia_ADL_PackWriter_addEntry(thread, writer, Arcadia_String_createFromCxxString(thread, u8"a"), kind, parameters, bytes, numberOfBytes);
+  Arcadia_ByteArrayBuilder* contents = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ADL_PackWriter_write(thread, writer, contents);
+  onInvalidPack(thread, contents);
+}
+
+// Entries of which the parameters do not agree with the number of Bytes of their data must be rejected when the pack is created.
+static void
+testInvalidParameters
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Natural8Value const bytes[64] = { 0 };
+  // Pixel buffer: 2 x 1 pixels of 4 Bytes are 8 Bytes not 4 Bytes.
+  {
+    Arcadia_Natural32Value const parameters[4] = { 2, 1, 0, 0 };
+    onInvalidEntry(thread, Arcadia_ADL_PackFormat_Kind_PixelBuffer, parameters, bytes, 4);
+  }
+  // Pixel buffer: unknown pixel format.
+  {
+    Arcadia_Natural32Value const parameters[4] = { 1, 1, 0xffffffff, 0 };
+    onInvalidEntry(thread, Arcadia_ADL_PackFormat_Kind_PixelBuffer, parameters, bytes, 4);
+  }
+  // Pixel buffer: the number of Bytes overflows.
+  {
+    Arcadia_Natural32Value const parameters[4] = { 0xffffffff, 0xffffffff, 0, 0 };
+    onInvalidEntry(thread, Arcadia_ADL_PackFormat_Kind_PixelBuffer, parameters, bytes, 4);
+  }
+  // Sample buffer: 1 second at 7 Hz with 2 channels of 2 Bytes are 28 Bytes not 14 Bytes.
+  {
+    Arcadia_Natural32Value const parameters[4] = { 1, 7, 0, 2 };
+    onInvalidEntry(thread, Arcadia_ADL_PackFormat_Kind_SampleBuffer, parameters, bytes, 14);
+  }
+  // Sample buffer: unknown sample format.
+  {
+    Arcadia_Natural32Value const parameters[4] = { 1, 7, 0xffffffff, 1 };
+    onInvalidEntry(thread, Arcadia_ADL_PackFormat_Kind_SampleBuffer, parameters, bytes, 14);
+  }
+  // Sample buffer: the number of Bytes overflows.
+  {
+    Arcadia_Natural32Value const parameters[4] = { 0xffffffff, 0xffffffff, 0, 0xffffffff };
+    onInvalidEntry(thread, Arcadia_ADL_PackFormat_Kind_SampleBuffer, parameters, bytes, 14);
+  }
+  // Mesh: 1 vertex and an ambient color name of 1 Byte are Arcadia_ADL_PackFormat_MeshVertexStride + 1 Bytes not 1 Byte.
+  {
+    Arcadia_Natural32Value const parameters[4] = { 1, Arcadia_ADL_PackFormat_MeshVertexStride, 1, 0 };
+    onInvalidEntry(thread, Arcadia_ADL_PackFormat_Kind_Mesh, parameters, bytes, 1);
+  }
+  // Mesh: the vertex stride is not Arcadia_ADL_PackFormat_MeshVertexStride.
+  {
+    Arcadia_Natural32Value const parameters[4] = { 1, 4, 1, 0 };
+    onInvalidEntry(thread, Arcadia_ADL_PackFormat_Kind_Mesh, parameters, bytes, 5);
+  }
+  // Mesh: the ambient color name is empty.
+  {
+    Arcadia_Natural32Value const parameters[4] = { 1, Arcadia_ADL_PackFormat_MeshVertexStride, 0, 0 };
+    onInvalidEntry(thread, Arcadia_ADL_PackFormat_Kind_Mesh, parameters, bytes, Arcadia_ADL_PackFormat_MeshVertexStride);
+  }
+}
+
+// Mount a pack into a set of definitions and look up the definitions baked into the pack.
+static void
+testDefinitions
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Natural8Value pixels[2 * 3 * 4];
+  for (Arcadia_SizeValue i = 0; i < sizeof(pixels); ++i) {
+    pixels[i] = (Arcadia_Natural8Value)i;
+  }
+  Arcadia_Natural32Value const pixelParameters[4] = { 2, 3, Arcadia_ADL_PixelFormat_RedGreenBlueAlphaNatural8, 0 };
+
+  Arcadia_Natural8Value samples[1 * 7 * 2 * 1] = { 0 };
+  Arcadia_Natural32Value const sampleParameters[4] = { 1, 7, Arcadia_ADL_SampleFormat_Integer16, 1 };
+
+  // One vertex: the position, the ambient color, and the ambient texture coordinates followed by the name of the ambient color.
+  Arcadia_Real32Value const vertex[9] = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f };
+  Arcadia_ByteArrayBuilder* mesh = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, mesh, vertex, sizeof(vertex));
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, mesh, u8"MyGame.Colors.MyColor", sizeof(u8"MyGame.Colors.MyColor") - 1);
+  Arcadia_Natural32Value const meshParameters[4] = { 1, Arcadia_ADL_PackFormat_MeshVertexStride, sizeof(u8"MyGame.Colors.MyColor") - 1, 0 };
+
+  Arcadia_ADL_PackWriter* writer = Arcadia_ADL_PackWriter_create(thread);
+  Arcadia_ADL_PackWriter_addEntry(thread, writer, Arcadia_String_createFromCxxString(thread, u8"MyGame.PixelBuffers.MyPixelBuffer"), Arcadia_ADL_PackFormat_Kind_PixelBuffer, pixelParameters, pixels, sizeof(pixels));
+  Arcadia_ADL_PackWriter_addEntry(thread, writer, Arcadia_String_createFromCxxString(thread, u8"MyGame.SampleBuffers.MySampleBuffer"), Arcadia_ADL_PackFormat_Kind_SampleBuffer, sampleParameters, samples, sizeof(samples));
+  Arcadia_ADL_PackWriter_addEntry(thread, writer, Arcadia_String_createFromCxxString(thread, u8"MyGame.Meshes.MyMesh"), Arcadia_ADL_PackFormat_Kind_Mesh, meshParameters,
+                                  Arcadia_ByteArrayBuilder_getBytes(thread, mesh), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, mesh));
+  Arcadia_ByteArrayBuilder* contents = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ADL_PackWriter_write(thread, writer, contents);
+  Arcadia_FilePath* path = Arcadia_FilePath_parseGeneric(thread, Arcadia_String_createFromCxxString(thread, u8"Definitions.apak"));
+  Arcadia_FileSystem_setFileContents(thread, Arcadia_FileSystem_getOrCreate(thread), path, contents);
+
+  Arcadia_ADL_Context* context = Arcadia_ADL_Context_getOrCreate(thread);
+  Arcadia_ADL_Definitions* definitions = Arcadia_ADL_Definitions_create(thread);
+  Arcadia_ADL_Definitions_addPack(thread, definitions, Arcadia_ADL_Pack_createFromFile(thread, path));
+
+  // Pixel buffer.
+  Arcadia_ADL_Definition* definition = Arcadia_ADL_Definitions_getDefinitionOrNull(thread, definitions, Arcadia_String_createFromCxxString(thread, u8"MyGame.PixelBuffers.MyPixelBuffer"));
+  Arcadia_Tests_assertTrue(thread, NULL != definition);
+  Arcadia_Tests_assertTrue(thread, Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)definition, _Arcadia_ADL_PixelBufferDefinition_getType(thread)));
+  Arcadia_ADL_PixelBufferDefinition* pixelBufferDefinition = (Arcadia_ADL_PixelBufferDefinition*)definition;
+  Arcadia_Tests_assertTrue(thread, 2 == pixelBufferDefinition->width);
+  Arcadia_Tests_assertTrue(thread, 3 == pixelBufferDefinition->height);
+  Arcadia_Tests_assertTrue(thread, Arcadia_ADL_PixelFormat_RedGreenBlueAlphaNatural8 == pixelBufferDefinition->pixelFormat);
+  Arcadia_Tests_assertTrue(thread, NULL != pixelBufferDefinition->pixels);
+  Arcadia_Tests_assertTrue(thread, !Arcadia_Memory_compare(thread, Arcadia_ADL_PackEntry_getBytes(thread, pixelBufferDefinition->pixels), pixels, sizeof(pixels)));
+  // Definitions are created once.
+  Arcadia_Tests_assertTrue(thread, definition == Arcadia_ADL_Definitions_getDefinitionOrNull(thread, definitions, Arcadia_String_createFromCxxString(thread, u8"MyGame.PixelBuffers.MyPixelBuffer")));
+
+  // Sample buffer.
+  definition = Arcadia_ADL_Definitions_getDefinitionOrNull(thread, definitions, Arcadia_String_createFromCxxString(thread, u8"MyGame.SampleBuffers.MySampleBuffer"));
+  Arcadia_Tests_assertTrue(thread, NULL != definition);
+  Arcadia_Tests_assertTrue(thread, Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)definition, _Arcadia_ADL_SampleBufferDefinition_getType(thread)));
+  Arcadia_ADL_SampleBufferDefinition* sampleBufferDefinition = (Arcadia_ADL_SampleBufferDefinition*)definition;
+  Arcadia_Tests_assertTrue(thread, 1 == sampleBufferDefinition->duration);
+  Arcadia_Tests_assertTrue(thread, 7 == sampleBufferDefinition->sampleRate);
+  Arcadia_Tests_assertTrue(thread, Arcadia_ADL_SampleFormat_Integer16 == sampleBufferDefinition->sampleFormat);
+  Arcadia_Tests_assertTrue(thread, NULL == sampleBufferDefinition->dsp);
+  Arcadia_Tests_assertTrue(thread, NULL != sampleBufferDefinition->samples);
+
+  // Mesh. The ambient color is a text definition.
+  Arcadia_ADL_Context_readFromString(thread, context, definitions, Arcadia_String_createFromCxxString(thread, u8"{ type : \"Color\", name : \"MyGame.Colors.MyColor\", red : 255, green : 0, blue : 0 }"), Arcadia_BooleanValue_False);
+  definition = Arcadia_ADL_Definitions_getDefinitionOrNull(thread, definitions, Arcadia_String_createFromCxxString(thread, u8"MyGame.Meshes.MyMesh"));
+  Arcadia_Tests_assertTrue(thread, NULL != definition);
+  Arcadia_Tests_assertTrue(thread, Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)definition, _Arcadia_ADL_MeshDefinition_getType(thread)));
+  Arcadia_ADL_MeshDefinition* meshDefinition = (Arcadia_ADL_MeshDefinition*)definition;
+  Arcadia_Tests_assertTrue(thread, 1 == Arcadia_ADL_MeshDefinition_getNumberOfVertices(thread, meshDefinition));
+  Arcadia_Tests_assertTrue(thread, !Arcadia_Memory_compare(thread, Arcadia_RuntimeByteArray_getBytes(thread, Arcadia_ADL_MeshDefinition_getVertexPositions(thread, meshDefinition)), vertex + 0, sizeof(Arcadia_Real32Value) * 3));
+  Arcadia_Tests_assertTrue(thread, !Arcadia_Memory_compare(thread, Arcadia_RuntimeByteArray_getBytes(thread, Arcadia_ADL_MeshDefinition_getVertexAmbientColors(thread, meshDefinition)), vertex + 3, sizeof(Arcadia_Real32Value) * 4));
+  Arcadia_Tests_assertTrue(thread, !Arcadia_Memory_compare(thread, Arcadia_RuntimeByteArray_getBytes(thread, Arcadia_ADL_MeshDefinition_getVertexAmbientTextureCoordinates(thread, meshDefinition)), vertex + 7, sizeof(Arcadia_Real32Value) * 2));
+  Arcadia_ADL_Definitions_link(thread, definitions);
+  Arcadia_Tests_assertTrue(thread, Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)meshDefinition->ambientColor->definition, _Arcadia_ADL_ColorDefinition_getType(thread)));
+
+  // A text definition of the name of a baked definition is skipped in favor of the baked definition.
+  definition = Arcadia_ADL_Context_readFromString(thread, context, definitions, Arcadia_String_createFromCxxString(thread, u8"{ type : \"SampleBuffer\", name : \"MyGame.SampleBuffers.MySampleBuffer\", duration : 2, sampleRate : 44100, sampleFormat : \"Real32\", dsp : \"x\" }"), Arcadia_BooleanValue_True);
+  Arcadia_Tests_assertTrue(thread, (Arcadia_ADL_Definition*)sampleBufferDefinition == definition);
+
+  // Names of neither text definitions nor baked definitions.
+  Arcadia_Tests_assertTrue(thread, NULL == Arcadia_ADL_Definitions_getDefinitionOrNull(thread, definitions, Arcadia_String_createFromCxxString(thread, u8"MyGame.Meshes.MyMesh2")));
+}
+
+int
+main
+  (
+    int argc,
+    char** argv
+  )
+{
+  if (!Arcadia_Tests_safeExecute(&testRoundTrip)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testDuplicateName)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testInvalid)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testInvalidParameters)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testDefinitions)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
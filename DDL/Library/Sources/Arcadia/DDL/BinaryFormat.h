@@ -0,0 +1,100 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_DDL_BINARYFORMAT_H_INCLUDED)
+#define ARCADIA_DDL_BINARYFORMAT_H_INCLUDED
+
+#if !defined(ARCADIA_DDL_MODULE) || 1 != ARCADIA_DDL_MODULE
+  #error("do not include directly, include `Arcadia/DDL/Include.h` instead")
+#endif
+
+#include "Arcadia/Ring2/Include.h"
+
+// The binary encoding of a Data Definition Language document.
+// All integers are unsigned and stored in little endian Byte order.
+// All offsets are Natural32 values relative to the first Byte of the document.
+//
+// header
+//   Natural8[4] magic          'A', 'D', 'D', 'L'
+//   Natural32   version        Arcadia_DDL_BinaryFormat_Version
+//   Natural32   stringTable    offset of the string table
+//   Natural32   root           offset of the root node
+//
+// string table
+//   Natural32             count
+//   Natural32[count]      offsets of the strings
+//   a string is a Natural32 number of Bytes followed by that many Bytes of UTF-8.
+//   Each string is stored exactly once.
+//
+// nodes (each starts with a Natural8 tag)
+//   void    tag
+//   boolean tag, Natural8 value (0 or 1)
+//   number  tag, Natural8 kind, Natural64 bits, Natural32 lexeme
+//           kind is one of Arcadia_DDL_BinaryFormat_NumberKind_*.
+//           bits is the Integer64 or the IEEE 754 Real64 value (if any) of the lexeme.
+//           lexeme is the index of the number literal in the string table.
+//   string  tag, Natural32 value
+//           value is the index of the string in the string table.
+//   list    tag, Natural32 count, Natural32[count] offsets of the elements
+//   map     tag, Natural32 count, (Natural32 key, Natural32 value)[count], Natural32[count] order
+//           The entries are stored in source order.
+//           key is the index of the name in the string table and value is the offset of the value node.
+//           order is a permutation of the entry indices sorting the entries by the Bytes of their keys.
+//
+// Nodes are written in post-order such that the root node is the last node.
+
+#define Arcadia_DDL_BinaryFormat_Magic0 ('A')
+#define Arcadia_DDL_BinaryFormat_Magic1 ('D')
+#define Arcadia_DDL_BinaryFormat_Magic2 ('D')
+#define Arcadia_DDL_BinaryFormat_Magic3 ('L')
+
+#define Arcadia_DDL_BinaryFormat_Version (1)
+
+#define Arcadia_DDL_BinaryFormat_HeaderSize (16)
+
+#define Arcadia_DDL_BinaryFormat_Tag_Void (1)
+#define Arcadia_DDL_BinaryFormat_Tag_Boolean (2)
+#define Arcadia_DDL_BinaryFormat_Tag_Number (3)
+#define Arcadia_DDL_BinaryFormat_Tag_String (4)
+#define Arcadia_DDL_BinaryFormat_Tag_List (5)
+#define Arcadia_DDL_BinaryFormat_Tag_Map (6)
+
+// The number literal could not be converted.
+#define Arcadia_DDL_BinaryFormat_NumberKind_None (0)
+// The number literal is an integer literal which fits into an Integer64 value.
+#define Arcadia_DDL_BinaryFormat_NumberKind_Integer64 (1)
+// The number literal is a real literal or an integer literal which does not fit into an Integer64 value.
+#define Arcadia_DDL_BinaryFormat_NumberKind_Real64 (2)
+
+// Compare two keys.
+// The keys are ordered by their Bytes first and by their lengths second.
+static inline Arcadia_Integer32Value
+Arcadia_DDL_BinaryFormat_compareKeys
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value const* p,
+    Arcadia_SizeValue n,
+    Arcadia_Natural8Value const* q,
+    Arcadia_SizeValue m
+  )
+{
+  Arcadia_Integer32Value result = Arcadia_Memory_compare(thread, p, q, n < m ? n : m);
+  if (result) {
+    return result;
+  }
+  return n < m ? -1 : (n > m ? +1 : 0);
+}
+
+#endif // ARCADIA_DDL_BINARYFORMAT_H_INCLUDED
@@ -24,12 +24,14 @@
 #pragma push_macro("ARCADIA_DDL_EXPORT")
 #define ARCADIA_DDL_EXPORT (1)
 
+#include "Arcadia/DDL/Reader/BinaryReader.h"
 #include "Arcadia/DDL/Reader/Keywords.h"
 #include "Arcadia/DDL/Reader/DefaultReader.h"
 #include "Arcadia/DDL/Reader/Parser.h"
 #include "Arcadia/DDL/Reader/Scanner.h"
 #include "Arcadia/DDL/Reader/WordType.h"
 #include "Arcadia/DDL/SemanticalAnalysis.h"
+#include "Arcadia/DDL/Writer/BinaryWriter.h"
 #include "Arcadia/DDL/Writer/Unparser.h"
 
 #undef ARCADIA_DDL_EXPORT
@@ -0,0 +1,658 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#define ARCADIA_DDL_MODULE (1)
+#include "Arcadia/DDL/Reader/BinaryReader.h"
+
+#include "Arcadia/DDL/BinaryFormat.h"
+#include "Arcadia/DDL/Include.h"
+
+struct Arcadia_DDL_BinaryReaderDispatch {
+  Arcadia_ObjectDispatch _parent;
+};
+
+struct Arcadia_DDL_BinaryReader {
+  Arcadia_Object _parent;
+  Arcadia_Languages_StringTable* stringTable;
+  // The Byte array owning the Bytes.
+  Arcadia_ByteArray* input;
+  // The Bytes of the document.
+  Arcadia_Natural8Value const* bytes;
+  Arcadia_Natural32Value numberOfBytes;
+  // The offset of the root node.
+  Arcadia_Natural32Value root;
+  // The number of strings in the string table.
+  Arcadia_Natural32Value numberOfStrings;
+  // The offset of the string offsets in the string table.
+  Arcadia_Natural32Value stringOffsets;
+};
+
+static void
+raiseEncodingInvalid
+  (
+    Arcadia_Thread* thread
+  );
+
+static Arcadia_Natural8Value
+readNatural8
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_SizeValue offset
+  );
+
+static Arcadia_Natural32Value
+readNatural32
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_SizeValue offset
+  );
+
+static Arcadia_Natural64Value
+readNatural64
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_SizeValue offset
+  );
+
+static Arcadia_Natural8Value const*
+getStringBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value index,
+    Arcadia_SizeValue* numberOfBytes
+  );
+
+static Arcadia_String*
+getString
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value index
+  );
+
+static Arcadia_Natural32Value
+getChild
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node,
+    Arcadia_SizeValue offset
+  );
+
+static void
+expectTag
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node,
+    Arcadia_Natural8Value tag
+  );
+
+static Arcadia_SizeValue
+checkIndex
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node,
+    Arcadia_SizeValue index
+  );
+
+static void
+Arcadia_DDL_BinaryReader_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self
+  );
+
+static void
+Arcadia_DDL_BinaryReader_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReaderDispatch* self
+  );
+
+static void
+Arcadia_DDL_BinaryReader_visit
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self
+  );
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_DDL_BinaryReader_constructImpl,
+  .visit = (Arcadia_Object_VisitCallbackFunction*)&Arcadia_DDL_BinaryReader_visit,
+  .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_DDL_BinaryReader_initializeDispatchImpl,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.DDL.BinaryReader", Arcadia_DDL_BinaryReader,
+                         u8"Arcadia.Object", Arcadia_Object,
+                         &_typeOperations);
+
+static void
+raiseEncodingInvalid
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+  Arcadia_Thread_jump(thread);
+}
+
+static Arcadia_Natural8Value
+readNatural8
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_SizeValue offset
+  )
+{
+  if (offset >= self->numberOfBytes) {
+    raiseEncodingInvalid(thread);
+  }
+  return self->bytes[offset];
+}
+
+static Arcadia_Natural32Value
+readNatural32
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_SizeValue offset
+  )
+{
+  if (offset > self->numberOfBytes || self->numberOfBytes - offset < 4) {
+    raiseEncodingInvalid(thread);
+  }
+  Arcadia_Natural8Value const* p = self->bytes + offset;
+  return ((Arcadia_Natural32Value)p[0] << 0)
+       | ((Arcadia_Natural32Value)p[1] << 8)
+       | ((Arcadia_Natural32Value)p[2] << 16)
+       | ((Arcadia_Natural32Value)p[3] << 24);
+}
+
+static Arcadia_Natural64Value
+readNatural64
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_SizeValue offset
+  )
+{
+  if (offset > self->numberOfBytes || self->numberOfBytes - offset < 8) {
+    raiseEncodingInvalid(thread);
+  }
+  Arcadia_Natural8Value const* p = self->bytes + offset;
+  Arcadia_Natural64Value value = 0;
+  for (Arcadia_SizeValue i = 0; i < 8; ++i) {
+    value |= (Arcadia_Natural64Value)p[i] << (i * 8);
+  }
+  return value;
+}
+
+static Arcadia_Natural8Value const*
+getStringBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value index,
+    Arcadia_SizeValue* numberOfBytes
+  )
+{
+  if (index >= self->numberOfStrings) {
+    raiseEncodingInvalid(thread);
+  }
+  Arcadia_SizeValue offset = readNatural32(thread, self, (Arcadia_SizeValue)self->stringOffsets + (Arcadia_SizeValue)index * 4);
+  Arcadia_SizeValue n = readNatural32(thread, self, offset);
+  if (self->numberOfBytes - (offset + 4) < n) {
+    raiseEncodingInvalid(thread);
+  }
+  *numberOfBytes = n;
+  return self->bytes + offset + 4;
+}
+
+static Arcadia_String*
+getString
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value index
+  )
+{
+  Arcadia_SizeValue numberOfBytes;
+  Arcadia_Natural8Value const* bytes = getStringBytes(thread, self, index, &numberOfBytes);
+  return Arcadia_Languages_StringTable_getOrCreateStringFromBytes(thread, self->stringTable, bytes, numberOfBytes);
+}
+
+// Nodes are written in post-order.
+// Hence the offset of a child node must be greater than or equal to the header size and less than the offset of its parent node.
+// This guarantees that traversals of invalid documents terminate.
+static Arcadia_Natural32Value
+getChild
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node,
+    Arcadia_SizeValue offset
+  )
+{
+  Arcadia_Natural32Value child = readNatural32(thread, self, offset);
+  if (child < Arcadia_DDL_BinaryFormat_HeaderSize || child >= node) {
+    raiseEncodingInvalid(thread);
+  }
+  return child;
+}
+
+static void
+expectTag
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node,
+    Arcadia_Natural8Value tag
+  )
+{
+  if (readNatural8(thread, self, node) != tag) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+}
+
+static Arcadia_SizeValue
+checkIndex
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node,
+    Arcadia_SizeValue index
+  )
+{
+  if (index >= readNatural32(thread, self, (Arcadia_SizeValue)node + 1)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  return index;
+}
+
+static void
+Arcadia_DDL_BinaryReader_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_DDL_BinaryReader);
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  if (2 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  //
+  self->stringTable = (Arcadia_Languages_StringTable*)Arcadia_ValueStack_getObjectReferenceValueChecked(thread, 2, _Arcadia_Languages_StringTable_getType(thread));
+  self->input = (Arcadia_ByteArray*)Arcadia_ValueStack_getObjectReferenceValueChecked(thread, 1, _Arcadia_ByteArray_getType(thread));
+  self->bytes = Arcadia_ByteArray_getBytes(thread, self->input);
+  if (Arcadia_ByteArray_getNumberOfBytes(thread, self->input) > Arcadia_Natural32Value_Maximum) {
+    raiseEncodingInvalid(thread);
+  }
+  self->numberOfBytes = (Arcadia_Natural32Value)Arcadia_ByteArray_getNumberOfBytes(thread, self->input);
+  //
+  if (self->numberOfBytes < Arcadia_DDL_BinaryFormat_HeaderSize) {
+    raiseEncodingInvalid(thread);
+  }
+  if (self->bytes[0] != Arcadia_DDL_BinaryFormat_Magic0 || self->bytes[1] != Arcadia_DDL_BinaryFormat_Magic1 ||
+      self->bytes[2] != Arcadia_DDL_BinaryFormat_Magic2 || self->bytes[3] != Arcadia_DDL_BinaryFormat_Magic3) {
+    raiseEncodingInvalid(thread);
+  }
+  if (Arcadia_DDL_BinaryFormat_Version != readNatural32(thread, self, 4)) {
+    raiseEncodingInvalid(thread);
+  }
+  Arcadia_Natural32Value stringTable = readNatural32(thread, self, 8);
+  self->root = readNatural32(thread, self, 12);
+  if (self->root < Arcadia_DDL_BinaryFormat_HeaderSize || self->root >= stringTable) {
+    raiseEncodingInvalid(thread);
+  }
+  self->numberOfStrings = readNatural32(thread, self, stringTable);
+  self->stringOffsets = stringTable + 4;
+  if ((self->numberOfBytes - self->stringOffsets) / 4 < self->numberOfStrings) {
+    raiseEncodingInvalid(thread);
+  }
+  //
+  Arcadia_LeaveConstructor(Arcadia_DDL_BinaryReader);
+}
+
+static void
+Arcadia_DDL_BinaryReader_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReaderDispatch* self
+  )
+{/*Intentionally empty.*/}
+
+static void
+Arcadia_DDL_BinaryReader_visit
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self
+  )
+{
+  if (self->stringTable) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->stringTable);
+  }
+  if (self->input) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->input);
+  }
+}
+
+Arcadia_DDL_BinaryReader*
+Arcadia_DDL_BinaryReader_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Languages_StringTable* stringTable,
+    Arcadia_ByteArray* input
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  if (stringTable) Arcadia_ValueStack_pushObjectReferenceValue(thread, (Arcadia_Object*)stringTable); else Arcadia_ValueStack_pushVoidValue(thread, Arcadia_VoidValue_Void);
+  if (input) Arcadia_ValueStack_pushObjectReferenceValue(thread, (Arcadia_Object*)input); else Arcadia_ValueStack_pushVoidValue(thread, Arcadia_VoidValue_Void);
+  Arcadia_ValueStack_pushNatural8Value(thread, 2);
+  ARCADIA_CREATEOBJECT(Arcadia_DDL_BinaryReader);
+}
+
+Arcadia_Natural32Value
+Arcadia_DDL_BinaryReader_getRoot
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self
+  )
+{ return self->root; }
+
+Arcadia_DDL_NodeType
+Arcadia_DDL_BinaryReader_getType
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node
+  )
+{
+  switch (readNatural8(thread, self, node)) {
+    case Arcadia_DDL_BinaryFormat_Tag_Boolean: {
+      return Arcadia_DDL_NodeType_Boolean;
+    } break;
+    case Arcadia_DDL_BinaryFormat_Tag_List: {
+      return Arcadia_DDL_NodeType_List;
+    } break;
+    case Arcadia_DDL_BinaryFormat_Tag_Map: {
+      return Arcadia_DDL_NodeType_Map;
+    } break;
+    case Arcadia_DDL_BinaryFormat_Tag_Number: {
+      return Arcadia_DDL_NodeType_Number;
+    } break;
+    case Arcadia_DDL_BinaryFormat_Tag_String: {
+      return Arcadia_DDL_NodeType_String;
+    } break;
+    case Arcadia_DDL_BinaryFormat_Tag_Void: {
+      return Arcadia_DDL_NodeType_Void;
+    } break;
+    default: {
+      raiseEncodingInvalid(thread);
+    } break;
+  };
+  return Arcadia_DDL_NodeType_Error;
+}
+
+Arcadia_BooleanValue
+Arcadia_DDL_BinaryReader_getBoolean
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node
+  )
+{
+  expectTag(thread, self, node, Arcadia_DDL_BinaryFormat_Tag_Boolean);
+  return readNatural8(thread, self, (Arcadia_SizeValue)node + 1) ? Arcadia_BooleanValue_True : Arcadia_BooleanValue_False;
+}
+
+Arcadia_Integer64Value
+Arcadia_DDL_BinaryReader_getInteger64
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node
+  )
+{
+  expectTag(thread, self, node, Arcadia_DDL_BinaryFormat_Tag_Number);
+  if (Arcadia_DDL_BinaryFormat_NumberKind_Integer64 != readNatural8(thread, self, (Arcadia_SizeValue)node + 1)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ConversionFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  return (Arcadia_Integer64Value)readNatural64(thread, self, (Arcadia_SizeValue)node + 2);
+}
+
+Arcadia_Real64Value
+Arcadia_DDL_BinaryReader_getReal64
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node
+  )
+{
+  expectTag(thread, self, node, Arcadia_DDL_BinaryFormat_Tag_Number);
+  Arcadia_Natural64Value bits = readNatural64(thread, self, (Arcadia_SizeValue)node + 2);
+  switch (readNatural8(thread, self, (Arcadia_SizeValue)node + 1)) {
+    case Arcadia_DDL_BinaryFormat_NumberKind_Integer64: {
+      return (Arcadia_Real64Value)(Arcadia_Integer64Value)bits;
+    } break;
+    case Arcadia_DDL_BinaryFormat_NumberKind_Real64: {
+      Arcadia_Real64Value value;
+      Arcadia_Memory_copy(thread, &value, &bits, sizeof(Arcadia_Real64Value));
+      return value;
+    } break;
+    case Arcadia_DDL_BinaryFormat_NumberKind_None: {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_ConversionFailed);
+      Arcadia_Thread_jump(thread);
+    } break;
+    default: {
+      raiseEncodingInvalid(thread);
+    } break;
+  };
+  return 0.;
+}
+
+Arcadia_String*
+Arcadia_DDL_BinaryReader_getNumberLiteral
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node
+  )
+{
+  expectTag(thread, self, node, Arcadia_DDL_BinaryFormat_Tag_Number);
+  return getString(thread, self, readNatural32(thread, self, (Arcadia_SizeValue)node + 10));
+}
+
+Arcadia_String*
+Arcadia_DDL_BinaryReader_getString
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node
+  )
+{
+  expectTag(thread, self, node, Arcadia_DDL_BinaryFormat_Tag_String);
+  return getString(thread, self, readNatural32(thread, self, (Arcadia_SizeValue)node + 1));
+}
+
+Arcadia_SizeValue
+Arcadia_DDL_BinaryReader_getSize
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node
+  )
+{
+  Arcadia_Natural8Value tag = readNatural8(thread, self, node);
+  if (Arcadia_DDL_BinaryFormat_Tag_List != tag && Arcadia_DDL_BinaryFormat_Tag_Map != tag) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  return readNatural32(thread, self, (Arcadia_SizeValue)node + 1);
+}
+
+Arcadia_Natural32Value
+Arcadia_DDL_BinaryReader_getElementAt
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node,
+    Arcadia_SizeValue index
+  )
+{
+  expectTag(thread, self, node, Arcadia_DDL_BinaryFormat_Tag_List);
+  checkIndex(thread, self, node, index);
+  return getChild(thread, self, node, (Arcadia_SizeValue)node + 5 + index * 4);
+}
+
+Arcadia_String*
+Arcadia_DDL_BinaryReader_getKeyAt
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node,
+    Arcadia_SizeValue index
+  )
+{
+  expectTag(thread, self, node, Arcadia_DDL_BinaryFormat_Tag_Map);
+  checkIndex(thread, self, node, index);
+  return getString(thread, self, readNatural32(thread, self, (Arcadia_SizeValue)node + 5 + index * 8));
+}
+
+Arcadia_Natural32Value
+Arcadia_DDL_BinaryReader_getValueAt
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node,
+    Arcadia_SizeValue index
+  )
+{
+  expectTag(thread, self, node, Arcadia_DDL_BinaryFormat_Tag_Map);
+  checkIndex(thread, self, node, index);
+  return getChild(thread, self, node, (Arcadia_SizeValue)node + 5 + index * 8 + 4);
+}
+
+Arcadia_BooleanValue
+Arcadia_DDL_BinaryReader_find_pn
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node,
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes,
+    Arcadia_Natural32Value* value
+  )
+{
+  expectTag(thread, self, node, Arcadia_DDL_BinaryFormat_Tag_Map);
+  Arcadia_SizeValue n = readNatural32(thread, self, (Arcadia_SizeValue)node + 1);
+  Arcadia_SizeValue entries = (Arcadia_SizeValue)node + 5;
+  Arcadia_SizeValue order = entries + n * 8;
+  Arcadia_SizeValue l = 0, r = n;
+  while (l < r) {
+    Arcadia_SizeValue m = l + (r - l) / 2;
+    Arcadia_SizeValue i = readNatural32(thread, self, order + m * 4);
+    if (i >= n) {
+      raiseEncodingInvalid(thread);
+    }
+    Arcadia_SizeValue keyNumberOfBytes;
+    Arcadia_Natural8Value const* keyBytes = getStringBytes(thread, self, readNatural32(thread, self, entries + i * 8), &keyNumberOfBytes);
+    Arcadia_Integer32Value c = Arcadia_DDL_BinaryFormat_compareKeys(thread, keyBytes, keyNumberOfBytes, bytes, numberOfBytes);
+    if (c < 0) {
+      l = m + 1;
+    } else if (c > 0) {
+      r = m;
+    } else {
+      *value = getChild(thread, self, node, entries + i * 8 + 4);
+      return Arcadia_BooleanValue_True;
+    }
+  }
+  return Arcadia_BooleanValue_False;
+}
+
+Arcadia_BooleanValue
+Arcadia_DDL_BinaryReader_find
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node,
+    Arcadia_String* key,
+    Arcadia_Natural32Value* value
+  )
+{ return Arcadia_DDL_BinaryReader_find_pn(thread, self, node, Arcadia_String_getBytes(thread, key), Arcadia_String_getNumberOfBytes(thread, key), value); }
+
+Arcadia_DDL_Node*
+Arcadia_DDL_BinaryReader_toNode
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node
+  )
+{
+  switch (Arcadia_DDL_BinaryReader_getType(thread, self, node)) {
+    case Arcadia_DDL_NodeType_Boolean: {
+      return (Arcadia_DDL_Node*)Arcadia_DDL_BooleanNode_createBoolean(thread, Arcadia_DDL_BinaryReader_getBoolean(thread, self, node));
+    } break;
+    case Arcadia_DDL_NodeType_List: {
+      Arcadia_DDL_ListNode* listNode = Arcadia_DDL_ListNode_create(thread);
+      for (Arcadia_SizeValue i = 0, n = Arcadia_DDL_BinaryReader_getSize(thread, self, node); i < n; ++i) {
+        Arcadia_DDL_Node* elementNode = Arcadia_DDL_BinaryReader_toNode(thread, self, Arcadia_DDL_BinaryReader_getElementAt(thread, self, node, i));
+        Arcadia_List_insertBackObjectReferenceValue(thread, listNode->elements, (Arcadia_Object*)elementNode);
+      }
+      return (Arcadia_DDL_Node*)listNode;
+    } break;
+    case Arcadia_DDL_NodeType_Map: {
+      Arcadia_DDL_MapNode* mapNode = Arcadia_DDL_MapNode_create(thread);
+      for (Arcadia_SizeValue i = 0, n = Arcadia_DDL_BinaryReader_getSize(thread, self, node); i < n; ++i) {
+        Arcadia_DDL_NameNode* keyNode = Arcadia_DDL_NameNode_create(thread, Arcadia_DDL_BinaryReader_getKeyAt(thread, self, node, i));
+        Arcadia_DDL_Node* valueNode = Arcadia_DDL_BinaryReader_toNode(thread, self, Arcadia_DDL_BinaryReader_getValueAt(thread, self, node, i));
+        Arcadia_List_insertBackObjectReferenceValue(thread, mapNode->entries, (Arcadia_Object*)Arcadia_DDL_MapEntryNode_create(thread, keyNode, valueNode));
+      }
+      return (Arcadia_DDL_Node*)mapNode;
+    } break;
+    case Arcadia_DDL_NodeType_Number: {
+      return (Arcadia_DDL_Node*)Arcadia_DDL_NumberNode_createString(thread, Arcadia_DDL_BinaryReader_getNumberLiteral(thread, self, node));
+    } break;
+    case Arcadia_DDL_NodeType_String: {
+      return (Arcadia_DDL_Node*)Arcadia_DDL_StringNode_createString(thread, Arcadia_DDL_BinaryReader_getString(thread, self, node));
+    } break;
+    case Arcadia_DDL_NodeType_Void: {
+      return (Arcadia_DDL_Node*)Arcadia_DDL_VoidNode_createVoid(thread, Arcadia_VoidValue_Void);
+    } break;
+    default: {
+      raiseEncodingInvalid(thread);
+    } break;
+  };
+  return NULL;
+}
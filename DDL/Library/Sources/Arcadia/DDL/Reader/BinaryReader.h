@@ -0,0 +1,276 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_DDL_READER_BINARYREADER_H_INCLUDED)
+#define ARCADIA_DDL_READER_BINARYREADER_H_INCLUDED
+
+#if !defined(ARCADIA_DDL_MODULE) || 1 != ARCADIA_DDL_MODULE
+  #error("do not include directly, include `Arcadia/DDL/Include.h` instead")
+#endif
+
+#include "Arcadia/DDL/Nodes/Include.h"
+#include "Arcadia/Languages/Include.h"
+
+/// @brief A reader for the binary encoding described in `Arcadia/DDL/BinaryFormat.h`.
+/// @code
+/// class Arcadia.DDL.BinaryReader
+/// @endcode
+/// The reader does not build a node tree.
+/// It answers queries directly from the Bytes of the document.
+/// A node is denoted by its offset in the document.
+Arcadia_declareObjectType(u8"Arcadia.DDL.BinaryReader", Arcadia_DDL_BinaryReader,
+                          u8"Arcadia.Object");
+
+/// @brief Create a DDL binary reader.
+/// @param thread A pointer to this thread.
+/// @param stringTable A pointer to the string table.
+/// @param input A pointer to the Byte array. The Bytes must not be modified while the reader uses them.
+/// @return A pointer to the DDL binary reader.
+/// @error Arcadia_Status_EncodingInvalid the header or the string table of the document is invalid
+Arcadia_DDL_BinaryReader*
+Arcadia_DDL_BinaryReader_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Languages_StringTable* stringTable,
+    Arcadia_ByteArray* input
+  );
+
+/// @brief Get the root node.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this DDL binary reader.
+/// @return The root node.
+Arcadia_Natural32Value
+Arcadia_DDL_BinaryReader_getRoot
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self
+  );
+
+/// @brief Get the type of a node.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this DDL binary reader.
+/// @param node The node.
+/// @return The type of the node. One of Arcadia_DDL_NodeType_Boolean, Arcadia_DDL_NodeType_List, Arcadia_DDL_NodeType_Map,
+/// Arcadia_DDL_NodeType_Number, Arcadia_DDL_NodeType_String, or Arcadia_DDL_NodeType_Void.
+/// @error Arcadia_Status_EncodingInvalid the node is invalid
+Arcadia_DDL_NodeType
+Arcadia_DDL_BinaryReader_getType
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node
+  );
+
+/// @brief Get the value of a boolean node.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this DDL binary reader.
+/// @param node The boolean node.
+/// @return The value.
+/// @error Arcadia_Status_ArgumentValueInvalid @a node is not a boolean node
+/// @error Arcadia_Status_EncodingInvalid the node is invalid
+Arcadia_BooleanValue
+Arcadia_DDL_BinaryReader_getBoolean
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node
+  );
+
+/// @brief Get the Integer64 value of a number node.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this DDL binary reader.
+/// @param node The number node.
+/// @return The value. It was converted from the literal when the document was written.
+/// @error Arcadia_Status_ArgumentValueInvalid @a node is not a number node
+/// @error Arcadia_Status_ConversionFailed the literal is not an integer literal representable by an Integer64 value
+/// @error Arcadia_Status_EncodingInvalid the node is invalid
+Arcadia_Integer64Value
+Arcadia_DDL_BinaryReader_getInteger64
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node
+  );
+
+/// @brief Get the Real64 value of a number node.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this DDL binary reader.
+/// @param node The number node.
+/// @return The value. It was converted from the literal when the document was written.
+/// @error Arcadia_Status_ArgumentValueInvalid @a node is not a number node
+/// @error Arcadia_Status_ConversionFailed the literal is not representable by a Real64 value
+/// @error Arcadia_Status_EncodingInvalid the node is invalid
+Arcadia_Real64Value
+Arcadia_DDL_BinaryReader_getReal64
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node
+  );
+
+/// @brief Get the literal of a number node.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this DDL binary reader.
+/// @param node The number node.
+/// @return The literal.
+/// @error Arcadia_Status_ArgumentValueInvalid @a node is not a number node
+/// @error Arcadia_Status_EncodingInvalid the node is invalid
+Arcadia_String*
+Arcadia_DDL_BinaryReader_getNumberLiteral
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node
+  );
+
+/// @brief Get the value of a string node.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this DDL binary reader.
+/// @param node The string node.
+/// @return The value.
+/// @error Arcadia_Status_ArgumentValueInvalid @a node is not a string node
+/// @error Arcadia_Status_EncodingInvalid the node is invalid
+Arcadia_String*
+Arcadia_DDL_BinaryReader_getString
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node
+  );
+
+/// @brief Get the number of elements of a list node or the number of entries of a map node.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this DDL binary reader.
+/// @param node The list node or map node.
+/// @return The number of elements or entries.
+/// @error Arcadia_Status_ArgumentValueInvalid @a node is neither a list node nor a map node
+/// @error Arcadia_Status_EncodingInvalid the node is invalid
+Arcadia_SizeValue
+Arcadia_DDL_BinaryReader_getSize
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node
+  );
+
+/// @brief Get an element of a list node.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this DDL binary reader.
+/// @param node The list node.
+/// @param index The index of the element.
+/// @return The element node.
+/// @error Arcadia_Status_ArgumentValueInvalid @a node is not a list node
+/// @error Arcadia_Status_ArgumentValueInvalid @a index is out of bounds
+/// @error Arcadia_Status_EncodingInvalid the node is invalid
+Arcadia_Natural32Value
+Arcadia_DDL_BinaryReader_getElementAt
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node,
+    Arcadia_SizeValue index
+  );
+
+/// @brief Get the key of an entry of a map node.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this DDL binary reader.
+/// @param node The map node.
+/// @param index The index of the entry. Entries are in source order.
+/// @return The key.
+/// @error Arcadia_Status_ArgumentValueInvalid @a node is not a map node
+/// @error Arcadia_Status_ArgumentValueInvalid @a index is out of bounds
+/// @error Arcadia_Status_EncodingInvalid the node is invalid
+Arcadia_String*
+Arcadia_DDL_BinaryReader_getKeyAt
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node,
+    Arcadia_SizeValue index
+  );
+
+/// @brief Get the value of an entry of a map node.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this DDL binary reader.
+/// @param node The map node.
+/// @param index The index of the entry. Entries are in source order.
+/// @return The value node.
+/// @error Arcadia_Status_ArgumentValueInvalid @a node is not a map node
+/// @error Arcadia_Status_ArgumentValueInvalid @a index is out of bounds
+/// @error Arcadia_Status_EncodingInvalid the node is invalid
+Arcadia_Natural32Value
+Arcadia_DDL_BinaryReader_getValueAt
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node,
+    Arcadia_SizeValue index
+  );
+
+/// @brief Find the value of the entry with the specified key in a map node.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this DDL binary reader.
+/// @param node The map node.
+/// @param bytes, numberOfBytes The UTF-8 Bytes of the key.
+/// @param value A pointer to a variable receiving the value node if the entry was found.
+/// @return Arcadia_BooleanValue_True if the entry was found. Arcadia_BooleanValue_False otherwise.
+/// @remarks This performs a binary search on the key order stored in the document and does not allocate.
+/// @error Arcadia_Status_ArgumentValueInvalid @a node is not a map node
+/// @error Arcadia_Status_EncodingInvalid the node is invalid
+Arcadia_BooleanValue
+Arcadia_DDL_BinaryReader_find_pn
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node,
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes,
+    Arcadia_Natural32Value* value
+  );
+
+/// @brief Find the value of the entry with the specified key in a map node.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this DDL binary reader.
+/// @param node The map node.
+/// @param key The key.
+/// @param value A pointer to a variable receiving the value node if the entry was found.
+/// @return Arcadia_BooleanValue_True if the entry was found. Arcadia_BooleanValue_False otherwise.
+/// @error Arcadia_Status_ArgumentValueInvalid @a node is not a map node
+/// @error Arcadia_Status_EncodingInvalid the node is invalid
+Arcadia_BooleanValue
+Arcadia_DDL_BinaryReader_find
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node,
+    Arcadia_String* key,
+    Arcadia_Natural32Value* value
+  );
+
+/// @brief Build the node tree of a node.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this DDL binary reader.
+/// @param node The node.
+/// @return A pointer to the DDL node.
+/// @error Arcadia_Status_EncodingInvalid the node or one of its descendants is invalid
+Arcadia_DDL_Node*
+Arcadia_DDL_BinaryReader_toNode
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryReader* self,
+    Arcadia_Natural32Value node
+  );
+
+#endif // ARCADIA_DDL_READER_BINARYREADER_H_INCLUDED
@@ -125,3 +125,16 @@ Arcadia_DDL_DefaultReader_run
   Arcadia_DDL_Node* node = (Arcadia_DDL_Node*)Arcadia_Value_getObjectReferenceValueChecked(thread, Arcadia_Languages_Parser_run(thread, (Arcadia_Languages_Parser*)self->parser), _Arcadia_DDL_Node_getType(thread));
   return node;
 }
+
+Arcadia_DDL_Node*
+Arcadia_DDL_DefaultReader_runBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_DefaultReader* self,
+    Arcadia_ByteArray* input
+  )
+{
+  Arcadia_DDL_Parser_setInputBytes(thread, self->parser, input);
+  Arcadia_DDL_Node* node = (Arcadia_DDL_Node*)Arcadia_Value_getObjectReferenceValueChecked(thread, Arcadia_Languages_Parser_run(thread, (Arcadia_Languages_Parser*)self->parser), _Arcadia_DDL_Node_getType(thread));
+  return node;
+}
@@ -55,4 +55,18 @@ Arcadia_DDL_DefaultReader_run
     Arcadia_UnicodeCodePointReader* input
   );
 
+/// @brief Run this DDL default reader on the specified Bytes.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this DDL default reader.
+/// @param input A pointer to the Byte array.
+/// @return A pointer to the result DDL tree node.
+/// @see Arcadia_DDL_Scanner_setInputBytes
+Arcadia_DDL_Node*
+Arcadia_DDL_DefaultReader_runBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_DefaultReader* self,
+    Arcadia_ByteArray* input
+  );
+
 #endif // ARCADIA_DDL_READER_DEFAULTREADER_H_INCLUDED
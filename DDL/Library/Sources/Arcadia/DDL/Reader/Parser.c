@@ -489,4 +489,15 @@ Arcadia_DDL_Parser_setInputImpl
   )
 {
   Arcadia_Languages_Scanner_setInput(thread, (Arcadia_Languages_Scanner*)self->scanner, input);
-}
\ No newline at end of file
+}
+
+void
+Arcadia_DDL_Parser_setInputBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_Parser* self,
+    Arcadia_ByteArray* input
+  )
+{
+  Arcadia_DDL_Scanner_setInputBytes(thread, self->scanner, input);
+}
@@ -37,4 +37,17 @@ Arcadia_DDL_Parser_create
     Arcadia_DDL_Scanner* scanner
   );
 
+/// @brief Set the input of this Data Definition Language parser to the specified Bytes.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this Data Definition Language parser.
+/// @param input A pointer to the Byte array.
+/// @see Arcadia_DDL_Scanner_setInputBytes
+void
+Arcadia_DDL_Parser_setInputBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_Parser* self,
+    Arcadia_ByteArray* input
+  );
+
 #endif // ARCADIA_DDL_READER_PARSER_H_INCLUDED
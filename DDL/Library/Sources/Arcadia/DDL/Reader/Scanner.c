@@ -44,6 +44,21 @@
 #define CodePoint_End (Arcadia_Unicode_CodePoint_Last + 2)
 #define CodePoint_Error (Arcadia_Unicode_CodePoint_Last + 3)
 
+// If the input was set using Arcadia_DDL_Scanner_setInputBytes, the scanner operates in "Byte mode".
+// In Byte mode, the scanner does not pull code points through the Arcadia_UnicodeCodePointReader.
+// Instead, it works directly on the contiguous UTF-8 Bytes of the input:
+// - the scanner dispatches on ASCII Bytes directly and only decodes (and validates) UTF-8 sequences in string literals and comments,
+// - runs of whitespace and the bodies of comments and string literals are skipped 16 Bytes at a time if SSE2 is available,
+// - the text of a word is recorded as a slice (start, length) of the input and is only interned when requested.
+//   Only string literals with escape sequences are written to the string buffer.
+
+#if Arcadia_Configuration_InstructionSetArchitecture == Arcadia_Configuration_InstructionSetArchitecture_X64
+  #include <emmintrin.h>
+  #define Arcadia_DDL_Scanner_WithSSE2 (1)
+#else
+  #define Arcadia_DDL_Scanner_WithSSE2 (0)
+#endif
+
 struct Arcadia_DDL_ScannerDispatch {
   Arcadia_Languages_ScannerDispatch _parent;
 };
@@ -70,7 +85,33 @@ struct Arcadia_DDL_Scanner {
     Arcadia_Natural32Value start;
     /// The length of the word in Bytes.
     Arcadia_Natural32Value length;
+    /// Byte mode only.
+    /// If Arcadia_BooleanValue_True, the text of the word is stored in the string buffer.
+    /// Otherwise the text of the word is the slice (textStart, textLength) of the input.
+    Arcadia_BooleanValue textBuffered;
+    /// Byte mode only.
+    /// The start of the text of the word as an offset in Bytes from the beginning of the input.
+    Arcadia_Natural32Value textStart;
+    /// Byte mode only.
+    /// The length of the text of the word in Bytes.
+    Arcadia_Natural32Value textLength;
+    /// Byte mode only.
+    /// The interned text of the word or null if the text was not interned yet.
+    Arcadia_String* string;
   } word;
+  // The input Bytes if this scanner is in Byte mode, null otherwise.
+  Arcadia_ByteArray* inputBytes;
+  struct {
+    /// Pointer to the first Byte of the input.
+    Arcadia_Natural8Value const* start;
+    /// Pointer to the current Byte of the input.
+    Arcadia_Natural8Value const* current;
+    /// Pointer to the Byte after the last Byte of the input.
+    Arcadia_Natural8Value const* end;
+  } bytes;
+  // The minimum and the maximum length, in Bytes, of a keyword.
+  // Used in Byte mode to avoid interning names which can not be keywords.
+  Arcadia_SizeValue minimumKeywordLength, maximumKeywordLength;
 };
 
 static void
@@ -267,6 +308,16 @@ Arcadia_DDL_Scanner_constructImpl
   self->keywords = NULL;
   self->input = NULL;
   self->symbol = CodePoint_Start;
+  self->word.textBuffered = Arcadia_BooleanValue_True;
+  self->word.textStart = 0;
+  self->word.textLength = 0;
+  self->word.string = NULL;
+  self->inputBytes = NULL;
+  self->bytes.start = NULL;
+  self->bytes.current = NULL;
+  self->bytes.end = NULL;
+  self->minimumKeywordLength = Arcadia_SizeValue_Maximum;
+  self->maximumKeywordLength = Arcadia_SizeValue_Minimum;
   //
   self->keywords = Arcadia_DataDefinitionLanguage_Keywords_create(thread);
   self->input = (Arcadia_UnicodeCodePointReader*)Arcadia_ByteReader_UnicodeCodePointReader_create(thread, (Arcadia_ByteReader*)Arcadia_ByteArray_ByteReader_create(thread, Arcadia_ByteArray_createByteArray(thread, Arcadia_RuntimeByteArray_create(thread, u8"", sizeof(u8"") - 1))));
@@ -285,6 +336,8 @@ Arcadia_DDL_Scanner_constructImpl
     Arcadia_StringBuilder_clear(thread, temporary); \
     Arcadia_StringBuilder_insertBackCxxString(thread, temporary, text); \
     Arcadia_DataDefinitionLanguage_Keywords_add(thread, self->keywords, Arcadia_Languages_StringTable_getOrCreateString(thread, self->stringTable, temporary), Arcadia_DDL_WordType_##type); \
+    self->minimumKeywordLength = Arcadia_minimumSizeValue(thread, self->minimumKeywordLength, Arcadia_StringBuilder_getNumberOfBytes(thread, temporary)); \
+    self->maximumKeywordLength = Arcadia_maximumSizeValue(thread, self->maximumKeywordLength, Arcadia_StringBuilder_getNumberOfBytes(thread, temporary)); \
   }
   //
   // literals
@@ -348,6 +401,13 @@ Arcadia_DDL_Scanner_visit
   if (self->keywords) {
     Arcadia_Object_visit(thread, (Arcadia_Object*)self->keywords);
   }
+
+  if (self->word.string) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->word.string);
+  }
+  if (self->inputBytes) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->inputBytes);
+  }
 }
 
 static void
@@ -471,7 +531,15 @@ Arcadia_DDL_Scanner_getWordTextImpl
     Arcadia_Thread* thread,
     Arcadia_DDL_Scanner* self
   )
-{ return Arcadia_Languages_StringTable_getOrCreateString(thread, self->stringTable, self->word.text); }
+{
+  if (!self->inputBytes || self->word.textBuffered) {
+    return Arcadia_Languages_StringTable_getOrCreateString(thread, self->stringTable, self->word.text);
+  }
+  if (!self->word.string) {
+    self->word.string = Arcadia_Languages_StringTable_getOrCreateStringFromBytes(thread, self->stringTable, self->bytes.start + self->word.textStart, self->word.textLength);
+  }
+  return self->word.string;
+}
 
 static Arcadia_Integer32Value
 Arcadia_DDL_Scanner_getWordTypeImpl
@@ -688,6 +756,530 @@ onStringLiteral
   onEndWord(thread, self, Arcadia_DDL_WordType_StringLiteral);
 }
 
+// Decode the UTF-8 encoded code point starting at p.
+// Return the number of Bytes of the code point or 0 if the Bytes do not form a valid UTF-8 encoded code point.
+static Arcadia_SizeValue
+decodeBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value const* p,
+    Arcadia_Natural8Value const* e,
+    Arcadia_Natural32Value* codePoint
+  )
+{
+  // The masks to remove the prefix bits from the first Byte.
+  static const Arcadia_Natural8Value mask[] = {
+    0b11111111,
+    0b00011111,
+    0b00001111,
+    0b00000111,
+  };
+  // The smallest code point which may be encoded by 1, 2, 3, or 4 Bytes.
+  static const Arcadia_Natural32Value minimum[] = {
+    0x00000,
+    0x00080,
+    0x00800,
+    0x10000,
+  };
+  Arcadia_SizeValue n = Arcadia_Unicode_UTF8_classifyFirstByte(thread, *p);
+  if (Arcadia_SizeValue_Maximum == n || (Arcadia_SizeValue)(e - p) < n) {
+    return 0;
+  }
+  Arcadia_Natural32Value x = p[0] & mask[n - 1];
+  for (Arcadia_SizeValue i = 1; i < n; ++i) {
+    if (0x80 != (p[i] & 0xC0)) {
+      return 0;
+    }
+    x = (x << 6) | (p[i] & 0x3F);
+  }
+  if (x < minimum[n - 1] || x > Arcadia_Unicode_CodePoint_Last) {
+    return 0;
+  }
+  *codePoint = x;
+  return n;
+}
+
+// Write the specified Bytes to the string buffer.
+// The Bytes must be valid UTF-8.
+static void
+writeBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_Scanner* self,
+    Arcadia_Natural8Value const* p,
+    Arcadia_Natural8Value const* e
+  )
+{
+  Arcadia_Natural32Value codePoints[32];
+  Arcadia_SizeValue numberOfCodePoints = 0;
+  while (p != e) {
+    if (*p < 0x80) {
+      codePoints[numberOfCodePoints++] = *p++;
+    } else {
+      p += decodeBytes(thread, p, e, &codePoints[numberOfCodePoints++]);
+    }
+    if (numberOfCodePoints == 32) {
+      Arcadia_StringBuilder_insertBackCodePoints(thread, self->word.text, codePoints, numberOfCodePoints);
+      numberOfCodePoints = 0;
+    }
+  }
+  if (numberOfCodePoints) {
+    Arcadia_StringBuilder_insertBackCodePoints(thread, self->word.text, codePoints, numberOfCodePoints);
+  }
+}
+
+// Skip Bytes which are <space> or <tabulator>.
+static Arcadia_Natural8Value const*
+skipWhiteSpace
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value const* p,
+    Arcadia_Natural8Value const* e
+  )
+{
+#if 1 == Arcadia_DDL_Scanner_WithSSE2
+  __m128i const space = _mm_set1_epi8(' ');
+  __m128i const tabulator = _mm_set1_epi8('\t');
+  while (e - p >= 16) {
+    __m128i x = _mm_loadu_si128((__m128i const*)p);
+    __m128i y = _mm_or_si128(_mm_cmpeq_epi8(x, space), _mm_cmpeq_epi8(x, tabulator));
+    Arcadia_Natural32Value stop = (~(Arcadia_Natural32Value)_mm_movemask_epi8(y)) & 0xffff;
+    if (stop) {
+      return p + Arcadia_countTrailingZeroesNatural32Value(thread, stop);
+    }
+    p += 16;
+  }
+#endif
+  while (p != e && (' ' == *p || '\t' == *p)) {
+    p++;
+  }
+  return p;
+}
+
+// Skip ASCII Bytes which are not <line feed> or <carriage return>.
+static Arcadia_Natural8Value const*
+skipSingleLineCommentBody
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value const* p,
+    Arcadia_Natural8Value const* e
+  )
+{
+#if 1 == Arcadia_DDL_Scanner_WithSSE2
+  __m128i const lineFeed = _mm_set1_epi8('\n');
+  __m128i const carriageReturn = _mm_set1_epi8('\r');
+  while (e - p >= 16) {
+    __m128i x = _mm_loadu_si128((__m128i const*)p);
+    __m128i y = _mm_or_si128(_mm_cmpeq_epi8(x, lineFeed), _mm_cmpeq_epi8(x, carriageReturn));
+    // _mm_movemask_epi8(x) has a bit set for each non-ASCII Byte.
+    Arcadia_Natural32Value stop = (Arcadia_Natural32Value)(_mm_movemask_epi8(y) | _mm_movemask_epi8(x));
+    if (stop) {
+      return p + Arcadia_countTrailingZeroesNatural32Value(thread, stop);
+    }
+    p += 16;
+  }
+#endif
+  while (p != e && *p < 0x80 && '\n' != *p && '\r' != *p) {
+    p++;
+  }
+  return p;
+}
+
+// Skip ASCII Bytes which are not <star>.
+static Arcadia_Natural8Value const*
+skipMultiLineCommentBody
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value const* p,
+    Arcadia_Natural8Value const* e
+  )
+{
+#if 1 == Arcadia_DDL_Scanner_WithSSE2
+  __m128i const star = _mm_set1_epi8('*');
+  while (e - p >= 16) {
+    __m128i x = _mm_loadu_si128((__m128i const*)p);
+    // _mm_movemask_epi8(x) has a bit set for each non-ASCII Byte.
+    Arcadia_Natural32Value stop = (Arcadia_Natural32Value)(_mm_movemask_epi8(_mm_cmpeq_epi8(x, star)) | _mm_movemask_epi8(x));
+    if (stop) {
+      return p + Arcadia_countTrailingZeroesNatural32Value(thread, stop);
+    }
+    p += 16;
+  }
+#endif
+  while (p != e && *p < 0x80 && '*' != *p) {
+    p++;
+  }
+  return p;
+}
+
+// Skip ASCII Bytes which are not <quotation mark>, <reverse solidus>, or control characters.
+static Arcadia_Natural8Value const*
+skipStringLiteralBody
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value const* p,
+    Arcadia_Natural8Value const* e
+  )
+{
+#if 1 == Arcadia_DDL_Scanner_WithSSE2
+  __m128i const quotationMark = _mm_set1_epi8('"');
+  __m128i const reverseSolidus = _mm_set1_epi8('\\');
+  __m128i const space = _mm_set1_epi8(' ');
+  while (e - p >= 16) {
+    __m128i x = _mm_loadu_si128((__m128i const*)p);
+    // The comparison is signed: non-ASCII Bytes are negative and hence are also smaller than <space>.
+    __m128i y = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(x, quotationMark), _mm_cmpeq_epi8(x, reverseSolidus)), _mm_cmplt_epi8(x, space));
+    Arcadia_Natural32Value stop = (Arcadia_Natural32Value)_mm_movemask_epi8(y);
+    if (stop) {
+      return p + Arcadia_countTrailingZeroesNatural32Value(thread, stop);
+    }
+    p += 16;
+  }
+#endif
+  while (p != e && 0x20 <= *p && *p < 0x80 && '"' != *p && '\\' != *p) {
+    p++;
+  }
+  return p;
+}
+
+// Skip a non-ASCII UTF-8 encoded code point.
+static Arcadia_Natural8Value const*
+skipNonASCII
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value const* p,
+    Arcadia_Natural8Value const* e
+  )
+{
+  Arcadia_Natural32Value codePoint;
+  Arcadia_SizeValue n = decodeBytes(thread, p, e, &codePoint);
+  if (!n) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_LexicalError);
+    Arcadia_Thread_jump(thread);
+  }
+  return p + n;
+}
+
+static Arcadia_BooleanValue
+isDecimalDigitByte
+  (
+    Arcadia_Natural8Value x
+  )
+{ return '0' <= x && x <= '9'; }
+
+static Arcadia_BooleanValue
+isHexadecimalDigitByte
+  (
+    Arcadia_Natural8Value x
+  )
+{
+  return ('0' <= x && x <= '9')
+      || ('a' <= x && x <= 'f')
+      || ('A' <= x && x <= 'F');
+}
+
+static Arcadia_BooleanValue
+isNameStartByte
+  (
+    Arcadia_Natural8Value x
+  )
+{
+  return ('A' <= x && x <= 'Z')
+      || ('a' <= x && x <= 'z')
+      || ('_' == x);
+}
+
+static Arcadia_BooleanValue
+isNamePartByte
+  (
+    Arcadia_Natural8Value x
+  )
+{ return isNameStartByte(x) || isDecimalDigitByte(x); }
+
+// Terminate a word in Byte mode.
+// The text of the word is the slice [textStart, textEnd) of the input unless it was written to the string buffer.
+static void
+onEndWordBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_Scanner* self,
+    Arcadia_DDL_WordType type,
+    Arcadia_Natural8Value const* textStart,
+    Arcadia_Natural8Value const* textEnd,
+    Arcadia_Natural8Value const* end
+  )
+{
+  self->word.type = type;
+  self->word.textStart = (Arcadia_Natural32Value)(textStart - self->bytes.start);
+  self->word.textLength = (Arcadia_Natural32Value)(textEnd - textStart);
+  self->word.length = (Arcadia_Natural32Value)(end - self->bytes.current);
+  self->bytes.current = end;
+}
+
+static Arcadia_Natural8Value const*
+onNumberLiteralBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_Scanner* self,
+    Arcadia_Natural8Value const* p,
+    Arcadia_Natural8Value const* e,
+    Arcadia_DDL_WordType* type
+  )
+{
+  *type = Arcadia_DDL_WordType_IntegerLiteral;
+  if (p != e && ('+' == *p || '-' == *p)) {
+    p++;
+  }
+  if (p != e && isDecimalDigitByte(*p)) {
+    // We have a non-empty integral part.
+    // We do not require a non-empty fractional part.
+    do {
+      p++;
+    } while (p != e && isDecimalDigitByte(*p));
+    if (p != e && '.' == *p) {
+      *type = Arcadia_DDL_WordType_RealLiteral;
+      p++;
+      while (p != e && isDecimalDigitByte(*p)) {
+        p++;
+      }
+    }
+  } else if (p != e && '.' == *p) {
+    // We have an empty integral part.
+    // We require a non-empty fractional part.
+    *type = Arcadia_DDL_WordType_RealLiteral;
+    p++;
+    if (p == e || !isDecimalDigitByte(*p)) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_LexicalError);
+      Arcadia_Thread_jump(thread);
+    }
+    do {
+      p++;
+    } while (p != e && isDecimalDigitByte(*p));
+  }
+  if (p != e && ('e' == *p || 'E' == *p)) {
+    *type = Arcadia_DDL_WordType_RealLiteral;
+    p++;
+    if (p != e && ('+' == *p || '-' == *p)) {
+      p++;
+    }
+    if (p == e || !isDecimalDigitByte(*p)) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_LexicalError);
+      Arcadia_Thread_jump(thread);
+    }
+    do {
+      p++;
+    } while (p != e && isDecimalDigitByte(*p));
+  }
+  return p;
+}
+
+static void
+onStringLiteralBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_Scanner* self
+  )
+{
+  Arcadia_Natural8Value const* e = self->bytes.end;
+  // Skip the opening <quotation mark>.
+  Arcadia_Natural8Value const* p = self->bytes.current + 1;
+  Arcadia_Natural8Value const* textStart = p;
+  // The start of the Bytes not yet written to the string buffer.
+  Arcadia_Natural8Value const* run = p;
+  while (Arcadia_BooleanValue_True) {
+    p = skipStringLiteralBody(thread, p, e);
+    if (p == e) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_LexicalError);
+      Arcadia_Thread_jump(thread);
+    }
+    if ('"' == *p) {
+      break;
+    } else if ('\\' == *p) {
+      // Escape sequences are rare. The text of the word is written to the string buffer from now on.
+      self->word.textBuffered = Arcadia_BooleanValue_True;
+      writeBytes(thread, self, run, p);
+      p++;
+      if (p == e) {
+        Arcadia_Thread_setStatus(thread, Arcadia_Status_LexicalError);
+        Arcadia_Thread_jump(thread);
+      }
+      // \uxxxx, \b, \f, \n, \r, \t, \0, \v
+      switch (*p) {
+        case 'u': {
+          Arcadia_Natural32Value codePoint = 0;
+          p++;
+          for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+            if (p == e || !isHexadecimalDigitByte(*p)) {
+              Arcadia_Thread_setStatus(thread, Arcadia_Status_LexicalError);
+              Arcadia_Thread_jump(thread);
+            }
+            codePoint = codePoint * 16 + hexadecimalDigitValue(*p);
+            p++;
+          }
+          write(thread, self, codePoint);
+        } break;
+        case '"': { write(thread, self, '"'); p++; } break;
+        case '\\': { write(thread, self, '\\'); p++; } break;
+        case 'b': { write(thread, self, '\b'); p++; } break;
+        case 'f': { write(thread, self, '\f'); p++; } break;
+        case 'n': { write(thread, self, '\n'); p++; } break;
+        case 'r': { write(thread, self, '\r'); p++; } break;
+        case 't': { write(thread, self, '\t'); p++; } break;
+        case '0': { write(thread, self, '\0'); p++; } break;
+        case 'v': { write(thread, self, '\v'); p++; } break;
+        default: {
+          Arcadia_Thread_setStatus(thread, Arcadia_Status_LexicalError);
+          Arcadia_Thread_jump(thread);
+        } break;
+      };
+      run = p;
+    } else if (*p < 0x20) {
+      // Must have had been escaped.
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_LexicalError);
+      Arcadia_Thread_jump(thread);
+    } else {
+      p = skipNonASCII(thread, p, e);
+    }
+  }
+  if (self->word.textBuffered) {
+    writeBytes(thread, self, run, p);
+  }
+  // Skip the closing <quotation mark>.
+  onEndWordBytes(thread, self, Arcadia_DDL_WordType_StringLiteral, textStart, p, p + 1);
+}
+
+static void
+stepBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_Scanner* self
+  )
+{
+  // Prepare for next token.
+  self->word.start = (Arcadia_Natural32Value)(self->bytes.current - self->bytes.start);
+  self->word.length = 0;
+  self->word.string = NULL;
+  if (self->word.textBuffered) {
+    Arcadia_StringBuilder_clear(thread, self->word.text);
+    self->word.textBuffered = Arcadia_BooleanValue_False;
+  }
+
+  Arcadia_Natural8Value const* p = self->bytes.current;
+  Arcadia_Natural8Value const* e = self->bytes.end;
+
+  if (p == e) {
+    self->word.type = Arcadia_DDL_WordType_EndOfInput;
+    self->word.textBuffered = Arcadia_BooleanValue_True;
+    Arcadia_StringBuilder_insertBackCxxString(thread, self->word.text, u8"<end of input>");
+    return;
+  }
+  switch (*p) {
+    // Whitespace :  <Whitespace> | <Tabulator>
+    case ' ': case '\t': {
+      Arcadia_Natural8Value const* q = skipWhiteSpace(thread, p + 1, e);
+      onEndWordBytes(thread, self, Arcadia_DDL_WordType_WhiteSpace, p, q, q);
+    } break;
+    // LineTerminator : <LineFeed>
+    //                  <CarriageReturn>
+    //                  <CarriageReturn> <LineFeed>
+    case '\r': {
+      Arcadia_Natural8Value const* q = (p + 1 != e && '\n' == p[1]) ? p + 2 : p + 1;
+      onEndWordBytes(thread, self, Arcadia_DDL_WordType_LineTerminator, p, q, q);
+    } break;
+    case '\n': {
+      onEndWordBytes(thread, self, Arcadia_DDL_WordType_LineTerminator, p, p + 1, p + 1);
+    } break;
+    case ':': {
+      // <colon>
+      onEndWordBytes(thread, self, Arcadia_DDL_WordType_Colon, p, p + 1, p + 1);
+    } break;
+    case ',': {
+      // <comma>
+      onEndWordBytes(thread, self, Arcadia_DDL_WordType_Comma, p, p + 1, p + 1);
+    } break;
+    case '{': {
+      // <left curly bracket>
+      onEndWordBytes(thread, self, Arcadia_DDL_WordType_LeftCurlyBracket, p, p + 1, p + 1);
+    } break;
+    case '}': {
+      // <right curly bracket>
+      onEndWordBytes(thread, self, Arcadia_DDL_WordType_RightCurlyBracket, p, p + 1, p + 1);
+    } break;
+    case '[': {
+      // <left square bracket>
+      onEndWordBytes(thread, self, Arcadia_DDL_WordType_LeftSquareBracket, p, p + 1, p + 1);
+    } break;
+    case ']': {
+      // <right square bracket>
+      onEndWordBytes(thread, self, Arcadia_DDL_WordType_RightSquareBracket, p, p + 1, p + 1);
+    } break;
+    case '"': {
+      // <string>
+      onStringLiteralBytes(thread, self);
+    } break;
+    case '/': {
+      Arcadia_Natural8Value const* q = p + 1;
+      if (q != e && '*' == *q) {
+        // multi line comment
+        q++;
+        Arcadia_Natural8Value const* textStart = q;
+        while (Arcadia_BooleanValue_True) {
+          q = skipMultiLineCommentBody(thread, q, e);
+          if (q == e) {
+            Arcadia_Thread_setStatus(thread, Arcadia_Status_LexicalError);
+            Arcadia_Thread_jump(thread);
+          } else if ('*' == *q) {
+            if (q + 1 != e && '/' == q[1]) {
+              break;
+            }
+            q++;
+          } else {
+            q = skipNonASCII(thread, q, e);
+          }
+        }
+        onEndWordBytes(thread, self, Arcadia_DDL_WordType_MultiLineComment, textStart, q, q + 2);
+      } else if (q != e && '/' == *q) {
+        // single line comment
+        q++;
+        Arcadia_Natural8Value const* textStart = q;
+        while (Arcadia_BooleanValue_True) {
+          q = skipSingleLineCommentBody(thread, q, e);
+          if (q == e || '\n' == *q || '\r' == *q) {
+            break;
+          }
+          q = skipNonASCII(thread, q, e);
+        }
+        onEndWordBytes(thread, self, Arcadia_DDL_WordType_SingleLineComment, textStart, q, q);
+      } else {
+        Arcadia_Thread_setStatus(thread, Arcadia_Status_LexicalError);
+        Arcadia_Thread_jump(thread);
+      }
+    } break;
+    default: {
+      if (isNameStartByte(*p)) {
+        // <name>
+        Arcadia_Natural8Value const* q = p + 1;
+        while (q != e && isNamePartByte(*q)) {
+          q++;
+        }
+        onEndWordBytes(thread, self, Arcadia_DDL_WordType_Name, p, q, q);
+        Arcadia_SizeValue n = (Arcadia_SizeValue)(q - p);
+        if (self->minimumKeywordLength <= n && n <= self->maximumKeywordLength) {
+          Arcadia_DataDefinitionLanguage_Keywords_scan(thread, self->keywords, Arcadia_Languages_Scanner_getWordText(thread, (Arcadia_Languages_Scanner*)self), &self->word.type);
+        }
+      } else if (isDecimalDigitByte(*p) || '+' == *p || '-' == *p) {
+        // <number>
+        Arcadia_DDL_WordType type;
+        Arcadia_Natural8Value const* q = onNumberLiteralBytes(thread, self, p, e, &type);
+        onEndWordBytes(thread, self, type, p, q, q);
+      } else {
+        Arcadia_Thread_setStatus(thread, Arcadia_Status_LexicalError);
+        Arcadia_Thread_jump(thread);
+      }
+    } break;
+  };
+}
+
 static void
 Arcadia_DDL_Scanner_stepImpl
   (
@@ -695,6 +1287,10 @@ Arcadia_DDL_Scanner_stepImpl
     Arcadia_DDL_Scanner* self
   )
 {
+  if (self->inputBytes) {
+    stepBytes(thread, self);
+    return;
+  }
   // Prepare for next token.
   Arcadia_StringBuilder_clear(thread, self->word.text);
   self->word.start = self->word.start + self->word.length;
@@ -831,6 +1427,12 @@ Arcadia_DDL_Scanner_setInputImpl
   )
 {
   self->input = input;
+  self->inputBytes = NULL;
+  self->bytes.start = NULL;
+  self->bytes.current = NULL;
+  self->bytes.end = NULL;
+  self->word.textBuffered = Arcadia_BooleanValue_True;
+  self->word.string = NULL;
   self->symbol = CodePoint_Start;
   self->word.type = Arcadia_DDL_WordType_StartOfInput;
   self->word.start = 0;
@@ -854,3 +1456,33 @@ Arcadia_DDL_Scanner_getDiagnosticsImpl
     Arcadia_DDL_Scanner* self
   )
 { return self->diagnostics; }
+
+void
+Arcadia_DDL_Scanner_setInputBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_Scanner* self,
+    Arcadia_ByteArray* input
+  )
+{
+  Arcadia_SizeValue numberOfBytes = Arcadia_ByteArray_getNumberOfBytes(thread, input);
+  if (numberOfBytes > Arcadia_Natural32Value_Maximum) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->input = (Arcadia_UnicodeCodePointReader*)Arcadia_ByteReader_UnicodeCodePointReader_create(thread, (Arcadia_ByteReader*)Arcadia_ByteArray_ByteReader_create(thread, input));
+  self->inputBytes = input;
+  self->bytes.start = Arcadia_ByteArray_getBytes(thread, input);
+  self->bytes.current = self->bytes.start;
+  self->bytes.end = self->bytes.start + numberOfBytes;
+  self->symbol = CodePoint_Start;
+  self->word.type = Arcadia_DDL_WordType_StartOfInput;
+  self->word.start = 0;
+  self->word.length = 0;
+  self->word.textBuffered = Arcadia_BooleanValue_True;
+  self->word.textStart = 0;
+  self->word.textLength = 0;
+  self->word.string = NULL;
+  Arcadia_StringBuilder_clear(thread, self->word.text);
+  Arcadia_StringBuilder_insertBackCxxString(thread, self->word.text, u8"<start of input>");
+}
@@ -39,4 +39,20 @@ Arcadia_DDL_Scanner_create
     Arcadia_Languages_Diagnostics* diagnostics
   );
 
+/// @brief Set the input of this DDL scanner to the specified Bytes.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this DDL scanner.
+/// @param input A pointer to the Byte array. The Bytes must not be modified while the scanner uses them.
+/// @remarks
+/// The scanner works directly on the UTF-8 Bytes of the Byte array instead of reading code points through an Arcadia_UnicodeCodePointReader.
+/// The text of a word is recorded as a slice of the Byte array and is only interned when requested.
+/// @error Arcadia_Status_ArgumentValueInvalid the number of Bytes exceeds Arcadia_Natural32Value_Maximum
+void
+Arcadia_DDL_Scanner_setInputBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_Scanner* self,
+    Arcadia_ByteArray* input
+  );
+
 #endif // ARCADIA_DDL_READER_SCANNER_H_INCLUDED
@@ -0,0 +1,564 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#define ARCADIA_DDL_MODULE (1)
+#include "Arcadia/DDL/Writer/BinaryWriter.h"
+
+#include "Arcadia/DDL/BinaryFormat.h"
+#include "Arcadia/DDL/Include.h"
+
+struct Arcadia_DDL_BinaryWriterDispatch {
+  Arcadia_ObjectDispatch _parent;
+};
+
+struct Arcadia_DDL_BinaryWriter {
+  Arcadia_Object _parent;
+  // Map from strings to their indices in the string table.
+  Arcadia_Map* stringIndices;
+  // The strings of the string table in the order of their indices.
+  Arcadia_List* strings;
+  // The encoded nodes.
+  Arcadia_ByteArrayBuilder* nodes;
+};
+
+static void
+writeNatural8
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_Natural8Value value
+  );
+
+static void
+writeNatural32
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_Natural32Value value
+  );
+
+static void
+writeNatural64
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_Natural64Value value
+  );
+
+static Arcadia_Natural32Value
+toNatural32
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SizeValue value
+  );
+
+static Arcadia_Natural32Value
+getOrCreateStringIndex
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryWriter* self,
+    Arcadia_String* string
+  );
+
+static Arcadia_BooleanValue
+tryToInteger64
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* lexeme,
+    Arcadia_Integer64Value* value
+  );
+
+static Arcadia_BooleanValue
+tryToReal64
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* lexeme,
+    Arcadia_Real64Value* value
+  );
+
+static Arcadia_Natural32Value
+Arcadia_DDL_BinaryWriter_writeListValue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryWriter* self,
+    Arcadia_DDL_ListNode* node
+  );
+
+static Arcadia_Natural32Value
+Arcadia_DDL_BinaryWriter_writeMapValue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryWriter* self,
+    Arcadia_DDL_MapNode* node
+  );
+
+static Arcadia_Natural32Value
+Arcadia_DDL_BinaryWriter_writeNumberValue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryWriter* self,
+    Arcadia_DDL_NumberNode* node
+  );
+
+static Arcadia_Natural32Value
+Arcadia_DDL_BinaryWriter_writeValue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryWriter* self,
+    Arcadia_DDL_Node* node
+  );
+
+static void
+Arcadia_DDL_BinaryWriter_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryWriter* self
+  );
+
+static void
+Arcadia_DDL_BinaryWriter_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryWriterDispatch* self
+  );
+
+static void
+Arcadia_DDL_BinaryWriter_visit
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryWriter* self
+  );
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_DDL_BinaryWriter_constructImpl,
+  .visit = (Arcadia_Object_VisitCallbackFunction*)&Arcadia_DDL_BinaryWriter_visit,
+  .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_DDL_BinaryWriter_initializeDispatchImpl,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.DDL.BinaryWriter", Arcadia_DDL_BinaryWriter,
+                         u8"Arcadia.Object", Arcadia_Object,
+                         &_typeOperations);
+
+static void
+writeNatural8
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_Natural8Value value
+  )
+{
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, &value, 1);
+}
+
+static void
+writeNatural32
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_Natural32Value value
+  )
+{
+  Arcadia_Natural8Value bytes[4];
+  for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+    bytes[i] = (Arcadia_Natural8Value)(value >> (i * 8));
+  }
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, bytes, 4);
+}
+
+static void
+writeNatural64
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_Natural64Value value
+  )
+{
+  Arcadia_Natural8Value bytes[8];
+  for (Arcadia_SizeValue i = 0; i < 8; ++i) {
+    bytes[i] = (Arcadia_Natural8Value)(value >> (i * 8));
+  }
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, bytes, 8);
+}
+
+static Arcadia_Natural32Value
+toNatural32
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SizeValue value
+  )
+{
+  if (value > Arcadia_Natural32Value_Maximum) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  return (Arcadia_Natural32Value)value;
+}
+
+static Arcadia_Natural32Value
+getOrCreateStringIndex
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryWriter* self,
+    Arcadia_String* string
+  )
+{
+  Arcadia_Value key = Arcadia_Value_makeObjectReferenceValue(string);
+  Arcadia_Value existing = Arcadia_Map_get(thread, self->stringIndices, key);
+  if (!Arcadia_Value_isVoidValue(&existing)) {
+    return (Arcadia_Natural32Value)Arcadia_Value_getSizeValue(&existing);
+  }
+  Arcadia_Natural32Value index = toNatural32(thread, Arcadia_Collection_getSize(thread, (Arcadia_Collection*)self->strings));
+  Arcadia_List_insertBackObjectReferenceValue(thread, self->strings, (Arcadia_Object*)string);
+  Arcadia_Map_set(thread, self->stringIndices, key, Arcadia_Value_makeSizeValue(index), NULL, NULL);
+  return index;
+}
+
+static Arcadia_BooleanValue
+tryToInteger64
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* lexeme,
+    Arcadia_Integer64Value* value
+  )
+{
+  Arcadia_Natural8Value const* bytes = Arcadia_String_getBytes(thread, lexeme);
+  Arcadia_SizeValue numberOfBytes = Arcadia_String_getNumberOfBytes(thread, lexeme);
+  // Only literals consisting of an optional sign followed by decimal digits are integer literals.
+  Arcadia_SizeValue i = 0;
+  if (i < numberOfBytes && (bytes[i] == '+' || bytes[i] == '-')) {
+    i++;
+  }
+  if (i == numberOfBytes) {
+    return Arcadia_BooleanValue_False;
+  }
+  for (; i < numberOfBytes; ++i) {
+    if (bytes[i] < '0' || bytes[i] > '9') {
+      return Arcadia_BooleanValue_False;
+    }
+  }
+  Arcadia_BooleanValue result = Arcadia_BooleanValue_False;
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    *value = Arcadia_toInteger64(thread, bytes, numberOfBytes);
+    result = Arcadia_BooleanValue_True;
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    if (Arcadia_Thread_getStatus(thread) != Arcadia_Status_ConversionFailed) {
+      Arcadia_Thread_jump(thread);
+    }
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+  return result;
+}
+
+static Arcadia_BooleanValue
+tryToReal64
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* lexeme,
+    Arcadia_Real64Value* value
+  )
+{
+  Arcadia_BooleanValue result = Arcadia_BooleanValue_False;
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    *value = Arcadia_toReal64(thread, Arcadia_String_getBytes(thread, lexeme), Arcadia_String_getNumberOfBytes(thread, lexeme));
+    result = Arcadia_BooleanValue_True;
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    if (Arcadia_Thread_getStatus(thread) != Arcadia_Status_ConversionFailed) {
+      Arcadia_Thread_jump(thread);
+    }
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+  return result;
+}
+
+static Arcadia_Natural32Value
+Arcadia_DDL_BinaryWriter_writeListValue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryWriter* self,
+    Arcadia_DDL_ListNode* node
+  )
+{
+  Arcadia_SizeValue n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)node->elements);
+  Arcadia_List* elementOffsets = (Arcadia_List*)Arcadia_ArrayList_create(thread);
+  for (Arcadia_SizeValue i = 0; i < n; ++i) {
+    Arcadia_DDL_Node* elementNode = (Arcadia_DDL_Node*)Arcadia_List_getObjectReferenceValueAt(thread, node->elements, i);
+    Arcadia_List_insertBackNatural32Value(thread, elementOffsets, Arcadia_DDL_BinaryWriter_writeValue(thread, self, elementNode));
+  }
+  Arcadia_Natural32Value offset = toNatural32(thread, Arcadia_DDL_BinaryFormat_HeaderSize + Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, self->nodes));
+  writeNatural8(thread, self->nodes, Arcadia_DDL_BinaryFormat_Tag_List);
+  writeNatural32(thread, self->nodes, toNatural32(thread, n));
+  for (Arcadia_SizeValue i = 0; i < n; ++i) {
+    writeNatural32(thread, self->nodes, Arcadia_List_getNatural32ValueAt(thread, elementOffsets, i));
+  }
+  return offset;
+}
+
+static Arcadia_Natural32Value
+Arcadia_DDL_BinaryWriter_writeMapValue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryWriter* self,
+    Arcadia_DDL_MapNode* node
+  )
+{
+  Arcadia_SizeValue n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)node->entries);
+  Arcadia_List* valueOffsets = (Arcadia_List*)Arcadia_ArrayList_create(thread);
+  // The indices of the entries sorted by their keys.
+  Arcadia_List* order = (Arcadia_List*)Arcadia_ArrayList_create(thread);
+  for (Arcadia_SizeValue i = 0; i < n; ++i) {
+    Arcadia_DDL_MapEntryNode* entryNode = (Arcadia_DDL_MapEntryNode*)Arcadia_List_getObjectReferenceValueAt(thread, node->entries, i);
+    Arcadia_List_insertBackNatural32Value(thread, valueOffsets, Arcadia_DDL_BinaryWriter_writeValue(thread, self, entryNode->value));
+    // Binary insertion into the sorted sequence of entry indices.
+    Arcadia_String* key = entryNode->key->value;
+    Arcadia_SizeValue l = 0, r = i;
+    while (l < r) {
+      Arcadia_SizeValue m = l + (r - l) / 2;
+      Arcadia_DDL_MapEntryNode* other = (Arcadia_DDL_MapEntryNode*)Arcadia_List_getObjectReferenceValueAt(thread, node->entries, Arcadia_List_getNatural32ValueAt(thread, order, m));
+      Arcadia_Integer32Value c = Arcadia_DDL_BinaryFormat_compareKeys(thread, Arcadia_String_getBytes(thread, other->key->value), Arcadia_String_getNumberOfBytes(thread, other->key->value),
+                                                                      Arcadia_String_getBytes(thread, key), Arcadia_String_getNumberOfBytes(thread, key));
+      if (c <= 0) {
+        l = m + 1;
+      } else {
+        r = m;
+      }
+    }
+    Arcadia_List_insertNatural32ValueAt(thread, order, l, (Arcadia_Natural32Value)i);
+  }
+  Arcadia_Natural32Value offset = toNatural32(thread, Arcadia_DDL_BinaryFormat_HeaderSize + Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, self->nodes));
+  writeNatural8(thread, self->nodes, Arcadia_DDL_BinaryFormat_Tag_Map);
+  writeNatural32(thread, self->nodes, toNatural32(thread, n));
+  for (Arcadia_SizeValue i = 0; i < n; ++i) {
+    Arcadia_DDL_MapEntryNode* entryNode = (Arcadia_DDL_MapEntryNode*)Arcadia_List_getObjectReferenceValueAt(thread, node->entries, i);
+    writeNatural32(thread, self->nodes, getOrCreateStringIndex(thread, self, entryNode->key->value));
+    writeNatural32(thread, self->nodes, Arcadia_List_getNatural32ValueAt(thread, valueOffsets, i));
+  }
+  for (Arcadia_SizeValue i = 0; i < n; ++i) {
+    writeNatural32(thread, self->nodes, Arcadia_List_getNatural32ValueAt(thread, order, i));
+  }
+  return offset;
+}
+
+static Arcadia_Natural32Value
+Arcadia_DDL_BinaryWriter_writeNumberValue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryWriter* self,
+    Arcadia_DDL_NumberNode* node
+  )
+{
+  Arcadia_Natural8Value kind = Arcadia_DDL_BinaryFormat_NumberKind_None;
+  Arcadia_Natural64Value bits = 0;
+  Arcadia_Integer64Value integer64Value;
+  Arcadia_Real64Value real64Value;
+  if (tryToInteger64(thread, node->value, &integer64Value)) {
+    kind = Arcadia_DDL_BinaryFormat_NumberKind_Integer64;
+    bits = (Arcadia_Natural64Value)integer64Value;
+  } else if (tryToReal64(thread, node->value, &real64Value)) {
+    kind = Arcadia_DDL_BinaryFormat_NumberKind_Real64;
+    Arcadia_Memory_copy(thread, &bits, &real64Value, sizeof(Arcadia_Natural64Value));
+  }
+  Arcadia_Natural32Value lexeme = getOrCreateStringIndex(thread, self, node->value);
+  Arcadia_Natural32Value offset = toNatural32(thread, Arcadia_DDL_BinaryFormat_HeaderSize + Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, self->nodes));
+  writeNatural8(thread, self->nodes, Arcadia_DDL_BinaryFormat_Tag_Number);
+  writeNatural8(thread, self->nodes, kind);
+  writeNatural64(thread, self->nodes, bits);
+  writeNatural32(thread, self->nodes, lexeme);
+  return offset;
+}
+
+static Arcadia_Natural32Value
+Arcadia_DDL_BinaryWriter_writeValue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryWriter* self,
+    Arcadia_DDL_Node* node
+  )
+{
+  switch (node->type) {
+    case Arcadia_DDL_NodeType_Boolean: {
+      Arcadia_BooleanValue value = Arcadia_String_toBoolean(thread, ((Arcadia_DDL_BooleanNode*)node)->value);
+      Arcadia_Natural32Value offset = toNatural32(thread, Arcadia_DDL_BinaryFormat_HeaderSize + Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, self->nodes));
+      writeNatural8(thread, self->nodes, Arcadia_DDL_BinaryFormat_Tag_Boolean);
+      writeNatural8(thread, self->nodes, value ? 1 : 0);
+      return offset;
+    } break;
+    case Arcadia_DDL_NodeType_List: {
+      return Arcadia_DDL_BinaryWriter_writeListValue(thread, self, (Arcadia_DDL_ListNode*)node);
+    } break;
+    case Arcadia_DDL_NodeType_Map: {
+      return Arcadia_DDL_BinaryWriter_writeMapValue(thread, self, (Arcadia_DDL_MapNode*)node);
+    } break;
+    case Arcadia_DDL_NodeType_Number: {
+      return Arcadia_DDL_BinaryWriter_writeNumberValue(thread, self, (Arcadia_DDL_NumberNode*)node);
+    } break;
+    case Arcadia_DDL_NodeType_String: {
+      Arcadia_Natural32Value value = getOrCreateStringIndex(thread, self, ((Arcadia_DDL_StringNode*)node)->value);
+      Arcadia_Natural32Value offset = toNatural32(thread, Arcadia_DDL_BinaryFormat_HeaderSize + Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, self->nodes));
+      writeNatural8(thread, self->nodes, Arcadia_DDL_BinaryFormat_Tag_String);
+      writeNatural32(thread, self->nodes, value);
+      return offset;
+    } break;
+    case Arcadia_DDL_NodeType_Void: {
+      Arcadia_Natural32Value offset = toNatural32(thread, Arcadia_DDL_BinaryFormat_HeaderSize + Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, self->nodes));
+      writeNatural8(thread, self->nodes, Arcadia_DDL_BinaryFormat_Tag_Void);
+      return offset;
+    } break;
+    default: {
+      // Error, map entry, and name nodes are not values.
+    } break;
+  }
+  Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+  Arcadia_Thread_jump(thread);
+}
+
+static void
+Arcadia_DDL_BinaryWriter_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryWriter* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_DDL_BinaryWriter);
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  if (0 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  //
+  self->stringIndices = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
+  self->strings = (Arcadia_List*)Arcadia_ArrayList_create(thread);
+  self->nodes = Arcadia_ByteArrayBuilder_create(thread);
+  //
+  Arcadia_LeaveConstructor(Arcadia_DDL_BinaryWriter);
+}
+
+static void
+Arcadia_DDL_BinaryWriter_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryWriterDispatch* self
+  )
+{/*Intentionally empty.*/}
+
+static void
+Arcadia_DDL_BinaryWriter_visit
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryWriter* self
+  )
+{
+  if (self->stringIndices) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->stringIndices);
+  }
+  if (self->strings) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->strings);
+  }
+  if (self->nodes) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->nodes);
+  }
+}
+
+Arcadia_DDL_BinaryWriter*
+Arcadia_DDL_BinaryWriter_create
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  Arcadia_ValueStack_pushNatural8Value(thread, 0);
+  ARCADIA_CREATEOBJECT(Arcadia_DDL_BinaryWriter);
+}
+
+void
+Arcadia_DDL_BinaryWriter_run
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryWriter* self,
+    Arcadia_DDL_Node* node,
+    Arcadia_ByteArrayBuilder* targetBuffer
+  )
+{
+  // The offsets in the document are relative to the first Byte of the target buffer.
+  if (Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, targetBuffer)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Collection_clear(thread, (Arcadia_Collection*)self->stringIndices);
+  Arcadia_Collection_clear(thread, (Arcadia_Collection*)self->strings);
+  Arcadia_ByteArrayBuilder_clear(thread, self->nodes);
+
+  Arcadia_Natural32Value root = Arcadia_DDL_BinaryWriter_writeValue(thread, self, node);
+  Arcadia_Natural32Value stringTable = toNatural32(thread, Arcadia_DDL_BinaryFormat_HeaderSize + Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, self->nodes));
+  Arcadia_SizeValue numberOfStrings = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)self->strings);
+  // Ensure the offsets of all strings are representable before anything is written.
+  Arcadia_SizeValue stringOffset = (Arcadia_SizeValue)stringTable + 4 + 4 * numberOfStrings;
+  for (Arcadia_SizeValue i = 0; i < numberOfStrings; ++i) {
+    Arcadia_String* string = (Arcadia_String*)Arcadia_List_getObjectReferenceValueAt(thread, self->strings, i);
+    stringOffset += 4 + Arcadia_String_getNumberOfBytes(thread, string);
+  }
+  toNatural32(thread, stringOffset);
+
+  // Header.
+  Arcadia_Natural8Value const magic[] = {
+    Arcadia_DDL_BinaryFormat_Magic0,
+    Arcadia_DDL_BinaryFormat_Magic1,
+    Arcadia_DDL_BinaryFormat_Magic2,
+    Arcadia_DDL_BinaryFormat_Magic3,
+  };
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, targetBuffer, magic, 4);
+  writeNatural32(thread, targetBuffer, Arcadia_DDL_BinaryFormat_Version);
+  writeNatural32(thread, targetBuffer, stringTable);
+  writeNatural32(thread, targetBuffer, root);
+
+  // Nodes.
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, targetBuffer, Arcadia_ByteArrayBuilder_getBytes(thread, self->nodes),
+                                           Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, self->nodes));
+
+  // String table.
+  writeNatural32(thread, targetBuffer, toNatural32(thread, numberOfStrings));
+  stringOffset = (Arcadia_SizeValue)stringTable + 4 + 4 * numberOfStrings;
+  for (Arcadia_SizeValue i = 0; i < numberOfStrings; ++i) {
+    Arcadia_String* string = (Arcadia_String*)Arcadia_List_getObjectReferenceValueAt(thread, self->strings, i);
+    writeNatural32(thread, targetBuffer, (Arcadia_Natural32Value)stringOffset);
+    stringOffset += 4 + Arcadia_String_getNumberOfBytes(thread, string);
+  }
+  for (Arcadia_SizeValue i = 0; i < numberOfStrings; ++i) {
+    Arcadia_String* string = (Arcadia_String*)Arcadia_List_getObjectReferenceValueAt(thread, self->strings, i);
+    Arcadia_SizeValue numberOfBytes = Arcadia_String_getNumberOfBytes(thread, string);
+    writeNatural32(thread, targetBuffer, (Arcadia_Natural32Value)numberOfBytes);
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, targetBuffer, Arcadia_String_getBytes(thread, string), numberOfBytes);
+  }
+
+  Arcadia_Collection_clear(thread, (Arcadia_Collection*)self->stringIndices);
+  Arcadia_Collection_clear(thread, (Arcadia_Collection*)self->strings);
+  Arcadia_ByteArrayBuilder_clear(thread, self->nodes);
+}
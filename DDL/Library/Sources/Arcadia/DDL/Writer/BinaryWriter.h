@@ -0,0 +1,58 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_DDL_WRITER_BINARYWRITER_H_INCLUDED)
+#define ARCADIA_DDL_WRITER_BINARYWRITER_H_INCLUDED
+
+#if !defined(ARCADIA_DDL_MODULE) || 1 != ARCADIA_DDL_MODULE
+  #error("do not include directly, include `Arcadia/DDL/Include.h` instead")
+#endif
+
+#include "Arcadia/DDL/Nodes/Include.h"
+
+/// @code
+/// class Arcadia.DDL.BinaryWriter
+/// @endcode
+/// Writes a Data Definition Language node in the binary encoding described in `Arcadia/DDL/BinaryFormat.h`.
+Arcadia_declareObjectType(u8"Arcadia.DDL.BinaryWriter", Arcadia_DDL_BinaryWriter,
+                          u8"Arcadia.Object");
+
+/// @brief Create a Data Definition Language binary writer.
+/// @param thread A pointer to this thread.
+/// @return A pointer to the Data Definition Language binary writer.
+Arcadia_DDL_BinaryWriter*
+Arcadia_DDL_BinaryWriter_create
+  (
+    Arcadia_Thread* thread
+  );
+
+/// @brief Write a node.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this Data Definition Language binary writer.
+/// @param node A pointer to the node to write.
+/// @param targetBuffer The Byte array builder to which the output is written to. Must be empty.
+/// @error Arcadia_Status_ArgumentValueInvalid @a targetBuffer is not empty
+/// @error Arcadia_Status_ArgumentValueInvalid @a node or one of its descendants is not a boolean, list, map, number, string, or void node
+/// @error Arcadia_Status_ArgumentValueInvalid the output would exceed the limits of the encoding
+void
+Arcadia_DDL_BinaryWriter_run
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_BinaryWriter* self,
+    Arcadia_DDL_Node* node,
+    Arcadia_ByteArrayBuilder* targetBuffer
+  );
+
+#endif // ARCADIA_DDL_WRITER_BINARYWRITER_H_INCLUDED
@@ -0,0 +1,293 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/DDL/Include.h"
+
+#include <string.h>
+
+#include "Arcadia/Ring2/Include.h"
+#include "Arcadia/Logging/Include.h"
+
+static Arcadia_DDL_Node*
+doRead
+  (
+    Arcadia_Thread* thread,
+    const char* p
+  )
+{
+  Arcadia_DataDefinitionLanguage_SemanticalAnalysis* semanticalAnalysis = Arcadia_DataDefinitionLanguage_SemanticalAnalysis_create(thread);
+  Arcadia_DDL_Parser* parser = Arcadia_DDL_Parser_create(thread, Arcadia_DDL_Scanner_create(thread, Arcadia_Languages_StringTable_getOrCreate(thread),
+                                                                                                    Arcadia_Languages_Diagnostics_create(thread, (Arcadia_Log*)Arcadia_ConsoleLog_create(thread))));
+  Arcadia_DDL_Parser_setInputBytes(thread, parser, Arcadia_ByteArray_createByteArray(thread, Arcadia_RuntimeByteArray_create(thread, p, strlen(p))));
+  Arcadia_DDL_Node* node = (Arcadia_DDL_Node*)Arcadia_Value_getObjectReferenceValueChecked(thread, Arcadia_Languages_Parser_run(thread, (Arcadia_Languages_Parser*)parser), _Arcadia_DDL_Node_getType(thread));
+  Arcadia_DataDefinitionLanguage_SemanticalAnalysis_run(thread, semanticalAnalysis, node);
+  return node;
+}
+
+static Arcadia_ByteArray*
+doWriteText
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_Node* node
+  )
+{
+  Arcadia_DataDefinitionLanguage_Unparser* unparser = Arcadia_DataDefinitionLanguage_Unparser_create(thread, (Arcadia_Unicode_Encoder*)Arcadia_Unicode_UTF8Encoder_create(thread));
+  Arcadia_ByteArrayBuilder* target = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_DataDefinitionLanguage_Unparser_run(thread, unparser, node, target);
+  return Arcadia_ByteArrayBuilder_toByteArray(thread, target);
+}
+
+static Arcadia_ByteArray*
+doWriteBinary
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_Node* node
+  )
+{
+  Arcadia_DDL_BinaryWriter* writer = Arcadia_DDL_BinaryWriter_create(thread);
+  Arcadia_ByteArrayBuilder* target = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_DDL_BinaryWriter_run(thread, writer, node, target);
+  return Arcadia_ByteArrayBuilder_toByteArray(thread, target);
+}
+
+static void
+assertEqual
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArray* x,
+    Arcadia_ByteArray* y
+  )
+{
+  Arcadia_Tests_assertTrue(thread, Arcadia_ByteArray_getNumberOfBytes(thread, x) == Arcadia_ByteArray_getNumberOfBytes(thread, y));
+  Arcadia_Tests_assertTrue(thread, !Arcadia_Memory_compare(thread, Arcadia_ByteArray_getBytes(thread, x), Arcadia_ByteArray_getBytes(thread, y), Arcadia_ByteArray_getNumberOfBytes(thread, x)));
+}
+
+// Text -> node -> binary -> node -> text must reproduce the text form.
+// Binary -> node -> binary must reproduce the binary form.
+static void
+onRoundTrip
+  (
+    Arcadia_Thread* thread,
+    const char* input
+  )
+{
+  Arcadia_DDL_Node* node = doRead(thread, input);
+  Arcadia_ByteArray* text = doWriteText(thread, node);
+  Arcadia_ByteArray* binary = doWriteBinary(thread, node);
+  Arcadia_DDL_BinaryReader* reader = Arcadia_DDL_BinaryReader_create(thread, Arcadia_Languages_StringTable_getOrCreate(thread), binary);
+  Arcadia_DDL_Node* binaryNode = Arcadia_DDL_BinaryReader_toNode(thread, reader, Arcadia_DDL_BinaryReader_getRoot(thread, reader));
+  assertEqual(thread, text, doWriteText(thread, binaryNode));
+  assertEqual(thread, binary, doWriteBinary(thread, binaryNode));
+}
+
+static void
+testRoundTrip
+  (
+    Arcadia_Thread* thread
+  )
+{
+  onRoundTrip(thread, u8"void");
+  onRoundTrip(thread, u8"true");
+  onRoundTrip(thread, u8"-12");
+  onRoundTrip(thread, u8"\"x\"");
+  onRoundTrip(thread, u8"[]");
+  onRoundTrip(thread, u8"{}");
+  onRoundTrip(thread, u8"{ prename : \"Michael\", surname: \"Heilmann\",\n}\n");
+  onRoundTrip(thread, u8"{\n"
+                      u8"  name : \"M\\u00e4rchen \\\"quoted\\\" \\\\ \",\n"
+                      u8"  values : [1, -2, 3.25, 1e3, 99999999999999999999, true, false, void, \"\", [], {}],\n"
+                      u8"  nested : { b : { a : 1, c : [ { z : 1, y : 2, x : 3 } ] }, a : \"a\" },\n"
+                      u8"  zzz : 1.50,\n"
+                      u8"  aa : 1.50,\n"
+                      u8"  a : 1.50,\n"
+                      u8"}\n");
+}
+
+static void
+testLookup
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_DDL_Node* node = doRead(thread, u8"{\n"
+                                          u8"  version : 3,\n"
+                                          u8"  scale : 1.50,\n"
+                                          u8"  huge : 99999999999999999999,\n"
+                                          u8"  title : \"Arcadia\",\n"
+                                          u8"  enabled : true,\n"
+                                          u8"  nothing : void,\n"
+                                          u8"  sizes : [ 640, 800, 1024 ],\n"
+                                          u8"  alias : \"Arcadia\",\n"
+                                          u8"}\n");
+  Arcadia_ByteArray* binary = doWriteBinary(thread, node);
+  Arcadia_DDL_BinaryReader* reader = Arcadia_DDL_BinaryReader_create(thread, Arcadia_Languages_StringTable_getOrCreate(thread), binary);
+  Arcadia_Natural32Value root = Arcadia_DDL_BinaryReader_getRoot(thread, reader);
+  Arcadia_Tests_assertTrue(thread, Arcadia_DDL_NodeType_Map == Arcadia_DDL_BinaryReader_getType(thread, reader, root));
+  Arcadia_Tests_assertTrue(thread, 8 == Arcadia_DDL_BinaryReader_getSize(thread, reader, root));
+  // Entries are reported in source order.
+  Arcadia_Tests_assertTrue(thread, Arcadia_String_isEqualTo_pn(thread, Arcadia_DDL_BinaryReader_getKeyAt(thread, reader, root, 0), u8"version", sizeof(u8"version") - 1));
+  Arcadia_Tests_assertTrue(thread, Arcadia_String_isEqualTo_pn(thread, Arcadia_DDL_BinaryReader_getKeyAt(thread, reader, root, 7), u8"alias", sizeof(u8"alias") - 1));
+
+  Arcadia_Natural32Value value;
+
+  Arcadia_Tests_assertTrue(thread, Arcadia_DDL_BinaryReader_find_pn(thread, reader, root, u8"version", sizeof(u8"version") - 1, &value));
+  Arcadia_Tests_assertTrue(thread, Arcadia_DDL_NodeType_Number == Arcadia_DDL_BinaryReader_getType(thread, reader, value));
+  Arcadia_Tests_assertTrue(thread, 3 == Arcadia_DDL_BinaryReader_getInteger64(thread, reader, value));
+  Arcadia_Tests_assertTrue(thread, 3. == Arcadia_DDL_BinaryReader_getReal64(thread, reader, value));
+
+  Arcadia_Tests_assertTrue(thread, Arcadia_DDL_BinaryReader_find_pn(thread, reader, root, u8"scale", sizeof(u8"scale") - 1, &value));
+  Arcadia_Tests_assertTrue(thread, 1.5 == Arcadia_DDL_BinaryReader_getReal64(thread, reader, value));
+  // The literal is preserved.
+  Arcadia_Tests_assertTrue(thread, Arcadia_String_isEqualTo_pn(thread, Arcadia_DDL_BinaryReader_getNumberLiteral(thread, reader, value), u8"1.50", sizeof(u8"1.50") - 1));
+
+  Arcadia_Tests_assertTrue(thread, Arcadia_DDL_BinaryReader_find_pn(thread, reader, root, u8"huge", sizeof(u8"huge") - 1, &value));
+  Arcadia_Tests_assertTrue(thread, 1e20 == Arcadia_DDL_BinaryReader_getReal64(thread, reader, value));
+
+  Arcadia_Tests_assertTrue(thread, Arcadia_DDL_BinaryReader_find_pn(thread, reader, root, u8"title", sizeof(u8"title") - 1, &value));
+  Arcadia_String* title = Arcadia_DDL_BinaryReader_getString(thread, reader, value);
+  Arcadia_Tests_assertTrue(thread, Arcadia_String_isEqualTo_pn(thread, title, u8"Arcadia", sizeof(u8"Arcadia") - 1));
+  // Strings are stored once and interned when read.
+  Arcadia_Tests_assertTrue(thread, Arcadia_DDL_BinaryReader_find(thread, reader, root, Arcadia_String_createFromCxxString(thread, u8"alias"), &value));
+  Arcadia_Tests_assertTrue(thread, title == Arcadia_DDL_BinaryReader_getString(thread, reader, value));
+
+  Arcadia_Tests_assertTrue(thread, Arcadia_DDL_BinaryReader_find_pn(thread, reader, root, u8"enabled", sizeof(u8"enabled") - 1, &value));
+  Arcadia_Tests_assertTrue(thread, Arcadia_BooleanValue_True == Arcadia_DDL_BinaryReader_getBoolean(thread, reader, value));
+
+  Arcadia_Tests_assertTrue(thread, Arcadia_DDL_BinaryReader_find_pn(thread, reader, root, u8"nothing", sizeof(u8"nothing") - 1, &value));
+  Arcadia_Tests_assertTrue(thread, Arcadia_DDL_NodeType_Void == Arcadia_DDL_BinaryReader_getType(thread, reader, value));
+
+  Arcadia_Tests_assertTrue(thread, Arcadia_DDL_BinaryReader_find_pn(thread, reader, root, u8"sizes", sizeof(u8"sizes") - 1, &value));
+  Arcadia_Tests_assertTrue(thread, Arcadia_DDL_NodeType_List == Arcadia_DDL_BinaryReader_getType(thread, reader, value));
+  Arcadia_Tests_assertTrue(thread, 3 == Arcadia_DDL_BinaryReader_getSize(thread, reader, value));
+  Arcadia_Tests_assertTrue(thread, 1024 == Arcadia_DDL_BinaryReader_getInteger64(thread, reader, Arcadia_DDL_BinaryReader_getElementAt(thread, reader, value, 2)));
+
+  Arcadia_Tests_assertTrue(thread, !Arcadia_DDL_BinaryReader_find_pn(thread, reader, root, u8"", 0, &value));
+  Arcadia_Tests_assertTrue(thread, !Arcadia_DDL_BinaryReader_find_pn(thread, reader, root, u8"a", 1, &value));
+  Arcadia_Tests_assertTrue(thread, !Arcadia_DDL_BinaryReader_find_pn(thread, reader, root, u8"versions", sizeof(u8"versions") - 1, &value));
+  Arcadia_Tests_assertTrue(thread, !Arcadia_DDL_BinaryReader_find_pn(thread, reader, root, u8"zzz", sizeof(u8"zzz") - 1, &value));
+}
+
+static Arcadia_Status
+tryCreate
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArray* input
+  )
+{
+  Arcadia_Status status = Arcadia_Status_Success;
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_DDL_BinaryReader* reader = Arcadia_DDL_BinaryReader_create(thread, Arcadia_Languages_StringTable_getOrCreate(thread), input);
+    Arcadia_DDL_BinaryReader_toNode(thread, reader, Arcadia_DDL_BinaryReader_getRoot(thread, reader));
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    status = Arcadia_Thread_getStatus(thread);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+  return status;
+}
+
+// Malformed documents must raise Arcadia_Status_EncodingInvalid.
+static void
+testInvalid
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_ByteArray* binary = doWriteBinary(thread, doRead(thread, u8"{ a : [ 1, \"b\", { c : true } ] }"));
+  Arcadia_Natural8Value const* bytes = Arcadia_ByteArray_getBytes(thread, binary);
+  Arcadia_SizeValue numberOfBytes = Arcadia_ByteArray_getNumberOfBytes(thread, binary);
+  Arcadia_Tests_assertTrue(thread, Arcadia_Status_Success == tryCreate(thread, binary));
+  // Every proper prefix of the document is invalid.
+  for (Arcadia_SizeValue i = 0; i < numberOfBytes; ++i) {
+    Arcadia_ByteArray* prefix = Arcadia_ByteArray_createByteArray(thread, Arcadia_RuntimeByteArray_create(thread, bytes, i));
+    Arcadia_Tests_assertTrue(thread, Arcadia_Status_EncodingInvalid == tryCreate(thread, prefix));
+  }
+  // A wrong magic number or version is invalid.
+  for (Arcadia_SizeValue i = 0; i < 8; ++i) {
+    Arcadia_ByteArrayBuilder* builder = Arcadia_ByteArrayBuilder_create(thread);
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, builder, bytes, i);
+    Arcadia_Natural8Value x = bytes[i] ^ 0x80;
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, builder, &x, 1);
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, builder, bytes + i + 1, numberOfBytes - i - 1);
+    Arcadia_Tests_assertTrue(thread, Arcadia_Status_EncodingInvalid == tryCreate(thread, Arcadia_ByteArrayBuilder_toByteArray(thread, builder)));
+  }
+}
+
+static Arcadia_Status
+tryWrite
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_Node* node,
+    Arcadia_ByteArrayBuilder* target
+  )
+{
+  Arcadia_Status status = Arcadia_Status_Success;
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_DDL_BinaryWriter_run(thread, Arcadia_DDL_BinaryWriter_create(thread), node, target);
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    status = Arcadia_Thread_getStatus(thread);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+  return status;
+}
+
+// Non-value nodes and non-empty target buffers must raise Arcadia_Status_ArgumentValueInvalid.
+static void
+testInvalidWrite
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_DDL_Node* node = doRead(thread, u8"{ a : 1 }");
+  Arcadia_ByteArrayBuilder* target = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, u8"x", 1);
+  Arcadia_Tests_assertTrue(thread, Arcadia_Status_ArgumentValueInvalid == tryWrite(thread, node, target));
+  Arcadia_Tests_assertTrue(thread, 1 == Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, target));
+
+  Arcadia_ByteArrayBuilder_clear(thread, target);
+  Arcadia_DDL_Node* name = (Arcadia_DDL_Node*)Arcadia_DDL_NameNode_create(thread, Arcadia_String_createFromCxxString(thread, u8"a"));
+  Arcadia_Tests_assertTrue(thread, Arcadia_Status_ArgumentValueInvalid == tryWrite(thread, name, target));
+  Arcadia_ByteArrayBuilder_clear(thread, target);
+  Arcadia_Tests_assertTrue(thread, Arcadia_Status_Success == tryWrite(thread, node, target));
+}
+
+int
+main
+  (
+    int argc,
+    char** argv
+  )
+{
+  if (!Arcadia_Tests_safeExecute(&testRoundTrip)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testLookup)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testInvalid)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testInvalidWrite)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -111,6 +111,158 @@ testScanner2
   expectAndNext(thread, scanner, Arcadia_DDL_WordType_EndOfInput, u8"<end of input>", sizeof(u8"<end of input>") - 1);
 }
 
+// Same as testScanner2 but in Byte mode.
+static void
+testScanner3
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static const char* input =
+    u8","
+    u8":"
+    u8"{"
+    u8"}"
+    u8"["
+    u8"]"
+    u8"\r "
+    u8"\n "
+    u8"\r\n"
+    u8"\"Hello, World!\\n\" "
+    u8"true "
+    u8"false "
+    u8"void "
+    u8"1 "
+    u8"6.2831"
+    ;
+  Arcadia_DDL_Scanner* scanner = Arcadia_DDL_Scanner_create(thread, Arcadia_Languages_StringTable_getOrCreate(thread),
+                                                                    Arcadia_Languages_Diagnostics_create(thread, (Arcadia_Log*)Arcadia_ConsoleLog_create(thread)));
+  Arcadia_DDL_Scanner_setInputBytes(thread, scanner, Arcadia_ByteArray_createByteArray(thread, Arcadia_RuntimeByteArray_create(thread, input, strlen(input))));
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_StartOfInput, u8"<start of input>", sizeof(u8"<start of input>") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_Comma, u8",", sizeof(u8",") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_Colon, u8":", sizeof(u8":") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_LeftCurlyBracket, u8"{", sizeof(u8"{") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_RightCurlyBracket, u8"}", sizeof(u8"}") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_LeftSquareBracket, u8"[", sizeof(u8"[") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_RightSquareBracket, u8"]", sizeof(u8"]") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_LineTerminator, u8"\r", sizeof(u8"\r") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_WhiteSpace, u8" ", sizeof(u8" ") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_LineTerminator, u8"\n", sizeof(u8"\n") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_WhiteSpace, u8" ", sizeof(u8" ") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_LineTerminator, u8"\r\n", sizeof(u8"\r\n") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_StringLiteral, u8"Hello, World!\n", sizeof(u8"Hello, World!\n") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_WhiteSpace, u8" ", sizeof(u8" ") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_BooleanLiteral, u8"true", sizeof(u8"true") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_WhiteSpace, u8" ", sizeof(u8" ") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_BooleanLiteral, u8"false", sizeof(u8"false") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_WhiteSpace, u8" ", sizeof(u8" ") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_VoidLiteral, u8"void", sizeof(u8"void") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_WhiteSpace, u8" ", sizeof(u8" ") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_IntegerLiteral, u8"1", sizeof(u8"1") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_WhiteSpace, u8" ", sizeof(u8" ") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_RealLiteral, u8"6.2831", sizeof(u8"6.2831") - 1);
+  expectAndNext(thread, scanner, Arcadia_DDL_WordType_EndOfInput, u8"<end of input>", sizeof(u8"<end of input>") - 1);
+}
+
+// Assert the Byte mode produces the same words as the code point reader mode.
+// The input contains runs longer than 16 Bytes and non-ASCII code points to exercise the SIMD skipping.
+static void
+testScanner4
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static const char* input =
+    u8"{\n"
+    u8"                                        \t\t  name : \"A rather long string literal without escapes, \u00e4\u00f6\u00fc \u20ac.\",\n"
+    u8"  _name1 : \"A rather long string literal with escapes \\t and \\u0041 and \\\\ and \\\" in it, \u00e4\u20ac.\",\n"
+    u8"  // A rather long single line comment \u00e4\u00f6\u00fc \u20ac and more text.\r\n"
+    u8"  /* A rather long multi line comment **\n \u00e4\u00f6\u00fc \u20ac * / and more text. */\r"
+    u8"  list : [ true, false, void, -1, +12.5, 3.e+7, 1E-3, 0, ],\n"
+    u8"  truex : voidy,\n"
+    u8"}"
+    ;
+  Arcadia_ByteArray* bytes = Arcadia_ByteArray_createByteArray(thread, Arcadia_RuntimeByteArray_create(thread, input, strlen(input)));
+  Arcadia_DDL_Scanner* x = Arcadia_DDL_Scanner_create(thread, Arcadia_Languages_StringTable_getOrCreate(thread),
+                                                              Arcadia_Languages_Diagnostics_create(thread, (Arcadia_Log*)Arcadia_ConsoleLog_create(thread)));
+  Arcadia_Languages_Scanner_setInput(thread, (Arcadia_Languages_Scanner*)x, (Arcadia_UnicodeCodePointReader*)Arcadia_ByteReader_UnicodeCodePointReader_create(thread, (Arcadia_ByteReader*)Arcadia_ByteArray_ByteReader_create(thread, bytes)));
+  Arcadia_DDL_Scanner* y = Arcadia_DDL_Scanner_create(thread, Arcadia_Languages_StringTable_getOrCreate(thread),
+                                                              Arcadia_Languages_Diagnostics_create(thread, (Arcadia_Log*)Arcadia_ConsoleLog_create(thread)));
+  Arcadia_DDL_Scanner_setInputBytes(thread, y, bytes);
+  Arcadia_SizeValue numberOfWords = 0;
+  Arcadia_Natural32Value end = 0;
+  while (Arcadia_BooleanValue_True) {
+    Arcadia_Integer32Value type = Arcadia_Languages_Scanner_getWordType(thread, (Arcadia_Languages_Scanner*)x);
+    if (type != Arcadia_Languages_Scanner_getWordType(thread, (Arcadia_Languages_Scanner*)y)) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+      Arcadia_Thread_jump(thread);
+    }
+    // Strings are interned, hence equal strings are the same object.
+    if (Arcadia_Languages_Scanner_getWordText(thread, (Arcadia_Languages_Scanner*)x) != Arcadia_Languages_Scanner_getWordText(thread, (Arcadia_Languages_Scanner*)y)) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+      Arcadia_Thread_jump(thread);
+    }
+    // In Byte mode, the words are adjacent.
+    if (end != Arcadia_Languages_Scanner_getWordStart(thread, (Arcadia_Languages_Scanner*)y)) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+      Arcadia_Thread_jump(thread);
+    }
+    end = Arcadia_Languages_Scanner_getWordStart(thread, (Arcadia_Languages_Scanner*)y) + Arcadia_Languages_Scanner_getWordLength(thread, (Arcadia_Languages_Scanner*)y);
+    if (Arcadia_DDL_WordType_EndOfInput == type) {
+      break;
+    }
+    numberOfWords++;
+    Arcadia_Languages_Scanner_step(thread, (Arcadia_Languages_Scanner*)x);
+    Arcadia_Languages_Scanner_step(thread, (Arcadia_Languages_Scanner*)y);
+  }
+  if (end != strlen(input) || numberOfWords < 60) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+    Arcadia_Thread_jump(thread);
+  }
+}
+
+// Assert the Byte mode raises lexical errors.
+static void
+testScanner5
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static const char* inputs[] = {
+    // Unterminated string literal.
+    u8"\"abcdefghijklmnopqrstuvwxyz",
+    // Control character in string literal.
+    u8"\"abcdefghijklmnopqrstuvwxyz\tabc\"",
+    // Invalid escape sequence.
+    u8"\"\\x\"",
+    // Invalid UTF-8 in a string literal.
+    u8"\"abcdefghijklmnopqrstuvwxyz\xff\"",
+    // Unterminated multi line comment.
+    u8"/* abcdefghijklmnopqrstuvwxyz *",
+    // Invalid symbol.
+    u8"#",
+  };
+  for (Arcadia_SizeValue i = 0, n = sizeof(inputs) / sizeof(inputs[0]); i < n; ++i) {
+    Arcadia_DDL_Scanner* scanner = Arcadia_DDL_Scanner_create(thread, Arcadia_Languages_StringTable_getOrCreate(thread),
+                                                                      Arcadia_Languages_Diagnostics_create(thread, (Arcadia_Log*)Arcadia_ConsoleLog_create(thread)));
+    Arcadia_DDL_Scanner_setInputBytes(thread, scanner, Arcadia_ByteArray_createByteArray(thread, Arcadia_RuntimeByteArray_create(thread, inputs[i], strlen(inputs[i]))));
+    Arcadia_JumpTarget jumpTarget;
+    Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+    if (Arcadia_JumpTarget_save(&jumpTarget)) {
+      Arcadia_Languages_Scanner_step(thread, (Arcadia_Languages_Scanner*)scanner);
+      Arcadia_Thread_popJumpTarget(thread);
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+      Arcadia_Thread_jump(thread);
+    } else {
+      Arcadia_Thread_popJumpTarget(thread);
+      if (Arcadia_Status_LexicalError != Arcadia_Thread_getStatus(thread)) {
+        Arcadia_Thread_jump(thread);
+      }
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+    }
+  }
+}
+
 int
 main
   (
@@ -124,5 +276,14 @@ main
   if (!Arcadia_Tests_safeExecute(&testScanner2)) {
     return EXIT_FAILURE;
   }
+  if (!Arcadia_Tests_safeExecute(&testScanner3)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testScanner4)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testScanner5)) {
+    return EXIT_FAILURE;
+  }
   return EXIT_SUCCESS;
 }
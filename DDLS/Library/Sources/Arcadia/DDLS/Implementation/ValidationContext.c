@@ -24,6 +24,13 @@ Arcadia_DDLS_ValidationContext_constructImpl
     Arcadia_DDLS_ValidationContext* self
   );
 
+static void
+Arcadia_DDLS_ValidationContext_destructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDLS_ValidationContext* self
+  );
+
 static void
 Arcadia_DDLS_ValidationContext_initializeDispatchImpl
   (
@@ -50,6 +57,7 @@ Arcadia_DDLS_ValidationContext_runImpl
 static const Arcadia_ObjectType_Operations _Arcadia_DDLS_ValidationContext_objectTypeOperations = {
   Arcadia_ObjectType_Operations_Initializer,
   .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_DDLS_ValidationContext_constructImpl,
+  .destruct = (Arcadia_Object_DestructCallbackFunction*)&Arcadia_DDLS_ValidationContext_destructImpl,
   .visit = (Arcadia_Object_VisitCallbackFunction*)&Arcadia_DDLS_ValidationContext_visitImpl,
   .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_DDLS_ValidationContext_initializeDispatchImpl,
 };
@@ -86,10 +94,24 @@ Arcadia_DDLS_ValidationContext_constructImpl
   self->stringTable = Arcadia_Languages_StringTable_getOrCreate(thread);
   self->diagnostics = Arcadia_DDLS_Diagnostics_create(thread, self->stringTable);
   self->schemata = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
+  self->program = NULL;
   //
   Arcadia_LeaveConstructor(Arcadia_DDLS_ValidationContext);
 }
 
+static void
+Arcadia_DDLS_ValidationContext_destructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDLS_ValidationContext* self
+  )
+{
+  if (self->program) {
+    Arcadia_DDLS_ValidationProgram_destroy(thread, self->program);
+    self->program = NULL;
+  }
+}
+
 static void
 Arcadia_DDLS_ValidationContext_initializeDispatchImpl
   (
@@ -119,171 +141,8 @@ Arcadia_DDLS_ValidationContext_visitImpl
   if (self->schemata) {
     Arcadia_Object_visit(thread, (Arcadia_Object*)self->schemata);
   }
-}
-
-static void
-onValidateList
-  (
-    Arcadia_Thread* thread,
-    Arcadia_DDLS_ValidationContext* self,
-    Arcadia_DDLS_Node* ddlsNode,
-    Arcadia_DDL_Node* node
-  );
-
-static void
-onValidateMap
-  (
-    Arcadia_Thread* thread,
-    Arcadia_DDLS_ValidationContext* self,
-    Arcadia_DDLS_Node* ddlsNode,
-    Arcadia_DDL_Node* node
-  );
-
-static void
-onValidate
-  (
-    Arcadia_Thread* thread,
-    Arcadia_DDLS_ValidationContext* self,
-    Arcadia_DDLS_Node* ddlsNode,
-    Arcadia_DDL_Node* node
-  );
-
-static void
-onValidateList
-  (
-    Arcadia_Thread* thread,
-    Arcadia_DDLS_ValidationContext* self,
-    Arcadia_DDLS_Node* ddlsNode,
-    Arcadia_DDL_Node* node
-  )
-{
-  Arcadia_DDLS_ListNode* ddlsListNode = (Arcadia_DDLS_ListNode*)ddlsNode;
-  Arcadia_DDLS_Node* ddlsListElementNode = ddlsListNode->element;
-  Arcadia_DDL_ListNode* listNode = (Arcadia_DDL_ListNode*)node;
-  for (Arcadia_SizeValue i = 0, n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)listNode->elements); i < n; ++i) {
-    Arcadia_DDL_Node* node = (Arcadia_DDL_Node*)Arcadia_List_getObjectReferenceValueCheckedAt(thread, listNode->elements, i, _Arcadia_DDL_Node_getType(thread));
-    onValidate(thread, self, ddlsListElementNode, node);
-  }
-}
-
-static void
-onValidateMap
-  (
-    Arcadia_Thread* thread,
-    Arcadia_DDLS_ValidationContext* self,
-    Arcadia_DDLS_Node* ddlsNode,
-    Arcadia_DDL_Node* node
-  )
-{
-  /// @todo The implementation shall be non-recursive (same for onValidateList) for example using a stack on which
-  ///       validation tasks (a new object type) are pushed.
-  Arcadia_Map* symbols = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
-  Arcadia_DDL_MapNode* mapNode = (Arcadia_DDL_MapNode*)node;
-  Arcadia_DDLS_MapNode* ddlsMapNode = (Arcadia_DDLS_MapNode*)ddlsNode;
-  // (1) Ensure all map entry names are unique.
-  // (2) Ensure all map entry names are permitted by the type.
-  for (Arcadia_SizeValue i = 0, n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)mapNode->entries); i < n; ++i) {
-    Arcadia_DDL_MapEntryNode* node = (Arcadia_DDL_MapEntryNode*)Arcadia_List_getObjectReferenceValueCheckedAt(thread, mapNode->entries, i, _Arcadia_DDL_MapEntryNode_getType(thread));
-    Arcadia_Value newValue = Arcadia_Value_makeObjectReferenceValue(node->value);
-    Arcadia_Value newKey = Arcadia_Value_makeObjectReferenceValue(node->key->value);
-    Arcadia_Value oldValue = Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void), oldKey = Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void);
-    Arcadia_Map_set(thread, symbols, newKey, newValue, &oldKey, &oldValue);
-    if (!Arcadia_Value_isVoidValue(&oldKey)) {
-      Arcadia_DDLS_Diagnostics_mapEntryAlreadyDefined(thread, self->diagnostics, (Arcadia_String*)Arcadia_Value_getObjectReferenceValue(&newKey));
-      Arcadia_Thread_setStatus(thread, Arcadia_Status_SemanticalError);
-      Arcadia_Thread_jump(thread);
-    }
-    Arcadia_Value temporary = Arcadia_Map_get(thread, ddlsMapNode->entries, newKey);
-    if (!Arcadia_Value_isObjectReferenceValue(&temporary)) {
-      Arcadia_DDLS_Diagnostics_mapEntryExistsError(thread, self->diagnostics, (Arcadia_String*)Arcadia_Value_getObjectReferenceValue(&newKey));
-      Arcadia_Thread_setStatus(thread, Arcadia_Status_SemanticalError);
-      Arcadia_Thread_jump(thread);
-    }
-    onValidate(thread, self, (Arcadia_DDLS_Node*)Arcadia_Value_getObjectReferenceValueChecked(thread, temporary, _Arcadia_DDLS_Node_getType(thread)), node->value);
-  }
-  // (3) Ensure no entry required by the type are missing.
-  Arcadia_List* requiredEntries = Arcadia_Map_getKeys(thread, ddlsMapNode->entries);
-  for (Arcadia_SizeValue i = 0, n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)requiredEntries); i < n; ++i) {
-    Arcadia_Value key = Arcadia_List_getAt(thread, requiredEntries, i);
-    Arcadia_Value oldKey;
-    Arcadia_Map_remove(thread, symbols, key, &oldKey, NULL);
-    if (Arcadia_Value_isVoidValue(&oldKey)) {
-      Arcadia_DDLS_Diagnostics_mapEntryNotExistsError(thread, self->diagnostics, (Arcadia_String*)Arcadia_Value_getObjectReferenceValue(&key));
-      Arcadia_Thread_setStatus(thread, Arcadia_Status_SemanticalError);
-      Arcadia_Thread_jump(thread);
-    }
-  }
-}
-
-static void
-onValidate
-  (
-    Arcadia_Thread* thread,
-    Arcadia_DDLS_ValidationContext* self,
-    Arcadia_DDLS_Node* ddlsNode,
-    Arcadia_DDL_Node* node
-  )
-{
-  while (Arcadia_DDLS_isSchemaReference(thread, ddlsNode)) {
-    Arcadia_Value v = Arcadia_Map_get(thread, self->schemata, Arcadia_Value_makeObjectReferenceValue(((Arcadia_DDLS_SchemaReferenceNode*)ddlsNode)->name));
-    if (Arcadia_Value_isVoidValue(&v)) {
-      Arcadia_DDLS_Diagnostics_unresolvedSchemaReferenceError(thread, self->diagnostics, ((Arcadia_DDLS_SchemaReferenceNode*)ddlsNode)->name);
-      Arcadia_Thread_setStatus(thread, Arcadia_Status_SemanticalError);
-      Arcadia_Thread_jump(thread);
-    }
-    Arcadia_DDLS_SchemaNode* schemaNode = (Arcadia_DDLS_SchemaNode*)Arcadia_Value_getObjectReferenceValue(&v);
-    ddlsNode = schemaNode->definition;
-
-  }
-  if (Arcadia_DDLS_isAny(thread, ddlsNode)) {
-    return;
-  }
-  if (Arcadia_DDLS_isChoice(thread, ddlsNode)) {
-    Arcadia_SizeValue n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)((Arcadia_DDLS_ChoiceNode*)ddlsNode)->choices);
-    if (n == 0) {
-      Arcadia_Thread_setStatus(thread, Arcadia_Status_SemanticalError);
-      Arcadia_Thread_popJumpTarget(thread);
-      Arcadia_Thread_jump(thread);
-    }
-    for (Arcadia_SizeValue i = 0; i < n; ++i) {
-      Arcadia_DDLS_Node* ddlsChildNode =
-      (Arcadia_DDLS_Node*)
-      Arcadia_List_getObjectReferenceValueCheckedAt
-        (
-          thread,
-          ((Arcadia_DDLS_ChoiceNode*)ddlsNode)->choices,
-          i,
-          _Arcadia_DDLS_Node_getType(thread)
-        );
-      Arcadia_JumpTarget jumpTarget;
-      Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
-      if (Arcadia_JumpTarget_save(&jumpTarget)) {
-        onValidate(thread, self, (Arcadia_DDLS_Node*)ddlsChildNode, node); // TODO: Do not use recursion.
-        Arcadia_Thread_popJumpTarget(thread);
-        break;
-      } else {
-        Arcadia_Thread_popJumpTarget(thread);
-        Arcadia_Thread_jump(thread);
-      }
-    }
-    return; // Accept.
-  }
-  if (Arcadia_DDLS_isBoolean(thread, ddlsNode) && Arcadia_DDL_Node_isBoolean(thread, node)) {
-    return; // Accept.
-  } else if (Arcadia_DDLS_isList(thread, ddlsNode) && Arcadia_DDL_Node_isList(thread, node)) {
-    onValidateList(thread, self, ddlsNode, node);
-  } else if (Arcadia_DDLS_isMap(thread, ddlsNode) && Arcadia_DDL_Node_isMap(thread, node)) {
-    onValidateMap(thread, self, ddlsNode, node);
-  } else if (Arcadia_DDLS_isNumber(thread, ddlsNode) && Arcadia_DDL_Node_isNumber(thread, node)) {
-    return;
-  } else if (Arcadia_DDLS_isString(thread, ddlsNode) && Arcadia_DDL_Node_isString(thread, node)) {
-    return;
-  } else if (Arcadia_DDLS_isVoid(thread, ddlsNode) && Arcadia_DDL_Node_isVoid(thread, node)) {
-    return;
-  } else {
-    Arcadia_DDLS_Diagnostics_unexpectedTypeError(thread, self->diagnostics, ddlsNode, node);
-    Arcadia_Thread_setStatus(thread, Arcadia_Status_SemanticalError);
-    Arcadia_Thread_jump(thread);
+  if (self->program) {
+    Arcadia_DDLS_ValidationProgram_visit(thread, self->program);
   }
 }
 
@@ -296,14 +155,10 @@ Arcadia_DDLS_ValidationContext_runImpl
     Arcadia_DDL_Node* node
   )
 {
-  Arcadia_Value v = Arcadia_Map_get(thread, self->schemata, Arcadia_Value_makeObjectReferenceValue(name));
-  if (Arcadia_Value_isVoidValue(&v)) {
-    Arcadia_DDLS_Diagnostics_unresolvedSchemaReferenceError(thread, self->diagnostics, name);
-    Arcadia_Thread_setStatus(thread, Arcadia_Status_SemanticalError);
-    Arcadia_Thread_jump(thread);
+  if (!self->program) {
+    self->program = Arcadia_DDLS_ValidationProgram_create(thread, self->schemata);
   }
-  Arcadia_DDLS_SchemaNode* ddlsNode = (Arcadia_DDLS_SchemaNode*)Arcadia_Value_getObjectReferenceValue(&v);
-  onValidate(thread, self, ((Arcadia_DDLS_SchemaNode*)ddlsNode)->definition, node);
+  Arcadia_DDLS_ValidationProgram_run(thread, self->program, self->diagnostics, name, node);
 }
 
 Arcadia_DDLS_ValidationContext*
@@ -333,6 +188,10 @@ Arcadia_DDLS_ValidationContext_addSchema
   }
   v = Arcadia_Value_makeObjectReferenceValue(schemaNode);
   Arcadia_Map_set(thread, self->schemata, k, v, NULL, NULL);
+  if (self->program) {
+    Arcadia_DDLS_ValidationProgram_destroy(thread, self->program);
+    self->program = NULL;
+  }
 }
 
 Arcadia_DDLS_SchemaNode*
@@ -365,6 +224,10 @@ Arcadia_DDLS_ValidationContext_removeSchema
   if (Arcadia_Value_isVoidValue(&v)) {
     return NULL;
   }
+  if (self->program) {
+    Arcadia_DDLS_ValidationProgram_destroy(thread, self->program);
+    self->program = NULL;
+  }
   return (Arcadia_DDLS_SchemaNode*)Arcadia_Value_getObjectReferenceValue(&v);
 }
 
@@ -19,6 +19,7 @@
 #include "Arcadia/DDLS/Nodes/Include.h"
 #include "Arcadia/DDL/Include.h"
 #include "Arcadia/DDLS/Implementation/Diagnostics.h"
+#include "Arcadia/DDLS/Implementation/ValidationProgram.h"
 #include "Arcadia/Languages/Include.h"
 
 // Internal type of a validation context.
@@ -34,6 +35,9 @@ struct Arcadia_DDLS_ValidationContext {
   Arcadia_Object parent;
   /// @brief The schemata used by this validation context.
   Arcadia_Map* schemata;
+  /// @brief The validation program compiled from the schemata or the null pointer.
+  /// Compiled by the first validation after the schemata were modified.
+  Arcadia_DDLS_ValidationProgram* program;
   Arcadia_DDLS_Diagnostics* diagnostics;
   Arcadia_StringBuilder* temporary1;
   Arcadia_Languages_StringTable* stringTable;
@@ -0,0 +1,692 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/DDLS/Implementation/ValidationProgram.h"
+
+#include "Arcadia/DDLS/Extensions.h"
+
+typedef enum Opcode {
+  /// Accept any node.
+  Opcode_Any,
+  /// Accept a boolean node.
+  Opcode_Boolean,
+  /// Accept a number node.
+  Opcode_Number,
+  /// Accept a string node.
+  Opcode_String,
+  /// Accept a void node.
+  Opcode_Void,
+  /// Reject any node (a scalar of an unknown name).
+  Opcode_Reject,
+  /// Accept a list node if all elements are accepted by the instruction "element".
+  Opcode_List,
+  /// Accept a map node if its entry names are exactly the keys "keys[first]", ..., "keys[first + count - 1]"
+  /// and each entry value is accepted by the instruction associated with its key.
+  Opcode_Map,
+  /// Accept a node if at least one of the instructions "alternatives[first]", ..., "alternatives[first + count - 1]" accepts it.
+  Opcode_Choice,
+  /// A reference to the instruction "element".
+  /// Only exists during compilation.
+  Opcode_Reference,
+  /// A reference to a schema that does not exist.
+  Opcode_Unresolved,
+} Opcode;
+
+typedef struct Instruction {
+  Opcode opcode;
+  /// The DDLS node this instruction was compiled from. Used for diagnostics.
+  Arcadia_DDLS_Node* ddlsNode;
+  /// Opcode_Reference, Opcode_Unresolved: The name of the schema.
+  Arcadia_String* name;
+  /// Opcode_List: The index of the element instruction.
+  /// Opcode_Reference: The index of the referenced instruction.
+  Arcadia_SizeValue element;
+  /// Opcode_Map: The index of the first key in "keys".
+  /// Opcode_Choice: The index of the first alternative in "alternatives".
+  Arcadia_SizeValue first;
+  /// Opcode_Map: The number of keys.
+  /// Opcode_Choice: The number of alternatives.
+  Arcadia_SizeValue count;
+} Instruction;
+
+typedef struct Key {
+  Arcadia_String* name;
+  Arcadia_SizeValue instruction;
+} Key;
+
+typedef enum TaskKind {
+  /// Validate the node "node" against the instruction "instruction".
+  TaskKind_Validate,
+  /// The choice "instruction" for the node "node" is trying its alternative "next - 1".
+  TaskKind_Choice,
+} TaskKind;
+
+typedef struct Task {
+  TaskKind kind;
+  Arcadia_SizeValue instruction;
+  Arcadia_DDL_Node* node;
+  Arcadia_SizeValue next;
+} Task;
+
+typedef enum FailureKind {
+  FailureKind_UnexpectedType,
+  FailureKind_EntryAlreadyDefined,
+  FailureKind_EntryNotPermitted,
+  FailureKind_EntryMissing,
+  FailureKind_UnresolvedSchemaReference,
+} FailureKind;
+
+typedef struct Failure {
+  FailureKind kind;
+  Arcadia_DDLS_Node* ddlsNode;
+  Arcadia_DDL_Node* node;
+  Arcadia_String* name;
+} Failure;
+
+struct Arcadia_DDLS_ValidationProgram {
+  Instruction* instructions;
+  Arcadia_SizeValue numberOfInstructions;
+  Arcadia_SizeValue instructionsCapacity;
+
+  Key* keys;
+  Arcadia_SizeValue numberOfKeys;
+  Arcadia_SizeValue keysCapacity;
+
+  Arcadia_SizeValue* alternatives;
+  Arcadia_SizeValue numberOfAlternatives;
+  Arcadia_SizeValue alternativesCapacity;
+
+  /// Map from schema names to the indices of the instructions of their definitions.
+  Arcadia_Map* entries;
+
+  /// The work stack.
+  Task* tasks;
+  Arcadia_SizeValue numberOfTasks;
+  Arcadia_SizeValue tasksCapacity;
+
+  /// One mark per key of the map instruction with the most keys.
+  Arcadia_BooleanValue* marks;
+  Arcadia_SizeValue marksCapacity;
+};
+
+static void
+ensureCapacity
+  (
+    Arcadia_Thread* thread,
+    void** elements,
+    Arcadia_SizeValue* capacity,
+    Arcadia_SizeValue required,
+    Arcadia_SizeValue elementSize
+  )
+{
+  if (required <= *capacity) {
+    return;
+  }
+  Arcadia_SizeValue newCapacity = *capacity ? *capacity : 8;
+  while (newCapacity < required) {
+    if (newCapacity > Arcadia_SizeValue_Maximum / 2) {
+      newCapacity = required;
+      break;
+    }
+    newCapacity *= 2;
+  }
+  if (newCapacity > Arcadia_SizeValue_Maximum / elementSize) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_AllocationFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Memory_reallocateUnmanaged(thread, elements, newCapacity * elementSize);
+  *capacity = newCapacity;
+}
+
+static int
+compareKeys
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* x,
+    Arcadia_String* y
+  )
+{
+  Arcadia_SizeValue n = Arcadia_String_getNumberOfBytes(thread, x),
+                    m = Arcadia_String_getNumberOfBytes(thread, y);
+  int8_t result = Arcadia_Memory_compare(thread, Arcadia_String_getBytes(thread, x), Arcadia_String_getBytes(thread, y), n < m ? n : m);
+  if (result) {
+    return result;
+  }
+  return n < m ? -1 : (n > m ? +1 : 0);
+}
+
+static Arcadia_SizeValue
+emitInstruction
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDLS_ValidationProgram* self,
+    Opcode opcode,
+    Arcadia_DDLS_Node* ddlsNode
+  )
+{
+  ensureCapacity(thread, (void**)&self->instructions, &self->instructionsCapacity, self->numberOfInstructions + 1, sizeof(Instruction));
+  Instruction* instruction = &self->instructions[self->numberOfInstructions];
+  instruction->opcode = opcode;
+  instruction->ddlsNode = ddlsNode;
+  instruction->name = NULL;
+  instruction->element = 0;
+  instruction->first = 0;
+  instruction->count = 0;
+  return self->numberOfInstructions++;
+}
+
+static Arcadia_SizeValue
+compileNode
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDLS_ValidationProgram* self,
+    Arcadia_DDLS_Node* ddlsNode
+  );
+
+static Arcadia_SizeValue
+compileMap
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDLS_ValidationProgram* self,
+    Arcadia_DDLS_MapNode* ddlsNode
+  )
+{
+  Arcadia_SizeValue index = emitInstruction(thread, self, Opcode_Map, (Arcadia_DDLS_Node*)ddlsNode);
+  Arcadia_List* names = Arcadia_Map_getKeys(thread, ddlsNode->entries);
+  Arcadia_SizeValue count = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)names);
+  // Compile the entries first as they append instructions and keys of their own.
+  // The keys of this map are appended afterwards such that they form a contiguous slice.
+  Arcadia_SizeValue* instructions = Arcadia_Memory_allocateUnmanaged(thread, (count ? count : 1) * sizeof(Arcadia_SizeValue));
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    for (Arcadia_SizeValue i = 0; i < count; ++i) {
+      Arcadia_Value name = Arcadia_List_getAt(thread, names, i);
+      Arcadia_Value value = Arcadia_Map_get(thread, ddlsNode->entries, name);
+      instructions[i] = compileNode(thread, self, (Arcadia_DDLS_Node*)Arcadia_Value_getObjectReferenceValueChecked(thread, value, _Arcadia_DDLS_Node_getType(thread)));
+    }
+    ensureCapacity(thread, (void**)&self->keys, &self->keysCapacity, self->numberOfKeys + count, sizeof(Key));
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Memory_deallocateUnmanaged(thread, instructions);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_SizeValue first = self->numberOfKeys;
+  // Insert the keys sorted by their Bytes such that they can be binary searched.
+  for (Arcadia_SizeValue i = 0; i < count; ++i) {
+    Arcadia_Value v = Arcadia_List_getAt(thread, names, i);
+    Key key = { .name = (Arcadia_String*)Arcadia_Value_getObjectReferenceValue(&v), .instruction = instructions[i] };
+    Arcadia_SizeValue j = first + i;
+    while (j > first && compareKeys(thread, self->keys[j - 1].name, key.name) > 0) {
+      self->keys[j] = self->keys[j - 1];
+      j--;
+    }
+    self->keys[j] = key;
+  }
+  Arcadia_Memory_deallocateUnmanaged(thread, instructions);
+  self->numberOfKeys += count;
+  self->instructions[index].first = first;
+  self->instructions[index].count = count;
+  if (count > self->marksCapacity) {
+    self->marksCapacity = count;
+  }
+  return index;
+}
+
+static Arcadia_SizeValue
+compileChoice
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDLS_ValidationProgram* self,
+    Arcadia_DDLS_ChoiceNode* ddlsNode
+  )
+{
+  Arcadia_SizeValue index = emitInstruction(thread, self, Opcode_Choice, (Arcadia_DDLS_Node*)ddlsNode);
+  Arcadia_SizeValue count = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)ddlsNode->choices);
+  // Reserve the slice of alternatives first: compiling the alternatives appends alternatives of their own.
+  ensureCapacity(thread, (void**)&self->alternatives, &self->alternativesCapacity, self->numberOfAlternatives + count, sizeof(Arcadia_SizeValue));
+  Arcadia_SizeValue first = self->numberOfAlternatives;
+  self->numberOfAlternatives += count;
+  self->instructions[index].first = first;
+  self->instructions[index].count = count;
+  for (Arcadia_SizeValue i = 0; i < count; ++i) {
+    Arcadia_DDLS_Node* ddlsChildNode = (Arcadia_DDLS_Node*)Arcadia_List_getObjectReferenceValueCheckedAt(thread, ddlsNode->choices, i, _Arcadia_DDLS_Node_getType(thread));
+    Arcadia_SizeValue alternative = compileNode(thread, self, ddlsChildNode);
+    self->alternatives[first + i] = alternative;
+  }
+  return index;
+}
+
+static Arcadia_SizeValue
+compileNode
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDLS_ValidationProgram* self,
+    Arcadia_DDLS_Node* ddlsNode
+  )
+{
+  if (Arcadia_DDLS_isAny(thread, ddlsNode)) {
+    return emitInstruction(thread, self, Opcode_Any, ddlsNode);
+  } else if (Arcadia_DDLS_isBoolean(thread, ddlsNode)) {
+    return emitInstruction(thread, self, Opcode_Boolean, ddlsNode);
+  } else if (Arcadia_DDLS_isNumber(thread, ddlsNode)) {
+    return emitInstruction(thread, self, Opcode_Number, ddlsNode);
+  } else if (Arcadia_DDLS_isString(thread, ddlsNode)) {
+    return emitInstruction(thread, self, Opcode_String, ddlsNode);
+  } else if (Arcadia_DDLS_isVoid(thread, ddlsNode)) {
+    return emitInstruction(thread, self, Opcode_Void, ddlsNode);
+  } else if (Arcadia_DDLS_isList(thread, ddlsNode)) {
+    Arcadia_SizeValue index = emitInstruction(thread, self, Opcode_List, ddlsNode);
+    Arcadia_SizeValue element = compileNode(thread, self, ((Arcadia_DDLS_ListNode*)ddlsNode)->element);
+    self->instructions[index].element = element;
+    return index;
+  } else if (Arcadia_DDLS_isMap(thread, ddlsNode)) {
+    return compileMap(thread, self, (Arcadia_DDLS_MapNode*)ddlsNode);
+  } else if (Arcadia_DDLS_isChoice(thread, ddlsNode)) {
+    return compileChoice(thread, self, (Arcadia_DDLS_ChoiceNode*)ddlsNode);
+  } else if (Arcadia_DDLS_isSchemaReference(thread, ddlsNode)) {
+    // References are resolved after all reachable schemata are compiled.
+    Arcadia_SizeValue index = emitInstruction(thread, self, Opcode_Reference, ddlsNode);
+    self->instructions[index].name = ((Arcadia_DDLS_SchemaReferenceNode*)ddlsNode)->name;
+    return index;
+  } else {
+    return emitInstruction(thread, self, Opcode_Reject, ddlsNode);
+  }
+}
+
+static void
+compile
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDLS_ValidationProgram* self,
+    Arcadia_Map* schemata
+  )
+{
+  // (1) Compile the definitions of all schemata.
+  Arcadia_List* names = Arcadia_Map_getKeys(thread, schemata);
+  for (Arcadia_SizeValue i = 0, n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)names); i < n; ++i) {
+    Arcadia_Value name = Arcadia_List_getAt(thread, names, i);
+    Arcadia_Value value = Arcadia_Map_get(thread, schemata, name);
+    Arcadia_DDLS_SchemaNode* schemaNode = (Arcadia_DDLS_SchemaNode*)Arcadia_Value_getObjectReferenceValueChecked(thread, value, _Arcadia_DDLS_SchemaNode_getType(thread));
+    Arcadia_SizeValue index = compileNode(thread, self, schemaNode->definition);
+    Arcadia_Map_set(thread, self->entries, name, Arcadia_Value_makeSizeValue(index), NULL, NULL);
+  }
+  // (2) Link the references to the definitions of the schemata.
+  for (Arcadia_SizeValue i = 0; i < self->numberOfInstructions; ++i) {
+    Instruction* instruction = &self->instructions[i];
+    if (Opcode_Reference == instruction->opcode) {
+      Arcadia_Value v = Arcadia_Map_get(thread, self->entries, Arcadia_Value_makeObjectReferenceValue(instruction->name));
+      if (Arcadia_Value_isVoidValue(&v)) {
+        instruction->opcode = Opcode_Unresolved;
+      } else {
+        instruction->element = Arcadia_Value_getSizeValue(&v);
+      }
+    }
+  }
+  // (3) Replace each reference by a copy of the instruction at the end of its chain of references.
+  // A chain that does not end within the number of instructions is a cycle and is considered as unresolved.
+  for (Arcadia_SizeValue i = 0; i < self->numberOfInstructions; ++i) {
+    Instruction* instruction = &self->instructions[i];
+    if (Opcode_Reference != instruction->opcode) {
+      continue;
+    }
+    Arcadia_SizeValue target = instruction->element;
+    Arcadia_SizeValue steps = 0;
+    while (Opcode_Reference == self->instructions[target].opcode && steps < self->numberOfInstructions) {
+      target = self->instructions[target].element;
+      steps++;
+    }
+    if (Opcode_Reference == self->instructions[target].opcode) {
+      instruction->opcode = Opcode_Unresolved;
+    } else {
+      *instruction = self->instructions[target];
+    }
+  }
+  if (self->marksCapacity) {
+    self->marks = Arcadia_Memory_allocateUnmanaged(thread, self->marksCapacity * sizeof(Arcadia_BooleanValue));
+  }
+}
+
+Arcadia_DDLS_ValidationProgram*
+Arcadia_DDLS_ValidationProgram_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Map* schemata
+  )
+{
+  Arcadia_DDLS_ValidationProgram* self = Arcadia_Memory_allocateUnmanaged(thread, sizeof(Arcadia_DDLS_ValidationProgram));
+  self->instructions = NULL;
+  self->numberOfInstructions = 0;
+  self->instructionsCapacity = 0;
+  self->keys = NULL;
+  self->numberOfKeys = 0;
+  self->keysCapacity = 0;
+  self->alternatives = NULL;
+  self->numberOfAlternatives = 0;
+  self->alternativesCapacity = 0;
+  self->entries = NULL;
+  self->tasks = NULL;
+  self->numberOfTasks = 0;
+  self->tasksCapacity = 0;
+  self->marks = NULL;
+  self->marksCapacity = 0;
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    self->entries = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
+    compile(thread, self, schemata);
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_DDLS_ValidationProgram_destroy(thread, self);
+    Arcadia_Thread_jump(thread);
+  }
+  return self;
+}
+
+void
+Arcadia_DDLS_ValidationProgram_destroy
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDLS_ValidationProgram* self
+  )
+{
+  if (self->marks) {
+    Arcadia_Memory_deallocateUnmanaged(thread, self->marks);
+    self->marks = NULL;
+  }
+  if (self->tasks) {
+    Arcadia_Memory_deallocateUnmanaged(thread, self->tasks);
+    self->tasks = NULL;
+  }
+  if (self->alternatives) {
+    Arcadia_Memory_deallocateUnmanaged(thread, self->alternatives);
+    self->alternatives = NULL;
+  }
+  if (self->keys) {
+    Arcadia_Memory_deallocateUnmanaged(thread, self->keys);
+    self->keys = NULL;
+  }
+  if (self->instructions) {
+    Arcadia_Memory_deallocateUnmanaged(thread, self->instructions);
+    self->instructions = NULL;
+  }
+  Arcadia_Memory_deallocateUnmanaged(thread, self);
+}
+
+void
+Arcadia_DDLS_ValidationProgram_visit
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDLS_ValidationProgram* self
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < self->numberOfInstructions; ++i) {
+    Instruction* instruction = &self->instructions[i];
+    if (instruction->ddlsNode) {
+      Arcadia_Object_visit(thread, (Arcadia_Object*)instruction->ddlsNode);
+    }
+    if (instruction->name) {
+      Arcadia_Object_visit(thread, (Arcadia_Object*)instruction->name);
+    }
+  }
+  for (Arcadia_SizeValue i = 0; i < self->numberOfKeys; ++i) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->keys[i].name);
+  }
+  if (self->entries) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->entries);
+  }
+}
+
+static inline void
+pushTask
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDLS_ValidationProgram* self,
+    TaskKind kind,
+    Arcadia_SizeValue instruction,
+    Arcadia_DDL_Node* node,
+    Arcadia_SizeValue next
+  )
+{
+  if (self->numberOfTasks == self->tasksCapacity) {
+    ensureCapacity(thread, (void**)&self->tasks, &self->tasksCapacity, self->numberOfTasks + 1, sizeof(Task));
+  }
+  Task* task = &self->tasks[self->numberOfTasks++];
+  task->kind = kind;
+  task->instruction = instruction;
+  task->node = node;
+  task->next = next;
+}
+
+// Binary search the keys of the map instruction for a name.
+// Return the index of the key relative to the first key of the instruction or Arcadia_SizeValue_Maximum if the name was not found.
+static Arcadia_SizeValue
+findKey
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDLS_ValidationProgram* self,
+    Instruction* instruction,
+    Arcadia_String* name
+  )
+{
+  Arcadia_SizeValue l = 0, r = instruction->count;
+  while (l < r) {
+    Arcadia_SizeValue m = l + (r - l) / 2;
+    int c = compareKeys(thread, self->keys[instruction->first + m].name, name);
+    if (c < 0) {
+      l = m + 1;
+    } else if (c > 0) {
+      r = m;
+    } else {
+      return m;
+    }
+  }
+  return Arcadia_SizeValue_Maximum;
+}
+
+// Execute a validate task.
+// Return Arcadia_BooleanValue_True if the task succeeded (its child tasks may still fail).
+// Return Arcadia_BooleanValue_False if the task failed and store the failure in "failure".
+static Arcadia_BooleanValue
+execute
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDLS_ValidationProgram* self,
+    Arcadia_SizeValue index,
+    Arcadia_DDL_Node* node,
+    Failure* failure
+  )
+{
+  Instruction* instruction = &self->instructions[index];
+  failure->kind = FailureKind_UnexpectedType;
+  failure->ddlsNode = instruction->ddlsNode;
+  failure->node = node;
+  failure->name = NULL;
+  switch (instruction->opcode) {
+    case Opcode_Any: {
+      return Arcadia_BooleanValue_True;
+    } break;
+    case Opcode_Boolean: {
+      return Arcadia_DDL_NodeType_Boolean == node->type;
+    } break;
+    case Opcode_Number: {
+      return Arcadia_DDL_NodeType_Number == node->type;
+    } break;
+    case Opcode_String: {
+      return Arcadia_DDL_NodeType_String == node->type;
+    } break;
+    case Opcode_Void: {
+      return Arcadia_DDL_NodeType_Void == node->type;
+    } break;
+    case Opcode_List: {
+      if (Arcadia_DDL_NodeType_List != node->type) {
+        return Arcadia_BooleanValue_False;
+      }
+      Arcadia_List* elements = ((Arcadia_DDL_ListNode*)node)->elements;
+      Arcadia_SizeValue n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)elements);
+      // Push in reverse order such that the elements are validated in order.
+      for (Arcadia_SizeValue i = n; i > 0; --i) {
+        Arcadia_DDL_Node* element = (Arcadia_DDL_Node*)Arcadia_List_getObjectReferenceValueAt(thread, elements, i - 1);
+        pushTask(thread, self, TaskKind_Validate, instruction->element, element, 0);
+      }
+      return Arcadia_BooleanValue_True;
+    } break;
+    case Opcode_Map: {
+      if (Arcadia_DDL_NodeType_Map != node->type) {
+        return Arcadia_BooleanValue_False;
+      }
+      Arcadia_List* entries = ((Arcadia_DDL_MapNode*)node)->entries;
+      Arcadia_SizeValue n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)entries);
+      for (Arcadia_SizeValue i = 0; i < instruction->count; ++i) {
+        self->marks[i] = Arcadia_BooleanValue_False;
+      }
+      // (1) Ensure all map entry names are unique.
+      // (2) Ensure all map entry names are permitted by the type.
+      for (Arcadia_SizeValue i = 0; i < n; ++i) {
+        Arcadia_DDL_MapEntryNode* entry = (Arcadia_DDL_MapEntryNode*)Arcadia_List_getObjectReferenceValueAt(thread, entries, i);
+        Arcadia_SizeValue j = findKey(thread, self, instruction, entry->key->value);
+        if (Arcadia_SizeValue_Maximum == j) {
+          failure->kind = FailureKind_EntryNotPermitted;
+          failure->name = entry->key->value;
+          return Arcadia_BooleanValue_False;
+        }
+        if (self->marks[j]) {
+          failure->kind = FailureKind_EntryAlreadyDefined;
+          failure->name = entry->key->value;
+          return Arcadia_BooleanValue_False;
+        }
+        self->marks[j] = Arcadia_BooleanValue_True;
+      }
+      // (3) Ensure no entry required by the type is missing.
+      for (Arcadia_SizeValue i = 0; i < instruction->count; ++i) {
+        if (!self->marks[i]) {
+          failure->kind = FailureKind_EntryMissing;
+          failure->name = self->keys[instruction->first + i].name;
+          return Arcadia_BooleanValue_False;
+        }
+      }
+      // (4) Validate the entry values in order.
+      for (Arcadia_SizeValue i = n; i > 0; --i) {
+        Arcadia_DDL_MapEntryNode* entry = (Arcadia_DDL_MapEntryNode*)Arcadia_List_getObjectReferenceValueAt(thread, entries, i - 1);
+        Arcadia_SizeValue j = findKey(thread, self, instruction, entry->key->value);
+        pushTask(thread, self, TaskKind_Validate, self->keys[instruction->first + j].instruction, entry->value, 0);
+      }
+      return Arcadia_BooleanValue_True;
+    } break;
+    case Opcode_Choice: {
+      if (!instruction->count) {
+        return Arcadia_BooleanValue_False;
+      }
+      pushTask(thread, self, TaskKind_Choice, index, node, 1);
+      pushTask(thread, self, TaskKind_Validate, self->alternatives[instruction->first], node, 0);
+      return Arcadia_BooleanValue_True;
+    } break;
+    case Opcode_Unresolved: {
+      failure->kind = FailureKind_UnresolvedSchemaReference;
+      failure->name = instruction->name;
+      return Arcadia_BooleanValue_False;
+    } break;
+    case Opcode_Reject:
+    case Opcode_Reference:
+    default: {
+      return Arcadia_BooleanValue_False;
+    } break;
+  };
+}
+
+static void
+report
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDLS_Diagnostics* diagnostics,
+    Failure* failure
+  )
+{
+  switch (failure->kind) {
+    case FailureKind_UnexpectedType: {
+      Arcadia_DDLS_Diagnostics_unexpectedTypeError(thread, diagnostics, failure->ddlsNode, failure->node);
+    } break;
+    case FailureKind_EntryAlreadyDefined: {
+      Arcadia_DDLS_Diagnostics_mapEntryAlreadyDefined(thread, diagnostics, failure->name);
+    } break;
+    case FailureKind_EntryNotPermitted: {
+      Arcadia_DDLS_Diagnostics_mapEntryExistsError(thread, diagnostics, failure->name);
+    } break;
+    case FailureKind_EntryMissing: {
+      Arcadia_DDLS_Diagnostics_mapEntryNotExistsError(thread, diagnostics, failure->name);
+    } break;
+    case FailureKind_UnresolvedSchemaReference: {
+      Arcadia_DDLS_Diagnostics_unresolvedSchemaReferenceError(thread, diagnostics, failure->name);
+    } break;
+  };
+}
+
+void
+Arcadia_DDLS_ValidationProgram_run
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDLS_ValidationProgram* self,
+    Arcadia_DDLS_Diagnostics* diagnostics,
+    Arcadia_String* name,
+    Arcadia_DDL_Node* node
+  )
+{
+  Arcadia_Value v = Arcadia_Map_get(thread, self->entries, Arcadia_Value_makeObjectReferenceValue(name));
+  if (Arcadia_Value_isVoidValue(&v)) {
+    Arcadia_DDLS_Diagnostics_unresolvedSchemaReferenceError(thread, diagnostics, name);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_SemanticalError);
+    Arcadia_Thread_jump(thread);
+  }
+  self->numberOfTasks = 0;
+  pushTask(thread, self, TaskKind_Validate, Arcadia_Value_getSizeValue(&v), node, 0);
+  Failure failure;
+  while (self->numberOfTasks) {
+    Task task = self->tasks[--self->numberOfTasks];
+    if (TaskKind_Choice == task.kind) {
+      // All tasks of the current alternative were completed: the choice is accepted.
+      continue;
+    }
+    if (execute(thread, self, task.instruction, task.node, &failure)) {
+      continue;
+    }
+    // Unwind to the innermost choice which has alternatives left.
+    // Try its next alternative.
+    Arcadia_BooleanValue recovered = Arcadia_BooleanValue_False;
+    while (self->numberOfTasks && !recovered) {
+      Task* choice = &self->tasks[self->numberOfTasks - 1];
+      if (TaskKind_Choice != choice->kind) {
+        self->numberOfTasks--;
+        continue;
+      }
+      Instruction* instruction = &self->instructions[choice->instruction];
+      if (choice->next < instruction->count) {
+        Arcadia_SizeValue alternative = self->alternatives[instruction->first + choice->next];
+        Arcadia_DDL_Node* choiceNode = choice->node;
+        choice->next++;
+        pushTask(thread, self, TaskKind_Validate, alternative, choiceNode, 0);
+        recovered = Arcadia_BooleanValue_True;
+      } else {
+        self->numberOfTasks--;
+      }
+    }
+    if (!recovered) {
+      report(thread, diagnostics, &failure);
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_SemanticalError);
+      Arcadia_Thread_jump(thread);
+    }
+  }
+}
@@ -0,0 +1,84 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_DDLS_IMPLEMENTATION_VALIDATIONPROGRAM_H_INCLUDED)
+#define ARCADIA_DDLS_IMPLEMENTATION_VALIDATIONPROGRAM_H_INCLUDED
+
+#include "Arcadia/DDLS/Nodes/Include.h"
+#include "Arcadia/DDL/Include.h"
+#include "Arcadia/DDLS/Implementation/Diagnostics.h"
+
+// Internal type of a validation program.
+//
+// A validation program is the compiled form of the schemata of a validation context.
+// Every schema node is compiled into an instruction in a flat array of instructions.
+// Schema references are resolved to the indices of the instructions of their definitions.
+// The permitted keys of a map are compiled into a table of keys sorted by their Bytes.
+//
+// A validation program validates a DDL node iteratively using an explicit stack of tasks.
+// Once the stack and the table of seen keys have grown to their required size, validation does not allocate.
+typedef struct Arcadia_DDLS_ValidationProgram Arcadia_DDLS_ValidationProgram;
+
+/// @brief Compile the schemata of a validation context into a validation program.
+/// @param thread A pointer to this thread.
+/// @param schemata The map from schema names to schema nodes.
+/// @return A pointer to the validation program.
+/// The program must be destroyed by Arcadia_DDLS_ValidationProgram_destroy when no longer required.
+/// The program must not be used after the schemata are modified.
+Arcadia_DDLS_ValidationProgram*
+Arcadia_DDLS_ValidationProgram_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Map* schemata
+  );
+
+/// @brief Destroy a validation program.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to the validation program.
+void
+Arcadia_DDLS_ValidationProgram_destroy
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDLS_ValidationProgram* self
+  );
+
+/// @brief Visit the objects referenced by a validation program.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to the validation program.
+void
+Arcadia_DDLS_ValidationProgram_visit
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDLS_ValidationProgram* self
+  );
+
+/// @brief Validate a DDL node against a schema.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to the validation program.
+/// @param diagnostics A pointer to the diagnostics.
+/// @param name The name of the schema.
+/// @param node A pointer to the DDL node.
+/// @error Arcadia_Status_SemanticalError the schema does not exist or the DDL node does not conform to the schema
+void
+Arcadia_DDLS_ValidationProgram_run
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDLS_ValidationProgram* self,
+    Arcadia_DDLS_Diagnostics* diagnostics,
+    Arcadia_String* name,
+    Arcadia_DDL_Node* node
+  );
+
+#endif // ARCADIA_DDLS_IMPLEMENTATION_VALIDATIONPROGRAM_H_INCLUDED
@@ -381,8 +381,7 @@ Arcadia_DDLS_DefaultReader_runImpl
   )
 {
   Arcadia_Languages_StringTable* stringTable = Arcadia_Languages_StringTable_getOrCreate(thread);
-  Arcadia_UnicodeCodePointReader* inputReader = (Arcadia_UnicodeCodePointReader*)Arcadia_ByteReader_UnicodeCodePointReader_create(thread, (Arcadia_ByteReader*)Arcadia_ByteArray_ByteReader_create(thread, input));
-  Arcadia_Languages_Parser_setInput(thread, (Arcadia_Languages_Parser*)self->parser, inputReader);
+  Arcadia_DDL_Parser_setInputBytes(thread, self->parser, input);
   Arcadia_DDL_Node* node = (Arcadia_DDL_Node*)Arcadia_Value_getObjectReferenceValueChecked(thread, Arcadia_Languages_Parser_run(thread, (Arcadia_Languages_Parser*)self->parser), _Arcadia_DDL_Node_getType(thread));
   Arcadia_DDLS_SymbolReader* symbolReader = Arcadia_DDLS_SymbolReader_create(thread, stringTable);
   Arcadia_DDLS_Symbol* symbol = Arcadia_DDLS_SymbolReader_run(thread, symbolReader, node);
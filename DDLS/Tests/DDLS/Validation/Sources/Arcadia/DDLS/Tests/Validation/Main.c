@@ -140,6 +140,187 @@ Arcadia_DDLS_Tests_Validation_choiceReject1
   }
 }
 
+// input is a string and a number, the second choice is string/number => accept
+static void
+Arcadia_DDLS_Tests_Validation_choiceAccept2
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static const char* DDLS =
+    "{\n"
+    "  kind : \"Schema\",\n"
+    "  name : \"MySchema\",\n"
+    "  definition : \n"
+    "  {\n"
+    "  kind : \"Choice\",\n"
+    "  choices : [\n"
+    "      {\n"
+    "        kind : \"Boolean\",\n"
+    "      },\n"
+    "      {\n"
+    "        kind : \"String\",\n"
+    "      },\n"
+    "      {\n"
+    "        kind : \"Number\",\n"
+    "      },\n"
+    "    ],\n"
+    "  },\n"
+    "},\n"
+    ;
+
+  const char* DDL[] =
+    {
+      "\"w\"",
+      "1",
+      "true",
+    };
+  Arcadia_DDLS_SchemaNode* ddlsNode = readDDLS(thread, DDLS);
+  Arcadia_DDLS_ValidationContext* validationContext = Arcadia_DDLS_ValidationContext_create(thread);
+  Arcadia_DDLS_ValidationContext_addSchema(thread, validationContext, ddlsNode);
+  for (Arcadia_SizeValue i = 0; i < sizeof(DDL) / sizeof(const char*); ++i) {
+    Arcadia_DDL_Node* node = readDDL(thread, DDL[i]);
+    Arcadia_DDLS_ValidationContext_run(thread, validationContext, Arcadia_String_createFromCxxString(thread, u8"MySchema"), node);
+  }
+}
+
+// input is a list of maps, the choice between the maps fails deep inside the first alternative => accept
+static void
+Arcadia_DDLS_Tests_Validation_choiceAccept3
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static const char* DDLS =
+    "{\n"
+    "  kind : \"Schema\",\n"
+    "  name : \"MySchema\",\n"
+    "  definition : \n"
+    "  {\n"
+    "  kind : \"List\",\n"
+    "  entry : {\n"
+    "    kind : \"Choice\",\n"
+    "    choices : [\n"
+    "      {\n"
+    "        kind : \"Map\",\n"
+    "        entries : [\n"
+    "          {\n"
+    "            kind : \"MapEntry\",\n"
+    "            name : \"x\",\n"
+    "            type : {\n"
+    "              kind : \"Number\",\n"
+    "            },\n"
+    "          },\n"
+    "        ],\n"
+    "      },\n"
+    "      {\n"
+    "        kind : \"Map\",\n"
+    "        entries : [\n"
+    "          {\n"
+    "            kind : \"MapEntry\",\n"
+    "            name : \"x\",\n"
+    "            type : {\n"
+    "              kind : \"String\",\n"
+    "            },\n"
+    "          },\n"
+    "        ],\n"
+    "      },\n"
+    "    ],\n"
+    "  },\n"
+    "  },\n"
+    "},\n"
+    ;
+
+  Arcadia_DDLS_SchemaNode* ddlsNode = readDDLS(thread, DDLS);
+  Arcadia_DDL_Node* node = readDDL(thread, "[ { x : 1 }, { x : \"y\" }, { x : 2 } ]");
+  Arcadia_DDLS_ValidationContext* validationContext = Arcadia_DDLS_ValidationContext_create(thread);
+  Arcadia_DDLS_ValidationContext_addSchema(thread, validationContext, ddlsNode);
+  Arcadia_DDLS_ValidationContext_run(thread, validationContext, Arcadia_String_createFromCxxString(thread, u8"MySchema"), node);
+}
+
+// input is a map with an entry not permitted by the schema => reject
+static void
+Arcadia_DDLS_Tests_Validation_testRejectEntryNotPermitted
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static const char* DDLS =
+    "{\n"
+    "  kind : \"Schema\",\n"
+    "  name : \"MySchema\",\n"
+    "  definition : \n"
+    "  {\n"
+    "  kind : \"Map\",\n"
+    "  entries : [\n"
+    "      {\n"
+    "        kind : \"MapEntry\",\n"
+    "        name : \"x\",\n"
+    "        type : {\n"
+    "          kind : \"Number\",\n"
+    "        },\n"
+    "      },\n"
+    "    ],\n"
+    "  },\n"
+    "},\n"
+    ;
+
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_DDLS_SchemaNode* ddlsNode = readDDLS(thread, DDLS);
+    Arcadia_DDL_Node* node = readDDL(thread, "{ x : 1, y : 2 }");
+    Arcadia_DDLS_ValidationContext* validationContext = Arcadia_DDLS_ValidationContext_create(thread);
+    Arcadia_DDLS_ValidationContext_addSchema(thread, validationContext, ddlsNode);
+    Arcadia_DDLS_ValidationContext_run(thread, validationContext, Arcadia_String_createFromCxxString(thread, u8"MySchema"), node);
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+    Arcadia_Thread_jump(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    if (Arcadia_Thread_getStatus(thread) != Arcadia_Status_SemanticalError) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+      Arcadia_Thread_jump(thread);
+    } else {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+    }
+  }
+}
+
+// input are 100000 nested lists, the schema is a list of itself => accept
+static void
+Arcadia_DDLS_Tests_Validation_testDeepNesting
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static const char* DDLS =
+    "{\n"
+    "  kind : \"Schema\",\n"
+    "  name : \"MySchema\",\n"
+    "  definition : \n"
+    "  {\n"
+    "  kind : \"List\",\n"
+    "  entry : {\n"
+    "    kind : \"SchemaReference\",\n"
+    "    name : \"MySchema\",\n"
+    "  },\n"
+    "  },\n"
+    "},\n"
+    ;
+
+  Arcadia_DDL_ListNode* node = Arcadia_DDL_ListNode_create(thread);
+  for (Arcadia_SizeValue i = 0; i < 100000; ++i) {
+    Arcadia_DDL_ListNode* outer = Arcadia_DDL_ListNode_create(thread);
+    Arcadia_List_insertBackObjectReferenceValue(thread, outer->elements, (Arcadia_Object*)node);
+    node = outer;
+  }
+  Arcadia_DDLS_SchemaNode* ddlsNode = readDDLS(thread, DDLS);
+  Arcadia_DDLS_ValidationContext* validationContext = Arcadia_DDLS_ValidationContext_create(thread);
+  Arcadia_DDLS_ValidationContext_addSchema(thread, validationContext, ddlsNode);
+  Arcadia_DDLS_ValidationContext_run(thread, validationContext, Arcadia_String_createFromCxxString(thread, u8"MySchema"), (Arcadia_DDL_Node*)node);
+}
+
 int
 main
   (
@@ -183,6 +364,20 @@ main
   if (!Arcadia_Tests_safeExecute(&Arcadia_DDLS_Tests_Validation_choiceReject1)) {
     return EXIT_FAILURE;
   }
+  if (!Arcadia_Tests_safeExecute(&Arcadia_DDLS_Tests_Validation_choiceAccept2)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&Arcadia_DDLS_Tests_Validation_choiceAccept3)) {
+    return EXIT_FAILURE;
+  }
+
+  if (!Arcadia_Tests_safeExecute(&Arcadia_DDLS_Tests_Validation_testRejectEntryNotPermitted)) {
+    return EXIT_FAILURE;
+  }
+
+  if (!Arcadia_Tests_safeExecute(&Arcadia_DDLS_Tests_Validation_testDeepNesting)) {
+    return EXIT_FAILURE;
+  }
 
   return EXIT_SUCCESS;
 }
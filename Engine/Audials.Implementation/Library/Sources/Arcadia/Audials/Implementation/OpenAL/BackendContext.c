@@ -17,6 +17,7 @@
 #include "Arcadia/Audials/Implementation/OpenAL/BackendContext.h"
 
 #include "Arcadia/Audials/Implementation/OpenAL/Resources/SoundSourceResource.h"
+#include "Arcadia/Audials/Implementation/OpenAL/Resources/StreamingSoundSourceResource.h"
 #include <assert.h>
 
 static Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext* g_instance = NULL;
@@ -51,6 +52,14 @@ Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext_createSoundSourceRes
     Arcadia_Media_SampleBuffer* sampleBuffer
   );
 
+static Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource*
+Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext_createStreamingSoundSourceResouceImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext* self,
+    Arcadia_Media_SampleStream* sampleStream
+  );
+
 static void
 Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext_constructImpl
   (
@@ -150,6 +159,20 @@ Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext_createSoundSourceRes
   return resource;
 }
 
+static Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource*
+Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext_createStreamingSoundSourceResouceImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext* self,
+    Arcadia_Media_SampleStream* sampleStream
+  )
+{
+  Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* resource = Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_create(thread, (Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext*)self, sampleStream);
+  assert(((Arcadia_Engine_Audials_Implementation_Resource*)resource)->referenceCount == 0);
+  Arcadia_List_insertBackObjectReferenceValue(thread, self->resources, (Arcadia_Object*)resource);
+  return resource;
+}
+
 static void
 Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext_constructImpl
   (
@@ -206,6 +229,7 @@ Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext_initializeDispatchIm
   )
 {
   ((Arcadia_Engine_Audials_BackendContextDispatch*)self)->createSoundSourceResource = (Arcadia_Engine_Audials_Implementation_SoundSourceResource * (*)(Arcadia_Thread*, Arcadia_Engine_Audials_BackendContext*,Arcadia_Media_SampleBuffer*)) & Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext_createSoundSourceResouceImpl;
+  ((Arcadia_Engine_Audials_BackendContextDispatch*)self)->createStreamingSoundSourceResource = (Arcadia_Engine_Audials_Implementation_SoundSourceResource * (*)(Arcadia_Thread*, Arcadia_Engine_Audials_BackendContext*,Arcadia_Media_SampleStream*)) & Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext_createStreamingSoundSourceResouceImpl;
   ((Arcadia_Engine_BackendContextDispatch*)self)->update = (void(*)(Arcadia_Thread*, Arcadia_Engine_BackendContext*)) & Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext_updateImpl;
 }
 
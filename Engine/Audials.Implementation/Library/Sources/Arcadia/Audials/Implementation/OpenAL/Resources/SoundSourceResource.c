@@ -138,6 +138,13 @@ Arcadia_Engine_Audials_Implementation_OpenAL_SoundSourceResource_getVolume
     Arcadia_Engine_Audials_Implementation_OpenAL_SoundSourceResource* self
   );
 
+static Arcadia_Natural64Value
+Arcadia_Engine_Audials_Implementation_OpenAL_SoundSourceResource_getNumberOfUnderruns
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_SoundSourceResource* self
+  );
+
 static const Arcadia_ObjectType_Operations _objectTypeOperations = {
   Arcadia_ObjectType_Operations_Initializer,
   .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_Engine_Audials_Implementation_OpenAL_SoundSourceResource_constructImpl,
@@ -205,6 +212,7 @@ Arcadia_Engine_Audials_Implementation_OpenAL_SoundSourceResource_initializeDispa
   ((Arcadia_Engine_Audials_Implementation_SoundSourceResourceDispatch*)self)->getIsLooping = (Arcadia_BooleanValue (*)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_SoundSourceResource*)) & Arcadia_Engine_Audials_Implementation_OpenAL_SoundSourceResource_getIsLooping;
   ((Arcadia_Engine_Audials_Implementation_SoundSourceResourceDispatch*)self)->setVolume = (void (*)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_SoundSourceResource*, Arcadia_Real32Value)) & Arcadia_Engine_Audials_Implementation_OpenAL_SoundSourceResource_setVolume;
   ((Arcadia_Engine_Audials_Implementation_SoundSourceResourceDispatch*)self)->getVolume = (Arcadia_Real32Value(*)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_SoundSourceResource*)) & Arcadia_Engine_Audials_Implementation_OpenAL_SoundSourceResource_getVolume;
+  ((Arcadia_Engine_Audials_Implementation_SoundSourceResourceDispatch*)self)->getNumberOfUnderruns = (Arcadia_Natural64Value(*)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_SoundSourceResource*)) & Arcadia_Engine_Audials_Implementation_OpenAL_SoundSourceResource_getNumberOfUnderruns;
   //
   ((Arcadia_Engine_Audials_Implementation_ResourceDispatch*)self)->load = (void (*)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_Resource*)) & Arcadia_Engine_Audials_Implementation_OpenAL_SoundSourceResource_loadImpl;
   ((Arcadia_Engine_Audials_Implementation_ResourceDispatch*)self)->unlink = (void (*)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_Resource*)) & Arcadia_Engine_Audials_Implementation_OpenAL_SoundSourceResource_unlinkImpl;
@@ -482,6 +490,14 @@ Arcadia_Engine_Audials_Implementation_OpenAL_SoundSourceResource_getVolume
   )
 { return self->volume; }
 
+static Arcadia_Natural64Value
+Arcadia_Engine_Audials_Implementation_OpenAL_SoundSourceResource_getNumberOfUnderruns
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_SoundSourceResource* self
+  )
+{ return 0; }
+
 Arcadia_Engine_Audials_Implementation_OpenAL_SoundSourceResource*
 Arcadia_Engine_Audials_Implementation_OpenAL_SoundSourceResource_create
   (
@@ -0,0 +1,742 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/Audials/Implementation/OpenAL/Resources/StreamingSoundSourceResource.h"
+
+#include "Arcadia/Audials/Implementation/OpenAL/BackendContext.h"
+#include "Arcadia/Media/Include.h"
+#include <assert.h>
+
+#define IsLoopingDirty (1)
+#define VolumeDirty (2)
+#define AllDirty (IsLoopingDirty|VolumeDirty)
+
+#define NumberOfBuffers Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_NumberOfBuffers
+#define BufferSize Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_BufferSize
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  );
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResourceDispatch* self
+  );
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_destructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  );
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_visitImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  );
+
+// Get the AL format for a sample format.
+// Raise Arcadia_Status_EnvironmentFailed if there is no AL format for the sample format.
+static ALenum
+getALFormat
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleFormat sampleFormat
+  );
+
+// Fill the specified AL buffer with the next samples of the sample stream and queue it on the AL source.
+// Return Arcadia_BooleanValue_False if there are no samples left.
+static Arcadia_BooleanValue
+fillAndQueueBuffer
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self,
+    ALuint alBufferID
+  );
+
+// Fill and queue free AL buffers until there are no free AL buffers or no samples left.
+static void
+fillAndQueueBuffers
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  );
+
+// Stop the AL source, detach all AL buffers from the AL source, and rewind the sample stream.
+static void
+reset
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  );
+
+// Unqueue the AL buffers the AL source has processed and add them to the free AL buffers.
+static void
+unqueueProcessedBuffers
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  );
+
+// Unqueue the processed AL buffers, refill and queue them again, and detect underruns.
+static void
+pump
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  );
+
+// Apply the dirty properties to the AL source and pump.
+static void
+update
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  );
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_loadImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  );
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_renderImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  );
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_unlinkImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  );
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_unloadImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  );
+
+static Arcadia_BooleanValue
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_isPlaying
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  );
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_pause
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  );
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_play
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  );
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_stop
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  );
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_setIsLooping
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self,
+    Arcadia_BooleanValue isLooping
+  );
+
+static Arcadia_BooleanValue
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_getIsLooping
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  );
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_setVolume
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self,
+    Arcadia_Real32Value volume
+  );
+
+static Arcadia_Real32Value
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_getVolume
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  );
+
+static Arcadia_Natural64Value
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_getNumberOfUnderruns
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  );
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_constructImpl,
+  .destruct = (Arcadia_Object_DestructCallbackFunction*)&Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_destructImpl,
+  .visit = (Arcadia_Object_VisitCallbackFunction*)&Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_visitImpl,
+  .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_initializeDispatchImpl,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.Engine.Audials.Implementation.OpenAL.StreamingSoundSourceResource", Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource,
+                         u8"Arcadia.Engine.Audials.Implementation.SoundSourceResource", Arcadia_Engine_Audials_Implementation_SoundSourceResource,
+                         &_typeOperations);
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource);
+  {
+    Arcadia_Value t;
+    t = Arcadia_ValueStack_getValue(thread, 2);
+    Arcadia_ValueStack_pushValue(thread, &t);
+    Arcadia_ValueStack_pushNatural8Value(thread, 1);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  //
+  if (2 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  //
+  self->sampleStream = Arcadia_ValueStack_getObjectReferenceValueChecked(thread, 1, _Arcadia_Media_SampleStream_getType(thread));
+  // Raise an error early if the sample format is not supported.
+  getALFormat(thread, Arcadia_Media_SampleStream_getSampleFormat(thread, self->sampleStream));
+  //
+  self->isLooping = Arcadia_BooleanValue_False;
+  self->volume = 1.f;
+  //
+  self->dirtyBits = AllDirty;
+  self->isPlaying = Arcadia_BooleanValue_False;
+  self->numberOfUnderruns = 0;
+  for (Arcadia_SizeValue i = 0; i < NumberOfBuffers; ++i) {
+    self->alBufferIDs[i] = 0;
+    self->alFreeBufferIDs[i] = 0;
+  }
+  self->numberOfFreeBuffers = 0;
+  self->alSourceID = 0;
+  self->block = Arcadia_Memory_allocateUnmanaged(thread, BufferSize * Arcadia_Media_SampleFormat_getNumberOfBytes(thread, Arcadia_Media_SampleStream_getSampleFormat(thread, self->sampleStream)));
+  //
+  Arcadia_LeaveConstructor(Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource);
+}
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResourceDispatch* self
+  )
+{
+  //
+  ((Arcadia_Engine_Audials_Implementation_SoundSourceResourceDispatch*)self)->isPlaying = (Arcadia_BooleanValue(*)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_SoundSourceResource*)) & Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_isPlaying;
+  ((Arcadia_Engine_Audials_Implementation_SoundSourceResourceDispatch*)self)->play = (void (*)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_SoundSourceResource*)) & Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_play;
+  ((Arcadia_Engine_Audials_Implementation_SoundSourceResourceDispatch*)self)->pause = (void (*)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_SoundSourceResource*)) & Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_pause;
+  ((Arcadia_Engine_Audials_Implementation_SoundSourceResourceDispatch*)self)->stop = (void (*)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_SoundSourceResource*)) & Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_stop;
+  ((Arcadia_Engine_Audials_Implementation_SoundSourceResourceDispatch*)self)->setIsLooping = (void (*)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_SoundSourceResource*, Arcadia_BooleanValue)) & Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_setIsLooping;
+  ((Arcadia_Engine_Audials_Implementation_SoundSourceResourceDispatch*)self)->getIsLooping = (Arcadia_BooleanValue (*)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_SoundSourceResource*)) & Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_getIsLooping;
+  ((Arcadia_Engine_Audials_Implementation_SoundSourceResourceDispatch*)self)->setVolume = (void (*)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_SoundSourceResource*, Arcadia_Real32Value)) & Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_setVolume;
+  ((Arcadia_Engine_Audials_Implementation_SoundSourceResourceDispatch*)self)->getVolume = (Arcadia_Real32Value(*)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_SoundSourceResource*)) & Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_getVolume;
+  ((Arcadia_Engine_Audials_Implementation_SoundSourceResourceDispatch*)self)->getNumberOfUnderruns = (Arcadia_Natural64Value(*)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_SoundSourceResource*)) & Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_getNumberOfUnderruns;
+  //
+  ((Arcadia_Engine_Audials_Implementation_ResourceDispatch*)self)->load = (void (*)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_Resource*)) & Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_loadImpl;
+  ((Arcadia_Engine_Audials_Implementation_ResourceDispatch*)self)->unlink = (void (*)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_Resource*)) & Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_unlinkImpl;
+  ((Arcadia_Engine_Audials_Implementation_ResourceDispatch*)self)->unload = (void (*)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_Resource*)) & Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_unloadImpl;
+  ((Arcadia_Engine_Audials_Implementation_ResourceDispatch*)self)->render = (void (*)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_Resource*)) & Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_renderImpl;
+}
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_destructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  )
+{
+  assert(0 == self->alBufferIDs[0]);
+  assert(0 == self->alSourceID);
+  if (self->block) {
+    Arcadia_Memory_deallocateUnmanaged(thread, self->block);
+    self->block = NULL;
+  }
+}
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_visitImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  )
+{
+  if (self->sampleStream) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->sampleStream);
+  }
+}
+
+static ALenum
+getALFormat
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleFormat sampleFormat
+  )
+{
+  switch (sampleFormat) {
+    case Arcadia_Media_SampleFormat_Integer16: {
+      return AL_FORMAT_MONO16;
+    } break;
+    case Arcadia_Media_SampleFormat_Natural8: {
+      return AL_FORMAT_MONO8;
+    } break;
+    default: {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+      Arcadia_Thread_jump(thread);
+    } break;
+  };
+  // Unreachable: The default case jumps.
+  return AL_NONE;
+}
+
+static Arcadia_BooleanValue
+fillAndQueueBuffer
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self,
+    ALuint alBufferID
+  )
+{
+  Arcadia_Media_SampleFormat sampleFormat = Arcadia_Media_SampleStream_getSampleFormat(thread, self->sampleStream);
+  Arcadia_SizeValue bytesPerSample = Arcadia_Media_SampleFormat_getNumberOfBytes(thread, sampleFormat);
+  Arcadia_SizeValue numberOfSamples = 0;
+  while (numberOfSamples < BufferSize) {
+    Arcadia_SizeValue n = Arcadia_Media_SampleStream_read(thread, self->sampleStream, self->block + numberOfSamples * bytesPerSample, BufferSize - numberOfSamples);
+    numberOfSamples += n;
+    if (n == 0) {
+      // The end of the sample stream was reached.
+      // If looping and the sample stream is not empty, continue at the first sample.
+      if (!self->isLooping || !Arcadia_Media_SampleStream_getLength(thread, self->sampleStream)) {
+        break;
+      }
+      Arcadia_Media_SampleStream_rewind(thread, self->sampleStream);
+    }
+  }
+  if (!numberOfSamples) {
+    return Arcadia_BooleanValue_False;
+  }
+  alBufferData(alBufferID, getALFormat(thread, sampleFormat), self->block, (ALsizei)(numberOfSamples * bytesPerSample),
+                                                                           Arcadia_Media_SampleStream_getSampleRate(thread, self->sampleStream));
+  alSourceQueueBuffers(self->alSourceID, 1, &alBufferID);
+  if (alGetError()) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  return Arcadia_BooleanValue_True;
+}
+
+static void
+fillAndQueueBuffers
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  )
+{
+  while (self->numberOfFreeBuffers) {
+    if (!fillAndQueueBuffer(thread, self, self->alFreeBufferIDs[self->numberOfFreeBuffers - 1])) {
+      break;
+    }
+    self->numberOfFreeBuffers--;
+  }
+}
+
+static void
+reset
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  )
+{
+  alSourceStop(self->alSourceID);
+  // Detach all queued AL buffers.
+  alSourcei(self->alSourceID, AL_BUFFER, 0);
+  if (alGetError()) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  for (Arcadia_SizeValue i = 0; i < NumberOfBuffers; ++i) {
+    self->alFreeBufferIDs[i] = self->alBufferIDs[i];
+  }
+  self->numberOfFreeBuffers = NumberOfBuffers;
+  Arcadia_Media_SampleStream_rewind(thread, self->sampleStream);
+}
+
+static void
+unqueueProcessedBuffers
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  )
+{
+  ALint numberOfProcessedBuffers = 0;
+  alGetSourcei(self->alSourceID, AL_BUFFERS_PROCESSED, &numberOfProcessedBuffers);
+  if (alGetError()) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  while (numberOfProcessedBuffers > 0) {
+    ALuint alBufferID;
+    alSourceUnqueueBuffers(self->alSourceID, 1, &alBufferID);
+    if (alGetError()) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+      Arcadia_Thread_jump(thread);
+    }
+    assert(self->numberOfFreeBuffers < NumberOfBuffers);
+    self->alFreeBufferIDs[self->numberOfFreeBuffers++] = alBufferID;
+    numberOfProcessedBuffers--;
+  }
+}
+
+static void
+pump
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  )
+{
+  // (1) Unqueue the AL buffers the AL source has processed.
+  unqueueProcessedBuffers(thread, self);
+  // (2) Refill and queue them again.
+  fillAndQueueBuffers(thread, self);
+  // (3) The AL source stops if it runs out of queued AL buffers.
+  // If it stopped, then all its AL buffers are processed, including those it processed after (1): Unqueue, refill, and queue them.
+  // If there are queued AL buffers now, then we did not keep up: Count an underrun and resume playback.
+  // Otherwise the end of the sample stream was reached.
+  if (self->isPlaying) {
+    ALint alSourceState;
+    alGetSourcei(self->alSourceID, AL_SOURCE_STATE, &alSourceState);
+    if (alGetError()) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+      Arcadia_Thread_jump(thread);
+    }
+    if (AL_PLAYING != alSourceState) {
+      unqueueProcessedBuffers(thread, self);
+      fillAndQueueBuffers(thread, self);
+      if (self->numberOfFreeBuffers < NumberOfBuffers) {
+        self->numberOfUnderruns++;
+        alSourcePlay(self->alSourceID);
+        if (alGetError()) {
+          Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+          Arcadia_Thread_jump(thread);
+        }
+      } else {
+        self->isPlaying = Arcadia_BooleanValue_False;
+      }
+    }
+  }
+}
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_loadImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  )
+{
+  if (0 == self->alBufferIDs[0]) {
+    alGenBuffers(NumberOfBuffers, self->alBufferIDs);
+    if (alGetError()) {
+      for (Arcadia_SizeValue i = 0; i < NumberOfBuffers; ++i) {
+        self->alBufferIDs[i] = 0;
+      }
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+      Arcadia_Thread_jump(thread);
+    }
+    for (Arcadia_SizeValue i = 0; i < NumberOfBuffers; ++i) {
+      self->alFreeBufferIDs[i] = self->alBufferIDs[i];
+    }
+    self->numberOfFreeBuffers = NumberOfBuffers;
+    Arcadia_Media_SampleStream_rewind(thread, self->sampleStream);
+  }
+  if (0 == self->alSourceID) {
+    alGenSources(1, &self->alSourceID);
+    if (alGetError()) {
+      alDeleteBuffers(NumberOfBuffers, self->alBufferIDs);
+      for (Arcadia_SizeValue i = 0; i < NumberOfBuffers; ++i) {
+        self->alBufferIDs[i] = 0;
+      }
+      self->numberOfFreeBuffers = 0;
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+      Arcadia_Thread_jump(thread);
+    }
+    // Looping is implemented by rewinding the sample stream and not by the AL source.
+    alSourcei(self->alSourceID, AL_LOOPING, AL_FALSE);
+    alSourcei(self->alSourceID, AL_SOURCE_RELATIVE, AL_TRUE);
+    self->dirtyBits |= AllDirty;
+  }
+  update(thread, self);
+}
+
+static void
+update
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  )
+{
+  // Volume.
+  if (self->dirtyBits & VolumeDirty) {
+    ALfloat minimumGain, maximumGain;
+    alGetSourcef(self->alSourceID, AL_MIN_GAIN, &minimumGain);
+    alGetSourcef(self->alSourceID, AL_MAX_GAIN, &maximumGain);
+    if (alGetError()) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+      Arcadia_Thread_jump(thread);
+    }
+    if (self->volume < minimumGain) self->volume = minimumGain;
+    if (self->volume > maximumGain) self->volume = maximumGain;
+    alSourcef(self->alSourceID, AL_GAIN, self->volume);
+    if (alGetError()) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+      Arcadia_Thread_jump(thread);
+    }
+    self->dirtyBits &= ~VolumeDirty;
+  }
+  // Looping.
+  if (self->dirtyBits & IsLoopingDirty) {
+    // Nothing to do: The next AL buffer filled observes the new value.
+    self->dirtyBits &= ~IsLoopingDirty;
+  }
+  pump(thread, self);
+}
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_renderImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  )
+{
+  Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_loadImpl(thread, self);
+}
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_unlinkImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  )
+{
+  assert(0 == self->alBufferIDs[0]);
+  assert(0 == self->alSourceID);
+  ((Arcadia_Engine_Audials_Implementation_Resource*)self)->context = NULL;
+}
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_unloadImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  )
+{
+  if (self->alSourceID) {
+    alSourceStop(self->alSourceID);
+    alSourcei(self->alSourceID, AL_BUFFER, 0);
+    alDeleteSources(1, &self->alSourceID);
+    self->alSourceID = 0;
+  }
+  if (self->alBufferIDs[0]) {
+    alDeleteBuffers(NumberOfBuffers, self->alBufferIDs);
+    for (Arcadia_SizeValue i = 0; i < NumberOfBuffers; ++i) {
+      self->alBufferIDs[i] = 0;
+    }
+  }
+  self->numberOfFreeBuffers = 0;
+  self->isPlaying = Arcadia_BooleanValue_False;
+}
+
+static Arcadia_BooleanValue
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_isPlaying
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  )
+{
+  if (!self->alSourceID) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_OperationInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  // The AL source is stopped during an underrun but the sound source is still considered as playing.
+  return self->isPlaying;
+}
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_pause
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  )
+{
+  if (!self->alSourceID) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_OperationInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  alSourcePause(self->alSourceID);
+  if (alGetError()) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  self->isPlaying = Arcadia_BooleanValue_False;
+}
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_play
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  )
+{
+  if (!self->alSourceID) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_OperationInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  if (!self->isPlaying) {
+    if (self->numberOfFreeBuffers == NumberOfBuffers) {
+      // The end of the sample stream was reached: Start from the beginning.
+      reset(thread, self);
+      fillAndQueueBuffers(thread, self);
+    }
+    alSourcePlay(self->alSourceID);
+    if (alGetError()) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+      Arcadia_Thread_jump(thread);
+    }
+    self->isPlaying = Arcadia_BooleanValue_True;
+  }
+}
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_stop
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  )
+{
+  if (!self->alSourceID) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_OperationInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->isPlaying = Arcadia_BooleanValue_False;
+  reset(thread, self);
+  fillAndQueueBuffers(thread, self);
+}
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_setIsLooping
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self,
+    Arcadia_BooleanValue isLooping
+  )
+{
+  self->dirtyBits |= self->isLooping != isLooping ? IsLoopingDirty : 0;
+  self->isLooping = isLooping;
+}
+
+static Arcadia_BooleanValue
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_getIsLooping
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  )
+{
+  return self->isLooping;
+}
+
+static void
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_setVolume
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self,
+    Arcadia_Real32Value volume
+  )
+{
+  if (!self->alSourceID || !Arcadia_Real32Value_isFinite(thread, volume)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_OperationInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  // The volume is clamped to the gain range of the AL source and applied when the sound source is rendered next.
+  self->dirtyBits |= self->volume != volume ? VolumeDirty : 0;
+  self->volume = volume;
+}
+
+static Arcadia_Real32Value
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_getVolume
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  )
+{ return self->volume; }
+
+static Arcadia_Natural64Value
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_getNumberOfUnderruns
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* self
+  )
+{ return self->numberOfUnderruns; }
+
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource*
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext* backendContext,
+    Arcadia_Media_SampleStream* sampleStream
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  if (backendContext) Arcadia_ValueStack_pushObjectReferenceValue(thread, backendContext); else Arcadia_ValueStack_pushVoidValue(thread, Arcadia_VoidValue_Void);
+  if (sampleStream) Arcadia_ValueStack_pushObjectReferenceValue(thread, sampleStream); else Arcadia_ValueStack_pushVoidValue(thread, Arcadia_VoidValue_Void);
+  Arcadia_ValueStack_pushNatural8Value(thread, 2);
+  ARCADIA_CREATEOBJECT(Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource);
+}
@@ -0,0 +1,83 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_ENGINE_AUDIALS_IMPLEMENTATION_OPENAL_RESOURCES_STREAMINGSOUNDSOURCERESOURCE_H_INCLUDED)
+#define ARCADIA_ENGINE_AUDIALS_IMPLEMENTATION_OPENAL_RESOURCES_STREAMINGSOUNDSOURCERESOURCE_H_INCLUDED
+
+#include "Arcadia/Engine/Include.h"
+typedef struct Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext;
+
+#define AL_LIBTYPE_STATIC
+#include <AL/al.h>
+
+// The number of AL buffers in the ring of a streaming sound source.
+#define Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_NumberOfBuffers (4)
+
+// The number of samples per AL buffer of a streaming sound source.
+#define Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_BufferSize (4096)
+
+// A sound source which streams its samples from a sample stream.
+// The sound source keeps a ring of AL buffers queued on its AL source.
+// Whenever the sound source is rendered, the AL buffers processed by the AL source are unqueued,
+// refilled with the next samples of the sample stream, and queued again.
+// If the AL source stopped because it ran out of queued AL buffers while the sound source was playing, an underrun is counted and playback is resumed.
+// Changes to the volume and to looping are applied when the sound source is rendered next.
+//
+// The samples are generated on the thread which renders the sound source and not on a worker of Arcadia_ThreadPool:
+// - Only the AL buffers processed since the last render are refilled, usually one.
+//   At 48000 Hz, an AL buffer holds about 85 ms of samples and the ring of AL buffers about 340 ms.
+//   Hence rendering at a rate of 10 Hz or more keeps up.
+// - The sample stream and the sample block are not synchronized.
+//   A task forked in one render and joined in the next would require them to be locked against play, stop, and looping in between.
+//   In addition, the audio backend context does not own a thread pool.
+// If the number of underruns shows that rendering does not keep up, increase the number of AL buffers or their size first.
+//
+// The sound source does not depend on an audio device being present:
+// With OpenAL Soft, it can be exercised by selecting the null backend (ALSOFT_DRIVERS=null) or a loopback device.
+Arcadia_declareObjectType(u8"Arcadia.Engine.Audials.Implementation.OpenAL.StreamingSoundSourceResource", Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource,
+                          u8"Arcadia.Engine.Audials.Implementation.SoundSourceResource");
+
+struct Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResourceDispatch {
+  Arcadia_Engine_Audials_Implementation_SoundSourceResourceDispatch _parent;
+};
+
+struct Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource {
+  Arcadia_Engine_Audials_Implementation_SoundSourceResource _parent;
+  Arcadia_Media_SampleStream* sampleStream;
+  Arcadia_BooleanValue isLooping;
+  Arcadia_Real32Value volume;
+  Arcadia_Natural8Value dirtyBits;
+  // Arcadia_BooleanValue_True if playback was requested and was neither paused, stopped, nor did it reach the end of the sample stream.
+  Arcadia_BooleanValue isPlaying;
+  // The number of underruns.
+  Arcadia_Natural64Value numberOfUnderruns;
+  // Unmanaged memory for Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_BufferSize samples.
+  Arcadia_Natural8Value* block;
+  // The AL buffers not queued on the AL source.
+  ALuint alFreeBufferIDs[Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_NumberOfBuffers];
+  Arcadia_SizeValue numberOfFreeBuffers;
+  ALuint alBufferIDs[Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_NumberOfBuffers];
+  ALuint alSourceID;
+};
+
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource*
+Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext* backendContext,
+    Arcadia_Media_SampleStream* sampleStream
+  );
+
+#endif // ARCADIA_ENGINE_AUDIALS_IMPLEMENTATION_OPENAL_RESOURCES_STREAMINGSOUNDSOURCERESOURCE_H_INCLUDED
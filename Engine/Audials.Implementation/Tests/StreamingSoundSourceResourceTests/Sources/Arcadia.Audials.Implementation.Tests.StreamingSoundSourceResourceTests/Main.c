@@ -0,0 +1,313 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "Arcadia/Audials/Implementation/OpenAL/BackendContext.h"
+#include "Arcadia/Audials/Implementation/OpenAL/Resources/StreamingSoundSourceResource.h"
+#include "Arcadia/Media/Include.h"
+
+#define NumberOfBuffers Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_NumberOfBuffers
+#define BufferSize Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_BufferSize
+
+// The maximum time, in milliseconds, to wait for the AL source to process AL buffers.
+#define Timeout (5000)
+
+// Select the "null" device of OpenAL Soft.
+// The "null" device mixes in real time like any other device but does not output the samples.
+static void
+selectNullDevice
+  (
+  )
+{
+#if Arcadia_Configuration_OperatingSystem == Arcadia_Configuration_OperatingSystem_Windows
+  _putenv_s("ALSOFT_DRIVERS", "null");
+#else
+  setenv("ALSOFT_DRIVERS", "null", 1);
+#endif
+}
+
+typedef struct Fixture {
+  Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext* backendContext;
+  Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource* resource;
+} Fixture;
+
+// Create a backend context and a streaming sound source resource for a sine wave of the specified length, in seconds, and sample rate, in Hz.
+static void
+Fixture_initialize
+  (
+    Arcadia_Thread* thread,
+    Fixture* self,
+    Arcadia_Integer32Value length,
+    Arcadia_Integer32Value sampleRate,
+    Arcadia_BooleanValue isLooping
+  )
+{
+  self->backendContext = Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext_create(thread);
+  Arcadia_Media_DSP* dsp = (Arcadia_Media_DSP*)Arcadia_Media_DSP_SineWave_create(thread, 440);
+  Arcadia_Media_SampleStream* sampleStream = Arcadia_Media_SampleStream_create(thread, dsp, length, sampleRate, Arcadia_Media_SampleFormat_Integer16);
+  self->resource = (Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource*)
+    Arcadia_Engine_Audials_BackendContext_createStreamingSoundSourceResource(thread, (Arcadia_Engine_Audials_BackendContext*)self->backendContext, sampleStream);
+  Arcadia_Engine_Audials_Implementation_Resource_ref(thread, (Arcadia_Engine_Audials_Implementation_Resource*)self->resource);
+  Arcadia_Engine_Audials_Implementation_SoundSourceResource_setIsLooping(thread, (Arcadia_Engine_Audials_Implementation_SoundSourceResource*)self->resource, isLooping);
+  Arcadia_Engine_Audials_Implementation_Resource_load(thread, (Arcadia_Engine_Audials_Implementation_Resource*)self->resource);
+}
+
+// Release the streaming sound source resource and let the backend context unload it.
+static void
+Fixture_uninitialize
+  (
+    Arcadia_Thread* thread,
+    Fixture* self
+  )
+{
+  Arcadia_Engine_Audials_Implementation_Resource_unref(thread, (Arcadia_Engine_Audials_Implementation_Resource*)self->resource);
+  Arcadia_Engine_BackendContext_update(thread, (Arcadia_Engine_BackendContext*)self->backendContext);
+  Arcadia_Tests_assertTrue(thread, 0 == self->resource->alSourceID);
+  self->resource = NULL;
+  self->backendContext = NULL;
+}
+
+static void
+render
+  (
+    Arcadia_Thread* thread,
+    Fixture* self
+  )
+{ Arcadia_Engine_Audials_Implementation_Resource_render(thread, (Arcadia_Engine_Audials_Implementation_Resource*)self->resource); }
+
+static Arcadia_BooleanValue
+isPlaying
+  (
+    Arcadia_Thread* thread,
+    Fixture* self
+  )
+{ return Arcadia_Engine_Audials_Implementation_SoundSourceResource_isPlaying(thread, (Arcadia_Engine_Audials_Implementation_SoundSourceResource*)self->resource); }
+
+static Arcadia_Natural64Value
+getNumberOfUnderruns
+  (
+    Arcadia_Thread* thread,
+    Fixture* self
+  )
+{ return Arcadia_Engine_Audials_Implementation_SoundSourceResource_getNumberOfUnderruns(thread, (Arcadia_Engine_Audials_Implementation_SoundSourceResource*)self->resource); }
+
+static ALint
+getSourceInteger
+  (
+    Arcadia_Thread* thread,
+    Fixture* self,
+    ALenum name
+  )
+{
+  ALint value = 0;
+  alGetSourcei(self->resource->alSourceID, name, &value);
+  Arcadia_Tests_assertTrue(thread, AL_NO_ERROR == alGetError());
+  return value;
+}
+
+// Loading fills and queues all AL buffers.
+// While playing, rendering unqueues the processed AL buffers and refills and queues them with the next samples.
+static void
+refillTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Fixture fixture;
+  Fixture_initialize(thread, &fixture, 2, 48000, Arcadia_BooleanValue_False);
+  Arcadia_Media_SampleStream* sampleStream = fixture.resource->sampleStream;
+
+  Arcadia_Tests_assertTrue(thread, 0 == fixture.resource->numberOfFreeBuffers);
+  Arcadia_Tests_assertTrue(thread, NumberOfBuffers == getSourceInteger(thread, &fixture, AL_BUFFERS_QUEUED));
+  Arcadia_Tests_assertTrue(thread, NumberOfBuffers * BufferSize == sampleStream->position);
+  Arcadia_Tests_assertTrue(thread, !isPlaying(thread, &fixture));
+
+  Arcadia_Engine_Audials_Implementation_SoundSourceResource_play(thread, (Arcadia_Engine_Audials_Implementation_SoundSourceResource*)fixture.resource);
+  Arcadia_Tests_assertTrue(thread, isPlaying(thread, &fixture));
+  // Wait until at least two AL buffers were processed, refilled, and queued again.
+  Arcadia_Natural64Value start = Arcadia_getTickCount(thread);
+  while (sampleStream->position < (NumberOfBuffers + 2) * BufferSize && Arcadia_getTickCount(thread) - start < Timeout) {
+    render(thread, &fixture);
+  }
+  Arcadia_Tests_assertTrue(thread, (NumberOfBuffers + 2) * BufferSize <= sampleStream->position);
+  Arcadia_Tests_assertTrue(thread, 0 == fixture.resource->numberOfFreeBuffers);
+  Arcadia_Tests_assertTrue(thread, NumberOfBuffers == getSourceInteger(thread, &fixture, AL_BUFFERS_QUEUED));
+  Arcadia_Tests_assertTrue(thread, isPlaying(thread, &fixture));
+
+  // Stopping rewinds the sample stream and refills all AL buffers.
+  Arcadia_Engine_Audials_Implementation_SoundSourceResource_stop(thread, (Arcadia_Engine_Audials_Implementation_SoundSourceResource*)fixture.resource);
+  Arcadia_Tests_assertTrue(thread, !isPlaying(thread, &fixture));
+  Arcadia_Tests_assertTrue(thread, NumberOfBuffers * BufferSize == sampleStream->position);
+  Arcadia_Tests_assertTrue(thread, NumberOfBuffers == getSourceInteger(thread, &fixture, AL_BUFFERS_QUEUED));
+
+  Fixture_uninitialize(thread, &fixture);
+}
+
+// A sample stream of 8000 samples fills one full AL buffer and one partial AL buffer.
+// If looping, the sample stream is rewound when its end is reached such that all AL buffers are filled completely.
+static void
+loopingTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Fixture fixture;
+  Fixture_initialize(thread, &fixture, 1, 8000, Arcadia_BooleanValue_True);
+  Arcadia_Tests_assertTrue(thread, 0 == fixture.resource->numberOfFreeBuffers);
+  Arcadia_Tests_assertTrue(thread, NumberOfBuffers == getSourceInteger(thread, &fixture, AL_BUFFERS_QUEUED));
+  // 4 * 4096 = 16384 samples were read: Two times all 8000 samples and the first 384 samples.
+  Arcadia_Tests_assertTrue(thread, NumberOfBuffers * BufferSize - 2 * 8000 == fixture.resource->sampleStream->position);
+  for (Arcadia_SizeValue i = 0; i < NumberOfBuffers; ++i) {
+    ALint size = 0;
+    alGetBufferi(fixture.resource->alBufferIDs[i], AL_SIZE, &size);
+    Arcadia_Tests_assertTrue(thread, AL_NO_ERROR == alGetError());
+    Arcadia_Tests_assertTrue(thread, 2 * BufferSize == size);
+  }
+  Fixture_uninitialize(thread, &fixture);
+}
+
+// If not looping, playback ends when the AL source has processed all samples, which is not an underrun.
+static void
+endOfStreamTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Fixture fixture;
+  Fixture_initialize(thread, &fixture, 1, 8000, Arcadia_BooleanValue_False);
+  Arcadia_Tests_assertTrue(thread, NumberOfBuffers - 2 == fixture.resource->numberOfFreeBuffers);
+  Arcadia_Tests_assertTrue(thread, 2 == getSourceInteger(thread, &fixture, AL_BUFFERS_QUEUED));
+  Arcadia_Tests_assertTrue(thread, Arcadia_Media_SampleStream_isAtEnd(thread, fixture.resource->sampleStream));
+
+  Arcadia_Engine_Audials_Implementation_SoundSourceResource_play(thread, (Arcadia_Engine_Audials_Implementation_SoundSourceResource*)fixture.resource);
+  Arcadia_Natural64Value start = Arcadia_getTickCount(thread);
+  while (isPlaying(thread, &fixture) && Arcadia_getTickCount(thread) - start < Timeout) {
+    render(thread, &fixture);
+  }
+  Arcadia_Tests_assertTrue(thread, !isPlaying(thread, &fixture));
+  Arcadia_Tests_assertTrue(thread, NumberOfBuffers == fixture.resource->numberOfFreeBuffers);
+  Arcadia_Tests_assertTrue(thread, 0 == getNumberOfUnderruns(thread, &fixture));
+
+  // Playing again starts from the beginning.
+  Arcadia_Engine_Audials_Implementation_SoundSourceResource_play(thread, (Arcadia_Engine_Audials_Implementation_SoundSourceResource*)fixture.resource);
+  Arcadia_Tests_assertTrue(thread, isPlaying(thread, &fixture));
+  Arcadia_Tests_assertTrue(thread, NumberOfBuffers - 2 == fixture.resource->numberOfFreeBuffers);
+  Arcadia_Tests_assertTrue(thread, 2 == getSourceInteger(thread, &fixture, AL_BUFFERS_QUEUED));
+
+  Fixture_uninitialize(thread, &fixture);
+}
+
+// Changes to the volume are applied when the sound source is rendered.
+// The volume is clamped to the gain range of the AL source.
+static void
+volumeTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Fixture fixture;
+  Fixture_initialize(thread, &fixture, 1, 8000, Arcadia_BooleanValue_False);
+  ALfloat gain = 0.f;
+
+  Arcadia_Engine_Audials_Implementation_SoundSourceResource_setVolume(thread, (Arcadia_Engine_Audials_Implementation_SoundSourceResource*)fixture.resource, 0.5f);
+  render(thread, &fixture);
+  alGetSourcef(fixture.resource->alSourceID, AL_GAIN, &gain);
+  Arcadia_Tests_assertTrue(thread, AL_NO_ERROR == alGetError());
+  Arcadia_Tests_assertTrue(thread, 0.5f == gain);
+
+  ALfloat maximumGain = 0.f;
+  alGetSourcef(fixture.resource->alSourceID, AL_MAX_GAIN, &maximumGain);
+  Arcadia_Tests_assertTrue(thread, AL_NO_ERROR == alGetError());
+  Arcadia_Engine_Audials_Implementation_SoundSourceResource_setVolume(thread, (Arcadia_Engine_Audials_Implementation_SoundSourceResource*)fixture.resource, maximumGain + 1.f);
+  render(thread, &fixture);
+  alGetSourcef(fixture.resource->alSourceID, AL_GAIN, &gain);
+  Arcadia_Tests_assertTrue(thread, AL_NO_ERROR == alGetError());
+  Arcadia_Tests_assertTrue(thread, maximumGain == gain);
+  Arcadia_Tests_assertTrue(thread, maximumGain == Arcadia_Engine_Audials_Implementation_SoundSourceResource_getVolume(thread, (Arcadia_Engine_Audials_Implementation_SoundSourceResource*)fixture.resource));
+
+  Fixture_uninitialize(thread, &fixture);
+}
+
+// If the AL source stops while AL buffers are queued, then an underrun is counted and playback is resumed.
+// Pausing is not an underrun.
+static void
+underrunTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Fixture fixture;
+  Fixture_initialize(thread, &fixture, 2, 48000, Arcadia_BooleanValue_False);
+
+  Arcadia_Engine_Audials_Implementation_SoundSourceResource_play(thread, (Arcadia_Engine_Audials_Implementation_SoundSourceResource*)fixture.resource);
+  Arcadia_Tests_assertTrue(thread, 0 == getNumberOfUnderruns(thread, &fixture));
+
+  // Simulate the AL source running out of AL buffers.
+  alSourceStop(fixture.resource->alSourceID);
+  Arcadia_Tests_assertTrue(thread, AL_NO_ERROR == alGetError());
+  render(thread, &fixture);
+  Arcadia_Tests_assertTrue(thread, 1 == getNumberOfUnderruns(thread, &fixture));
+  Arcadia_Tests_assertTrue(thread, isPlaying(thread, &fixture));
+  Arcadia_Tests_assertTrue(thread, AL_PLAYING == getSourceInteger(thread, &fixture, AL_SOURCE_STATE));
+  Arcadia_Tests_assertTrue(thread, 0 == fixture.resource->numberOfFreeBuffers);
+
+  alSourceStop(fixture.resource->alSourceID);
+  Arcadia_Tests_assertTrue(thread, AL_NO_ERROR == alGetError());
+  render(thread, &fixture);
+  Arcadia_Tests_assertTrue(thread, 2 == getNumberOfUnderruns(thread, &fixture));
+
+  Arcadia_Engine_Audials_Implementation_SoundSourceResource_pause(thread, (Arcadia_Engine_Audials_Implementation_SoundSourceResource*)fixture.resource);
+  render(thread, &fixture);
+  Arcadia_Tests_assertTrue(thread, 2 == getNumberOfUnderruns(thread, &fixture));
+  Arcadia_Tests_assertTrue(thread, !isPlaying(thread, &fixture));
+  Arcadia_Tests_assertTrue(thread, AL_PAUSED == getSourceInteger(thread, &fixture, AL_SOURCE_STATE));
+
+  Fixture_uninitialize(thread, &fixture);
+}
+
+int
+main
+  (
+    int argc,
+    char **argv
+  )
+{
+  selectNullDevice();
+  // Skip the tests if OpenAL is not available, for example if the "null" device was not compiled into OpenAL Soft.
+  ALCdevice* alcDevice = alcOpenDevice(NULL);
+  if (!alcDevice) {
+    fprintf(stdout, "OpenAL is not available, skipping tests\n");
+    return EXIT_SUCCESS;
+  }
+  alcCloseDevice(alcDevice);
+  if (!Arcadia_Tests_safeExecute(&refillTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&loopingTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&endOfStreamTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&underrunTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&volumeTests)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
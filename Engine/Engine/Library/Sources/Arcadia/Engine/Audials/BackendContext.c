@@ -96,3 +96,12 @@ Arcadia_Engine_Audials_BackendContext_createSoundSourceResource
     Arcadia_Media_SampleBuffer* sampleBuffer
   )
 { Arcadia_VirtualCallWithReturn(Arcadia_Engine_Audials_BackendContext, createSoundSourceResource, self, sampleBuffer); }
+
+Arcadia_Engine_Audials_Implementation_SoundSourceResource*
+Arcadia_Engine_Audials_BackendContext_createStreamingSoundSourceResource
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_BackendContext* self,
+    Arcadia_Media_SampleStream* sampleStream
+  )
+{ Arcadia_VirtualCallWithReturn(Arcadia_Engine_Audials_BackendContext, createStreamingSoundSourceResource, self, sampleStream); }
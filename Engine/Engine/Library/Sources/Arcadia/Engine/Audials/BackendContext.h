@@ -37,6 +37,14 @@ struct Arcadia_Engine_Audials_BackendContextDispatch {
       Arcadia_Engine_Audials_BackendContext* self,
       Arcadia_Media_SampleBuffer* sampleBuffer
     );
+
+  Arcadia_Engine_Audials_Implementation_SoundSourceResource*
+  (*createStreamingSoundSourceResource)
+    (
+      Arcadia_Thread* thread,
+      Arcadia_Engine_Audials_BackendContext* self,
+      Arcadia_Media_SampleStream* sampleStream
+    );
 };
 
 struct Arcadia_Engine_Audials_BackendContext {
@@ -51,4 +59,14 @@ Arcadia_Engine_Audials_BackendContext_createSoundSourceResource
     Arcadia_Media_SampleBuffer* sampleBuffer
   );
 
+// Create a sound source resource which streams its samples from the specified sample stream.
+// Only a few blocks of samples are generated ahead of the playback position.
+Arcadia_Engine_Audials_Implementation_SoundSourceResource*
+Arcadia_Engine_Audials_BackendContext_createStreamingSoundSourceResource
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_BackendContext* self,
+    Arcadia_Media_SampleStream* sampleStream
+  );
+
 #endif // ARCADIA_ENGINE_AUDIALS_BACKENDCONTEXT_H_INCLUDED
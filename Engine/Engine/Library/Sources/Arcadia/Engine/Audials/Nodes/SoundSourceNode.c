@@ -242,6 +242,9 @@ makeDSP
     return (Arcadia_Media_DSP*)Arcadia_Media_DSP_SineWave_create(thread, sineWaveDefinition->frequency); // TODO: Unchecked cast from Natural32 to Integer32.
   } else if (Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)definition, _Arcadia_ADL_WhiteNoiseDefinition_getType(thread))) {
     return (Arcadia_Media_DSP*)Arcadia_Media_DSP_WhiteNoise_create(thread);
+  } else if (Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)definition, _Arcadia_ADL_SawtoothWaveDefinition_getType(thread))) {
+    Arcadia_ADL_SawtoothWaveDefinition* sawtoothWaveDefinition = (Arcadia_ADL_SawtoothWaveDefinition*)definition;
+    return (Arcadia_Media_DSP*)Arcadia_Media_DSP_SawtoothWave_create(thread, sawtoothWaveDefinition->frequency);
   } else {
     Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
     Arcadia_Thread_jump(thread);
@@ -260,19 +263,29 @@ Arcadia_Engine_Audials_SoundSourceNode_renderImpl
       Arcadia_Engine_Audials_BackendContext* backendContext = self->backendContext;
 
       // (1) sound wave
-      Arcadia_Integer32Value sampleRate = 44100;
-      Arcadia_Media_SampleBuffer* sampleBuffer = Arcadia_Media_SampleBuffer_create(thread, 2, sampleRate, Arcadia_Media_SampleFormat_Integer16);
+      // The samples are streamed: Only a few blocks of samples are generated ahead of the playback position.
+      // The samples of a definition loaded from an asset pack were baked and are read from the pack.
       Arcadia_ADL_SampleBufferDefinition* sampleBufferSource = ((Arcadia_Engine_Audials_SoundSourceNode*)self)->source;
-      Arcadia_Media_DSP* dsp = makeDSP(thread, sampleBufferSource->dsp);
-      Arcadia_Media_SampleBuffer_fill(thread, sampleBuffer, dsp);
+      Arcadia_Media_SampleStream* sampleStream = NULL;
+      if (sampleBufferSource->samples) {
+        sampleStream = Arcadia_Media_SampleStream_createFromPackEntry(thread, sampleBufferSource->samples);
+      } else {
+        if (sampleBufferSource->duration > Arcadia_Integer32Value_Maximum || sampleBufferSource->sampleRate > Arcadia_Integer32Value_Maximum) {
+          Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+          Arcadia_Thread_jump(thread);
+        }
+        Arcadia_Media_DSP* dsp = makeDSP(thread, sampleBufferSource->dsp);
+        sampleStream = Arcadia_Media_SampleStream_create(thread, dsp, (Arcadia_Integer32Value)sampleBufferSource->duration, (Arcadia_Integer32Value)sampleBufferSource->sampleRate,
+                                                         (Arcadia_Media_SampleFormat)sampleBufferSource->sampleFormat);
+      }
 
       // (2) sound source
       self->soundSourceResource =
-        Arcadia_Engine_Audials_BackendContext_createSoundSourceResource
+        Arcadia_Engine_Audials_BackendContext_createStreamingSoundSourceResource
           (
             thread,
             (Arcadia_Engine_Audials_BackendContext*)backendContext,
-            sampleBuffer
+            sampleStream
           );
       Arcadia_Engine_Audials_Implementation_Resource_ref(thread, (Arcadia_Engine_Audials_Implementation_Resource*)self->soundSourceResource);
     }
@@ -172,3 +172,11 @@ Arcadia_Engine_Audials_Implementation_SoundSourceResource_getVolume
     Arcadia_Engine_Audials_Implementation_SoundSourceResource* self
   )
 { Arcadia_VirtualCallWithReturn(Arcadia_Engine_Audials_Implementation_SoundSourceResource, getVolume, self); }
+
+Arcadia_Natural64Value
+Arcadia_Engine_Audials_Implementation_SoundSourceResource_getNumberOfUnderruns
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_SoundSourceResource* self
+  )
+{ Arcadia_VirtualCallWithReturn(Arcadia_Engine_Audials_Implementation_SoundSourceResource, getNumberOfUnderruns, self); }
@@ -33,6 +33,7 @@ struct Arcadia_Engine_Audials_Implementation_SoundSourceResourceDispatch {
   Arcadia_BooleanValue (*getIsLooping)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_SoundSourceResource*);
   void (*setVolume)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_SoundSourceResource*, Arcadia_Real32Value);
   Arcadia_Real32Value(*getVolume)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_SoundSourceResource*);
+  Arcadia_Natural64Value(*getNumberOfUnderruns)(Arcadia_Thread*, Arcadia_Engine_Audials_Implementation_SoundSourceResource*);
 };
 
 struct Arcadia_Engine_Audials_Implementation_SoundSourceResource {
@@ -97,4 +98,14 @@ Arcadia_Engine_Audials_Implementation_SoundSourceResource_getVolume
     Arcadia_Engine_Audials_Implementation_SoundSourceResource* self
   );
 
+// Get the number of underruns of this sound source.
+// An underrun occurs if a streaming sound source runs out of queued samples while it is playing.
+// The return value is always 0 for sound sources which are not streaming.
+Arcadia_Natural64Value
+Arcadia_Engine_Audials_Implementation_SoundSourceResource_getNumberOfUnderruns
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Audials_Implementation_SoundSourceResource* self
+  );
+
 #endif // ARCADIA_ENGINE_AUDIALS_IMPLEMENTATION_RESOURCES_SOUNDSOURCERESOURCE_H_INCLUDED
@@ -32,6 +32,13 @@ Arcadia_Engine_initializeDispatchImpl
     Arcadia_EngineDispatch* self
   );
 
+static void
+Arcadia_Engine_destructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine* self
+  );
+
 static void
 Arcadia_Engine_visitImpl
   (
@@ -39,6 +46,13 @@ Arcadia_Engine_visitImpl
     Arcadia_Engine* self
   );
 
+static void
+Arcadia_Engine_visitEvent
+  (
+    Arcadia_Thread* thread,
+    void* event
+  );
+
 static void
 Arcadia_Engine_destroyCallback
   (
@@ -55,6 +69,7 @@ Arcadia_Engine_create
 static const Arcadia_ObjectType_Operations _objectTypeOperations = {
   Arcadia_ObjectType_Operations_Initializer,
   .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_Engine_constructImpl,
+  .destruct = (Arcadia_Object_DestructCallbackFunction*)&Arcadia_Engine_destructImpl,
   .visit = (Arcadia_Object_VisitCallbackFunction*)&Arcadia_Engine_visitImpl,
   .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_Engine_initializeDispatchImpl,
 };
@@ -95,7 +110,7 @@ Arcadia_Engine_constructImpl
   self->audialsBackendContext = NULL;
   self->audialsNodeFactory = NULL;
 
-  self->events = (Arcadia_Deque*)Arcadia_ArrayDeque_create(thread);
+  self->events = Arcadia_MultiProducerQueue_create(thread, Arcadia_Engine_EventQueueCapacity, Arcadia_MultiProducerQueue_OverflowPolicy_Reject);
 
   Arcadia_LeaveConstructor(Arcadia_Engine);
 }
@@ -108,6 +123,19 @@ Arcadia_Engine_initializeDispatchImpl
   )
 {/*Intentionally empty.*/}
 
+static void
+Arcadia_Engine_destructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine* self
+  )
+{
+  if (self->events) {
+    Arcadia_MultiProducerQueue_destroy(thread, self->events);
+    self->events = NULL;
+  }
+}
+
 static void
 Arcadia_Engine_visitImpl
   (
@@ -142,10 +170,18 @@ Arcadia_Engine_visitImpl
   }
 
   if (self->events) {
-    Arcadia_Object_visit(thread, (Arcadia_Object*)self->events);
+    Arcadia_MultiProducerQueue_visit(thread, self->events, &Arcadia_Engine_visitEvent);
   }
 }
 
+static void
+Arcadia_Engine_visitEvent
+  (
+    Arcadia_Thread* thread,
+    void* event
+  )
+{ Arcadia_Object_visit(thread, (Arcadia_Object*)event); }
+
 static void
 Arcadia_Engine_destroyCallback
   (
@@ -175,7 +211,11 @@ Arcadia_Engine_enqueEvent
     Arcadia_Engine_Event* event
   )
 {
-  Arcadia_Deque_insertBack(thread, self->events, Arcadia_Value_makeObjectReferenceValue(event));
+  if (!event) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_MultiProducerQueue_enqueue(thread, self->events, event);
 }
 
 Arcadia_Engine_Event*
@@ -184,15 +224,26 @@ Arcadia_Engine_dequeEvent
     Arcadia_Thread* thread,
     Arcadia_Engine* self
   )
-{
-  if (Arcadia_Collection_isEmpty(thread, (Arcadia_Collection*)self->events)) {
-    return NULL;
-  }
-  Arcadia_Value eventValue = Arcadia_Deque_getFront(thread, self->events);
-  Arcadia_Deque_removeFront(thread, self->events);
-  Arcadia_Engine_Event* event = (Arcadia_Engine_Event*)Arcadia_Value_getObjectReferenceValue(&eventValue);
-  return event;
-}
+{ return (Arcadia_Engine_Event*)Arcadia_MultiProducerQueue_dequeue(thread, self->events); }
+
+Arcadia_SizeValue
+Arcadia_Engine_dequeEvents
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine* self,
+    Arcadia_Engine_Event** events,
+    Arcadia_SizeValue maximumNumberOfEvents
+  )
+{ return Arcadia_MultiProducerQueue_dequeueBatch(thread, self->events, (void**)events, maximumNumberOfEvents); }
+
+void
+Arcadia_Engine_getEventQueueStatistics
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine* self,
+    Arcadia_MultiProducerQueue_Statistics* statistics
+  )
+{ Arcadia_MultiProducerQueue_getStatistics(thread, self->events, statistics); }
 
 void
 Arcadia_Engine_update
@@ -65,13 +65,21 @@ struct Arcadia_Engine {
   Arcadia_Engine_NodeFactory* audialsNodeFactory;
 
   /// @brief The event queue.
-  Arcadia_Deque* events;
+  /// Events can be enqueued by any thread and are dequeued by the main thread.
+  Arcadia_MultiProducerQueue* events;
 };
 
+/// @brief The capacity of the event queue of an engine.
+#define Arcadia_Engine_EventQueueCapacity (4096)
+
 /// @brief Enque an event to this application.
 /// @param thread A pointer to this thread.
 /// @param self A pointer to this application.
 /// @param event A pointer to the event.
+/// @remarks
+/// This function can be invoked by any thread attached to the process.
+/// If the event queue is full, the event is dropped and counted in the statistics of the event queue.
+/// The event must be reachable from the value stack of the calling thread or locked until this function returns.
 void
 Arcadia_Engine_enqueEvent
   (
@@ -84,6 +92,7 @@ Arcadia_Engine_enqueEvent
 /// @param thread A pointer to this thread.
 /// @param self A pointer to this engine.
 /// @return A pointer to the event (if there is an event), a null pointer otherwise.
+/// @remarks This function must only be invoked by the main thread.
 Arcadia_Engine_Event*
 Arcadia_Engine_dequeEvent
   (
@@ -91,6 +100,37 @@ Arcadia_Engine_dequeEvent
     Arcadia_Engine* self
   );
 
+/// @brief Deque up to the specified number of events from this engine.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this engine.
+/// @param events A pointer to an array of @a maximumNumberOfEvents pointers receiving the events.
+/// @param maximumNumberOfEvents The maximum number of events to deque.
+/// @return The number of events dequed.
+/// @remarks
+/// This function must only be invoked by the main thread.
+/// The events are not reachable from the engine anymore.
+/// They must be made reachable from the value stack of the calling thread or be locked if they are required after the next safepoint.
+Arcadia_SizeValue
+Arcadia_Engine_dequeEvents
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine* self,
+    Arcadia_Engine_Event** events,
+    Arcadia_SizeValue maximumNumberOfEvents
+  );
+
+/// @brief Get the statistics of the event queue of this engine.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this engine.
+/// @param statistics A pointer to the statistics receiving the statistics.
+void
+Arcadia_Engine_getEventQueueStatistics
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine* self,
+    Arcadia_MultiProducerQueue_Statistics* statistics
+  );
+
 /// @brief Update this engine.
 /// @param thread A pointer to this thread.
 /// @param self A pointer to this engine.
@@ -39,6 +39,7 @@
 #include "Arcadia/Engine/Visuals/Nodes/ModelNode.h"
 #include "Arcadia/Engine/Visuals/Nodes/PixelBufferNode.h"
 #include "Arcadia/Engine/Visuals/Nodes/RenderScene.h"
+#include "Arcadia/Engine/Visuals/Nodes/SceneNode.h"
 #include "Arcadia/Engine/Visuals/Nodes/TextureNode.h"
 #include "Arcadia/Engine/Visuals/Nodes/ViewportNode.h"
 
@@ -182,14 +182,15 @@ Arcadia_Engine_Visuals_MeshNode_constructImpl
     Arcadia_RuntimeByteArray* vertexAmbientUV = Arcadia_ADL_MeshDefinition_getVertexAmbientTextureCoordinates(thread, source);
     Arcadia_Real32Value const* vertexAmbientUVBytes = (Arcadia_Real32Value const*)Arcadia_RuntimeByteArray_getBytes(thread, vertexAmbientUV);
 
-    Arcadia_ByteArrayBuilder* temporary = Arcadia_ByteArrayBuilder_create(thread);
+    Arcadia_Real32ArrayList* temporary = Arcadia_Real32ArrayList_create(thread);
+    Arcadia_Real32ArrayList_ensureFreeCapacity(thread, temporary, self->vertexBuffer->numberOfVertices * 9);
     for (Arcadia_SizeValue i = 0, n = self->vertexBuffer->numberOfVertices; i < n; ++i) {
-      Arcadia_ByteArrayBuilder_insertBackBytes(thread, temporary, &vertexYZBytes[i * 3], sizeof(Arcadia_Real32Value) * 3);
-      Arcadia_ByteArrayBuilder_insertBackBytes(thread, temporary, &vertexAmbientRGBBytes[i * 4], sizeof(Arcadia_Real32Value) * 4);
-      Arcadia_ByteArrayBuilder_insertBackBytes(thread, temporary, &vertexAmbientUVBytes[i * 2], sizeof(Arcadia_Real32Value) * 2);
+      Arcadia_Real32ArrayList_insertBackMany(thread, temporary, &vertexYZBytes[i * 3], 3);
+      Arcadia_Real32ArrayList_insertBackMany(thread, temporary, &vertexAmbientRGBBytes[i * 4], 4);
+      Arcadia_Real32ArrayList_insertBackMany(thread, temporary, &vertexAmbientUVBytes[i * 2], 2);
     }
-    Arcadia_Memory_copy(thread, self->vertexBuffer->vertices, Arcadia_ByteArrayBuilder_getBytes(thread, temporary),
-                                                              Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, temporary));
+    Arcadia_Real32ArrayList_copyTo(thread, temporary, 0, Arcadia_Real32ArrayList_getSize(thread, temporary),
+                                   (Arcadia_Real32Value*)self->vertexBuffer->vertices);
     Arcadia_Thread_popJumpTarget(thread);
   } else {
     Arcadia_Thread_popJumpTarget(thread);
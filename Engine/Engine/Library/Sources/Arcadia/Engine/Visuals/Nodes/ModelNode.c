@@ -121,6 +121,9 @@ Arcadia_Engine_Visuals_ModelNode_constructImpl
   //
   self->modelResource = NULL;
   //
+  self->localToWorldMatrix = Arcadia_Math_Matrix4Real32_create(thread);
+  Arcadia_Math_Matrix4Real32_setIdentity(thread, self->localToWorldMatrix);
+  self->localToWorldMatrixDirty = Arcadia_BooleanValue_True;
 
   Arcadia_LeaveConstructor(Arcadia_Engine_Visuals_ModelNode);
 }
@@ -169,6 +172,9 @@ Arcadia_Engine_Visuals_ModelNode_visitImpl
   if (self->material) {
     Arcadia_Object_visit(thread, (Arcadia_Object*)self->material);
   }
+  if (self->localToWorldMatrix) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->localToWorldMatrix);
+  }
 }
 
 static void
@@ -193,6 +199,11 @@ Arcadia_Engine_Visuals_ModelNode_renderImpl
                                                                                               meshNode->vertexBufferResource,
                                                                                               materialNode->materialResource);
       Arcadia_Engine_Visuals_Implementation_Resource_ref(thread, (Arcadia_Engine_Visuals_Implementation_Resource*)self->modelResource);
+      self->localToWorldMatrixDirty = Arcadia_BooleanValue_True;
+    }
+    if (self->localToWorldMatrixDirty) {
+      Arcadia_Engine_Visuals_Implementation_ModelResource_setLocalToWorldMatrix(thread, self->modelResource, self->localToWorldMatrix);
+      self->localToWorldMatrixDirty = Arcadia_BooleanValue_False;
     }
   }
   // (4) Perform actual render to frame buffer.
@@ -242,3 +253,15 @@ Arcadia_Engine_Visuals_ModelNode_create
   Arcadia_ValueStack_pushNatural8Value(thread, 2);
   ARCADIA_CREATEOBJECT(Arcadia_Engine_Visuals_ModelNode);
 }
+
+void
+Arcadia_Engine_Visuals_ModelNode_setLocalToWorldMatrix
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_ModelNode* self,
+    Arcadia_Math_Matrix4Real32* localToWorldMatrix
+  )
+{
+  Arcadia_Math_Matrix4Real32_assign(thread, self->localToWorldMatrix, localToWorldMatrix);
+  self->localToWorldMatrixDirty = Arcadia_BooleanValue_True;
+}
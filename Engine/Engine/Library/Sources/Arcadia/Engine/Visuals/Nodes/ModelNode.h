@@ -45,6 +45,11 @@ struct Arcadia_Engine_Visuals_ModelNode {
   Arcadia_Engine_Visuals_BackendContext* backendContext;
   /// The model resource.
   Arcadia_Engine_Visuals_Implementation_ModelResource* modelResource;
+  /// The local to world matrix of this model.
+  /// The default value is the identity matrix.
+  Arcadia_Math_Matrix4Real32* localToWorldMatrix;
+  /// Non-zero if the local to world matrix was not yet passed to the model resource.
+  Arcadia_BooleanValue localToWorldMatrixDirty;
 };
 
 Arcadia_Engine_Visuals_ModelNode*
@@ -55,4 +60,16 @@ Arcadia_Engine_Visuals_ModelNode_create
     Arcadia_ADL_ModelDefinition* source
   );
 
+/// @brief Set the local to world matrix of this model node.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this model node.
+/// @param localToWorldMatrix A pointer to the local to world matrix.
+void
+Arcadia_Engine_Visuals_ModelNode_setLocalToWorldMatrix
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_ModelNode* self,
+    Arcadia_Math_Matrix4Real32* localToWorldMatrix
+  );
+
 #endif // ARCADIA_ENGINE_VISUALS_NODES_MODELNODE_H_INCLUDED
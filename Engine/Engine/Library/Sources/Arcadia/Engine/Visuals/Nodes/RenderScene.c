@@ -16,15 +16,15 @@
 #define ARCADIA_ENGINE_PRIVATE (1)
 #include "Arcadia/Engine/Visuals/Nodes/RenderScene.h"
 
-void
-Arcadia_Engine_Visuals_renderScene
+static void
+enterPass
   (
     Arcadia_Thread* thread,
     Arcadia_Engine_Visuals_EnterPassNode* enterPassNode,
-    Arcadia_Engine_Visuals_ModelNode* modelNode,
     Arcadia_Engine_Visuals_BackendContext* backendContext
   )
 {
+  Arcadia_Profiler_beginZone(thread, "enterPass");
   Arcadia_Engine_Node_setVisualsBackendContext(thread, (Arcadia_Engine_Node*)enterPassNode, (Arcadia_Engine_Visuals_BackendContext*)backendContext);
   if (enterPassNode->frameBufferNode) {
     // "rendering" the scene buffer activates it.
@@ -38,8 +38,42 @@ Arcadia_Engine_Visuals_renderScene
   // Render the enter pass node.
   // Pass mesh nodes to the enter pass node.
   Arcadia_Engine_Visuals_Node_render(thread, (Arcadia_Engine_Visuals_Node*)enterPassNode, (Arcadia_Engine_Visuals_EnterPassNode*)enterPassNode);
-  // Render the mesh node.
-  // TODO: Render multiple mesh nodes.
+  Arcadia_Profiler_endZone(thread);
+}
+
+void
+Arcadia_Engine_Visuals_renderScene
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_EnterPassNode* enterPassNode,
+    Arcadia_Engine_Visuals_ModelNode* modelNode,
+    Arcadia_Engine_Visuals_BackendContext* backendContext
+  )
+{
+  Arcadia_Profiler_beginZone(thread, "Arcadia_Engine_Visuals_renderScene");
+  enterPass(thread, enterPassNode, backendContext);
+  // Render the model node.
+  // Use Arcadia_Engine_Visuals_renderSceneNode to render multiple model nodes.
+  Arcadia_Profiler_beginZone(thread, "Arcadia_Engine_Visuals_ModelNode_render");
   Arcadia_Engine_Visuals_Node_render(thread, (Arcadia_Engine_Visuals_Node*)modelNode, enterPassNode);
+  Arcadia_Profiler_endZone(thread);
   // TODO: Render the leave pass node.
+  Arcadia_Profiler_endZone(thread);
+}
+
+void
+Arcadia_Engine_Visuals_renderSceneNode
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_EnterPassNode* enterPassNode,
+    Arcadia_Engine_Visuals_SceneNode* sceneNode,
+    Arcadia_Engine_Visuals_BackendContext* backendContext
+  )
+{
+  Arcadia_Profiler_beginZone(thread, "Arcadia_Engine_Visuals_renderSceneNode");
+  enterPass(thread, enterPassNode, backendContext);
+  // Render the scene node.
+  Arcadia_Engine_Node_setVisualsBackendContext(thread, (Arcadia_Engine_Node*)sceneNode, (Arcadia_Engine_Visuals_BackendContext*)backendContext);
+  Arcadia_Engine_Visuals_Node_render(thread, (Arcadia_Engine_Visuals_Node*)sceneNode, enterPassNode);
+  Arcadia_Profiler_endZone(thread);
 }
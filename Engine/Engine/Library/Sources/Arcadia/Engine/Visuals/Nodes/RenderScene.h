@@ -21,6 +21,7 @@
 #endif
 #include "Arcadia/Engine/Visuals/Nodes/EnterPassNode.h"
 #include "Arcadia/Engine/Visuals/Nodes/ModelNode.h"
+#include "Arcadia/Engine/Visuals/Nodes/SceneNode.h"
 
 void
 Arcadia_Engine_Visuals_renderScene
@@ -31,4 +32,16 @@ Arcadia_Engine_Visuals_renderScene
     Arcadia_Engine_Visuals_BackendContext* backendContext
   );
 
+// Render a scene node.
+// Unlike Arcadia_Engine_Visuals_renderScene, this renders many model nodes.
+// The model nodes outside of the view frustum are culled and the others are drawn sorted by their state.
+void
+Arcadia_Engine_Visuals_renderSceneNode
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_EnterPassNode* enterPassNode,
+    Arcadia_Engine_Visuals_SceneNode* sceneNode,
+    Arcadia_Engine_Visuals_BackendContext* backendContext
+  );
+
 #endif // ARCADIA_ENGINE_VISUALS_NODES_RENDERSCENE_H_INCLUDED
@@ -0,0 +1,454 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#define ARCADIA_ENGINE_PRIVATE (1)
+#include "Arcadia/Engine/Visuals/Nodes/SceneNode.h"
+
+#include "Arcadia/Engine/Include.h"
+#include <stdlib.h>
+
+// The local to world matrix of the object was recomputed in the current update.
+#define LocalToWorldMatrixUpdated (4)
+
+static void
+Arcadia_Engine_Visuals_SceneNode_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* self
+  );
+
+static void
+Arcadia_Engine_Visuals_SceneNode_destructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* self
+  );
+
+static void
+Arcadia_Engine_Visuals_SceneNode_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNodeDispatch* self
+  );
+
+static void
+Arcadia_Engine_Visuals_SceneNode_visitImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* self
+  );
+
+static void
+Arcadia_Engine_Visuals_SceneNode_renderImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* self,
+    Arcadia_Engine_Visuals_EnterPassNode* enterPassNode
+  );
+
+static void
+Arcadia_Engine_Visuals_SceneNode_setVisualsBackendContextImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* self,
+    Arcadia_Engine_Visuals_BackendContext* backendContext
+  );
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_Engine_Visuals_SceneNode_constructImpl,
+  .destruct = (Arcadia_Object_DestructCallbackFunction*)&Arcadia_Engine_Visuals_SceneNode_destructImpl,
+  .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_Engine_Visuals_SceneNode_initializeDispatchImpl,
+  .visit = (Arcadia_Object_VisitCallbackFunction*)&Arcadia_Engine_Visuals_SceneNode_visitImpl,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.Engine.Visuals.SceneNode", Arcadia_Engine_Visuals_SceneNode,
+                         u8"Arcadia.Engine.Visuals.Node", Arcadia_Engine_Visuals_Node,
+                         &_typeOperations);
+
+static void
+Arcadia_Engine_Visuals_SceneNode_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_Engine_Visuals_SceneNode);
+  if (1 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  self->objects = NULL;
+  self->draws = NULL;
+  self->numberOfObjects = 0;
+  self->capacity = 0;
+  self->statistics.numberOfObjects = 0;
+  self->statistics.numberOfCulledObjects = 0;
+  self->statistics.numberOfDraws = 0;
+  self->statistics.numberOfBatches = 0;
+  self->statistics.numberOfStateChanges = 0;
+  self->temporary = Arcadia_Math_Matrix4Real32_create(thread);
+  //
+  if (Arcadia_ValueStack_isVoidValue(thread, 1)) {
+    self->backendContext = NULL;
+  } else {
+    self->backendContext = Arcadia_ValueStack_getObjectReferenceValueChecked(thread, 1, _Arcadia_Engine_Visuals_BackendContext_getType(thread));
+    Arcadia_Object_lock(thread, (Arcadia_Object*)self->backendContext);
+  }
+  Arcadia_LeaveConstructor(Arcadia_Engine_Visuals_SceneNode);
+}
+
+static void
+Arcadia_Engine_Visuals_SceneNode_destructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* self
+  )
+{
+  if (self->draws) {
+    Arcadia_Memory_deallocateUnmanaged(thread, self->draws);
+    self->draws = NULL;
+  }
+  if (self->objects) {
+    Arcadia_Memory_deallocateUnmanaged(thread, self->objects);
+    self->objects = NULL;
+  }
+  if (self->backendContext) {
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)self->backendContext);
+    self->backendContext = NULL;
+  }
+}
+
+static void
+Arcadia_Engine_Visuals_SceneNode_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNodeDispatch* self
+  )
+{
+  ((Arcadia_Engine_Visuals_NodeDispatch*)self)->render = (void (*)(Arcadia_Thread*, Arcadia_Engine_Visuals_Node*, Arcadia_Engine_Visuals_EnterPassNode*)) & Arcadia_Engine_Visuals_SceneNode_renderImpl;
+  ((Arcadia_Engine_NodeDispatch*)self)->setVisualsBackendContext = (void (*)(Arcadia_Thread*, Arcadia_Engine_Node*, Arcadia_Engine_Visuals_BackendContext*)) & Arcadia_Engine_Visuals_SceneNode_setVisualsBackendContextImpl;
+}
+
+static void
+Arcadia_Engine_Visuals_SceneNode_visitImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* self
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < self->numberOfObjects; ++i) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->objects[i].modelNode);
+  }
+  if (self->temporary) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->temporary);
+  }
+}
+
+// Order draws by program, texture, and vertices.
+// Draws with the same key are ordered by the index of their objects such that the order does not depend on the sort algorithm.
+static int
+compareDraws
+  (
+    void const* x,
+    void const* y
+  )
+{
+  Arcadia_Engine_Visuals_SceneNodeDraw const* a = (Arcadia_Engine_Visuals_SceneNodeDraw const*)x;
+  Arcadia_Engine_Visuals_SceneNodeDraw const* b = (Arcadia_Engine_Visuals_SceneNodeDraw const*)y;
+  if (a->program != b->program) {
+    return a->program < b->program ? -1 : +1;
+  }
+  if (a->texture != b->texture) {
+    return (uintptr_t)a->texture < (uintptr_t)b->texture ? -1 : +1;
+  }
+  if (a->vertices != b->vertices) {
+    return (uintptr_t)a->vertices < (uintptr_t)b->vertices ? -1 : +1;
+  }
+  if (a->object != b->object) {
+    return a->object < b->object ? -1 : +1;
+  }
+  return 0;
+}
+
+static void
+update
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* self
+  )
+{
+  // A parent precedes its children.
+  // Hence the local to world matrix of the parent is up to date when the child is visited.
+  for (Arcadia_SizeValue i = 0; i < self->numberOfObjects; ++i) {
+    Arcadia_Engine_Visuals_SceneNodeObject* object = &self->objects[i];
+    Arcadia_Engine_Visuals_SceneNodeObject* parent = Arcadia_SizeValue_Maximum != object->parent ? &self->objects[object->parent] : NULL;
+    if ((object->dirty & Arcadia_Engine_Visuals_SceneNode_LocalToWorldMatrixDirty) || (parent && (parent->dirty & LocalToWorldMatrixUpdated))) {
+      if (parent) {
+        Arcadia_Math_Matrix4x4Real32Value_multiply(thread, &object->localToWorldMatrix, &parent->localToWorldMatrix, &object->localToParentMatrix);
+      } else {
+        object->localToWorldMatrix = object->localToParentMatrix;
+      }
+      Arcadia_Math_BoxReal32Value_transform(thread, &object->worldBounds, &object->localBounds, &object->localToWorldMatrix);
+      Arcadia_Math_SphereReal32Value_setFromBox(thread, &object->worldSphere, &object->worldBounds);
+      object->dirty &= ~Arcadia_Engine_Visuals_SceneNode_LocalToWorldMatrixDirty;
+      object->dirty |= Arcadia_Engine_Visuals_SceneNode_ModelNodeDirty | LocalToWorldMatrixUpdated;
+    }
+  }
+  for (Arcadia_SizeValue i = 0; i < self->numberOfObjects; ++i) {
+    self->objects[i].dirty &= ~LocalToWorldMatrixUpdated;
+  }
+}
+
+static void
+Arcadia_Engine_Visuals_SceneNode_renderImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* self,
+    Arcadia_Engine_Visuals_EnterPassNode* enterPassNode
+  )
+{
+  // (1) Update, cull, and sort.
+  Arcadia_Profiler_beginZone(thread, "Arcadia_Engine_Visuals_SceneNode_cull");
+  Arcadia_Engine_Visuals_CameraNode* cameraNode = enterPassNode->cameraNode;
+  if (cameraNode) {
+    Arcadia_Math_Matrix4x4Real32Value worldToView, worldToProjection;
+    Arcadia_Math_Matrix4Real32_getValue(thread, Arcadia_Engine_Visuals_CameraNode_getViewToProjectionMatrix(thread, cameraNode), &worldToProjection);
+    Arcadia_Math_Matrix4Real32_getValue(thread, Arcadia_Engine_Visuals_CameraNode_getWorldToViewMatrix(thread, cameraNode), &worldToView);
+    Arcadia_Math_Matrix4x4Real32Value_multiply(thread, &worldToProjection, &worldToProjection, &worldToView);
+    Arcadia_Engine_Visuals_SceneNode_cull(thread, self, &worldToProjection);
+  } else {
+    Arcadia_Engine_Visuals_SceneNode_cull(thread, self, NULL);
+  }
+  Arcadia_Profiler_endZone(thread);
+  Arcadia_Profiler_setCounter(thread, "SceneNode culled objects", (Arcadia_Integer64Value)self->statistics.numberOfCulledObjects);
+  Arcadia_Profiler_setCounter(thread, "SceneNode draws", (Arcadia_Integer64Value)self->statistics.numberOfDraws);
+  // (2) Issue the draws.
+  Arcadia_Profiler_beginZone(thread, "Arcadia_Engine_Visuals_SceneNode_draw");
+  for (Arcadia_SizeValue i = 0, n = self->statistics.numberOfDraws; i < n; ++i) {
+    Arcadia_Engine_Visuals_SceneNodeObject* object = &self->objects[self->draws[i].object];
+    if (object->dirty & Arcadia_Engine_Visuals_SceneNode_ModelNodeDirty) {
+      Arcadia_Math_Matrix4Real32_setValue(thread, self->temporary, &object->localToWorldMatrix);
+      Arcadia_Engine_Visuals_ModelNode_setLocalToWorldMatrix(thread, object->modelNode, self->temporary);
+      object->dirty &= ~Arcadia_Engine_Visuals_SceneNode_ModelNodeDirty;
+    }
+    Arcadia_Engine_Visuals_Node_render(thread, (Arcadia_Engine_Visuals_Node*)object->modelNode, enterPassNode);
+  }
+  Arcadia_Profiler_endZone(thread);
+}
+
+static void
+Arcadia_Engine_Visuals_SceneNode_setVisualsBackendContextImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* self,
+    Arcadia_Engine_Visuals_BackendContext* backendContext
+  )
+{
+  if (backendContext == self->backendContext) {
+    // Only change something if the backend context changes.
+    return;
+  }
+  if (backendContext) {
+    Arcadia_Object_lock(thread, (Arcadia_Object*)backendContext);
+  }
+  if (self->backendContext) {
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)self->backendContext);
+  }
+  self->backendContext = backendContext;
+  for (Arcadia_SizeValue i = 0; i < self->numberOfObjects; ++i) {
+    Arcadia_Engine_Node_setVisualsBackendContext(thread, (Arcadia_Engine_Node*)self->objects[i].modelNode, backendContext);
+  }
+}
+
+Arcadia_Engine_Visuals_SceneNode*
+Arcadia_Engine_Visuals_SceneNode_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_BackendContext* backendContext
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  if (backendContext) Arcadia_ValueStack_pushObjectReferenceValue(thread, backendContext); else Arcadia_ValueStack_pushVoidValue(thread, Arcadia_VoidValue_Void);
+  Arcadia_ValueStack_pushNatural8Value(thread, 1);
+  ARCADIA_CREATEOBJECT(Arcadia_Engine_Visuals_SceneNode);
+}
+
+Arcadia_SizeValue
+Arcadia_Engine_Visuals_SceneNode_addModelNode
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* self,
+    Arcadia_SizeValue parent,
+    Arcadia_Engine_Visuals_ModelNode* modelNode
+  )
+{
+  if (!modelNode || (Arcadia_SizeValue_Maximum != parent && parent >= self->numberOfObjects)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  if (self->numberOfObjects == self->capacity) {
+    if (self->capacity > Arcadia_SizeValue_Maximum / 2 / sizeof(Arcadia_Engine_Visuals_SceneNodeObject)) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_AllocationFailed);
+      Arcadia_Thread_jump(thread);
+    }
+    Arcadia_SizeValue newCapacity = self->capacity ? 2 * self->capacity : 8;
+    // If the second allocation fails, the first array is larger than required which is harmless.
+    if (self->objects) {
+      Arcadia_Memory_reallocateUnmanaged(thread, (void**)&self->objects, newCapacity * sizeof(Arcadia_Engine_Visuals_SceneNodeObject));
+    } else {
+      self->objects = Arcadia_Memory_allocateUnmanaged(thread, newCapacity * sizeof(Arcadia_Engine_Visuals_SceneNodeObject));
+    }
+    if (self->draws) {
+      Arcadia_Memory_reallocateUnmanaged(thread, (void**)&self->draws, newCapacity * sizeof(Arcadia_Engine_Visuals_SceneNodeDraw));
+    } else {
+      self->draws = Arcadia_Memory_allocateUnmanaged(thread, newCapacity * sizeof(Arcadia_Engine_Visuals_SceneNodeDraw));
+    }
+    self->capacity = newCapacity;
+  }
+  Arcadia_Engine_Visuals_SceneNodeObject* object = &self->objects[self->numberOfObjects];
+  object->modelNode = modelNode;
+  object->parent = parent;
+  object->dirty = Arcadia_Engine_Visuals_SceneNode_LocalToWorldMatrixDirty | Arcadia_Engine_Visuals_SceneNode_ModelNodeDirty;
+  Arcadia_Math_Matrix4x4Real32Value_setIdentity(thread, &object->localToParentMatrix);
+  Arcadia_Math_Matrix4x4Real32Value_setIdentity(thread, &object->localToWorldMatrix);
+  // Compute the bounds of the vertex positions.
+  Arcadia_Media_VertexBuffer* vertexBuffer = modelNode->mesh->vertexBuffer;
+  Arcadia_SizeValue offset = Arcadia_SizeValue_Maximum;
+  for (Arcadia_SizeValue i = 0, n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)vertexBuffer->vertexDescriptor->vertexElementDescriptors); i < n; ++i) {
+    Arcadia_Media_VertexElementDescriptor* vertexElementDescriptor = (Arcadia_Media_VertexElementDescriptor*)Arcadia_List_getObjectReferenceValueCheckedAt(thread, (Arcadia_List*)vertexBuffer->vertexDescriptor->vertexElementDescriptors, i, _Arcadia_Media_VertexElementDescriptor_getType(thread));
+    if (Arcadia_Media_VertexElementSemantics_PositionXYZ == vertexElementDescriptor->semantics) {
+      offset = vertexElementDescriptor->offset;
+      break;
+    }
+  }
+  if (Arcadia_SizeValue_Maximum == offset) {
+    Arcadia_Math_BoxReal32Value_setFromPoints(thread, &object->localBounds, NULL, 0, 0);
+  } else {
+    Arcadia_Math_BoxReal32Value_setFromPoints(thread, &object->localBounds, (Arcadia_Natural8Value const*)vertexBuffer->vertices + offset,
+                                              vertexBuffer->vertexDescriptor->stride, vertexBuffer->numberOfVertices);
+  }
+  object->worldBounds = object->localBounds;
+  Arcadia_Math_SphereReal32Value_setFromBox(thread, &object->worldSphere, &object->worldBounds);
+  if (self->backendContext) {
+    Arcadia_Engine_Node_setVisualsBackendContext(thread, (Arcadia_Engine_Node*)modelNode, self->backendContext);
+  }
+  return self->numberOfObjects++;
+}
+
+void
+Arcadia_Engine_Visuals_SceneNode_setLocalToParentMatrix
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* self,
+    Arcadia_SizeValue index,
+    Arcadia_Math_Matrix4x4Real32Value const* localToParentMatrix
+  )
+{
+  if (index >= self->numberOfObjects || !localToParentMatrix) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->objects[index].localToParentMatrix = *localToParentMatrix;
+  self->objects[index].dirty |= Arcadia_Engine_Visuals_SceneNode_LocalToWorldMatrixDirty;
+}
+
+void
+Arcadia_Engine_Visuals_SceneNode_getLocalToWorldMatrix
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* self,
+    Arcadia_SizeValue index,
+    Arcadia_Math_Matrix4x4Real32Value* localToWorldMatrix
+  )
+{
+  if (index >= self->numberOfObjects || !localToWorldMatrix) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  update(thread, self);
+  *localToWorldMatrix = self->objects[index].localToWorldMatrix;
+}
+
+void
+Arcadia_Engine_Visuals_SceneNode_cull
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* self,
+    Arcadia_Math_Matrix4x4Real32Value const* worldToProjectionMatrix
+  )
+{
+  update(thread, self);
+  // (1) Cull.
+  // The sphere test is cheaper and rejects most objects far outside of the frustum.
+  // The box test rejects objects close to the corners of the frustum.
+  Arcadia_Math_FrustumReal32Value frustum;
+  if (worldToProjectionMatrix) {
+    Arcadia_Math_FrustumReal32Value_setFromMatrix(thread, &frustum, worldToProjectionMatrix);
+  }
+  Arcadia_SizeValue numberOfDraws = 0;
+  for (Arcadia_SizeValue i = 0; i < self->numberOfObjects; ++i) {
+    Arcadia_Engine_Visuals_SceneNodeObject* object = &self->objects[i];
+    if (worldToProjectionMatrix) {
+      if (!Arcadia_Math_FrustumReal32Value_intersectsSphere(thread, &frustum, &object->worldSphere) ||
+          !Arcadia_Math_FrustumReal32Value_intersectsBox(thread, &frustum, &object->worldBounds)) {
+        continue;
+      }
+    }
+    Arcadia_ADL_MaterialDefinition* material = object->modelNode->material->source;
+    Arcadia_Engine_Visuals_SceneNodeDraw* draw = &self->draws[numberOfDraws++];
+    draw->program = (Arcadia_Natural32Value)material->ambientColorSource;
+    draw->texture = Arcadia_ADL_AmbientColorSource_Texture == material->ambientColorSource ? (void const*)material->ambientColorTexture->definition : NULL;
+    draw->vertices = (void const*)object->modelNode->mesh->source;
+    draw->object = i;
+  }
+  // (2) Sort.
+  qsort(self->draws, numberOfDraws, sizeof(Arcadia_Engine_Visuals_SceneNodeDraw), &compareDraws);
+  // (3) Count the batches and the state changes.
+  Arcadia_SizeValue numberOfBatches = 0, numberOfStateChanges = 0;
+  for (Arcadia_SizeValue i = 0; i < numberOfDraws; ++i) {
+    Arcadia_Engine_Visuals_SceneNodeDraw const* current = &self->draws[i];
+    Arcadia_Engine_Visuals_SceneNodeDraw const* previous = i > 0 ? &self->draws[i - 1] : NULL;
+    Arcadia_SizeValue changes = 0;
+    changes += (!previous || previous->program != current->program) ? 1 : 0;
+    changes += (current->texture && (!previous || previous->texture != current->texture)) ? 1 : 0;
+    changes += (!previous || previous->vertices != current->vertices) ? 1 : 0;
+    numberOfBatches += changes ? 1 : 0;
+    numberOfStateChanges += changes;
+  }
+  self->statistics.numberOfObjects = self->numberOfObjects;
+  self->statistics.numberOfCulledObjects = self->numberOfObjects - numberOfDraws;
+  self->statistics.numberOfDraws = numberOfDraws;
+  self->statistics.numberOfBatches = numberOfBatches;
+  self->statistics.numberOfStateChanges = numberOfStateChanges;
+}
+
+void
+Arcadia_Engine_Visuals_SceneNode_getStatistics
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* self,
+    Arcadia_Engine_Visuals_SceneNodeStatistics* statistics
+  )
+{ *statistics = self->statistics; }
@@ -0,0 +1,196 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_ENGINE_VISUALS_NODES_SCENENODE_H_INCLUDED)
+#define ARCADIA_ENGINE_VISUALS_NODES_SCENENODE_H_INCLUDED
+
+#if !defined(ARCADIA_ENGINE_PRIVATE) || 1 != ARCADIA_ENGINE_PRIVATE
+  #error("do not include directly, include `Arcadia/Engine/Include.h` instead")
+#endif
+#include "Arcadia/Engine/Visuals/Nodes/ModelNode.h"
+
+/// The local to world matrix of the object must be recomputed.
+#define Arcadia_Engine_Visuals_SceneNode_LocalToWorldMatrixDirty (1)
+/// The local to world matrix of the object was not yet passed to its model node.
+#define Arcadia_Engine_Visuals_SceneNode_ModelNodeDirty (2)
+
+/// An object of a scene node.
+typedef struct Arcadia_Engine_Visuals_SceneNodeObject {
+  /// The model node of this object.
+  Arcadia_Engine_Visuals_ModelNode* modelNode;
+  /// The index of the parent object or Arcadia_SizeValue_Maximum if this object has no parent.
+  Arcadia_SizeValue parent;
+  /// The dirty flags.
+  Arcadia_Natural8Value dirty;
+  /// The local to parent matrix.
+  /// The default value is the identity matrix.
+  Arcadia_Math_Matrix4x4Real32Value localToParentMatrix;
+  /// The local to world matrix.
+  /// This is the product of the local to world matrix of the parent and the local to parent matrix.
+  Arcadia_Math_Matrix4x4Real32Value localToWorldMatrix;
+  /// The bounds of the vertices of the mesh in local space.
+  Arcadia_Math_BoxReal32Value localBounds;
+  /// The bounds of the vertices of the mesh in world space.
+  Arcadia_Math_BoxReal32Value worldBounds;
+  /// The bounding sphere of the world space bounds.
+  Arcadia_Math_SphereReal32Value worldSphere;
+} Arcadia_Engine_Visuals_SceneNodeObject;
+
+/// A draw of a scene node.
+/// The components of the sort key identify the state required by the draw.
+typedef struct Arcadia_Engine_Visuals_SceneNodeDraw {
+  /// The program. This is the ambient color source of the material.
+  Arcadia_Natural32Value program;
+  /// The texture. This is the address of the texture definition or the null pointer.
+  void const* texture;
+  /// The vertices. This is the address of the mesh definition.
+  void const* vertices;
+  /// The index of the object.
+  Arcadia_SizeValue object;
+} Arcadia_Engine_Visuals_SceneNodeDraw;
+
+/// The statistics of the last frame of a scene node.
+typedef struct Arcadia_Engine_Visuals_SceneNodeStatistics {
+  /// The number of objects.
+  Arcadia_SizeValue numberOfObjects;
+  /// The number of objects culled, that is, not drawn because their bounds are outside of the view frustum.
+  Arcadia_SizeValue numberOfCulledObjects;
+  /// The number of draws.
+  Arcadia_SizeValue numberOfDraws;
+  /// The number of batches, that is, runs of consecutive draws requiring the same program, texture, and vertices.
+  Arcadia_SizeValue numberOfBatches;
+  /// The number of state changes, that is, the sum of the number of program changes, texture changes, and vertices changes.
+  Arcadia_SizeValue numberOfStateChanges;
+} Arcadia_Engine_Visuals_SceneNodeStatistics;
+
+/// A "scene node" consists of many model nodes.
+/// Each model node is an object with a local to parent matrix and an optional parent object.
+///
+/// When the scene node is rendered,
+/// - the local to world matrices of objects whose local to parent matrix or whose parent's local to world matrix changed are recomputed,
+/// - objects whose bounds are outside of the view frustum of the camera are culled,
+/// - the remaining objects are drawn sorted by program, texture, and vertices to minimize state changes.
+Arcadia_declareObjectType(u8"Arcadia.Engine.Visuals.SceneNode", Arcadia_Engine_Visuals_SceneNode,
+                          u8"Arcadia.Engine.Visuals.Node")
+
+struct Arcadia_Engine_Visuals_SceneNodeDispatch {
+  Arcadia_Engine_Visuals_NodeDispatch parent;
+};
+
+struct Arcadia_Engine_Visuals_SceneNode {
+  Arcadia_Engine_Visuals_Node _parent;
+
+  /// The objects. A parent object precedes its child objects.
+  Arcadia_Engine_Visuals_SceneNodeObject* objects;
+  /// The draws of the last frame in the order in which they are issued.
+  Arcadia_Engine_Visuals_SceneNodeDraw* draws;
+  /// The number of objects.
+  Arcadia_SizeValue numberOfObjects;
+  /// The capacity, in objects, of the objects array and the draws array.
+  Arcadia_SizeValue capacity;
+  /// The statistics of the last frame.
+  Arcadia_Engine_Visuals_SceneNodeStatistics statistics;
+  /// The backend context.
+  Arcadia_Engine_Visuals_BackendContext* backendContext;
+  /// Temporary used to pass matrices to model nodes.
+  Arcadia_Math_Matrix4Real32* temporary;
+};
+
+/// @brief Create a scene node.
+/// @param thread A pointer to this thread.
+/// @param backendContext A pointer to the backend context or the null pointer.
+/// @return A pointer to the scene node.
+Arcadia_Engine_Visuals_SceneNode*
+Arcadia_Engine_Visuals_SceneNode_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_BackendContext* backendContext
+  );
+
+/// @brief Add a model node to this scene node.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this scene node.
+/// @param parent The index of the parent object or Arcadia_SizeValue_Maximum.
+/// @param modelNode A pointer to the model node.
+/// @return The index of the object.
+/// @error #Arcadia_Status_ArgumentValueInvalid @a modelNode is a null pointer
+/// @error #Arcadia_Status_ArgumentValueInvalid @a parent is neither Arcadia_SizeValue_Maximum nor the index of an object
+Arcadia_SizeValue
+Arcadia_Engine_Visuals_SceneNode_addModelNode
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* self,
+    Arcadia_SizeValue parent,
+    Arcadia_Engine_Visuals_ModelNode* modelNode
+  );
+
+/// @brief Set the local to parent matrix of an object.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this scene node.
+/// @param index The index of the object.
+/// @param localToParentMatrix A pointer to the local to parent matrix.
+/// @error #Arcadia_Status_ArgumentValueInvalid @a index is not the index of an object
+void
+Arcadia_Engine_Visuals_SceneNode_setLocalToParentMatrix
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* self,
+    Arcadia_SizeValue index,
+    Arcadia_Math_Matrix4x4Real32Value const* localToParentMatrix
+  );
+
+/// @brief Get the local to world matrix of an object.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this scene node.
+/// @param index The index of the object.
+/// @param localToWorldMatrix A pointer to the matrix value receiving the local to world matrix.
+/// @error #Arcadia_Status_ArgumentValueInvalid @a index is not the index of an object
+void
+Arcadia_Engine_Visuals_SceneNode_getLocalToWorldMatrix
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* self,
+    Arcadia_SizeValue index,
+    Arcadia_Math_Matrix4x4Real32Value* localToWorldMatrix
+  );
+
+/// @brief Update the local to world matrices and cull and sort the objects.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this scene node.
+/// @param worldToProjectionMatrix A pointer to the world to projection matrix or the null pointer.
+/// If this is the null pointer, no objects are culled.
+/// @post The draws and the statistics of this scene node were updated.
+/// @remarks This is invoked when rendering the scene node. It does not issue draws.
+void
+Arcadia_Engine_Visuals_SceneNode_cull
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* self,
+    Arcadia_Math_Matrix4x4Real32Value const* worldToProjectionMatrix
+  );
+
+/// @brief Get the statistics of the last frame of this scene node.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this scene node.
+/// @param statistics A pointer to the value receiving the statistics.
+void
+Arcadia_Engine_Visuals_SceneNode_getStatistics
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* self,
+    Arcadia_Engine_Visuals_SceneNodeStatistics* statistics
+  );
+
+#endif // ARCADIA_ENGINE_VISUALS_NODES_SCENENODE_H_INCLUDED
@@ -134,7 +134,19 @@ makePixelBuffer
     Arcadia_ADL_PixelBufferDefinition* source
   )
 {
-  Arcadia_Media_PixelBuffer* target = Arcadia_Media_PixelBuffer_create(thread, 0, source->width, source->height, Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8);
+  Arcadia_Media_PixelBuffer* target = Arcadia_Media_PixelBuffer_create(thread, 0, source->width, source->height, (Arcadia_Media_PixelFormat)source->pixelFormat);
+
+  // The pixels of a definition loaded from an asset pack were baked.
+  // The baked rows have no line padding.
+  if (source->pixels) {
+    Arcadia_SizeValue lineStride = Arcadia_Media_PixelBuffer_getLineStride(thread, target),
+                      rowSize = (Arcadia_SizeValue)source->width * Arcadia_Media_PixelBuffer_getBytesPerPixel(thread, target);
+    Arcadia_Natural8Value const* pixels = Arcadia_ADL_PackEntry_getBytes(thread, source->pixels);
+    for (Arcadia_SizeValue y = 0; y < source->height; ++y) {
+      Arcadia_Memory_copy(thread, target->bytes + y * lineStride, pixels + y * rowSize, rowSize);
+    }
+    return target;
+  }
 
   for (Arcadia_SizeValue i = 0, n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)source->operations); i < n; ++i) {
     Arcadia_ADL_Reference* e = (Arcadia_ADL_Reference*)Arcadia_List_getObjectReferenceValueAt(thread, source->operations, i);
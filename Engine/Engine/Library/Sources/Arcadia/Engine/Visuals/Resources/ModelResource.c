@@ -78,6 +78,14 @@ Arcadia_Engine_Visuals_Implementation_ModelResource_renderImpl
     Arcadia_Engine_Visuals_Implementation_EnterPassResource* enterPassResource
   );
 
+static void
+Arcadia_Engine_Visuals_Implementation_ModelResource_setLocalToWorldMatrixImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_ModelResource* self,
+    Arcadia_Math_Matrix4Real32* localToWorldMatrix
+  );
+
 static const Arcadia_ObjectType_Operations _objectTypeOperations = {
   Arcadia_ObjectType_Operations_Initializer,
   .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_Engine_Visuals_Implementation_ModelResource_constructImpl,
@@ -199,6 +207,7 @@ Arcadia_Engine_Visuals_Implementation_ModelResource_initializeDispatchImpl
   ((Arcadia_Engine_Visuals_Implementation_ResourceDispatch*)self)->unload = (void (*)(Arcadia_Thread*, Arcadia_Engine_Visuals_Implementation_Resource*)) & Arcadia_Engine_Visuals_Implementation_ModelResource_unloadImpl;
   ((Arcadia_Engine_Visuals_Implementation_ResourceDispatch*)self)->unlink = (void (*)(Arcadia_Thread*, Arcadia_Engine_Visuals_Implementation_Resource*)) & Arcadia_Engine_Visuals_Implementation_ModelResource_unlinkImpl;
   ((Arcadia_Engine_Visuals_Implementation_ResourceDispatch*)self)->render = (void (*)(Arcadia_Thread*, Arcadia_Engine_Visuals_Implementation_Resource*, Arcadia_Engine_Visuals_Implementation_EnterPassResource*)) & Arcadia_Engine_Visuals_Implementation_ModelResource_renderImpl;
+  self->setLocalToWorldMatrix = &Arcadia_Engine_Visuals_Implementation_ModelResource_setLocalToWorldMatrixImpl;
 }
 
 static void
@@ -268,6 +277,18 @@ Arcadia_Engine_Visuals_Implementation_ModelResource_renderImpl
   )
 { }
 
+static void
+Arcadia_Engine_Visuals_Implementation_ModelResource_setLocalToWorldMatrixImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_ModelResource* self,
+    Arcadia_Math_Matrix4Real32* localToWorldMatrix
+  )
+{
+  Arcadia_Math_Matrix4Real32_assign(thread, self->localToWorldMatrix, localToWorldMatrix);
+  self->dirty |= Arcadia_Engine_Visuals_Implementation_ModelResource_LocalToWorldMatrixDirty;
+}
+
 void
 Arcadia_Engine_Visuals_Implementation_ModelResource_setLocalToWorldMatrix
   (
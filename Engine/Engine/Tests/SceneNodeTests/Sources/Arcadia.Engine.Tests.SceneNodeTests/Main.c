@@ -0,0 +1,234 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "Arcadia/Engine/Include.h"
+#include "Arcadia/ADL/Include.h"
+
+// The definitions of the models.
+// All models share one mesh, a quad of size 1 x 1 in the xy-plane centered at the origin.
+// "MeshColorModel" and "OtherMeshColorModel" require the same state, "TextureColorModel" requires a different program and a texture.
+static const char* DEFINITIONS[] = {
+  u8"{ type : \"Color\", name : \"SceneNodeTests.FirstColor\", red : 255, green : 255, blue : 255 }",
+  u8"{ type : \"Color\", name : \"SceneNodeTests.SecondColor\", red : 0, green : 0, blue : 0 }",
+  u8"{ type : \"Color\", name : \"SceneNodeTests.MeshColor\", red : 167, green : 255, blue : 181 }",
+  u8"{ type : \"PixelBufferOperations.CheckerboardFillOperation\", name : \"SceneNodeTests.FillOperation\", checkerWidth : 2, checkerHeight : 2,"
+  u8"  firstCheckerColor : \"SceneNodeTests.FirstColor\", secondCheckerColor : \"SceneNodeTests.SecondColor\" }",
+  u8"{ type : \"PixelBuffer\", name : \"SceneNodeTests.PixelBuffer\", width : 4, height : 4, pixelFormat : \"RedGreenBlueAlphaNatural8\", operations : [ \"SceneNodeTests.FillOperation\" ] }",
+  u8"{ type : \"Texture\", name : \"SceneNodeTests.Texture\", pixelBuffer : \"SceneNodeTests.PixelBuffer\" }",
+  u8"{ type : \"Mesh\", name : \"SceneNodeTests.Mesh\", ambientColor : \"SceneNodeTests.MeshColor\","
+  u8"  vertexPositions : [ -0.5, -0.5, 0.0, 0.5, -0.5, 0.0, -0.5, 0.5, 0.0, 0.5, -0.5, 0.0, 0.5, 0.5, 0.0, -0.5, 0.5, 0.0 ],"
+  u8"  vertexAmbientColors : [ 1, 0, 0, 1, 0, 1, 0, 1, 0, 0, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 0, 0, 1, 1 ],"
+  u8"  vertexAmbientColorTextureCoordinates : [ 0, 0, 1, 0, 0, 1, 1, 0, 1, 1, 0, 1 ] }",
+  u8"{ type : \"Material\", name : \"SceneNodeTests.MeshColorMaterial\", materialType : \"Blinn-Phong\", ambientColorSource : \"Mesh\","
+  u8"  ambientColorTexture : \"SceneNodeTests.Texture\" }",
+  u8"{ type : \"Material\", name : \"SceneNodeTests.TextureColorMaterial\", materialType : \"Blinn-Phong\", ambientColorSource : \"Texture\","
+  u8"  ambientColorTexture : \"SceneNodeTests.Texture\" }",
+  u8"{ type : \"Model\", name : \"SceneNodeTests.MeshColorModel\", mesh : \"SceneNodeTests.Mesh\", material : \"SceneNodeTests.MeshColorMaterial\" }",
+  u8"{ type : \"Model\", name : \"SceneNodeTests.OtherMeshColorModel\", mesh : \"SceneNodeTests.Mesh\", material : \"SceneNodeTests.MeshColorMaterial\" }",
+  u8"{ type : \"Model\", name : \"SceneNodeTests.TextureColorModel\", mesh : \"SceneNodeTests.Mesh\", material : \"SceneNodeTests.TextureColorMaterial\" }",
+};
+
+static Arcadia_ADL_Definitions*
+createDefinitions
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Engine* engine = Arcadia_Engine_getOrCreate(thread);
+  if (!engine->visualsNodeFactory) {
+    // The default node factory creates nodes without a backend.
+    engine->visualsNodeFactory = (Arcadia_Engine_NodeFactory*)Arcadia_Engine_Visuals_NodeFactory_create(thread);
+  }
+  Arcadia_ADL_Definitions* definitions = Arcadia_ADL_Definitions_create(thread);
+  Arcadia_ADL_Context* context = Arcadia_ADL_Context_getOrCreate(thread);
+  for (Arcadia_SizeValue i = 0; i < sizeof(DEFINITIONS) / sizeof(DEFINITIONS[0]); ++i) {
+    Arcadia_ADL_Context_readFromString(thread, context, definitions, Arcadia_String_createFromCxxString(thread, DEFINITIONS[i]), Arcadia_BooleanValue_True);
+  }
+  return definitions;
+}
+
+static Arcadia_Engine_Visuals_ModelNode*
+createModelNode
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Definitions* definitions,
+    const char* name
+  )
+{
+  Arcadia_ADL_Definition* definition = Arcadia_ADL_Definitions_getDefinitionOrNull(thread, definitions, Arcadia_String_createFromCxxString(thread, name));
+  Arcadia_Tests_assertTrue(thread, NULL != definition && Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)definition, _Arcadia_ADL_ModelDefinition_getType(thread)));
+  Arcadia_Engine* engine = Arcadia_Engine_getOrCreate(thread);
+  return Arcadia_Engine_Visuals_NodeFactory_createModelNode(thread, (Arcadia_Engine_Visuals_NodeFactory*)engine->visualsNodeFactory, NULL, (Arcadia_ADL_ModelDefinition*)definition);
+}
+
+static Arcadia_SizeValue
+addModelNode
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_SceneNode* sceneNode,
+    Arcadia_ADL_Definitions* definitions,
+    Arcadia_SizeValue parent,
+    const char* name,
+    Arcadia_Real32Value x,
+    Arcadia_Real32Value y,
+    Arcadia_Real32Value z
+  )
+{
+  Arcadia_SizeValue index = Arcadia_Engine_Visuals_SceneNode_addModelNode(thread, sceneNode, parent, createModelNode(thread, definitions, name));
+  Arcadia_Math_Matrix4x4Real32Value matrix;
+  Arcadia_Math_Matrix4x4Real32Value_setIdentity(thread, &matrix);
+  matrix.elements[0][3] = x; matrix.elements[1][3] = y; matrix.elements[2][3] = z;
+  Arcadia_Engine_Visuals_SceneNode_setLocalToParentMatrix(thread, sceneNode, index, &matrix);
+  return index;
+}
+
+// The world to projection matrix of a perspective projection with a field of view of 90 degrees, an aspect ratio of 1, and near and far distances of 1 and 100.
+// The viewer is at the origin looking along the negative z-axis.
+static void
+getWorldToProjectionMatrix
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4x4Real32Value* target
+  )
+{
+  Arcadia_Math_Matrix4Real32* projection = Arcadia_Math_Matrix4Real32_create(thread);
+  Arcadia_Math_Matrix4x4Real32_setPerspectiveProjection(thread, projection, 90.f, 1.f, 1.f, 100.f);
+  Arcadia_Math_Matrix4Real32_getValue(thread, projection, target);
+}
+
+// Objects outside of the frustum are culled and the remaining objects are sorted by their state.
+static void
+cullTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_ADL_Definitions* definitions = createDefinitions(thread);
+  Arcadia_Engine_Visuals_SceneNode* sceneNode = Arcadia_Engine_Visuals_SceneNode_create(thread, NULL);
+  Arcadia_Engine_Visuals_SceneNodeStatistics statistics;
+  Arcadia_Math_Matrix4x4Real32Value worldToProjection;
+  getWorldToProjectionMatrix(thread, &worldToProjection);
+
+  // Inside of the frustum.
+  addModelNode(thread, sceneNode, definitions, Arcadia_SizeValue_Maximum, u8"SceneNodeTests.MeshColorModel", 0.f, 0.f, -5.f);
+  addModelNode(thread, sceneNode, definitions, Arcadia_SizeValue_Maximum, u8"SceneNodeTests.TextureColorModel", 1.f, 0.f, -10.f);
+  addModelNode(thread, sceneNode, definitions, Arcadia_SizeValue_Maximum, u8"SceneNodeTests.OtherMeshColorModel", -1.f, 0.f, -20.f);
+  // Behind the viewer, right of the frustum, and beyond the far plane.
+  addModelNode(thread, sceneNode, definitions, Arcadia_SizeValue_Maximum, u8"SceneNodeTests.MeshColorModel", 0.f, 0.f, +5.f);
+  addModelNode(thread, sceneNode, definitions, Arcadia_SizeValue_Maximum, u8"SceneNodeTests.TextureColorModel", 50.f, 0.f, -5.f);
+  addModelNode(thread, sceneNode, definitions, Arcadia_SizeValue_Maximum, u8"SceneNodeTests.MeshColorModel", 0.f, 0.f, -200.f);
+
+  Arcadia_Engine_Visuals_SceneNode_cull(thread, sceneNode, &worldToProjection);
+  Arcadia_Engine_Visuals_SceneNode_getStatistics(thread, sceneNode, &statistics);
+  Arcadia_Tests_assertTrue(thread, 6 == statistics.numberOfObjects);
+  Arcadia_Tests_assertTrue(thread, 3 == statistics.numberOfCulledObjects);
+  Arcadia_Tests_assertTrue(thread, 3 == statistics.numberOfDraws);
+  // The two draws with the mesh color material form one batch, the draw with the texture color material forms another batch.
+  // The first batch sets the program and the vertices (and the texture if it has one).
+  // The second batch changes the program and the texture. Both batches use the same vertices.
+  Arcadia_Tests_assertTrue(thread, 2 == statistics.numberOfBatches);
+  Arcadia_Tests_assertTrue(thread, 4 == statistics.numberOfStateChanges);
+  // Draws with the same state are consecutive and ordered by their objects.
+  Arcadia_Engine_Visuals_SceneNodeDraw const* draws = sceneNode->draws;
+  if (draws[0].program == draws[1].program) {
+    Arcadia_Tests_assertTrue(thread, 0 == draws[0].object && 2 == draws[1].object && 1 == draws[2].object);
+  } else {
+    Arcadia_Tests_assertTrue(thread, 1 == draws[0].object && 0 == draws[1].object && 2 == draws[2].object);
+  }
+
+  // Without a frustum, no object is culled.
+  Arcadia_Engine_Visuals_SceneNode_cull(thread, sceneNode, NULL);
+  Arcadia_Engine_Visuals_SceneNode_getStatistics(thread, sceneNode, &statistics);
+  Arcadia_Tests_assertTrue(thread, 0 == statistics.numberOfCulledObjects && 6 == statistics.numberOfDraws);
+  Arcadia_Tests_assertTrue(thread, 2 == statistics.numberOfBatches);
+}
+
+// A change of the local to parent matrix of a parent is propagated to its children.
+static void
+dirtyTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_ADL_Definitions* definitions = createDefinitions(thread);
+  Arcadia_Engine_Visuals_SceneNode* sceneNode = Arcadia_Engine_Visuals_SceneNode_create(thread, NULL);
+  Arcadia_Engine_Visuals_SceneNodeStatistics statistics;
+  Arcadia_Math_Matrix4x4Real32Value worldToProjection, matrix;
+  getWorldToProjectionMatrix(thread, &worldToProjection);
+
+  Arcadia_SizeValue parent = addModelNode(thread, sceneNode, definitions, Arcadia_SizeValue_Maximum, u8"SceneNodeTests.MeshColorModel", 0.f, 0.f, -5.f);
+  Arcadia_SizeValue child = addModelNode(thread, sceneNode, definitions, parent, u8"SceneNodeTests.MeshColorModel", 1.f, 0.f, 0.f);
+  Arcadia_SizeValue grandChild = addModelNode(thread, sceneNode, definitions, child, u8"SceneNodeTests.MeshColorModel", 0.f, 1.f, 0.f);
+  Arcadia_Tests_assertTrue(thread, sceneNode->objects[child].dirty & Arcadia_Engine_Visuals_SceneNode_LocalToWorldMatrixDirty);
+
+  Arcadia_Engine_Visuals_SceneNode_cull(thread, sceneNode, &worldToProjection);
+  Arcadia_Engine_Visuals_SceneNode_getStatistics(thread, sceneNode, &statistics);
+  Arcadia_Tests_assertTrue(thread, 0 == statistics.numberOfCulledObjects);
+  Arcadia_Engine_Visuals_SceneNode_getLocalToWorldMatrix(thread, sceneNode, grandChild, &matrix);
+  Arcadia_Tests_assertTrue(thread, 1.f == matrix.elements[0][3] && 1.f == matrix.elements[1][3] && -5.f == matrix.elements[2][3]);
+  for (Arcadia_SizeValue i = 0; i < 3; ++i) {
+    Arcadia_Tests_assertTrue(thread, !(sceneNode->objects[i].dirty & Arcadia_Engine_Visuals_SceneNode_LocalToWorldMatrixDirty));
+    // The model nodes were not rendered yet and must receive their local to world matrices.
+    Arcadia_Tests_assertTrue(thread, sceneNode->objects[i].dirty & Arcadia_Engine_Visuals_SceneNode_ModelNodeDirty);
+  }
+
+  // Move the parent behind the viewer.
+  // Only the parent is marked dirty, the children are updated when the scene node is culled.
+  Arcadia_Math_Matrix4x4Real32Value_setIdentity(thread, &matrix);
+  matrix.elements[2][3] = +5.f;
+  Arcadia_Engine_Visuals_SceneNode_setLocalToParentMatrix(thread, sceneNode, parent, &matrix);
+  Arcadia_Tests_assertTrue(thread, sceneNode->objects[parent].dirty & Arcadia_Engine_Visuals_SceneNode_LocalToWorldMatrixDirty);
+  Arcadia_Tests_assertTrue(thread, !(sceneNode->objects[child].dirty & Arcadia_Engine_Visuals_SceneNode_LocalToWorldMatrixDirty));
+
+  Arcadia_Engine_Visuals_SceneNode_cull(thread, sceneNode, &worldToProjection);
+  Arcadia_Engine_Visuals_SceneNode_getStatistics(thread, sceneNode, &statistics);
+  Arcadia_Tests_assertTrue(thread, 3 == statistics.numberOfCulledObjects && 0 == statistics.numberOfDraws);
+  Arcadia_Tests_assertTrue(thread, 0 == statistics.numberOfBatches && 0 == statistics.numberOfStateChanges);
+  Arcadia_Engine_Visuals_SceneNode_getLocalToWorldMatrix(thread, sceneNode, grandChild, &matrix);
+  Arcadia_Tests_assertTrue(thread, 1.f == matrix.elements[0][3] && 1.f == matrix.elements[1][3] && +5.f == matrix.elements[2][3]);
+  // The bounds of the grand child follow its parents.
+  Arcadia_Math_SphereReal32Value const* sphere = &sceneNode->objects[grandChild].worldSphere;
+  Arcadia_Tests_assertTrue(thread, 1.f == sphere->center[0] && 1.f == sphere->center[1] && +5.f == sphere->center[2]);
+  Arcadia_Tests_assertTrue(thread, fabsf(sphere->radius - sqrtf(0.5f)) < 1e-6f);
+
+  // Move the child back into the frustum. The parent remains behind the viewer.
+  Arcadia_Math_Matrix4x4Real32Value_setIdentity(thread, &matrix);
+  matrix.elements[2][3] = -15.f;
+  Arcadia_Engine_Visuals_SceneNode_setLocalToParentMatrix(thread, sceneNode, child, &matrix);
+  Arcadia_Engine_Visuals_SceneNode_cull(thread, sceneNode, &worldToProjection);
+  Arcadia_Engine_Visuals_SceneNode_getStatistics(thread, sceneNode, &statistics);
+  Arcadia_Tests_assertTrue(thread, 1 == statistics.numberOfCulledObjects && 2 == statistics.numberOfDraws && 1 == statistics.numberOfBatches);
+  Arcadia_Engine_Visuals_SceneNode_getLocalToWorldMatrix(thread, sceneNode, grandChild, &matrix);
+  Arcadia_Tests_assertTrue(thread, 0.f == matrix.elements[0][3] && 1.f == matrix.elements[1][3] && -10.f == matrix.elements[2][3]);
+}
+
+int
+main
+  (
+    int argc,
+    char **argv
+  )
+{
+  if (!Arcadia_Tests_safeExecute(&cullTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&dirtyTests)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -20,8 +20,7 @@
 
 struct Arcadia_Languages_StringTable_Node {
   Arcadia_Languages_StringTable_Node* next;
-  // We need to compare the hash of the Bytes in a string buffer with the hash of the Bytes in a string.
-  // The hash function of string buffer and string cannot be used for that.
+  // The hash value of the Bytes of the string as computed by Arcadia_hashBytes.
   Arcadia_SizeValue hash;
   Arcadia_String* string;
 };
@@ -47,14 +46,6 @@ Arcadia_Languages_StringTable_maybeResize_nojump
     Arcadia_Languages_StringTable* self
   );
 
-static Arcadia_SizeValue
-Arcadia_Languages_StringTable_hashBytes
-  (
-    Arcadia_Thread* thread,
-    Arcadia_Natural8Value const* bytes,
-    Arcadia_SizeValue numberOfBytes
-  );
-
 static void
 Arcadia_Languages_StringTable_visit
   (
@@ -143,10 +134,9 @@ Arcadia_Languages_StringTable_maybeResize_nojump
       Arcadia_SizeValue oldCapacity = self->capacity;
       Arcadia_SizeValue newCapacity;
       if (oldCapacity > maximumCapacity / 2) {
-        if (oldCapacity == maximumCapacity) {
-          return; // Cannot grow. Still a success.
-        }
-        newCapacity = maximumCapacity;
+        // Cannot grow without violating the power of two property. Still a success.
+        Arcadia_Thread_popJumpTarget(thread);
+        return;
       } else {
         newCapacity = oldCapacity * 2;
       }
@@ -160,9 +150,7 @@ Arcadia_Languages_StringTable_maybeResize_nojump
         while (oldBuckets[oldIndex]) {
           Arcadia_Languages_StringTable_Node* node = oldBuckets[oldIndex];
           oldBuckets[oldIndex] = oldBuckets[oldIndex]->next;
-          Arcadia_Value v = Arcadia_Value_makeObjectReferenceValue(node->string);
-          Arcadia_SizeValue hash = Arcadia_Value_getHash(thread, &v);
-          Arcadia_SizeValue newIndex = hash % newCapacity;
+          Arcadia_SizeValue newIndex = node->hash & (newCapacity - 1);
           node->next = newBuckets[newIndex];
           newBuckets[newIndex] = node;
         }
@@ -178,21 +166,6 @@ Arcadia_Languages_StringTable_maybeResize_nojump
   }
 }
 
-static Arcadia_SizeValue
-Arcadia_Languages_StringTable_hashBytes
-  (
-    Arcadia_Thread* thread,
-    Arcadia_Natural8Value const* bytes,
-    Arcadia_SizeValue numberOfBytes
-  )
-{
-  Arcadia_SizeValue hash = numberOfBytes;
-  for (Arcadia_SizeValue i = 0, n = numberOfBytes; i < n; ++i) {
-    hash = hash * 37 + bytes[i];
-  }
-  return hash;
-}
-
 static void
 Arcadia_Languages_StringTable_visit
   (
@@ -254,10 +227,9 @@ Arcadia_Languages_StringTable_getOrCreateStringFromBytes
     Arcadia_SizeValue numberOfBytes
   )
 {
-  Arcadia_SizeValue hash = Arcadia_Languages_StringTable_hashBytes(thread, bytes, numberOfBytes);
-  Arcadia_SizeValue index = hash % self->capacity;
+  Arcadia_SizeValue hash = Arcadia_hashBytes(thread, bytes, numberOfBytes);
+  Arcadia_SizeValue index = hash & (self->capacity - 1);
   for (Arcadia_Languages_StringTable_Node* node = self->buckets[index]; NULL != node; node = node->next) {
-    Arcadia_Value nodeValue = Arcadia_Value_makeObjectReferenceValue(node->string);
     if (node->hash == hash &&
       Arcadia_String_getNumberOfBytes(thread, node->string) == numberOfBytes) {
       if (!Arcadia_Memory_compare(thread, Arcadia_String_getBytes(thread, node->string), bytes, numberOfBytes)) {
@@ -36,6 +36,7 @@ struct Arcadia_Languages_StringTable {
   Arcadia_Object _parent;
   Arcadia_Languages_StringTable_Node** buckets;
   Arcadia_SizeValue size;
+  // The capacity is a power of two such that the index of a bucket can be computed by masking.
   Arcadia_SizeValue capacity;
 };
 
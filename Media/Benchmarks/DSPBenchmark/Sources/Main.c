@@ -0,0 +1,199 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "Arcadia/Media/Include.h"
+#include "Arcadia/Benchmarks/Harness/Driver.h"
+
+// The sample rate.
+#define SampleRate (44100)
+
+// The number of frames generated per repetition.
+#define NumberOfFrames (1 << 20)
+
+static Arcadia_Real32Value g_block[Arcadia_Media_DSP_BlockSize * 8];
+
+// Prevents the compiler from removing the generation of the samples.
+static volatile Arcadia_Real32Value g_sink;
+
+// The DSP to benchmark.
+static Arcadia_Media_DSP* g_dsp = NULL;
+
+// The number of channels to generate.
+static Arcadia_Natural32Value g_numberOfChannels = 1;
+
+static Arcadia_Media_DSP*
+createSawtoothWave
+  (
+    Arcadia_Thread* thread
+  )
+{ return (Arcadia_Media_DSP*)Arcadia_Media_DSP_SawtoothWave_create(thread, 440); }
+
+static Arcadia_Media_DSP*
+createSineWave
+  (
+    Arcadia_Thread* thread
+  )
+{ return (Arcadia_Media_DSP*)Arcadia_Media_DSP_SineWave_create(thread, 440); }
+
+static Arcadia_Media_DSP*
+createSquareWave
+  (
+    Arcadia_Thread* thread
+  )
+{ return (Arcadia_Media_DSP*)Arcadia_Media_DSP_SquareWave_create(thread, 440); }
+
+static Arcadia_Media_DSP*
+createWhiteNoise
+  (
+    Arcadia_Thread* thread
+  )
+{ return (Arcadia_Media_DSP*)Arcadia_Media_DSP_WhiteNoise_create(thread); }
+
+static void
+setUp
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_DSP* (*create)(Arcadia_Thread* thread),
+    Arcadia_Natural32Value numberOfChannels
+  )
+{
+  g_dsp = create(thread);
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_dsp);
+  g_numberOfChannels = numberOfChannels;
+}
+
+static void
+tearDown
+  (
+    Arcadia_Thread* thread
+  )
+{
+  if (g_dsp) {
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)g_dsp);
+    g_dsp = NULL;
+  }
+}
+
+static void
+run
+  (
+    Arcadia_Thread* thread
+  )
+{
+  for (Arcadia_Natural64Value i = 0; i < NumberOfFrames; i += Arcadia_Media_DSP_BlockSize) {
+    Arcadia_Media_DSP_generate(thread, g_dsp, SampleRate, i, Arcadia_Media_DSP_BlockSize, g_numberOfChannels, g_block);
+    g_sink = g_block[0];
+  }
+}
+
+#define DefineSetUp(Name, Create, NumberOfChannels) \
+  static void \
+  setUp##Name \
+    ( \
+      Arcadia_Thread* thread \
+    ) \
+  { setUp(thread, Create, NumberOfChannels); }
+
+DefineSetUp(SawtoothWave1, &createSawtoothWave, 1)
+DefineSetUp(SawtoothWave2, &createSawtoothWave, 2)
+DefineSetUp(SawtoothWave8, &createSawtoothWave, 8)
+DefineSetUp(SineWave1, &createSineWave, 1)
+DefineSetUp(SineWave2, &createSineWave, 2)
+DefineSetUp(SineWave8, &createSineWave, 8)
+DefineSetUp(SquareWave1, &createSquareWave, 1)
+DefineSetUp(SquareWave2, &createSquareWave, 2)
+DefineSetUp(SquareWave8, &createSquareWave, 8)
+DefineSetUp(WhiteNoise1, &createWhiteNoise, 1)
+DefineSetUp(WhiteNoise2, &createWhiteNoise, 2)
+DefineSetUp(WhiteNoise8, &createWhiteNoise, 8)
+
+// The per-sample reference: one sinf call per sample.
+static void
+runScalarSineWave
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static const Arcadia_Real32Value PI = 3.14159265358979323846f;
+  const Arcadia_Real32Value c = 2.f * PI * 440.f / (Arcadia_Real32Value)SampleRate;
+  Arcadia_Natural32Value j = 0;
+  for (Arcadia_Natural64Value i = 0; i < NumberOfFrames; i += Arcadia_Media_DSP_BlockSize) {
+    for (Arcadia_SizeValue k = 0; k < Arcadia_Media_DSP_BlockSize; ++k) {
+      g_block[k] = sinf(c * (Arcadia_Real32Value)j);
+      if (++j == SampleRate) {
+        j = 0;
+      }
+    }
+    g_sink = g_block[0];
+  }
+}
+
+// The per-sample reference: one rand call per sample.
+static void
+runScalarWhiteNoise
+  (
+    Arcadia_Thread* thread
+  )
+{
+  for (Arcadia_Natural64Value i = 0; i < NumberOfFrames; i += Arcadia_Media_DSP_BlockSize) {
+    for (Arcadia_SizeValue k = 0; k < Arcadia_Media_DSP_BlockSize; ++k) {
+      g_block[k] = (Arcadia_Real32Value)rand() / (Arcadia_Real32Value)RAND_MAX * 2.f - 1.f;
+    }
+    g_sink = g_block[0];
+  }
+}
+
+// One operation is one sample.
+static Arcadia_Benchmarks_Benchmark const g_benchmarks[] = {
+  { u8"sine wave (sinf per sample)", NumberOfFrames, NULL, &runScalarSineWave, NULL },
+  { u8"white noise (rand per sample)", NumberOfFrames, NULL, &runScalarWhiteNoise, NULL },
+  { u8"sawtooth wave 1 channel(s)", NumberOfFrames * 1, &setUpSawtoothWave1, &run, &tearDown },
+  { u8"sine wave 1 channel(s)", NumberOfFrames * 1, &setUpSineWave1, &run, &tearDown },
+  { u8"square wave 1 channel(s)", NumberOfFrames * 1, &setUpSquareWave1, &run, &tearDown },
+  { u8"white noise 1 channel(s)", NumberOfFrames * 1, &setUpWhiteNoise1, &run, &tearDown },
+  { u8"sawtooth wave 2 channel(s)", NumberOfFrames * 2, &setUpSawtoothWave2, &run, &tearDown },
+  { u8"sine wave 2 channel(s)", NumberOfFrames * 2, &setUpSineWave2, &run, &tearDown },
+  { u8"square wave 2 channel(s)", NumberOfFrames * 2, &setUpSquareWave2, &run, &tearDown },
+  { u8"white noise 2 channel(s)", NumberOfFrames * 2, &setUpWhiteNoise2, &run, &tearDown },
+  { u8"sawtooth wave 8 channel(s)", NumberOfFrames * 8, &setUpSawtoothWave8, &run, &tearDown },
+  { u8"sine wave 8 channel(s)", NumberOfFrames * 8, &setUpSineWave8, &run, &tearDown },
+  { u8"square wave 8 channel(s)", NumberOfFrames * 8, &setUpSquareWave8, &run, &tearDown },
+  { u8"white noise 8 channel(s)", NumberOfFrames * 8, &setUpWhiteNoise8, &run, &tearDown },
+};
+
+static Arcadia_Benchmarks_Benchmark const*
+getBenchmarks
+  (
+    Arcadia_SizeValue* numberOfBenchmarks
+  )
+{
+  *numberOfBenchmarks = sizeof(g_benchmarks) / sizeof(Arcadia_Benchmarks_Benchmark);
+  return g_benchmarks;
+}
+
+static Arcadia_Benchmarks_GetBenchmarks* const g_groups[] = {
+  &getBenchmarks,
+};
+
+int
+main
+  (
+    int argc,
+    char** argv
+  )
+{ return Arcadia_Benchmarks_main(argc, argv, g_groups, sizeof(g_groups) / sizeof(Arcadia_Benchmarks_GetBenchmarks*)); }
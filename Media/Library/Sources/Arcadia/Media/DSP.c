@@ -16,6 +16,19 @@
 #define ARCADIA_MEDIA_MODULE (1)
 #include "Arcadia/Media/DSP.h"
 
+#if Arcadia_Configuration_InstructionSetArchitecture == Arcadia_Configuration_InstructionSetArchitecture_X64
+  #include <emmintrin.h>
+  #define Arcadia_Media_DSP_WithSSE2 (1)
+  #define Arcadia_Media_DSP_WithNEON (0)
+#elif defined(__ARM_NEON)
+  #include <arm_neon.h>
+  #define Arcadia_Media_DSP_WithSSE2 (0)
+  #define Arcadia_Media_DSP_WithNEON (1)
+#else
+  #define Arcadia_Media_DSP_WithSSE2 (0)
+  #define Arcadia_Media_DSP_WithNEON (0)
+#endif
+
 static void
 Arcadia_Media_DSP_constructImpl
   (
@@ -72,13 +85,73 @@ Arcadia_Media_DSP_initializeDispatchImpl
   )
 {/*Intentionally empty.*/}
 
+// Copy each of the numberOfFrames values of source to the numberOfChannels consecutive channels of a frame in target.
+static void
+interleave
+  (
+    Arcadia_Real32Value const* source,
+    Arcadia_Natural32Value numberOfFrames,
+    Arcadia_Natural32Value numberOfChannels,
+    Arcadia_Real32Value* target
+  )
+{
+  Arcadia_Natural32Value i = 0;
+  if (2 == numberOfChannels) {
+#if 1 == Arcadia_Media_DSP_WithSSE2
+    for (; i + 4 <= numberOfFrames; i += 4) {
+      __m128 x = _mm_loadu_ps(source + i);
+      _mm_storeu_ps(target + 2 * i + 0, _mm_unpacklo_ps(x, x));
+      _mm_storeu_ps(target + 2 * i + 4, _mm_unpackhi_ps(x, x));
+    }
+#elif 1 == Arcadia_Media_DSP_WithNEON
+    for (; i + 4 <= numberOfFrames; i += 4) {
+      float32x4_t x = vld1q_f32(source + i);
+      float32x4x2_t y = { { x, x } };
+      vst2q_f32(target + 2 * i, y);
+    }
+#endif
+    for (; i < numberOfFrames; ++i) {
+      target[2 * i + 0] = source[i];
+      target[2 * i + 1] = source[i];
+    }
+  } else {
+    for (; i < numberOfFrames; ++i) {
+      for (Arcadia_Natural32Value j = 0; j < numberOfChannels; ++j) {
+        target[i * numberOfChannels + j] = source[i];
+      }
+    }
+  }
+}
+
 void
 Arcadia_Media_DSP_generate
   (
     Arcadia_Thread* thread,
     Arcadia_Media_DSP* self,
     Arcadia_Natural32Value sampleRate,
-    Arcadia_Natural32Value numberOfSamples,
-    Arcadia_ByteArrayBuilder* target
+    Arcadia_Natural64Value offset,
+    Arcadia_Natural32Value numberOfFrames,
+    Arcadia_Natural32Value numberOfChannels,
+    Arcadia_Real32Value* target
   )
-{ Arcadia_VirtualCall(Arcadia_Media_DSP, generate, self, sampleRate, numberOfSamples, target); }
+{
+  if (!sampleRate || !numberOfChannels || (!target && numberOfFrames)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Media_DSPDispatch* dispatch = (Arcadia_Media_DSPDispatch*)Arcadia_ObjectType_getDispatch(Arcadia_Object_getType(thread, (Arcadia_Object*)self));
+  if (1 == numberOfChannels) {
+    dispatch->generate(thread, self, sampleRate, offset, numberOfFrames, target);
+    return;
+  }
+  // Generate the signal block by block and copy each block to the channels.
+  Arcadia_Real32Value block[Arcadia_Media_DSP_BlockSize];
+  while (numberOfFrames) {
+    Arcadia_Natural32Value n = numberOfFrames < Arcadia_Media_DSP_BlockSize ? numberOfFrames : Arcadia_Media_DSP_BlockSize;
+    dispatch->generate(thread, self, sampleRate, offset, n, block);
+    interleave(block, n, numberOfChannels, target);
+    target += (Arcadia_SizeValue)n * numberOfChannels;
+    offset += n;
+    numberOfFrames -= n;
+  }
+}
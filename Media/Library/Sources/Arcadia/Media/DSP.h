@@ -24,27 +24,40 @@ Arcadia_declareObjectType(u8"Arcadia.Media.DSP", Arcadia_Media_DSP,
 struct Arcadia_Media_DSPDispatch {
   Arcadia_ObjectDispatch parent;
 
-  void (*generate)(Arcadia_Thread* thread, Arcadia_Media_DSP* self, Arcadia_Natural32Value samples, Arcadia_Natural32Value numberOfSamples, Arcadia_ByteArrayBuilder* target);
+  void (*generate)(Arcadia_Thread* thread, Arcadia_Media_DSP* self, Arcadia_Natural32Value sampleRate, Arcadia_Natural64Value offset, Arcadia_Natural32Value numberOfFrames, Arcadia_Real32Value* target);
 };
 
 struct Arcadia_Media_DSP {
   Arcadia_Object parent;
 };
 
-/// @brief Generate a number of samples.
+/// The number of frames a DSP generates at once.
+/// Callers generating long signals should generate them in blocks of this size.
+#define Arcadia_Media_DSP_BlockSize (1024)
+
+/// @brief Generate a number of frames.
 /// @param thread A pointer to this thread.
 /// @param self A pointer to this DSP.
 /// @param sampleRate The sample rate.
-/// @param numberOfSamples The number of samples.
-/// @param buffer A pointer to a buffer of @a numberOfSamples Arcadia_Real32Value.
+/// @param offset The index of the first frame to generate.
+/// Generating the frames [a,b) and then [b,c) yields the same signal as generating [a,c) at once.
+/// @param numberOfFrames The number of frames.
+/// @param numberOfChannels The number of channels per frame.
+/// The signal is written to every channel of a frame.
+/// @param target A pointer to an array of @a numberOfFrames * @a numberOfChannels Arcadia_Real32Value values.
+/// The channels of a frame are stored consecutively (interleaved).
+/// @error #Arcadia_Status_ArgumentValueInvalid @a sampleRate or @a numberOfChannels is @a 0
+/// @error #Arcadia_Status_ArgumentValueInvalid @a target is a null pointer and @a numberOfFrames is not @a 0
 void
 Arcadia_Media_DSP_generate
   (
     Arcadia_Thread* thread,
     Arcadia_Media_DSP* self,
     Arcadia_Natural32Value sampleRate,
-    Arcadia_Natural32Value numberOfSamples,
-    Arcadia_ByteArrayBuilder* target
+    Arcadia_Natural64Value offset,
+    Arcadia_Natural32Value numberOfFrames,
+    Arcadia_Natural32Value numberOfChannels,
+    Arcadia_Real32Value* target
   );
 
 #endif // ARCADIA_MEDIA_SAMPLEBUFFEROPERATION_H_INCLUDED
@@ -1,136 +1,204 @@
-// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
-//
-// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
-//
-// Permission to use, copy, modify, and distribute this software for any
-// purpose without fee is hereby granted, provided that this entire notice
-// is included in all copies of any software which is or includes a copy
-// or modification of this software and in all copies of the supporting
-// documentation for such software.
-//
-// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
-// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
-// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
-// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
-
-#define ARCADIA_MEDIA_PRIVATE (1)
-#include "Arcadia/Media/DSP/SawtoothWave.h"
-
-#include "Arcadia/Media/Quantization.h"
-
-static void
-Arcadia_Media_DSP_SawtoothWave_constructImpl
-  (
-    Arcadia_Thread* thread,
-    Arcadia_Media_DSP_SawtoothWave* self
-  );
-
-static void
-Arcadia_Media_DSP_SawtoothWave_initializeDispatchImpl
-  (
-    Arcadia_Thread* thread,
-    Arcadia_Media_DSP_SawtoothWaveDispatch* self
-  );
-
-static void
-Arcadia_Media_DSP_SawtoothWave_visitImpl
-  (
-    Arcadia_Thread* thread,
-    Arcadia_Media_DSP_SawtoothWave* self
-  );
-
-static void
-Arcadia_Media_DSP_SawtoothWave_generate
-  (
-    Arcadia_Thread* thread,
-    Arcadia_Media_DSP_SawtoothWave* self,
-    Arcadia_Natural32Value sampleRate,
-    Arcadia_Natural32Value numberOfSamples,
-    Arcadia_ByteBuffer* target
-  );
-
-static const Arcadia_ObjectType_Operations _objectTypeOperations = {
-  Arcadia_ObjectType_Operations_Initializer,
-  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_Media_DSP_SawtoothWave_constructImpl,
-  .visit = (Arcadia_Object_VisitCallbackFunction*)&Arcadia_Media_DSP_SawtoothWave_visitImpl,
-  .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_Media_DSP_SawtoothWave_initializeDispatchImpl,
-};
-
-static const Arcadia_Type_Operations _typeOperations = {
-  Arcadia_Type_Operations_Initializer,
-  .objectTypeOperations = &_objectTypeOperations,
-};
-
-Arcadia_defineObjectType(u8"Arcadia.Media.DSP.SawtoothWave", Arcadia_Media_DSP_SawtoothWave,
-                         u8"Arcadia.Media.DSP", &_typeOperations);
-
-static void
-Arcadia_Media_DSP_SawtoothWave_constructImpl
-  (
-    Arcadia_Thread* thread,
-    Arcadia_Media_DSP_SawtoothWave* self
-  )
-{
-  Arcadia_EnterConstructor(Arcadia_Media_DSP_SawtoothWave);
-  {
-    Arcadia_ValueStack_pushNatural8Value(thread, 0);
-    Arcadia_superTypeConstructor(thread, _type, self);
-  }
-  if (1 != _numberOfArguments) {
-    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
-    Arcadia_Thread_jump(thread);
-  }
-  self->frequency = Arcadia_ValueStack_getInteger32Value(thread, 1);
-  if (self->frequency < 1) {
-    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
-    Arcadia_Thread_jump(thread);
-  }
-  Arcadia_LeaveConstructor(Arcadia_Media_DSP_SawtoothWave);
-}
-
-static void
-Arcadia_Media_DSP_SawtoothWave_initializeDispatchImpl
-  (
-    Arcadia_Thread* thread,
-    Arcadia_Media_DSP_SawtoothWaveDispatch* self
-  )
-{
-  ((Arcadia_Media_DSPDispatch*)self)->generate = (void (*)(Arcadia_Thread*, Arcadia_Media_DSP*, Arcadia_Natural32Value, Arcadia_Natural32Value, Arcadia_ByteBuffer*)) & Arcadia_Media_DSP_SawtoothWave_generate;
-}
-
-static void
-Arcadia_Media_DSP_SawtoothWave_visitImpl
-  (
-    Arcadia_Thread* thread,
-    Arcadia_Media_DSP_SawtoothWave* self
-  ){/*Intentionally empty.*/}
-
-static void
-Arcadia_Media_DSP_SawtoothWave_generate
-  (
-    Arcadia_Thread* thread,
-    Arcadia_Media_DSP_SawtoothWave* self,
-    Arcadia_Natural32Value sampleRate,
-    Arcadia_Natural32Value numberOfSamples,
-    Arcadia_ByteBuffer* target
-  )
-{
-  const Arcadia_Real32Value period = (Arcadia_Real32Value)sampleRate / self->frequency;
-  for (Arcadia_SizeValue i = 0, n = numberOfSamples; i < n; ++i) {
-    Arcadia_Real32Value v = fmod((Arcadia_Real32Value)i, period) / period - 0.5f;
-    Arcadia_ByteBuffer_insertBackBytes(thread, target, &v, sizeof(v));
-  }
-}
-
-Arcadia_Media_DSP_SawtoothWave*
-Arcadia_Media_DSP_SawtoothWave_create
-  (
-    Arcadia_Thread* thread,
-    Arcadia_Integer32Value frequency
-  )
-{
-  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
-  Arcadia_ValueStack_pushInteger32Value(thread, frequency);
-  Arcadia_ValueStack_pushNatural8Value(thread, 1);
-  ARCADIA_CREATEOBJECT(Arcadia_Media_DSP_SawtoothWave);
-}
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#define ARCADIA_MEDIA_MODULE (1)
+#include "Arcadia/Media/DSP/SawtoothWave.h"
+
+#if Arcadia_Configuration_InstructionSetArchitecture == Arcadia_Configuration_InstructionSetArchitecture_X64
+  #include <emmintrin.h>
+  #define Arcadia_Media_DSP_SawtoothWave_WithSSE2 (1)
+  #define Arcadia_Media_DSP_SawtoothWave_WithNEON (0)
+#elif defined(__ARM_NEON)
+  #include <arm_neon.h>
+  #define Arcadia_Media_DSP_SawtoothWave_WithSSE2 (0)
+  #define Arcadia_Media_DSP_SawtoothWave_WithNEON (1)
+#else
+  #define Arcadia_Media_DSP_SawtoothWave_WithSSE2 (0)
+  #define Arcadia_Media_DSP_SawtoothWave_WithNEON (0)
+#endif
+
+static void
+Arcadia_Media_DSP_SawtoothWave_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_DSP_SawtoothWave* self
+  );
+
+static void
+Arcadia_Media_DSP_SawtoothWave_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_DSP_SawtoothWaveDispatch* self
+  );
+
+static void
+Arcadia_Media_DSP_SawtoothWave_visitImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_DSP_SawtoothWave* self
+  );
+
+static void
+Arcadia_Media_DSP_SawtoothWave_generate
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_DSP_SawtoothWave* self,
+    Arcadia_Natural32Value sampleRate,
+    Arcadia_Natural64Value offset,
+    Arcadia_Natural32Value numberOfFrames,
+    Arcadia_Real32Value* target
+  );
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_Media_DSP_SawtoothWave_constructImpl,
+  .visit = (Arcadia_Object_VisitCallbackFunction*)&Arcadia_Media_DSP_SawtoothWave_visitImpl,
+  .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_Media_DSP_SawtoothWave_initializeDispatchImpl,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.Media.DSP.SawtoothWave", Arcadia_Media_DSP_SawtoothWave,
+                         u8"Arcadia.Media.DSP", Arcadia_Media_DSP,
+                         &_typeOperations);
+
+static void
+Arcadia_Media_DSP_SawtoothWave_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_DSP_SawtoothWave* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_Media_DSP_SawtoothWave);
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  if (1 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->frequency = Arcadia_ValueStack_getInteger32Value(thread, 1);
+  if (self->frequency < 1) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_LeaveConstructor(Arcadia_Media_DSP_SawtoothWave);
+}
+
+static void
+Arcadia_Media_DSP_SawtoothWave_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_DSP_SawtoothWaveDispatch* self
+  )
+{
+  ((Arcadia_Media_DSPDispatch*)self)->generate = (void (*)(Arcadia_Thread*, Arcadia_Media_DSP*, Arcadia_Natural32Value, Arcadia_Natural64Value, Arcadia_Natural32Value, Arcadia_Real32Value*)) & Arcadia_Media_DSP_SawtoothWave_generate;
+}
+
+static void
+Arcadia_Media_DSP_SawtoothWave_visitImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_DSP_SawtoothWave* self
+  )
+{/*Intentionally empty.*/}
+
+// Advance a phase by an increment modulo the sample rate.
+// phase and step are less than sampleRate.
+static inline Arcadia_Natural32Value
+advance
+  (
+    Arcadia_Natural32Value phase,
+    Arcadia_Natural32Value step,
+    Arcadia_Natural32Value sampleRate
+  )
+{ return phase >= sampleRate - step ? phase - (sampleRate - step) : phase + step; }
+
+static void
+Arcadia_Media_DSP_SawtoothWave_generate
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_DSP_SawtoothWave* self,
+    Arcadia_Natural32Value sampleRate,
+    Arcadia_Natural64Value offset,
+    Arcadia_Natural32Value numberOfFrames,
+    Arcadia_Real32Value* target
+  )
+{
+  // The frequency is an integer hence the phase (f i) mod r can be computed exactly.
+  Arcadia_Natural32Value step = (Arcadia_Natural32Value)((Arcadia_Natural64Value)self->frequency % sampleRate);
+  Arcadia_Natural32Value phase = (Arcadia_Natural32Value)(((offset % sampleRate) * step) % sampleRate);
+  const Arcadia_Real32Value scale = (Arcadia_Real32Value)(1. / (double)sampleRate);
+  Arcadia_Natural32Value i = 0;
+#if 1 == Arcadia_Media_DSP_SawtoothWave_WithSSE2 || 1 == Arcadia_Media_DSP_SawtoothWave_WithNEON
+  // Four lanes hold the phases of the frames i + 0, ..., i + 3.
+  // The SSE2 comparisons are signed hence the phases must be less than 2^31.
+  if (sampleRate <= UINT32_C(0x80000000) && numberOfFrames >= 4) {
+    Arcadia_Natural32Value phases[4];
+    phases[0] = phase;
+    for (Arcadia_SizeValue k = 1; k < 4; ++k) {
+      phases[k] = advance(phases[k - 1], step, sampleRate);
+    }
+    Arcadia_Natural32Value step4 = (Arcadia_Natural32Value)(((Arcadia_Natural64Value)step * 4) % sampleRate);
+  #if 1 == Arcadia_Media_DSP_SawtoothWave_WithSSE2
+    __m128i p = _mm_loadu_si128((__m128i const*)phases);
+    const __m128i threshold = _mm_set1_epi32((int)(sampleRate - step4 - 1)),
+                  increment = _mm_set1_epi32((int)step4),
+                  decrement = _mm_set1_epi32((int)(sampleRate - step4));
+    const __m128 vscale = _mm_set1_ps(scale), half = _mm_set1_ps(0.5f);
+    for (; i + 4 <= numberOfFrames; i += 4) {
+      _mm_storeu_ps(target + i, _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(p), vscale), half));
+      __m128i mask = _mm_cmpgt_epi32(p, threshold);
+      p = _mm_add_epi32(p, _mm_or_si128(_mm_andnot_si128(mask, increment), _mm_and_si128(mask, _mm_sub_epi32(_mm_setzero_si128(), decrement))));
+    }
+    _mm_storeu_si128((__m128i*)phases, p);
+  #else
+    uint32x4_t p = vld1q_u32(phases);
+    const uint32x4_t threshold = vdupq_n_u32(sampleRate - step4 - 1),
+                     increment = vdupq_n_u32(step4),
+                     decrement = vdupq_n_u32(sampleRate - step4);
+    const float32x4_t vscale = vdupq_n_f32(scale), half = vdupq_n_f32(0.5f);
+    for (; i + 4 <= numberOfFrames; i += 4) {
+      vst1q_f32(target + i, vsubq_f32(vmulq_f32(vcvtq_f32_u32(p), vscale), half));
+      uint32x4_t mask = vcgtq_u32(p, threshold);
+      p = vbslq_u32(mask, vsubq_u32(p, decrement), vaddq_u32(p, increment));
+    }
+    vst1q_u32(phases, p);
+  #endif
+    phase = phases[0];
+  }
+#endif
+  for (; i < numberOfFrames; ++i) {
+    target[i] = (Arcadia_Real32Value)phase * scale - 0.5f;
+    phase = advance(phase, step, sampleRate);
+  }
+}
+
+Arcadia_Media_DSP_SawtoothWave*
+Arcadia_Media_DSP_SawtoothWave_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Integer32Value frequency
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  Arcadia_ValueStack_pushInteger32Value(thread, frequency);
+  Arcadia_ValueStack_pushNatural8Value(thread, 1);
+  ARCADIA_CREATEOBJECT(Arcadia_Media_DSP_SawtoothWave);
+}
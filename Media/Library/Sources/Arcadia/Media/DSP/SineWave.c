@@ -18,6 +18,23 @@
 
 #include "Arcadia/Media/Quantization.h"
 
+#if Arcadia_Configuration_InstructionSetArchitecture == Arcadia_Configuration_InstructionSetArchitecture_X64
+  #include <emmintrin.h>
+  #define Arcadia_Media_DSP_SineWave_WithSSE2 (1)
+  #define Arcadia_Media_DSP_SineWave_WithNEON (0)
+#elif defined(__ARM_NEON)
+  #include <arm_neon.h>
+  #define Arcadia_Media_DSP_SineWave_WithSSE2 (0)
+  #define Arcadia_Media_DSP_SineWave_WithNEON (1)
+#else
+  #define Arcadia_Media_DSP_SineWave_WithSSE2 (0)
+  #define Arcadia_Media_DSP_SineWave_WithNEON (0)
+#endif
+
+// The oscillator is renormalized every ChunkSize frames.
+// Chunks start at multiples of ChunkSize such that a frame has the same value no matter in which blocks the signal is generated.
+#define ChunkSize (64)
+
 static void
 Arcadia_Media_DSP_SineWave_constructImpl
   (
@@ -45,8 +62,9 @@ Arcadia_Media_DSP_SineWave_generate
     Arcadia_Thread* thread,
     Arcadia_Media_DSP_SineWave* self,
     Arcadia_Natural32Value sampleRate,
-    Arcadia_Natural32Value numberOfSamples,
-    Arcadia_ByteArrayBuilder* target
+    Arcadia_Natural64Value offset,
+    Arcadia_Natural32Value numberOfFrames,
+    Arcadia_Real32Value* target
   );
 
 static const Arcadia_ObjectType_Operations _objectTypeOperations = {
@@ -96,7 +114,7 @@ Arcadia_Media_DSP_SineWave_initializeDispatchImpl
     Arcadia_Media_DSP_SineWaveDispatch* self
   )
 {
-  ((Arcadia_Media_DSPDispatch*)self)->generate = (void (*)(Arcadia_Thread*, Arcadia_Media_DSP*, Arcadia_Natural32Value, Arcadia_Natural32Value, Arcadia_ByteArrayBuilder*)) & Arcadia_Media_DSP_SineWave_generate;
+  ((Arcadia_Media_DSPDispatch*)self)->generate = (void (*)(Arcadia_Thread*, Arcadia_Media_DSP*, Arcadia_Natural32Value, Arcadia_Natural64Value, Arcadia_Natural32Value, Arcadia_Real32Value*)) & Arcadia_Media_DSP_SineWave_generate;
 }
 
 static void
@@ -107,21 +125,118 @@ Arcadia_Media_DSP_SineWave_visitImpl
   )
 {/*Intentionally empty.*/}
 
+typedef struct Oscillator {
+  Arcadia_Natural32Value sampleRate;
+  // The phase increment per frame in units of 2 pi / sampleRate.
+  Arcadia_Natural32Value step;
+  // cos(k delta) and sin(k delta) for k = 0, ..., 4 where delta is the phase increment per frame in radians.
+  double cosines[5];
+  double sines[5];
+} Oscillator;
+
+static void
+Oscillator_initialize
+  (
+    Oscillator* oscillator,
+    Arcadia_Natural32Value sampleRate,
+    Arcadia_Integer32Value frequency
+  )
+{
+  static const double PI = 3.14159265358979323846;
+  oscillator->sampleRate = sampleRate;
+  oscillator->step = (Arcadia_Natural32Value)((Arcadia_Natural64Value)frequency % sampleRate);
+  double delta = 2. * PI * (double)oscillator->step / (double)sampleRate;
+  for (Arcadia_SizeValue k = 0; k < 5; ++k) {
+    oscillator->cosines[k] = cos((double)k * delta);
+    oscillator->sines[k] = sin((double)k * delta);
+  }
+}
+
+// Generate the ChunkSize frames starting at frame first.
+// Four lanes hold the frames first + i + 0, ..., first + i + 3 as unit complex numbers z.
+// Each step emits the imaginary parts and multiplies z by w = exp(i 4 delta).
+// The lanes are seeded in double precision from the exact phase of frame first, which bounds the error accumulated by the recurrence.
+static void
+Oscillator_generateChunk
+  (
+    Oscillator const* oscillator,
+    Arcadia_Natural64Value first,
+    Arcadia_Real32Value* target
+  )
+{
+  static const double PI = 3.14159265358979323846;
+  // The frequency is an integer hence the signal repeats after sampleRate frames.
+  Arcadia_Natural64Value phase = ((first % oscillator->sampleRate) * oscillator->step) % oscillator->sampleRate;
+  double theta = 2. * PI * (double)phase / (double)oscillator->sampleRate;
+  double c = cos(theta), s = sin(theta);
+  Arcadia_Real32Value re[4], im[4];
+  for (Arcadia_SizeValue k = 0; k < 4; ++k) {
+    re[k] = (Arcadia_Real32Value)(c * oscillator->cosines[k] - s * oscillator->sines[k]);
+    im[k] = (Arcadia_Real32Value)(s * oscillator->cosines[k] + c * oscillator->sines[k]);
+  }
+  const Arcadia_Real32Value wre = (Arcadia_Real32Value)oscillator->cosines[4],
+                            wim = (Arcadia_Real32Value)oscillator->sines[4];
+#if 1 == Arcadia_Media_DSP_SineWave_WithSSE2
+  __m128 zre = _mm_loadu_ps(re), zim = _mm_loadu_ps(im);
+  const __m128 vre = _mm_set1_ps(wre), vim = _mm_set1_ps(wim);
+  for (Arcadia_SizeValue i = 0; i < ChunkSize; i += 4) {
+    _mm_storeu_ps(target + i, zim);
+    __m128 t = _mm_sub_ps(_mm_mul_ps(zre, vre), _mm_mul_ps(zim, vim));
+    zim = _mm_add_ps(_mm_mul_ps(zre, vim), _mm_mul_ps(zim, vre));
+    zre = t;
+  }
+#elif 1 == Arcadia_Media_DSP_SineWave_WithNEON
+  float32x4_t zre = vld1q_f32(re), zim = vld1q_f32(im);
+  const float32x4_t vre = vdupq_n_f32(wre), vim = vdupq_n_f32(wim);
+  for (Arcadia_SizeValue i = 0; i < ChunkSize; i += 4) {
+    vst1q_f32(target + i, zim);
+    float32x4_t t = vsubq_f32(vmulq_f32(zre, vre), vmulq_f32(zim, vim));
+    zim = vaddq_f32(vmulq_f32(zre, vim), vmulq_f32(zim, vre));
+    zre = t;
+  }
+#else
+  for (Arcadia_SizeValue i = 0; i < ChunkSize; i += 4) {
+    for (Arcadia_SizeValue k = 0; k < 4; ++k) {
+      target[i + k] = im[k];
+      Arcadia_Real32Value t = re[k] * wre - im[k] * wim;
+      im[k] = re[k] * wim + im[k] * wre;
+      re[k] = t;
+    }
+  }
+#endif
+}
+
 static void
 Arcadia_Media_DSP_SineWave_generate
   (
     Arcadia_Thread* thread,
     Arcadia_Media_DSP_SineWave* self,
     Arcadia_Natural32Value sampleRate,
-    Arcadia_Natural32Value numberOfSamples,
-    Arcadia_ByteArrayBuilder* target
+    Arcadia_Natural64Value offset,
+    Arcadia_Natural32Value numberOfFrames,
+    Arcadia_Real32Value* target
   )
 {
-  static const Arcadia_Real32Value PI = 3.14159265358979323846;
-  const Arcadia_Real32Value c = 2.f * PI * (Arcadia_Real32Value)self->frequency / sampleRate;
-  for (Arcadia_SizeValue i = 0, n = numberOfSamples; i < n; ++i) {
-    Arcadia_Real32Value v = sinf(c * (Arcadia_Real32Value)i);
-    Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, &v, sizeof(v));
+  Oscillator oscillator;
+  Oscillator_initialize(&oscillator, sampleRate, self->frequency);
+  while (numberOfFrames) {
+    Arcadia_Natural64Value first = offset - offset % ChunkSize;
+    Arcadia_Natural32Value skip = (Arcadia_Natural32Value)(offset - first);
+    if (!skip && numberOfFrames >= ChunkSize) {
+      Oscillator_generateChunk(&oscillator, first, target);
+      target += ChunkSize;
+      offset += ChunkSize;
+      numberOfFrames -= ChunkSize;
+    } else {
+      // The block starts or ends within this chunk.
+      Arcadia_Real32Value chunk[ChunkSize];
+      Oscillator_generateChunk(&oscillator, first, chunk);
+      Arcadia_Natural32Value n = ChunkSize - skip < numberOfFrames ? ChunkSize - skip : numberOfFrames;
+      Arcadia_Memory_copy(thread, target, chunk + skip, n * sizeof(Arcadia_Real32Value));
+      target += n;
+      offset += n;
+      numberOfFrames -= n;
+    }
   }
 }
 
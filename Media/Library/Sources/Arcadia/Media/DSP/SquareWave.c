@@ -0,0 +1,208 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#define ARCADIA_MEDIA_MODULE (1)
+#include "Arcadia/Media/DSP/SquareWave.h"
+
+#if Arcadia_Configuration_InstructionSetArchitecture == Arcadia_Configuration_InstructionSetArchitecture_X64
+  #include <emmintrin.h>
+  #define Arcadia_Media_DSP_SquareWave_WithSSE2 (1)
+  #define Arcadia_Media_DSP_SquareWave_WithNEON (0)
+#elif defined(__ARM_NEON)
+  #include <arm_neon.h>
+  #define Arcadia_Media_DSP_SquareWave_WithSSE2 (0)
+  #define Arcadia_Media_DSP_SquareWave_WithNEON (1)
+#else
+  #define Arcadia_Media_DSP_SquareWave_WithSSE2 (0)
+  #define Arcadia_Media_DSP_SquareWave_WithNEON (0)
+#endif
+
+static void
+Arcadia_Media_DSP_SquareWave_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_DSP_SquareWave* self
+  );
+
+static void
+Arcadia_Media_DSP_SquareWave_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_DSP_SquareWaveDispatch* self
+  );
+
+static void
+Arcadia_Media_DSP_SquareWave_visitImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_DSP_SquareWave* self
+  );
+
+static void
+Arcadia_Media_DSP_SquareWave_generate
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_DSP_SquareWave* self,
+    Arcadia_Natural32Value sampleRate,
+    Arcadia_Natural64Value offset,
+    Arcadia_Natural32Value numberOfFrames,
+    Arcadia_Real32Value* target
+  );
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_Media_DSP_SquareWave_constructImpl,
+  .visit = (Arcadia_Object_VisitCallbackFunction*)&Arcadia_Media_DSP_SquareWave_visitImpl,
+  .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_Media_DSP_SquareWave_initializeDispatchImpl,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.Media.DSP.SquareWave", Arcadia_Media_DSP_SquareWave,
+                         u8"Arcadia.Media.DSP", Arcadia_Media_DSP,
+                         &_typeOperations);
+
+static void
+Arcadia_Media_DSP_SquareWave_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_DSP_SquareWave* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_Media_DSP_SquareWave);
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  if (1 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->frequency = Arcadia_ValueStack_getInteger32Value(thread, 1);
+  if (self->frequency < 1) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_LeaveConstructor(Arcadia_Media_DSP_SquareWave);
+}
+
+static void
+Arcadia_Media_DSP_SquareWave_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_DSP_SquareWaveDispatch* self
+  )
+{
+  ((Arcadia_Media_DSPDispatch*)self)->generate = (void (*)(Arcadia_Thread*, Arcadia_Media_DSP*, Arcadia_Natural32Value, Arcadia_Natural64Value, Arcadia_Natural32Value, Arcadia_Real32Value*)) & Arcadia_Media_DSP_SquareWave_generate;
+}
+
+static void
+Arcadia_Media_DSP_SquareWave_visitImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_DSP_SquareWave* self
+  )
+{/*Intentionally empty.*/}
+
+// Advance a phase by an increment modulo the sample rate.
+// phase and step are less than sampleRate.
+static inline Arcadia_Natural32Value
+advance
+  (
+    Arcadia_Natural32Value phase,
+    Arcadia_Natural32Value step,
+    Arcadia_Natural32Value sampleRate
+  )
+{ return phase >= sampleRate - step ? phase - (sampleRate - step) : phase + step; }
+
+static void
+Arcadia_Media_DSP_SquareWave_generate
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_DSP_SquareWave* self,
+    Arcadia_Natural32Value sampleRate,
+    Arcadia_Natural64Value offset,
+    Arcadia_Natural32Value numberOfFrames,
+    Arcadia_Real32Value* target
+  )
+{
+  // The frequency is an integer hence the phase (f i) mod r can be computed exactly.
+  Arcadia_Natural32Value step = (Arcadia_Natural32Value)((Arcadia_Natural64Value)self->frequency % sampleRate);
+  Arcadia_Natural32Value phase = (Arcadia_Natural32Value)(((offset % sampleRate) * step) % sampleRate);
+  // 2p < r if and only if p <= (r - 1) / 2.
+  const Arcadia_Natural32Value half = (sampleRate - 1) / 2;
+  Arcadia_Natural32Value i = 0;
+#if 1 == Arcadia_Media_DSP_SquareWave_WithSSE2 || 1 == Arcadia_Media_DSP_SquareWave_WithNEON
+  // Four lanes hold the phases of the frames i + 0, ..., i + 3.
+  // The SSE2 comparisons are signed hence the phases must be less than 2^31.
+  if (sampleRate <= UINT32_C(0x80000000) && numberOfFrames >= 4) {
+    Arcadia_Natural32Value phases[4];
+    phases[0] = phase;
+    for (Arcadia_SizeValue k = 1; k < 4; ++k) {
+      phases[k] = advance(phases[k - 1], step, sampleRate);
+    }
+    Arcadia_Natural32Value step4 = (Arcadia_Natural32Value)(((Arcadia_Natural64Value)step * 4) % sampleRate);
+  #if 1 == Arcadia_Media_DSP_SquareWave_WithSSE2
+    __m128i p = _mm_loadu_si128((__m128i const*)phases);
+    const __m128i threshold = _mm_set1_epi32((int)(sampleRate - step4 - 1)),
+                  increment = _mm_set1_epi32((int)step4),
+                  decrement = _mm_set1_epi32((int)(sampleRate - step4));
+    const __m128i vhalf = _mm_set1_epi32((int)half);
+    const __m128 plusOne = _mm_set1_ps(+1.f), minusOne = _mm_set1_ps(-1.f);
+    for (; i + 4 <= numberOfFrames; i += 4) {
+      __m128 high = _mm_castsi128_ps(_mm_cmpgt_epi32(p, vhalf));
+      _mm_storeu_ps(target + i, _mm_or_ps(_mm_and_ps(high, minusOne), _mm_andnot_ps(high, plusOne)));
+      __m128i mask = _mm_cmpgt_epi32(p, threshold);
+      p = _mm_add_epi32(p, _mm_or_si128(_mm_andnot_si128(mask, increment), _mm_and_si128(mask, _mm_sub_epi32(_mm_setzero_si128(), decrement))));
+    }
+    _mm_storeu_si128((__m128i*)phases, p);
+  #else
+    uint32x4_t p = vld1q_u32(phases);
+    const uint32x4_t threshold = vdupq_n_u32(sampleRate - step4 - 1),
+                     increment = vdupq_n_u32(step4),
+                     decrement = vdupq_n_u32(sampleRate - step4);
+    const uint32x4_t vhalf = vdupq_n_u32(half);
+    const float32x4_t plusOne = vdupq_n_f32(+1.f), minusOne = vdupq_n_f32(-1.f);
+    for (; i + 4 <= numberOfFrames; i += 4) {
+      vst1q_f32(target + i, vbslq_f32(vcgtq_u32(p, vhalf), minusOne, plusOne));
+      uint32x4_t mask = vcgtq_u32(p, threshold);
+      p = vbslq_u32(mask, vsubq_u32(p, decrement), vaddq_u32(p, increment));
+    }
+    vst1q_u32(phases, p);
+  #endif
+    phase = phases[0];
+  }
+#endif
+  for (; i < numberOfFrames; ++i) {
+    target[i] = phase > half ? -1.f : +1.f;
+    phase = advance(phase, step, sampleRate);
+  }
+}
+
+Arcadia_Media_DSP_SquareWave*
+Arcadia_Media_DSP_SquareWave_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Integer32Value frequency
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  Arcadia_ValueStack_pushInteger32Value(thread, frequency);
+  Arcadia_ValueStack_pushNatural8Value(thread, 1);
+  ARCADIA_CREATEOBJECT(Arcadia_Media_DSP_SquareWave);
+}
@@ -0,0 +1,46 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_MEDIA_DSP_SQUAREWAVE_H_INCLUDED)
+#define ARCADIA_MEDIA_DSP_SQUAREWAVE_H_INCLUDED
+
+#if !defined(ARCADIA_MEDIA_MODULE) || 1 != ARCADIA_MEDIA_MODULE
+  #error("do not include directly, include `Arcadia/Media/Include.h` instead")
+#endif
+#include "Arcadia/ADL/Include.h"
+#include "Arcadia/Media/DSP.h"
+
+/// @brief A DSP generating a square wave which is +1 if 2p < r and -1 otherwise where p = (f i) mod r, f is the frequency, r the sample rate, and i the index of the frame.
+/// The phase p is computed exactly in integer arithmetic.
+Arcadia_declareObjectType(u8"Arcadia.Media.DSP.SquareWave", Arcadia_Media_DSP_SquareWave,
+                          u8"Arcadia.Media.DSP");
+
+struct Arcadia_Media_DSP_SquareWaveDispatch {
+  Arcadia_Media_DSPDispatch parent;
+};
+
+struct Arcadia_Media_DSP_SquareWave {
+  Arcadia_Media_DSP parent;
+  Arcadia_Integer32Value frequency;
+};
+
+Arcadia_Media_DSP_SquareWave*
+Arcadia_Media_DSP_SquareWave_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Integer32Value frequency
+  );
+
+#endif // ARCADIA_MEDIA_DSP_SQUAREWAVE_H_INCLUDED
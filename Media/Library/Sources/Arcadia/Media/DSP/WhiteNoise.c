@@ -18,6 +18,22 @@
 
 #include "Arcadia/Media/Quantization.h"
 
+#if Arcadia_Configuration_InstructionSetArchitecture == Arcadia_Configuration_InstructionSetArchitecture_X64
+  #include <emmintrin.h>
+  #define Arcadia_Media_DSP_WhiteNoise_WithSSE2 (1)
+  #define Arcadia_Media_DSP_WhiteNoise_WithNEON (0)
+#elif defined(__ARM_NEON)
+  #include <arm_neon.h>
+  #define Arcadia_Media_DSP_WhiteNoise_WithSSE2 (0)
+  #define Arcadia_Media_DSP_WhiteNoise_WithNEON (1)
+#else
+  #define Arcadia_Media_DSP_WhiteNoise_WithSSE2 (0)
+  #define Arcadia_Media_DSP_WhiteNoise_WithNEON (0)
+#endif
+
+// The seed of the noise.
+#define Seed (0x9e3779b9)
+
 static void
 Arcadia_Media_DSP_WhiteNoise_constructImpl
   (
@@ -45,16 +61,9 @@ Arcadia_Media_DSP_WhiteNoise_generate
     Arcadia_Thread* thread,
     Arcadia_Media_DSP_WhiteNoise* self,
     Arcadia_Natural32Value sampleRate,
-    Arcadia_Natural32Value numberOfSamples,
-    Arcadia_ByteArrayBuilder* target
-  );
-
-/// @return The random number [-1,+1].
-/// @todo We must replace rand().
-static Arcadia_Real32Value
-Arcadia_getRandomReal32Value
-  (
-    Arcadia_Thread* thread
+    Arcadia_Natural64Value offset,
+    Arcadia_Natural32Value numberOfFrames,
+    Arcadia_Real32Value* target
   );
 
 static const Arcadia_ObjectType_Operations _objectTypeOperations = {
@@ -99,7 +108,7 @@ Arcadia_Media_DSP_WhiteNoise_initializeDispatchImpl
     Arcadia_Media_DSP_WhiteNoiseDispatch* self
   )
 {
-  ((Arcadia_Media_DSPDispatch*)self)->generate = (void (*)(Arcadia_Thread*, Arcadia_Media_DSP*, Arcadia_Natural32Value, Arcadia_Natural32Value, Arcadia_ByteArrayBuilder*)) & Arcadia_Media_DSP_WhiteNoise_generate;
+  ((Arcadia_Media_DSPDispatch*)self)->generate = (void (*)(Arcadia_Thread*, Arcadia_Media_DSP*, Arcadia_Natural32Value, Arcadia_Natural64Value, Arcadia_Natural32Value, Arcadia_Real32Value*)) & Arcadia_Media_DSP_WhiteNoise_generate;
 }
 
 static void
@@ -110,33 +119,107 @@ Arcadia_Media_DSP_WhiteNoise_visitImpl
   )
 {/*Intentionally empty.*/}
 
+// The finalizer of MurmurHash3.
+// Consecutive inputs yield uncorrelated outputs.
+static inline Arcadia_Natural32Value
+hash
+  (
+    Arcadia_Natural32Value x
+  )
+{
+  x ^= x >> 16;
+  x *= UINT32_C(0x85ebca6b);
+  x ^= x >> 13;
+  x *= UINT32_C(0xc2b2ae35);
+  x ^= x >> 16;
+  return x;
+}
+
+#if 1 == Arcadia_Media_DSP_WhiteNoise_WithSSE2
+// SSE2 has no 32 bit multiplication yielding the lower 32 bits of the products.
+// Multiply the even and the odd lanes separately and interleave the lower 32 bits of the 64 bit products.
+static inline __m128i
+multiply
+  (
+    __m128i a,
+    __m128i b
+  )
+{
+  __m128i even = _mm_mul_epu32(a, b);
+  __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+  return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+#endif
+
+// Map the upper 24 bits of a hash to [-1,+1).
+static inline Arcadia_Real32Value
+toReal32
+  (
+    Arcadia_Natural32Value x
+  )
+{ return (Arcadia_Real32Value)(x >> 8) * (1.f / 8388608.f) - 1.f; }
+
+// The value of frame i is hash((i mod 2^32) xor key) mapped to [-1,+1) where key = hash(floor(i / 2^32) xor Seed).
+// The value of a frame depends only on its index hence the noise can be generated in arbitrary blocks and from multiple threads.
 static void
 Arcadia_Media_DSP_WhiteNoise_generate
   (
     Arcadia_Thread* thread,
     Arcadia_Media_DSP_WhiteNoise* self,
     Arcadia_Natural32Value sampleRate,
-    Arcadia_Natural32Value numberOfSamples,
-    Arcadia_ByteArrayBuilder* target
-  )
-{ 
-  for (Arcadia_SizeValue i = 0, n = numberOfSamples; i < n; ++i) {
-    Arcadia_Real32Value v = Arcadia_getRandomReal32Value(thread);
-    Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, &v, sizeof(v));
-  }
-}
-
-static Arcadia_Real32Value
-Arcadia_getRandomReal32Value
-  (
-    Arcadia_Thread* thread
+    Arcadia_Natural64Value offset,
+    Arcadia_Natural32Value numberOfFrames,
+    Arcadia_Real32Value* target
   )
 {
-  Arcadia_Integer32Value i = rand(); // [0,RAND_MAX]
-  Arcadia_Real32Value f = ((Arcadia_Real32Value)i) / ((Arcadia_Real32Value)RAND_MAX); // [0,1]
-  f *= 2.f; // [0,2]
-  f -= 1.f; // [-1,+1]
-  return f;
+  while (numberOfFrames) {
+    // The frames up to the next multiple of 2^32 share the same key.
+    Arcadia_Natural32Value low = (Arcadia_Natural32Value)offset;
+    Arcadia_Natural32Value key = hash((Arcadia_Natural32Value)(offset >> 32) ^ Seed);
+    Arcadia_Natural32Value n = numberOfFrames;
+    if (low && (Arcadia_Natural32Value)(0 - low) < n) {
+      n = (Arcadia_Natural32Value)(0 - low);
+    }
+    Arcadia_Natural32Value i = 0;
+#if 1 == Arcadia_Media_DSP_WhiteNoise_WithSSE2
+    const __m128i c1 = _mm_set1_epi32((int)UINT32_C(0x85ebca6b)), c2 = _mm_set1_epi32((int)UINT32_C(0xc2b2ae35)),
+                  four = _mm_set1_epi32(4), vkey = _mm_set1_epi32((int)key);
+    const __m128 scale = _mm_set1_ps(1.f / 8388608.f), one = _mm_set1_ps(1.f);
+    __m128i index = _mm_add_epi32(_mm_set1_epi32((int)low), _mm_setr_epi32(0, 1, 2, 3));
+    for (; i + 4 <= n; i += 4) {
+      __m128i x = _mm_xor_si128(index, vkey);
+      x = _mm_xor_si128(x, _mm_srli_epi32(x, 16));
+      x = multiply(x, c1);
+      x = _mm_xor_si128(x, _mm_srli_epi32(x, 13));
+      x = multiply(x, c2);
+      x = _mm_xor_si128(x, _mm_srli_epi32(x, 16));
+      _mm_storeu_ps(target + i, _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(x, 8)), scale), one));
+      index = _mm_add_epi32(index, four);
+    }
+#elif 1 == Arcadia_Media_DSP_WhiteNoise_WithNEON
+    static const uint32_t lanes[4] = { 0, 1, 2, 3 };
+    const uint32x4_t c1 = vdupq_n_u32(UINT32_C(0x85ebca6b)), c2 = vdupq_n_u32(UINT32_C(0xc2b2ae35)),
+                     four = vdupq_n_u32(4), vkey = vdupq_n_u32(key);
+    const float32x4_t scale = vdupq_n_f32(1.f / 8388608.f), one = vdupq_n_f32(1.f);
+    uint32x4_t index = vaddq_u32(vdupq_n_u32(low), vld1q_u32(lanes));
+    for (; i + 4 <= n; i += 4) {
+      uint32x4_t x = veorq_u32(index, vkey);
+      x = veorq_u32(x, vshrq_n_u32(x, 16));
+      x = vmulq_u32(x, c1);
+      x = veorq_u32(x, vshrq_n_u32(x, 13));
+      x = vmulq_u32(x, c2);
+      x = veorq_u32(x, vshrq_n_u32(x, 16));
+      vst1q_f32(target + i, vsubq_f32(vmulq_f32(vcvtq_f32_u32(vshrq_n_u32(x, 8)), scale), one));
+      index = vaddq_u32(index, four);
+    }
+#endif
+    for (; i < n; ++i) {
+      target[i] = toReal32(hash((low + i) ^ key));
+    }
+    target += n;
+    offset += n;
+    numberOfFrames -= n;
+  }
 }
 
 Arcadia_Media_DSP_WhiteNoise*
@@ -23,7 +23,8 @@
 #include "Arcadia/Media/DSP.h"
 
 /// @brief A DSP generating white noise.
-/// @todo We use rand() here. We must not use rand() as it is in general not thread safe.
+/// The samples are uniformly distributed in [-1,+1).
+/// The value of a frame is a hash of its index: the noise is reproducible and can be generated from multiple threads.
 Arcadia_declareObjectType(u8"Arcadia.Media.DSP.WhiteNoise", Arcadia_Media_DSP_WhiteNoise,
                           u8"Arcadia.Media.DSP");
 
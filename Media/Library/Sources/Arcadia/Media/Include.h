@@ -31,9 +31,12 @@
 #include "Arcadia/Media/PixelFormat.h"
 
 #include "Arcadia/Media/SampleBuffer.h"
+#include "Arcadia/Media/DSP/SawtoothWave.h"
 #include "Arcadia/Media/DSP/SineWave.h"
+#include "Arcadia/Media/DSP/SquareWave.h"
 #include "Arcadia/Media/DSP/WhiteNoise.h"
 #include "Arcadia/Media/SampleFormat.h"
+#include "Arcadia/Media/SampleStream.h"
 
 #include "Arcadia/Media/VertexBuffer.h"
 
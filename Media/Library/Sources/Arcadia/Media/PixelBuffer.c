@@ -235,6 +235,47 @@ getTranscodeCallbacks
   *targetNumberOfBytesPerPixel = targetEntry->numberOfBytesPerPixel;
 }
 
+// Add the rectangle (left, top, right, bottom) to the dirty rectangle.
+// The rectangle must be clipped against the pixel buffer.
+static inline void
+addDirty
+  (
+    Arcadia_Media_PixelBuffer* self,
+    Arcadia_Integer32Value left,
+    Arcadia_Integer32Value top,
+    Arcadia_Integer32Value right,
+    Arcadia_Integer32Value bottom
+  )
+{
+  if (left >= right || top >= bottom) {
+    return;
+  }
+  if (self->dirty.left == self->dirty.right || self->dirty.top == self->dirty.bottom) {
+    self->dirty.left = left;
+    self->dirty.top = top;
+    self->dirty.right = right;
+    self->dirty.bottom = bottom;
+  } else {
+    if (left < self->dirty.left) self->dirty.left = left;
+    if (top < self->dirty.top) self->dirty.top = top;
+    if (right > self->dirty.right) self->dirty.right = right;
+    if (bottom > self->dirty.bottom) self->dirty.bottom = bottom;
+  }
+}
+
+// Set the dirty rectangle to the entire pixel buffer.
+static inline void
+setDirtyAll
+  (
+    Arcadia_Media_PixelBuffer* self
+  )
+{
+  self->dirty.left = 0;
+  self->dirty.top = 0;
+  self->dirty.right = self->width;
+  self->dirty.bottom = self->height;
+}
+
 /// @code
 /// construct(linePadding:Integer32,width:Integer32,height:Integer32,pixelFormat:Natural8)
 /// @endcode
@@ -381,6 +422,7 @@ Arcadia_Media_PixelBuffer_constructImpl
     Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
     Arcadia_Thread_jump(thread);
   }
+  setDirtyAll(self);
   Arcadia_LeaveConstructor(Arcadia_Media_PixelBuffer);
 }
 
@@ -456,6 +498,7 @@ Arcadia_Media_PixelBuffer_setPixelFormat
     self->bytes = targetBytes;
   }
   self->pixelFormat = pixelFormat;
+  setDirtyAll(self);
 }
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -602,6 +645,7 @@ Arcadia_Media_PixelBuffer_setPixelRGBA
       Arcadia_Thread_jump(thread);
     } break;
   };
+  addDirty(self, column, row, column + 1, row + 1);
 }
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -635,6 +679,9 @@ Arcadia_Media_PixelBuffer_fillRectangle
   if (top < 0) top = 0;
   if (right > self->width) right = self->width;
   if (bottom > self->height) bottom = self->height;
+  if (left >= right || top >= bottom) {
+    return;
+  }
 
   switch (self->pixelFormat) {
     case Arcadia_Media_PixelFormat_AlphaBlueGreenRedNatural8: {
@@ -732,6 +779,7 @@ Arcadia_Media_PixelBuffer_fillRectangle
       Arcadia_Thread_jump(thread);
     } break;
   };
+  addDirty(self, left, top, right, bottom);
 }
 
 void
@@ -823,6 +871,7 @@ Arcadia_Media_PixelBuffer_fill
       Arcadia_Thread_jump(thread);
     } break;
   };
+  setDirtyAll(self);
 }
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -856,6 +905,11 @@ Arcadia_Media_PixelBuffer_swapColumns
     source += lineStride;
     target += lineStride;
   }
+  if (column1 < column2) {
+    addDirty(self, column1, 0, column2 + 1, self->height);
+  } else {
+    addDirty(self, column2, 0, column1 + 1, self->height);
+  }
 }
 
 void
@@ -882,6 +936,11 @@ Arcadia_Media_PixelBuffer_swapRows
   Arcadia_Natural8Value* source = self->bytes + Arcadia_Media_PixelBuffer_getLineStride(thread, self) * row1;
   Arcadia_Natural8Value* target = self->bytes + Arcadia_Media_PixelBuffer_getLineStride(thread, self) * row2;
   Arcadia_Memory_swap(thread, source, target, self->width * bytesPerPixel);
+  if (row1 < row2) {
+    addDirty(self, 0, row1, self->width, row2 + 1);
+  } else {
+    addDirty(self, 0, row2, self->width, row1 + 1);
+  }
 }
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -1099,6 +1158,8 @@ Arcadia_Media_PixelBuffer_swap
     Arcadia_swapInteger32(thread, &self->height, &other->height);
     Arcadia_swapInteger32(thread, &self->linePadding, &other->linePadding);
     Arcadia_swapPointer(thread, (void**)&self->bytes, (void**)&other->bytes);
+    setDirtyAll(self);
+    setDirtyAll(other);
   }
 }
 
@@ -1112,6 +1173,33 @@ Arcadia_Media_PixelBuffer_assign
 {
   if (self == other) {
     return;
+  } else if (self->width == other->width && self->height == other->height &&
+             self->linePadding == other->linePadding && self->pixelFormat == other->pixelFormat) {
+    // Only copy the pixels which differ and add them to the dirty rectangle.
+    Arcadia_SizeValue bytesPerPixel = Arcadia_Media_PixelBuffer_getBytesPerPixel(thread, other);
+    Arcadia_SizeValue lineStride = self->width * bytesPerPixel + self->linePadding;
+    Arcadia_Integer32Value left = self->width, top = self->height, right = 0, bottom = 0;
+    for (Arcadia_Integer32Value y = 0; y < self->height; ++y) {
+      Arcadia_Natural8Value* p = self->bytes + y * lineStride;
+      Arcadia_Natural8Value const* q = other->bytes + y * lineStride;
+      if (!Arcadia_Memory_compare(thread, p, q, self->width * bytesPerPixel)) {
+        continue;
+      }
+      // The line contains at least one pixel which differs: Find the first and the last such pixel.
+      Arcadia_Integer32Value first = 0, last = self->width;
+      while (!Arcadia_Memory_compare(thread, p + first * bytesPerPixel, q + first * bytesPerPixel, bytesPerPixel)) {
+        first++;
+      }
+      while (!Arcadia_Memory_compare(thread, p + (last - 1) * bytesPerPixel, q + (last - 1) * bytesPerPixel, bytesPerPixel)) {
+        last--;
+      }
+      Arcadia_Memory_copy(thread, p + first * bytesPerPixel, q + first * bytesPerPixel, (last - first) * bytesPerPixel);
+      if (first < left) left = first;
+      if (last > right) right = last;
+      if (y < top) top = y;
+      bottom = y + 1;
+    }
+    addDirty(self, left, top, right, bottom);
   } else {
     Arcadia_SizeValue bytesPerPixel = Arcadia_Media_PixelBuffer_getBytesPerPixel(thread, other);
     Arcadia_SizeValue numberOfBytes = (other->width * bytesPerPixel + other->linePadding) * other->height;
@@ -1121,5 +1209,66 @@ Arcadia_Media_PixelBuffer_assign
     self->height = other->height;
     self->linePadding = other->linePadding;
     self->pixelFormat = other->pixelFormat;
+    setDirtyAll(self);
   }
 }
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+Arcadia_BooleanValue
+Arcadia_Media_PixelBuffer_getDirtyRectangle
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_PixelBuffer* self,
+    Arcadia_Integer32Value* left,
+    Arcadia_Integer32Value* top,
+    Arcadia_Integer32Value* width,
+    Arcadia_Integer32Value* height
+  )
+{
+  *left = self->dirty.left;
+  *top = self->dirty.top;
+  *width = self->dirty.right - self->dirty.left;
+  *height = self->dirty.bottom - self->dirty.top;
+  return *width > 0 && *height > 0;
+}
+
+void
+Arcadia_Media_PixelBuffer_addDirtyRectangle
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_PixelBuffer* self,
+    Arcadia_Integer32Value left,
+    Arcadia_Integer32Value top,
+    Arcadia_Integer32Value width,
+    Arcadia_Integer32Value height
+  )
+{
+  if (width < 0 || height < 0) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Integer32Value right, bottom;
+  if (!Arcadia_safeAddInteger32Value(left, width, &right) || !Arcadia_safeAddInteger32Value(top, height, &bottom)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  if (left < 0) left = 0;
+  if (top < 0) top = 0;
+  if (right > self->width) right = self->width;
+  if (bottom > self->height) bottom = self->height;
+  addDirty(self, left, top, right, bottom);
+}
+
+void
+Arcadia_Media_PixelBuffer_clearDirtyRectangle
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_PixelBuffer* self
+  )
+{
+  self->dirty.left = 0;
+  self->dirty.top = 0;
+  self->dirty.right = 0;
+  self->dirty.bottom = 0;
+}
@@ -42,6 +42,11 @@ struct Arcadia_Media_PixelBuffer {
   Arcadia_Integer32Value width;
   /// The line padding of this pixel buffer.
   Arcadia_Integer32Value linePadding;
+  /// The dirty rectangle of this pixel buffer.
+  /// The rectangle is empty if <code>left == right</code> or <code>top == bottom</code>.
+  struct {
+    Arcadia_Integer32Value left, top, right, bottom;
+  } dirty;
 };
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -421,6 +426,14 @@ Arcadia_Media_PixelBuffer_swap
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
+/// @brief Assign the contents of another pixel buffer to this pixel buffer.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this pixel buffer.
+/// @param other A pointer to the other pixel buffer.
+/// @remarks
+/// If both pixel buffers have the same width, height, line padding, and pixel format,
+/// then only the pixels which differ are copied and added to the dirty rectangle of this pixel buffer.
+/// Otherwise all pixels are copied and the dirty rectangle of this pixel buffer is the entire pixel buffer.
 void
 Arcadia_Media_PixelBuffer_assign
   (
@@ -429,4 +442,60 @@ Arcadia_Media_PixelBuffer_assign
     Arcadia_Media_PixelBuffer* other
   );
 
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/// @brief Get the dirty rectangle of this pixel buffer.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this pixel buffer.
+/// @param left A pointer to a variable to which the left side of the dirty rectangle is assigned.
+/// @param top A pointer to a variable to which the top side of the dirty rectangle is assigned.
+/// @param width A pointer to a variable to which the width of the dirty rectangle is assigned.
+/// @param height A pointer to a variable to which the height of the dirty rectangle is assigned.
+/// @return #Arcadia_BooleanValue_True if the dirty rectangle is not empty, #Arcadia_BooleanValue_False otherwise.
+/// @remarks
+/// The dirty rectangle contains all pixels which were modified by functions of this pixel buffer since it was created or since the dirty rectangle was cleared.
+/// Modifications of the Bytes of this pixel buffer by other means must be reported by Arcadia_Media_PixelBuffer_addDirtyRectangle.
+Arcadia_BooleanValue
+Arcadia_Media_PixelBuffer_getDirtyRectangle
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_PixelBuffer* self,
+    Arcadia_Integer32Value* left,
+    Arcadia_Integer32Value* top,
+    Arcadia_Integer32Value* width,
+    Arcadia_Integer32Value* height
+  );
+
+/// @brief Add a rectangle to the dirty rectangle of this pixel buffer.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this pixel buffer.
+/// @param left The left side of the rectangle.
+/// @param top The top side of the rectangle.
+/// @param width The width of the rectangle.
+/// @param height The height of the rectangle.
+/// @error Arcadia_Status_ArgumentValueInvalid @a width and/or @a height is negative.
+/// @error Arcadia_Status_ArgumentValueInvalid <code>left + width</code> and/or <code>top + height</code> would overflow.
+/// @remarks The rectangle is clipped against this pixel buffer.
+/// The dirty rectangle becomes the smallest rectangle enclosing the dirty rectangle and the clipped rectangle.
+void
+Arcadia_Media_PixelBuffer_addDirtyRectangle
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_PixelBuffer* self,
+    Arcadia_Integer32Value left,
+    Arcadia_Integer32Value top,
+    Arcadia_Integer32Value width,
+    Arcadia_Integer32Value height
+  );
+
+/// @brief Clear the dirty rectangle of this pixel buffer.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this pixel buffer.
+void
+Arcadia_Media_PixelBuffer_clearDirtyRectangle
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_PixelBuffer* self
+  );
+
 #endif // ARCADIA_MEDIA_PIXELBUFFER_H_INCLUDED
@@ -15,3 +15,45 @@
 
 #define ARCADIA_MEDIA_MODULE (1)
 #include "Arcadia/Media/Quantization.h"
+
+void
+Arcadia_Media_quantize
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleFormat sampleFormat,
+    Arcadia_Real32Value const* source,
+    void* target,
+    Arcadia_SizeValue numberOfSamples
+  )
+{
+  switch (sampleFormat) {
+    case Arcadia_Media_SampleFormat_Integer16: {
+      Arcadia_Integer16Value* p = (Arcadia_Integer16Value*)target;
+      for (Arcadia_SizeValue i = 0; i < numberOfSamples; ++i) {
+        p[i] = Arcadia_Media_quantizeInteger16(thread, source[i]);
+      }
+    } break;
+    case Arcadia_Media_SampleFormat_Integer8: {
+      Arcadia_Integer8Value* p = (Arcadia_Integer8Value*)target;
+      for (Arcadia_SizeValue i = 0; i < numberOfSamples; ++i) {
+        p[i] = Arcadia_Media_quantizeInteger8(thread, source[i]);
+      }
+    } break;
+    case Arcadia_Media_SampleFormat_Natural16: {
+      Arcadia_Natural16Value* p = (Arcadia_Natural16Value*)target;
+      for (Arcadia_SizeValue i = 0; i < numberOfSamples; ++i) {
+        p[i] = Arcadia_Media_quantizeNatural16(thread, source[i]);
+      }
+    } break;
+    case Arcadia_Media_SampleFormat_Natural8: {
+      Arcadia_Natural8Value* p = (Arcadia_Natural8Value*)target;
+      for (Arcadia_SizeValue i = 0; i < numberOfSamples; ++i) {
+        p[i] = Arcadia_Media_quantizeNatural8(thread, source[i]);
+      }
+    } break;
+    default: {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+      Arcadia_Thread_jump(thread);
+    } break;
+  };
+}
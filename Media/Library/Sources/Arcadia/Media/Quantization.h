@@ -268,4 +268,22 @@ Arcadia_Media_quantizeNatural8
   return x;
 }
 
+/// @brief Quantize an array of Arcadia.Real32 values to PCM samples of the specified sample format.
+/// @param thread A pointer to this thread.
+/// @param sampleFormat The sample format.
+/// @param source A pointer to an array of @a numberOfSamples Arcadia.Real32 values.
+/// @param target A pointer to an array of @a numberOfSamples samples of the specified sample format.
+/// @param numberOfSamples The number of samples.
+/// @error #Arcadia_Status_ArgumentValueInvalid @a sampleFormat is not a valid sample format
+/// @error #Arcadia_Status_ArgumentValueInvalid a source value is no number
+void
+Arcadia_Media_quantize
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleFormat sampleFormat,
+    Arcadia_Real32Value const* source,
+    void* target,
+    Arcadia_SizeValue numberOfSamples
+  );
+
 #endif // ARCADIA_MEDIA_QUANTIZATION_H_INCLUDED
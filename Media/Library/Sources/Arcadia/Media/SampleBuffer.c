@@ -233,49 +233,15 @@ Arcadia_Media_SampleBuffer_fill
     Arcadia_Media_DSP* dsp
   )
 {
-  // @todo If Arcadia_Media_DSP_generate could directly write to an array of Bytes, we would not have to allocate a temporary Byte buffer.
-  // However, we could actually use a Byte buffer as the backing array of the sample buffer.
   const Arcadia_Integer32Value SAMPLERATE = Arcadia_Media_SampleBuffer_getSampleRate(thread, self);
-  const Arcadia_Integer32Value NUMBEROFSAMPLES = SAMPLERATE * Arcadia_Media_SampleBuffer_getLength(thread, self);
-  Arcadia_ByteArrayBuilder* temporary = Arcadia_ByteArrayBuilder_create(thread);
-  Arcadia_Media_DSP_generate(thread, (Arcadia_Media_DSP*)dsp, Arcadia_Media_SampleBuffer_getSampleRate(thread, self), NUMBEROFSAMPLES, temporary);
-
-  switch (Arcadia_Media_SampleBuffer_getSampleFormat(thread, self)) {
-    case Arcadia_Media_SampleFormat_Integer16: {
-      Arcadia_Real32Value* source = (Arcadia_Real32Value*)Arcadia_ByteArrayBuilder_getBytes(thread, temporary);
-      Arcadia_Integer16Value* p = (Arcadia_Integer16Value*)self->bytes;
-      for (Arcadia_SizeValue i = 0; i < NUMBEROFSAMPLES; ++i) {
-        Arcadia_Integer16Value sample = Arcadia_Media_quantizeInteger16(thread, source[i]);
-        p[i] = sample;
-      }
-    } break;
-    case Arcadia_Media_SampleFormat_Integer8: {
-      Arcadia_Real32Value* source = (Arcadia_Real32Value*)Arcadia_ByteArrayBuilder_getBytes(thread, temporary);
-      Arcadia_Integer16Value* p = (Arcadia_Integer16Value*)self->bytes;
-      for (Arcadia_SizeValue i = 0; i < NUMBEROFSAMPLES; ++i) {
-        Arcadia_Integer16Value sample = Arcadia_Media_quantizeInteger16(thread, source[i]);
-        p[i] = sample;
-      }
-    } break;
-    case Arcadia_Media_SampleFormat_Natural16: {
-      Arcadia_Real32Value* source = (Arcadia_Real32Value*)Arcadia_ByteArrayBuilder_getBytes(thread, temporary);
-      Arcadia_Natural16Value* p = (Arcadia_Natural16Value*)self->bytes;
-      for (Arcadia_SizeValue i = 0; i < NUMBEROFSAMPLES; ++i) {
-        Arcadia_Natural16Value sample = Arcadia_Media_quantizeNatural16(thread, source[i]);
-        p[i] = sample;
-      }
-    } break;
-    case Arcadia_Media_SampleFormat_Natural8: {
-      Arcadia_Real32Value* source = (Arcadia_Real32Value*)Arcadia_ByteArrayBuilder_getBytes(thread, temporary);
-      Arcadia_Natural8Value* p = (Arcadia_Natural8Value*)self->bytes;
-      for (Arcadia_SizeValue i = 0; i < NUMBEROFSAMPLES; ++i) {
-        Arcadia_Natural8Value sample = Arcadia_Media_quantizeNatural8(thread, source[i]);
-        p[i] = sample;
-      }
-    } break;
-    default: {
-      Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
-      Arcadia_Thread_jump(thread);
-    } break;
-  };
+  const Arcadia_Natural64Value NUMBEROFSAMPLES = (Arcadia_Natural64Value)SAMPLERATE * (Arcadia_Natural64Value)Arcadia_Media_SampleBuffer_getLength(thread, self);
+  const Arcadia_SizeValue BYTESPERSAMPLE = Arcadia_Media_SampleFormat_getNumberOfBytes(thread, self->sampleFormat);
+  // Generate and quantize the signal block by block such that the block stays in the cache.
+  Arcadia_Real32Value block[Arcadia_Media_DSP_BlockSize];
+  for (Arcadia_Natural64Value i = 0; i < NUMBEROFSAMPLES;) {
+    Arcadia_Natural32Value n = NUMBEROFSAMPLES - i < Arcadia_Media_DSP_BlockSize ? (Arcadia_Natural32Value)(NUMBEROFSAMPLES - i) : Arcadia_Media_DSP_BlockSize;
+    Arcadia_Media_DSP_generate(thread, (Arcadia_Media_DSP*)dsp, SAMPLERATE, i, n, 1, block);
+    Arcadia_Media_quantize(thread, self->sampleFormat, block, (Arcadia_Natural8Value*)self->bytes + i * BYTESPERSAMPLE, n);
+    i += n;
+  }
 }
@@ -0,0 +1,261 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#define ARCADIA_MEDIA_MODULE (1)
+#include "Arcadia/Media/SampleStream.h"
+
+#include "Arcadia/Media/DSP.h"
+#include "Arcadia/Media/Quantization.h"
+
+/// @code
+/// construct(source:Arcadia.Media.DSP|Arcadia.ADL.PackEntry,length:Integer32,sampleRate:Integer32,sampleFormat:Arcadia.Media.SampleFormat)
+/// @endcode
+static void
+Arcadia_Media_SampleStream_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleStream* self
+  );
+
+static void
+Arcadia_Media_SampleStream_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleStreamDispatch* self
+  );
+
+static void
+Arcadia_Media_SampleStream_visitImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleStream* self
+  );
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_Media_SampleStream_constructImpl,
+  .visit = (Arcadia_Object_VisitCallbackFunction*)&Arcadia_Media_SampleStream_visitImpl,
+  .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_Media_SampleStream_initializeDispatchImpl,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.Media.SampleStream", Arcadia_Media_SampleStream,
+                         u8"Arcadia.Object", Arcadia_Object,
+                         &_typeOperations);
+
+static void
+Arcadia_Media_SampleStream_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleStream* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_Media_SampleStream);
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  if (4 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Value source = Arcadia_ValueStack_getValue(thread, 4);
+  if (Arcadia_Value_isInstanceOf(thread, &source, _Arcadia_ADL_PackEntry_getType(thread))) {
+    self->dsp = NULL;
+    self->samples = (Arcadia_ADL_PackEntry*)Arcadia_Value_getObjectReferenceValue(&source);
+  } else {
+    self->dsp = (Arcadia_Media_DSP*)Arcadia_ValueStack_getObjectReferenceValueChecked(thread, 4, _Arcadia_Media_DSP_getType(thread));
+    self->samples = NULL;
+  }
+  self->length = Arcadia_ValueStack_getInteger32Value(thread, 3);
+  self->sampleRate = Arcadia_ValueStack_getInteger32Value(thread, 2);
+  Arcadia_EnumerationValue enumerationValue = Arcadia_ValueStack_getEnumerationValue(thread, 1);
+  if (!Arcadia_Type_isDescendantType(thread, enumerationValue.type, _Arcadia_Media_SampleFormat_getType(thread))) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentTypeInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->sampleFormat = enumerationValue.value;
+  // Validate the sample format.
+  Arcadia_Media_SampleFormat_getNumberOfBytes(thread, self->sampleFormat);
+  if (self->length < 0 || self->sampleRate < 1) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  // The asset pack entry must provide all samples.
+  if (self->samples) {
+    Arcadia_Natural64Value numberOfBytes = (Arcadia_Natural64Value)self->length * (Arcadia_Natural64Value)self->sampleRate
+                                         * (Arcadia_Natural64Value)Arcadia_Media_SampleFormat_getNumberOfBytes(thread, self->sampleFormat);
+    if (numberOfBytes > Arcadia_ADL_PackEntry_getNumberOfBytes(thread, self->samples)) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+      Arcadia_Thread_jump(thread);
+    }
+  }
+  self->position = 0;
+  Arcadia_LeaveConstructor(Arcadia_Media_SampleStream);
+}
+
+static void
+Arcadia_Media_SampleStream_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleStreamDispatch* self
+  )
+{ }
+
+static void
+Arcadia_Media_SampleStream_visitImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleStream* self
+  )
+{
+  if (self->dsp) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->dsp);
+  }
+  if (self->samples) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->samples);
+  }
+}
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+Arcadia_Media_SampleFormat
+Arcadia_Media_SampleStream_getSampleFormat
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleStream* self
+  )
+{ return self->sampleFormat; }
+
+Arcadia_Integer32Value
+Arcadia_Media_SampleStream_getSampleRate
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleStream* self
+  )
+{ return self->sampleRate; }
+
+Arcadia_Integer32Value
+Arcadia_Media_SampleStream_getLength
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleStream* self
+  )
+{ return self->length; }
+
+Arcadia_BooleanValue
+Arcadia_Media_SampleStream_isAtEnd
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleStream* self
+  )
+{ return self->position == (Arcadia_Natural64Value)self->length * (Arcadia_Natural64Value)self->sampleRate; }
+
+Arcadia_SizeValue
+Arcadia_Media_SampleStream_read
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleStream* self,
+    void* target,
+    Arcadia_SizeValue numberOfSamples
+  )
+{
+  Arcadia_Natural64Value remaining = (Arcadia_Natural64Value)self->length * (Arcadia_Natural64Value)self->sampleRate - self->position;
+  if (numberOfSamples > remaining) {
+    numberOfSamples = (Arcadia_SizeValue)remaining;
+  }
+  if (numberOfSamples > Arcadia_Natural32Value_Maximum) {
+    numberOfSamples = Arcadia_Natural32Value_Maximum;
+  }
+  if (!numberOfSamples) {
+    return 0;
+  }
+  const Arcadia_SizeValue bytesPerSample = Arcadia_Media_SampleFormat_getNumberOfBytes(thread, self->sampleFormat);
+  if (self->samples) {
+    Arcadia_Memory_copy(thread, target, Arcadia_ADL_PackEntry_getBytes(thread, self->samples) + self->position * bytesPerSample, numberOfSamples * bytesPerSample);
+    self->position += numberOfSamples;
+    return numberOfSamples;
+  }
+  Arcadia_Real32Value block[Arcadia_Media_DSP_BlockSize];
+  for (Arcadia_SizeValue i = 0; i < numberOfSamples;) {
+    Arcadia_Natural32Value n = numberOfSamples - i < Arcadia_Media_DSP_BlockSize ? (Arcadia_Natural32Value)(numberOfSamples - i) : Arcadia_Media_DSP_BlockSize;
+    Arcadia_Media_DSP_generate(thread, self->dsp, (Arcadia_Natural32Value)self->sampleRate, self->position, n, 1, block);
+    Arcadia_Media_quantize(thread, self->sampleFormat, block, (Arcadia_Natural8Value*)target + i * bytesPerSample, n);
+    self->position += n;
+    i += n;
+  }
+  return numberOfSamples;
+}
+
+void
+Arcadia_Media_SampleStream_rewind
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleStream* self
+  )
+{ self->position = 0; }
+
+Arcadia_Media_SampleStream*
+Arcadia_Media_SampleStream_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_DSP* dsp,
+    Arcadia_Integer32Value length,
+    Arcadia_Integer32Value sampleRate,
+    Arcadia_Media_SampleFormat sampleFormat
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  if (dsp) {
+    Arcadia_ValueStack_pushObjectReferenceValue(thread, dsp);
+  } else {
+    Arcadia_ValueStack_pushVoidValue(thread, Arcadia_VoidValue_Void);
+  }
+  Arcadia_ValueStack_pushInteger32Value(thread, length);
+  Arcadia_ValueStack_pushInteger32Value(thread, sampleRate);
+  Arcadia_ValueStack_pushEnumerationValue(thread, Arcadia_EnumerationValue_make(_Arcadia_Media_SampleFormat_getType(thread), sampleFormat));
+  Arcadia_ValueStack_pushNatural8Value(thread, 4);
+  ARCADIA_CREATEOBJECT(Arcadia_Media_SampleStream);
+}
+
+Arcadia_Media_SampleStream*
+Arcadia_Media_SampleStream_createFromPackEntry
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackEntry* entry
+  )
+{
+  if (!entry || Arcadia_ADL_PackFormat_Kind_SampleBuffer != Arcadia_ADL_PackEntry_getKind(thread, entry) || 1 != Arcadia_ADL_PackEntry_getParameter(thread, entry, 3)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Natural32Value length = Arcadia_ADL_PackEntry_getParameter(thread, entry, 0),
+                         sampleRate = Arcadia_ADL_PackEntry_getParameter(thread, entry, 1);
+  if (length > Arcadia_Integer32Value_Maximum || sampleRate > Arcadia_Integer32Value_Maximum) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  Arcadia_ValueStack_pushObjectReferenceValue(thread, entry);
+  Arcadia_ValueStack_pushInteger32Value(thread, (Arcadia_Integer32Value)length);
+  Arcadia_ValueStack_pushInteger32Value(thread, (Arcadia_Integer32Value)sampleRate);
+  Arcadia_ValueStack_pushEnumerationValue(thread, Arcadia_EnumerationValue_make(_Arcadia_Media_SampleFormat_getType(thread), (Arcadia_Media_SampleFormat)Arcadia_ADL_PackEntry_getParameter(thread, entry, 2)));
+  Arcadia_ValueStack_pushNatural8Value(thread, 4);
+  ARCADIA_CREATEOBJECT(Arcadia_Media_SampleStream);
+}
@@ -0,0 +1,148 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_MEDIA_SAMPLESTREAM_H_INCLUDED)
+#define ARCADIA_MEDIA_SAMPLESTREAM_H_INCLUDED
+
+#if !defined(ARCADIA_MEDIA_MODULE) || 1 != ARCADIA_MEDIA_MODULE
+  #error("do not include directly, include `Arcadia/Media/Include.h` instead")
+#endif
+#include "Arcadia/Ring2/Include.h"
+#include "Arcadia/Media/SampleFormat.h"
+#include "Arcadia/ADL/Include.h"
+typedef struct Arcadia_Media_DSP Arcadia_Media_DSP;
+
+/// @brief A sample stream generates the PCM data of a signal block by block.
+/// In contrast to a sample buffer, a sample stream does not keep the PCM data of the entire signal in memory.
+/// A sample stream either generates its samples by a DSP or reads the baked samples of an asset pack entry.
+Arcadia_declareObjectType(u8"Arcadia.Media.SampleStream", Arcadia_Media_SampleStream,
+                          u8"Arcadia.Object");
+
+struct Arcadia_Media_SampleStreamDispatch {
+  Arcadia_ObjectDispatch parent;
+};
+
+struct Arcadia_Media_SampleStream {
+  Arcadia_Object _parent;
+  /// The DSP generating the signal of this sample stream or the null pointer.
+  Arcadia_Media_DSP* dsp;
+  /// The asset pack entry providing the samples of this sample stream or the null pointer.
+  Arcadia_ADL_PackEntry* samples;
+  /// The sample format of this sample stream.
+  Arcadia_Media_SampleFormat sampleFormat;
+  /// The length, in seconds, of this sample stream.
+  Arcadia_Integer32Value length;
+  /// The sample rate, in Hz, of this sample stream.
+  Arcadia_Integer32Value sampleRate;
+  /// The index of the next sample to generate.
+  Arcadia_Natural64Value position;
+};
+
+/// @brief Get the sample format of this sample stream.
+/// @param self A pointer to this sample stream.
+/// @return The sample format of this sample stream.
+Arcadia_Media_SampleFormat
+Arcadia_Media_SampleStream_getSampleFormat
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleStream* self
+  );
+
+/// @brief Get the sample rate of this sample stream.
+/// @param self A pointer to this sample stream.
+/// @return The sample rate, in Hertz, of this sample stream.
+Arcadia_Integer32Value
+Arcadia_Media_SampleStream_getSampleRate
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleStream* self
+  );
+
+/// @brief Get the length, in seconds, of this sample stream.
+/// @param self A pointer to this sample stream.
+/// @return The length, in seconds, of this sample stream.
+Arcadia_Integer32Value
+Arcadia_Media_SampleStream_getLength
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleStream* self
+  );
+
+/// @brief Get if this sample stream is at its end.
+/// @param self A pointer to this sample stream.
+/// @return #Arcadia_BooleanValue_True if all samples of this sample stream were read. #Arcadia_BooleanValue_False otherwise.
+Arcadia_BooleanValue
+Arcadia_Media_SampleStream_isAtEnd
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleStream* self
+  );
+
+/// @brief Read the next samples of this sample stream.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this sample stream.
+/// @param target A pointer to an array of at least @a numberOfSamples samples of the sample format of this sample stream.
+/// @param numberOfSamples The maximum number of samples to read.
+/// @return The number of samples read.
+/// This is less than @a numberOfSamples only if the end of this sample stream was reached.
+Arcadia_SizeValue
+Arcadia_Media_SampleStream_read
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleStream* self,
+    void* target,
+    Arcadia_SizeValue numberOfSamples
+  );
+
+/// @brief Rewind this sample stream to its first sample.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this sample stream.
+void
+Arcadia_Media_SampleStream_rewind
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleStream* self
+  );
+
+/// @brief Create a sample stream.
+/// @param thread A pointer to this thread.
+/// @param dsp A pointer to the DSP generating the signal.
+/// @param length The length, in seconds, of the sample stream.
+/// @param sampleRate The sample rate, in Hertz, of the sample stream.
+/// @param sampleFormat The sample format of the sample stream.
+/// @return A pointer to the sample stream.
+Arcadia_Media_SampleStream*
+Arcadia_Media_SampleStream_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_DSP* dsp,
+    Arcadia_Integer32Value length,
+    Arcadia_Integer32Value sampleRate,
+    Arcadia_Media_SampleFormat sampleFormat
+  );
+
+/// @brief Create a sample stream reading the samples of an asset pack entry.
+/// @param thread A pointer to this thread.
+/// @param entry A pointer to the Arcadia_ADL_PackFormat_Kind_SampleBuffer asset pack entry.
+/// @return A pointer to the sample stream.
+/// @error Arcadia_Status_ArgumentValueInvalid @a entry is not a single channel sample buffer entry
+Arcadia_Media_SampleStream*
+Arcadia_Media_SampleStream_createFromPackEntry
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackEntry* entry
+  );
+
+#endif // ARCADIA_MEDIA_SAMPLESTREAM_H_INCLUDED
@@ -0,0 +1,256 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Arcadia/Media/Include.h"
+
+// The maximum absolute error of a sample of Arcadia.Media.DSP.SineWave.
+#define SineWaveErrorBound (2e-6)
+
+#define NumberOfFrames (4096)
+
+static const Arcadia_Natural32Value g_sampleRates[] = { 1, 8000, 11025, 44100, 48000, 192000, 3000000000 };
+
+static const Arcadia_Integer32Value g_frequencies[] = { 1, 3, 440, 1000, 12345, 50000, 96001 };
+
+static const Arcadia_Natural64Value g_offsets[] = { 0, 1, 63, 44100 * 60 * 60, UINT64_C(0xfffffffffffff) };
+
+static Arcadia_Natural32Value
+getPhase
+  (
+    Arcadia_Natural32Value sampleRate,
+    Arcadia_Integer32Value frequency,
+    Arcadia_Natural64Value frame
+  )
+{ return (Arcadia_Natural32Value)(((frame % sampleRate) * ((Arcadia_Natural64Value)frequency % sampleRate)) % sampleRate); }
+
+// Assert the sine wave is within SineWaveErrorBound of sin(2 pi f i / r) computed in double precision.
+static void
+testSineWaveAccuracy
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static const double PI = 3.14159265358979323846;
+  Arcadia_Real32Value* frames = malloc(NumberOfFrames * sizeof(Arcadia_Real32Value));
+  Arcadia_Tests_assertTrue(thread, NULL != frames);
+  double maximumError = 0.;
+  for (Arcadia_SizeValue i = 0; i < sizeof(g_frequencies) / sizeof(g_frequencies[0]); ++i) {
+    Arcadia_Media_DSP* dsp = (Arcadia_Media_DSP*)Arcadia_Media_DSP_SineWave_create(thread, g_frequencies[i]);
+    for (Arcadia_SizeValue j = 0; j < sizeof(g_sampleRates) / sizeof(g_sampleRates[0]); ++j) {
+      for (Arcadia_SizeValue k = 0; k < sizeof(g_offsets) / sizeof(g_offsets[0]); ++k) {
+        Arcadia_Media_DSP_generate(thread, dsp, g_sampleRates[j], g_offsets[k], NumberOfFrames, 1, frames);
+        for (Arcadia_SizeValue l = 0; l < NumberOfFrames; ++l) {
+          Arcadia_Natural32Value phase = getPhase(g_sampleRates[j], g_frequencies[i], g_offsets[k] + l);
+          double expected = sin(2. * PI * (double)phase / (double)g_sampleRates[j]);
+          double error = fabs(expected - (double)frames[l]);
+          maximumError = error > maximumError ? error : maximumError;
+        }
+      }
+    }
+  }
+  free(frames);
+  Arcadia_Tests_assertTrue(thread, maximumError <= SineWaveErrorBound);
+}
+
+// Assert the square wave and the sawtooth wave agree with their definitions.
+static void
+testSquareWaveAndSawtoothWave
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Real32Value* frames = malloc(NumberOfFrames * sizeof(Arcadia_Real32Value));
+  Arcadia_Tests_assertTrue(thread, NULL != frames);
+  for (Arcadia_SizeValue i = 0; i < sizeof(g_frequencies) / sizeof(g_frequencies[0]); ++i) {
+    Arcadia_Media_DSP* squareWave = (Arcadia_Media_DSP*)Arcadia_Media_DSP_SquareWave_create(thread, g_frequencies[i]);
+    Arcadia_Media_DSP* sawtoothWave = (Arcadia_Media_DSP*)Arcadia_Media_DSP_SawtoothWave_create(thread, g_frequencies[i]);
+    for (Arcadia_SizeValue j = 0; j < sizeof(g_sampleRates) / sizeof(g_sampleRates[0]); ++j) {
+      for (Arcadia_SizeValue k = 0; k < sizeof(g_offsets) / sizeof(g_offsets[0]); ++k) {
+        Arcadia_Media_DSP_generate(thread, squareWave, g_sampleRates[j], g_offsets[k], NumberOfFrames, 1, frames);
+        for (Arcadia_SizeValue l = 0; l < NumberOfFrames; ++l) {
+          Arcadia_Natural32Value phase = getPhase(g_sampleRates[j], g_frequencies[i], g_offsets[k] + l);
+          Arcadia_Real32Value expected = (Arcadia_Natural64Value)phase * 2 < g_sampleRates[j] ? +1.f : -1.f;
+          Arcadia_Tests_assertTrue(thread, expected == frames[l]);
+        }
+        Arcadia_Media_DSP_generate(thread, sawtoothWave, g_sampleRates[j], g_offsets[k], NumberOfFrames, 1, frames);
+        for (Arcadia_SizeValue l = 0; l < NumberOfFrames; ++l) {
+          Arcadia_Natural32Value phase = getPhase(g_sampleRates[j], g_frequencies[i], g_offsets[k] + l);
+          double expected = (double)phase / (double)g_sampleRates[j] - 0.5;
+          Arcadia_Tests_assertTrue(thread, fabs(expected - (double)frames[l]) <= 1e-6);
+        }
+      }
+    }
+  }
+  free(frames);
+}
+
+// Assert the white noise is uniformly distributed in [-1,+1) and its consecutive samples are uncorrelated.
+static void
+testWhiteNoise
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static const Arcadia_Natural32Value n = 1 << 20;
+  Arcadia_Real32Value* frames = malloc(n * sizeof(Arcadia_Real32Value));
+  Arcadia_Tests_assertTrue(thread, NULL != frames);
+  Arcadia_Media_DSP* dsp = (Arcadia_Media_DSP*)Arcadia_Media_DSP_WhiteNoise_create(thread);
+  for (Arcadia_SizeValue k = 0; k < sizeof(g_offsets) / sizeof(g_offsets[0]); ++k) {
+    Arcadia_Media_DSP_generate(thread, dsp, 44100, g_offsets[k], n, 1, frames);
+    double sum = 0., sumOfSquares = 0., sumOfProducts = 0.;
+    Arcadia_SizeValue histogram[16] = { 0 };
+    for (Arcadia_SizeValue i = 0; i < n; ++i) {
+      Arcadia_Tests_assertTrue(thread, -1.f <= frames[i] && frames[i] < +1.f);
+      sum += frames[i];
+      sumOfSquares += (double)frames[i] * (double)frames[i];
+      if (i > 0) {
+        sumOfProducts += (double)frames[i] * (double)frames[i - 1];
+      }
+      histogram[(Arcadia_SizeValue)((frames[i] + 1.f) * 8.f)]++;
+    }
+    double mean = sum / n, variance = sumOfSquares / n - mean * mean;
+    double autocorrelation = (sumOfProducts / (n - 1) - mean * mean) / variance;
+    Arcadia_Tests_assertTrue(thread, fabs(mean) < 0.005);
+    Arcadia_Tests_assertTrue(thread, fabs(variance - 1. / 3.) < 0.005);
+    Arcadia_Tests_assertTrue(thread, fabs(autocorrelation) < 0.005);
+    for (Arcadia_SizeValue i = 0; i < 16; ++i) {
+      Arcadia_Tests_assertTrue(thread, fabs((double)histogram[i] / (double)n - 1. / 16.) < 0.002);
+    }
+  }
+  free(frames);
+}
+
+// Assert generating a signal in blocks yields the same samples as generating that signal at once.
+static void
+testBlocks
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static const Arcadia_Natural32Value blockSizes[] = { 1, 3, 63, 64, 65, 1000, 1024, 1025 };
+  Arcadia_Media_DSP* dsps[] = {
+    (Arcadia_Media_DSP*)Arcadia_Media_DSP_SawtoothWave_create(thread, 440),
+    (Arcadia_Media_DSP*)Arcadia_Media_DSP_SineWave_create(thread, 440),
+    (Arcadia_Media_DSP*)Arcadia_Media_DSP_SquareWave_create(thread, 440),
+    (Arcadia_Media_DSP*)Arcadia_Media_DSP_WhiteNoise_create(thread),
+  };
+  Arcadia_Real32Value expected[NumberOfFrames], actual[NumberOfFrames];
+  for (Arcadia_SizeValue i = 0; i < sizeof(dsps) / sizeof(dsps[0]); ++i) {
+    for (Arcadia_SizeValue k = 0; k < sizeof(g_offsets) / sizeof(g_offsets[0]); ++k) {
+      // Start such that the frames cross the offset, which is one less than a multiple of 2^32 for the last offset.
+      Arcadia_Natural64Value offset = g_offsets[k] >= NumberOfFrames / 2 ? g_offsets[k] - NumberOfFrames / 2 : 0;
+      Arcadia_Media_DSP_generate(thread, dsps[i], 44100, offset, NumberOfFrames, 1, expected);
+      for (Arcadia_SizeValue j = 0; j < sizeof(blockSizes) / sizeof(blockSizes[0]); ++j) {
+        for (Arcadia_Natural32Value l = 0; l < NumberOfFrames; l += blockSizes[j]) {
+          Arcadia_Natural32Value n = NumberOfFrames - l < blockSizes[j] ? NumberOfFrames - l : blockSizes[j];
+          Arcadia_Media_DSP_generate(thread, dsps[i], 44100, offset + l, n, 1, actual + l);
+        }
+      }
+    }
+  }
+}
+
+// Assert each channel of a multi-channel signal is the single-channel signal.
+static void
+testChannels
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static const Arcadia_Natural32Value numbersOfChannels[] = { 2, 3, 8 };
+  Arcadia_Media_DSP* dsp = (Arcadia_Media_DSP*)Arcadia_Media_DSP_SineWave_create(thread, 440);
+  Arcadia_Real32Value* expected = malloc(NumberOfFrames * sizeof(Arcadia_Real32Value));
+  Arcadia_Real32Value* actual = malloc(NumberOfFrames * 8 * sizeof(Arcadia_Real32Value));
+  Arcadia_Tests_assertTrue(thread, NULL != expected && NULL != actual);
+  Arcadia_Media_DSP_generate(thread, dsp, 44100, 7, NumberOfFrames, 1, expected);
+  for (Arcadia_SizeValue i = 0; i < sizeof(numbersOfChannels) / sizeof(numbersOfChannels[0]); ++i) {
+    Arcadia_Natural32Value m = numbersOfChannels[i];
+    Arcadia_Media_DSP_generate(thread, dsp, 44100, 7, NumberOfFrames, m, actual);
+    for (Arcadia_SizeValue j = 0; j < NumberOfFrames; ++j) {
+      for (Arcadia_SizeValue k = 0; k < m; ++k) {
+        Arcadia_Tests_assertTrue(thread, expected[j] == actual[j * m + k]);
+      }
+    }
+  }
+  free(actual);
+  free(expected);
+}
+
+static void
+assertArgumentValueInvalid
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural32Value sampleRate,
+    Arcadia_Natural32Value numberOfChannels,
+    Arcadia_Real32Value* target
+  )
+{
+  Arcadia_Media_DSP* dsp = (Arcadia_Media_DSP*)Arcadia_Media_DSP_SineWave_create(thread, 440);
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_Media_DSP_generate(thread, dsp, sampleRate, 0, 1, numberOfChannels, target);
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_BooleanValue_False);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_Status_ArgumentValueInvalid == Arcadia_Thread_getStatus(thread));
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+}
+
+static void
+testInvalidArguments
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Real32Value frame;
+  assertArgumentValueInvalid(thread, 0, 1, &frame);
+  assertArgumentValueInvalid(thread, 44100, 0, &frame);
+  assertArgumentValueInvalid(thread, 44100, 1, NULL);
+}
+
+int
+main
+  (
+    int argc,
+    char **argv
+  )
+{
+  if (!Arcadia_Tests_safeExecute(&testSineWaveAccuracy)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testSquareWaveAndSawtoothWave)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testWhiteNoise)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testBlocks)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testChannels)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testInvalidArguments)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
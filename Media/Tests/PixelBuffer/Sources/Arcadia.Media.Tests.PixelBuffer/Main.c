@@ -25,6 +25,83 @@ test1
   )
 {/*Intentionally empty.*/}
 
+static void
+assertDirtyRectangle
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_PixelBuffer* pixelBuffer,
+    Arcadia_Integer32Value expectedLeft,
+    Arcadia_Integer32Value expectedTop,
+    Arcadia_Integer32Value expectedWidth,
+    Arcadia_Integer32Value expectedHeight
+  )
+{
+  Arcadia_Integer32Value left, top, width, height;
+  Arcadia_BooleanValue dirty = Arcadia_Media_PixelBuffer_getDirtyRectangle(thread, pixelBuffer, &left, &top, &width, &height);
+  if (0 == expectedWidth || 0 == expectedHeight) {
+    Arcadia_Tests_assertTrue(thread, !dirty);
+  } else {
+    Arcadia_Tests_assertTrue(thread, dirty);
+    Arcadia_Tests_assertTrue(thread, expectedLeft == left);
+    Arcadia_Tests_assertTrue(thread, expectedTop == top);
+    Arcadia_Tests_assertTrue(thread, expectedWidth == width);
+    Arcadia_Tests_assertTrue(thread, expectedHeight == height);
+  }
+}
+
+// Assert the dirty rectangle of a pixel buffer encloses exactly the modified pixels.
+static void
+testDirtyRectangle
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Media_PixelBuffer* pixelBuffer = Arcadia_Media_PixelBuffer_create(thread, 0, 16, 8, Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8);
+  // A new pixel buffer is dirty.
+  assertDirtyRectangle(thread, pixelBuffer, 0, 0, 16, 8);
+  Arcadia_Media_PixelBuffer_clearDirtyRectangle(thread, pixelBuffer);
+  assertDirtyRectangle(thread, pixelBuffer, 0, 0, 0, 0);
+  // Setting pixels adds them to the dirty rectangle.
+  Arcadia_Media_PixelBuffer_setPixelRGBA(thread, pixelBuffer, 3, 2, 255, 0, 0, 255);
+  assertDirtyRectangle(thread, pixelBuffer, 3, 2, 1, 1);
+  Arcadia_Media_PixelBuffer_setPixelRGBA(thread, pixelBuffer, 5, 6, 255, 0, 0, 255);
+  assertDirtyRectangle(thread, pixelBuffer, 3, 2, 3, 5);
+  // Filled rectangles are clipped.
+  Arcadia_Media_PixelBuffer_clearDirtyRectangle(thread, pixelBuffer);
+  Arcadia_Media_PixelBuffer_fillRectangle(thread, pixelBuffer, 12, -4, 8, 6, 0, 255, 0, 255);
+  assertDirtyRectangle(thread, pixelBuffer, 12, 0, 4, 2);
+  Arcadia_Media_PixelBuffer_clearDirtyRectangle(thread, pixelBuffer);
+  Arcadia_Media_PixelBuffer_fillRectangle(thread, pixelBuffer, 20, 20, 8, 6, 0, 255, 0, 255);
+  assertDirtyRectangle(thread, pixelBuffer, 0, 0, 0, 0);
+  // Swapping rows marks the rows and the rows in between.
+  Arcadia_Media_PixelBuffer_swapRows(thread, pixelBuffer, 6, 1);
+  assertDirtyRectangle(thread, pixelBuffer, 0, 1, 16, 6);
+  Arcadia_Media_PixelBuffer_clearDirtyRectangle(thread, pixelBuffer);
+  Arcadia_Media_PixelBuffer_addDirtyRectangle(thread, pixelBuffer, -2, 7, 4, 4);
+  assertDirtyRectangle(thread, pixelBuffer, 0, 7, 2, 1);
+  // Assigning a pixel buffer of the same geometry only marks the pixels which differ.
+  Arcadia_Media_PixelBuffer* other = Arcadia_Media_PixelBuffer_createClone(thread, pixelBuffer);
+  Arcadia_Media_PixelBuffer_setPixelRGBA(thread, other, 9, 4, 0, 0, 255, 255);
+  Arcadia_Media_PixelBuffer_setPixelRGBA(thread, other, 11, 5, 0, 0, 255, 255);
+  Arcadia_Media_PixelBuffer_clearDirtyRectangle(thread, pixelBuffer);
+  Arcadia_Media_PixelBuffer_assign(thread, pixelBuffer, other);
+  assertDirtyRectangle(thread, pixelBuffer, 9, 4, 3, 2);
+  Arcadia_Natural8Value r, g, b, a;
+  Arcadia_Media_PixelBuffer_getPixelRGBA(thread, pixelBuffer, 11, 5, &r, &g, &b, &a);
+  Arcadia_Tests_assertTrue(thread, 0 == r && 0 == g && 255 == b && 255 == a);
+  Arcadia_Media_PixelBuffer_clearDirtyRectangle(thread, pixelBuffer);
+  Arcadia_Media_PixelBuffer_assign(thread, pixelBuffer, other);
+  assertDirtyRectangle(thread, pixelBuffer, 0, 0, 0, 0);
+  // Assigning a pixel buffer of a different geometry marks the entire pixel buffer.
+  other = Arcadia_Media_PixelBuffer_create(thread, 0, 4, 4, Arcadia_Media_PixelFormat_RedGreenBlueNatural8);
+  Arcadia_Media_PixelBuffer_assign(thread, pixelBuffer, other);
+  assertDirtyRectangle(thread, pixelBuffer, 0, 0, 4, 4);
+  // Resizing marks the entire pixel buffer.
+  Arcadia_Media_PixelBuffer_clearDirtyRectangle(thread, pixelBuffer);
+  Arcadia_Media_PixelBuffer_setWidth(thread, pixelBuffer, 5);
+  assertDirtyRectangle(thread, pixelBuffer, 0, 0, 5, 4);
+}
+
 int
 main
   (
@@ -35,5 +112,8 @@ main
   if (!Arcadia_Tests_safeExecute(&test1)) {
     return EXIT_FAILURE;
   }
+  if (!Arcadia_Tests_safeExecute(&testDirtyRectangle)) {
+    return EXIT_FAILURE;
+  }
   return EXIT_SUCCESS;
 }
@@ -66,6 +66,36 @@ test1
   }
 }
 
+// Assert streaming a signal in blocks yields the same samples as filling a sample buffer with that signal.
+static void
+testSampleStream
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static const Arcadia_SizeValue blockSizes[] = { 1, 333, 4096, 8000 };
+  Arcadia_Media_DSP* dsp = (Arcadia_Media_DSP*)Arcadia_Media_DSP_SineWave_create(thread, 440);
+  Arcadia_Media_SampleBuffer* sampleBuffer = Arcadia_Media_SampleBuffer_create(thread, 2, 8000, Arcadia_Media_SampleFormat_Integer16);
+  Arcadia_Media_SampleBuffer_fill(thread, sampleBuffer, dsp);
+  const Arcadia_Integer16Value* expected = (const Arcadia_Integer16Value*)sampleBuffer->bytes;
+  for (Arcadia_SizeValue i = 0; i < sizeof(blockSizes) / sizeof(blockSizes[0]); ++i) {
+    Arcadia_Media_SampleStream* sampleStream = Arcadia_Media_SampleStream_create(thread, dsp, 2, 8000, Arcadia_Media_SampleFormat_Integer16);
+    Arcadia_Integer16Value block[8000];
+    Arcadia_SizeValue position = 0;
+    while (!Arcadia_Media_SampleStream_isAtEnd(thread, sampleStream)) {
+      Arcadia_SizeValue n = Arcadia_Media_SampleStream_read(thread, sampleStream, block, blockSizes[i]);
+      Arcadia_Tests_assertTrue(thread, 0 < n && n <= blockSizes[i]);
+      Arcadia_Tests_assertTrue(thread, position + n <= 2 * 8000);
+      Arcadia_Tests_assertTrue(thread, !memcmp(block, expected + position, n * sizeof(Arcadia_Integer16Value)));
+      position += n;
+    }
+    Arcadia_Tests_assertTrue(thread, position == 2 * 8000);
+    Arcadia_Tests_assertTrue(thread, 0 == Arcadia_Media_SampleStream_read(thread, sampleStream, block, blockSizes[i]));
+    Arcadia_Media_SampleStream_rewind(thread, sampleStream);
+    Arcadia_Tests_assertTrue(thread, !Arcadia_Media_SampleStream_isAtEnd(thread, sampleStream));
+  }
+}
+
 int
 main
   (
@@ -76,5 +106,8 @@ main
   if (!Arcadia_Tests_safeExecute(&test1)) {
     return EXIT_FAILURE;
   }
+  if (!Arcadia_Tests_safeExecute(&testSampleStream)) {
+    return EXIT_FAILURE;
+  }
   return EXIT_SUCCESS;
 }
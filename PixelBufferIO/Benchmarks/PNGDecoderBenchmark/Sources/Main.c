@@ -0,0 +1,220 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <string.h>
+
+#include "Arcadia/PixelBufferIO/Include.h"
+#include "Arcadia/PixelBufferIO/PNGEncoder.h"
+#include "Arcadia/Benchmarks/Harness/Driver.h"
+
+#if Arcadia_Configuration_OperatingSystem == Arcadia_Configuration_OperatingSystem_Linux
+  #include <png.h>
+#endif
+
+// The width of a 4K image.
+#define Width (3840)
+
+// The height of a 4K image.
+#define Height (2160)
+
+// The encoded image.
+static Arcadia_ByteArrayBuilder* g_source = NULL;
+
+// The reader and its parameters.
+static Arcadia_Imaging_ImageReader* g_reader = NULL;
+static Arcadia_Imaging_ImageReaderParameters* g_parameters = NULL;
+
+#if Arcadia_Configuration_OperatingSystem == Arcadia_Configuration_OperatingSystem_Linux
+// The pixels decoded by libpng.
+static Arcadia_Natural8Value* g_target = NULL;
+#endif
+
+static Arcadia_String*
+makeString
+  (
+    Arcadia_Thread* thread,
+    char const* bytes
+  )
+{ return Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_create(thread, bytes, strlen(bytes)))); }
+
+// Create a 4K RGBA image with smooth gradients and some noise.
+static Arcadia_Media_PixelBuffer*
+createPixelBuffer
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Media_PixelBuffer* pixelBuffer = Arcadia_Media_PixelBuffer_create(thread, 0, Width, Height, Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8);
+  Arcadia_SizeValue lineStride = Arcadia_Media_PixelBuffer_getLineStride(thread, pixelBuffer);
+  Arcadia_Natural32Value seed = 7;
+  for (Arcadia_SizeValue y = 0; y < Height; ++y) {
+    Arcadia_Natural8Value* p = pixelBuffer->bytes + y * lineStride;
+    for (Arcadia_SizeValue x = 0; x < Width; ++x) {
+      seed = seed * 1664525 + 1013904223;
+      p[0] = (Arcadia_Natural8Value)(x / 15);
+      p[1] = (Arcadia_Natural8Value)(y / 9);
+      p[2] = (Arcadia_Natural8Value)((x + y) / 23 + (seed >> 30));
+      p[3] = (Arcadia_Natural8Value)(255 - (x / 15));
+      p += 4;
+    }
+  }
+  return pixelBuffer;
+}
+
+// Encode the image.
+static void
+setUpSource
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Media_PixelBuffer* pixelBuffer = createPixelBuffer(thread);
+  g_source = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_source);
+  Arcadia_Imaging_PNGEncoder* encoder = Arcadia_Imaging_PNGEncoder_create(thread);
+  Arcadia_Imaging_PNGEncoder_encodeToByteArrayBuilder(thread, encoder, pixelBuffer, g_source);
+}
+
+static void
+setUpReader
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value pixelFormat
+  )
+{
+  setUpSource(thread);
+  Arcadia_Imaging_ImageManager* imageManager = Arcadia_Imaging_ImageManager_getOrCreate(thread);
+  Arcadia_List* readers = Arcadia_Imaging_ImageManager_getReaders(thread, imageManager, makeString(thread, u8"png"));
+  g_reader = (Arcadia_Imaging_ImageReader*)Arcadia_List_getObjectReferenceValueAt(thread, readers, 0);
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_reader);
+  g_parameters = Arcadia_Imaging_ImageReaderParameters_createByteBuffer(thread, g_source, makeString(thread, u8"png"));
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_parameters);
+  Arcadia_Imaging_ImageReaderParameters_setPixelFormat(thread, g_parameters, pixelFormat);
+}
+
+static void
+setUpReaderRGBA
+  (
+    Arcadia_Thread* thread
+  )
+{ setUpReader(thread, Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8); }
+
+static void
+setUpReaderBGRA
+  (
+    Arcadia_Thread* thread
+  )
+{ setUpReader(thread, Arcadia_Media_PixelFormat_BlueGreenRedAlphaNatural8); }
+
+static void
+tearDown
+  (
+    Arcadia_Thread* thread
+  )
+{
+#if Arcadia_Configuration_OperatingSystem == Arcadia_Configuration_OperatingSystem_Linux
+  if (g_target) {
+    Arcadia_Memory_deallocateUnmanaged(thread, g_target);
+    g_target = NULL;
+  }
+#endif
+  if (g_parameters) {
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)g_parameters);
+    g_parameters = NULL;
+  }
+  if (g_reader) {
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)g_reader);
+    g_reader = NULL;
+  }
+  if (g_source) {
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)g_source);
+    g_source = NULL;
+  }
+}
+
+static void
+runReader
+  (
+    Arcadia_Thread* thread
+  )
+{ Arcadia_Imaging_ImageReader_read(thread, g_reader, g_parameters); }
+
+#if Arcadia_Configuration_OperatingSystem == Arcadia_Configuration_OperatingSystem_Linux
+
+static void
+setUpLibPng
+  (
+    Arcadia_Thread* thread
+  )
+{
+  setUpSource(thread);
+  g_target = Arcadia_Memory_allocateUnmanaged(thread, (Arcadia_SizeValue)Width * Height * 4);
+}
+
+static void
+runLibPng
+  (
+    Arcadia_Thread* thread
+  )
+{
+  png_image image;
+  memset(&image, 0, sizeof(png_image));
+  image.version = PNG_IMAGE_VERSION;
+  if (!png_image_begin_read_from_memory(&image, Arcadia_ByteArrayBuilder_getBytes(thread, g_source), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, g_source))) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  image.format = PNG_FORMAT_RGBA;
+  // Do not convert between sRGB and linear.
+  image.flags = PNG_IMAGE_FLAG_FAST;
+  if (!png_image_finish_read(&image, NULL, g_target, 0, NULL)) {
+    png_image_free(&image);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+    Arcadia_Thread_jump(thread);
+  }
+}
+
+#endif
+
+// One operation is one decoded pixel.
+static Arcadia_Benchmarks_Benchmark const g_benchmarks[] = {
+  { u8"PNGImageReader RGBA", Width * Height, &setUpReaderRGBA, &runReader, &tearDown },
+  { u8"PNGImageReader BGRA", Width * Height, &setUpReaderBGRA, &runReader, &tearDown },
+#if Arcadia_Configuration_OperatingSystem == Arcadia_Configuration_OperatingSystem_Linux
+  { u8"libpng RGBA", Width * Height, &setUpLibPng, &runLibPng, &tearDown },
+#endif
+};
+
+static Arcadia_Benchmarks_Benchmark const*
+getBenchmarks
+  (
+    Arcadia_SizeValue* numberOfBenchmarks
+  )
+{
+  *numberOfBenchmarks = sizeof(g_benchmarks) / sizeof(Arcadia_Benchmarks_Benchmark);
+  return g_benchmarks;
+}
+
+static Arcadia_Benchmarks_GetBenchmarks* const g_groups[] = {
+  &getBenchmarks,
+};
+
+int
+main
+  (
+    int argc,
+    char** argv
+  )
+{ return Arcadia_Benchmarks_main(argc, argv, g_groups, sizeof(g_groups) / sizeof(Arcadia_Benchmarks_GetBenchmarks*)); }
@@ -0,0 +1,137 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/PixelBufferIO/Include.h"
+#include "Arcadia/PixelBufferIO/PNGEncoder.h"
+#include "Arcadia/Benchmarks/Harness/Driver.h"
+
+// The width of a 4K image.
+#define Width (3840)
+
+// The height of a 4K image.
+#define Height (2160)
+
+// The image to encode.
+static Arcadia_Media_PixelBuffer* g_pixelBuffer = NULL;
+
+// The encoder.
+static Arcadia_Imaging_PNGEncoder* g_encoder = NULL;
+
+// Create a 4K RGBA image with smooth gradients and some noise.
+static Arcadia_Media_PixelBuffer*
+createPixelBuffer
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Media_PixelBuffer* pixelBuffer = Arcadia_Media_PixelBuffer_create(thread, 0, Width, Height, Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8);
+  Arcadia_SizeValue lineStride = Arcadia_Media_PixelBuffer_getLineStride(thread, pixelBuffer);
+  Arcadia_Natural32Value seed = 7;
+  for (Arcadia_SizeValue y = 0; y < Height; ++y) {
+    Arcadia_Natural8Value* p = pixelBuffer->bytes + y * lineStride;
+    for (Arcadia_SizeValue x = 0; x < Width; ++x) {
+      seed = seed * 1664525 + 1013904223;
+      p[0] = (Arcadia_Natural8Value)(x / 15);
+      p[1] = (Arcadia_Natural8Value)(y / 9);
+      p[2] = (Arcadia_Natural8Value)((x + y) / 23 + (seed >> 30));
+      p[3] = 255;
+      p += 4;
+    }
+  }
+  return pixelBuffer;
+}
+
+// A numberOfWorkers of 0 uses all cores.
+static void
+setUp
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SizeValue numberOfWorkers
+  )
+{
+  g_pixelBuffer = createPixelBuffer(thread);
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_pixelBuffer);
+  g_encoder = Arcadia_Imaging_PNGEncoder_create(thread);
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_encoder);
+  Arcadia_Imaging_PNGEncoder_setNumberOfWorkers(thread, g_encoder, numberOfWorkers);
+}
+
+static void
+setUpSingleWorker
+  (
+    Arcadia_Thread* thread
+  )
+{ setUp(thread, 1); }
+
+static void
+setUpAllCores
+  (
+    Arcadia_Thread* thread
+  )
+{ setUp(thread, 0); }
+
+static void
+tearDown
+  (
+    Arcadia_Thread* thread
+  )
+{
+  if (g_encoder) {
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)g_encoder);
+    g_encoder = NULL;
+  }
+  if (g_pixelBuffer) {
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)g_pixelBuffer);
+    g_pixelBuffer = NULL;
+  }
+}
+
+static void
+run
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_ByteArrayBuilder* target = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_Imaging_PNGEncoder_encodeToByteArrayBuilder(thread, g_encoder, g_pixelBuffer, target);
+}
+
+// One operation is one encoded pixel.
+static Arcadia_Benchmarks_Benchmark const g_benchmarks[] = {
+  { u8"PNGEncoder 1 worker", Width * Height, &setUpSingleWorker, &run, &tearDown },
+  { u8"PNGEncoder all cores", Width * Height, &setUpAllCores, &run, &tearDown },
+};
+
+static Arcadia_Benchmarks_Benchmark const*
+getBenchmarks
+  (
+    Arcadia_SizeValue* numberOfBenchmarks
+  )
+{
+  *numberOfBenchmarks = sizeof(g_benchmarks) / sizeof(Arcadia_Benchmarks_Benchmark);
+  return g_benchmarks;
+}
+
+static Arcadia_Benchmarks_GetBenchmarks* const g_groups[] = {
+  &getBenchmarks,
+};
+
+int
+main
+  (
+    int argc,
+    char** argv
+  )
+{ return Arcadia_Benchmarks_main(argc, argv, g_groups, sizeof(g_groups) / sizeof(Arcadia_Benchmarks_GetBenchmarks*)); }
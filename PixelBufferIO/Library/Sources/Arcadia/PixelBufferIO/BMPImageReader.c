@@ -0,0 +1,368 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/PixelBufferIO/BMPImageReader.h"
+
+#include <string.h>
+
+static void
+Arcadia_Imaging_BMPImageReader_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_BMPImageReader* self
+  );
+
+static void
+Arcadia_Imaging_BMPImageReader_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_BMPImageReaderDispatch* self
+  );
+
+static void
+Arcadia_Imaging_BMPImageReader_visit
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_BMPImageReader* self
+  );
+
+static Arcadia_ImmutableList*
+Arcadia_Imaging_BMPImageReader_getSupportedTypesImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_BMPImageReader* self
+  );
+
+static Arcadia_Media_PixelBuffer*
+Arcadia_Imaging_BMPImageReader_readImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_BMPImageReader* self,
+    Arcadia_Imaging_ImageReaderParameters* source
+  );
+
+// The compression methods.
+#define Compression_RGB (0)
+#define Compression_BitFields (3)
+#define Compression_AlphaBitFields (6)
+
+static inline Arcadia_Natural32Value
+loadNatural32LittleEndian
+  (
+    Arcadia_Natural8Value const* p
+  )
+{ return ((Arcadia_Natural32Value)p[0] << 0) | ((Arcadia_Natural32Value)p[1] << 8) | ((Arcadia_Natural32Value)p[2] << 16) | ((Arcadia_Natural32Value)p[3] << 24); }
+
+static inline Arcadia_Natural16Value
+loadNatural16LittleEndian
+  (
+    Arcadia_Natural8Value const* p
+  )
+{ return (Arcadia_Natural16Value)(((Arcadia_Natural16Value)p[0] << 0) | ((Arcadia_Natural16Value)p[1] << 8)); }
+
+// Get the offset of the Byte selected by a mask.
+// Raise an error if the mask does not select exactly one Byte.
+static Arcadia_SizeValue
+getByteOffset
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural32Value mask
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+    if (mask == (Arcadia_Natural32Value)0xff << (i * 8)) {
+      return i;
+    }
+  }
+  Arcadia_Thread_setStatus(thread, Arcadia_Status_NotImplemented);
+  Arcadia_Thread_jump(thread);
+}
+
+static void
+describeTarget
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value pixelFormat,
+    Arcadia_SizeValue* bytesPerPixel,
+    Arcadia_SizeValue offsets[4]
+  )
+{
+  switch (pixelFormat) {
+    case Arcadia_Media_PixelFormat_AlphaBlueGreenRedNatural8: {
+      *bytesPerPixel = 4;
+      offsets[0] = 3; offsets[1] = 2; offsets[2] = 1; offsets[3] = 0;
+    } break;
+    case Arcadia_Media_PixelFormat_AlphaRedGreenBlueNatural8: {
+      *bytesPerPixel = 4;
+      offsets[0] = 1; offsets[1] = 2; offsets[2] = 3; offsets[3] = 0;
+    } break;
+    case Arcadia_Media_PixelFormat_BlueGreenRedAlphaNatural8: {
+      *bytesPerPixel = 4;
+      offsets[0] = 2; offsets[1] = 1; offsets[2] = 0; offsets[3] = 3;
+    } break;
+    case Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8: {
+      *bytesPerPixel = 4;
+      offsets[0] = 0; offsets[1] = 1; offsets[2] = 2; offsets[3] = 3;
+    } break;
+    case Arcadia_Media_PixelFormat_BlueGreenRedNatural8: {
+      *bytesPerPixel = 3;
+      offsets[0] = 2; offsets[1] = 1; offsets[2] = 0; offsets[3] = 0;
+    } break;
+    case Arcadia_Media_PixelFormat_RedGreenBlueNatural8: {
+      *bytesPerPixel = 3;
+      offsets[0] = 0; offsets[1] = 1; offsets[2] = 2; offsets[3] = 0;
+    } break;
+    default: {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+      Arcadia_Thread_jump(thread);
+    } break;
+  };
+}
+
+static Arcadia_Media_PixelBuffer*
+decode
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes,
+    Arcadia_Natural8Value pixelFormat
+  )
+{
+  Arcadia_SizeValue targetBytesPerPixel;
+  Arcadia_SizeValue targetOffsets[4];
+  describeTarget(thread, pixelFormat, &targetBytesPerPixel, targetOffsets);
+
+  // The file header (14 Bytes) and the size of the info header (4 Bytes).
+  if (numberOfBytes < 18 || 'B' != bytes[0] || 'M' != bytes[1]) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_SizeValue dataOffset = loadNatural32LittleEndian(bytes + 10);
+  Arcadia_SizeValue headerSize = loadNatural32LittleEndian(bytes + 14);
+  if (headerSize < 40) {
+    // BITMAPCOREHEADER and OS/2 headers.
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NotImplemented);
+    Arcadia_Thread_jump(thread);
+  }
+  if (numberOfBytes - 14 < headerSize) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Natural8Value const* header = bytes + 14;
+  Arcadia_Integer32Value width = (Arcadia_Integer32Value)loadNatural32LittleEndian(header + 4);
+  Arcadia_Integer32Value height = (Arcadia_Integer32Value)loadNatural32LittleEndian(header + 8);
+  Arcadia_Natural16Value planes = loadNatural16LittleEndian(header + 12);
+  Arcadia_Natural16Value bitsPerPixel = loadNatural16LittleEndian(header + 14);
+  Arcadia_Natural32Value compression = loadNatural32LittleEndian(header + 16);
+  // Rows are stored bottom-up if the height is positive and top-down if the height is negative.
+  Arcadia_BooleanValue bottomUp = height > 0;
+  if (height < 0) {
+    if (height == Arcadia_Integer32Value_Minimum) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+      Arcadia_Thread_jump(thread);
+    }
+    height = -height;
+  }
+  if (width <= 0 || 0 == height || 1 != planes) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+
+  // The offsets of the red, green, blue, and alpha component in a pixel of the image.
+  Arcadia_SizeValue sourceOffsets[4] = { 2, 1, 0, 3 };
+  Arcadia_BooleanValue sourceHasAlpha = Arcadia_BooleanValue_False;
+  Arcadia_SizeValue sourceBytesPerPixel;
+  if (24 == bitsPerPixel && Compression_RGB == compression) {
+    sourceBytesPerPixel = 3;
+  } else if (32 == bitsPerPixel && Compression_RGB == compression) {
+    sourceBytesPerPixel = 4;
+  } else if (32 == bitsPerPixel && (Compression_BitFields == compression || Compression_AlphaBitFields == compression)) {
+    sourceBytesPerPixel = 4;
+    // The masks are part of the info header if its size is at least 52 Bytes (56 Bytes with the alpha mask).
+    // Otherwise they directly follow the info header.
+    Arcadia_SizeValue numberOfMasks = (headerSize >= 56 || Compression_AlphaBitFields == compression) ? 4 : 3;
+    if (numberOfBytes - 14 - 40 < numberOfMasks * 4) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+      Arcadia_Thread_jump(thread);
+    }
+    Arcadia_Natural8Value const* masks = header + 40;
+    sourceOffsets[0] = getByteOffset(thread, loadNatural32LittleEndian(masks + 0));
+    sourceOffsets[1] = getByteOffset(thread, loadNatural32LittleEndian(masks + 4));
+    sourceOffsets[2] = getByteOffset(thread, loadNatural32LittleEndian(masks + 8));
+    if (4 == numberOfMasks && 0 != loadNatural32LittleEndian(masks + 12)) {
+      sourceOffsets[3] = getByteOffset(thread, loadNatural32LittleEndian(masks + 12));
+      sourceHasAlpha = Arcadia_BooleanValue_True;
+    }
+  } else {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NotImplemented);
+    Arcadia_Thread_jump(thread);
+  }
+
+  // Rows are padded to multiples of 4 Bytes.
+  Arcadia_SizeValue rowBytes = (Arcadia_SizeValue)width * sourceBytesPerPixel;
+  Arcadia_SizeValue sourceLineStride = (rowBytes + 3) & ~(Arcadia_SizeValue)3;
+  if (dataOffset > numberOfBytes || (numberOfBytes - dataOffset) / sourceLineStride < (Arcadia_SizeValue)height - 1
+   || numberOfBytes - dataOffset - sourceLineStride * ((Arcadia_SizeValue)height - 1) < rowBytes) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+
+  Arcadia_Media_PixelBuffer* pixelBuffer = Arcadia_Media_PixelBuffer_create(thread, 0, width, height, pixelFormat);
+  Arcadia_SizeValue targetLineStride = Arcadia_Media_PixelBuffer_getLineStride(thread, pixelBuffer);
+  Arcadia_BooleanValue targetHasAlpha = 4 == targetBytesPerPixel;
+  // The rows can be copied if the pixel formats are the same.
+  Arcadia_BooleanValue copy = sourceBytesPerPixel == targetBytesPerPixel
+                           && sourceOffsets[0] == targetOffsets[0] && sourceOffsets[1] == targetOffsets[1] && sourceOffsets[2] == targetOffsets[2]
+                           && (!targetHasAlpha || (sourceHasAlpha && sourceOffsets[3] == targetOffsets[3]));
+  for (Arcadia_SizeValue y = 0; y < (Arcadia_SizeValue)height; ++y) {
+    Arcadia_SizeValue sourceRow = bottomUp ? (Arcadia_SizeValue)height - 1 - y : y;
+    Arcadia_Natural8Value const* p = bytes + dataOffset + sourceRow * sourceLineStride;
+    Arcadia_Natural8Value* q = pixelBuffer->bytes + y * targetLineStride;
+    if (copy) {
+      memcpy(q, p, rowBytes);
+    } else if (targetHasAlpha) {
+      for (Arcadia_SizeValue x = 0; x < (Arcadia_SizeValue)width; ++x) {
+        q[targetOffsets[0]] = p[sourceOffsets[0]];
+        q[targetOffsets[1]] = p[sourceOffsets[1]];
+        q[targetOffsets[2]] = p[sourceOffsets[2]];
+        q[targetOffsets[3]] = sourceHasAlpha ? p[sourceOffsets[3]] : 255;
+        p += sourceBytesPerPixel;
+        q += 4;
+      }
+    } else {
+      for (Arcadia_SizeValue x = 0; x < (Arcadia_SizeValue)width; ++x) {
+        q[targetOffsets[0]] = p[sourceOffsets[0]];
+        q[targetOffsets[1]] = p[sourceOffsets[1]];
+        q[targetOffsets[2]] = p[sourceOffsets[2]];
+        p += sourceBytesPerPixel;
+        q += 3;
+      }
+    }
+  }
+  return pixelBuffer;
+}
+
+static Arcadia_ImmutableList*
+Arcadia_Imaging_BMPImageReader_getSupportedTypesImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_BMPImageReader* self
+  )
+{ return self->supportedTypes; }
+
+static Arcadia_Media_PixelBuffer*
+Arcadia_Imaging_BMPImageReader_readImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_BMPImageReader* self,
+    Arcadia_Imaging_ImageReaderParameters* source
+  )
+{
+  Arcadia_Value requestedExtension = Arcadia_Value_makeObjectReferenceValue(Arcadia_Imaging_ImageReaderParameters_getFormat(thread, source));
+  if (!Arcadia_List_contains(thread, (Arcadia_List*)self->supportedTypes, requestedExtension)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Natural8Value pixelFormat = Arcadia_Imaging_ImageReaderParameters_getPixelFormat(thread, source);
+  Arcadia_Natural8Value const* bytes = NULL;
+  Arcadia_SizeValue numberOfBytes = 0;
+  Arcadia_Object* owner = Arcadia_Imaging_ImageReaderParameters_lockBytes(thread, source, &bytes, &numberOfBytes);
+  Arcadia_Media_PixelBuffer* pixelBuffer = NULL;
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    pixelBuffer = decode(thread, bytes, numberOfBytes, pixelFormat);
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Object_unlock(thread, owner);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Object_unlock(thread, owner);
+  return pixelBuffer;
+}
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_Imaging_BMPImageReader_constructImpl,
+  .visit = (Arcadia_Object_VisitCallbackFunction*)&Arcadia_Imaging_BMPImageReader_visit,
+  .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_Imaging_BMPImageReader_initializeDispatchImpl,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.Imaging.BMPImageReader", Arcadia_Imaging_BMPImageReader,
+                         u8"Arcadia.Imaging.ImageReader", Arcadia_Imaging_ImageReader,
+                         &_typeOperations);
+
+static void
+Arcadia_Imaging_BMPImageReader_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_BMPImageReader* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_Imaging_BMPImageReader);
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  if (0 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->supportedTypes = NULL;
+  Arcadia_List* supportedTypes = (Arcadia_List*)Arcadia_ArrayList_create(thread);
+  Arcadia_List_insertBackObjectReferenceValue(thread, supportedTypes, Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_create(thread, u8"bmp", sizeof(u8"bmp") - 1))));
+  self->supportedTypes = Arcadia_ImmutableList_create(thread, Arcadia_Value_makeObjectReferenceValue(supportedTypes));
+  Arcadia_LeaveConstructor(Arcadia_Imaging_BMPImageReader);
+}
+
+static void
+Arcadia_Imaging_BMPImageReader_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_BMPImageReaderDispatch* self
+  )
+{
+  ((Arcadia_Imaging_ImageReaderDispatch*)self)->getSupportedTypes = (Arcadia_ImmutableList*(*)(Arcadia_Thread*, Arcadia_Imaging_ImageReader*))&Arcadia_Imaging_BMPImageReader_getSupportedTypesImpl;
+  ((Arcadia_Imaging_ImageReaderDispatch*)self)->read = (Arcadia_Media_PixelBuffer*(*)(Arcadia_Thread*, Arcadia_Imaging_ImageReader*, Arcadia_Imaging_ImageReaderParameters*))&Arcadia_Imaging_BMPImageReader_readImpl;
+}
+
+static void
+Arcadia_Imaging_BMPImageReader_visit
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_BMPImageReader* self
+  )
+{
+  if (self->supportedTypes) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->supportedTypes);
+  }
+}
+
+Arcadia_Imaging_BMPImageReader*
+Arcadia_Imaging_BMPImageReader_create
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  Arcadia_ValueStack_pushNatural8Value(thread, 0);
+  ARCADIA_CREATEOBJECT(Arcadia_Imaging_BMPImageReader);
+}
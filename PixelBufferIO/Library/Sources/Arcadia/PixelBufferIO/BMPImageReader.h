@@ -0,0 +1,44 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_PIXELBUFFERIO_BMPIMAGEREADER_H_INCLUDED)
+#define ARCADIA_PIXELBUFFERIO_BMPIMAGEREADER_H_INCLUDED
+
+#include "Arcadia/Ring2/Include.h"
+#include "Arcadia/PixelBufferIO/ImageReader.h"
+
+// A reader for the "BMP" file format.
+// Supported are uncompressed 24 bit images and 32 bit images.
+// 32 bit images without bit fields are decoded as opaque images.
+// 32 bit images with bit fields are supported if each mask selects one Byte.
+Arcadia_declareObjectType(u8"Arcadia.Imaging.BMPImageReader", Arcadia_Imaging_BMPImageReader,
+                          u8"Arcadia.Imaging.ImageReader");
+
+struct Arcadia_Imaging_BMPImageReaderDispatch {
+  Arcadia_Imaging_ImageReaderDispatch _parent;
+};
+
+struct Arcadia_Imaging_BMPImageReader {
+  Arcadia_Imaging_ImageReader _parent;
+  Arcadia_ImmutableList* supportedTypes;
+};
+
+Arcadia_Imaging_BMPImageReader*
+Arcadia_Imaging_BMPImageReader_create
+  (
+    Arcadia_Thread* thread
+  );
+
+#endif // ARCADIA_PIXELBUFFERIO_BMPIMAGEREADER_H_INCLUDED
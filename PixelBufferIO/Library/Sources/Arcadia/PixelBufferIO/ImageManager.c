@@ -15,9 +15,12 @@
 
 #include "Arcadia/PixelBufferIO/ImageManager.h"
 
+#include "Arcadia/PixelBufferIO/ImageReader.h"
 #include "Arcadia/PixelBufferIO/ImageWriter.h"
 
+#include "Arcadia/PixelBufferIO/BMPImageReader.h"
 #include "Arcadia/PixelBufferIO/ICOImageWriter.h"
+#include "Arcadia/PixelBufferIO/PNGImageReader.h"
 #if Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
   #include "Arcadia/PixelBufferIO/Windows/BMPImageWriter.h"
   #include "Arcadia/PixelBufferIO/Windows/PNGImageWriter.h"
@@ -118,6 +121,14 @@ Arcadia_Imaging_ImageManager_constructImpl
 #else
   #error("environment not (yet) supported")
 #endif
+
+  self->readers = (Arcadia_List*)Arcadia_ArrayList_create(thread);
+  Arcadia_Imaging_ImageReader* reader = NULL;
+
+  reader = (Arcadia_Imaging_ImageReader*)Arcadia_Imaging_PNGImageReader_create(thread);
+  Arcadia_List_insertBackObjectReferenceValue(thread, self->readers, reader);
+  reader = (Arcadia_Imaging_ImageReader*)Arcadia_Imaging_BMPImageReader_create(thread);
+  Arcadia_List_insertBackObjectReferenceValue(thread, self->readers, reader);
   Arcadia_LeaveConstructor(Arcadia_Imaging_ImageManager);
 }
 
@@ -150,6 +161,9 @@ Arcadia_Imaging_ImageManager_visit
   if (self->writers) {
     Arcadia_Object_visit(thread, (Arcadia_Object*)self->writers);
   }
+  if (self->readers) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->readers);
+  }
 }
 
 static void
@@ -176,6 +190,26 @@ Arcadia_Imaging_ImageManager_getOrCreate
   return g_instance;
 }
 
+static Arcadia_BooleanValue
+filterReaders
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Value context,
+    Arcadia_Value value
+  )
+{
+  Arcadia_Imaging_ImageReader* reader = Arcadia_Value_getObjectReferenceValue(&value);
+  Arcadia_List* supportedExtensions = (Arcadia_List*)Arcadia_Imaging_ImageReader_getSupportedTypes(thread, reader);
+  for (Arcadia_SizeValue i = 0, n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)supportedExtensions); i < n; ++i) {
+    Arcadia_Value a = Arcadia_List_getAt(thread, supportedExtensions, i);
+    Arcadia_Value b = context;
+    if (Arcadia_Value_isEqualTo(thread, &a, &b)) {
+      return Arcadia_BooleanValue_True;
+    }
+  }
+  return Arcadia_BooleanValue_False;
+}
+
 static Arcadia_BooleanValue
 filter
   (
@@ -207,3 +241,15 @@ Arcadia_Imaging_ImageManager_getWriters
   Arcadia_List* list = Arcadia_List_filter(thread, self->writers, Arcadia_Value_makeObjectReferenceValue(extension), &filter);
   return list;
 }
+
+Arcadia_List*
+Arcadia_Imaging_ImageManager_getReaders
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageManager* self,
+    Arcadia_String* extension
+  )
+{
+  Arcadia_List* list = Arcadia_List_filter(thread, self->readers, Arcadia_Value_makeObjectReferenceValue(extension), &filterReaders);
+  return list;
+}
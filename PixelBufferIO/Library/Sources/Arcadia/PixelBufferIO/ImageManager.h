@@ -28,6 +28,7 @@ struct Arcadia_Imaging_ImageManagerDispatch {
 struct Arcadia_Imaging_ImageManager {
   Arcadia_Object _parent;
   Arcadia_List* writers;
+  Arcadia_List* readers;
 };
 
 /// @brief Get or create the image manager singleton object.
@@ -51,4 +52,16 @@ Arcadia_Imaging_ImageManager_getWriters
     Arcadia_String* extension
   );
 
+/// @brief Get a list of image readers supporting the specified extension.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this image manager.
+/// @return A pointer to a list of image readers.
+Arcadia_List*
+Arcadia_Imaging_ImageManager_getReaders
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageManager* self,
+    Arcadia_String* extension
+  );
+
 #endif // ARCADIA_PIXELBUFFERIO_IMAGEMANAGER_H_INCLUDED
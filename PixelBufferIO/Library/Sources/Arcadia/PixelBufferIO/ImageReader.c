@@ -0,0 +1,89 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/PixelBufferIO/ImageReader.h"
+
+Arcadia_ImmutableList*
+Arcadia_Imaging_ImageReader_getSupportedTypes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReader* self
+  )
+{ Arcadia_VirtualCallWithReturn(Arcadia_Imaging_ImageReader, getSupportedTypes, self); }
+
+Arcadia_Media_PixelBuffer*
+Arcadia_Imaging_ImageReader_read
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReader* self,
+    Arcadia_Imaging_ImageReaderParameters* source
+  )
+{ Arcadia_VirtualCallWithReturn(Arcadia_Imaging_ImageReader, read, self, source); }
+
+static void
+Arcadia_Imaging_ImageReader_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReader* self
+  );
+
+static void
+Arcadia_Imaging_ImageReader_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderDispatch* self
+  );
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_Imaging_ImageReader_constructImpl,
+  .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_Imaging_ImageReader_initializeDispatchImpl,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.Imaging.ImageReader", Arcadia_Imaging_ImageReader,
+                         u8"Arcadia.Object", Arcadia_Object,
+                         &_typeOperations);
+
+static void
+Arcadia_Imaging_ImageReader_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReader* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_Imaging_ImageReader);
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  if (0 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_LeaveConstructor(Arcadia_Imaging_ImageReader);
+}
+
+static void
+Arcadia_Imaging_ImageReader_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderDispatch* self
+  )
+{/*Intentionally empty.*/}
@@ -0,0 +1,65 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_PIXELBUFFERIO_IMAGEREADER_H_INCLUDED)
+#define ARCADIA_PIXELBUFFERIO_IMAGEREADER_H_INCLUDED
+
+#include "Arcadia/Ring2/Include.h"
+#include "Arcadia/Media/Include.h"
+#include "Arcadia/PixelBufferIO/ImageReaderParameters.h"
+
+Arcadia_declareObjectType(u8"Arcadia.Imaging.ImageReader", Arcadia_Imaging_ImageReader, u8"Arcadia.Object");
+
+struct Arcadia_Imaging_ImageReaderDispatch {
+  Arcadia_ObjectDispatch parent;
+
+  Arcadia_ImmutableList* (*getSupportedTypes)(Arcadia_Thread* thread, Arcadia_Imaging_ImageReader* self);
+  Arcadia_Media_PixelBuffer* (*read)(Arcadia_Thread* thread, Arcadia_Imaging_ImageReader* self, Arcadia_Imaging_ImageReaderParameters* source);
+};
+
+struct Arcadia_Imaging_ImageReader {
+  Arcadia_Object _parent;
+};
+
+/// @brief A set of strings denoting the extensions supported by this image reader.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this image reader.
+/// @return A set of strings denoting the extensions supported by this image reader.
+/// @remarks Canonical strings are "bmp" and "png".
+Arcadia_ImmutableList*
+Arcadia_Imaging_ImageReader_getSupportedTypes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReader* self
+  );
+
+/// @brief Read an image.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this image reader.
+/// @param source A pointer to the image reader parameters.
+/// @return A pointer to the pixel buffer.
+/// The pixel format of the pixel buffer is the pixel format specified by the image reader parameters.
+/// @error #Arcadia_Status_ArgumentValueInvalid the format is not supported by this image reader
+/// @error #Arcadia_Status_EncodingInvalid the image is corrupted
+/// @error #Arcadia_Status_NotImplemented the image uses a feature not supported by this image reader
+Arcadia_Media_PixelBuffer*
+Arcadia_Imaging_ImageReader_read
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReader* self,
+    Arcadia_Imaging_ImageReaderParameters* source
+  );
+
+#endif // ARCADIA_PIXELBUFFERIO_IMAGEREADER_H_INCLUDED
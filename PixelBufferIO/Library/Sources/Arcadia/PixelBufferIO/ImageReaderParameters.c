@@ -0,0 +1,320 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/PixelBufferIO/ImageReaderParameters.h"
+
+#include "Arcadia/FileSystem/Include.h"
+#include "Arcadia/Media/Include.h"
+
+struct Arcadia_Imaging_ImageReaderParametersDispatch {
+  Arcadia_ObjectDispatch parent;
+};
+
+struct Arcadia_Imaging_ImageReaderParameters {
+  Arcadia_Object _parent;
+  // The format string.
+  Arcadia_String* format;
+  // "object" either refers to a "Arcadia.ByteArrayBuilder" object or a "Arcadia.Path" object.
+  Arcadia_ObjectReferenceValue object;
+  // The pixel format of the pixel buffer.
+  Arcadia_Natural8Value pixelFormat;
+  // If the file is mapped into memory.
+  Arcadia_BooleanValue mapFile;
+};
+
+static void
+Arcadia_Imaging_ImageReaderParameters_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self
+  );
+
+static void
+Arcadia_Imaging_ImageReaderParameters_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParametersDispatch* self
+  );
+
+static void
+Arcadia_Imaging_ImageReaderParameters_visit
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self
+  );
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_Imaging_ImageReaderParameters_constructImpl,
+  .visit = (Arcadia_Object_VisitCallbackFunction*)&Arcadia_Imaging_ImageReaderParameters_visit,
+  .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_Imaging_ImageReaderParameters_initializeDispatchImpl,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.Imaging.ImageReaderParameters", Arcadia_Imaging_ImageReaderParameters,
+                         u8"Arcadia.Object", Arcadia_Object, &_typeOperations);
+
+static void
+Arcadia_Imaging_ImageReaderParameters_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_Imaging_ImageReaderParameters);
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  if (2 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Object* object = Arcadia_ValueStack_getObjectReferenceValue(thread, 2);
+  if (Arcadia_Object_isInstanceOf(thread, object, _Arcadia_String_getType(thread))) {
+    self->object = (Arcadia_ObjectReferenceValue)object;
+  } else if (Arcadia_Object_isInstanceOf(thread, object, _Arcadia_ByteArrayBuilder_getType(thread))) {
+    self->object = (Arcadia_ObjectReferenceValue)object;
+  } else {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentTypeInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->format = Arcadia_ValueStack_getObjectReferenceValueChecked(thread, 1, _Arcadia_String_getType(thread));
+  self->pixelFormat = Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8;
+  self->mapFile = Arcadia_BooleanValue_False;
+  Arcadia_LeaveConstructor(Arcadia_Imaging_ImageReaderParameters);
+}
+
+static void
+Arcadia_Imaging_ImageReaderParameters_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParametersDispatch* self
+  )
+{ }
+
+static void
+Arcadia_Imaging_ImageReaderParameters_visit
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self
+  )
+{
+  if (self->format) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->format);
+  }
+  if (self->object) {
+    Arcadia_Object_visit(thread, self->object);
+  }
+}
+
+Arcadia_Imaging_ImageReaderParameters*
+Arcadia_Imaging_ImageReaderParameters_createFile
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* path,
+    Arcadia_String* format
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  if (path) {
+    Arcadia_ValueStack_pushObjectReferenceValue(thread, path);
+  } else {
+    Arcadia_ValueStack_pushVoidValue(thread, Arcadia_VoidValue_Void);
+  }
+  if (format) {
+    Arcadia_ValueStack_pushObjectReferenceValue(thread, format);
+  } else {
+    Arcadia_ValueStack_pushVoidValue(thread, Arcadia_VoidValue_Void);
+  }
+  Arcadia_ValueStack_pushNatural8Value(thread, 2);
+  ARCADIA_CREATEOBJECT(Arcadia_Imaging_ImageReaderParameters);
+}
+
+Arcadia_Imaging_ImageReaderParameters*
+Arcadia_Imaging_ImageReaderParameters_createByteBuffer
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* byteBuffer,
+    Arcadia_String* format
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  if (byteBuffer) {
+    Arcadia_ValueStack_pushObjectReferenceValue(thread, byteBuffer);
+  } else {
+    Arcadia_ValueStack_pushVoidValue(thread, Arcadia_VoidValue_Void);
+  }
+  if (format) {
+    Arcadia_ValueStack_pushObjectReferenceValue(thread, format);
+  } else {
+    Arcadia_ValueStack_pushVoidValue(thread, Arcadia_VoidValue_Void);
+  }
+  Arcadia_ValueStack_pushNatural8Value(thread, 2);
+  ARCADIA_CREATEOBJECT(Arcadia_Imaging_ImageReaderParameters);
+}
+
+Arcadia_BooleanValue
+Arcadia_Imaging_ImageReaderParameters_hasPath
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self
+  )
+{
+  Arcadia_TypeValue type = Arcadia_Object_getType(thread, self->object);
+  return Arcadia_Type_isDescendantType(thread, type, _Arcadia_String_getType(thread));
+}
+
+Arcadia_String*
+Arcadia_Imaging_ImageReaderParameters_getPath
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self
+  )
+{
+  if (!Arcadia_Imaging_ImageReaderParameters_hasPath(thread, self)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_OperationInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  return (Arcadia_String*)self->object;
+}
+
+Arcadia_BooleanValue
+Arcadia_Imaging_ImageReaderParameters_hasByteBuffer
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self
+  )
+{
+  Arcadia_TypeValue type = Arcadia_Object_getType(thread, self->object);
+  return Arcadia_Type_isDescendantType(thread, type, _Arcadia_ByteArrayBuilder_getType(thread));
+}
+
+Arcadia_ByteArrayBuilder*
+Arcadia_Imaging_ImageReaderParameters_getByteBuffer
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self
+  )
+{
+  if (!Arcadia_Imaging_ImageReaderParameters_hasByteBuffer(thread, self)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_OperationInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  return (Arcadia_ByteArrayBuilder*)self->object;
+}
+
+Arcadia_String*
+Arcadia_Imaging_ImageReaderParameters_getFormat
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self
+  )
+{
+  return self->format;
+}
+
+Arcadia_Natural8Value
+Arcadia_Imaging_ImageReaderParameters_getPixelFormat
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self
+  )
+{
+  return self->pixelFormat;
+}
+
+void
+Arcadia_Imaging_ImageReaderParameters_setPixelFormat
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self,
+    Arcadia_Natural8Value pixelFormat
+  )
+{
+  switch (pixelFormat) {
+    case Arcadia_Media_PixelFormat_AlphaBlueGreenRedNatural8:
+    case Arcadia_Media_PixelFormat_AlphaRedGreenBlueNatural8:
+    case Arcadia_Media_PixelFormat_BlueGreenRedNatural8:
+    case Arcadia_Media_PixelFormat_BlueGreenRedAlphaNatural8:
+    case Arcadia_Media_PixelFormat_RedGreenBlueNatural8:
+    case Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8: {
+      self->pixelFormat = pixelFormat;
+    } break;
+    default: {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+      Arcadia_Thread_jump(thread);
+    } break;
+  };
+}
+
+Arcadia_BooleanValue
+Arcadia_Imaging_ImageReaderParameters_getMapFile
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self
+  )
+{
+  return self->mapFile;
+}
+
+void
+Arcadia_Imaging_ImageReaderParameters_setMapFile
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self,
+    Arcadia_BooleanValue mapFile
+  )
+{
+  self->mapFile = mapFile;
+}
+
+Arcadia_Object*
+Arcadia_Imaging_ImageReaderParameters_lockBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self,
+    Arcadia_Natural8Value const** bytes,
+    Arcadia_SizeValue* numberOfBytes
+  )
+{
+  if (Arcadia_Imaging_ImageReaderParameters_hasByteBuffer(thread, self)) {
+    Arcadia_ByteArrayBuilder* byteBuffer = (Arcadia_ByteArrayBuilder*)self->object;
+    Arcadia_Object_lock(thread, (Arcadia_Object*)byteBuffer);
+    *bytes = Arcadia_ByteArrayBuilder_getBytes(thread, byteBuffer);
+    *numberOfBytes = Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, byteBuffer);
+    return (Arcadia_Object*)byteBuffer;
+  } else {
+    Arcadia_FileSystem* fileSystem = Arcadia_FileSystem_getOrCreate(thread);
+    Arcadia_FilePath* filePath = Arcadia_FilePath_parseNative(thread, (Arcadia_String*)self->object);
+    if (self->mapFile) {
+      Arcadia_FileMapping* fileMapping = Arcadia_FileSystem_mapFile(thread, fileSystem, filePath);
+      Arcadia_Object_lock(thread, (Arcadia_Object*)fileMapping);
+      *bytes = Arcadia_FileMapping_getBytes(thread, fileMapping);
+      *numberOfBytes = Arcadia_FileMapping_getNumberOfBytes(thread, fileMapping);
+      return (Arcadia_Object*)fileMapping;
+    } else {
+      Arcadia_ByteArrayBuilder* byteBuffer = Arcadia_FileSystem_getFileContents(thread, fileSystem, filePath);
+      Arcadia_Object_lock(thread, (Arcadia_Object*)byteBuffer);
+      *bytes = Arcadia_ByteArrayBuilder_getBytes(thread, byteBuffer);
+      *numberOfBytes = Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, byteBuffer);
+      return (Arcadia_Object*)byteBuffer;
+    }
+  }
+}
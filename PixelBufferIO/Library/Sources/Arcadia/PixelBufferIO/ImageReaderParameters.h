@@ -0,0 +1,149 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_PIXELBUFFERIO_IMAGEREADERPARAMETERS_H_INCLUDED)
+#define ARCADIA_PIXELBUFFERIO_IMAGEREADERPARAMETERS_H_INCLUDED
+
+#include "Arcadia/Ring2/Include.h"
+
+/// @code
+/// class ImageReaderParameters {
+///   construct(path:String,format:String)
+///   construct(byteBuffer:ByteBuffer,format:String)
+/// }
+/// @endcode
+/// where @ format is one of "bmp", "png".
+/// The pixel format of the pixel buffer is Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8 by default.
+/// Files are read into memory by default.
+Arcadia_declareObjectType(u8"Arcadia.Imaging.ImageReaderParameters", Arcadia_Imaging_ImageReaderParameters,
+                          u8"Arcadia.Object");
+
+Arcadia_Imaging_ImageReaderParameters*
+Arcadia_Imaging_ImageReaderParameters_createFile
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* path,
+    Arcadia_String* format
+  );
+
+Arcadia_Imaging_ImageReaderParameters*
+Arcadia_Imaging_ImageReaderParameters_createByteBuffer
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* byteBuffer,
+    Arcadia_String* format
+  );
+
+Arcadia_BooleanValue
+Arcadia_Imaging_ImageReaderParameters_hasPath
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self
+  );
+
+Arcadia_String*
+Arcadia_Imaging_ImageReaderParameters_getPath
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self
+  );
+
+Arcadia_BooleanValue
+Arcadia_Imaging_ImageReaderParameters_hasByteBuffer
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self
+  );
+
+Arcadia_ByteArrayBuilder*
+Arcadia_Imaging_ImageReaderParameters_getByteBuffer
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self
+  );
+
+Arcadia_String*
+Arcadia_Imaging_ImageReaderParameters_getFormat
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self
+  );
+
+/// @brief Get the pixel format of the pixel buffer.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to these image reader parameters.
+/// @return The pixel format.
+Arcadia_Natural8Value
+Arcadia_Imaging_ImageReaderParameters_getPixelFormat
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self
+  );
+
+/// @brief Set the pixel format of the pixel buffer.
+/// The image is decoded directly into this pixel format.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to these image reader parameters.
+/// @param pixelFormat The pixel format.
+void
+Arcadia_Imaging_ImageReaderParameters_setPixelFormat
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self,
+    Arcadia_Natural8Value pixelFormat
+  );
+
+/// @brief Get if the file is mapped into memory instead of being read into memory.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to these image reader parameters.
+/// @return #Arcadia_BooleanValue_True if the file is mapped into memory, #Arcadia_BooleanValue_False otherwise.
+Arcadia_BooleanValue
+Arcadia_Imaging_ImageReaderParameters_getMapFile
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self
+  );
+
+/// @brief Set if the file is mapped into memory instead of being read into memory.
+/// This has no effect if the image is read from a byte buffer.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to these image reader parameters.
+/// @param mapFile #Arcadia_BooleanValue_True if the file is mapped into memory, #Arcadia_BooleanValue_False otherwise.
+void
+Arcadia_Imaging_ImageReaderParameters_setMapFile
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self,
+    Arcadia_BooleanValue mapFile
+  );
+
+/// @brief Get the Bytes to decode.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to these image reader parameters.
+/// @param bytes A pointer to a variable receiving a pointer to the Bytes.
+/// @param numberOfBytes A pointer to a variable receiving the number of Bytes.
+/// @return A pointer to the object owning the Bytes.
+/// The object is locked and the Bytes remain valid until the caller unlocks the object using Arcadia_Object_unlock.
+/// If the source is a file, then the file is either read into memory or mapped into memory.
+Arcadia_Object*
+Arcadia_Imaging_ImageReaderParameters_lockBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_ImageReaderParameters* self,
+    Arcadia_Natural8Value const** bytes,
+    Arcadia_SizeValue* numberOfBytes
+  );
+
+#endif // ARCADIA_PIXELBUFFERIO_IMAGEREADERPARAMETERS_H_INCLUDED
@@ -17,6 +17,7 @@
 #define ARCADIA_PIXELBUFFERIO_INCLUDE_H_INCLUDED
 
 #include "Arcadia/PixelBufferIO/ImageManager.h"
+#include "Arcadia/PixelBufferIO/ImageReader.h"
 #include "Arcadia/PixelBufferIO/ImageWriter.h"
 
 #include "Arcadia/Media/Include.h"
@@ -191,7 +191,7 @@ Arcadia_Imaging_Linux_BMPImageWriter_writeBmpToByteBufferImpl
     case Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8: {
       sourcePixelBuffer = Arcadia_Media_PixelBuffer_createClone(thread, sourcePixelBuffer);
       Arcadia_Media_PixelBuffer_setLinePadding(thread, sourcePixelBuffer, 0);
-      components = 3;
+      components = 4;
     } break;
 
     case Arcadia_Media_PixelFormat_BlueGreenRedNatural8: {
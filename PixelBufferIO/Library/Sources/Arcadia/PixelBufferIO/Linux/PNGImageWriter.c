@@ -18,9 +18,7 @@
 #include "Arcadia/PixelBufferIO/ImageWriterParameters.h"
 #include "Arcadia/PixelBufferIO/Linux/Include.h"
 
-#include <malloc.h> // @todo Use functionality provided by Arcadia_Process.
-
-#include <png.h>
+#include "Arcadia/PixelBufferIO/PNGEncoder.h"
 
 static void
 Arcadia_Imaging_Linux_PNGImageWriter_constructImpl
@@ -77,101 +75,6 @@ Arcadia_Imaging_Linux_PNGImageWriter_writePngToPathImpl
     Arcadia_String* targetPath
   );
 
-typedef struct LibPngState {
-  png_structp png_struct;
-  png_infop png_info;
-  uint8_t** row_pointers;
-} LibPngState;
-
-typedef struct LibPngWriteState {
-  Arcadia_ByteArrayBuilder* byteArrayBuilder;
-  Arcadia_Process* process;
-} LibPngWriteState;
-
-static void
-LibPngState_destroy
-  (
-    Arcadia_Thread* thread,
-    LibPngState* state
-  )
-{
-  if (state->row_pointers) {
-    free(state->row_pointers);
-    state->row_pointers = NULL;
-  }
-  png_destroy_write_struct(&state->png_struct, &state->png_info);
-  free(state);
-}
-
-static LibPngState*
-LibPngState_create
-  (
-    Arcadia_Thread* thread
-  )
-{
-  LibPngState* state = malloc(sizeof(LibPngState));
-  if (!state) {
-    Arcadia_Thread_setStatus(thread, Arcadia_Status_AllocationFailed);
-    Arcadia_Thread_jump(thread);
-  }
-  state->png_struct = NULL;
-  state->png_info = NULL;
-  state->row_pointers = NULL;
-  Arcadia_JumpTarget jumpTarget;
-  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
-  if (Arcadia_JumpTarget_save(&jumpTarget)) {
-    state->png_struct = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
-    if (!state->png_struct) {
-      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
-      Arcadia_Thread_jump(thread);
-    }
-    state->png_info = png_create_info_struct(state->png_struct);
-    if (!state->png_info) {
-      png_destroy_write_struct(&state->png_struct, (png_infopp)NULL);
-      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
-      Arcadia_Thread_jump(thread);
-    }
-    Arcadia_Thread_popJumpTarget(thread);
-  } else {
-    Arcadia_Thread_popJumpTarget(thread);
-    if (!state->png_info) {
-      png_destroy_write_struct(&state->png_struct, (png_infopp)NULL);
-    }
-    free(state);
-    state = NULL;
-    Arcadia_Thread_jump(thread);
-  }
-  return state;
-}
-
-static void
-on_write
-  (
-    png_structp png_struct,
-    png_bytep data,
-    png_size_t length
-  )
-{
-  LibPngWriteState* ws = (LibPngWriteState*)png_get_io_ptr(png_struct);
-  Arcadia_Thread* thread = Arcadia_Process_getThread(ws->process);
-  Arcadia_JumpTarget jumpTarget;
-  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
-  if (Arcadia_JumpTarget_save(&jumpTarget)) {
-    Arcadia_ByteArrayBuilder_insertBackBytes(thread, ws->byteArrayBuilder, data, length);
-    Arcadia_Thread_popJumpTarget(thread);
-  } else {
-    Arcadia_Thread_popJumpTarget(thread);
-    png_error(png_struct, "error");
-  }
-}
-
-static void
-on_flush
-  (
-    png_structp png_struct
-  )
-{/*Intentionally empty.*/}
-
 static Arcadia_ImmutableList*
 Arcadia_Imaging_Linux_PNGImageWriter_getSupportedTypesImpl
   (
@@ -223,74 +126,8 @@ Arcadia_Imaging_Linux_PNGImageWriter_writePngToByteBufferImpl
     Arcadia_ByteArrayBuilder* targetByteArrayBuilder
   )
 {
-  LibPngState* state = NULL;
-  int bitDepth;
-  int colorType;
-
-  switch (Arcadia_Media_PixelBuffer_getPixelFormat(thread, sourcePixelBuffer)) {
-    case Arcadia_Media_PixelFormat_AlphaRedGreenBlueNatural8:
-    case Arcadia_Media_PixelFormat_AlphaBlueGreenRedNatural8:
-    case Arcadia_Media_PixelFormat_BlueGreenRedAlphaNatural8:
-    case Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8: {
-      Arcadia_Media_PixelBuffer* pixelBuffer = Arcadia_Media_PixelBuffer_createClone(thread, sourcePixelBuffer);
-      Arcadia_Media_PixelBuffer_setPixelFormat(thread, pixelBuffer, Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8);
-      sourcePixelBuffer = pixelBuffer;
-      bitDepth = 8;
-      colorType = PNG_COLOR_TYPE_RGBA;
-    } break;
-    case Arcadia_Media_PixelFormat_BlueGreenRedNatural8:
-    case Arcadia_Media_PixelFormat_RedGreenBlueNatural8: {
-      Arcadia_Media_PixelBuffer* pixelBuffer = Arcadia_Media_PixelBuffer_createClone(thread, sourcePixelBuffer);
-      Arcadia_Media_PixelBuffer_setPixelFormat(thread, pixelBuffer, Arcadia_Media_PixelFormat_RedGreenBlueNatural8);
-      sourcePixelBuffer = pixelBuffer;
-      bitDepth = 8;
-      colorType = PNG_COLOR_TYPE_RGB;
-    } break;
-    default: {
-      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
-      Arcadia_Thread_jump(thread);
-    } break;
-  };
-  uint32_t width = Arcadia_Media_PixelBuffer_getWidth(thread, sourcePixelBuffer);
-  uint32_t height = Arcadia_Media_PixelBuffer_getHeight(thread, sourcePixelBuffer);
-  uint32_t lineStride = Arcadia_Media_PixelBuffer_getLineStride(thread, sourcePixelBuffer);
-  //uint32_t pixelBytes = Arcadia_Media_PixelBuffer_getBytesPerPixel(thread, sourcePixelBuffer);
-  uint8_t* pixels = sourcePixelBuffer->bytes;
-
-  state = LibPngState_create(thread);
-  if (!setjmp(png_jmpbuf(state->png_struct))) {
-    state->row_pointers = malloc(sizeof(uint8_t*) * height);
-    if (!state->row_pointers) {
-      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
-      Arcadia_Thread_jump(thread);
-    }
-    for (size_t i = 0; i < height; ++i) {
-      state->row_pointers[i] = pixels + lineStride * i;
-    }
-    LibPngWriteState writeState = { .byteArrayBuilder = targetByteArrayBuilder, .process = Arcadia_Thread_getProcess(thread) };
-    png_set_write_fn(state->png_struct, &writeState, &on_write, &on_flush),
-    png_set_IHDR
-      (
-        state->png_struct,
-        state->png_info,
-        width, height,
-        bitDepth,
-        colorType,
-        PNG_INTERLACE_NONE,
-        PNG_COMPRESSION_TYPE_DEFAULT,
-        PNG_FILTER_TYPE_DEFAULT
-      );
-    png_write_info(state->png_struct, state->png_info);
-    png_write_image(state->png_struct, state->row_pointers);
-    png_write_end(state->png_struct, NULL);
-  } else {
-    LibPngState_destroy(thread, state);
-    state = NULL;
-    Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
-    Arcadia_Thread_jump(thread);
-  }
-  LibPngState_destroy(thread, state);
-  state = NULL;
+  Arcadia_Imaging_PNGEncoder* encoder = Arcadia_Imaging_PNGEncoder_create(thread);
+  Arcadia_Imaging_PNGEncoder_encodeToByteArrayBuilder(thread, encoder, sourcePixelBuffer, targetByteArrayBuilder);
 }
 
 static void
@@ -302,89 +139,20 @@ Arcadia_Imaging_Linux_PNGImageWriter_writePngToPathImpl
     Arcadia_String* targetPath
   )
 {
-  LibPngState* state = NULL;
-  int bitDepth;
-  int colorType;
-
-  switch (Arcadia_Media_PixelBuffer_getPixelFormat(thread, sourcePixelBuffer)) {
-    case Arcadia_Media_PixelFormat_AlphaRedGreenBlueNatural8:
-    case Arcadia_Media_PixelFormat_AlphaBlueGreenRedNatural8:
-    case Arcadia_Media_PixelFormat_BlueGreenRedAlphaNatural8:
-    case Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8: {
-      Arcadia_Media_PixelBuffer* pixelBuffer = Arcadia_Media_PixelBuffer_createClone(thread, sourcePixelBuffer);
-      Arcadia_Media_PixelBuffer_setPixelFormat(thread, pixelBuffer, Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8);
-      sourcePixelBuffer = pixelBuffer;
-      bitDepth = 8;
-      colorType = PNG_COLOR_TYPE_RGBA;
-    } break;
-    case Arcadia_Media_PixelFormat_BlueGreenRedNatural8:
-    case Arcadia_Media_PixelFormat_RedGreenBlueNatural8: {
-      Arcadia_Media_PixelBuffer* pixelBuffer = Arcadia_Media_PixelBuffer_createClone(thread, sourcePixelBuffer);
-      Arcadia_Media_PixelBuffer_setPixelFormat(thread, pixelBuffer, Arcadia_Media_PixelFormat_RedGreenBlueNatural8);
-      sourcePixelBuffer = pixelBuffer;
-      bitDepth = 8;
-      colorType = PNG_COLOR_TYPE_RGB;
-    } break;
-    default: {
-      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
-      Arcadia_Thread_jump(thread);
-    } break;
-  };
-  uint32_t width = Arcadia_Media_PixelBuffer_getWidth(thread, sourcePixelBuffer);
-  uint32_t height = Arcadia_Media_PixelBuffer_getHeight(thread, sourcePixelBuffer);
-  uint32_t lineStride = Arcadia_Media_PixelBuffer_getLineStride(thread, sourcePixelBuffer);
-  //uint32_t pixelBytes = Arcadia_Media_PixelBuffer_getBytesPerPixel(thread, sourcePixelBuffer);
-  uint8_t* pixels = sourcePixelBuffer->bytes;
-
-  state = LibPngState_create(thread);
-  FILE* fp = NULL;
-  if (!setjmp(png_jmpbuf(state->png_struct))) {
-    state->row_pointers = malloc(sizeof(uint8_t*) * height);
-    if (!state->row_pointers) {
-      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
-      Arcadia_Thread_jump(thread);
-    }
-    for (size_t i = 0; i < height; ++i) {
-      state->row_pointers[i] = pixels + lineStride * i;
-    }
-    Arcadia_FilePath* filePath = Arcadia_FilePath_parseNative(thread, targetPath);
-    Arcadia_String* filePathString = Arcadia_FilePath_toNative(thread, filePath, Arcadia_BooleanValue_True);
-    fp = fopen(Arcadia_String_getBytes(thread, filePathString), "wb");
-    if (!fp) {
-      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
-      Arcadia_Thread_jump(thread);
-    }
-    png_init_io(state->png_struct, fp);
-    png_set_IHDR
-      (
-        state->png_struct,
-        state->png_info,
-        width, height,
-        bitDepth,
-        colorType,
-        PNG_INTERLACE_NONE,
-        PNG_COMPRESSION_TYPE_DEFAULT,
-        PNG_FILTER_TYPE_DEFAULT
-      );
-    png_write_info(state->png_struct, state->png_info);
-    png_write_image(state->png_struct, state->row_pointers);
-    png_write_end(state->png_struct, NULL);
+  Arcadia_Imaging_PNGEncoder* encoder = Arcadia_Imaging_PNGEncoder_create(thread);
+  Arcadia_FileHandle* fileHandle = Arcadia_FileSystem_createFileHandle(thread, Arcadia_FileSystem_getOrCreate(thread));
+  Arcadia_FileHandle_openForWriting(thread, fileHandle, Arcadia_FilePath_parseNative(thread, targetPath));
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_Imaging_PNGEncoder_encodeToFileHandle(thread, encoder, sourcePixelBuffer, fileHandle);
+    Arcadia_Thread_popJumpTarget(thread);
   } else {
-    LibPngState_destroy(thread, state);
-    state = NULL;
-    if (fp) {
-      fclose(fp);
-      fp = NULL;
-    }
-    Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_FileHandle_close(thread, fileHandle);
     Arcadia_Thread_jump(thread);
   }
-  LibPngState_destroy(thread, state);
-  state = NULL;
-  if (fp) {
-    fclose(fp);
-    fp = NULL;
-  }
+  Arcadia_FileHandle_close(thread, fileHandle);
 }
 
 static const Arcadia_ObjectType_Operations _objectTypeOperations = {
@@ -0,0 +1,745 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/PixelBufferIO/PNGEncoder.h"
+
+#include <string.h>
+#include <zlib.h>
+
+/// The default compression level.
+#define DefaultCompressionLevel (6)
+
+/// The default chunk size.
+#define DefaultChunkSize (256 * 1024)
+
+/// The number of chunks per worker which are in flight.
+#define ChunksPerWorker (2)
+
+typedef struct Image {
+  Arcadia_Natural8Value const* pixels;
+  Arcadia_SizeValue lineStride;
+  Arcadia_SizeValue width;
+  Arcadia_SizeValue height;
+  // The number of Bytes per pixel in the pixel buffer.
+  Arcadia_SizeValue sourceBytesPerPixel;
+  // The number of Bytes per pixel in the PNG image (3 for RGB, 4 for RGBA).
+  Arcadia_SizeValue targetBytesPerPixel;
+  // The offsets of the red, green, blue, and alpha component in a pixel of the pixel buffer.
+  Arcadia_SizeValue offsets[4];
+  // If the rows of the pixel buffer can be used as they are.
+  Arcadia_BooleanValue isIdentity;
+} Image;
+
+typedef struct Job {
+  Image const* image;
+  Arcadia_Integer32Value compressionLevel;
+  Arcadia_SizeValue firstRow;
+  Arcadia_SizeValue numberOfRows;
+  Arcadia_BooleanValue isLast;
+  // The compressed Bytes.
+  Arcadia_Natural8Value* bytes;
+  Arcadia_SizeValue numberOfBytes;
+  // The Adler-32 checksum and the number of Bytes of the filtered rows.
+  uLong adler;
+  Arcadia_SizeValue numberOfFilteredBytes;
+  // The task if this job was forked into a thread pool, null otherwise.
+  Arcadia_ThreadPool_Task* task;
+} Job;
+
+typedef struct Sink {
+  void (*write)(Arcadia_Thread* thread, void* context, void const* bytes, Arcadia_SizeValue numberOfBytes);
+  void* context;
+} Sink;
+
+static void
+Arcadia_Imaging_PNGEncoder_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGEncoder* self
+  );
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_Imaging_PNGEncoder_constructImpl,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.Imaging.PNGEncoder", Arcadia_Imaging_PNGEncoder,
+                         u8"Arcadia.Object", Arcadia_Object,
+                         &_typeOperations);
+
+static void
+Arcadia_Imaging_PNGEncoder_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGEncoder* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_Imaging_PNGEncoder);
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  if (0 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->compressionLevel = DefaultCompressionLevel;
+  self->chunkSize = DefaultChunkSize;
+  self->numberOfWorkers = 0;
+  Arcadia_LeaveConstructor(Arcadia_Imaging_PNGEncoder);
+}
+
+static void
+describeImage
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_PixelBuffer* source,
+    Image* image
+  )
+{
+  switch (Arcadia_Media_PixelBuffer_getPixelFormat(thread, source)) {
+    case Arcadia_Media_PixelFormat_AlphaBlueGreenRedNatural8: {
+      *image = (Image){ .sourceBytesPerPixel = 4, .targetBytesPerPixel = 4, .offsets = { 3, 2, 1, 0 } };
+    } break;
+    case Arcadia_Media_PixelFormat_AlphaRedGreenBlueNatural8: {
+      *image = (Image){ .sourceBytesPerPixel = 4, .targetBytesPerPixel = 4, .offsets = { 1, 2, 3, 0 } };
+    } break;
+    case Arcadia_Media_PixelFormat_BlueGreenRedAlphaNatural8: {
+      *image = (Image){ .sourceBytesPerPixel = 4, .targetBytesPerPixel = 4, .offsets = { 2, 1, 0, 3 } };
+    } break;
+    case Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8: {
+      *image = (Image){ .sourceBytesPerPixel = 4, .targetBytesPerPixel = 4, .offsets = { 0, 1, 2, 3 } };
+    } break;
+    case Arcadia_Media_PixelFormat_BlueGreenRedNatural8: {
+      *image = (Image){ .sourceBytesPerPixel = 3, .targetBytesPerPixel = 3, .offsets = { 2, 1, 0, 0 } };
+    } break;
+    case Arcadia_Media_PixelFormat_RedGreenBlueNatural8: {
+      *image = (Image){ .sourceBytesPerPixel = 3, .targetBytesPerPixel = 3, .offsets = { 0, 1, 2, 0 } };
+    } break;
+    default: {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+      Arcadia_Thread_jump(thread);
+    } break;
+  };
+  if (Arcadia_Media_PixelBuffer_getWidth(thread, source) <= 0 || Arcadia_Media_PixelBuffer_getHeight(thread, source) <= 0) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  image->pixels = source->bytes;
+  image->lineStride = Arcadia_Media_PixelBuffer_getLineStride(thread, source);
+  image->width = Arcadia_Media_PixelBuffer_getWidth(thread, source);
+  image->height = Arcadia_Media_PixelBuffer_getHeight(thread, source);
+  image->isIdentity = 0 == image->offsets[0] && 1 == image->offsets[1] && 2 == image->offsets[2]
+                   && (3 == image->targetBytesPerPixel || 3 == image->offsets[3]);
+}
+
+// Get the row of the image in the pixel format of the PNG image.
+// Either returns a pointer into the pixel buffer or converts the row into the specified buffer.
+static Arcadia_Natural8Value const*
+getRow
+  (
+    Image const* image,
+    Arcadia_SizeValue row,
+    Arcadia_Natural8Value* buffer
+  )
+{
+  Arcadia_Natural8Value const* p = image->pixels + row * image->lineStride;
+  if (image->isIdentity) {
+    return p;
+  }
+  Arcadia_Natural8Value* q = buffer;
+  if (4 == image->targetBytesPerPixel) {
+    for (Arcadia_SizeValue i = 0, n = image->width; i < n; ++i) {
+      q[0] = p[image->offsets[0]];
+      q[1] = p[image->offsets[1]];
+      q[2] = p[image->offsets[2]];
+      q[3] = p[image->offsets[3]];
+      p += 4;
+      q += 4;
+    }
+  } else {
+    for (Arcadia_SizeValue i = 0, n = image->width; i < n; ++i) {
+      q[0] = p[image->offsets[0]];
+      q[1] = p[image->offsets[1]];
+      q[2] = p[image->offsets[2]];
+      p += 3;
+      q += 3;
+    }
+  }
+  return buffer;
+}
+
+static inline Arcadia_Natural8Value
+paeth
+  (
+    Arcadia_Natural8Value a,
+    Arcadia_Natural8Value b,
+    Arcadia_Natural8Value c
+  )
+{
+  int p = (int)a + (int)b - (int)c;
+  int pa = p > a ? p - a : a - p;
+  int pb = p > b ? p - b : b - p;
+  int pc = p > c ? p - c : c - p;
+  if (pa <= pb && pa <= pc) {
+    return a;
+  } else if (pb <= pc) {
+    return b;
+  } else {
+    return c;
+  }
+}
+
+// The absolute value of a filtered Byte interpreted as a signed Byte.
+static inline Arcadia_Natural32Value
+magnitude
+  (
+    Arcadia_Natural8Value x
+  )
+{ return x < 128 ? x : 256 - x; }
+
+// Filter a row.
+// The filter with the minimum sum of absolute differences is chosen.
+// The filter type is stored in the first Byte of the target, the filtered Bytes are stored in the following Bytes.
+static void
+filterRow
+  (
+    Arcadia_SizeValue bytesPerPixel,
+    Arcadia_SizeValue rowBytes,
+    Arcadia_Natural8Value const* current,
+    Arcadia_Natural8Value const* previous,
+    Arcadia_Natural8Value* target
+  )
+{
+  Arcadia_Natural32Value sums[5] = { 0, 0, 0, 0, 0 };
+  for (Arcadia_SizeValue i = 0; i < rowBytes; ++i) {
+    Arcadia_Natural8Value x = current[i];
+    Arcadia_Natural8Value a = i >= bytesPerPixel ? current[i - bytesPerPixel] : 0;
+    Arcadia_Natural8Value b = previous[i];
+    Arcadia_Natural8Value c = i >= bytesPerPixel ? previous[i - bytesPerPixel] : 0;
+    sums[0] += magnitude(x);
+    sums[1] += magnitude((Arcadia_Natural8Value)(x - a));
+    sums[2] += magnitude((Arcadia_Natural8Value)(x - b));
+    sums[3] += magnitude((Arcadia_Natural8Value)(x - ((a + b) >> 1)));
+    sums[4] += magnitude((Arcadia_Natural8Value)(x - paeth(a, b, c)));
+  }
+  Arcadia_Natural8Value filter = 0;
+  for (Arcadia_Natural8Value i = 1; i < 5; ++i) {
+    if (sums[i] < sums[filter]) {
+      filter = i;
+    }
+  }
+  target[0] = filter;
+  target++;
+  switch (filter) {
+    case 0: {
+      memcpy(target, current, rowBytes);
+    } break;
+    case 1: {
+      for (Arcadia_SizeValue i = 0; i < rowBytes; ++i) {
+        Arcadia_Natural8Value a = i >= bytesPerPixel ? current[i - bytesPerPixel] : 0;
+        target[i] = current[i] - a;
+      }
+    } break;
+    case 2: {
+      for (Arcadia_SizeValue i = 0; i < rowBytes; ++i) {
+        target[i] = current[i] - previous[i];
+      }
+    } break;
+    case 3: {
+      for (Arcadia_SizeValue i = 0; i < rowBytes; ++i) {
+        Arcadia_Natural8Value a = i >= bytesPerPixel ? current[i - bytesPerPixel] : 0;
+        target[i] = current[i] - (Arcadia_Natural8Value)((a + previous[i]) >> 1);
+      }
+    } break;
+    case 4: {
+      for (Arcadia_SizeValue i = 0; i < rowBytes; ++i) {
+        Arcadia_Natural8Value a = i >= bytesPerPixel ? current[i - bytesPerPixel] : 0;
+        Arcadia_Natural8Value c = i >= bytesPerPixel ? previous[i - bytesPerPixel] : 0;
+        target[i] = current[i] - paeth(a, previous[i], c);
+      }
+    } break;
+  };
+}
+
+// Invoke deflate until
+// - all input was consumed (Z_NO_FLUSH),
+// - all input was consumed and the output was flushed (Z_SYNC_FLUSH), or
+// - the stream was finished (Z_FINISH).
+// The output buffer of the job is grown as necessary.
+static void
+deflateRows
+  (
+    Arcadia_Thread* thread,
+    Job* job,
+    Arcadia_SizeValue* capacity,
+    z_stream* stream,
+    int flush
+  )
+{
+  while (Arcadia_BooleanValue_True) {
+    if (0 == stream->avail_out) {
+      Arcadia_SizeValue used = *capacity;
+      Arcadia_SizeValue newCapacity = *capacity * 2;
+      Arcadia_Memory_reallocateUnmanaged(thread, (void**)&job->bytes, newCapacity);
+      *capacity = newCapacity;
+      stream->next_out = job->bytes + used;
+      stream->avail_out = (uInt)(newCapacity - used);
+    }
+    int result = deflate(stream, flush);
+    if (Z_STREAM_ERROR == result) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+      Arcadia_Thread_jump(thread);
+    }
+    if (Z_NO_FLUSH == flush) {
+      if (0 == stream->avail_in) {
+        break;
+      }
+    } else if (Z_FINISH == flush) {
+      if (Z_STREAM_END == result) {
+        break;
+      }
+    } else {
+      if (0 != stream->avail_out) {
+        break;
+      }
+    }
+  }
+}
+
+// Filter and compress the rows of a job.
+static void
+Job_run
+  (
+    Arcadia_Thread* thread,
+    Job* job
+  )
+{
+  Image const* image = job->image;
+  Arcadia_SizeValue rowBytes = image->width * image->targetBytesPerPixel;
+  Arcadia_Natural8Value* scratch = NULL;
+  Arcadia_SizeValue capacity = 0;
+  z_stream stream;
+  memset(&stream, 0, sizeof(z_stream));
+  if (Z_OK != deflateInit2(&stream, job->compressionLevel, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    // Two buffers for the converted rows, one buffer for the filtered row.
+    scratch = Arcadia_Memory_allocateUnmanaged(thread, 2 * rowBytes + 1 + rowBytes);
+    Arcadia_Natural8Value* buffers[2] = { scratch, scratch + rowBytes };
+    Arcadia_Natural8Value* filtered = scratch + 2 * rowBytes;
+
+    // The number of Bytes of a sync flush or the final block is small, however, add some more Bytes to be on the safe side.
+    capacity = deflateBound(&stream, (uLong)(job->numberOfRows * (1 + rowBytes))) + 64;
+    job->bytes = Arcadia_Memory_allocateUnmanaged(thread, capacity);
+    stream.next_out = job->bytes;
+    stream.avail_out = (uInt)capacity;
+
+    Arcadia_Natural8Value const* previous;
+    if (0 == job->firstRow) {
+      memset(buffers[1], 0, rowBytes);
+      previous = buffers[1];
+    } else {
+      previous = getRow(image, job->firstRow - 1, buffers[1]);
+    }
+    job->adler = adler32(0L, Z_NULL, 0);
+    for (Arcadia_SizeValue i = 0; i < job->numberOfRows; ++i) {
+      // Do not overwrite the buffer holding the previous row.
+      Arcadia_Natural8Value* buffer = previous == buffers[0] ? buffers[1] : buffers[0];
+      Arcadia_Natural8Value const* current = getRow(image, job->firstRow + i, buffer);
+      filterRow(image->targetBytesPerPixel, rowBytes, current, previous, filtered);
+      job->adler = adler32(job->adler, filtered, (uInt)(1 + rowBytes));
+      stream.next_in = filtered;
+      stream.avail_in = (uInt)(1 + rowBytes);
+      deflateRows(thread, job, &capacity, &stream, Z_NO_FLUSH);
+      previous = current;
+    }
+    deflateRows(thread, job, &capacity, &stream, job->isLast ? Z_FINISH : Z_SYNC_FLUSH);
+    job->numberOfBytes = capacity - stream.avail_out;
+    job->numberOfFilteredBytes = job->numberOfRows * (1 + rowBytes);
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    deflateEnd(&stream);
+    if (scratch) {
+      Arcadia_Memory_deallocateUnmanaged(thread, scratch);
+      scratch = NULL;
+    }
+    Arcadia_Thread_jump(thread);
+  }
+  deflateEnd(&stream);
+  Arcadia_Memory_deallocateUnmanaged(thread, scratch);
+  scratch = NULL;
+}
+
+static void
+Job_runTask
+  (
+    Arcadia_Thread* thread,
+    void* context
+  )
+{ Job_run(thread, (Job*)context); }
+
+static void
+storeNatural32BigEndian
+  (
+    Arcadia_Natural8Value* target,
+    Arcadia_Natural32Value value
+  )
+{
+  target[0] = (Arcadia_Natural8Value)(value >> 24);
+  target[1] = (Arcadia_Natural8Value)(value >> 16);
+  target[2] = (Arcadia_Natural8Value)(value >> 8);
+  target[3] = (Arcadia_Natural8Value)(value >> 0);
+}
+
+// Write a chunk.
+// The data of the chunk is the concatenation of the prefix, the Bytes, and the suffix.
+static void
+writeChunk
+  (
+    Arcadia_Thread* thread,
+    Sink* sink,
+    char const* type,
+    Arcadia_Natural8Value const* prefix,
+    Arcadia_SizeValue numberOfPrefixBytes,
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes,
+    Arcadia_Natural8Value const* suffix,
+    Arcadia_SizeValue numberOfSuffixBytes
+  )
+{
+  Arcadia_SizeValue length = numberOfPrefixBytes + numberOfBytes + numberOfSuffixBytes;
+  if (length > 0x7fffffff) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Natural8Value header[8];
+  storeNatural32BigEndian(header, (Arcadia_Natural32Value)length);
+  memcpy(header + 4, type, 4);
+  uLong crc = crc32(0L, Z_NULL, 0);
+  crc = crc32(crc, header + 4, 4);
+  sink->write(thread, sink->context, header, 8);
+  if (numberOfPrefixBytes) {
+    crc = crc32(crc, prefix, (uInt)numberOfPrefixBytes);
+    sink->write(thread, sink->context, prefix, numberOfPrefixBytes);
+  }
+  if (numberOfBytes) {
+    crc = crc32(crc, bytes, (uInt)numberOfBytes);
+    sink->write(thread, sink->context, bytes, numberOfBytes);
+  }
+  if (numberOfSuffixBytes) {
+    crc = crc32(crc, suffix, (uInt)numberOfSuffixBytes);
+    sink->write(thread, sink->context, suffix, numberOfSuffixBytes);
+  }
+  Arcadia_Natural8Value footer[4];
+  storeNatural32BigEndian(footer, (Arcadia_Natural32Value)crc);
+  sink->write(thread, sink->context, footer, 4);
+}
+
+static void
+writeHeader
+  (
+    Arcadia_Thread* thread,
+    Sink* sink,
+    Image const* image
+  )
+{
+  static const Arcadia_Natural8Value signature[] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+  sink->write(thread, sink->context, signature, sizeof(signature));
+  Arcadia_Natural8Value ihdr[13];
+  storeNatural32BigEndian(ihdr + 0, (Arcadia_Natural32Value)image->width);
+  storeNatural32BigEndian(ihdr + 4, (Arcadia_Natural32Value)image->height);
+  ihdr[8] = 8; // bit depth
+  ihdr[9] = 4 == image->targetBytesPerPixel ? 6 : 2; // color type: RGBA or RGB
+  ihdr[10] = 0; // compression method: deflate
+  ihdr[11] = 0; // filter method: adaptive
+  ihdr[12] = 0; // interlace method: none
+  writeChunk(thread, sink, "IHDR", NULL, 0, ihdr, sizeof(ihdr), NULL, 0);
+}
+
+// Release the jobs.
+// Jobs which were forked but not joined are joined, errors raised by these jobs are ignored.
+static void
+releaseJobs
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ThreadPool* pool,
+    Job* jobs,
+    Arcadia_SizeValue numberOfJobs
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < numberOfJobs; ++i) {
+    Job* job = &jobs[i];
+    if (job->task) {
+      Arcadia_ThreadPool_Task* task = job->task;
+      job->task = NULL;
+      Arcadia_JumpTarget jumpTarget;
+      Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+      if (Arcadia_JumpTarget_save(&jumpTarget)) {
+        Arcadia_ThreadPool_join(thread, pool, task);
+      }
+      Arcadia_Thread_popJumpTarget(thread);
+    }
+    if (job->bytes) {
+      Arcadia_Memory_deallocateUnmanaged(thread, job->bytes);
+      job->bytes = NULL;
+    }
+  }
+}
+
+static void
+encode
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGEncoder* self,
+    Arcadia_Media_PixelBuffer* source,
+    Sink* sink
+  )
+{
+  Image image;
+  describeImage(thread, source, &image);
+  Arcadia_SizeValue rowBytes = image.width * image.targetBytesPerPixel;
+  Arcadia_SizeValue rowsPerChunk = self->chunkSize / (1 + rowBytes);
+  if (!rowsPerChunk) {
+    rowsPerChunk = 1;
+  }
+  Arcadia_SizeValue numberOfJobs = (image.height + rowsPerChunk - 1) / rowsPerChunk;
+
+  Arcadia_ThreadPool* pool = NULL;
+  Job* jobs = NULL;
+  // The workers read the pixels of the pixel buffer.
+  Arcadia_Object_lock(thread, (Arcadia_Object*)source);
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    jobs = Arcadia_Memory_allocateUnmanaged(thread, numberOfJobs * sizeof(Job));
+    for (Arcadia_SizeValue i = 0; i < numberOfJobs; ++i) {
+      jobs[i].image = &image;
+      jobs[i].compressionLevel = self->compressionLevel;
+      jobs[i].firstRow = i * rowsPerChunk;
+      jobs[i].numberOfRows = i + 1 < numberOfJobs ? rowsPerChunk : image.height - i * rowsPerChunk;
+      jobs[i].isLast = i + 1 == numberOfJobs;
+      jobs[i].bytes = NULL;
+      jobs[i].numberOfBytes = 0;
+      jobs[i].adler = 0;
+      jobs[i].numberOfFilteredBytes = 0;
+      jobs[i].task = NULL;
+    }
+    Arcadia_SizeValue numberOfJobsInFlight = 1;
+    if (numberOfJobs > 1 && 1 != self->numberOfWorkers) {
+      pool = Arcadia_ThreadPool_create(thread, self->numberOfWorkers);
+      numberOfJobsInFlight = ChunksPerWorker * Arcadia_ThreadPool_getNumberOfWorkers(thread, pool);
+    }
+
+    writeHeader(thread, sink, &image);
+
+    // The zlib header.
+    Arcadia_Natural8Value zlibHeader[2];
+    {
+      Arcadia_Natural8Value level = self->compressionLevel < 2 ? 0 : self->compressionLevel < 6 ? 1 : self->compressionLevel == 6 ? 2 : 3;
+      zlibHeader[0] = 0x78; // deflate, 32 KiB window
+      zlibHeader[1] = (Arcadia_Natural8Value)(level << 6);
+      zlibHeader[1] += 31 - ((zlibHeader[0] << 8) + zlibHeader[1]) % 31;
+    }
+    uLong adler = adler32(0L, Z_NULL, 0);
+    Arcadia_SizeValue forked = 0;
+    for (Arcadia_SizeValue i = 0; i < numberOfJobs; ++i) {
+      Job* job = &jobs[i];
+      if (pool) {
+        while (forked < numberOfJobs && forked < i + numberOfJobsInFlight) {
+          jobs[forked].task = Arcadia_ThreadPool_fork(thread, pool, &Job_runTask, &jobs[forked]);
+          forked++;
+        }
+        Arcadia_ThreadPool_Task* task = job->task;
+        job->task = NULL;
+        Arcadia_ThreadPool_join(thread, pool, task);
+      } else {
+        Job_run(thread, job);
+      }
+      adler = adler32_combine(adler, job->adler, (z_off_t)job->numberOfFilteredBytes);
+      Arcadia_Natural8Value zlibTrailer[4];
+      storeNatural32BigEndian(zlibTrailer, (Arcadia_Natural32Value)adler);
+      writeChunk(thread, sink, "IDAT", zlibHeader, 0 == i ? 2 : 0, job->bytes, job->numberOfBytes, zlibTrailer, job->isLast ? 4 : 0);
+      Arcadia_Memory_deallocateUnmanaged(thread, job->bytes);
+      job->bytes = NULL;
+    }
+    writeChunk(thread, sink, "IEND", NULL, 0, NULL, 0, NULL, 0);
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Status status = Arcadia_Thread_getStatus(thread);
+    if (jobs) {
+      releaseJobs(thread, pool, jobs, numberOfJobs);
+      Arcadia_Memory_deallocateUnmanaged(thread, jobs);
+      jobs = NULL;
+    }
+    if (pool) {
+      Arcadia_ThreadPool_destroy(thread, pool);
+      pool = NULL;
+    }
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)source);
+    Arcadia_Thread_setStatus(thread, status);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Memory_deallocateUnmanaged(thread, jobs);
+  jobs = NULL;
+  if (pool) {
+    Arcadia_ThreadPool_destroy(thread, pool);
+    pool = NULL;
+  }
+  Arcadia_Object_unlock(thread, (Arcadia_Object*)source);
+}
+
+static void
+writeToByteArrayBuilder
+  (
+    Arcadia_Thread* thread,
+    void* context,
+    void const* bytes,
+    Arcadia_SizeValue numberOfBytes
+  )
+{ Arcadia_ByteArrayBuilder_insertBackBytes(thread, (Arcadia_ByteArrayBuilder*)context, bytes, numberOfBytes); }
+
+static void
+writeToFileHandle
+  (
+    Arcadia_Thread* thread,
+    void* context,
+    void const* bytes,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  Arcadia_Natural8Value const* p = (Arcadia_Natural8Value const*)bytes;
+  while (numberOfBytes > 0) {
+    Arcadia_SizeValue bytesWritten = 0;
+    Arcadia_FileHandle_write(thread, (Arcadia_FileHandle*)context, p, numberOfBytes, &bytesWritten);
+    if (!bytesWritten) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+      Arcadia_Thread_jump(thread);
+    }
+    p += bytesWritten;
+    numberOfBytes -= bytesWritten;
+  }
+}
+
+Arcadia_Imaging_PNGEncoder*
+Arcadia_Imaging_PNGEncoder_create
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  Arcadia_ValueStack_pushNatural8Value(thread, 0);
+  ARCADIA_CREATEOBJECT(Arcadia_Imaging_PNGEncoder);
+}
+
+Arcadia_Integer32Value
+Arcadia_Imaging_PNGEncoder_getCompressionLevel
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGEncoder* self
+  )
+{ return self->compressionLevel; }
+
+void
+Arcadia_Imaging_PNGEncoder_setCompressionLevel
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGEncoder* self,
+    Arcadia_Integer32Value compressionLevel
+  )
+{
+  if (compressionLevel < 0 || compressionLevel > 9) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->compressionLevel = compressionLevel;
+}
+
+Arcadia_SizeValue
+Arcadia_Imaging_PNGEncoder_getChunkSize
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGEncoder* self
+  )
+{ return self->chunkSize; }
+
+void
+Arcadia_Imaging_PNGEncoder_setChunkSize
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGEncoder* self,
+    Arcadia_SizeValue chunkSize
+  )
+{
+  if (!chunkSize) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->chunkSize = chunkSize;
+}
+
+Arcadia_SizeValue
+Arcadia_Imaging_PNGEncoder_getNumberOfWorkers
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGEncoder* self
+  )
+{ return self->numberOfWorkers; }
+
+void
+Arcadia_Imaging_PNGEncoder_setNumberOfWorkers
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGEncoder* self,
+    Arcadia_SizeValue numberOfWorkers
+  )
+{ self->numberOfWorkers = numberOfWorkers; }
+
+void
+Arcadia_Imaging_PNGEncoder_encodeToByteArrayBuilder
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGEncoder* self,
+    Arcadia_Media_PixelBuffer* source,
+    Arcadia_ByteArrayBuilder* target
+  )
+{
+  Sink sink = { .write = &writeToByteArrayBuilder, .context = target };
+  encode(thread, self, source, &sink);
+}
+
+void
+Arcadia_Imaging_PNGEncoder_encodeToFileHandle
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGEncoder* self,
+    Arcadia_Media_PixelBuffer* source,
+    Arcadia_FileHandle* target
+  )
+{
+  Sink sink = { .write = &writeToFileHandle, .context = target };
+  encode(thread, self, source, &sink);
+}
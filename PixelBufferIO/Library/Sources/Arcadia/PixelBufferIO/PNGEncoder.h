@@ -0,0 +1,177 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_PIXELBUFFERIO_PNGENCODER_H_INCLUDED)
+#define ARCADIA_PIXELBUFFERIO_PNGENCODER_H_INCLUDED
+
+#include "Arcadia/Ring2/Include.h"
+#include "Arcadia/FileSystem/Include.h"
+#include "Arcadia/Media/Include.h"
+
+// An encoder for the "PNG" file format.
+//
+// The rows of the image are split into chunks.
+// The rows of each chunk are filtered and compressed independently of the other chunks such that chunks can be encoded in parallel.
+// The filter of each row is chosen adaptively: the filter with the minimum sum of absolute differences is used.
+// The compressed chunks are written as "IDAT" chunks to the target in order as soon as they are available.
+// At most two chunks per worker are in flight such that the memory used does not depend on the size of the image.
+//
+// The compressed chunks are raw deflate streams.
+// Each chunk but the last ends with a sync flush (an empty stored block) and the last chunk ends with a final block.
+// Their concatenation (preceded by a zlib header and followed by the Adler-32 checksum) is the zlib stream of the image.
+//
+// The pixel formats
+// - Arcadia_Media_PixelFormat_AlphaBlueGreenRedNatural8,
+// - Arcadia_Media_PixelFormat_AlphaRedGreenBlueNatural8,
+// - Arcadia_Media_PixelFormat_BlueGreenRedAlphaNatural8, and
+// - Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8
+// are encoded as 8 bit RGBA images.
+// The pixel formats
+// - Arcadia_Media_PixelFormat_BlueGreenRedNatural8 and
+// - Arcadia_Media_PixelFormat_RedGreenBlueNatural8
+// are encoded as 8 bit RGB images.
+Arcadia_declareObjectType(u8"Arcadia.Imaging.PNGEncoder", Arcadia_Imaging_PNGEncoder,
+                          u8"Arcadia.Object");
+
+struct Arcadia_Imaging_PNGEncoderDispatch {
+  Arcadia_ObjectDispatch _parent;
+};
+
+struct Arcadia_Imaging_PNGEncoder {
+  Arcadia_Object _parent;
+  // The compression level, a value from 0 (no compression) to 9 (best compression).
+  Arcadia_Integer32Value compressionLevel;
+  // The approximate number of Bytes of filtered image data per chunk.
+  Arcadia_SizeValue chunkSize;
+  // The number of workers. If 0, then the number of cores is used.
+  Arcadia_SizeValue numberOfWorkers;
+};
+
+/// @brief Create a PNG encoder.
+/// @param thread A pointer to this thread.
+/// @return A pointer to the PNG encoder.
+/// The compression level is 6, the chunk size is 256 KiB, and the number of workers is 0.
+Arcadia_Imaging_PNGEncoder*
+Arcadia_Imaging_PNGEncoder_create
+  (
+    Arcadia_Thread* thread
+  );
+
+/// @brief Get the compression level.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this PNG encoder.
+/// @return The compression level.
+Arcadia_Integer32Value
+Arcadia_Imaging_PNGEncoder_getCompressionLevel
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGEncoder* self
+  );
+
+/// @brief Set the compression level.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this PNG encoder.
+/// @param compressionLevel The compression level, a value from 0 (no compression) to 9 (best compression).
+/// @error #Arcadia_Status_ArgumentValueInvalid @a compressionLevel is not within the bounds of [0,9]
+void
+Arcadia_Imaging_PNGEncoder_setCompressionLevel
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGEncoder* self,
+    Arcadia_Integer32Value compressionLevel
+  );
+
+/// @brief Get the chunk size.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this PNG encoder.
+/// @return The chunk size.
+Arcadia_SizeValue
+Arcadia_Imaging_PNGEncoder_getChunkSize
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGEncoder* self
+  );
+
+/// @brief Set the chunk size.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this PNG encoder.
+/// @param chunkSize The approximate number of Bytes of filtered image data per chunk.
+/// A chunk consists of at least one row.
+/// Smaller chunks allow for more parallelism, larger chunks compress better.
+/// @error #Arcadia_Status_ArgumentValueInvalid @a chunkSize is @a 0
+void
+Arcadia_Imaging_PNGEncoder_setChunkSize
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGEncoder* self,
+    Arcadia_SizeValue chunkSize
+  );
+
+/// @brief Get the number of workers.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this PNG encoder.
+/// @return The number of workers.
+Arcadia_SizeValue
+Arcadia_Imaging_PNGEncoder_getNumberOfWorkers
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGEncoder* self
+  );
+
+/// @brief Set the number of workers.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this PNG encoder.
+/// @param numberOfWorkers The number of workers. If @a 0, then the number of cores is used. If @a 1, then the image is encoded on the calling thread.
+void
+Arcadia_Imaging_PNGEncoder_setNumberOfWorkers
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGEncoder* self,
+    Arcadia_SizeValue numberOfWorkers
+  );
+
+/// @brief Encode a pixel buffer and append the Bytes to a byte array builder.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this PNG encoder.
+/// @param source A pointer to the pixel buffer.
+/// @param target A pointer to the byte array builder.
+/// @error #Arcadia_Status_ArgumentValueInvalid the pixel format of @a source is not supported
+/// @error #Arcadia_Status_ArgumentValueInvalid the width or the height of @a source is @a 0
+void
+Arcadia_Imaging_PNGEncoder_encodeToByteArrayBuilder
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGEncoder* self,
+    Arcadia_Media_PixelBuffer* source,
+    Arcadia_ByteArrayBuilder* target
+  );
+
+/// @brief Encode a pixel buffer and write the Bytes to a file handle.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this PNG encoder.
+/// @param source A pointer to the pixel buffer.
+/// @param target A pointer to the file handle. The file handle must be opened for writing.
+/// @error #Arcadia_Status_ArgumentValueInvalid the pixel format of @a source is not supported
+/// @error #Arcadia_Status_ArgumentValueInvalid the width or the height of @a source is @a 0
+void
+Arcadia_Imaging_PNGEncoder_encodeToFileHandle
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGEncoder* self,
+    Arcadia_Media_PixelBuffer* source,
+    Arcadia_FileHandle* target
+  );
+
+#endif // ARCADIA_PIXELBUFFERIO_PNGENCODER_H_INCLUDED
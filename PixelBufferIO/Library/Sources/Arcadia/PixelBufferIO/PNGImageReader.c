@@ -0,0 +1,899 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/PixelBufferIO/PNGImageReader.h"
+
+#include <string.h>
+#include <zlib.h>
+
+#if Arcadia_Configuration_InstructionSetArchitecture == Arcadia_Configuration_InstructionSetArchitecture_X64
+  #include <emmintrin.h>
+  #define Arcadia_Imaging_PNGImageReader_WithSSE2 (1)
+  #define Arcadia_Imaging_PNGImageReader_WithNEON (0)
+#elif defined(__ARM_NEON)
+  #include <arm_neon.h>
+  #define Arcadia_Imaging_PNGImageReader_WithSSE2 (0)
+  #define Arcadia_Imaging_PNGImageReader_WithNEON (1)
+#else
+  #define Arcadia_Imaging_PNGImageReader_WithSSE2 (0)
+  #define Arcadia_Imaging_PNGImageReader_WithNEON (0)
+#endif
+
+static void
+Arcadia_Imaging_PNGImageReader_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGImageReader* self
+  );
+
+static void
+Arcadia_Imaging_PNGImageReader_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGImageReaderDispatch* self
+  );
+
+static void
+Arcadia_Imaging_PNGImageReader_visit
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGImageReader* self
+  );
+
+static Arcadia_ImmutableList*
+Arcadia_Imaging_PNGImageReader_getSupportedTypesImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGImageReader* self
+  );
+
+static Arcadia_Media_PixelBuffer*
+Arcadia_Imaging_PNGImageReader_readImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGImageReader* self,
+    Arcadia_Imaging_ImageReaderParameters* source
+  );
+
+// The color types.
+#define ColorType_Gray (0)
+#define ColorType_RedGreenBlue (2)
+#define ColorType_Palette (3)
+#define ColorType_GrayAlpha (4)
+#define ColorType_RedGreenBlueAlpha (6)
+
+// The filter types.
+#define FilterType_None (0)
+#define FilterType_Sub (1)
+#define FilterType_Up (2)
+#define FilterType_Average (3)
+#define FilterType_Paeth (4)
+
+typedef struct Decoder {
+  Arcadia_SizeValue width;
+  Arcadia_SizeValue height;
+  Arcadia_Natural8Value colorType;
+  // The number of Bytes per pixel in the image.
+  Arcadia_SizeValue bytesPerPixel;
+  // The number of Bytes per row in the image (without the filter type Byte).
+  Arcadia_SizeValue rowBytes;
+  // The palette in the pixel format of the pixel buffer.
+  Arcadia_Natural8Value palette[256][4];
+  Arcadia_SizeValue numberOfPaletteEntries;
+  // The colour key of a gray or red green blue image.
+  // Pixels of that colour are fully transparent, all other pixels are fully opaque.
+  Arcadia_BooleanValue hasColorKey;
+  Arcadia_Natural16Value colorKey[3];
+  // The pixel buffer.
+  Arcadia_Natural8Value* targetBytes;
+  Arcadia_SizeValue targetLineStride;
+  Arcadia_SizeValue targetBytesPerPixel;
+  // The offsets of the red, green, blue, and alpha component in a pixel of the pixel buffer.
+  // The offset of the alpha component is only meaningful if the pixel buffer has an alpha component.
+  Arcadia_SizeValue targetOffsets[4];
+  // Two buffers of 1 + rowBytes Bytes each: the current row and the previous row, both including the filter type Byte.
+  Arcadia_Natural8Value* rows;
+  Arcadia_Natural8Value* currentRow;
+  Arcadia_Natural8Value* previousRow;
+  // The number of Bytes of the current row inflated so far.
+  Arcadia_SizeValue currentRowBytes;
+  // The index of the current row.
+  Arcadia_SizeValue y;
+  z_stream stream;
+  Arcadia_BooleanValue streamInitialized;
+} Decoder;
+
+static inline Arcadia_Natural32Value
+loadNatural32BigEndian
+  (
+    Arcadia_Natural8Value const* p
+  )
+{ return ((Arcadia_Natural32Value)p[0] << 24) | ((Arcadia_Natural32Value)p[1] << 16) | ((Arcadia_Natural32Value)p[2] << 8) | ((Arcadia_Natural32Value)p[3] << 0); }
+
+static inline Arcadia_Natural8Value
+paeth
+  (
+    Arcadia_Natural8Value a,
+    Arcadia_Natural8Value b,
+    Arcadia_Natural8Value c
+  )
+{
+  int p = (int)a + (int)b - (int)c;
+  int pa = p > a ? p - a : a - p;
+  int pb = p > b ? p - b : b - p;
+  int pc = p > c ? p - c : c - p;
+  if (pa <= pb && pa <= pc) {
+    return a;
+  } else if (pb <= pc) {
+    return b;
+  } else {
+    return c;
+  }
+}
+
+static void
+unfilterUp
+  (
+    Arcadia_Natural8Value* row,
+    Arcadia_Natural8Value const* previous,
+    Arcadia_SizeValue rowBytes
+  )
+{
+  Arcadia_SizeValue i = 0;
+#if 1 == Arcadia_Imaging_PNGImageReader_WithSSE2
+  for (; i + 16 <= rowBytes; i += 16) {
+    __m128i x = _mm_loadu_si128((__m128i const*)(row + i));
+    __m128i b = _mm_loadu_si128((__m128i const*)(previous + i));
+    _mm_storeu_si128((__m128i*)(row + i), _mm_add_epi8(x, b));
+  }
+#elif 1 == Arcadia_Imaging_PNGImageReader_WithNEON
+  for (; i + 16 <= rowBytes; i += 16) {
+    vst1q_u8(row + i, vaddq_u8(vld1q_u8(row + i), vld1q_u8(previous + i)));
+  }
+#endif
+  for (; i < rowBytes; ++i) {
+    row[i] += previous[i];
+  }
+}
+
+#if 1 == Arcadia_Imaging_PNGImageReader_WithSSE2
+
+// Load a pixel of 3 or 4 Bytes into the lower Bytes of a vector.
+static inline __m128i
+loadPixel
+  (
+    Arcadia_Natural8Value const* p,
+    Arcadia_SizeValue bytesPerPixel
+  )
+{
+  int x = 0;
+  memcpy(&x, p, bytesPerPixel);
+  return _mm_cvtsi32_si128(x);
+}
+
+// Store the lower 3 or 4 Bytes of a vector.
+static inline void
+storePixel
+  (
+    Arcadia_Natural8Value* p,
+    __m128i v,
+    Arcadia_SizeValue bytesPerPixel
+  )
+{
+  int x = _mm_cvtsi128_si32(v);
+  memcpy(p, &x, bytesPerPixel);
+}
+
+// The unfilter functions for 3 and 4 Bytes per pixel process one pixel per iteration.
+// All Bytes of a pixel are processed in parallel.
+
+static void
+unfilterSubSSE2
+  (
+    Arcadia_Natural8Value* row,
+    Arcadia_SizeValue rowBytes,
+    Arcadia_SizeValue bytesPerPixel
+  )
+{
+  __m128i a = _mm_setzero_si128();
+  for (Arcadia_SizeValue i = 0; i < rowBytes; i += bytesPerPixel) {
+    a = _mm_add_epi8(a, loadPixel(row + i, bytesPerPixel));
+    storePixel(row + i, a, bytesPerPixel);
+  }
+}
+
+static void
+unfilterAverageSSE2
+  (
+    Arcadia_Natural8Value* row,
+    Arcadia_Natural8Value const* previous,
+    Arcadia_SizeValue rowBytes,
+    Arcadia_SizeValue bytesPerPixel
+  )
+{
+  const __m128i one = _mm_set1_epi8(1);
+  __m128i a = _mm_setzero_si128();
+  for (Arcadia_SizeValue i = 0; i < rowBytes; i += bytesPerPixel) {
+    __m128i b = loadPixel(previous + i, bytesPerPixel);
+    // _mm_avg_epu8 computes (a + b + 1) / 2, subtract 1 if a + b is odd to obtain (a + b) / 2.
+    __m128i average = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), one));
+    a = _mm_add_epi8(loadPixel(row + i, bytesPerPixel), average);
+    storePixel(row + i, a, bytesPerPixel);
+  }
+}
+
+static inline __m128i
+absoluteValue16
+  (
+    __m128i x
+  )
+{ return _mm_max_epi16(x, _mm_sub_epi16(_mm_setzero_si128(), x)); }
+
+static inline __m128i
+selectBits
+  (
+    __m128i condition,
+    __m128i whenTrue,
+    __m128i whenFalse
+  )
+{ return _mm_or_si128(_mm_and_si128(condition, whenTrue), _mm_andnot_si128(condition, whenFalse)); }
+
+static void
+unfilterPaethSSE2
+  (
+    Arcadia_Natural8Value* row,
+    Arcadia_Natural8Value const* previous,
+    Arcadia_SizeValue rowBytes,
+    Arcadia_SizeValue bytesPerPixel
+  )
+{
+  // The components are widened to 16 bit such that the differences do not overflow.
+  const __m128i zero = _mm_setzero_si128();
+  __m128i a = zero, c = zero;
+  for (Arcadia_SizeValue i = 0; i < rowBytes; i += bytesPerPixel) {
+    __m128i b = _mm_unpacklo_epi8(loadPixel(previous + i, bytesPerPixel), zero);
+    __m128i x = _mm_unpacklo_epi8(loadPixel(row + i, bytesPerPixel), zero);
+    // pa = |p - a| = |b - c|, pb = |p - b| = |a - c|, pc = |p - c| = |(b - c) + (a - c)|
+    __m128i pa = _mm_sub_epi16(b, c);
+    __m128i pb = _mm_sub_epi16(a, c);
+    __m128i pc = _mm_add_epi16(pa, pb);
+    pa = absoluteValue16(pa);
+    pb = absoluteValue16(pb);
+    pc = absoluteValue16(pc);
+    __m128i smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+    __m128i predictor = selectBits(_mm_cmpeq_epi16(smallest, pa), a, selectBits(_mm_cmpeq_epi16(smallest, pb), b, c));
+    // Adding Bytes keeps the upper Byte of each 16 bit lane zero.
+    a = _mm_add_epi8(x, predictor);
+    c = b;
+    storePixel(row + i, _mm_packus_epi16(a, a), bytesPerPixel);
+  }
+}
+
+#endif
+
+static void
+unfilterRow
+  (
+    Arcadia_Thread* thread,
+    Decoder* decoder
+  )
+{
+  Arcadia_Natural8Value filterType = decoder->currentRow[0];
+  Arcadia_Natural8Value* row = decoder->currentRow + 1;
+  Arcadia_Natural8Value const* previous = decoder->previousRow + 1;
+  Arcadia_SizeValue rowBytes = decoder->rowBytes;
+  Arcadia_SizeValue bpp = decoder->bytesPerPixel;
+  switch (filterType) {
+    case FilterType_None: {
+      /*Intentionally empty.*/
+    } break;
+    case FilterType_Sub: {
+    #if 1 == Arcadia_Imaging_PNGImageReader_WithSSE2
+      if (3 == bpp || 4 == bpp) {
+        unfilterSubSSE2(row, rowBytes, bpp);
+        break;
+      }
+    #endif
+      for (Arcadia_SizeValue i = bpp; i < rowBytes; ++i) {
+        row[i] += row[i - bpp];
+      }
+    } break;
+    case FilterType_Up: {
+      unfilterUp(row, previous, rowBytes);
+    } break;
+    case FilterType_Average: {
+    #if 1 == Arcadia_Imaging_PNGImageReader_WithSSE2
+      if (3 == bpp || 4 == bpp) {
+        unfilterAverageSSE2(row, previous, rowBytes, bpp);
+        break;
+      }
+    #endif
+      for (Arcadia_SizeValue i = 0; i < bpp; ++i) {
+        row[i] += previous[i] >> 1;
+      }
+      for (Arcadia_SizeValue i = bpp; i < rowBytes; ++i) {
+        row[i] += (Arcadia_Natural8Value)(((unsigned)row[i - bpp] + (unsigned)previous[i]) >> 1);
+      }
+    } break;
+    case FilterType_Paeth: {
+    #if 1 == Arcadia_Imaging_PNGImageReader_WithSSE2
+      if (3 == bpp || 4 == bpp) {
+        unfilterPaethSSE2(row, previous, rowBytes, bpp);
+        break;
+      }
+    #endif
+      for (Arcadia_SizeValue i = 0; i < bpp; ++i) {
+        row[i] += previous[i];
+      }
+      for (Arcadia_SizeValue i = bpp; i < rowBytes; ++i) {
+        row[i] += paeth(row[i - bpp], previous[i], previous[i - bpp]);
+      }
+    } break;
+    default: {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+      Arcadia_Thread_jump(thread);
+    } break;
+  };
+}
+
+#if 1 == Arcadia_Imaging_PNGImageReader_WithSSE2
+
+// Permute the Bytes of RGBA pixels into a pixel format with 4 Bytes per pixel.
+// Four pixels are processed per iteration.
+// The component at index i of a source pixel is moved to index offsets[i] of the target pixel.
+static Arcadia_SizeValue
+permuteRGBASSE2
+  (
+    Arcadia_Natural8Value* q,
+    Arcadia_Natural8Value const* p,
+    Arcadia_SizeValue n,
+    Arcadia_SizeValue const offsets[4]
+  )
+{
+  __m128i const mask = _mm_set1_epi32(0xff);
+  __m128i shifts[4];
+  for (Arcadia_SizeValue j = 0; j < 4; ++j) {
+    shifts[j] = _mm_cvtsi32_si128((int)(8 * offsets[j]));
+  }
+  Arcadia_SizeValue i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128i v = _mm_loadu_si128((__m128i const*)(p + 4 * i));
+    __m128i w = _mm_sll_epi32(_mm_and_si128(v, mask), shifts[0]);
+    w = _mm_or_si128(w, _mm_sll_epi32(_mm_and_si128(_mm_srli_epi32(v, 8), mask), shifts[1]));
+    w = _mm_or_si128(w, _mm_sll_epi32(_mm_and_si128(_mm_srli_epi32(v, 16), mask), shifts[2]));
+    w = _mm_or_si128(w, _mm_sll_epi32(_mm_srli_epi32(v, 24), shifts[3]));
+    _mm_storeu_si128((__m128i*)(q + 4 * i), w);
+  }
+  return i;
+}
+
+#endif
+
+// Convert the current row into the pixel format of the pixel buffer.
+static void
+convertRow
+  (
+    Decoder* decoder
+  )
+{
+  Arcadia_Natural8Value const* p = decoder->currentRow + 1;
+  Arcadia_Natural8Value* q = decoder->targetBytes + decoder->y * decoder->targetLineStride;
+  Arcadia_SizeValue n = decoder->width;
+  Arcadia_SizeValue qbpp = decoder->targetBytesPerPixel;
+  Arcadia_SizeValue r = decoder->targetOffsets[0], g = decoder->targetOffsets[1], b = decoder->targetOffsets[2], a = decoder->targetOffsets[3];
+  Arcadia_BooleanValue hasAlpha = 4 == qbpp;
+  switch (decoder->colorType) {
+    case ColorType_Gray: {
+      if (hasAlpha && decoder->hasColorKey) {
+        Arcadia_Natural16Value k = decoder->colorKey[0];
+        for (Arcadia_SizeValue i = 0; i < n; ++i) {
+          q[r] = q[g] = q[b] = p[0];
+          q[a] = k == p[0] ? 0 : 255;
+          p += 1;
+          q += qbpp;
+        }
+        break;
+      }
+      for (Arcadia_SizeValue i = 0; i < n; ++i) {
+        q[r] = q[g] = q[b] = p[0];
+        if (hasAlpha) q[a] = 255;
+        p += 1;
+        q += qbpp;
+      }
+    } break;
+    case ColorType_GrayAlpha: {
+      for (Arcadia_SizeValue i = 0; i < n; ++i) {
+        q[r] = q[g] = q[b] = p[0];
+        if (hasAlpha) q[a] = p[1];
+        p += 2;
+        q += qbpp;
+      }
+    } break;
+    case ColorType_Palette: {
+      for (Arcadia_SizeValue i = 0; i < n; ++i) {
+        // Indices out of bounds refer to black opaque entries.
+        memcpy(q, decoder->palette[p[0]], qbpp);
+        p += 1;
+        q += qbpp;
+      }
+    } break;
+    case ColorType_RedGreenBlue: {
+      if (3 == qbpp && 0 == r && 1 == g && 2 == b) {
+        memcpy(q, p, n * 3);
+        break;
+      }
+      if (hasAlpha && decoder->hasColorKey) {
+        Arcadia_Natural16Value const* k = decoder->colorKey;
+        for (Arcadia_SizeValue i = 0; i < n; ++i) {
+          q[r] = p[0];
+          q[g] = p[1];
+          q[b] = p[2];
+          q[a] = k[0] == p[0] && k[1] == p[1] && k[2] == p[2] ? 0 : 255;
+          p += 3;
+          q += qbpp;
+        }
+        break;
+      }
+      for (Arcadia_SizeValue i = 0; i < n; ++i) {
+        q[r] = p[0];
+        q[g] = p[1];
+        q[b] = p[2];
+        if (hasAlpha) q[a] = 255;
+        p += 3;
+        q += qbpp;
+      }
+    } break;
+    case ColorType_RedGreenBlueAlpha: {
+      if (4 == qbpp && 0 == r && 1 == g && 2 == b && 3 == a) {
+        memcpy(q, p, n * 4);
+        break;
+      }
+      Arcadia_SizeValue i = 0;
+    #if 1 == Arcadia_Imaging_PNGImageReader_WithSSE2
+      if (4 == qbpp) {
+        i = permuteRGBASSE2(q, p, n, decoder->targetOffsets);
+        p += 4 * i;
+        q += 4 * i;
+      }
+    #endif
+      for (; i < n; ++i) {
+        q[r] = p[0];
+        q[g] = p[1];
+        q[b] = p[2];
+        if (hasAlpha) q[a] = p[3];
+        p += 4;
+        q += qbpp;
+      }
+    } break;
+  };
+}
+
+// Inflate the data of an "IDAT" chunk.
+// Complete rows are unfiltered and converted as soon as they are available.
+static void
+inflateImageData
+  (
+    Arcadia_Thread* thread,
+    Decoder* decoder,
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  decoder->stream.next_in = (Bytef*)bytes;
+  decoder->stream.avail_in = (uInt)numberOfBytes;
+  while (decoder->stream.avail_in > 0 && decoder->y < decoder->height) {
+    Arcadia_SizeValue bytesPerRow = 1 + decoder->rowBytes;
+    decoder->stream.next_out = decoder->currentRow + decoder->currentRowBytes;
+    decoder->stream.avail_out = (uInt)(bytesPerRow - decoder->currentRowBytes);
+    int result = inflate(&decoder->stream, Z_NO_FLUSH);
+    if (Z_OK != result && Z_STREAM_END != result && Z_BUF_ERROR != result) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+      Arcadia_Thread_jump(thread);
+    }
+    decoder->currentRowBytes = bytesPerRow - decoder->stream.avail_out;
+    if (decoder->currentRowBytes == bytesPerRow) {
+      unfilterRow(thread, decoder);
+      convertRow(decoder);
+      Arcadia_Natural8Value* temporary = decoder->previousRow;
+      decoder->previousRow = decoder->currentRow;
+      decoder->currentRow = temporary;
+      decoder->currentRowBytes = 0;
+      decoder->y++;
+    }
+    if (Z_STREAM_END == result || Z_BUF_ERROR == result) {
+      // Z_STREAM_END: No more rows are available. Z_BUF_ERROR: No progress was possible.
+      break;
+    }
+  }
+}
+
+static void
+describeTarget
+  (
+    Arcadia_Thread* thread,
+    Decoder* decoder,
+    Arcadia_Natural8Value pixelFormat
+  )
+{
+  switch (pixelFormat) {
+    case Arcadia_Media_PixelFormat_AlphaBlueGreenRedNatural8: {
+      decoder->targetBytesPerPixel = 4;
+      decoder->targetOffsets[0] = 3; decoder->targetOffsets[1] = 2; decoder->targetOffsets[2] = 1; decoder->targetOffsets[3] = 0;
+    } break;
+    case Arcadia_Media_PixelFormat_AlphaRedGreenBlueNatural8: {
+      decoder->targetBytesPerPixel = 4;
+      decoder->targetOffsets[0] = 1; decoder->targetOffsets[1] = 2; decoder->targetOffsets[2] = 3; decoder->targetOffsets[3] = 0;
+    } break;
+    case Arcadia_Media_PixelFormat_BlueGreenRedAlphaNatural8: {
+      decoder->targetBytesPerPixel = 4;
+      decoder->targetOffsets[0] = 2; decoder->targetOffsets[1] = 1; decoder->targetOffsets[2] = 0; decoder->targetOffsets[3] = 3;
+    } break;
+    case Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8: {
+      decoder->targetBytesPerPixel = 4;
+      decoder->targetOffsets[0] = 0; decoder->targetOffsets[1] = 1; decoder->targetOffsets[2] = 2; decoder->targetOffsets[3] = 3;
+    } break;
+    case Arcadia_Media_PixelFormat_BlueGreenRedNatural8: {
+      decoder->targetBytesPerPixel = 3;
+      decoder->targetOffsets[0] = 2; decoder->targetOffsets[1] = 1; decoder->targetOffsets[2] = 0; decoder->targetOffsets[3] = 0;
+    } break;
+    case Arcadia_Media_PixelFormat_RedGreenBlueNatural8: {
+      decoder->targetBytesPerPixel = 3;
+      decoder->targetOffsets[0] = 0; decoder->targetOffsets[1] = 1; decoder->targetOffsets[2] = 2; decoder->targetOffsets[3] = 0;
+    } break;
+    default: {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+      Arcadia_Thread_jump(thread);
+    } break;
+  };
+}
+
+// Store a palette entry in the pixel format of the pixel buffer.
+static void
+setPaletteEntry
+  (
+    Decoder* decoder,
+    Arcadia_SizeValue index,
+    Arcadia_Natural8Value r,
+    Arcadia_Natural8Value g,
+    Arcadia_Natural8Value b,
+    Arcadia_Natural8Value a
+  )
+{
+  Arcadia_Natural8Value* q = decoder->palette[index];
+  q[decoder->targetOffsets[0]] = r;
+  q[decoder->targetOffsets[1]] = g;
+  q[decoder->targetOffsets[2]] = b;
+  if (4 == decoder->targetBytesPerPixel) {
+    q[decoder->targetOffsets[3]] = a;
+  }
+}
+
+static void
+Decoder_uninitialize
+  (
+    Arcadia_Thread* thread,
+    Decoder* decoder
+  )
+{
+  if (decoder->streamInitialized) {
+    inflateEnd(&decoder->stream);
+    decoder->streamInitialized = Arcadia_BooleanValue_False;
+  }
+  if (decoder->rows) {
+    Arcadia_Memory_deallocateUnmanaged(thread, decoder->rows);
+    decoder->rows = NULL;
+  }
+}
+
+static void
+Decoder_readHeader
+  (
+    Arcadia_Thread* thread,
+    Decoder* decoder,
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  if (13 != numberOfBytes) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Natural32Value width = loadNatural32BigEndian(bytes + 0);
+  Arcadia_Natural32Value height = loadNatural32BigEndian(bytes + 4);
+  Arcadia_Natural8Value bitDepth = bytes[8];
+  Arcadia_Natural8Value colorType = bytes[9];
+  Arcadia_Natural8Value compressionMethod = bytes[10];
+  Arcadia_Natural8Value filterMethod = bytes[11];
+  Arcadia_Natural8Value interlaceMethod = bytes[12];
+  if (0 == width || 0 == height || width > Arcadia_Integer32Value_Maximum || height > Arcadia_Integer32Value_Maximum) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  if (0 != compressionMethod || 0 != filterMethod || interlaceMethod > 1) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  switch (colorType) {
+    case ColorType_Gray: {
+      decoder->bytesPerPixel = 1;
+    } break;
+    case ColorType_GrayAlpha: {
+      decoder->bytesPerPixel = 2;
+    } break;
+    case ColorType_Palette: {
+      decoder->bytesPerPixel = 1;
+    } break;
+    case ColorType_RedGreenBlue: {
+      decoder->bytesPerPixel = 3;
+    } break;
+    case ColorType_RedGreenBlueAlpha: {
+      decoder->bytesPerPixel = 4;
+    } break;
+    default: {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+      Arcadia_Thread_jump(thread);
+    } break;
+  };
+  if (8 != bitDepth || 0 != interlaceMethod) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NotImplemented);
+    Arcadia_Thread_jump(thread);
+  }
+  decoder->width = width;
+  decoder->height = height;
+  decoder->colorType = colorType;
+  decoder->rowBytes = decoder->width * decoder->bytesPerPixel;
+}
+
+static Arcadia_Media_PixelBuffer*
+decode
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes,
+    Arcadia_Natural8Value pixelFormat
+  )
+{
+  static const Arcadia_Natural8Value signature[] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+  if (numberOfBytes < sizeof(signature) || memcmp(bytes, signature, sizeof(signature))) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Decoder decoder;
+  memset(&decoder, 0, sizeof(Decoder));
+  describeTarget(thread, &decoder, pixelFormat);
+  Arcadia_Media_PixelBuffer* pixelBuffer = NULL;
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_SizeValue position = sizeof(signature);
+    Arcadia_BooleanValue end = Arcadia_BooleanValue_False;
+    while (!end) {
+      if (numberOfBytes - position < 12) {
+        Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+        Arcadia_Thread_jump(thread);
+      }
+      Arcadia_SizeValue length = loadNatural32BigEndian(bytes + position);
+      Arcadia_Natural8Value const* type = bytes + position + 4;
+      Arcadia_Natural8Value const* data = bytes + position + 8;
+      if (length > 0x7fffffff || numberOfBytes - position - 12 < length) {
+        Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+        Arcadia_Thread_jump(thread);
+      }
+      if (crc32(crc32(0L, Z_NULL, 0), type, (uInt)(4 + length)) != loadNatural32BigEndian(data + length)) {
+        Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+        Arcadia_Thread_jump(thread);
+      }
+      Arcadia_BooleanValue isHeader = !memcmp(type, "IHDR", 4);
+      if (isHeader != !pixelBuffer) {
+        // The "IHDR" chunk must be the first chunk and must not occur more than once.
+        Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+        Arcadia_Thread_jump(thread);
+      }
+      if (isHeader) {
+        Decoder_readHeader(thread, &decoder, data, length);
+        for (Arcadia_SizeValue i = 0; i < 256; ++i) {
+          setPaletteEntry(&decoder, i, 0, 0, 0, 255);
+        }
+        decoder.rows = Arcadia_Memory_allocateUnmanaged(thread, 2 * (1 + decoder.rowBytes));
+        memset(decoder.rows, 0, 2 * (1 + decoder.rowBytes));
+        decoder.currentRow = decoder.rows;
+        decoder.previousRow = decoder.rows + 1 + decoder.rowBytes;
+        if (Z_OK != inflateInit(&decoder.stream)) {
+          Arcadia_Thread_setStatus(thread, Arcadia_Status_AllocationFailed);
+          Arcadia_Thread_jump(thread);
+        }
+        decoder.streamInitialized = Arcadia_BooleanValue_True;
+        pixelBuffer = Arcadia_Media_PixelBuffer_create(thread, 0, (Arcadia_Integer32Value)decoder.width, (Arcadia_Integer32Value)decoder.height, pixelFormat);
+        decoder.targetBytes = pixelBuffer->bytes;
+        decoder.targetLineStride = Arcadia_Media_PixelBuffer_getLineStride(thread, pixelBuffer);
+      } else if (!memcmp(type, "PLTE", 4)) {
+        if (0 != length % 3 || length / 3 > 256) {
+          Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+          Arcadia_Thread_jump(thread);
+        }
+        decoder.numberOfPaletteEntries = length / 3;
+        for (Arcadia_SizeValue i = 0; i < decoder.numberOfPaletteEntries; ++i) {
+          setPaletteEntry(&decoder, i, data[i * 3 + 0], data[i * 3 + 1], data[i * 3 + 2], 255);
+        }
+      } else if (!memcmp(type, "tRNS", 4)) {
+        // The "tRNS" chunk must precede the first "IDAT" chunk.
+        if (decoder.stream.total_in) {
+          Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+          Arcadia_Thread_jump(thread);
+        }
+        if (ColorType_Palette == decoder.colorType) {
+          if (length > decoder.numberOfPaletteEntries) {
+            Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+            Arcadia_Thread_jump(thread);
+          }
+          if (4 == decoder.targetBytesPerPixel) {
+            for (Arcadia_SizeValue i = 0; i < length; ++i) {
+              decoder.palette[i][decoder.targetOffsets[3]] = data[i];
+            }
+          }
+        } else if (ColorType_Gray == decoder.colorType || ColorType_RedGreenBlue == decoder.colorType) {
+          // One (gray) or three (red, green, blue) samples of 2 Bytes each.
+          // A sample greater than 255 matches no pixel of an image with 8 bits per sample.
+          Arcadia_SizeValue numberOfSamples = ColorType_Gray == decoder.colorType ? 1 : 3;
+          if (length != numberOfSamples * 2) {
+            Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+            Arcadia_Thread_jump(thread);
+          }
+          for (Arcadia_SizeValue i = 0; i < numberOfSamples; ++i) {
+            decoder.colorKey[i] = (Arcadia_Natural16Value)((data[i * 2 + 0] << 8) | data[i * 2 + 1]);
+          }
+          decoder.hasColorKey = Arcadia_BooleanValue_True;
+        }
+      } else if (!memcmp(type, "IDAT", 4)) {
+        if (ColorType_Palette == decoder.colorType && !decoder.numberOfPaletteEntries) {
+          Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+          Arcadia_Thread_jump(thread);
+        }
+        inflateImageData(thread, &decoder, data, length);
+      } else if (!memcmp(type, "IEND", 4)) {
+        end = Arcadia_BooleanValue_True;
+      } else if (!(type[0] & 0x20)) {
+        // Unknown critical chunk.
+        Arcadia_Thread_setStatus(thread, Arcadia_Status_NotImplemented);
+        Arcadia_Thread_jump(thread);
+      }
+      position += 12 + length;
+    }
+    if (decoder.y != decoder.height) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+      Arcadia_Thread_jump(thread);
+    }
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Decoder_uninitialize(thread, &decoder);
+    Arcadia_Thread_jump(thread);
+  }
+  Decoder_uninitialize(thread, &decoder);
+  return pixelBuffer;
+}
+
+static Arcadia_ImmutableList*
+Arcadia_Imaging_PNGImageReader_getSupportedTypesImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGImageReader* self
+  )
+{ return self->supportedTypes; }
+
+static Arcadia_Media_PixelBuffer*
+Arcadia_Imaging_PNGImageReader_readImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGImageReader* self,
+    Arcadia_Imaging_ImageReaderParameters* source
+  )
+{
+  Arcadia_Value requestedExtension = Arcadia_Value_makeObjectReferenceValue(Arcadia_Imaging_ImageReaderParameters_getFormat(thread, source));
+  if (!Arcadia_List_contains(thread, (Arcadia_List*)self->supportedTypes, requestedExtension)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Natural8Value pixelFormat = Arcadia_Imaging_ImageReaderParameters_getPixelFormat(thread, source);
+  Arcadia_Natural8Value const* bytes = NULL;
+  Arcadia_SizeValue numberOfBytes = 0;
+  Arcadia_Object* owner = Arcadia_Imaging_ImageReaderParameters_lockBytes(thread, source, &bytes, &numberOfBytes);
+  Arcadia_Media_PixelBuffer* pixelBuffer = NULL;
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    pixelBuffer = decode(thread, bytes, numberOfBytes, pixelFormat);
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Object_unlock(thread, owner);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Object_unlock(thread, owner);
+  return pixelBuffer;
+}
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_Imaging_PNGImageReader_constructImpl,
+  .visit = (Arcadia_Object_VisitCallbackFunction*)&Arcadia_Imaging_PNGImageReader_visit,
+  .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_Imaging_PNGImageReader_initializeDispatchImpl,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.Imaging.PNGImageReader", Arcadia_Imaging_PNGImageReader,
+                         u8"Arcadia.Imaging.ImageReader", Arcadia_Imaging_ImageReader,
+                         &_typeOperations);
+
+static void
+Arcadia_Imaging_PNGImageReader_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGImageReader* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_Imaging_PNGImageReader);
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  if (0 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->supportedTypes = NULL;
+  Arcadia_List* supportedTypes = (Arcadia_List*)Arcadia_ArrayList_create(thread);
+  Arcadia_List_insertBackObjectReferenceValue(thread, supportedTypes, Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_create(thread, u8"png", sizeof(u8"png") - 1))));
+  self->supportedTypes = Arcadia_ImmutableList_create(thread, Arcadia_Value_makeObjectReferenceValue(supportedTypes));
+  Arcadia_LeaveConstructor(Arcadia_Imaging_PNGImageReader);
+}
+
+static void
+Arcadia_Imaging_PNGImageReader_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGImageReaderDispatch* self
+  )
+{
+  ((Arcadia_Imaging_ImageReaderDispatch*)self)->getSupportedTypes = (Arcadia_ImmutableList*(*)(Arcadia_Thread*, Arcadia_Imaging_ImageReader*))&Arcadia_Imaging_PNGImageReader_getSupportedTypesImpl;
+  ((Arcadia_Imaging_ImageReaderDispatch*)self)->read = (Arcadia_Media_PixelBuffer*(*)(Arcadia_Thread*, Arcadia_Imaging_ImageReader*, Arcadia_Imaging_ImageReaderParameters*))&Arcadia_Imaging_PNGImageReader_readImpl;
+}
+
+static void
+Arcadia_Imaging_PNGImageReader_visit
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Imaging_PNGImageReader* self
+  )
+{
+  if (self->supportedTypes) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->supportedTypes);
+  }
+}
+
+Arcadia_Imaging_PNGImageReader*
+Arcadia_Imaging_PNGImageReader_create
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  Arcadia_ValueStack_pushNatural8Value(thread, 0);
+  ARCADIA_CREATEOBJECT(Arcadia_Imaging_PNGImageReader);
+}
@@ -0,0 +1,44 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_PIXELBUFFERIO_PNGIMAGEREADER_H_INCLUDED)
+#define ARCADIA_PIXELBUFFERIO_PNGIMAGEREADER_H_INCLUDED
+
+#include "Arcadia/Ring2/Include.h"
+#include "Arcadia/PixelBufferIO/ImageReader.h"
+
+// A reader for the "PNG" file format.
+// Supported are non-interlaced images with a bit depth of 8 of all color types.
+// The transparency of palette images is supported, the transparency of other images ("tRNS" chunk) is ignored.
+// The image data is inflated row by row, each row is unfiltered and converted directly into the pixel format of the pixel buffer.
+Arcadia_declareObjectType(u8"Arcadia.Imaging.PNGImageReader", Arcadia_Imaging_PNGImageReader,
+                          u8"Arcadia.Imaging.ImageReader");
+
+struct Arcadia_Imaging_PNGImageReaderDispatch {
+  Arcadia_Imaging_ImageReaderDispatch _parent;
+};
+
+struct Arcadia_Imaging_PNGImageReader {
+  Arcadia_Imaging_ImageReader _parent;
+  Arcadia_ImmutableList* supportedTypes;
+};
+
+Arcadia_Imaging_PNGImageReader*
+Arcadia_Imaging_PNGImageReader_create
+  (
+    Arcadia_Thread* thread
+  );
+
+#endif // ARCADIA_PIXELBUFFERIO_PNGIMAGEREADER_H_INCLUDED
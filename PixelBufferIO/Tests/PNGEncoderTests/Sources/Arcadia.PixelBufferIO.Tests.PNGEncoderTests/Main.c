@@ -0,0 +1,210 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "Arcadia/PixelBufferIO/Include.h"
+#include "Arcadia/PixelBufferIO/PNGEncoder.h"
+
+#if Arcadia_Configuration_OperatingSystem == Arcadia_Configuration_OperatingSystem_Linux
+  #include <png.h>
+#endif
+
+// Fill a pixel buffer with a pattern which exercises all filters.
+static Arcadia_Media_PixelBuffer*
+createPixelBuffer
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Integer32Value width,
+    Arcadia_Integer32Value height,
+    Arcadia_Natural8Value pixelFormat
+  )
+{
+  Arcadia_Media_PixelBuffer* pixelBuffer = Arcadia_Media_PixelBuffer_create(thread, 3, width, height, pixelFormat);
+  Arcadia_Natural32Value seed = 7;
+  for (Arcadia_Integer32Value y = 0; y < height; ++y) {
+    for (Arcadia_Integer32Value x = 0; x < width; ++x) {
+      seed = seed * 1664525 + 1013904223;
+      Arcadia_Natural8Value noise = (Arcadia_Natural8Value)(seed >> 24);
+      Arcadia_Natural8Value r = (Arcadia_Natural8Value)(x * 3);
+      Arcadia_Natural8Value g = (Arcadia_Natural8Value)(y * 5);
+      Arcadia_Natural8Value b = (y / 8) % 2 ? noise : (Arcadia_Natural8Value)(x + y);
+      Arcadia_Natural8Value a = (Arcadia_Natural8Value)(255 - x);
+      Arcadia_Media_PixelBuffer_setPixelRGBA(thread, pixelBuffer, x, y, r, g, b, a);
+    }
+  }
+  return pixelBuffer;
+}
+
+// Decode the PNG image and compare its pixels with the pixels of the pixel buffer.
+static void
+assertEqual
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_PixelBuffer* expected,
+    Arcadia_ByteArrayBuilder* actual
+  )
+{
+  static const Arcadia_Natural8Value signature[] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+  Arcadia_Tests_assertTrue(thread, Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, actual) > sizeof(signature));
+  Arcadia_Tests_assertTrue(thread, !memcmp(Arcadia_ByteArrayBuilder_getBytes(thread, actual), signature, sizeof(signature)));
+#if Arcadia_Configuration_OperatingSystem == Arcadia_Configuration_OperatingSystem_Linux
+  png_image image;
+  memset(&image, 0, sizeof(png_image));
+  image.version = PNG_IMAGE_VERSION;
+  Arcadia_Tests_assertTrue(thread, png_image_begin_read_from_memory(&image, Arcadia_ByteArrayBuilder_getBytes(thread, actual), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, actual)));
+  Arcadia_Tests_assertTrue(thread, image.width == Arcadia_Media_PixelBuffer_getWidth(thread, expected));
+  Arcadia_Tests_assertTrue(thread, image.height == Arcadia_Media_PixelBuffer_getHeight(thread, expected));
+  image.format = PNG_FORMAT_RGBA;
+  Arcadia_Natural8Value* pixels = Arcadia_Memory_allocateUnmanaged(thread, PNG_IMAGE_SIZE(image));
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_Tests_assertTrue(thread, png_image_finish_read(&image, NULL, pixels, 0, NULL));
+    Arcadia_Tests_assertTrue(thread, 0 == (image.warning_or_error & PNG_IMAGE_ERROR));
+    Arcadia_BooleanValue hasAlpha = 4 == Arcadia_Media_PixelBuffer_getBytesPerPixel(thread, expected);
+    for (Arcadia_Integer32Value y = 0; y < (Arcadia_Integer32Value)image.height; ++y) {
+      for (Arcadia_Integer32Value x = 0; x < (Arcadia_Integer32Value)image.width; ++x) {
+        Arcadia_Natural8Value r, g, b, a;
+        Arcadia_Media_PixelBuffer_getPixelRGBA(thread, expected, x, y, &r, &g, &b, &a);
+        Arcadia_Natural8Value const* p = pixels + (y * image.width + x) * 4;
+        Arcadia_Tests_assertTrue(thread, p[0] == r && p[1] == g && p[2] == b && p[3] == (hasAlpha ? a : 255));
+      }
+    }
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Memory_deallocateUnmanaged(thread, pixels);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Memory_deallocateUnmanaged(thread, pixels);
+#endif
+}
+
+// Encode all supported pixel formats with different chunk sizes and numbers of workers.
+static void
+testEncode
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static const Arcadia_Natural8Value pixelFormats[] = {
+    Arcadia_Media_PixelFormat_AlphaBlueGreenRedNatural8,
+    Arcadia_Media_PixelFormat_AlphaRedGreenBlueNatural8,
+    Arcadia_Media_PixelFormat_BlueGreenRedAlphaNatural8,
+    Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8,
+    Arcadia_Media_PixelFormat_BlueGreenRedNatural8,
+    Arcadia_Media_PixelFormat_RedGreenBlueNatural8,
+  };
+  static const Arcadia_SizeValue chunkSizes[] = { 1, 1000, 256 * 1024 };
+  static const Arcadia_SizeValue numbersOfWorkers[] = { 1, 3 };
+  Arcadia_Imaging_PNGEncoder* encoder = Arcadia_Imaging_PNGEncoder_create(thread);
+  for (Arcadia_SizeValue i = 0; i < sizeof(pixelFormats) / sizeof(pixelFormats[0]); ++i) {
+    Arcadia_Media_PixelBuffer* pixelBuffer = createPixelBuffer(thread, 67, 45, pixelFormats[i]);
+    for (Arcadia_SizeValue j = 0; j < sizeof(chunkSizes) / sizeof(chunkSizes[0]); ++j) {
+      for (Arcadia_SizeValue k = 0; k < sizeof(numbersOfWorkers) / sizeof(numbersOfWorkers[0]); ++k) {
+        Arcadia_Imaging_PNGEncoder_setChunkSize(thread, encoder, chunkSizes[j]);
+        Arcadia_Imaging_PNGEncoder_setNumberOfWorkers(thread, encoder, numbersOfWorkers[k]);
+        Arcadia_ByteArrayBuilder* target = Arcadia_ByteArrayBuilder_create(thread);
+        Arcadia_Imaging_PNGEncoder_encodeToByteArrayBuilder(thread, encoder, pixelBuffer, target);
+        assertEqual(thread, pixelBuffer, target);
+      }
+    }
+  }
+}
+
+// Encode with all compression levels.
+static void
+testCompressionLevels
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Imaging_PNGEncoder* encoder = Arcadia_Imaging_PNGEncoder_create(thread);
+  Arcadia_Media_PixelBuffer* pixelBuffer = createPixelBuffer(thread, 1, 100, Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8);
+  Arcadia_Imaging_PNGEncoder_setChunkSize(thread, encoder, 64);
+  for (Arcadia_Integer32Value i = 0; i <= 9; ++i) {
+    Arcadia_Imaging_PNGEncoder_setCompressionLevel(thread, encoder, i);
+    Arcadia_Tests_assertTrue(thread, i == Arcadia_Imaging_PNGEncoder_getCompressionLevel(thread, encoder));
+    Arcadia_ByteArrayBuilder* target = Arcadia_ByteArrayBuilder_create(thread);
+    Arcadia_Imaging_PNGEncoder_encodeToByteArrayBuilder(thread, encoder, pixelBuffer, target);
+    assertEqual(thread, pixelBuffer, target);
+  }
+}
+
+// Invalid arguments are rejected.
+static void
+testInvalidArguments
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Imaging_PNGEncoder* encoder = Arcadia_Imaging_PNGEncoder_create(thread);
+  Arcadia_JumpTarget jumpTarget;
+
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_Imaging_PNGEncoder_setCompressionLevel(thread, encoder, 10);
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_BooleanValue_False);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_Status_ArgumentValueInvalid == Arcadia_Thread_getStatus(thread));
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_Imaging_PNGEncoder_setChunkSize(thread, encoder, 0);
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_BooleanValue_False);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_Status_ArgumentValueInvalid == Arcadia_Thread_getStatus(thread));
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+
+  Arcadia_Media_PixelBuffer* pixelBuffer = Arcadia_Media_PixelBuffer_create(thread, 0, 0, 8, Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8);
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_Imaging_PNGEncoder_encodeToByteArrayBuilder(thread, encoder, pixelBuffer, Arcadia_ByteArrayBuilder_create(thread));
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_BooleanValue_False);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_Status_ArgumentValueInvalid == Arcadia_Thread_getStatus(thread));
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+}
+
+int
+main
+  (
+    int argc,
+    char **argv
+  )
+{
+  if (!Arcadia_Tests_safeExecute(&testEncode)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testCompressionLevels)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testInvalidArguments)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,209 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "Arcadia/PixelBufferIO/Include.h"
+
+static const Arcadia_Natural8Value g_pixelFormats[] = {
+  Arcadia_Media_PixelFormat_AlphaBlueGreenRedNatural8,
+  Arcadia_Media_PixelFormat_AlphaRedGreenBlueNatural8,
+  Arcadia_Media_PixelFormat_BlueGreenRedAlphaNatural8,
+  Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8,
+  Arcadia_Media_PixelFormat_BlueGreenRedNatural8,
+  Arcadia_Media_PixelFormat_RedGreenBlueNatural8,
+};
+
+#define NumberOfPixelFormats (sizeof(g_pixelFormats) / sizeof(g_pixelFormats[0]))
+
+static Arcadia_String*
+makeString
+  (
+    Arcadia_Thread* thread,
+    char const* bytes
+  )
+{ return Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_create(thread, bytes, strlen(bytes)))); }
+
+// Fill a pixel buffer with a pattern which exercises all filters.
+static Arcadia_Media_PixelBuffer*
+createPixelBuffer
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Integer32Value width,
+    Arcadia_Integer32Value height,
+    Arcadia_Natural8Value pixelFormat
+  )
+{
+  Arcadia_Media_PixelBuffer* pixelBuffer = Arcadia_Media_PixelBuffer_create(thread, 0, width, height, pixelFormat);
+  Arcadia_Natural32Value seed = 7;
+  for (Arcadia_Integer32Value y = 0; y < height; ++y) {
+    for (Arcadia_Integer32Value x = 0; x < width; ++x) {
+      seed = seed * 1664525 + 1013904223;
+      Arcadia_Natural8Value noise = (Arcadia_Natural8Value)(seed >> 24);
+      Arcadia_Natural8Value r = (Arcadia_Natural8Value)(x * 3);
+      Arcadia_Natural8Value g = (Arcadia_Natural8Value)(y * 5);
+      Arcadia_Natural8Value b = (y / 8) % 2 ? noise : (Arcadia_Natural8Value)(x + y);
+      Arcadia_Natural8Value a = (Arcadia_Natural8Value)(255 - x);
+      Arcadia_Media_PixelBuffer_setPixelRGBA(thread, pixelBuffer, x, y, r, g, b, a);
+    }
+  }
+  return pixelBuffer;
+}
+
+// Compare the pixels of two pixel buffers.
+// The alpha components are only compared if both pixel buffers have an alpha component.
+static void
+assertEqual
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_PixelBuffer* expected,
+    Arcadia_Media_PixelBuffer* actual
+  )
+{
+  Arcadia_Tests_assertTrue(thread, Arcadia_Media_PixelBuffer_getWidth(thread, expected) == Arcadia_Media_PixelBuffer_getWidth(thread, actual));
+  Arcadia_Tests_assertTrue(thread, Arcadia_Media_PixelBuffer_getHeight(thread, expected) == Arcadia_Media_PixelBuffer_getHeight(thread, actual));
+  Arcadia_BooleanValue compareAlpha = 4 == Arcadia_Media_PixelBuffer_getBytesPerPixel(thread, expected)
+                                   && 4 == Arcadia_Media_PixelBuffer_getBytesPerPixel(thread, actual);
+  for (Arcadia_Integer32Value y = 0; y < Arcadia_Media_PixelBuffer_getHeight(thread, expected); ++y) {
+    for (Arcadia_Integer32Value x = 0; x < Arcadia_Media_PixelBuffer_getWidth(thread, expected); ++x) {
+      Arcadia_Natural8Value r0, g0, b0, a0, r1, g1, b1, a1;
+      Arcadia_Media_PixelBuffer_getPixelRGBA(thread, expected, x, y, &r0, &g0, &b0, &a0);
+      Arcadia_Media_PixelBuffer_getPixelRGBA(thread, actual, x, y, &r1, &g1, &b1, &a1);
+      Arcadia_Tests_assertTrue(thread, r0 == r1 && g0 == g1 && b0 == b1 && (!compareAlpha || a0 == a1));
+    }
+  }
+}
+
+static Arcadia_Imaging_ImageWriter*
+getWriter
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Imaging_ImageManager* imageManager = Arcadia_Imaging_ImageManager_getOrCreate(thread);
+  Arcadia_List* writers = Arcadia_Imaging_ImageManager_getWriters(thread, imageManager, makeString(thread, u8"bmp"));
+  Arcadia_Tests_assertTrue(thread, 0 != Arcadia_Collection_getSize(thread, (Arcadia_Collection*)writers));
+  return (Arcadia_Imaging_ImageWriter*)Arcadia_List_getObjectReferenceValueAt(thread, writers, 0);
+}
+
+static Arcadia_Imaging_ImageReader*
+getReader
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Imaging_ImageManager* imageManager = Arcadia_Imaging_ImageManager_getOrCreate(thread);
+  Arcadia_List* readers = Arcadia_Imaging_ImageManager_getReaders(thread, imageManager, makeString(thread, u8"bmp"));
+  Arcadia_Tests_assertTrue(thread, 0 != Arcadia_Collection_getSize(thread, (Arcadia_Collection*)readers));
+  return (Arcadia_Imaging_ImageReader*)Arcadia_List_getObjectReferenceValueAt(thread, readers, 0);
+}
+
+// Write images of all pixel formats to byte buffers and read them back into all pixel formats.
+static void
+testRoundTripByteBuffer
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Imaging_ImageWriter* writer = getWriter(thread);
+  Arcadia_Imaging_ImageReader* reader = getReader(thread);
+  for (Arcadia_SizeValue i = 0; i < NumberOfPixelFormats; ++i) {
+    Arcadia_Media_PixelBuffer* source = createPixelBuffer(thread, 67, 45, g_pixelFormats[i]);
+    Arcadia_List* sources = (Arcadia_List*)Arcadia_ArrayList_create(thread);
+    Arcadia_List_insertBackObjectReferenceValue(thread, sources, source);
+    Arcadia_ByteArrayBuilder* byteBuffer = Arcadia_ByteArrayBuilder_create(thread);
+    Arcadia_Imaging_ImageWriter_write(thread, writer, sources, Arcadia_Imaging_ImageWriterParameters_createByteBuffer(thread, byteBuffer, makeString(thread, u8"bmp")));
+    for (Arcadia_SizeValue j = 0; j < NumberOfPixelFormats; ++j) {
+      Arcadia_Imaging_ImageReaderParameters* parameters = Arcadia_Imaging_ImageReaderParameters_createByteBuffer(thread, byteBuffer, makeString(thread, u8"bmp"));
+      Arcadia_Imaging_ImageReaderParameters_setPixelFormat(thread, parameters, g_pixelFormats[j]);
+      Arcadia_Media_PixelBuffer* target = Arcadia_Imaging_ImageReader_read(thread, reader, parameters);
+      Arcadia_Tests_assertTrue(thread, g_pixelFormats[j] == Arcadia_Media_PixelBuffer_getPixelFormat(thread, target));
+      assertEqual(thread, source, target);
+    }
+  }
+}
+
+// Write an image to a file and read it back with and without mapping the file into memory.
+static void
+testRoundTripFile
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Imaging_ImageWriter* writer = getWriter(thread);
+  Arcadia_Imaging_ImageReader* reader = getReader(thread);
+  Arcadia_Media_PixelBuffer* source = createPixelBuffer(thread, 131, 17, Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8);
+  Arcadia_List* sources = (Arcadia_List*)Arcadia_ArrayList_create(thread);
+  Arcadia_List_insertBackObjectReferenceValue(thread, sources, source);
+  Arcadia_String* path = makeString(thread, u8"roundtrip.bmp");
+  Arcadia_Imaging_ImageWriter_write(thread, writer, sources, Arcadia_Imaging_ImageWriterParameters_createFile(thread, path, makeString(thread, u8"bmp")));
+  for (Arcadia_SizeValue i = 0; i < 2; ++i) {
+    Arcadia_Imaging_ImageReaderParameters* parameters = Arcadia_Imaging_ImageReaderParameters_createFile(thread, path, makeString(thread, u8"bmp"));
+    Arcadia_Imaging_ImageReaderParameters_setMapFile(thread, parameters, 1 == i);
+    Arcadia_Tests_assertTrue(thread, (1 == i) == Arcadia_Imaging_ImageReaderParameters_getMapFile(thread, parameters));
+    Arcadia_Media_PixelBuffer* target = Arcadia_Imaging_ImageReader_read(thread, reader, parameters);
+    assertEqual(thread, source, target);
+  }
+}
+
+// Truncated images are rejected.
+static void
+testTruncated
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Imaging_ImageWriter* writer = getWriter(thread);
+  Arcadia_Imaging_ImageReader* reader = getReader(thread);
+  Arcadia_Media_PixelBuffer* source = createPixelBuffer(thread, 16, 16, Arcadia_Media_PixelFormat_RedGreenBlueNatural8);
+  Arcadia_List* sources = (Arcadia_List*)Arcadia_ArrayList_create(thread);
+  Arcadia_List_insertBackObjectReferenceValue(thread, sources, source);
+  Arcadia_ByteArrayBuilder* byteBuffer = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_Imaging_ImageWriter_write(thread, writer, sources, Arcadia_Imaging_ImageWriterParameters_createByteBuffer(thread, byteBuffer, makeString(thread, u8"bmp")));
+  Arcadia_SizeValue numberOfBytes = Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, byteBuffer);
+  Arcadia_ByteArrayBuilder* truncated = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, truncated, Arcadia_ByteArrayBuilder_getBytes(thread, byteBuffer), numberOfBytes / 2);
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_Imaging_ImageReader_read(thread, reader, Arcadia_Imaging_ImageReaderParameters_createByteBuffer(thread, truncated, makeString(thread, u8"bmp")));
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_BooleanValue_False);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_Status_EncodingInvalid == Arcadia_Thread_getStatus(thread));
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+}
+
+int
+main
+  (
+    int argc,
+    char **argv
+  )
+{
+  if (!Arcadia_Tests_safeExecute(&testRoundTripByteBuffer)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testRoundTripFile)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testTruncated)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
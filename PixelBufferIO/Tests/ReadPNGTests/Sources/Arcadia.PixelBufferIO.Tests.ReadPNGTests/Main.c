@@ -0,0 +1,454 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "Arcadia/PixelBufferIO/Include.h"
+
+#if Arcadia_Configuration_OperatingSystem == Arcadia_Configuration_OperatingSystem_Linux
+  #include <png.h>
+#endif
+
+static const Arcadia_Natural8Value g_pixelFormats[] = {
+  Arcadia_Media_PixelFormat_AlphaBlueGreenRedNatural8,
+  Arcadia_Media_PixelFormat_AlphaRedGreenBlueNatural8,
+  Arcadia_Media_PixelFormat_BlueGreenRedAlphaNatural8,
+  Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8,
+  Arcadia_Media_PixelFormat_BlueGreenRedNatural8,
+  Arcadia_Media_PixelFormat_RedGreenBlueNatural8,
+};
+
+#define NumberOfPixelFormats (sizeof(g_pixelFormats) / sizeof(g_pixelFormats[0]))
+
+static Arcadia_String*
+makeString
+  (
+    Arcadia_Thread* thread,
+    char const* bytes
+  )
+{ return Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_create(thread, bytes, strlen(bytes)))); }
+
+// Fill a pixel buffer with a pattern which exercises all filters.
+static Arcadia_Media_PixelBuffer*
+createPixelBuffer
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Integer32Value width,
+    Arcadia_Integer32Value height,
+    Arcadia_Natural8Value pixelFormat
+  )
+{
+  Arcadia_Media_PixelBuffer* pixelBuffer = Arcadia_Media_PixelBuffer_create(thread, 0, width, height, pixelFormat);
+  Arcadia_Natural32Value seed = 7;
+  for (Arcadia_Integer32Value y = 0; y < height; ++y) {
+    for (Arcadia_Integer32Value x = 0; x < width; ++x) {
+      seed = seed * 1664525 + 1013904223;
+      Arcadia_Natural8Value noise = (Arcadia_Natural8Value)(seed >> 24);
+      Arcadia_Natural8Value r = (Arcadia_Natural8Value)(x * 3);
+      Arcadia_Natural8Value g = (Arcadia_Natural8Value)(y * 5);
+      Arcadia_Natural8Value b = (y / 8) % 2 ? noise : (Arcadia_Natural8Value)(x + y);
+      Arcadia_Natural8Value a = (Arcadia_Natural8Value)(255 - x);
+      Arcadia_Media_PixelBuffer_setPixelRGBA(thread, pixelBuffer, x, y, r, g, b, a);
+    }
+  }
+  return pixelBuffer;
+}
+
+// Compare the pixels of two pixel buffers.
+// The alpha components are only compared if both pixel buffers have an alpha component.
+static void
+assertEqual
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_PixelBuffer* expected,
+    Arcadia_Media_PixelBuffer* actual
+  )
+{
+  Arcadia_Tests_assertTrue(thread, Arcadia_Media_PixelBuffer_getWidth(thread, expected) == Arcadia_Media_PixelBuffer_getWidth(thread, actual));
+  Arcadia_Tests_assertTrue(thread, Arcadia_Media_PixelBuffer_getHeight(thread, expected) == Arcadia_Media_PixelBuffer_getHeight(thread, actual));
+  Arcadia_BooleanValue compareAlpha = 4 == Arcadia_Media_PixelBuffer_getBytesPerPixel(thread, expected)
+                                   && 4 == Arcadia_Media_PixelBuffer_getBytesPerPixel(thread, actual);
+  for (Arcadia_Integer32Value y = 0; y < Arcadia_Media_PixelBuffer_getHeight(thread, expected); ++y) {
+    for (Arcadia_Integer32Value x = 0; x < Arcadia_Media_PixelBuffer_getWidth(thread, expected); ++x) {
+      Arcadia_Natural8Value r0, g0, b0, a0, r1, g1, b1, a1;
+      Arcadia_Media_PixelBuffer_getPixelRGBA(thread, expected, x, y, &r0, &g0, &b0, &a0);
+      Arcadia_Media_PixelBuffer_getPixelRGBA(thread, actual, x, y, &r1, &g1, &b1, &a1);
+      Arcadia_Tests_assertTrue(thread, r0 == r1 && g0 == g1 && b0 == b1 && (!compareAlpha || a0 == a1));
+    }
+  }
+}
+
+static Arcadia_Imaging_ImageWriter*
+getWriter
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Imaging_ImageManager* imageManager = Arcadia_Imaging_ImageManager_getOrCreate(thread);
+  Arcadia_List* writers = Arcadia_Imaging_ImageManager_getWriters(thread, imageManager, makeString(thread, u8"png"));
+  Arcadia_Tests_assertTrue(thread, 0 != Arcadia_Collection_getSize(thread, (Arcadia_Collection*)writers));
+  return (Arcadia_Imaging_ImageWriter*)Arcadia_List_getObjectReferenceValueAt(thread, writers, 0);
+}
+
+static Arcadia_Imaging_ImageReader*
+getReader
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Imaging_ImageManager* imageManager = Arcadia_Imaging_ImageManager_getOrCreate(thread);
+  Arcadia_List* readers = Arcadia_Imaging_ImageManager_getReaders(thread, imageManager, makeString(thread, u8"png"));
+  Arcadia_Tests_assertTrue(thread, 0 != Arcadia_Collection_getSize(thread, (Arcadia_Collection*)readers));
+  return (Arcadia_Imaging_ImageReader*)Arcadia_List_getObjectReferenceValueAt(thread, readers, 0);
+}
+
+// Write images of all pixel formats to byte buffers and read them back into all pixel formats.
+static void
+testRoundTripByteBuffer
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Imaging_ImageWriter* writer = getWriter(thread);
+  Arcadia_Imaging_ImageReader* reader = getReader(thread);
+  for (Arcadia_SizeValue i = 0; i < NumberOfPixelFormats; ++i) {
+    Arcadia_Media_PixelBuffer* source = createPixelBuffer(thread, 67, 45, g_pixelFormats[i]);
+    Arcadia_List* sources = (Arcadia_List*)Arcadia_ArrayList_create(thread);
+    Arcadia_List_insertBackObjectReferenceValue(thread, sources, source);
+    Arcadia_ByteArrayBuilder* byteBuffer = Arcadia_ByteArrayBuilder_create(thread);
+    Arcadia_Imaging_ImageWriter_write(thread, writer, sources, Arcadia_Imaging_ImageWriterParameters_createByteBuffer(thread, byteBuffer, makeString(thread, u8"png")));
+    for (Arcadia_SizeValue j = 0; j < NumberOfPixelFormats; ++j) {
+      Arcadia_Imaging_ImageReaderParameters* parameters = Arcadia_Imaging_ImageReaderParameters_createByteBuffer(thread, byteBuffer, makeString(thread, u8"png"));
+      Arcadia_Imaging_ImageReaderParameters_setPixelFormat(thread, parameters, g_pixelFormats[j]);
+      Arcadia_Media_PixelBuffer* target = Arcadia_Imaging_ImageReader_read(thread, reader, parameters);
+      Arcadia_Tests_assertTrue(thread, g_pixelFormats[j] == Arcadia_Media_PixelBuffer_getPixelFormat(thread, target));
+      assertEqual(thread, source, target);
+    }
+  }
+}
+
+// Write an image to a file and read it back with and without mapping the file into memory.
+static void
+testRoundTripFile
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Imaging_ImageWriter* writer = getWriter(thread);
+  Arcadia_Imaging_ImageReader* reader = getReader(thread);
+  Arcadia_Media_PixelBuffer* source = createPixelBuffer(thread, 131, 17, Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8);
+  Arcadia_List* sources = (Arcadia_List*)Arcadia_ArrayList_create(thread);
+  Arcadia_List_insertBackObjectReferenceValue(thread, sources, source);
+  Arcadia_String* path = makeString(thread, u8"roundtrip.png");
+  Arcadia_Imaging_ImageWriter_write(thread, writer, sources, Arcadia_Imaging_ImageWriterParameters_createFile(thread, path, makeString(thread, u8"png")));
+  for (Arcadia_SizeValue i = 0; i < 2; ++i) {
+    Arcadia_Imaging_ImageReaderParameters* parameters = Arcadia_Imaging_ImageReaderParameters_createFile(thread, path, makeString(thread, u8"png"));
+    Arcadia_Imaging_ImageReaderParameters_setMapFile(thread, parameters, 1 == i);
+    Arcadia_Tests_assertTrue(thread, (1 == i) == Arcadia_Imaging_ImageReaderParameters_getMapFile(thread, parameters));
+    Arcadia_Media_PixelBuffer* target = Arcadia_Imaging_ImageReader_read(thread, reader, parameters);
+    assertEqual(thread, source, target);
+  }
+}
+
+// Truncated images are rejected.
+static void
+testTruncated
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Imaging_ImageWriter* writer = getWriter(thread);
+  Arcadia_Imaging_ImageReader* reader = getReader(thread);
+  Arcadia_Media_PixelBuffer* source = createPixelBuffer(thread, 16, 16, Arcadia_Media_PixelFormat_RedGreenBlueNatural8);
+  Arcadia_List* sources = (Arcadia_List*)Arcadia_ArrayList_create(thread);
+  Arcadia_List_insertBackObjectReferenceValue(thread, sources, source);
+  Arcadia_ByteArrayBuilder* byteBuffer = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_Imaging_ImageWriter_write(thread, writer, sources, Arcadia_Imaging_ImageWriterParameters_createByteBuffer(thread, byteBuffer, makeString(thread, u8"png")));
+  Arcadia_SizeValue numberOfBytes = Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, byteBuffer);
+  Arcadia_ByteArrayBuilder* truncated = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, truncated, Arcadia_ByteArrayBuilder_getBytes(thread, byteBuffer), numberOfBytes / 2);
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_Imaging_ImageReader_read(thread, reader, Arcadia_Imaging_ImageReaderParameters_createByteBuffer(thread, truncated, makeString(thread, u8"png")));
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_BooleanValue_False);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_Status_EncodingInvalid == Arcadia_Thread_getStatus(thread));
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+}
+
+// Compute the CRC of a PNG chunk.
+static Arcadia_Natural32Value
+computeCrc
+  (
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  Arcadia_Natural32Value crc = 0xffffffff;
+  for (Arcadia_SizeValue i = 0; i < numberOfBytes; ++i) {
+    crc ^= bytes[i];
+    for (int j = 0; j < 8; ++j) {
+      crc = (crc >> 1) ^ (0xedb88320 & (0 - (crc & 1)));
+    }
+  }
+  return crc ^ 0xffffffff;
+}
+
+// Insert a "tRNS" chunk directly after the "IHDR" chunk of a PNG image.
+static Arcadia_ByteArrayBuilder*
+insertTransparencyChunk
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* source,
+    Arcadia_Natural8Value const* data,
+    Arcadia_SizeValue length
+  )
+{
+  // The signature (8 Bytes) and the "IHDR" chunk (12 + 13 Bytes).
+  static const Arcadia_SizeValue offset = 8 + 12 + 13;
+  Arcadia_Natural8Value chunk[12 + 6];
+  chunk[0] = 0; chunk[1] = 0; chunk[2] = 0; chunk[3] = (Arcadia_Natural8Value)length;
+  memcpy(chunk + 4, "tRNS", 4);
+  memcpy(chunk + 8, data, length);
+  Arcadia_Natural32Value crc = computeCrc(chunk + 4, 4 + length);
+  chunk[8 + length + 0] = (Arcadia_Natural8Value)(crc >> 24);
+  chunk[8 + length + 1] = (Arcadia_Natural8Value)(crc >> 16);
+  chunk[8 + length + 2] = (Arcadia_Natural8Value)(crc >> 8);
+  chunk[8 + length + 3] = (Arcadia_Natural8Value)(crc >> 0);
+  Arcadia_Natural8Value const* bytes = Arcadia_ByteArrayBuilder_getBytes(thread, source);
+  Arcadia_ByteArrayBuilder* target = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, bytes, offset);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, chunk, 12 + length);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, bytes + offset, Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, source) - offset);
+  return target;
+}
+
+// Pixels of red green blue images which match the colour key are transparent.
+static void
+testColorKey
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Imaging_ImageWriter* writer = getWriter(thread);
+  Arcadia_Imaging_ImageReader* reader = getReader(thread);
+  Arcadia_Integer32Value width = 23, height = 19;
+  Arcadia_Media_PixelBuffer* source = Arcadia_Media_PixelBuffer_create(thread, 0, width, height, Arcadia_Media_PixelFormat_RedGreenBlueNatural8);
+  Arcadia_Media_PixelBuffer* expected = Arcadia_Media_PixelBuffer_create(thread, 0, width, height, Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8);
+  for (Arcadia_Integer32Value y = 0; y < height; ++y) {
+    for (Arcadia_Integer32Value x = 0; x < width; ++x) {
+      // Every third pixel has the colour of the key, the other pixels differ from the key in one component.
+      Arcadia_Natural8Value r = 10, g = 20, b = 30;
+      switch ((x + y) % 3) {
+        case 1: { g = (Arcadia_Natural8Value)(21 + x); } break;
+        case 2: { b = (Arcadia_Natural8Value)(31 + y); } break;
+      };
+      Arcadia_Media_PixelBuffer_setPixelRGBA(thread, source, x, y, r, g, b, 255);
+      Arcadia_Media_PixelBuffer_setPixelRGBA(thread, expected, x, y, r, g, b, (x + y) % 3 ? 255 : 0);
+    }
+  }
+  Arcadia_List* sources = (Arcadia_List*)Arcadia_ArrayList_create(thread);
+  Arcadia_List_insertBackObjectReferenceValue(thread, sources, source);
+  Arcadia_ByteArrayBuilder* byteBuffer = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_Imaging_ImageWriter_write(thread, writer, sources, Arcadia_Imaging_ImageWriterParameters_createByteBuffer(thread, byteBuffer, makeString(thread, u8"png")));
+  static const Arcadia_Natural8Value key[] = { 0, 10, 0, 20, 0, 30 };
+  byteBuffer = insertTransparencyChunk(thread, byteBuffer, key, sizeof(key));
+  for (Arcadia_SizeValue i = 0; i < NumberOfPixelFormats; ++i) {
+    Arcadia_Imaging_ImageReaderParameters* parameters = Arcadia_Imaging_ImageReaderParameters_createByteBuffer(thread, byteBuffer, makeString(thread, u8"png"));
+    Arcadia_Imaging_ImageReaderParameters_setPixelFormat(thread, parameters, g_pixelFormats[i]);
+    Arcadia_Media_PixelBuffer* target = Arcadia_Imaging_ImageReader_read(thread, reader, parameters);
+    assertEqual(thread, expected, target);
+  }
+  // A colour key of the wrong size is rejected.
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_ByteArrayBuilder* invalid = Arcadia_ByteArrayBuilder_create(thread);
+    Arcadia_Imaging_ImageWriter_write(thread, writer, sources, Arcadia_Imaging_ImageWriterParameters_createByteBuffer(thread, invalid, makeString(thread, u8"png")));
+    invalid = insertTransparencyChunk(thread, invalid, key, 2);
+    Arcadia_Imaging_ImageReader_read(thread, reader, Arcadia_Imaging_ImageReaderParameters_createByteBuffer(thread, invalid, makeString(thread, u8"png")));
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_BooleanValue_False);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_Status_EncodingInvalid == Arcadia_Thread_getStatus(thread));
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+}
+
+#if Arcadia_Configuration_OperatingSystem == Arcadia_Configuration_OperatingSystem_Linux
+
+// Write an image using libpng.
+static Arcadia_ByteArrayBuilder*
+writeLibPngImage
+  (
+    Arcadia_Thread* thread,
+    png_image* image,
+    void const* buffer,
+    void const* colorMap
+  )
+{
+  png_alloc_size_t numberOfBytes = 0;
+  Arcadia_Tests_assertTrue(thread, png_image_write_get_memory_size(*image, numberOfBytes, 0, buffer, 0, colorMap));
+  Arcadia_ByteArrayBuilder* byteBuffer = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_Natural8Value* bytes = Arcadia_Memory_allocateUnmanaged(thread, numberOfBytes);
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_Tests_assertTrue(thread, png_image_write_to_memory(image, bytes, &numberOfBytes, 0, buffer, 0, colorMap));
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, byteBuffer, bytes, numberOfBytes);
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Memory_deallocateUnmanaged(thread, bytes);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Memory_deallocateUnmanaged(thread, bytes);
+  return byteBuffer;
+}
+
+// Read an image written by libpng.
+static void
+readLibPngImage
+  (
+    Arcadia_Thread* thread,
+    png_image* image,
+    void const* buffer,
+    void const* colorMap,
+    Arcadia_Media_PixelBuffer* expected
+  )
+{
+  Arcadia_ByteArrayBuilder* byteBuffer = writeLibPngImage(thread, image, buffer, colorMap);
+  Arcadia_Imaging_ImageReader* reader = getReader(thread);
+  Arcadia_Imaging_ImageReaderParameters* parameters = Arcadia_Imaging_ImageReaderParameters_createByteBuffer(thread, byteBuffer, makeString(thread, u8"png"));
+  Arcadia_Media_PixelBuffer* actual = Arcadia_Imaging_ImageReader_read(thread, reader, parameters);
+  assertEqual(thread, expected, actual);
+}
+
+// Read gray, gray alpha, and palette images.
+static void
+testColorTypes
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Integer32Value width = 37, height = 29;
+  Arcadia_Natural8Value buffer[37 * 29 * 2];
+  Arcadia_Natural8Value colorMap[256 * 4];
+  for (Arcadia_SizeValue i = 0; i < 256; ++i) {
+    colorMap[i * 4 + 0] = (Arcadia_Natural8Value)(i * 7);
+    colorMap[i * 4 + 1] = (Arcadia_Natural8Value)(255 - i);
+    colorMap[i * 4 + 2] = (Arcadia_Natural8Value)(i * 13);
+    colorMap[i * 4 + 3] = (Arcadia_Natural8Value)(i < 128 ? i * 2 : 255);
+  }
+  Arcadia_Media_PixelBuffer* expected = Arcadia_Media_PixelBuffer_create(thread, 0, width, height, Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8);
+  png_image image;
+
+  // Gray.
+  for (Arcadia_Integer32Value y = 0; y < height; ++y) {
+    for (Arcadia_Integer32Value x = 0; x < width; ++x) {
+      Arcadia_Natural8Value v = (Arcadia_Natural8Value)(x * y + x);
+      buffer[y * width + x] = v;
+      Arcadia_Media_PixelBuffer_setPixelRGBA(thread, expected, x, y, v, v, v, 255);
+    }
+  }
+  memset(&image, 0, sizeof(png_image));
+  image.version = PNG_IMAGE_VERSION;
+  image.width = width;
+  image.height = height;
+  image.format = PNG_FORMAT_GRAY;
+  // Do not convert between sRGB and linear.
+  image.flags = PNG_IMAGE_FLAG_FAST;
+  readLibPngImage(thread, &image, buffer, NULL, expected);
+
+  // Gray with a colour key.
+  for (Arcadia_Integer32Value y = 0; y < height; ++y) {
+    for (Arcadia_Integer32Value x = 0; x < width; ++x) {
+      Arcadia_Natural8Value v = buffer[y * width + x];
+      Arcadia_Media_PixelBuffer_setPixelRGBA(thread, expected, x, y, v, v, v, 12 == v ? 0 : 255);
+    }
+  }
+  static const Arcadia_Natural8Value key[] = { 0, 12 };
+  Arcadia_ByteArrayBuilder* byteBuffer = insertTransparencyChunk(thread, writeLibPngImage(thread, &image, buffer, NULL), key, sizeof(key));
+  assertEqual(thread, expected, Arcadia_Imaging_ImageReader_read(thread, getReader(thread), Arcadia_Imaging_ImageReaderParameters_createByteBuffer(thread, byteBuffer, makeString(thread, u8"png"))));
+
+  // Gray alpha.
+  for (Arcadia_Integer32Value y = 0; y < height; ++y) {
+    for (Arcadia_Integer32Value x = 0; x < width; ++x) {
+      Arcadia_Natural8Value v = (Arcadia_Natural8Value)(x * y + x), a = (Arcadia_Natural8Value)(x * 5 + y);
+      buffer[(y * width + x) * 2 + 0] = v;
+      buffer[(y * width + x) * 2 + 1] = a;
+      Arcadia_Media_PixelBuffer_setPixelRGBA(thread, expected, x, y, v, v, v, a);
+    }
+  }
+  memset(&image, 0, sizeof(png_image));
+  image.version = PNG_IMAGE_VERSION;
+  image.width = width;
+  image.height = height;
+  image.format = PNG_FORMAT_GA;
+  image.flags = PNG_IMAGE_FLAG_FAST;
+  readLibPngImage(thread, &image, buffer, NULL, expected);
+
+  // Palette with transparency.
+  for (Arcadia_Integer32Value y = 0; y < height; ++y) {
+    for (Arcadia_Integer32Value x = 0; x < width; ++x) {
+      Arcadia_Natural8Value i = (Arcadia_Natural8Value)(x * 3 + y * 11);
+      buffer[y * width + x] = i;
+      Arcadia_Media_PixelBuffer_setPixelRGBA(thread, expected, x, y, colorMap[i * 4 + 0], colorMap[i * 4 + 1], colorMap[i * 4 + 2], colorMap[i * 4 + 3]);
+    }
+  }
+  memset(&image, 0, sizeof(png_image));
+  image.version = PNG_IMAGE_VERSION;
+  image.width = width;
+  image.height = height;
+  image.format = PNG_FORMAT_RGBA_COLORMAP;
+  image.colormap_entries = 256;
+  image.flags = PNG_IMAGE_FLAG_FAST;
+  readLibPngImage(thread, &image, buffer, colorMap, expected);
+}
+
+#endif
+
+int
+main
+  (
+    int argc,
+    char **argv
+  )
+{
+  if (!Arcadia_Tests_safeExecute(&testRoundTripByteBuffer)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testRoundTripFile)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testTruncated)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testColorKey)) {
+    return EXIT_FAILURE;
+  }
+#if Arcadia_Configuration_OperatingSystem == Arcadia_Configuration_OperatingSystem_Linux
+  if (!Arcadia_Tests_safeExecute(&testColorTypes)) {
+    return EXIT_FAILURE;
+  }
+#endif
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,366 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/Collections/Include.h"
+#include "Arcadia/Benchmarks/Harness/Driver.h"
+
+// The number of objects created per repetition.
+// The objects of a repetition are reclaimed after the repetition, outside of the measured time.
+#define NumberOfObjects (100000)
+
+// A three-deep user type Level3 <: Level2 <: Level1 <: Arcadia.Object.
+// The constructor of Level3 accepts three Integer32 values, forwards two to the constructor of Level2 which forwards one to the constructor of Level1.
+// The types are defined twice:
+// - "Arcadia.Benchmarks.StackLevel1" ... "Arcadia.Benchmarks.StackLevel3" have constructors only.
+// - "Arcadia.Benchmarks.NativeLevel1" ... "Arcadia.Benchmarks.NativeLevel3" have native constructors.
+
+#define DeclareLevels(Prefix) \
+  Arcadia_declareObjectType(u8"Arcadia.Benchmarks." #Prefix "Level1", Prefix##Level1, u8"Arcadia.Object"); \
+  struct Prefix##Level1Dispatch { Arcadia_ObjectDispatch _parent; }; \
+  struct Prefix##Level1 { Arcadia_Object _parent; Arcadia_Integer32Value x; }; \
+  Arcadia_declareObjectType(u8"Arcadia.Benchmarks." #Prefix "Level2", Prefix##Level2, u8"Arcadia.Benchmarks." #Prefix "Level1"); \
+  struct Prefix##Level2Dispatch { Prefix##Level1Dispatch _parent; }; \
+  struct Prefix##Level2 { Prefix##Level1 _parent; Arcadia_Integer32Value y; }; \
+  Arcadia_declareObjectType(u8"Arcadia.Benchmarks." #Prefix "Level3", Prefix##Level3, u8"Arcadia.Benchmarks." #Prefix "Level2"); \
+  struct Prefix##Level3Dispatch { Prefix##Level2Dispatch _parent; }; \
+  struct Prefix##Level3 { Prefix##Level2 _parent; Arcadia_Integer32Value z; };
+
+DeclareLevels(Stack)
+DeclareLevels(Native)
+
+#undef DeclareLevels
+
+static void
+StackLevel1_constructImpl
+  (
+    Arcadia_Thread* thread,
+    StackLevel1* self
+  )
+{
+  Arcadia_EnterConstructor(StackLevel1);
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  if (1 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->x = Arcadia_ValueStack_getInteger32Value(thread, 1);
+  Arcadia_LeaveConstructor(StackLevel1);
+}
+
+static void
+StackLevel2_constructImpl
+  (
+    Arcadia_Thread* thread,
+    StackLevel2* self
+  )
+{
+  Arcadia_EnterConstructor(StackLevel2);
+  if (2 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  {
+    Arcadia_Value x = Arcadia_ValueStack_getValue(thread, 2);
+    Arcadia_ValueStack_pushValue(thread, &x);
+    Arcadia_ValueStack_pushNatural8Value(thread, 1);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  self->y = Arcadia_ValueStack_getInteger32Value(thread, 1);
+  Arcadia_LeaveConstructor(StackLevel2);
+}
+
+static void
+StackLevel3_constructImpl
+  (
+    Arcadia_Thread* thread,
+    StackLevel3* self
+  )
+{
+  Arcadia_EnterConstructor(StackLevel3);
+  if (3 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  {
+    Arcadia_Value x = Arcadia_ValueStack_getValue(thread, 3);
+    Arcadia_Value y = Arcadia_ValueStack_getValue(thread, 2);
+    Arcadia_ValueStack_pushValue(thread, &x);
+    Arcadia_ValueStack_pushValue(thread, &y);
+    Arcadia_ValueStack_pushNatural8Value(thread, 2);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  self->z = Arcadia_ValueStack_getInteger32Value(thread, 1);
+  Arcadia_LeaveConstructor(StackLevel3);
+}
+
+static void
+NativeLevel1_constructNativeImpl
+  (
+    Arcadia_Thread* thread,
+    NativeLevel1* self,
+    Arcadia_SizeValue numberOfArgumentValues,
+    Arcadia_Value const* argumentValues
+  )
+{
+  Arcadia_EnterNativeConstructor(NativeLevel1);
+  Arcadia_superTypeNativeConstructor(thread, _type, self, 0, NULL);
+  if (1 != numberOfArgumentValues || !Arcadia_Value_isInteger32Value(&argumentValues[0])) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentTypeInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->x = Arcadia_Value_getInteger32Value(&argumentValues[0]);
+  Arcadia_LeaveNativeConstructor(NativeLevel1);
+}
+
+static void
+NativeLevel2_constructNativeImpl
+  (
+    Arcadia_Thread* thread,
+    NativeLevel2* self,
+    Arcadia_SizeValue numberOfArgumentValues,
+    Arcadia_Value const* argumentValues
+  )
+{
+  Arcadia_EnterNativeConstructor(NativeLevel2);
+  if (2 != numberOfArgumentValues || !Arcadia_Value_isInteger32Value(&argumentValues[1])) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentTypeInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_superTypeNativeConstructor(thread, _type, self, 1, argumentValues);
+  self->y = Arcadia_Value_getInteger32Value(&argumentValues[1]);
+  Arcadia_LeaveNativeConstructor(NativeLevel2);
+}
+
+static void
+NativeLevel3_constructNativeImpl
+  (
+    Arcadia_Thread* thread,
+    NativeLevel3* self,
+    Arcadia_SizeValue numberOfArgumentValues,
+    Arcadia_Value const* argumentValues
+  )
+{
+  Arcadia_EnterNativeConstructor(NativeLevel3);
+  if (3 != numberOfArgumentValues || !Arcadia_Value_isInteger32Value(&argumentValues[2])) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentTypeInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_superTypeNativeConstructor(thread, _type, self, 2, argumentValues);
+  self->z = Arcadia_Value_getInteger32Value(&argumentValues[2]);
+  Arcadia_LeaveNativeConstructor(NativeLevel3);
+}
+
+#define NativeLevel(Name) \
+  static void \
+  Name##_constructImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Name* self \
+    ) \
+  { \
+    Arcadia_Object_constructNativeFromValueStack(thread, (Arcadia_Object*)self, _##Name##_getType(thread)); \
+  }
+
+NativeLevel(NativeLevel1)
+NativeLevel(NativeLevel2)
+NativeLevel(NativeLevel3)
+
+#undef NativeLevel
+
+#define DefineLevel(Name, ParentCilName, ParentName, ConstructNative) \
+  static const Arcadia_ObjectType_Operations _##Name##_objectTypeOperations = { \
+    Arcadia_ObjectType_Operations_Initializer, \
+    .construct = (Arcadia_Object_ConstructCallbackFunction*)&Name##_constructImpl, \
+    .constructNative = (Arcadia_Object_ConstructNativeCallbackFunction*)ConstructNative, \
+  }; \
+  \
+  static const Arcadia_Type_Operations _##Name##_typeOperations = { \
+    Arcadia_Type_Operations_Initializer, \
+    .objectTypeOperations = &_##Name##_objectTypeOperations, \
+  }; \
+  \
+  Arcadia_defineObjectType(u8"Arcadia.Benchmarks." #Name, Name, ParentCilName, ParentName, &_##Name##_typeOperations);
+
+DefineLevel(StackLevel1, u8"Arcadia.Object", Arcadia_Object, NULL)
+DefineLevel(StackLevel2, u8"Arcadia.Benchmarks.StackLevel1", StackLevel1, NULL)
+DefineLevel(StackLevel3, u8"Arcadia.Benchmarks.StackLevel2", StackLevel2, NULL)
+DefineLevel(NativeLevel1, u8"Arcadia.Object", Arcadia_Object, &NativeLevel1_constructNativeImpl)
+DefineLevel(NativeLevel2, u8"Arcadia.Benchmarks.NativeLevel1", NativeLevel1, &NativeLevel2_constructNativeImpl)
+DefineLevel(NativeLevel3, u8"Arcadia.Benchmarks.NativeLevel2", NativeLevel2, &NativeLevel3_constructNativeImpl)
+
+#undef DefineLevel
+
+// A string the created strings are created from.
+static Arcadia_String* g_prototype = NULL;
+
+// Create an object via the value stack protocol.
+static void
+createViaValueStack
+  (
+    Arcadia_Thread* thread,
+    Arcadia_TypeValue type,
+    Arcadia_SizeValue numberOfArgumentValues,
+    Arcadia_Value const* argumentValues
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  for (Arcadia_SizeValue i = 0; i < numberOfArgumentValues; ++i) {
+    Arcadia_ValueStack_pushValue(thread, &argumentValues[i]);
+  }
+  Arcadia_ValueStack_pushNatural8Value(thread, (Arcadia_Natural8Value)numberOfArgumentValues);
+  ARCADIA_CREATEOBJECT0(thread, type, oldValueStackSize);
+}
+
+static void
+createStringViaValueStack
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Value argumentValues[] = { Arcadia_Value_makeObjectReferenceValue(g_prototype) };
+  createViaValueStack(thread, _Arcadia_String_getType(thread), 1, argumentValues);
+}
+
+static void
+createString
+  (
+    Arcadia_Thread* thread
+  )
+{ Arcadia_String_create(thread, Arcadia_Value_makeObjectReferenceValue(g_prototype)); }
+
+static void
+createArrayListViaValueStack
+  (
+    Arcadia_Thread* thread
+  )
+{ createViaValueStack(thread, _Arcadia_ArrayList_getType(thread), 0, NULL); }
+
+static void
+createArrayList
+  (
+    Arcadia_Thread* thread
+  )
+{ Arcadia_ArrayList_create(thread); }
+
+static void
+createStackLevel3
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Value argumentValues[] = { Arcadia_Value_makeInteger32Value(1), Arcadia_Value_makeInteger32Value(2), Arcadia_Value_makeInteger32Value(3) };
+  createViaValueStack(thread, _StackLevel3_getType(thread), 3, argumentValues);
+}
+
+static void
+createNativeLevel3ViaValueStack
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Value argumentValues[] = { Arcadia_Value_makeInteger32Value(1), Arcadia_Value_makeInteger32Value(2), Arcadia_Value_makeInteger32Value(3) };
+  createViaValueStack(thread, _NativeLevel3_getType(thread), 3, argumentValues);
+}
+
+static void
+createNativeLevel3
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Value argumentValues[] = { Arcadia_Value_makeInteger32Value(1), Arcadia_Value_makeInteger32Value(2), Arcadia_Value_makeInteger32Value(3) };
+  Arcadia_Object_createNative(thread, _NativeLevel3_getType(thread), 3, argumentValues);
+}
+
+static void
+setUpPrototype
+  (
+    Arcadia_Thread* thread
+  )
+{
+  g_prototype = Arcadia_String_createFromCxxString(thread, "Hello, World!");
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_prototype);
+}
+
+static void
+tearDownPrototype
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Object_unlock(thread, (Arcadia_Object*)g_prototype);
+  g_prototype = NULL;
+}
+
+#define DefineRun(Name, Create) \
+  static void \
+  Name \
+    ( \
+      Arcadia_Thread* thread \
+    ) \
+  { \
+    for (Arcadia_SizeValue i = 0; i < NumberOfObjects; ++i) { \
+      Create(thread); \
+    } \
+  }
+
+DefineRun(runStringViaValueStack, createStringViaValueStack)
+DefineRun(runString, createString)
+DefineRun(runArrayListViaValueStack, createArrayListViaValueStack)
+DefineRun(runArrayList, createArrayList)
+DefineRun(runStackLevel3, createStackLevel3)
+DefineRun(runNativeLevel3ViaValueStack, createNativeLevel3ViaValueStack)
+DefineRun(runNativeLevel3, createNativeLevel3)
+
+#undef DefineRun
+
+// One operation is the creation of one object.
+// "value stack" denotes the value stack protocol (as used by interpreted callers), "native" the native construction path.
+// "value stack only" denotes a type without native constructors.
+static Arcadia_Benchmarks_Benchmark const g_benchmarks[] = {
+  { u8"Arcadia.String (value stack)", NumberOfObjects, &setUpPrototype, &runStringViaValueStack, &tearDownPrototype },
+  { u8"Arcadia.String (native)", NumberOfObjects, &setUpPrototype, &runString, &tearDownPrototype },
+  { u8"Arcadia.ArrayList (value stack)", NumberOfObjects, NULL, &runArrayListViaValueStack, NULL },
+  { u8"Arcadia.ArrayList (native)", NumberOfObjects, NULL, &runArrayList, NULL },
+  { u8"three-deep type (value stack only)", NumberOfObjects, NULL, &runStackLevel3, NULL },
+  { u8"three-deep type (value stack)", NumberOfObjects, NULL, &runNativeLevel3ViaValueStack, NULL },
+  { u8"three-deep type (native)", NumberOfObjects, NULL, &runNativeLevel3, NULL },
+};
+
+static Arcadia_Benchmarks_Benchmark const*
+getBenchmarks
+  (
+    Arcadia_SizeValue* numberOfBenchmarks
+  )
+{
+  *numberOfBenchmarks = sizeof(g_benchmarks) / sizeof(Arcadia_Benchmarks_Benchmark);
+  return g_benchmarks;
+}
+
+static Arcadia_Benchmarks_GetBenchmarks* const g_groups[] = {
+  &getBenchmarks,
+};
+
+// See Arcadia_Benchmarks_main for the command line arguments.
+int
+main
+  (
+    int argc,
+    char** argv
+  )
+{ return Arcadia_Benchmarks_main(argc, argv, g_groups, sizeof(g_groups) / sizeof(Arcadia_Benchmarks_GetBenchmarks*)); }
@@ -0,0 +1,144 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <stdio.h>
+
+#include "Arcadia/Collections/Include.h"
+#include "Arcadia/Benchmarks/Harness/Driver.h"
+
+// The number of keys in the map.
+#define NumberOfKeys (1024)
+
+// The number of times each key is looked up per repetition.
+#define NumberOfRounds (100)
+
+// The map.
+static Arcadia_Map* g_map = NULL;
+
+// The keys looked up.
+static Arcadia_List* g_keys = NULL;
+
+// Create the map and the list of keys and lock them.
+static void
+setUp
+  (
+    Arcadia_Thread* thread
+  )
+{
+  g_map = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_map);
+  g_keys = (Arcadia_List*)Arcadia_ArrayList_create(thread);
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_keys);
+}
+
+// String keys.
+// The keys looked up are equal to but not identical with the keys in the map.
+// Hence each successful probe computes a hash and performs an equality comparison.
+static void
+setUpStringKeys
+  (
+    Arcadia_Thread* thread
+  )
+{
+  setUp(thread);
+  for (Arcadia_SizeValue i = 0; i < NumberOfKeys; ++i) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "key%zu", (size_t)i);
+    Arcadia_String* k = Arcadia_String_createFromCxxString(thread, buffer);
+    Arcadia_String* l = Arcadia_String_createFromCxxString(thread, buffer);
+    Arcadia_Map_set(thread, g_map, Arcadia_Value_makeObjectReferenceValue(k), Arcadia_Value_makeSizeValue(i), NULL, NULL);
+    Arcadia_List_insertBackObjectReferenceValue(thread, g_keys, l);
+  }
+}
+
+// Object keys.
+// The keys are objects of a type which does not override equality and hashing.
+static void
+setUpObjectKeys
+  (
+    Arcadia_Thread* thread
+  )
+{
+  setUp(thread);
+  for (Arcadia_SizeValue i = 0; i < NumberOfKeys; ++i) {
+    Arcadia_Object* k = (Arcadia_Object*)Arcadia_ArrayList_create(thread);
+    Arcadia_Map_set(thread, g_map, Arcadia_Value_makeObjectReferenceValue(k), Arcadia_Value_makeSizeValue(i), NULL, NULL);
+    Arcadia_List_insertBackObjectReferenceValue(thread, g_keys, k);
+  }
+}
+
+// Look up all keys.
+static void
+run
+  (
+    Arcadia_Thread* thread
+  )
+{
+  for (Arcadia_SizeValue j = 0; j < NumberOfRounds; ++j) {
+    for (Arcadia_SizeValue i = 0; i < NumberOfKeys; ++i) {
+      Arcadia_Value k = Arcadia_List_getAt(thread, g_keys, i);
+      Arcadia_Value v = Arcadia_Map_get(thread, g_map, k);
+      if (!Arcadia_Value_isSizeValue(&v) || i != Arcadia_Value_getSizeValue(&v)) {
+        Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+        Arcadia_Thread_jump(thread);
+      }
+    }
+  }
+}
+
+static void
+tearDown
+  (
+    Arcadia_Thread* thread
+  )
+{
+  if (g_keys) {
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)g_keys);
+    g_keys = NULL;
+  }
+  if (g_map) {
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)g_map);
+    g_map = NULL;
+  }
+}
+
+// One operation is one lookup.
+static Arcadia_Benchmarks_Benchmark const g_benchmarks[] = {
+  { u8"HashMap.get (String keys)", NumberOfKeys * NumberOfRounds, &setUpStringKeys, &run, &tearDown },
+  { u8"HashMap.get (Object keys)", NumberOfKeys * NumberOfRounds, &setUpObjectKeys, &run, &tearDown },
+};
+
+static Arcadia_Benchmarks_Benchmark const*
+getBenchmarks
+  (
+    Arcadia_SizeValue* numberOfBenchmarks
+  )
+{
+  *numberOfBenchmarks = sizeof(g_benchmarks) / sizeof(Arcadia_Benchmarks_Benchmark);
+  return g_benchmarks;
+}
+
+static Arcadia_Benchmarks_GetBenchmarks* const g_groups[] = {
+  &getBenchmarks,
+};
+
+// See Arcadia_Benchmarks_main for the command line arguments.
+int
+main
+  (
+    int argc,
+    char** argv
+  )
+{ return Arcadia_Benchmarks_main(argc, argv, g_groups, sizeof(g_groups) / sizeof(Arcadia_Benchmarks_GetBenchmarks*)); }
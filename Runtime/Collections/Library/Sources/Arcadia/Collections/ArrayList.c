@@ -44,6 +44,15 @@ Arcadia_ArrayList_constructImpl
     Arcadia_ArrayList* self
   );
 
+static void
+Arcadia_ArrayList_constructNativeImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ArrayList* self,
+    Arcadia_SizeValue numberOfArgumentValues,
+    Arcadia_Value const* argumentValues
+  );
+
 static void
 Arcadia_ArrayList_initializeDispatchImpl
   (
@@ -131,6 +140,7 @@ Arcadia_ArrayList_removeAtImpl
 static const Arcadia_ObjectType_Operations _objectTypeOperations = {
   Arcadia_ObjectType_Operations_Initializer,
   .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_ArrayList_constructImpl,
+  .constructNative = (Arcadia_Object_ConstructNativeCallbackFunction*)&Arcadia_ArrayList_constructNativeImpl,
   .destruct = (Arcadia_Object_DestructCallbackFunction*)&Arcadia_ArrayList_destruct,
   .visit = (Arcadia_Object_VisitCallbackFunction*)&Arcadia_ArrayList_visit,
   .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_ArrayList_initializeDispatchImpl,
@@ -203,14 +213,23 @@ Arcadia_ArrayList_constructImpl
     Arcadia_Thread* thread,
     Arcadia_ArrayList* self
   )
+{
+  Arcadia_Object_constructNativeFromValueStack(thread, (Arcadia_Object*)self, _Arcadia_ArrayList_getType(thread));
+}
+
+static void
+Arcadia_ArrayList_constructNativeImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ArrayList* self,
+    Arcadia_SizeValue numberOfArgumentValues,
+    Arcadia_Value const* argumentValues
+  )
 {
   Arcadia_ArrayList_ensureInitialized(thread);
-  Arcadia_EnterConstructor(Arcadia_ArrayList);
-  {
-    Arcadia_ValueStack_pushNatural8Value(thread, 0);
-    Arcadia_superTypeConstructor(thread, _type, self);
-  }
-  if (0 != _numberOfArguments) {
+  Arcadia_EnterNativeConstructor(Arcadia_ArrayList);
+  Arcadia_superTypeNativeConstructor(thread, _type, self, 0, NULL);
+  if (0 != numberOfArgumentValues) {
     Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
     Arcadia_Thread_jump(thread);
   }
@@ -222,7 +241,7 @@ Arcadia_ArrayList_constructImpl
   for (Arcadia_SizeValue i = 0, n = self->capacity; i < n; ++i) {
     Arcadia_Value_setVoidValue(self->elements + i, Arcadia_VoidValue_Void);
   }
-  Arcadia_LeaveConstructor(Arcadia_ArrayList);
+  Arcadia_LeaveNativeConstructor(Arcadia_ArrayList);
 }
 
 static void
@@ -392,8 +411,4 @@ Arcadia_ArrayList_create
   (
     Arcadia_Thread* thread
   )
-{
-  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
-  Arcadia_ValueStack_pushNatural8Value(thread, 0);
-  ARCADIA_CREATEOBJECT(Arcadia_ArrayList);
-}
+{ return Arcadia_Object_createNative(thread, _Arcadia_ArrayList_getType(thread), 0, NULL); }
@@ -25,6 +25,15 @@ Arcadia_Collection_constructImpl
     Arcadia_Collection* self
   );
 
+static void
+Arcadia_Collection_constructNativeImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Collection* self,
+    Arcadia_SizeValue numberOfArgumentValues,
+    Arcadia_Value const* argumentValues
+  );
+
 static void
 Arcadia_Collection_initializeDispatchImpl
   (
@@ -42,6 +51,7 @@ Arcadia_Collection_isEmptyImpl
 static const Arcadia_ObjectType_Operations _objectTypeOperations = {
   Arcadia_ObjectType_Operations_Initializer,
   .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_Collection_constructImpl,
+  .constructNative = (Arcadia_Object_ConstructNativeCallbackFunction*)&Arcadia_Collection_constructNativeImpl,
   .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_Collection_initializeDispatchImpl,
 };
 
@@ -61,16 +71,25 @@ Arcadia_Collection_constructImpl
     Arcadia_Collection* self
   )
 {
-  Arcadia_EnterConstructor(Arcadia_Collection);
-  {
-    Arcadia_ValueStack_pushNatural8Value(thread, 0);
-    Arcadia_superTypeConstructor(thread, _type, self);
-  }
-  if (0 != _numberOfArguments) {
+  Arcadia_Object_constructNativeFromValueStack(thread, (Arcadia_Object*)self, _Arcadia_Collection_getType(thread));
+}
+
+static void
+Arcadia_Collection_constructNativeImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Collection* self,
+    Arcadia_SizeValue numberOfArgumentValues,
+    Arcadia_Value const* argumentValues
+  )
+{
+  Arcadia_EnterNativeConstructor(Arcadia_Collection);
+  Arcadia_superTypeNativeConstructor(thread, _type, self, 0, NULL);
+  if (0 != numberOfArgumentValues) {
     Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
     Arcadia_Thread_jump(thread);
   }
-  Arcadia_LeaveConstructor(Arcadia_Collection);
+  Arcadia_LeaveNativeConstructor(Arcadia_Collection);
 }
 
 static void
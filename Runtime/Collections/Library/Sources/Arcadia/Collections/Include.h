@@ -30,6 +30,7 @@
 #include "Arcadia/Collections/HashSet.h"
 #include "Arcadia/Collections/ArrayStack.h"
 #include "Arcadia/Collections/ImmutableList.h"
+#include "Arcadia/Collections/TypedArrayLists.h"
 
 #undef ARCADIA_COLLECTIONS_EXPORT
 #pragma pop_macro("ARCADIA_COLLECTIONS_EXPORT")
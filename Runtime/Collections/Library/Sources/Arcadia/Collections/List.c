@@ -25,6 +25,15 @@ Arcadia_List_constructImpl
     Arcadia_List* self
   );
 
+static void
+Arcadia_List_constructNativeImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_List* self,
+    Arcadia_SizeValue numberOfArgumentValues,
+    Arcadia_Value const* argumentValues
+  );
+
 static void
 Arcadia_List_initializeDispatchImpl
   (
@@ -35,6 +44,7 @@ Arcadia_List_initializeDispatchImpl
 static const Arcadia_ObjectType_Operations _objectTypeOperations = {
   Arcadia_ObjectType_Operations_Initializer,
   .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_List_constructImpl,
+  .constructNative = (Arcadia_Object_ConstructNativeCallbackFunction*)&Arcadia_List_constructNativeImpl,
   .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_List_initializeDispatchImpl,
 };
 
@@ -54,16 +64,25 @@ Arcadia_List_constructImpl
     Arcadia_List* self
   )
 {
-  Arcadia_EnterConstructor(Arcadia_List);
-  {
-    Arcadia_ValueStack_pushNatural8Value(thread, 0);
-    Arcadia_superTypeConstructor(thread, _type, self);
-  }
-  if (0 != _numberOfArguments) {
+  Arcadia_Object_constructNativeFromValueStack(thread, (Arcadia_Object*)self, _Arcadia_List_getType(thread));
+}
+
+static void
+Arcadia_List_constructNativeImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_List* self,
+    Arcadia_SizeValue numberOfArgumentValues,
+    Arcadia_Value const* argumentValues
+  )
+{
+  Arcadia_EnterNativeConstructor(Arcadia_List);
+  Arcadia_superTypeNativeConstructor(thread, _type, self, 0, NULL);
+  if (0 != numberOfArgumentValues) {
     Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
     Arcadia_Thread_jump(thread);
   }
-  Arcadia_LeaveConstructor(Arcadia_List);
+  Arcadia_LeaveNativeConstructor(Arcadia_List);
 }
 
 static void
@@ -0,0 +1,415 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#define ARCADIA_COLLECTIONS_MODULE (1)
+#include "Arcadia/Collections/TypedArrayLists.h"
+
+#include "Arcadia/Collections/Include.h"
+
+static const Arcadia_SizeValue g_minimumCapacity = 8;
+
+// Get the maximum capacity of a list with elements of the specified size.
+static inline Arcadia_SizeValue
+getMaximumCapacity
+  (
+    Arcadia_SizeValue elementSize
+  )
+{
+  Arcadia_SizeValue maximumCapacity = SIZE_MAX / elementSize;
+  if (maximumCapacity > Arcadia_Integer32Value_Maximum) {
+    maximumCapacity = Arcadia_Integer32Value_Maximum;
+  }
+  return maximumCapacity;
+}
+
+#define Define(Suffix) \
+  static void \
+  Arcadia_##Suffix##ArrayList_constructImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self \
+    ); \
+  \
+  static void \
+  Arcadia_##Suffix##ArrayList_constructNativeImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self, \
+      Arcadia_SizeValue numberOfArgumentValues, \
+      Arcadia_Value const* argumentValues \
+    ); \
+  \
+  static void \
+  Arcadia_##Suffix##ArrayList_initializeDispatchImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayListDispatch* self \
+    ); \
+  \
+  static void \
+  Arcadia_##Suffix##ArrayList_destruct \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self \
+    ); \
+  \
+  static void \
+  Arcadia_##Suffix##ArrayList_clearImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self \
+    ); \
+  \
+  static Arcadia_Value \
+  Arcadia_##Suffix##ArrayList_getAtImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self, \
+      Arcadia_SizeValue index \
+    ); \
+  \
+  static Arcadia_SizeValue \
+  Arcadia_##Suffix##ArrayList_getSizeImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self \
+    ); \
+  \
+  static Arcadia_BooleanValue \
+  Arcadia_##Suffix##ArrayList_isImmutableImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self \
+    ); \
+  \
+  static void \
+  Arcadia_##Suffix##ArrayList_insertAtImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self, \
+      Arcadia_SizeValue index, \
+      Arcadia_Value value \
+    ); \
+  \
+  static void \
+  Arcadia_##Suffix##ArrayList_insertBackImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self, \
+      Arcadia_Value value \
+    ); \
+  \
+  static void \
+  Arcadia_##Suffix##ArrayList_insertFrontImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self, \
+      Arcadia_Value value \
+    ); \
+  \
+  static void \
+  Arcadia_##Suffix##ArrayList_removeAtImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self, \
+      Arcadia_SizeValue index, \
+      Arcadia_SizeValue count \
+    ); \
+  \
+  static const Arcadia_ObjectType_Operations _Arcadia_##Suffix##ArrayList_objectTypeOperations = { \
+    Arcadia_ObjectType_Operations_Initializer, \
+    .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_##Suffix##ArrayList_constructImpl, \
+    .constructNative = (Arcadia_Object_ConstructNativeCallbackFunction*)&Arcadia_##Suffix##ArrayList_constructNativeImpl, \
+    .destruct = (Arcadia_Object_DestructCallbackFunction*)&Arcadia_##Suffix##ArrayList_destruct, \
+    .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_##Suffix##ArrayList_initializeDispatchImpl, \
+  }; \
+  \
+  static const Arcadia_Type_Operations _Arcadia_##Suffix##ArrayList_typeOperations = { \
+    Arcadia_Type_Operations_Initializer, \
+    .objectTypeOperations = &_Arcadia_##Suffix##ArrayList_objectTypeOperations, \
+  }; \
+  \
+  Arcadia_defineObjectType(u8"Arcadia." #Suffix "ArrayList", Arcadia_##Suffix##ArrayList, \
+                           u8"Arcadia.List", Arcadia_List, \
+                           &_Arcadia_##Suffix##ArrayList_typeOperations); \
+  \
+  static void \
+  Arcadia_##Suffix##ArrayList_constructImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self \
+    ) \
+  { \
+    Arcadia_Object_constructNativeFromValueStack(thread, (Arcadia_Object*)self, _Arcadia_##Suffix##ArrayList_getType(thread)); \
+  } \
+  \
+  static void \
+  Arcadia_##Suffix##ArrayList_constructNativeImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self, \
+      Arcadia_SizeValue numberOfArgumentValues, \
+      Arcadia_Value const* argumentValues \
+    ) \
+  { \
+    Arcadia_EnterNativeConstructor(Arcadia_##Suffix##ArrayList); \
+    Arcadia_superTypeNativeConstructor(thread, _type, self, 0, NULL); \
+    if (0 != numberOfArgumentValues) { \
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid); \
+      Arcadia_Thread_jump(thread); \
+    } \
+    self->elements = NULL; \
+    self->size = 0; \
+    self->capacity = g_minimumCapacity; \
+    self->elements = Arcadia_Memory_allocateUnmanaged(thread, sizeof(Arcadia_##Suffix##Value) * self->capacity); \
+    Arcadia_LeaveNativeConstructor(Arcadia_##Suffix##ArrayList); \
+  } \
+  \
+  static void \
+  Arcadia_##Suffix##ArrayList_initializeDispatchImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayListDispatch* self \
+    ) \
+  { \
+    ((Arcadia_CollectionDispatch*)self)->clear = (void (*)(Arcadia_Thread*, Arcadia_Collection*)) & Arcadia_##Suffix##ArrayList_clearImpl; \
+    ((Arcadia_CollectionDispatch*)self)->getSize = (Arcadia_SizeValue(*)(Arcadia_Thread*, Arcadia_Collection*)) & Arcadia_##Suffix##ArrayList_getSizeImpl; \
+    ((Arcadia_CollectionDispatch*)self)->isImmutable = (Arcadia_BooleanValue(*)(Arcadia_Thread*, Arcadia_Collection*)) & Arcadia_##Suffix##ArrayList_isImmutableImpl; \
+    ((Arcadia_ListDispatch*)self)->getAt = (Arcadia_Value(*)(Arcadia_Thread*, Arcadia_List*, Arcadia_SizeValue)) & Arcadia_##Suffix##ArrayList_getAtImpl; \
+    ((Arcadia_ListDispatch*)self)->insertAt = (void (*)(Arcadia_Thread*, Arcadia_List*, Arcadia_SizeValue, Arcadia_Value)) & Arcadia_##Suffix##ArrayList_insertAtImpl; \
+    ((Arcadia_ListDispatch*)self)->insertBack = (void (*)(Arcadia_Thread*, Arcadia_List*, Arcadia_Value)) & Arcadia_##Suffix##ArrayList_insertBackImpl; \
+    ((Arcadia_ListDispatch*)self)->insertFront = (void (*)(Arcadia_Thread*, Arcadia_List*, Arcadia_Value)) & Arcadia_##Suffix##ArrayList_insertFrontImpl; \
+    ((Arcadia_ListDispatch*)self)->removeAt = (void (*)(Arcadia_Thread*, Arcadia_List*, Arcadia_SizeValue, Arcadia_SizeValue)) & Arcadia_##Suffix##ArrayList_removeAtImpl; \
+  } \
+  \
+  static void \
+  Arcadia_##Suffix##ArrayList_destruct \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self \
+    ) \
+  { \
+    if (self->elements) { \
+      Arcadia_Memory_deallocateUnmanaged(thread, self->elements); \
+      self->elements = NULL; \
+    } \
+  } \
+  \
+  static void \
+  Arcadia_##Suffix##ArrayList_clearImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self \
+    ) \
+  { self->size = 0; } \
+  \
+  static Arcadia_Value \
+  Arcadia_##Suffix##ArrayList_getAtImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self, \
+      Arcadia_SizeValue index \
+    ) \
+  { return Arcadia_Value_make##Suffix##Value(Arcadia_##Suffix##ArrayList_getAt(thread, self, index)); } \
+  \
+  static Arcadia_SizeValue \
+  Arcadia_##Suffix##ArrayList_getSizeImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self \
+    ) \
+  { return self->size; } \
+  \
+  static Arcadia_BooleanValue \
+  Arcadia_##Suffix##ArrayList_isImmutableImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self \
+    ) \
+  { return Arcadia_BooleanValue_False; } \
+  \
+  static void \
+  Arcadia_##Suffix##ArrayList_insertAtImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self, \
+      Arcadia_SizeValue index, \
+      Arcadia_Value value \
+    ) \
+  { \
+    if (index > self->size) { \
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid); \
+      Arcadia_Thread_jump(thread); \
+    } \
+    if (!Arcadia_Value_is##Suffix##Value(&value)) { \
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentTypeInvalid); \
+      Arcadia_Thread_jump(thread); \
+    } \
+    if (self->capacity == self->size) { \
+      Arcadia_##Suffix##ArrayList_ensureFreeCapacity(thread, self, Arcadia_SizeValue_Literal(1)); \
+    } \
+    if (index < self->size) { \
+      Arcadia_Memory_copy(thread, self->elements + index + 1, \
+                          self->elements + index + 0, sizeof(Arcadia_##Suffix##Value) * (self->size - index)); \
+    } \
+    self->elements[index] = Arcadia_Value_get##Suffix##Value(&value); \
+    self->size++; \
+  } \
+  \
+  static void \
+  Arcadia_##Suffix##ArrayList_insertBackImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self, \
+      Arcadia_Value value \
+    ) \
+  { \
+    Arcadia_##Suffix##ArrayList_insertAtImpl(thread, self, self->size, value); \
+  } \
+  \
+  static void \
+  Arcadia_##Suffix##ArrayList_insertFrontImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self, \
+      Arcadia_Value value \
+    ) \
+  { \
+    Arcadia_##Suffix##ArrayList_insertAtImpl(thread, self, Arcadia_SizeValue_Literal(0), value); \
+  } \
+  \
+  static void \
+  Arcadia_##Suffix##ArrayList_removeAtImpl \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self, \
+      Arcadia_SizeValue index, \
+      Arcadia_SizeValue count \
+    ) \
+  { \
+    if ((Arcadia_SizeValue_Maximum - count) < index) { \
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid); \
+      Arcadia_Thread_jump(thread); \
+    } \
+    if ((index + count) > self->size) { \
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid); \
+      Arcadia_Thread_jump(thread); \
+    } \
+    Arcadia_SizeValue tailLength = (self->size - index) - count; \
+    if (tailLength) { \
+      Arcadia_SizeValue tailStart = index + count; \
+      Arcadia_Memory_copy(thread, self->elements + index, \
+                          self->elements + tailStart, tailLength * sizeof(Arcadia_##Suffix##Value)); \
+    } \
+    self->size -= count; \
+  } \
+  \
+  Arcadia_##Suffix##ArrayList* \
+  Arcadia_##Suffix##ArrayList_create \
+    ( \
+      Arcadia_Thread* thread \
+    ) \
+  { return Arcadia_Object_createNative(thread, _Arcadia_##Suffix##ArrayList_getType(thread), 0, NULL); } \
+  \
+  void \
+  Arcadia_##Suffix##ArrayList_ensureFreeCapacity \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self, \
+      Arcadia_SizeValue requiredFreeCapacity \
+    ) \
+  { \
+    Arcadia_SizeValue maximumCapacity = getMaximumCapacity(sizeof(Arcadia_##Suffix##Value)); \
+    if (requiredFreeCapacity <= self->capacity - self->size) { \
+      return; \
+    } \
+    if (requiredFreeCapacity > maximumCapacity - self->size) { \
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_AllocationFailed); \
+      Arcadia_Thread_jump(thread); \
+    } \
+    Arcadia_SizeValue requiredCapacity = self->size + requiredFreeCapacity; \
+    Arcadia_SizeValue newCapacity = self->capacity; \
+    while (newCapacity < requiredCapacity) { \
+      if (newCapacity > maximumCapacity / 2) { \
+        /* Cannot double the capacity. Saturate the capacity. */ \
+        newCapacity = maximumCapacity; \
+      } else { \
+        newCapacity = newCapacity * 2; \
+      } \
+    } \
+    Arcadia_Memory_reallocateUnmanaged(thread, (void**)&self->elements, sizeof(Arcadia_##Suffix##Value) * newCapacity); \
+    self->capacity = newCapacity; \
+  } \
+  \
+  void \
+  Arcadia_##Suffix##ArrayList_insertBackMany \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self, \
+      Arcadia_##Suffix##Value const* values, \
+      Arcadia_SizeValue numberOfValues \
+    ) \
+  { \
+    if (!numberOfValues) { \
+      return; \
+    } \
+    if (!values) { \
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid); \
+      Arcadia_Thread_jump(thread); \
+    } \
+    /* The values may be elements of this list which are moved if the list grows. */ \
+    uintptr_t p = (uintptr_t)values, q = (uintptr_t)self->elements; \
+    if (q <= p && p < q + self->size * sizeof(Arcadia_##Suffix##Value)) { \
+      Arcadia_SizeValue offset = (p - q) / sizeof(Arcadia_##Suffix##Value); \
+      Arcadia_##Suffix##ArrayList_ensureFreeCapacity(thread, self, numberOfValues); \
+      values = self->elements + offset; \
+    } else { \
+      Arcadia_##Suffix##ArrayList_ensureFreeCapacity(thread, self, numberOfValues); \
+    } \
+    Arcadia_Memory_copy(thread, self->elements + self->size, values, sizeof(Arcadia_##Suffix##Value) * numberOfValues); \
+    self->size += numberOfValues; \
+  } \
+  \
+  void \
+  Arcadia_##Suffix##ArrayList_copyTo \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self, \
+      Arcadia_SizeValue index, \
+      Arcadia_SizeValue numberOfValues, \
+      Arcadia_##Suffix##Value* target \
+    ) \
+  { \
+    if ((Arcadia_SizeValue_Maximum - numberOfValues) < index) { \
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid); \
+      Arcadia_Thread_jump(thread); \
+    } \
+    if ((index + numberOfValues) > self->size) { \
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid); \
+      Arcadia_Thread_jump(thread); \
+    } \
+    if (!numberOfValues) { \
+      return; \
+    } \
+    if (!target) { \
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid); \
+      Arcadia_Thread_jump(thread); \
+    } \
+    Arcadia_Memory_copy(thread, target, self->elements + index, sizeof(Arcadia_##Suffix##Value) * numberOfValues); \
+  }
+
+#include "Arcadia/Collections/TypedArrayLists.i"
+
+#undef Define
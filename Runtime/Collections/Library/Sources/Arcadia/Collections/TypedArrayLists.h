@@ -0,0 +1,158 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_COLLECTIONS_TYPEDARRAYLISTS_H_INCLUDED)
+#define ARCADIA_COLLECTIONS_TYPEDARRAYLISTS_H_INCLUDED
+
+#if !defined(ARCADIA_COLLECTIONS_MODULE)
+  #error("do not include directly, include `Arcadia/Collections/Include.h` instead")
+#endif
+
+#include "Arcadia/Collections/List.h"
+
+// For each numeric type <Suffix> in "Arcadia/Collections/TypedArrayLists.i" an "Arcadia.<Suffix>ArrayList" type is defined.
+// Unlike "Arcadia.ArrayList" which stores "Arcadia.Value" values, such a list stores its elements unboxed in a contiguous array.
+// Consequently, the list has no visit callback and the garbage collector never inspects the elements.
+//
+// The list is an "Arcadia.List":
+// Its "Arcadia.List" functions box and unbox the elements and raise "Arcadia.Status.ArgumentTypeInvalid" if a value of another type is inserted.
+//
+// Arcadia_<Suffix>ArrayList_getElements returns a pointer to the elements.
+// That pointer is invalidated by any operation which changes the size of the list.
+//
+// Arcadia_<Suffix>ArrayList_insertBackMany appends the specified number of elements from the specified array.
+// Arcadia_<Suffix>ArrayList_copyTo copies the specified number of elements starting at the specified index to the specified array.
+#define Define(Suffix) \
+  Arcadia_declareObjectType(u8"Arcadia." #Suffix "ArrayList", Arcadia_##Suffix##ArrayList, \
+                            u8"Arcadia.List"); \
+  \
+  struct Arcadia_##Suffix##ArrayListDispatch { \
+    Arcadia_ListDispatch _parent; \
+  }; \
+  \
+  struct Arcadia_##Suffix##ArrayList { \
+    Arcadia_List _parent; \
+    Arcadia_##Suffix##Value* elements; \
+    Arcadia_SizeValue size; \
+    Arcadia_SizeValue capacity; \
+  }; \
+  \
+  Arcadia_##Suffix##ArrayList* \
+  Arcadia_##Suffix##ArrayList_create \
+    ( \
+      Arcadia_Thread* thread \
+    ); \
+  \
+  void \
+  Arcadia_##Suffix##ArrayList_ensureFreeCapacity \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self, \
+      Arcadia_SizeValue requiredFreeCapacity \
+    ); \
+  \
+  void \
+  Arcadia_##Suffix##ArrayList_insertBackMany \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self, \
+      Arcadia_##Suffix##Value const* values, \
+      Arcadia_SizeValue numberOfValues \
+    ); \
+  \
+  void \
+  Arcadia_##Suffix##ArrayList_copyTo \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self, \
+      Arcadia_SizeValue index, \
+      Arcadia_SizeValue numberOfValues, \
+      Arcadia_##Suffix##Value* target \
+    ); \
+  \
+  static inline Arcadia_##Suffix##Value* \
+  Arcadia_##Suffix##ArrayList_getElements \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self \
+    ) \
+  { return self->elements; } \
+  \
+  static inline Arcadia_SizeValue \
+  Arcadia_##Suffix##ArrayList_getSize \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self \
+    ) \
+  { return self->size; } \
+  \
+  static inline void \
+  Arcadia_##Suffix##ArrayList_clear \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self \
+    ) \
+  { self->size = 0; } \
+  \
+  static inline Arcadia_##Suffix##Value \
+  Arcadia_##Suffix##ArrayList_getAt \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self, \
+      Arcadia_SizeValue index \
+    ) \
+  { \
+    if (index >= self->size) { \
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_OperationInvalid); \
+      Arcadia_Thread_jump(thread); \
+    } \
+    return self->elements[index]; \
+  } \
+  \
+  static inline void \
+  Arcadia_##Suffix##ArrayList_setAt \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self, \
+      Arcadia_SizeValue index, \
+      Arcadia_##Suffix##Value value \
+    ) \
+  { \
+    if (index >= self->size) { \
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_OperationInvalid); \
+      Arcadia_Thread_jump(thread); \
+    } \
+    self->elements[index] = value; \
+  } \
+  \
+  static inline void \
+  Arcadia_##Suffix##ArrayList_insertBack \
+    ( \
+      Arcadia_Thread* thread, \
+      Arcadia_##Suffix##ArrayList* self, \
+      Arcadia_##Suffix##Value value \
+    ) \
+  { \
+    if (self->capacity == self->size) { \
+      Arcadia_##Suffix##ArrayList_ensureFreeCapacity(thread, self, Arcadia_SizeValue_Literal(1)); \
+    } \
+    self->elements[self->size++] = value; \
+  }
+
+#include "Arcadia/Collections/TypedArrayLists.i"
+
+#undef Define
+
+#endif // ARCADIA_COLLECTIONS_TYPEDARRAYLISTS_H_INCLUDED
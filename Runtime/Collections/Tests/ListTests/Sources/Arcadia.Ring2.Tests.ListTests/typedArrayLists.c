@@ -0,0 +1,141 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia.Ring2.Tests.ListTests/typedArrayLists.h"
+
+// Append [0,100). Assert the elements are stored contiguously.
+// Overwrite the elements. Clear the list.
+static void
+insertBackTest
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Real32ArrayList* l = Arcadia_Real32ArrayList_create(thread);
+  for (Arcadia_SizeValue i = 0; i < 100; ++i) {
+    Arcadia_Real32ArrayList_insertBack(thread, l, (Arcadia_Real32Value)i);
+    Arcadia_Tests_assertTrue(thread, i + 1 == Arcadia_Real32ArrayList_getSize(thread, l));
+  }
+  Arcadia_Real32Value* elements = Arcadia_Real32ArrayList_getElements(thread, l);
+  for (Arcadia_SizeValue i = 0; i < 100; ++i) {
+    Arcadia_Tests_assertTrue(thread, (Arcadia_Real32Value)i == elements[i]);
+    Arcadia_Tests_assertTrue(thread, (Arcadia_Real32Value)i == Arcadia_Real32ArrayList_getAt(thread, l, i));
+  }
+  for (Arcadia_SizeValue i = 0; i < 100; ++i) {
+    Arcadia_Real32ArrayList_setAt(thread, l, i, -(Arcadia_Real32Value)i);
+  }
+  for (Arcadia_SizeValue i = 0; i < 100; ++i) {
+    Arcadia_Tests_assertTrue(thread, -(Arcadia_Real32Value)i == Arcadia_Real32ArrayList_getAt(thread, l, i));
+  }
+  Arcadia_Real32ArrayList_clear(thread, l);
+  Arcadia_Tests_assertTrue(thread, 0 == Arcadia_Real32ArrayList_getSize(thread, l));
+  Arcadia_Tests_assertTrue(thread, Arcadia_Collection_isEmpty(thread, (Arcadia_Collection*)l));
+}
+
+// Append an array. Append the list to itself. Copy a range of the list to an array.
+static void
+insertBackManyTest
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static const Arcadia_Natural16Value values[] = { 1, 2, 3, 4, 5, 6, 7 };
+  Arcadia_Natural16ArrayList* l = Arcadia_Natural16ArrayList_create(thread);
+  Arcadia_Natural16ArrayList_insertBackMany(thread, l, values, 7);
+  Arcadia_Natural16ArrayList_insertBackMany(thread, l, values, 0);
+  Arcadia_Tests_assertTrue(thread, 7 == Arcadia_Natural16ArrayList_getSize(thread, l));
+  // The list grows while its own elements are appended.
+  Arcadia_Natural16ArrayList_insertBackMany(thread, l, Arcadia_Natural16ArrayList_getElements(thread, l), 7);
+  Arcadia_Tests_assertTrue(thread, 14 == Arcadia_Natural16ArrayList_getSize(thread, l));
+  for (Arcadia_SizeValue i = 0; i < 14; ++i) {
+    Arcadia_Tests_assertTrue(thread, values[i % 7] == Arcadia_Natural16ArrayList_getAt(thread, l, i));
+  }
+  Arcadia_Natural16Value target[3] = { 0, 0, 0 };
+  Arcadia_Natural16ArrayList_copyTo(thread, l, 5, 3, target);
+  Arcadia_Tests_assertTrue(thread, 6 == target[0] && 7 == target[1] && 1 == target[2]);
+
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_Natural16ArrayList_copyTo(thread, l, 12, 3, target);
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+    Arcadia_Thread_jump(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_Status_ArgumentValueInvalid == Arcadia_Thread_getStatus(thread));
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+}
+
+// The "Arcadia.List" functions box and unbox the elements and reject values of other types.
+static void
+listTest
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_List* l = (Arcadia_List*)Arcadia_Integer32ArrayList_create(thread);
+  Arcadia_List_insertBackInteger32Value(thread, l, 2);
+  Arcadia_List_insertBackInteger32Value(thread, l, 3);
+  Arcadia_List_insertFrontInteger32Value(thread, l, 1);
+  Arcadia_Tests_assertTrue(thread, 3 == Arcadia_Collection_getSize(thread, (Arcadia_Collection*)l));
+  for (Arcadia_Integer32Value i = 0; i < 3; ++i) {
+    Arcadia_Tests_assertTrue(thread, i + 1 == Arcadia_List_getInteger32ValueAt(thread, l, i));
+  }
+  Arcadia_List_removeAt(thread, l, 0, 1);
+  Arcadia_Tests_assertTrue(thread, 2 == Arcadia_Integer32ArrayList_getAt(thread, (Arcadia_Integer32ArrayList*)l, 0));
+  Arcadia_Tests_assertTrue(thread, 3 == Arcadia_Integer32ArrayList_getAt(thread, (Arcadia_Integer32ArrayList*)l, 1));
+
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_List_insertBack(thread, l, Arcadia_Value_makeReal32Value(4.f));
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+    Arcadia_Thread_jump(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_Status_ArgumentTypeInvalid == Arcadia_Thread_getStatus(thread));
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+  Arcadia_Tests_assertTrue(thread, 2 == Arcadia_Collection_getSize(thread, (Arcadia_Collection*)l));
+}
+
+// The elements survive a garbage collection.
+static void
+gcTest
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Real64ArrayList* l = Arcadia_Real64ArrayList_create(thread);
+  Arcadia_Object_lock(thread, (Arcadia_Object*)l);
+  for (Arcadia_SizeValue i = 0; i < 1024; ++i) {
+    Arcadia_Real64ArrayList_insertBack(thread, l, (Arcadia_Real64Value)i / 2.);
+  }
+  Arcadia_Process_runARMS(Arcadia_Thread_getProcess(thread), false);
+  Arcadia_Object_unlock(thread, (Arcadia_Object*)l);
+  for (Arcadia_SizeValue i = 0; i < 1024; ++i) {
+    Arcadia_Tests_assertTrue(thread, (Arcadia_Real64Value)i / 2. == Arcadia_Real64ArrayList_getAt(thread, l, i));
+  }
+}
+
+void Arcadia_Collections_Tests_ListTests_typedArrayLists(Arcadia_Thread* thread) {
+  insertBackTest(thread);
+  insertBackManyTest(thread);
+  listTest(thread);
+  gcTest(thread);
+}
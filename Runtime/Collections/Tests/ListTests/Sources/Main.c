@@ -17,6 +17,7 @@
 #include <string.h>
 
 #include "Arcadia.Ring2.Tests.ListTests/removeAt.h"
+#include "Arcadia.Ring2.Tests.ListTests/typedArrayLists.h"
 #include "Arcadia/Collections/Include.h"
 
 // We use integers for testing.
@@ -57,5 +58,8 @@ main
   if (!Arcadia_Tests_safeExecute(&Arcadia_Collections_Tests_ListTests_removeAt)) {
     return EXIT_FAILURE;
   }
+  if (!Arcadia_Tests_safeExecute(&Arcadia_Collections_Tests_ListTests_typedArrayLists)) {
+    return EXIT_FAILURE;
+  }
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,205 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <stdio.h>
+
+#include "Arcadia/Ring2/Include.h"
+#include "Arcadia/FileSystem/Include.h"
+#include "Arcadia/Benchmarks/Harness/Driver.h"
+
+// The number of Bytes of the generated file.
+#define NumberOfBytes (16 * 1024 * 1024)
+
+// The path of the generated file or null if the file is the `--input` file.
+static Arcadia_FilePath* g_generatedPath = NULL;
+
+// The mapping of the file to scan.
+static Arcadia_FileMapping* g_fileMapping = NULL;
+
+// Prevent the compiler from removing the scans.
+static volatile Arcadia_SizeValue g_sink = 0;
+
+// Generate text which is mostly ASCII with a multi-Byte code point every few words.
+static void
+generate
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FilePath* path
+  )
+{
+  static const char* const words[] = {
+    u8"lorem ", u8"ipsum ", u8"dolor ", u8"sit ", u8"amet, ", u8"consectetur ", u8"adipiscing ", u8"elit.\n",
+    u8"π ", u8"– ", u8"\U0001F600 ",
+  };
+  static const Arcadia_SizeValue lengths[] = {
+    6, 6, 6, 4, 6, 12, 11, 6,
+    3, 4, 5,
+  };
+  Arcadia_ByteArrayBuilder* contents = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_Natural32Value seed = 5;
+  Arcadia_SizeValue numberOfBytes = 0;
+  while (numberOfBytes < NumberOfBytes) {
+    seed = seed * 1664525 + 1013904223;
+    Arcadia_SizeValue i = (seed >> 16) % 64;
+    i = i < 8 ? 8 + i % 3 : i % 8;
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, contents, words[i], lengths[i]);
+    numberOfBytes += lengths[i];
+  }
+  Arcadia_FileSystem_setFileContents(thread, Arcadia_FileSystem_getOrCreate(thread), path, contents);
+}
+
+static void setUp(Arcadia_Thread* thread);
+static void tearDown(Arcadia_Thread* thread);
+static void runBytes(Arcadia_Thread* thread);
+static void runSpans(Arcadia_Thread* thread);
+static void runCodePoints(Arcadia_Thread* thread);
+
+// One operation is one Byte of the file.
+// The number of operations is updated by setUp if the file is the `--input` file.
+static Arcadia_Benchmarks_Benchmark g_benchmarks[] = {
+  { u8"ByteReader (per Byte)", NumberOfBytes, &setUp, &runBytes, &tearDown },
+  { u8"ByteReader (span)", NumberOfBytes, &setUp, &runSpans, &tearDown },
+  { u8"UnicodeCodePointReader", NumberOfBytes, &setUp, &runCodePoints, &tearDown },
+};
+
+// Map the `--input` file or generate a file and map it.
+static void
+setUp
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_FileSystem* fileSystem = Arcadia_FileSystem_getOrCreate(thread);
+  Arcadia_FilePath* path = NULL;
+  if (Arcadia_Benchmarks_getInput()) {
+    path = Arcadia_FilePath_parseNative(thread, Arcadia_Benchmarks_getInput());
+  } else {
+    path = Arcadia_FilePath_parseGeneric(thread, Arcadia_String_createFromCxxString(thread, u8"ByteReaderBenchmark.txt"));
+    generate(thread, path);
+    g_generatedPath = path;
+    Arcadia_Object_lock(thread, (Arcadia_Object*)g_generatedPath);
+  }
+  g_fileMapping = Arcadia_FileSystem_mapFile(thread, fileSystem, path);
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_fileMapping);
+  Arcadia_SizeValue numberOfBytes = Arcadia_FileMapping_getNumberOfBytes(thread, g_fileMapping);
+  for (Arcadia_SizeValue i = 0; i < sizeof(g_benchmarks) / sizeof(Arcadia_Benchmarks_Benchmark); ++i) {
+    g_benchmarks[i].numberOfOperations = numberOfBytes ? numberOfBytes : 1;
+  }
+}
+
+static void
+tearDown
+  (
+    Arcadia_Thread* thread
+  )
+{
+  if (g_fileMapping) {
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)g_fileMapping);
+    g_fileMapping = NULL;
+  }
+  if (g_generatedPath) {
+    // Some platforms do not permit deleting a mapped file: destroy the file mapping first.
+    Arcadia_Process_runARMS(Arcadia_Thread_getProcess(thread), Arcadia_BooleanValue_False);
+    Arcadia_FileSystem_deleteRegularFile(thread, Arcadia_FileSystem_getOrCreate(thread), g_generatedPath);
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)g_generatedPath);
+    g_generatedPath = NULL;
+  }
+}
+
+// Scan the Bytes through hasValue/getValue/nextValue.
+static void
+runBytes
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_ByteReader* reader = (Arcadia_ByteReader*)Arcadia_FileMapping_ByteReader_create(thread, g_fileMapping);
+  Arcadia_SizeValue numberOfNewlines = 0;
+  while (Arcadia_ByteReader_hasValue(thread, reader)) {
+    numberOfNewlines += '\n' == Arcadia_ByteReader_getValue(thread, reader);
+    Arcadia_ByteReader_nextValue(thread, reader);
+  }
+  g_sink = numberOfNewlines;
+}
+
+// Scan the Bytes through getSpan/advance.
+static void
+runSpans
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_ByteReader* reader = (Arcadia_ByteReader*)Arcadia_FileMapping_ByteReader_create(thread, g_fileMapping);
+  Arcadia_SizeValue numberOfNewlines = 0;
+  while (Arcadia_BooleanValue_True) {
+    Arcadia_Natural8Value const* bytes;
+    Arcadia_SizeValue numberOfBytes;
+    Arcadia_ByteReader_getSpan(thread, reader, &bytes, &numberOfBytes);
+    if (!numberOfBytes) {
+      break;
+    }
+    for (Arcadia_SizeValue i = 0; i < numberOfBytes; ++i) {
+      numberOfNewlines += '\n' == bytes[i];
+    }
+    Arcadia_ByteReader_advance(thread, reader, numberOfBytes);
+  }
+  g_sink = numberOfNewlines;
+}
+
+// Scan the code points through the UTF-8 decoder.
+static void
+runCodePoints
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_ByteReader* source = (Arcadia_ByteReader*)Arcadia_FileMapping_ByteReader_create(thread, g_fileMapping);
+  Arcadia_UnicodeCodePointReader* reader = (Arcadia_UnicodeCodePointReader*)Arcadia_ByteReader_UnicodeCodePointReader_create(thread, source);
+  Arcadia_SizeValue numberOfNewlines = 0;
+  while (Arcadia_UnicodeCodePointReader_hasValue(thread, reader)) {
+    numberOfNewlines += '\n' == Arcadia_UnicodeCodePointReader_getValue(thread, reader);
+    Arcadia_UnicodeCodePointReader_nextValue(thread, reader);
+  }
+  if (Arcadia_UnicodeCodePointReader_hasError(thread, reader)) {
+    fprintf(stderr, "the file is not valid UTF-8\n");
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  g_sink = numberOfNewlines;
+}
+
+static Arcadia_Benchmarks_Benchmark const*
+getBenchmarks
+  (
+    Arcadia_SizeValue* numberOfBenchmarks
+  )
+{
+  *numberOfBenchmarks = sizeof(g_benchmarks) / sizeof(Arcadia_Benchmarks_Benchmark);
+  return g_benchmarks;
+}
+
+static Arcadia_Benchmarks_GetBenchmarks* const g_groups[] = {
+  &getBenchmarks,
+};
+
+// Usage: Arcadia.FileSystem.Benchmarks.ByteReaderBenchmark [--input=<path to a UTF-8 file>]
+// See Arcadia_Benchmarks_main for the other command line arguments.
+int
+main
+  (
+    int argc,
+    char** argv
+  )
+{ return Arcadia_Benchmarks_main(argc, argv, g_groups, sizeof(g_groups) / sizeof(Arcadia_Benchmarks_GetBenchmarks*)); }
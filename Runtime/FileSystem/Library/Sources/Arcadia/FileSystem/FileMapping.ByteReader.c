@@ -0,0 +1,238 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#define ARCADIA_FILESYSTEM_MODULE (1)
+#include "Arcadia/FileSystem/FileMapping.ByteReader.h"
+
+static void
+Arcadia_FileMapping_ByteReader_construct
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping_ByteReader* self
+  );
+
+static void
+Arcadia_FileMapping_ByteReader_initializeDispatch
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping_ByteReaderDispatch* self
+  );
+
+static void
+Arcadia_FileMapping_ByteReader_visit
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping_ByteReader* self
+  );
+
+static Arcadia_BooleanValue
+Arcadia_FileMapping_ByteReader_hasValueImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping_ByteReader* self
+  );
+
+static Arcadia_BooleanValue
+Arcadia_FileMapping_ByteReader_hasErrorImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping_ByteReader* self
+  );
+
+static Arcadia_Natural8Value
+Arcadia_FileMapping_ByteReader_getValueImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping_ByteReader* self
+  );
+
+static void
+Arcadia_FileMapping_ByteReader_nextValueImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping_ByteReader* self
+  );
+
+static void
+Arcadia_FileMapping_ByteReader_getSpanImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping_ByteReader* self,
+    Arcadia_Natural8Value const** bytes,
+    Arcadia_SizeValue* numberOfBytes
+  );
+
+static void
+Arcadia_FileMapping_ByteReader_advanceImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping_ByteReader* self,
+    Arcadia_SizeValue numberOfBytes
+  );
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_FileMapping_ByteReader_construct,
+  .visit = (Arcadia_Object_VisitCallbackFunction*)&Arcadia_FileMapping_ByteReader_visit,
+  .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_FileMapping_ByteReader_initializeDispatch,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.FileMapping.ByteReader", Arcadia_FileMapping_ByteReader,
+                         u8"Arcadia.ByteReader", Arcadia_ByteReader,
+                         &_typeOperations);
+
+static void
+Arcadia_FileMapping_ByteReader_construct
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping_ByteReader* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_FileMapping_ByteReader);
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  if (1 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->source = Arcadia_ValueStack_getObjectReferenceValueChecked(thread, 1, _Arcadia_FileMapping_getType(thread));
+  self->index = 0;
+  Arcadia_LeaveConstructor(Arcadia_FileMapping_ByteReader);
+}
+
+static void
+Arcadia_FileMapping_ByteReader_initializeDispatch
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping_ByteReaderDispatch* self
+  )
+{
+  ((Arcadia_ByteReaderDispatch*)self)->getValue = (Arcadia_Natural8Value(*)(Arcadia_Thread*, Arcadia_ByteReader*)) & Arcadia_FileMapping_ByteReader_getValueImpl;
+  ((Arcadia_ByteReaderDispatch*)self)->hasError = (Arcadia_BooleanValue(*)(Arcadia_Thread*, Arcadia_ByteReader*)) & Arcadia_FileMapping_ByteReader_hasErrorImpl;
+  ((Arcadia_ByteReaderDispatch*)self)->hasValue = (Arcadia_BooleanValue(*)(Arcadia_Thread*, Arcadia_ByteReader*)) & Arcadia_FileMapping_ByteReader_hasValueImpl;
+  ((Arcadia_ByteReaderDispatch*)self)->nextValue = (void(*)(Arcadia_Thread*, Arcadia_ByteReader*)) & Arcadia_FileMapping_ByteReader_nextValueImpl;
+  ((Arcadia_ByteReaderDispatch*)self)->getSpan = (void(*)(Arcadia_Thread*, Arcadia_ByteReader*, Arcadia_Natural8Value const**, Arcadia_SizeValue*)) & Arcadia_FileMapping_ByteReader_getSpanImpl;
+  ((Arcadia_ByteReaderDispatch*)self)->advance = (void(*)(Arcadia_Thread*, Arcadia_ByteReader*, Arcadia_SizeValue)) & Arcadia_FileMapping_ByteReader_advanceImpl;
+}
+
+static void
+Arcadia_FileMapping_ByteReader_visit
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping_ByteReader* self
+  )
+{
+  // The file mapping must outlive this reader as the Bytes are unmapped when it is destroyed.
+  if (self->source) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->source);
+  }
+}
+
+static Arcadia_BooleanValue
+Arcadia_FileMapping_ByteReader_hasValueImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping_ByteReader* self
+  )
+{ return self->index < self->source->numberOfBytes; }
+
+static Arcadia_BooleanValue
+Arcadia_FileMapping_ByteReader_hasErrorImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping_ByteReader* self
+  )
+{ return Arcadia_BooleanValue_False; }
+
+static Arcadia_Natural8Value
+Arcadia_FileMapping_ByteReader_getValueImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping_ByteReader* self
+  )
+{
+  if (self->index >= self->source->numberOfBytes) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_OperationInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  return self->source->bytes[self->index];
+}
+
+static void
+Arcadia_FileMapping_ByteReader_nextValueImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping_ByteReader* self
+  )
+{
+  if (self->index >= self->source->numberOfBytes) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_OperationInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->index++;
+}
+
+static void
+Arcadia_FileMapping_ByteReader_getSpanImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping_ByteReader* self,
+    Arcadia_Natural8Value const** bytes,
+    Arcadia_SizeValue* numberOfBytes
+  )
+{
+  if (self->index < self->source->numberOfBytes) {
+    *bytes = self->source->bytes + self->index;
+    *numberOfBytes = self->source->numberOfBytes - self->index;
+  } else {
+    *bytes = NULL;
+    *numberOfBytes = 0;
+  }
+}
+
+static void
+Arcadia_FileMapping_ByteReader_advanceImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping_ByteReader* self,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  if (numberOfBytes > self->source->numberOfBytes - self->index) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_OperationInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->index += numberOfBytes;
+}
+
+Arcadia_FileMapping_ByteReader*
+Arcadia_FileMapping_ByteReader_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping* source
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  Arcadia_ValueStack_pushObjectReferenceValue(thread, (Arcadia_Object*)source);
+  Arcadia_ValueStack_pushNatural8Value(thread, 1);
+  ARCADIA_CREATEOBJECT(Arcadia_FileMapping_ByteReader);
+}
@@ -0,0 +1,52 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_FILESYSTEM_FILEMAPPING_BYTEREADER_H_INCLUDED)
+#define ARCADIA_FILESYSTEM_FILEMAPPING_BYTEREADER_H_INCLUDED
+
+#if !defined(ARCADIA_FILESYSTEM_MODULE)
+  #error("do not include directly, include `Arcadia/FileSystem/Include.h` instead")
+#endif
+
+#include "Arcadia/FileSystem/FileMapping.h"
+
+/// @brief A Byte reader over the Bytes of a file mapping.
+/// Its span is the remainder of the mapped Bytes.
+/// @code
+/// class Arcadia.FileMapping.ByteReader extends Arcadia.ByteReader {
+///   construct(source:Arcadia.FileMapping)
+/// }
+/// @endcode
+Arcadia_declareObjectType(u8"Arcadia.FileMapping.ByteReader", Arcadia_FileMapping_ByteReader,
+                          u8"Arcadia.ByteReader");
+
+struct Arcadia_FileMapping_ByteReaderDispatch {
+  Arcadia_ByteReaderDispatch _parent;
+};
+
+struct Arcadia_FileMapping_ByteReader {
+  Arcadia_ByteReader _parent;
+  Arcadia_FileMapping* source;
+  Arcadia_SizeValue index;
+};
+
+Arcadia_FileMapping_ByteReader*
+Arcadia_FileMapping_ByteReader_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping* source
+  );
+
+#endif // ARCADIA_FILESYSTEM_FILEMAPPING_BYTEREADER_H_INCLUDED
@@ -0,0 +1,91 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#define ARCADIA_FILESYSTEM_MODULE (1)
+#include "Arcadia/FileSystem/FileMapping.h"
+
+static void
+Arcadia_FileMapping_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping* self
+  );
+
+static void
+Arcadia_FileMapping_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMappingDispatch* self
+  );
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_FileMapping_constructImpl,
+  .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_FileMapping_initializeDispatchImpl,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.FileMapping", Arcadia_FileMapping,
+                         u8"Arcadia.Object", Arcadia_Object,
+                         &_typeOperations);
+
+static void
+Arcadia_FileMapping_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_FileMapping);
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  if (0 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->bytes = NULL;
+  self->numberOfBytes = 0;
+  Arcadia_LeaveConstructor(Arcadia_FileMapping);
+}
+
+static void
+Arcadia_FileMapping_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMappingDispatch* self
+  )
+{/*Intentionally empty.*/}
+
+Arcadia_Natural8Value const*
+Arcadia_FileMapping_getBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping* self
+  )
+{ return self->bytes; }
+
+Arcadia_SizeValue
+Arcadia_FileMapping_getNumberOfBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping* self
+  )
+{ return self->numberOfBytes; }
@@ -0,0 +1,71 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_FILESYSTEM_FILEMAPPING_H_INCLUDED)
+#define ARCADIA_FILESYSTEM_FILEMAPPING_H_INCLUDED
+
+#if !defined(ARCADIA_FILESYSTEM_MODULE)
+  #error("do not include directly, include `Arcadia/FileSystem/Include.h` instead")
+#endif
+
+#include "Arcadia/Ring2/Implementation/Configure.h"
+#include "Arcadia/Ring1/Include.h"
+
+/// @brief A read-only view of the contents of a regular file mapped into the address space of this process.
+/// The Bytes remain valid until the file mapping is destroyed.
+/// The Bytes must not be modified.
+/// @code
+/// class FileMapping {
+///   constructor()
+/// }
+/// @endcode
+Arcadia_declareObjectType(u8"Arcadia.FileMapping", Arcadia_FileMapping,
+                          u8"Arcadia.Object");
+
+struct Arcadia_FileMappingDispatch {
+  Arcadia_ObjectDispatch _parent;
+};
+
+struct Arcadia_FileMapping {
+  Arcadia_Object _parent;
+  /// A pointer to the Bytes of the file or the null pointer if the file is empty.
+  Arcadia_Natural8Value const* bytes;
+  /// The number of Bytes of the file.
+  Arcadia_SizeValue numberOfBytes;
+};
+
+/// @brief Get a pointer to the Bytes of this file mapping.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this file mapping.
+/// @return A pointer to the Bytes. The null pointer if the number of Bytes is zero.
+Arcadia_Natural8Value const*
+Arcadia_FileMapping_getBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping* self
+  );
+
+/// @brief Get the number of Bytes of this file mapping.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this file mapping.
+/// @return The number of Bytes.
+Arcadia_SizeValue
+Arcadia_FileMapping_getNumberOfBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMapping* self
+  );
+
+#endif // ARCADIA_FILESYSTEM_FILEMAPPING_H_INCLUDED
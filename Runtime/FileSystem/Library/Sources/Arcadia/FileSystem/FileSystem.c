@@ -237,6 +237,15 @@ Arcadia_FileSystem_getSaveDirectory
   )
 { Arcadia_VirtualCallWithReturn(Arcadia_FileSystem, getSaveDirectory, self); }
 
+Arcadia_FileMapping*
+Arcadia_FileSystem_mapFile
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileSystem* self,
+    Arcadia_FilePath* path
+  )
+{ Arcadia_VirtualCallWithReturn(Arcadia_FileSystem, mapFile, self, path); }
+
 Arcadia_BooleanValue
 Arcadia_FileSystem_regularFileExists
   (
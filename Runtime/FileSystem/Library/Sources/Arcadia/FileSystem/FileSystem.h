@@ -22,6 +22,7 @@
 
 #include "Arcadia/FileSystem/DirectoryIterator.h"
 #include "Arcadia/FileSystem/FileHandle.h"
+#include "Arcadia/FileSystem/FileMapping.h"
 #include "Arcadia/FileSystem/FilePath.h"
 #include "Arcadia/FileSystem/FileType.h"
 
@@ -151,6 +152,14 @@ struct Arcadia_FileSystemDispatch {
       Arcadia_FileSystem* self
     );
 
+  Arcadia_FileMapping*
+  (*mapFile)
+    (
+      Arcadia_Thread* thread,
+      Arcadia_FileSystem* self,
+      Arcadia_FilePath* path
+    );
+
   Arcadia_BooleanValue
   (*regularFileExists)
     (
@@ -314,6 +323,24 @@ Arcadia_FileSystem_getWorkingDirectory
     Arcadia_FileSystem* self
   );
 
+/// @brief Map the contents of a regular file into memory for reading.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this file system.
+/// @param path The path of the regular file.
+/// @return A pointer to the file mapping.
+/// The contents are not copied: pages are loaded on first access.
+/// The behavior is undefined if the file is modified while it is mapped.
+/// @error Arcadia_Status_NotFound the file was not found
+/// @error Arcadia_Status_EnvironmentFailed the file is not a regular file or could not be mapped
+/// @error Arcadia_Status_AllocationFailed an allocation failed
+Arcadia_FileMapping*
+Arcadia_FileSystem_mapFile
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileSystem* self,
+    Arcadia_FilePath* path
+  );
+
 // https://michaelheilmann.com/Arcadia/Ring2/#Arcadia_FileSystem_regularFileExists
 Arcadia_BooleanValue
 Arcadia_FileSystem_regularFileExists
@@ -27,6 +27,7 @@
 #if Arcadia_Configuration_OperatingSystem == Arcadia_Configuration_OperatingSystem_Windows
 
   #include "Arcadia/FileSystem/Windows/DirectoryIteratorWindows.h"
+  #include "Arcadia/FileSystem/Windows/FileMappingWindows.h"
   #include "Arcadia/FileSystem/Windows/getLocalFolder.h"
   #include "Arcadia/FileSystem/Windows/getRoamingFolder.h"
 
@@ -36,6 +37,7 @@
     Arcadia_Configuration_OperatingSystem == Arcadia_Configuration_OperatingSystem_Cygwin
 
   #include "Arcadia/FileSystem/Linux/DirectoryIteratorLinux.h"
+  #include "Arcadia/FileSystem/Linux/FileMappingLinux.h"
   #include "Arcadia/FileSystem/Linux/getHomeFolder.h"
 
 #endif
@@ -209,6 +211,14 @@ Arcadia_DefaultFileSystem_getWorkingDirectoryImpl
     Arcadia_DefaultFileSystem* self
   );
 
+static Arcadia_FileMapping*
+Arcadia_DefaultFileSystem_mapFileImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DefaultFileSystem* self,
+    Arcadia_FilePath* path
+  );
+
 static Arcadia_BooleanValue
 Arcadia_DefaultFileSystem_regularFileExistsImpl
   (
@@ -321,6 +331,8 @@ Arcadia_DefaultFileSystem_initializeDispatchImpl
   ((Arcadia_FileSystemDispatch*)self)->getSaveDirectory = (Arcadia_FilePath * (*)(Arcadia_Thread*, Arcadia_FileSystem*)) & Arcadia_DefaultFileSystem_getSaveFolderImpl;
   ((Arcadia_FileSystemDispatch*)self)->getWorkingDirectory = (Arcadia_FilePath * (*)(Arcadia_Thread*, Arcadia_FileSystem*)) & Arcadia_DefaultFileSystem_getWorkingDirectoryImpl;
 
+  ((Arcadia_FileSystemDispatch*)self)->mapFile = (Arcadia_FileMapping * (*)(Arcadia_Thread*, Arcadia_FileSystem*, Arcadia_FilePath*)) & Arcadia_DefaultFileSystem_mapFileImpl;
+
   ((Arcadia_FileSystemDispatch*)self)->regularFileExists = (Arcadia_BooleanValue(*)(Arcadia_Thread*, Arcadia_FileSystem*, Arcadia_FilePath*)) & Arcadia_DefaultFileSystem_regularFileExistsImpl;
 
   ((Arcadia_FileSystemDispatch*)self)->setFileContents = (void (*)(Arcadia_Thread*, Arcadia_FileSystem*, Arcadia_FilePath*, Arcadia_ByteArrayBuilder*)) & Arcadia_DefaultFileSystem_setFileContentsImpl;
@@ -734,6 +746,23 @@ Arcadia_DefaultFileSystem_getWorkingDirectoryImpl
 #endif
 }
 
+static Arcadia_FileMapping*
+Arcadia_DefaultFileSystem_mapFileImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DefaultFileSystem* self,
+    Arcadia_FilePath* path
+  )
+{
+#if Arcadia_Configuration_OperatingSystem == Arcadia_Configuration_OperatingSystem_Windows
+  return (Arcadia_FileMapping*)Arcadia_FileMappingWindows_create(thread, path);
+#elif Arcadia_Configuration_OperatingSystem == Arcadia_Configuration_OperatingSystem_Linux
+  return (Arcadia_FileMapping*)Arcadia_FileMappingLinux_create(thread, path);
+#else
+  #error("operating system not (yet) supported")
+#endif
+}
+
 static Arcadia_BooleanValue
 Arcadia_DefaultFileSystem_regularFileExistsImpl
   (
@@ -29,6 +29,8 @@
 #include "Arcadia/FileSystem/FileAccessMode.h"
 #include "Arcadia/FileSystem/FileHandle.h"
 #include "Arcadia/FileSystem/FileHandleExtensions.h"
+#include "Arcadia/FileSystem/FileMapping.h"
+#include "Arcadia/FileSystem/FileMapping.ByteReader.h"
 #include "Arcadia/FileSystem/FilePath.h"
 #include "Arcadia/FileSystem/FileSystem.h"
 #include "Arcadia/FileSystem/FileType.h"
@@ -0,0 +1,173 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#define ARCADIA_FILESYSTEM_MODULE (1)
+#include "Arcadia/FileSystem/Linux/FileMappingLinux.h"
+
+#include "Arcadia/Ring2/Include.h"
+#include "Arcadia/FileSystem/FilePath.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static void
+Arcadia_FileMappingLinux_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMappingLinux* self
+  );
+
+static void
+Arcadia_FileMappingLinux_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMappingLinuxDispatch* self
+  );
+
+static void
+Arcadia_FileMappingLinux_destructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMappingLinux* self
+  );
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_FileMappingLinux_constructImpl,
+  .destruct = (Arcadia_Object_DestructCallbackFunction*)&Arcadia_FileMappingLinux_destructImpl,
+  .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_FileMappingLinux_initializeDispatchImpl,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.FileMappingLinux", Arcadia_FileMappingLinux,
+                         u8"Arcadia.FileMapping", Arcadia_FileMapping,
+                         &_typeOperations);
+
+static void
+Arcadia_FileMappingLinux_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMappingLinux* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_FileMappingLinux);
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  if (1 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->address = NULL;
+  self->length = 0;
+  // Clear errno.
+  errno = 0;
+  // Open file.
+  Arcadia_FilePath* path = Arcadia_ValueStack_getObjectReferenceValueChecked(thread, 1, _Arcadia_FilePath_getType(thread));
+  Arcadia_String* pathString = Arcadia_FilePath_toNative(thread, path, Arcadia_BooleanValue_True);
+  int fd = open(Arcadia_String_getBytes(thread, pathString), O_RDONLY);
+  if (-1 == fd) {
+    switch (errno) {
+      case ENOENT: {
+        errno = 0;
+        Arcadia_Thread_setStatus(thread, Arcadia_Status_NotFound);
+        Arcadia_Thread_jump(thread);
+      } break;
+      case EMFILE:
+      case ENFILE:
+      case ENOMEM: {
+        errno = 0;
+        Arcadia_Thread_setStatus(thread, Arcadia_Status_AllocationFailed);
+        Arcadia_Thread_jump(thread);
+      } break;
+      default: {
+        errno = 0;
+        Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+        Arcadia_Thread_jump(thread);
+      } break;
+    };
+  }
+  struct stat sb;
+  if (-1 == fstat(fd, &sb) || !S_ISREG(sb.st_mode)) {
+    errno = 0;
+    close(fd);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  if (sb.st_size > 0) {
+    if ((Arcadia_Natural64Value)sb.st_size > Arcadia_SizeValue_Maximum) {
+      close(fd);
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_AllocationFailed);
+      Arcadia_Thread_jump(thread);
+    }
+    // The mapping stays valid after the file descriptor is closed.
+    void* address = mmap(NULL, (size_t)sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (MAP_FAILED == address) {
+      errno = 0;
+      close(fd);
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+      Arcadia_Thread_jump(thread);
+    }
+    self->address = address;
+    self->length = (size_t)sb.st_size;
+  }
+  close(fd);
+  ((Arcadia_FileMapping*)self)->bytes = self->address;
+  ((Arcadia_FileMapping*)self)->numberOfBytes = self->length;
+  Arcadia_LeaveConstructor(Arcadia_FileMappingLinux);
+}
+
+static void
+Arcadia_FileMappingLinux_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMappingLinuxDispatch* self
+  )
+{/*Intentionally empty.*/}
+
+static void
+Arcadia_FileMappingLinux_destructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMappingLinux* self
+  )
+{
+  if (self->address) {
+    munmap(self->address, self->length);
+    self->address = NULL;
+    self->length = 0;
+  }
+}
+
+Arcadia_FileMappingLinux*
+Arcadia_FileMappingLinux_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FilePath* path
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  Arcadia_ValueStack_pushObjectReferenceValue(thread, (Arcadia_Object*)path);
+  Arcadia_ValueStack_pushNatural8Value(thread, 1);
+  ARCADIA_CREATEOBJECT(Arcadia_FileMappingLinux);
+}
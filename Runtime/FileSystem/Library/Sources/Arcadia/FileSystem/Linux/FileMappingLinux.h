@@ -0,0 +1,46 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_FILESYSTEM_LINUX_FILEMAPPINGLINUX_H_INCLUDED)
+#define ARCADIA_FILESYSTEM_LINUX_FILEMAPPINGLINUX_H_INCLUDED
+
+#if !defined(ARCADIA_FILESYSTEM_MODULE)
+  #error("do not include directly, include `Arcadia/FileSystem/Include.h` instead")
+#endif
+
+#include "Arcadia/FileSystem/FileMapping.h"
+typedef struct Arcadia_FilePath Arcadia_FilePath;
+
+Arcadia_declareObjectType(u8"Arcadia.FileMappingLinux", Arcadia_FileMappingLinux,
+                          u8"Arcadia.FileMapping");
+
+struct Arcadia_FileMappingLinuxDispatch {
+  Arcadia_FileMappingDispatch _parent;
+};
+
+struct Arcadia_FileMappingLinux {
+  Arcadia_FileMapping _parent;
+  void* address;
+  size_t length;
+};
+
+Arcadia_FileMappingLinux*
+Arcadia_FileMappingLinux_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FilePath* path
+  );
+
+#endif // ARCADIA_FILESYSTEM_LINUX_FILEMAPPINGLINUX_H_INCLUDED
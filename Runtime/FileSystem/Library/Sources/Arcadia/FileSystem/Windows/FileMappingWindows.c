@@ -0,0 +1,170 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#define ARCADIA_FILESYSTEM_MODULE (1)
+#include "Arcadia/FileSystem/Windows/FileMappingWindows.h"
+
+#include "Arcadia/Ring2/Include.h"
+#include "Arcadia/FileSystem/FilePath.h"
+
+static void
+Arcadia_FileMappingWindows_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMappingWindows* self
+  );
+
+static void
+Arcadia_FileMappingWindows_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMappingWindowsDispatch* self
+  );
+
+static void
+Arcadia_FileMappingWindows_destructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMappingWindows* self
+  );
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_FileMappingWindows_constructImpl,
+  .destruct = (Arcadia_Object_DestructCallbackFunction*)&Arcadia_FileMappingWindows_destructImpl,
+  .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_FileMappingWindows_initializeDispatchImpl,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.FileMappingWindows", Arcadia_FileMappingWindows,
+                         u8"Arcadia.FileMapping", Arcadia_FileMapping,
+                         &_typeOperations);
+
+static void
+Arcadia_FileMappingWindows_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMappingWindows* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_FileMappingWindows);
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  if (1 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->fileHandle = INVALID_HANDLE_VALUE;
+  self->mappingHandle = NULL;
+  self->address = NULL;
+  self->length = 0;
+  // Open file.
+  Arcadia_FilePath* path = Arcadia_ValueStack_getObjectReferenceValueChecked(thread, 1, _Arcadia_FilePath_getType(thread));
+  Arcadia_String* pathString = Arcadia_FilePath_toNative(thread, path, Arcadia_BooleanValue_True);
+  self->fileHandle = CreateFileA(Arcadia_String_getBytes(thread, pathString), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (INVALID_HANDLE_VALUE == self->fileHandle) {
+    DWORD error = GetLastError();
+    if (ERROR_FILE_NOT_FOUND == error || ERROR_PATH_NOT_FOUND == error) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_NotFound);
+    } else {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+    }
+    Arcadia_Thread_jump(thread);
+  }
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(self->fileHandle, &size)) {
+    CloseHandle(self->fileHandle);
+    self->fileHandle = INVALID_HANDLE_VALUE;
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  if (size.QuadPart > 0) {
+    if ((Arcadia_Natural64Value)size.QuadPart > Arcadia_SizeValue_Maximum) {
+      CloseHandle(self->fileHandle);
+      self->fileHandle = INVALID_HANDLE_VALUE;
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_AllocationFailed);
+      Arcadia_Thread_jump(thread);
+    }
+    self->mappingHandle = CreateFileMappingA(self->fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!self->mappingHandle) {
+      CloseHandle(self->fileHandle);
+      self->fileHandle = INVALID_HANDLE_VALUE;
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+      Arcadia_Thread_jump(thread);
+    }
+    self->address = MapViewOfFile(self->mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (!self->address) {
+      CloseHandle(self->mappingHandle);
+      self->mappingHandle = NULL;
+      CloseHandle(self->fileHandle);
+      self->fileHandle = INVALID_HANDLE_VALUE;
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+      Arcadia_Thread_jump(thread);
+    }
+    self->length = (size_t)size.QuadPart;
+  }
+  ((Arcadia_FileMapping*)self)->bytes = self->address;
+  ((Arcadia_FileMapping*)self)->numberOfBytes = self->length;
+  Arcadia_LeaveConstructor(Arcadia_FileMappingWindows);
+}
+
+static void
+Arcadia_FileMappingWindows_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMappingWindowsDispatch* self
+  )
+{/*Intentionally empty.*/}
+
+static void
+Arcadia_FileMappingWindows_destructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FileMappingWindows* self
+  )
+{
+  if (self->address) {
+    UnmapViewOfFile(self->address);
+    self->address = NULL;
+    self->length = 0;
+  }
+  if (self->mappingHandle) {
+    CloseHandle(self->mappingHandle);
+    self->mappingHandle = NULL;
+  }
+  if (INVALID_HANDLE_VALUE != self->fileHandle) {
+    CloseHandle(self->fileHandle);
+    self->fileHandle = INVALID_HANDLE_VALUE;
+  }
+}
+
+Arcadia_FileMappingWindows*
+Arcadia_FileMappingWindows_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FilePath* path
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  Arcadia_ValueStack_pushObjectReferenceValue(thread, (Arcadia_Object*)path);
+  Arcadia_ValueStack_pushNatural8Value(thread, 1);
+  ARCADIA_CREATEOBJECT(Arcadia_FileMappingWindows);
+}
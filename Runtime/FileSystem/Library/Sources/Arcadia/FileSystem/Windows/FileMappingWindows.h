@@ -0,0 +1,50 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_FILESYSTEM_WINDOWS_FILEMAPPINGWINDOWS_H_INCLUDED)
+#define ARCADIA_FILESYSTEM_WINDOWS_FILEMAPPINGWINDOWS_H_INCLUDED
+
+#if !defined(ARCADIA_FILESYSTEM_MODULE)
+  #error("do not include directly, include `Arcadia/FileSystem/Include.h` instead")
+#endif
+
+#include "Arcadia/FileSystem/FileMapping.h"
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+typedef struct Arcadia_FilePath Arcadia_FilePath;
+
+Arcadia_declareObjectType(u8"Arcadia.FileMappingWindows", Arcadia_FileMappingWindows,
+                          u8"Arcadia.FileMapping");
+
+struct Arcadia_FileMappingWindowsDispatch {
+  Arcadia_FileMappingDispatch _parent;
+};
+
+struct Arcadia_FileMappingWindows {
+  Arcadia_FileMapping _parent;
+  HANDLE fileHandle;
+  HANDLE mappingHandle;
+  void* address;
+  size_t length;
+};
+
+Arcadia_FileMappingWindows*
+Arcadia_FileMappingWindows_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FilePath* path
+  );
+
+#endif // ARCADIA_FILESYSTEM_WINDOWS_FILEMAPPINGWINDOWS_H_INCLUDED
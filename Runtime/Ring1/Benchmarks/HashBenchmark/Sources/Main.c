@@ -0,0 +1,216 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <string.h>
+
+#include "Arcadia/Ring1/Include.h"
+#include "Arcadia/Benchmarks/Harness/Driver.h"
+
+static char const* const g_identifiers[] = {
+#define Identifier(x) x,
+#include "Arcadia.Ring1.Tests.HashTests/Identifiers.i"
+#undef Identifier
+};
+
+#define NumberOfIdentifiers (sizeof(g_identifiers) / sizeof(char const*))
+
+// The number of times each identifier is hashed or looked up per repetition.
+#define NumberOfRounds (100)
+
+static Arcadia_SizeValue g_lengths[NumberOfIdentifiers];
+
+// The names of Names.getOrCreateName.
+static Arcadia_Name* g_names[NumberOfIdentifiers];
+
+// The atoms of Atoms.getOrCreateAtom.
+static Arcadia_AtomValue g_atoms[NumberOfIdentifiers];
+
+// Prevent the compiler from removing the computation of the hash values.
+static volatile Arcadia_SizeValue g_sink = 0;
+
+static void
+setUpLengths
+  (
+    Arcadia_Thread* thread
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < NumberOfIdentifiers; ++i) {
+    g_lengths[i] = strlen(g_identifiers[i]);
+  }
+}
+
+// The byte-at-a-time hash function formerly used by immutable UTF-8 strings, atoms, and string tables.
+static Arcadia_SizeValue
+referenceHashBytes
+  (
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  Arcadia_SizeValue hash = numberOfBytes;
+  for (Arcadia_SizeValue i = 0, n = numberOfBytes; i < n; ++i) {
+    hash = hash * 37 + bytes[i];
+  }
+  return hash;
+}
+
+// Hash all identifiers by the reference hash function.
+static void
+runReferenceHash
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_SizeValue sink = 0;
+  for (Arcadia_SizeValue j = 0; j < NumberOfRounds; ++j) {
+    for (Arcadia_SizeValue i = 0; i < NumberOfIdentifiers; ++i) {
+      sink ^= referenceHashBytes((Arcadia_Natural8Value const*)g_identifiers[i], g_lengths[i]);
+    }
+  }
+  g_sink = sink;
+}
+
+// Hash all identifiers by Arcadia_hashBytes.
+static void
+runHashBytes
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_SizeValue sink = 0;
+  for (Arcadia_SizeValue j = 0; j < NumberOfRounds; ++j) {
+    for (Arcadia_SizeValue i = 0; i < NumberOfIdentifiers; ++i) {
+      sink ^= Arcadia_hashBytes(thread, g_identifiers[i], g_lengths[i]);
+    }
+  }
+  g_sink = sink;
+}
+
+// The names are locked such that the lookups find them after the collector ran between the repetitions.
+static void
+setUpNames
+  (
+    Arcadia_Thread* thread
+  )
+{
+  setUpLengths(thread);
+  for (Arcadia_SizeValue i = 0; i < NumberOfIdentifiers; ++i) {
+    g_names[i] = Arcadia_Names_getOrCreateName(thread, g_identifiers[i], g_lengths[i]);
+    Arcadia_Process_lockObject(Arcadia_Thread_getProcess(thread), g_names[i]);
+  }
+}
+
+// Look up the names of all identifiers.
+static void
+runNames
+  (
+    Arcadia_Thread* thread
+  )
+{
+  for (Arcadia_SizeValue j = 0; j < NumberOfRounds; ++j) {
+    for (Arcadia_SizeValue i = 0; i < NumberOfIdentifiers; ++i) {
+      if (g_names[i] != Arcadia_Names_getOrCreateName(thread, g_identifiers[i], g_lengths[i])) {
+        Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+        Arcadia_Thread_jump(thread);
+      }
+    }
+  }
+}
+
+static void
+tearDownNames
+  (
+    Arcadia_Thread* thread
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < NumberOfIdentifiers; ++i) {
+    Arcadia_Process_unlockObject(Arcadia_Thread_getProcess(thread), g_names[i]);
+    g_names[i] = NULL;
+  }
+}
+
+// The atoms are locked such that the lookups find them after the collector ran between the repetitions.
+static void
+setUpAtoms
+  (
+    Arcadia_Thread* thread
+  )
+{
+  setUpLengths(thread);
+  for (Arcadia_SizeValue i = 0; i < NumberOfIdentifiers; ++i) {
+    g_atoms[i] = Arcadia_Atoms_getOrCreateAtom(thread, 0, g_identifiers[i], g_lengths[i]);
+    Arcadia_Process_lockObject(Arcadia_Thread_getProcess(thread), g_atoms[i]);
+  }
+}
+
+// Look up the atoms of all identifiers.
+static void
+runAtoms
+  (
+    Arcadia_Thread* thread
+  )
+{
+  for (Arcadia_SizeValue j = 0; j < NumberOfRounds; ++j) {
+    for (Arcadia_SizeValue i = 0; i < NumberOfIdentifiers; ++i) {
+      if (g_atoms[i] != Arcadia_Atoms_getOrCreateAtom(thread, 0, g_identifiers[i], g_lengths[i])) {
+        Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+        Arcadia_Thread_jump(thread);
+      }
+    }
+  }
+}
+
+static void
+tearDownAtoms
+  (
+    Arcadia_Thread* thread
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < NumberOfIdentifiers; ++i) {
+    Arcadia_Process_unlockObject(Arcadia_Thread_getProcess(thread), g_atoms[i]);
+    g_atoms[i] = NULL;
+  }
+}
+
+// One operation is the hashing or the lookup of one identifier.
+static Arcadia_Benchmarks_Benchmark const g_benchmarks[] = {
+  { u8"Hash.reference", NumberOfIdentifiers * NumberOfRounds, &setUpLengths, &runReferenceHash, NULL },
+  { u8"Hash.hashBytes", NumberOfIdentifiers * NumberOfRounds, &setUpLengths, &runHashBytes, NULL },
+  { u8"Names.getOrCreateName", NumberOfIdentifiers * NumberOfRounds, &setUpNames, &runNames, &tearDownNames },
+  { u8"Atoms.getOrCreateAtom", NumberOfIdentifiers * NumberOfRounds, &setUpAtoms, &runAtoms, &tearDownAtoms },
+};
+
+static Arcadia_Benchmarks_Benchmark const*
+getBenchmarks
+  (
+    Arcadia_SizeValue* numberOfBenchmarks
+  )
+{
+  *numberOfBenchmarks = sizeof(g_benchmarks) / sizeof(Arcadia_Benchmarks_Benchmark);
+  return g_benchmarks;
+}
+
+static Arcadia_Benchmarks_GetBenchmarks* const g_groups[] = {
+  &getBenchmarks,
+};
+
+// See Arcadia_Benchmarks_main for the command line arguments.
+int
+main
+  (
+    int argc,
+    char** argv
+  )
+{ return Arcadia_Benchmarks_main(argc, argv, g_groups, sizeof(g_groups) / sizeof(Arcadia_Benchmarks_GetBenchmarks*)); }
@@ -0,0 +1,98 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <stdio.h>
+
+#include "Arcadia/Ring1/Include.h"
+#include "Arcadia/Benchmarks/Harness/Driver.h"
+
+// The number of zones recorded per repetition.
+// The buffer of the thread is not cleared between the repetitions: each repetition of Profiler.zone adds 1 MiB to it.
+#define NumberOfZones (1024 * 16)
+
+// Prevent the compiler from removing the reads of the clock.
+static volatile Arcadia_Natural64Value g_sink = 0;
+
+static void
+runTimestamp
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Natural64Value sink = 0;
+  for (Arcadia_SizeValue i = 0; i < NumberOfZones; ++i) {
+    sink ^= Arcadia_Profiler_getTimestamp();
+  }
+  g_sink = sink;
+}
+
+static void
+runZone
+  (
+    Arcadia_Thread* thread
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < NumberOfZones; ++i) {
+    Arcadia_Profiler_beginZone(thread, "zone");
+    Arcadia_Profiler_endZone(thread);
+  }
+}
+
+static void
+runCounter
+  (
+    Arcadia_Thread* thread
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < NumberOfZones; ++i) {
+    Arcadia_Profiler_setCounter(thread, "counter", (Arcadia_Integer64Value)i);
+  }
+}
+
+static Arcadia_Benchmarks_Benchmark const g_benchmarks[] = {
+  { u8"Profiler.getTimestamp", NumberOfZones, NULL, &runTimestamp, NULL },
+  { u8"Profiler.zone", NumberOfZones, NULL, &runZone, NULL },
+  { u8"Profiler.setCounter", NumberOfZones, NULL, &runCounter, NULL },
+};
+
+static Arcadia_Benchmarks_Benchmark const*
+getBenchmarks
+  (
+    Arcadia_SizeValue* numberOfBenchmarks
+  )
+{
+  *numberOfBenchmarks = sizeof(g_benchmarks) / sizeof(Arcadia_Benchmarks_Benchmark);
+  return g_benchmarks;
+}
+
+static Arcadia_Benchmarks_GetBenchmarks* const g_groups[] = {
+  &getBenchmarks,
+};
+
+// See Arcadia_Benchmarks_main for the command line arguments.
+int
+main
+  (
+    int argc,
+    char** argv
+  )
+{
+#if 1 == Arcadia_Configuration_Profiler_Enabled
+  fprintf(stdout, "profiler enabled\n");
+#else
+  fprintf(stdout, "profiler disabled\n");
+#endif
+  return Arcadia_Benchmarks_main(argc, argv, g_groups, sizeof(g_groups) / sizeof(Arcadia_Benchmarks_GetBenchmarks*));
+}
@@ -89,14 +89,6 @@ visitCallback
     Arcadia_AtomValue atom
   );
 
-static Arcadia_SizeValue
-hashBytes
-  (
-    Arcadia_Thread* thread,
-    void const* bytes,
-    Arcadia_SizeValue numberOfBytes
-  );
-
 static void
 resize
   (
@@ -147,7 +139,7 @@ finalizeCallback
     Arcadia_AtomValue atom
   )
 {
-  Arcadia_SizeValue index = atom->hash % g_singleton->capacity;
+  Arcadia_SizeValue index = atom->hash & (g_singleton->capacity - 1);
   Arcadia_Atom** previous = &g_singleton->buckets[index];
   Arcadia_Atom* current = g_singleton->buckets[index];
   while (current) {
@@ -170,22 +162,6 @@ visitCallback
   )
 {/*Intentionally empty.*/}
 
-static Arcadia_SizeValue
-hashBytes
-  (
-    Arcadia_Thread* thread,
-    void const* bytes,
-    Arcadia_SizeValue numberOfBytes
-  )
-{
-  uint8_t const* p = (uint8_t const*)bytes;
-  Arcadia_SizeValue hashValue = numberOfBytes;
-  for (Arcadia_SizeValue i = 0, n = numberOfBytes; i < n; ++i) {
-    hashValue = hashValue * 37 + p[i];
-  }
-  return hashValue;
-}
-
 static void
 resize
   (
@@ -197,13 +173,8 @@ resize
     Arcadia_SizeValue newCapacity = oldCapacity;
     if (oldCapacity > g_singleton->maximumCapacity / 2) {
       // If oldCapacity > maximumCapacity / 2 holds then oldCapacity * 2 > maximumCapacity holds.
-      // Consequently, we cannot double the capacity. Try to saturate the capacity.
-      if (oldCapacity == g_singleton->maximumCapacity) {
-        // Do nothing.
-        return;
-      } else {
-        newCapacity = g_singleton->maximumCapacity;
-      }
+      // Consequently, we cannot double the capacity. The capacity must remain a power of two, so do nothing.
+      return;
     } else {
       newCapacity = oldCapacity * 2;
     }
@@ -216,7 +187,7 @@ resize
       while (oldBuckets[i]) {
         Arcadia_Atom*node = oldBuckets[i];
         oldBuckets[i] = oldBuckets[i]->next;
-        Arcadia_SizeValue j = node->hash % newCapacity;
+        Arcadia_SizeValue j = node->hash & (newCapacity - 1);
         node->next = newBuckets[j];
         newBuckets[j] = node;
       }
@@ -227,6 +198,7 @@ resize
   }
 }
 
+// The capacity of the table is a power of two such that the index of a bucket can be computed by masking.
 #define Arcadia_Ring1_Configuration_Atoms_InitialCapacity (8)
 #define Arcadia_Ring1_Configuration_Atoms_MinimalCapacity (8)
 #define Arcadia_Ring1_Configuration_Atoms_MaximalCapacity (Arcadia_SizeValue_Maximum/sizeof(Arcadia_Atom*))
@@ -235,8 +207,8 @@ Arcadia_StaticAssert(Arcadia_Ring1_Configuration_Atoms_MinimalCapacity <= Arcadi
 Arcadia_StaticAssert(Arcadia_Ring1_Configuration_Atoms_MinimalCapacity <= Arcadia_Ring1_Configuration_Atoms_InitialCapacity, "configuration invalid");
 Arcadia_StaticAssert(Arcadia_Ring1_Configuration_Atoms_InitialCapacity <= Arcadia_Ring1_Configuration_Atoms_MaximalCapacity, "configuration invalid");
 
-Arcadia_AtomValue
-Arcadia_Atoms_getOrCreateAtom
+static Arcadia_AtomValue
+getOrCreateAtom
   (
     Arcadia_Thread* thread,
     Arcadia_Natural8Value flags,
@@ -249,13 +221,13 @@ Arcadia_Atoms_getOrCreateAtom
     Arcadia_Thread_jump(thread);
   }
 
-  if (Arcadia_Unicode_isUTF8(thread, bytes, numberOfBytes, NULL)) {
+  if (!Arcadia_Unicode_isUTF8(thread, bytes, numberOfBytes, NULL)) {
     Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
     Arcadia_Thread_jump(thread);
   }
 
-  Arcadia_SizeValue hash = hashBytes(thread, bytes, numberOfBytes);
-  Arcadia_SizeValue index = hash % g_singleton->capacity;
+  Arcadia_SizeValue hash = Arcadia_hashBytes(thread, bytes, numberOfBytes);
+  Arcadia_SizeValue index = hash & (g_singleton->capacity - 1);
   for (Arcadia_Atom* atom = g_singleton->buckets[index]; NULL != atom; atom = atom->next) {
     if (atom->numberOfBytes == numberOfBytes && atom->hash == hash) {
       if (!memcmp(atom->bytes, bytes, numberOfBytes)) {
@@ -276,6 +248,32 @@ Arcadia_Atoms_getOrCreateAtom
   return atom;
 }
 
+Arcadia_AtomValue
+Arcadia_Atoms_getOrCreateAtom
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value flags,
+    const void* bytes,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  Arcadia_Process* process = Arcadia_Thread_getProcess(thread);
+  Arcadia_AtomValue atom = NULL;
+  Arcadia_Process_lockRuntime(process);
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    atom = getOrCreateAtom(thread, flags, bytes, numberOfBytes);
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Process_unlockRuntime(process);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Process_unlockRuntime(process);
+    Arcadia_Thread_jump(thread);
+  }
+  return atom;
+}
+
 void
 Arcadia_Atom_visit
   (
@@ -20,7 +20,7 @@
 
 #define TypeName u8"Arcadia.BigInteger"
 
-static Arcadia_BooleanValue g_registered = Arcadia_BooleanValue_False;
+static uint32_t volatile g_registered = 0;
 
 static void
 onFinalize
@@ -43,7 +43,7 @@ onTypeRemoved
     size_t numberOfBytes
   )
 {
-  g_registered = Arcadia_BooleanValue_False;
+  g_registered = 0;
 }
 
 Arcadia_BigInteger*
@@ -52,15 +52,13 @@ Arcadia_BigInteger_create
     Arcadia_Thread* thread
   )
 {
-  if (!g_registered) {
-    Arcadia_Process_registerType(Arcadia_Thread_getProcess(thread),
-                                 TypeName, sizeof(TypeName) - 1,
-                                 Arcadia_Thread_getProcess(thread), 
-                                 (Arcadia_Process_TypeRemovedCallback*)&onTypeRemoved,
-                                 NULL,
-                                 (Arcadia_Process_FinalizeCallback*)&onFinalize);
-    g_registered = Arcadia_BooleanValue_True;
-  }
+  Arcadia_Process_registerTypeOnce(Arcadia_Thread_getProcess(thread),
+                                   &g_registered,
+                                   TypeName, sizeof(TypeName) - 1,
+                                   Arcadia_Thread_getProcess(thread),
+                                   (Arcadia_Process_TypeRemovedCallback*)&onTypeRemoved,
+                                   NULL,
+                                   (Arcadia_Process_FinalizeCallback*)&onFinalize);
   Arcadia_BigInteger* self = NULL;
   Arcadia_Process_allocate(Arcadia_Thread_getProcess(thread), (void**)&self, TypeName, sizeof(TypeName) - 1, sizeof(Arcadia_BigInteger));
   self->numberOfLimps = 0;
@@ -335,16 +333,20 @@ typeDestructing
   g_type = NULL;
 }
 
+static Arcadia_TypeValue
+registerType
+  (
+    Arcadia_Thread* thread
+  )
+{ return Arcadia_registerInternalType(thread, Arcadia_Names_getOrCreateName(thread, TypeName, sizeof(TypeName) - 1), &_typeOperations, &typeDestructing); }
+
 Arcadia_TypeValue
 _Arcadia_BigIntegerValue_getType
   (
     Arcadia_Thread* thread
   )
 {
-  if (!g_type) {
-    g_type = Arcadia_registerInternalType(thread, Arcadia_Names_getOrCreateName(thread, TypeName, sizeof(TypeName) - 1), &_typeOperations, &typeDestructing);
-  }
-  return g_type;
+  return Arcadia_getOrRegisterType(thread, &g_type, &registerType);
 }
 
 void
@@ -0,0 +1,191 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/Ring1/Implementation/Concurrency/Atomic.h"
+
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  /* Intentionally empty. Nothing to include. */
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  #define WIN32_LEAN_AND_MEAN
+  #include <Windows.h>
+#else
+  #error("environment not (yet) supported")
+#endif
+
+uint32_t
+Arcadia_Memory_atomicLoad32
+  (
+    uint32_t volatile* source
+  )
+{
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  return __atomic_load_n(source, __ATOMIC_SEQ_CST);
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  return (uint32_t)InterlockedCompareExchange((LONG volatile*)source, 0, 0);
+#else
+  #error("environment not (yet) supported")
+#endif
+}
+
+void
+Arcadia_Memory_atomicStore32
+  (
+    uint32_t volatile* destination,
+    uint32_t value
+  )
+{
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  __atomic_store_n(destination, value, __ATOMIC_SEQ_CST);
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  InterlockedExchange((LONG volatile*)destination, (LONG)value);
+#else
+  #error("environment not (yet) supported")
+#endif
+}
+
+uint32_t
+Arcadia_Memory_atomicExchange32
+  (
+    uint32_t volatile* destination,
+    uint32_t exchange
+  )
+{
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  return __atomic_exchange_n(destination, exchange, __ATOMIC_SEQ_CST);
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  return (uint32_t)InterlockedExchange((LONG volatile*)destination, (LONG)exchange);
+#else
+  #error("environment not (yet) supported")
+#endif
+}
+
+uint32_t
+Arcadia_Memory_atomicAdd32
+  (
+    uint32_t volatile* destination,
+    uint32_t addend
+  )
+{
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  return __atomic_add_fetch(destination, addend, __ATOMIC_SEQ_CST);
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  return (uint32_t)InterlockedAdd((LONG volatile*)destination, (LONG)addend);
+#else
+  #error("environment not (yet) supported")
+#endif
+}
+
+uint32_t
+Arcadia_Memory_atomicCompareAndSwap32
+  (
+    uint32_t volatile* destination,
+    uint32_t comperand,
+    uint32_t exchange
+  )
+{
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  // On failure, comperand receives the old value.
+  __atomic_compare_exchange_n(destination, &comperand, exchange, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+  return comperand;
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  return (uint32_t)InterlockedCompareExchange((LONG volatile*)destination, (LONG)exchange, (LONG)comperand);
+#else
+  #error("environment not (yet) supported")
+#endif
+}
+
+void*
+Arcadia_Memory_atomicLoadPointer
+  (
+    void* volatile* source
+  )
+{
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  return __atomic_load_n(source, __ATOMIC_SEQ_CST);
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  return InterlockedCompareExchangePointer(source, NULL, NULL);
+#else
+  #error("environment not (yet) supported")
+#endif
+}
+
+void
+Arcadia_Memory_atomicStorePointer
+  (
+    void* volatile* destination,
+    void* value
+  )
+{
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  __atomic_store_n(destination, value, __ATOMIC_SEQ_CST);
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  InterlockedExchangePointer(destination, value);
+#else
+  #error("environment not (yet) supported")
+#endif
+}
+
+size_t
+Arcadia_Memory_atomicLoadSize
+  (
+    size_t volatile* source
+  )
+{
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  return __atomic_load_n(source, __ATOMIC_SEQ_CST);
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  // size_t and pointers have the same width on Windows.
+  return (size_t)InterlockedCompareExchangePointer((PVOID volatile*)source, NULL, NULL);
+#else
+  #error("environment not (yet) supported")
+#endif
+}
+
+void
+Arcadia_Memory_atomicStoreSize
+  (
+    size_t volatile* destination,
+    size_t value
+  )
+{
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  __atomic_store_n(destination, value, __ATOMIC_SEQ_CST);
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  // size_t and pointers have the same width on Windows.
+  InterlockedExchangePointer((PVOID volatile*)destination, (PVOID)value);
+#else
+  #error("environment not (yet) supported")
+#endif
+}
@@ -0,0 +1,124 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_RING1_CONCURRENCY_ATOMIC_H_INCLUDED)
+#define ARCADIA_RING1_CONCURRENCY_ATOMIC_H_INCLUDED
+
+#include "Arcadia/Ring1/Implementation/Configure.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/// @brief Atomically load the value of a 32 bit variable.
+/// @param source A pointer to the variable.
+/// @return The value of the variable.
+/// @remarks The operation is sequentially consistent.
+uint32_t
+Arcadia_Memory_atomicLoad32
+  (
+    uint32_t volatile* source
+  );
+
+/// @brief Atomically store a value in a 32 bit variable.
+/// @param destination A pointer to the variable.
+/// @param value The value.
+/// @remarks The operation is sequentially consistent.
+void
+Arcadia_Memory_atomicStore32
+  (
+    uint32_t volatile* destination,
+    uint32_t value
+  );
+
+/// @brief Atomically replace the value of a 32 bit variable.
+/// @param destination A pointer to the variable.
+/// @param exchange The new value of the variable.
+/// @return The old value of the variable.
+/// @remarks The operation is sequentially consistent.
+uint32_t
+Arcadia_Memory_atomicExchange32
+  (
+    uint32_t volatile* destination,
+    uint32_t exchange
+  );
+
+/// @brief Atomically add to the value of a 32 bit variable.
+/// @param destination A pointer to the variable.
+/// @param addend The value to add. Use the two's complement to subtract.
+/// @return The new value of the variable.
+/// @remarks The operation is sequentially consistent.
+uint32_t
+Arcadia_Memory_atomicAdd32
+  (
+    uint32_t volatile* destination,
+    uint32_t addend
+  );
+
+/// @brief Atomically compare the value of a 32 bit variable to a value. If the comparison yields true, then replace the value of the variable by a specified value.
+/// @param destination A pointer to the variable.
+/// @param comperand The value to compare the value of the variable to.
+/// @param exchange The new value of the variable if the comparison yields true.
+/// @return The old value of the variable.
+/// @remarks The operation is sequentially consistent.
+uint32_t
+Arcadia_Memory_atomicCompareAndSwap32
+  (
+    uint32_t volatile* destination,
+    uint32_t comperand,
+    uint32_t exchange
+  );
+
+/// @brief Atomically load the value of a pointer variable.
+/// @param source A pointer to the variable.
+/// @return The value of the variable.
+/// @remarks The operation is sequentially consistent.
+void*
+Arcadia_Memory_atomicLoadPointer
+  (
+    void* volatile* source
+  );
+
+/// @brief Atomically store a value in a pointer variable.
+/// @param destination A pointer to the variable.
+/// @param value The value.
+/// @remarks The operation is sequentially consistent.
+void
+Arcadia_Memory_atomicStorePointer
+  (
+    void* volatile* destination,
+    void* value
+  );
+
+/// @brief Atomically load the value of a size variable.
+/// @param source A pointer to the variable.
+/// @return The value of the variable.
+/// @remarks The operation is sequentially consistent.
+size_t
+Arcadia_Memory_atomicLoadSize
+  (
+    size_t volatile* source
+  );
+
+/// @brief Atomically store a value in a size variable.
+/// @param destination A pointer to the variable.
+/// @param value The value.
+/// @remarks The operation is sequentially consistent.
+void
+Arcadia_Memory_atomicStoreSize
+  (
+    size_t volatile* destination,
+    size_t value
+  );
+
+#endif // ARCADIA_RING1_CONCURRENCY_ATOMIC_H_INCLUDED
@@ -16,6 +16,7 @@
 #include "Arcadia/Ring1/Implementation/Concurrency/Condition.h"
 
 #include "Arcadia/Ring1/Implementation/Concurrency/CompareAndSwap.h"
+#include "Arcadia/Ring1/Implementation/Concurrency/Mutex.module.h"
 #include <malloc.h>
 
 #if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
@@ -38,7 +39,6 @@ struct Impl {
     pthread_cond_t condition;
   #elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
     CONDITION_VARIABLE conditionVariable;
-    CRITICAL_SECTION criticalSection;
   #else
     #error("environment not (yet) supported")
   #endif
@@ -117,9 +117,30 @@ Arcadia_Concurrency_Condition_uninitialize
 Arcadia_Concurrency_Condition_Result
 Arcadia_Concurrency_Condition_wait
   (
-    Arcadia_Concurrency_Condition* condition
+    Arcadia_Concurrency_Condition* condition,
+    Arcadia_Concurrency_Mutex* mutex
   )
-{ return Arcadia_Concurrency_Condition_Result_Success; }
+{
+  if (!condition || !condition->pimpl || !mutex || !mutex->pimpl) {
+    return Arcadia_Concurrency_Condition_Result_ArgumentInvalid;
+  }
+  Impl* pimpl = (Impl*)condition->pimpl;
+  Arcadia_Concurrency_MutexImpl* mutexImpl = (Arcadia_Concurrency_MutexImpl*)mutex->pimpl;
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  if (pthread_cond_wait(&pimpl->condition, &mutexImpl->mutex)) {
+    return Arcadia_Concurrency_Condition_Result_EnvironmentFailed;
+  }
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  if (!SleepConditionVariableCS(&pimpl->conditionVariable, &mutexImpl->mutex, INFINITE)) {
+    return Arcadia_Concurrency_Condition_Result_EnvironmentFailed;
+  }
+#else
+  #error("operating system not (yet) supported")
+#endif
+  return Arcadia_Concurrency_Condition_Result_Success;
+}
 
 Arcadia_Concurrency_Condition_Result
 Arcadia_Concurrency_Condition_signalOne
@@ -127,9 +148,21 @@ Arcadia_Concurrency_Condition_signalOne
     Arcadia_Concurrency_Condition* condition
   )
 {
-  if (!condition) {
+  if (!condition || !condition->pimpl) {
     return Arcadia_Concurrency_Condition_Result_ArgumentInvalid;
   }
+  Impl* pimpl = (Impl*)condition->pimpl;
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  if (pthread_cond_signal(&pimpl->condition)) {
+    return Arcadia_Concurrency_Condition_Result_EnvironmentFailed;
+  }
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  WakeConditionVariable(&pimpl->conditionVariable);
+#else
+  #error("operating system not (yet) supported")
+#endif
   return Arcadia_Concurrency_Condition_Result_Success;
 }
 
@@ -139,8 +172,20 @@ Arcadia_Concurrency_Condition_signalAll
     Arcadia_Concurrency_Condition* condition
   )
 {
-  if (!condition) {
+  if (!condition || !condition->pimpl) {
     return Arcadia_Concurrency_Condition_Result_ArgumentInvalid;
   }
+  Impl* pimpl = (Impl*)condition->pimpl;
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  if (pthread_cond_broadcast(&pimpl->condition)) {
+    return Arcadia_Concurrency_Condition_Result_EnvironmentFailed;
+  }
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  WakeAllConditionVariable(&pimpl->conditionVariable);
+#else
+  #error("operating system not (yet) supported")
+#endif
   return Arcadia_Concurrency_Condition_Result_Success;
 }
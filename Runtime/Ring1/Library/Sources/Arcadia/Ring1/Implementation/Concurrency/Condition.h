@@ -17,6 +17,7 @@
 #define ARCADIA_RING1_CONCURRENCY_CONDITION_H_INCLUDED
 
 #include "Arcadia/Ring1/Implementation/Configure.h"
+#include "Arcadia/Ring1/Implementation/Concurrency/Mutex.h"
 #include <stddef.h>
 
 /// @brief The type of return values of Arcadia_Concurrency_Condition functions.
@@ -49,10 +50,16 @@ Arcadia_Concurrency_Condition_uninitialize
     Arcadia_Concurrency_Condition* condition
   );
 
+/// @brief Atomically release the specified mutex and block on this condition.
+/// The mutex is re-acquired before this function returns.
+/// @param condition A pointer to this condition.
+/// @param mutex A pointer to the mutex. The calling thread must hold that mutex exactly once.
+/// @remarks Spurious wake-ups are possible. Callers re-check their predicate in a loop.
 Arcadia_Concurrency_Condition_Result
 Arcadia_Concurrency_Condition_wait
   (
-    Arcadia_Concurrency_Condition* condition
+    Arcadia_Concurrency_Condition* condition,
+    Arcadia_Concurrency_Mutex* mutex
   );
 
 Arcadia_Concurrency_Condition_Result
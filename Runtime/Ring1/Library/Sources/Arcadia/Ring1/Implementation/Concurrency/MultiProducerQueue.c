@@ -0,0 +1,242 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#define ARCADIA_RING1_MODULE (1)
+#include "Arcadia/Ring1/Implementation/Concurrency/MultiProducerQueue.h"
+
+#include "Arcadia/Ring1/Include.h"
+#include "Arcadia/Ring1/Implementation/Concurrency/Atomic.h"
+#include "Arcadia/Ring1/Implementation/Concurrency/NativeThread.h"
+
+typedef struct Cell Cell;
+
+// A cell of the ring buffer.
+// If sequence equals the position p of the cell, the cell is free for the producer enqueueing at p.
+// If sequence equals p + 1, the cell is occupied by the element enqueued at p.
+// When the consumer dequeues the element at p, it sets sequence to p + capacity, freeing the cell for the producer enqueueing at p + capacity.
+struct Cell {
+  uint32_t volatile sequence;
+  void* element;
+};
+
+// The positions are 32 bit indices which wrap around.
+// Two positions are compared by the sign of their difference, hence the capacity must not exceed 2^30.
+#define MaximumCapacity (1 << 30)
+
+struct Arcadia_MultiProducerQueue {
+  Cell* cells;
+  uint32_t capacity;
+  Arcadia_MultiProducerQueue_OverflowPolicy overflowPolicy;
+  // The position at which the next element is enqueued. Accessed atomically.
+  uint32_t volatile tail;
+  // The position at which the next element is dequeued. Only accessed by the consumer.
+  uint32_t head;
+  // The number of rejected elements and waits. Accessed atomically. These counters wrap around.
+  uint32_t volatile numberOfRejectedElements;
+  uint32_t volatile numberOfWaits;
+  // The number of dequeued elements and the high water mark. Only accessed by the consumer.
+  Arcadia_Natural64Value numberOfDequeuedElements;
+  Arcadia_SizeValue highWaterMark;
+};
+
+Arcadia_MultiProducerQueue*
+Arcadia_MultiProducerQueue_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SizeValue capacity,
+    Arcadia_MultiProducerQueue_OverflowPolicy overflowPolicy
+  )
+{
+  if (0 == capacity || capacity > MaximumCapacity) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  if (Arcadia_MultiProducerQueue_OverflowPolicy_Reject != overflowPolicy && Arcadia_MultiProducerQueue_OverflowPolicy_Wait != overflowPolicy) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  uint32_t powerOfTwoCapacity = 1;
+  while (powerOfTwoCapacity < capacity) {
+    powerOfTwoCapacity *= 2;
+  }
+  Arcadia_MultiProducerQueue* self = Arcadia_Memory_allocateUnmanaged(thread, sizeof(Arcadia_MultiProducerQueue));
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    self->cells = Arcadia_Memory_allocateUnmanaged(thread, sizeof(Cell) * powerOfTwoCapacity);
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Memory_deallocateUnmanaged(thread, self);
+    Arcadia_Thread_jump(thread);
+  }
+  for (uint32_t i = 0; i < powerOfTwoCapacity; ++i) {
+    self->cells[i].sequence = i;
+    self->cells[i].element = NULL;
+  }
+  self->capacity = powerOfTwoCapacity;
+  self->overflowPolicy = overflowPolicy;
+  self->tail = 0;
+  self->head = 0;
+  self->numberOfRejectedElements = 0;
+  self->numberOfWaits = 0;
+  self->numberOfDequeuedElements = 0;
+  self->highWaterMark = 0;
+  // Publish the initialized queue to other threads.
+  Arcadia_Memory_atomicStore32(&self->tail, 0);
+  return self;
+}
+
+void
+Arcadia_MultiProducerQueue_destroy
+  (
+    Arcadia_Thread* thread,
+    Arcadia_MultiProducerQueue* self
+  )
+{
+  Arcadia_Memory_deallocateUnmanaged(thread, self->cells);
+  self->cells = NULL;
+  Arcadia_Memory_deallocateUnmanaged(thread, self);
+}
+
+Arcadia_SizeValue
+Arcadia_MultiProducerQueue_getCapacity
+  (
+    Arcadia_Thread* thread,
+    Arcadia_MultiProducerQueue* self
+  )
+{ return self->capacity; }
+
+Arcadia_BooleanValue
+Arcadia_MultiProducerQueue_enqueue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_MultiProducerQueue* self,
+    void* element
+  )
+{
+  if (!element) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  uint32_t mask = self->capacity - 1;
+  uint32_t position = Arcadia_Memory_atomicLoad32(&self->tail);
+  Cell* cell;
+  while (Arcadia_BooleanValue_True) {
+    cell = &self->cells[position & mask];
+    int32_t difference = (int32_t)(Arcadia_Memory_atomicLoad32(&cell->sequence) - position);
+    if (0 == difference) {
+      // The cell is free. Try to reserve it.
+      uint32_t oldPosition = Arcadia_Memory_atomicCompareAndSwap32(&self->tail, position, position + 1);
+      if (oldPosition == position) {
+        break;
+      }
+      position = oldPosition;
+    } else if (difference < 0) {
+      // The cell is still occupied by the element enqueued at position - capacity: The queue is full.
+      if (Arcadia_MultiProducerQueue_OverflowPolicy_Reject == self->overflowPolicy) {
+        Arcadia_Memory_atomicAdd32(&self->numberOfRejectedElements, 1);
+        return Arcadia_BooleanValue_False;
+      }
+      Arcadia_Memory_atomicAdd32(&self->numberOfWaits, 1);
+      // The caller keeps the element alive across this safepoint (see Arcadia_MultiProducerQueue_enqueue).
+      Arcadia_Thread_safepoint(thread);
+      // Let the consumer run.
+      Arcadia_Concurrency_NativeThread_yield();
+      position = Arcadia_Memory_atomicLoad32(&self->tail);
+    } else {
+      // Another producer reserved the cell.
+      position = Arcadia_Memory_atomicLoad32(&self->tail);
+    }
+  }
+  cell->element = element;
+  // Publish the element to the consumer.
+  Arcadia_Memory_atomicStore32(&cell->sequence, position + 1);
+  return Arcadia_BooleanValue_True;
+}
+
+void*
+Arcadia_MultiProducerQueue_dequeue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_MultiProducerQueue* self
+  )
+{
+  void* element = NULL;
+  return Arcadia_MultiProducerQueue_dequeueBatch(thread, self, &element, 1) ? element : NULL;
+}
+
+Arcadia_SizeValue
+Arcadia_MultiProducerQueue_dequeueBatch
+  (
+    Arcadia_Thread* thread,
+    Arcadia_MultiProducerQueue* self,
+    void** elements,
+    Arcadia_SizeValue maximumNumberOfElements
+  )
+{
+  uint32_t mask = self->capacity - 1;
+  uint32_t position = self->head;
+  // The number of reserved cells is an upper bound of the number of elements.
+  Arcadia_SizeValue size = Arcadia_Memory_atomicLoad32(&self->tail) - position;
+  if (size > self->highWaterMark) {
+    self->highWaterMark = size;
+  }
+  Arcadia_SizeValue numberOfElements = 0;
+  while (numberOfElements < maximumNumberOfElements) {
+    Cell* cell = &self->cells[position & mask];
+    if (Arcadia_Memory_atomicLoad32(&cell->sequence) != position + 1) {
+      // The cell is empty or a producer reserved the cell but has not yet published its element.
+      break;
+    }
+    elements[numberOfElements++] = cell->element;
+    cell->element = NULL;
+    // Free the cell for the producer enqueueing at position + capacity.
+    Arcadia_Memory_atomicStore32(&cell->sequence, position + self->capacity);
+    position++;
+  }
+  self->head = position;
+  self->numberOfDequeuedElements += numberOfElements;
+  return numberOfElements;
+}
+
+void
+Arcadia_MultiProducerQueue_visit
+  (
+    Arcadia_Thread* thread,
+    Arcadia_MultiProducerQueue* self,
+    void (*procedure)(Arcadia_Thread* thread, void* element)
+  )
+{
+  for (uint32_t i = 0; i < self->capacity; ++i) {
+    if (self->cells[i].element) {
+      procedure(thread, self->cells[i].element);
+    }
+  }
+}
+
+void
+Arcadia_MultiProducerQueue_getStatistics
+  (
+    Arcadia_Thread* thread,
+    Arcadia_MultiProducerQueue* self,
+    Arcadia_MultiProducerQueue_Statistics* statistics
+  )
+{
+  statistics->numberOfDequeuedElements = self->numberOfDequeuedElements;
+  statistics->numberOfRejectedElements = Arcadia_Memory_atomicLoad32(&self->numberOfRejectedElements);
+  statistics->numberOfWaits = Arcadia_Memory_atomicLoad32(&self->numberOfWaits);
+  statistics->highWaterMark = self->highWaterMark;
+}
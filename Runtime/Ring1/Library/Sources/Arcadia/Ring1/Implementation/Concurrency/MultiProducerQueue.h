@@ -0,0 +1,172 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_RING1_IMPLEMENTATION_CONCURRENCY_MULTIPRODUCERQUEUE_H_INCLUDED)
+#define ARCADIA_RING1_IMPLEMENTATION_CONCURRENCY_MULTIPRODUCERQUEUE_H_INCLUDED
+
+#if !defined(ARCADIA_RING1_MODULE)
+  #error("do not include directly, include `Arcadia/Ring1/Include.h` instead")
+#endif
+
+#include "Arcadia/Ring1/Implementation/Boolean.h"
+#include "Arcadia/Ring1/Implementation/Natural64.h"
+#include "Arcadia/Ring1/Implementation/Size.h"
+#include "Arcadia/Ring1/Implementation/Thread.h"
+
+/// @brief A bounded multi-producer single-consumer queue of non-null pointers.
+/// Any number of threads can enqueue elements concurrently without locking.
+/// Exactly one thread (the consumer) dequeues elements.
+/// The elements enqueued by one thread are dequeued in the order in which that thread enqueued them.
+/// @remarks
+/// The elements are stored in a ring buffer with a power of two capacity.
+/// Each cell of the ring buffer stores a sequence number which tells producers and the consumer if the cell is free or occupied.
+/// A producer reserves a cell by a compare-and-swap on the tail index, the consumer owns the head index.
+typedef struct Arcadia_MultiProducerQueue Arcadia_MultiProducerQueue;
+
+/// @brief What a producer does if the queue is full.
+typedef enum Arcadia_MultiProducerQueue_OverflowPolicy {
+  /// The element is not enqueued and Arcadia_MultiProducerQueue_enqueue returns Arcadia_BooleanValue_False.
+  Arcadia_MultiProducerQueue_OverflowPolicy_Reject,
+  /// The producer spins until the consumer dequeued an element.
+  /// The producer passes a safepoint in each iteration.
+  /// The consumer must not enqueue elements under this policy.
+  Arcadia_MultiProducerQueue_OverflowPolicy_Wait,
+} Arcadia_MultiProducerQueue_OverflowPolicy;
+
+/// @brief The statistics of a multi-producer single-consumer queue.
+typedef struct Arcadia_MultiProducerQueue_Statistics {
+  /// The number of elements dequeued.
+  Arcadia_Natural64Value numberOfDequeuedElements;
+  /// The number of elements rejected because the queue was full.
+  Arcadia_Natural64Value numberOfRejectedElements;
+  /// The number of times a producer found the queue full and waited.
+  Arcadia_Natural64Value numberOfWaits;
+  /// The greatest number of elements in the queue observed by the consumer.
+  Arcadia_SizeValue highWaterMark;
+} Arcadia_MultiProducerQueue_Statistics;
+
+/// @brief Create a multi-producer single-consumer queue.
+/// @param thread A pointer to the calling thread.
+/// @param capacity The capacity. Rounded up to the next power of two.
+/// @param overflowPolicy The overflow policy.
+/// @return A pointer to the queue.
+/// @error Arcadia_Status_ArgumentValueInvalid @a capacity is @a 0 or greater than @a 2^30
+/// @error Arcadia_Status_AllocationFailed an allocation failed
+Arcadia_MultiProducerQueue*
+Arcadia_MultiProducerQueue_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SizeValue capacity,
+    Arcadia_MultiProducerQueue_OverflowPolicy overflowPolicy
+  );
+
+/// @brief Destroy a multi-producer single-consumer queue.
+/// @param thread A pointer to the calling thread.
+/// @param self A pointer to this queue.
+/// @remarks No thread may access the queue concurrently.
+void
+Arcadia_MultiProducerQueue_destroy
+  (
+    Arcadia_Thread* thread,
+    Arcadia_MultiProducerQueue* self
+  );
+
+/// @brief Get the capacity of this queue.
+/// @param thread A pointer to the calling thread.
+/// @param self A pointer to this queue.
+/// @return The capacity.
+Arcadia_SizeValue
+Arcadia_MultiProducerQueue_getCapacity
+  (
+    Arcadia_Thread* thread,
+    Arcadia_MultiProducerQueue* self
+  );
+
+/// @brief Enqueue an element.
+/// @param thread A pointer to the calling thread.
+/// @param self A pointer to this queue.
+/// @param element A pointer to the element.
+/// @return Arcadia_BooleanValue_True if the element was enqueued, Arcadia_BooleanValue_False if it was rejected.
+/// @remarks This function can be invoked concurrently by any number of threads.
+/// @remarks
+/// Under Arcadia_MultiProducerQueue_OverflowPolicy_Wait the producer passes safepoints while the element is neither in the queue nor reachable through it.
+/// If the element is a managed object, then the caller must keep it locked (see Arcadia_Object_lock) or on its value stack until this function returns.
+/// Once enqueued, the element is kept alive by the owner of the queue which visits it (see Arcadia_MultiProducerQueue_visit).
+/// @error Arcadia_Status_ArgumentValueInvalid @a element is a null pointer
+Arcadia_BooleanValue
+Arcadia_MultiProducerQueue_enqueue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_MultiProducerQueue* self,
+    void* element
+  );
+
+/// @brief Dequeue an element.
+/// @param thread A pointer to the calling thread.
+/// @param self A pointer to this queue.
+/// @return A pointer to the element if the queue is not empty, a null pointer otherwise.
+/// @remarks This function must only be invoked by the consumer.
+void*
+Arcadia_MultiProducerQueue_dequeue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_MultiProducerQueue* self
+  );
+
+/// @brief Dequeue up to the specified number of elements.
+/// @param thread A pointer to the calling thread.
+/// @param self A pointer to this queue.
+/// @param elements A pointer to an array of @a maximumNumberOfElements pointers receiving the elements.
+/// @param maximumNumberOfElements The maximum number of elements to dequeue.
+/// @return The number of elements dequeued.
+/// @remarks This function must only be invoked by the consumer.
+Arcadia_SizeValue
+Arcadia_MultiProducerQueue_dequeueBatch
+  (
+    Arcadia_Thread* thread,
+    Arcadia_MultiProducerQueue* self,
+    void** elements,
+    Arcadia_SizeValue maximumNumberOfElements
+  );
+
+/// @brief Invoke a procedure for each element in this queue.
+/// @param thread A pointer to the calling thread.
+/// @param self A pointer to this queue.
+/// @param procedure A pointer to the procedure.
+/// @remarks
+/// This function is intended to be invoked by visit callbacks of the garbage collector.
+/// No thread may enqueue or dequeue elements concurrently.
+void
+Arcadia_MultiProducerQueue_visit
+  (
+    Arcadia_Thread* thread,
+    Arcadia_MultiProducerQueue* self,
+    void (*procedure)(Arcadia_Thread* thread, void* element)
+  );
+
+/// @brief Get the statistics of this queue.
+/// @param thread A pointer to the calling thread.
+/// @param self A pointer to this queue.
+/// @param statistics A pointer to the statistics receiving the statistics.
+/// @remarks The statistics are a snapshot and may be outdated if producers are enqueueing elements concurrently.
+void
+Arcadia_MultiProducerQueue_getStatistics
+  (
+    Arcadia_Thread* thread,
+    Arcadia_MultiProducerQueue* self,
+    Arcadia_MultiProducerQueue_Statistics* statistics
+  );
+
+#endif // ARCADIA_RING1_IMPLEMENTATION_CONCURRENCY_MULTIPRODUCERQUEUE_H_INCLUDED
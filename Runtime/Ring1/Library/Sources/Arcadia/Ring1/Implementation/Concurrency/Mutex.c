@@ -13,35 +13,12 @@
 // REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
 // OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
 
-#include "Arcadia/Ring1/Implementation/Concurrency/Mutex.h"
+#include "Arcadia/Ring1/Implementation/Concurrency/Mutex.module.h"
 
 #include "Arcadia/Ring1/Implementation/Concurrency/CompareAndSwap.h"
 #include <malloc.h>
 
-#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
-    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
-    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
-  #include <pthread.h>
-#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
-  #define WIN32_LEAN_AND_MEAN
-  #include <Windows.h>
-#else
-  #error("environment not (yet) supported")
-#endif
-
-typedef struct Impl Impl;
-
-struct Impl {
-#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
-    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
-    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
-  pthread_mutex_t mutex;
-#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
-  HANDLE mutex;
-#else
-  #error("environment not (yet) supported")
-#endif
-};
+typedef Arcadia_Concurrency_MutexImpl Impl;
 
 Arcadia_Concurrency_Mutex_Result
 Arcadia_Concurrency_Mutex_initialize
@@ -70,12 +47,7 @@ Arcadia_Concurrency_Mutex_initialize
     return Arcadia_Concurrency_Mutex_Result_EnvironmentFailed;
   }
 #elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
-  pimpl->mutex = CreateMutex(NULL, FALSE, NULL);
-  if (!pimpl->mutex) {
-    free(pimpl);
-    pimpl = NULL;
-    return Arcadia_Concurrency_Mutex_Result_EnvironmentFailed;
-  }
+  InitializeCriticalSection(&pimpl->mutex);
 #else
   #error("operating system not (yet) supported")
 #endif
@@ -86,8 +58,7 @@ Arcadia_Concurrency_Mutex_initialize
       Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
     pthread_mutex_destroy(&pimpl->mutex);
   #elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
-    CloseHandle(pimpl->mutex);
-    pimpl->mutex = NULL;
+    DeleteCriticalSection(&pimpl->mutex);
   #else
     #error("operating system not (yet) supported")
   #endif
@@ -114,8 +85,7 @@ Arcadia_Concurrency_Mutex_uninitialize
       Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
     pthread_mutex_destroy(&pimpl->mutex);
   #elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
-    CloseHandle(pimpl->mutex);
-    pimpl->mutex = NULL;
+    DeleteCriticalSection(&pimpl->mutex);
   #else
     #error("operating system not (yet) supported")
   #endif
@@ -131,9 +101,21 @@ Arcadia_Concurrency_Mutex_lock
     Arcadia_Concurrency_Mutex* mutex
   )
 {
-  if (!mutex) {
+  if (!mutex || !mutex->pimpl) {
     return Arcadia_Concurrency_Mutex_Result_ArgumentInvalid;
   }
+  Impl* pimpl = (Impl*)mutex->pimpl;
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  if (pthread_mutex_lock(&pimpl->mutex)) {
+    return Arcadia_Concurrency_Mutex_Result_EnvironmentFailed;
+  }
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  EnterCriticalSection(&pimpl->mutex);
+#else
+  #error("operating system not (yet) supported")
+#endif
   return Arcadia_Concurrency_Mutex_Result_Success;
 }
 
@@ -143,8 +125,20 @@ Arcadia_Concurrency_Mutex_unlock
     Arcadia_Concurrency_Mutex* mutex
   )
 {
-  if (!mutex) {
+  if (!mutex || !mutex->pimpl) {
     return Arcadia_Concurrency_Mutex_Result_ArgumentInvalid;
   }
+  Impl* pimpl = (Impl*)mutex->pimpl;
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  if (pthread_mutex_unlock(&pimpl->mutex)) {
+    return Arcadia_Concurrency_Mutex_Result_EnvironmentFailed;
+  }
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  LeaveCriticalSection(&pimpl->mutex);
+#else
+  #error("operating system not (yet) supported")
+#endif
   return Arcadia_Concurrency_Mutex_Result_Success;
 }
@@ -0,0 +1,53 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_RING1_CONCURRENCY_MUTEX_MODULE_H_INCLUDED)
+#define ARCADIA_RING1_CONCURRENCY_MUTEX_MODULE_H_INCLUDED
+
+#if defined(ARCADIA_RING1_EXPORT)
+  #error("this file is not supposed to be exported")
+#endif
+
+#include "Arcadia/Ring1/Implementation/Concurrency/Mutex.h"
+
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  #include <pthread.h>
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  #define WIN32_LEAN_AND_MEAN
+  #include <Windows.h>
+#else
+  #error("environment not (yet) supported")
+#endif
+
+// The implementation of a mutex.
+// Shared with the implementation of conditions which must release and re-acquire the mutex when waiting.
+typedef struct Arcadia_Concurrency_MutexImpl Arcadia_Concurrency_MutexImpl;
+
+struct Arcadia_Concurrency_MutexImpl {
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  pthread_mutex_t mutex;
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  // A critical section is recursive and can be used with condition variables.
+  CRITICAL_SECTION mutex;
+#else
+  #error("environment not (yet) supported")
+#endif
+};
+
+#endif // ARCADIA_RING1_CONCURRENCY_MUTEX_MODULE_H_INCLUDED
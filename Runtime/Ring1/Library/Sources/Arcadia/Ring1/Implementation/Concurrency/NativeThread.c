@@ -0,0 +1,175 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/Ring1/Implementation/Concurrency/NativeThread.h"
+
+#include "Arcadia/Ring1/Implementation/Concurrency/CompareAndSwap.h"
+#include <malloc.h>
+
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  #include <pthread.h>
+  #include <sched.h>
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  #define WIN32_LEAN_AND_MEAN
+  #include <Windows.h>
+#else
+  #error("environment not (yet) supported")
+#endif
+
+typedef struct Impl Impl;
+
+struct Impl {
+  Arcadia_Concurrency_NativeThread_Procedure* procedure;
+  void* argument;
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  pthread_t thread;
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  HANDLE thread;
+#else
+  #error("environment not (yet) supported")
+#endif
+};
+
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+
+static void*
+entry
+  (
+    void* argument
+  )
+{
+  Impl* pimpl = (Impl*)argument;
+  pimpl->procedure(pimpl->argument);
+  return NULL;
+}
+
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+
+static DWORD WINAPI
+entry
+  (
+    LPVOID argument
+  )
+{
+  Impl* pimpl = (Impl*)argument;
+  pimpl->procedure(pimpl->argument);
+  return 0;
+}
+
+#else
+  #error("environment not (yet) supported")
+#endif
+
+Arcadia_Concurrency_NativeThread_Result
+Arcadia_Concurrency_NativeThread_initialize
+  (
+    Arcadia_Concurrency_NativeThread* nativeThread,
+    Arcadia_Concurrency_NativeThread_Procedure* procedure,
+    void* argument
+  )
+{
+  if (!nativeThread || !procedure) {
+    return Arcadia_Concurrency_NativeThread_Result_ArgumentInvalid;
+  }
+  Impl* pimpl = malloc(sizeof(Impl));
+  if (!pimpl) {
+    return Arcadia_Concurrency_NativeThread_Result_AllocationFailed;
+  }
+  pimpl->procedure = procedure;
+  pimpl->argument = argument;
+  // Publish the implementation before the thread is started such that a concurrent initialization fails early.
+  Impl* oldValue = Arcadia_Memory_compareAndSwap(&nativeThread->pimpl, NULL, pimpl);
+  if (oldValue) {
+    free(pimpl);
+    pimpl = NULL;
+    return Arcadia_Concurrency_NativeThread_Result_Initialized;
+  }
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  if (pthread_create(&pimpl->thread, NULL, &entry, pimpl)) {
+    nativeThread->pimpl = NULL;
+    free(pimpl);
+    pimpl = NULL;
+    return Arcadia_Concurrency_NativeThread_Result_EnvironmentFailed;
+  }
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  pimpl->thread = CreateThread(NULL, 0, &entry, pimpl, 0, NULL);
+  if (!pimpl->thread) {
+    nativeThread->pimpl = NULL;
+    free(pimpl);
+    pimpl = NULL;
+    return Arcadia_Concurrency_NativeThread_Result_EnvironmentFailed;
+  }
+#else
+  #error("operating system not (yet) supported")
+#endif
+  return Arcadia_Concurrency_NativeThread_Result_Success;
+}
+
+Arcadia_Concurrency_NativeThread_Result
+Arcadia_Concurrency_NativeThread_join
+  (
+    Arcadia_Concurrency_NativeThread* nativeThread
+  )
+{
+  if (!nativeThread) {
+    return Arcadia_Concurrency_NativeThread_Result_ArgumentInvalid;
+  }
+  Impl* pimpl = Arcadia_Memory_compareAndSwap(&nativeThread->pimpl, nativeThread->pimpl, NULL);
+  if (!pimpl) {
+    return Arcadia_Concurrency_NativeThread_Result_ArgumentInvalid;
+  }
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  if (pthread_join(pimpl->thread, NULL)) {
+    free(pimpl);
+    pimpl = NULL;
+    return Arcadia_Concurrency_NativeThread_Result_EnvironmentFailed;
+  }
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  WaitForSingleObject(pimpl->thread, INFINITE);
+  CloseHandle(pimpl->thread);
+  pimpl->thread = NULL;
+#else
+  #error("operating system not (yet) supported")
+#endif
+  free(pimpl);
+  pimpl = NULL;
+  return Arcadia_Concurrency_NativeThread_Result_Success;
+}
+
+void
+Arcadia_Concurrency_NativeThread_yield
+  (
+  )
+{
+#if Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem  || \
+    Arcadia_Configuration_OperatingSystem_Cygwin == Arcadia_Configuration_OperatingSystem || \
+    Arcadia_Configuration_OperatingSystem_Macos == Arcadia_Configuration_OperatingSystem
+  sched_yield();
+#elif Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  SwitchToThread();
+#else
+  #error("operating system not (yet) supported")
+#endif
+}
@@ -0,0 +1,72 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_RING1_CONCURRENCY_NATIVETHREAD_H_INCLUDED)
+#define ARCADIA_RING1_CONCURRENCY_NATIVETHREAD_H_INCLUDED
+
+#include "Arcadia/Ring1/Implementation/Configure.h"
+#include <stddef.h>
+
+/// @brief The type of return values of Arcadia_Concurrency_NativeThread functions.
+typedef enum Arcadia_Concurrency_NativeThread_Result Arcadia_Concurrency_NativeThread_Result;
+
+/// @brief A "native thread" object to be embedded into structs or to be allocated on the stack or the heap.
+/// A native thread is an operating system thread.
+/// It is not known to the process until it attaches itself via Arcadia_Process_attachThread.
+typedef struct Arcadia_Concurrency_NativeThread Arcadia_Concurrency_NativeThread;
+
+/// @brief The type of the procedure executed by a native thread.
+typedef void (Arcadia_Concurrency_NativeThread_Procedure)(void* argument);
+
+enum Arcadia_Concurrency_NativeThread_Result {
+  Arcadia_Concurrency_NativeThread_Result_Success,
+  Arcadia_Concurrency_NativeThread_Result_ArgumentInvalid,
+  Arcadia_Concurrency_NativeThread_Result_AllocationFailed,
+  Arcadia_Concurrency_NativeThread_Result_EnvironmentFailed,
+  Arcadia_Concurrency_NativeThread_Result_Initialized,
+};
+
+struct Arcadia_Concurrency_NativeThread {
+  void* pimpl;
+}; // struct Arcadia_Concurrency_NativeThread
+
+/// @brief Start a native thread executing the specified procedure.
+/// @param nativeThread A pointer to this native thread.
+/// @param procedure A pointer to the procedure.
+/// @param argument The argument passed to the procedure.
+Arcadia_Concurrency_NativeThread_Result
+Arcadia_Concurrency_NativeThread_initialize
+  (
+    Arcadia_Concurrency_NativeThread* nativeThread,
+    Arcadia_Concurrency_NativeThread_Procedure* procedure,
+    void* argument
+  );
+
+/// @brief Wait for the procedure of this native thread to return and release the native thread.
+/// @param nativeThread A pointer to this native thread.
+Arcadia_Concurrency_NativeThread_Result
+Arcadia_Concurrency_NativeThread_join
+  (
+    Arcadia_Concurrency_NativeThread* nativeThread
+  );
+
+/// @brief Offer the remainder of the time slice of the calling thread to other threads.
+/// To be called by threads spinning on a condition another thread must establish.
+void
+Arcadia_Concurrency_NativeThread_yield
+  (
+  );
+
+#endif // ARCADIA_RING1_CONCURRENCY_NATIVETHREAD_H_INCLUDED
@@ -0,0 +1,519 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#define ARCADIA_RING1_MODULE (1)
+#include "Arcadia/Ring1/Implementation/Concurrency/ThreadPool.h"
+
+#include "Arcadia/Ring1/Include.h"
+#include "Arcadia/Ring1/Implementation/Concurrency/Atomic.h"
+#include "Arcadia/Ring1/Implementation/Concurrency/Condition.h"
+#include "Arcadia/Ring1/Implementation/Concurrency/Mutex.h"
+#include "Arcadia/Ring1/Implementation/Concurrency/NativeThread.h"
+#include "Arcadia/Ring1/Implementation/getNumberOfCores.h"
+
+typedef struct Deque Deque;
+typedef struct Worker Worker;
+
+struct Arcadia_ThreadPool_Task {
+  Arcadia_ThreadPool_TaskProcedure* procedure;
+  void* context;
+  // 1 if the task completed, 0 otherwise. Accessed atomically.
+  uint32_t volatile completed;
+  // The status of the task if it completed.
+  Arcadia_Status status;
+};
+
+// A double-ended queue of tasks.
+// The owner pushes and pops at the bottom, thieves steal from the top.
+// The tasks are stored in a ring buffer with a power of two capacity.
+// top and bottom are increasing indices, the number of tasks is bottom - top.
+struct Deque {
+  Arcadia_Concurrency_Mutex mutex;
+  Arcadia_ThreadPool_Task** elements;
+  Arcadia_SizeValue capacity;
+  Arcadia_SizeValue top;
+  Arcadia_SizeValue bottom;
+};
+
+struct Worker {
+  Arcadia_ThreadPool* pool;
+  Arcadia_SizeValue index;
+  Deque deque;
+  Arcadia_Concurrency_NativeThread nativeThread;
+};
+
+struct Arcadia_ThreadPool {
+  Arcadia_Process* process;
+  Worker* workers;
+  Arcadia_SizeValue numberOfWorkers;
+  // The deque of tasks forked by threads which are not workers of this pool.
+  Deque shared;
+  // Guards sleeping and waking up.
+  Arcadia_Concurrency_Mutex mutex;
+  // Signaled if a task was forked while workers were sleeping or if the pool shuts down.
+  Arcadia_Concurrency_Condition taskForked;
+  // Signaled if a task completed while threads were waiting for tasks to complete.
+  Arcadia_Concurrency_Condition taskCompleted;
+  // The number of sleeping workers. Accessed atomically.
+  uint32_t volatile numberOfSleepingWorkers;
+  // The number of threads waiting for tasks to complete. Accessed atomically.
+  uint32_t volatile numberOfJoiningThreads;
+  // Arcadia_BooleanValue_True if the workers shall terminate. Guarded by the mutex.
+  Arcadia_BooleanValue shutdown;
+};
+
+// The worker executed by the calling operating system thread if any.
+static Arcadia_ThreadLocal() Worker* g_currentWorker = NULL;
+
+#define Deque_InitialCapacity (32)
+
+static Arcadia_BooleanValue
+Deque_initialize
+  (
+    Arcadia_Thread* thread,
+    Deque* self
+  )
+{
+  self->mutex.pimpl = NULL;
+  if (Arcadia_Concurrency_Mutex_initialize(&self->mutex)) {
+    return Arcadia_BooleanValue_False;
+  }
+  self->elements = NULL;
+  self->capacity = 0;
+  self->top = 0;
+  self->bottom = 0;
+  return Arcadia_BooleanValue_True;
+}
+
+static void
+Deque_uninitialize
+  (
+    Arcadia_Thread* thread,
+    Deque* self
+  )
+{
+  if (self->elements) {
+    Arcadia_Memory_deallocateUnmanaged(thread, self->elements);
+    self->elements = NULL;
+  }
+  Arcadia_Concurrency_Mutex_uninitialize(&self->mutex);
+}
+
+// Must be invoked while holding the mutex of the deque.
+static Arcadia_BooleanValue
+Deque_grow
+  (
+    Arcadia_Thread* thread,
+    Deque* self
+  )
+{
+  Arcadia_SizeValue oldCapacity = self->capacity;
+  Arcadia_SizeValue newCapacity = oldCapacity ? oldCapacity * 2 : Deque_InitialCapacity;
+  if (newCapacity < oldCapacity || newCapacity > Arcadia_SizeValue_Maximum / sizeof(Arcadia_ThreadPool_Task*)) {
+    return Arcadia_BooleanValue_False;
+  }
+  Arcadia_ThreadPool_Task** newElements = NULL;
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    newElements = Arcadia_Memory_allocateUnmanaged(thread, sizeof(Arcadia_ThreadPool_Task*) * newCapacity);
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    return Arcadia_BooleanValue_False;
+  }
+  for (Arcadia_SizeValue i = self->top; i != self->bottom; ++i) {
+    newElements[i & (newCapacity - 1)] = self->elements[i & (oldCapacity - 1)];
+  }
+  if (self->elements) {
+    Arcadia_Memory_deallocateUnmanaged(thread, self->elements);
+  }
+  self->elements = newElements;
+  self->capacity = newCapacity;
+  return Arcadia_BooleanValue_True;
+}
+
+static void
+Deque_pushBottom
+  (
+    Arcadia_Thread* thread,
+    Deque* self,
+    Arcadia_ThreadPool_Task* task
+  )
+{
+  Arcadia_Concurrency_Mutex_lock(&self->mutex);
+  if (self->bottom - self->top == self->capacity) {
+    if (!Deque_grow(thread, self)) {
+      Arcadia_Concurrency_Mutex_unlock(&self->mutex);
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_AllocationFailed);
+      Arcadia_Thread_jump(thread);
+    }
+  }
+  self->elements[self->bottom & (self->capacity - 1)] = task;
+  self->bottom++;
+  Arcadia_Concurrency_Mutex_unlock(&self->mutex);
+}
+
+static Arcadia_ThreadPool_Task*
+Deque_popBottom
+  (
+    Deque* self
+  )
+{
+  Arcadia_ThreadPool_Task* task = NULL;
+  Arcadia_Concurrency_Mutex_lock(&self->mutex);
+  if (self->bottom != self->top) {
+    self->bottom--;
+    task = self->elements[self->bottom & (self->capacity - 1)];
+  }
+  Arcadia_Concurrency_Mutex_unlock(&self->mutex);
+  return task;
+}
+
+static Arcadia_ThreadPool_Task*
+Deque_stealTop
+  (
+    Deque* self
+  )
+{
+  Arcadia_ThreadPool_Task* task = NULL;
+  Arcadia_Concurrency_Mutex_lock(&self->mutex);
+  if (self->bottom != self->top) {
+    task = self->elements[self->top & (self->capacity - 1)];
+    self->top++;
+  }
+  Arcadia_Concurrency_Mutex_unlock(&self->mutex);
+  return task;
+}
+
+// Find a pending task.
+// A worker first pops from its own deque.
+// Then the shared deque and the deques of the other workers are tried.
+static Arcadia_ThreadPool_Task*
+findTask
+  (
+    Arcadia_ThreadPool* pool,
+    Worker* worker
+  )
+{
+  Arcadia_ThreadPool_Task* task = NULL;
+  if (worker) {
+    task = Deque_popBottom(&worker->deque);
+    if (task) {
+      return task;
+    }
+  }
+  task = Deque_stealTop(&pool->shared);
+  if (task) {
+    return task;
+  }
+  Arcadia_SizeValue start = worker ? worker->index + 1 : 0;
+  for (Arcadia_SizeValue i = 0, n = pool->numberOfWorkers; i < n; ++i) {
+    Worker* victim = &pool->workers[(start + i) % n];
+    if (victim != worker) {
+      task = Deque_stealTop(&victim->deque);
+      if (task) {
+        return task;
+      }
+    }
+  }
+  return NULL;
+}
+
+static void
+runTask
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ThreadPool* pool,
+    Arcadia_ThreadPool_Task* task
+  )
+{
+  Arcadia_SizeValue stackSize = Arcadia_ValueStack_getSize(thread);
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    task->procedure(thread, task->context);
+    Arcadia_Thread_popJumpTarget(thread);
+    task->status = Arcadia_Status_Success;
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    task->status = Arcadia_Thread_getStatus(thread);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+  // Remove the values the task left on the stack (e.g., if it raised an error).
+  Arcadia_SizeValue newStackSize = Arcadia_ValueStack_getSize(thread);
+  if (newStackSize > stackSize) {
+    Arcadia_ValueStack_popValues(thread, newStackSize - stackSize);
+  }
+  Arcadia_Memory_atomicExchange32(&task->completed, 1);
+  if (Arcadia_Memory_atomicLoad32(&pool->numberOfJoiningThreads)) {
+    Arcadia_Concurrency_Mutex_lock(&pool->mutex);
+    Arcadia_Concurrency_Condition_signalAll(&pool->taskCompleted);
+    Arcadia_Concurrency_Mutex_unlock(&pool->mutex);
+  }
+}
+
+static void
+workerProcedure
+  (
+    void* argument
+  )
+{
+  Worker* worker = (Worker*)argument;
+  Arcadia_ThreadPool* pool = worker->pool;
+  Arcadia_Thread* thread = NULL;
+  if (Arcadia_Process_attachThread(pool->process, &thread)) {
+    // The pool remains operational as long as threads join tasks.
+    Arcadia_logf(Arcadia_LogFlags_Error, "%s:%d: %s failed\n", __FILE__, __LINE__, "Arcadia_Process_attachThread");
+    return;
+  }
+  g_currentWorker = worker;
+  while (true) {
+    Arcadia_ThreadPool_Task* task = findTask(pool, worker);
+    if (!task) {
+      Arcadia_BooleanValue shutdown = Arcadia_BooleanValue_False;
+      Arcadia_Thread_enterSafeRegion(thread);
+      Arcadia_Concurrency_Mutex_lock(&pool->mutex);
+      Arcadia_Memory_atomicAdd32(&pool->numberOfSleepingWorkers, 1);
+      // A task forked after the increment is either found here or its fork signals the condition.
+      while (!(task = findTask(pool, worker)) && !pool->shutdown) {
+        Arcadia_Concurrency_Condition_wait(&pool->taskForked, &pool->mutex);
+      }
+      Arcadia_Memory_atomicAdd32(&pool->numberOfSleepingWorkers, (uint32_t)-1);
+      shutdown = pool->shutdown;
+      Arcadia_Concurrency_Mutex_unlock(&pool->mutex);
+      Arcadia_Thread_leaveSafeRegion(thread);
+      if (!task && shutdown) {
+        break;
+      }
+    }
+    runTask(thread, pool, task);
+    Arcadia_Thread_safepoint(thread);
+  }
+  g_currentWorker = NULL;
+  if (Arcadia_Process_detachThread(pool->process, thread)) {
+    Arcadia_logf(Arcadia_LogFlags_Error, "%s:%d: %s failed\n", __FILE__, __LINE__, "Arcadia_Process_detachThread");
+  }
+}
+
+static void
+shutdownWorkers
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ThreadPool* self,
+    Arcadia_SizeValue numberOfStartedWorkers
+  )
+{
+  Arcadia_Concurrency_Mutex_lock(&self->mutex);
+  self->shutdown = Arcadia_BooleanValue_True;
+  Arcadia_Concurrency_Condition_signalAll(&self->taskForked);
+  Arcadia_Concurrency_Mutex_unlock(&self->mutex);
+  // The workers might collect while this thread waits for them.
+  Arcadia_Thread_enterSafeRegion(thread);
+  for (Arcadia_SizeValue i = 0; i < numberOfStartedWorkers; ++i) {
+    Arcadia_Concurrency_NativeThread_join(&self->workers[i].nativeThread);
+  }
+  Arcadia_Thread_leaveSafeRegion(thread);
+}
+
+static void
+uninitializePool
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ThreadPool* self,
+    Arcadia_SizeValue numberOfInitializedWorkers
+  )
+{
+  for (Arcadia_SizeValue i = numberOfInitializedWorkers; i > 0; --i) {
+    Deque_uninitialize(thread, &self->workers[i - 1].deque);
+  }
+  Arcadia_Memory_deallocateUnmanaged(thread, self->workers);
+  Deque_uninitialize(thread, &self->shared);
+  Arcadia_Concurrency_Condition_uninitialize(&self->taskCompleted);
+  Arcadia_Concurrency_Condition_uninitialize(&self->taskForked);
+  Arcadia_Concurrency_Mutex_uninitialize(&self->mutex);
+  Arcadia_Memory_deallocateUnmanaged(thread, self);
+}
+
+Arcadia_ThreadPool*
+Arcadia_ThreadPool_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SizeValue numberOfWorkers
+  )
+{
+  if (0 == numberOfWorkers) {
+    Arcadia_Natural64Value numberOfCores = Arcadia_getNumberOfCores(thread);
+    numberOfWorkers = numberOfCores > Arcadia_SizeValue_Maximum ? Arcadia_SizeValue_Maximum : (Arcadia_SizeValue)numberOfCores;
+    if (0 == numberOfWorkers) {
+      numberOfWorkers = 1;
+    }
+  }
+  if (numberOfWorkers > Arcadia_SizeValue_Maximum / sizeof(Worker)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_AllocationFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_ThreadPool* self = Arcadia_Memory_allocateUnmanaged(thread, sizeof(Arcadia_ThreadPool));
+  self->process = Arcadia_Thread_getProcess(thread);
+  self->numberOfWorkers = numberOfWorkers;
+  self->numberOfSleepingWorkers = 0;
+  self->numberOfJoiningThreads = 0;
+  self->shutdown = Arcadia_BooleanValue_False;
+  self->mutex.pimpl = NULL;
+  self->taskForked.pimpl = NULL;
+  self->taskCompleted.pimpl = NULL;
+  self->workers = NULL;
+  if (Arcadia_Concurrency_Mutex_initialize(&self->mutex) ||
+      Arcadia_Concurrency_Condition_initialize(&self->taskForked) ||
+      Arcadia_Concurrency_Condition_initialize(&self->taskCompleted) ||
+      !Deque_initialize(thread, &self->shared)) {
+    Arcadia_Concurrency_Condition_uninitialize(&self->taskCompleted);
+    Arcadia_Concurrency_Condition_uninitialize(&self->taskForked);
+    Arcadia_Concurrency_Mutex_uninitialize(&self->mutex);
+    Arcadia_Memory_deallocateUnmanaged(thread, self);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    self->workers = Arcadia_Memory_allocateUnmanaged(thread, sizeof(Worker) * numberOfWorkers);
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Deque_uninitialize(thread, &self->shared);
+    Arcadia_Concurrency_Condition_uninitialize(&self->taskCompleted);
+    Arcadia_Concurrency_Condition_uninitialize(&self->taskForked);
+    Arcadia_Concurrency_Mutex_uninitialize(&self->mutex);
+    Arcadia_Memory_deallocateUnmanaged(thread, self);
+    Arcadia_Thread_jump(thread);
+  }
+  for (Arcadia_SizeValue i = 0; i < numberOfWorkers; ++i) {
+    Worker* worker = &self->workers[i];
+    worker->pool = self;
+    worker->index = i;
+    worker->nativeThread.pimpl = NULL;
+    if (!Deque_initialize(thread, &worker->deque)) {
+      uninitializePool(thread, self, i);
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+      Arcadia_Thread_jump(thread);
+    }
+  }
+  // The deques of all workers must be initialized before the first worker starts stealing.
+  for (Arcadia_SizeValue i = 0; i < numberOfWorkers; ++i) {
+    if (Arcadia_Concurrency_NativeThread_initialize(&self->workers[i].nativeThread, &workerProcedure, &self->workers[i])) {
+      shutdownWorkers(thread, self, i);
+      uninitializePool(thread, self, numberOfWorkers);
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+      Arcadia_Thread_jump(thread);
+    }
+  }
+  return self;
+}
+
+void
+Arcadia_ThreadPool_destroy
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ThreadPool* self
+  )
+{
+  shutdownWorkers(thread, self, self->numberOfWorkers);
+  uninitializePool(thread, self, self->numberOfWorkers);
+}
+
+Arcadia_SizeValue
+Arcadia_ThreadPool_getNumberOfWorkers
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ThreadPool* self
+  )
+{ return self->numberOfWorkers; }
+
+Arcadia_ThreadPool_Task*
+Arcadia_ThreadPool_fork
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ThreadPool* self,
+    Arcadia_ThreadPool_TaskProcedure* procedure,
+    void* context
+  )
+{
+  if (!procedure) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_ThreadPool_Task* task = Arcadia_Memory_allocateUnmanaged(thread, sizeof(Arcadia_ThreadPool_Task));
+  task->procedure = procedure;
+  task->context = context;
+  task->completed = 0;
+  task->status = Arcadia_Status_Success;
+  Worker* worker = g_currentWorker;
+  Deque* deque = (worker && worker->pool == self) ? &worker->deque : &self->shared;
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Deque_pushBottom(thread, deque, task);
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Memory_deallocateUnmanaged(thread, task);
+    Arcadia_Thread_jump(thread);
+  }
+  // Either a sleeping worker is observed here or the worker finds the task before it sleeps.
+  if (Arcadia_Memory_atomicLoad32(&self->numberOfSleepingWorkers)) {
+    Arcadia_Concurrency_Mutex_lock(&self->mutex);
+    Arcadia_Concurrency_Condition_signalOne(&self->taskForked);
+    Arcadia_Concurrency_Mutex_unlock(&self->mutex);
+  }
+  return task;
+}
+
+void
+Arcadia_ThreadPool_join
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ThreadPool* self,
+    Arcadia_ThreadPool_Task* task
+  )
+{
+  Worker* worker = g_currentWorker;
+  if (worker && worker->pool != self) {
+    worker = NULL;
+  }
+  while (!Arcadia_Memory_atomicLoad32(&task->completed)) {
+    Arcadia_ThreadPool_Task* other = findTask(self, worker);
+    if (other) {
+      runTask(thread, self, other);
+      continue;
+    }
+    // The task is executed by another thread.
+    Arcadia_Thread_enterSafeRegion(thread);
+    Arcadia_Concurrency_Mutex_lock(&self->mutex);
+    Arcadia_Memory_atomicAdd32(&self->numberOfJoiningThreads, 1);
+    while (!Arcadia_Memory_atomicLoad32(&task->completed)) {
+      Arcadia_Concurrency_Condition_wait(&self->taskCompleted, &self->mutex);
+    }
+    Arcadia_Memory_atomicAdd32(&self->numberOfJoiningThreads, (uint32_t)-1);
+    Arcadia_Concurrency_Mutex_unlock(&self->mutex);
+    Arcadia_Thread_leaveSafeRegion(thread);
+  }
+  Arcadia_Status status = task->status;
+  Arcadia_Memory_deallocateUnmanaged(thread, task);
+  if (status) {
+    Arcadia_Thread_setStatus(thread, status);
+    Arcadia_Thread_jump(thread);
+  }
+}
@@ -0,0 +1,113 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_RING1_IMPLEMENTATION_CONCURRENCY_THREADPOOL_H_INCLUDED)
+#define ARCADIA_RING1_IMPLEMENTATION_CONCURRENCY_THREADPOOL_H_INCLUDED
+
+#if !defined(ARCADIA_RING1_MODULE)
+  #error("do not include directly, include `Arcadia/Ring1/Include.h` instead")
+#endif
+
+#include "Arcadia/Ring1/Implementation/Size.h"
+#include "Arcadia/Ring1/Implementation/Thread.h"
+
+/// @brief A pool of worker threads executing tasks.
+/// Each worker owns a double-ended queue of tasks.
+/// A worker pushes tasks it forks to the bottom of its queue and pops tasks from the bottom of its queue.
+/// If its queue is empty, the worker steals tasks from the top of the queues of other workers.
+/// Tasks forked by threads which are not workers of the pool are pushed to a queue shared by all workers.
+/// @remarks
+/// The workers are threads attached to the process (see Arcadia_Process_attachThread).
+/// A worker passes a safepoint after each task and is in a safe region while it is idle.
+/// Objects passed to tasks must be locked or reachable from a value stack while the task is pending.
+typedef struct Arcadia_ThreadPool Arcadia_ThreadPool;
+
+/// @brief A task forked into a thread pool.
+typedef struct Arcadia_ThreadPool_Task Arcadia_ThreadPool_Task;
+
+/// @brief The type of the procedure of a task.
+/// @param thread A pointer to the thread executing the task.
+/// @param context The context pointer passed to Arcadia_ThreadPool_fork.
+typedef void (Arcadia_ThreadPool_TaskProcedure)(Arcadia_Thread* thread, void* context);
+
+/// @brief Create a thread pool.
+/// @param thread A pointer to the calling thread.
+/// @param numberOfWorkers The number of workers. If @a 0, the number of cores is used.
+/// @return A pointer to the thread pool.
+/// @error Arcadia_Status_AllocationFailed an allocation failed
+/// @error Arcadia_Status_EnvironmentFailed a worker could not be started
+Arcadia_ThreadPool*
+Arcadia_ThreadPool_create
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SizeValue numberOfWorkers
+  );
+
+/// @brief Destroy a thread pool.
+/// @param thread A pointer to the calling thread.
+/// @param self A pointer to this thread pool.
+/// @remarks Pending tasks are executed before the workers terminate. Tasks must be joined before the pool is destroyed.
+void
+Arcadia_ThreadPool_destroy
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ThreadPool* self
+  );
+
+/// @brief Get the number of workers of this thread pool.
+/// @param thread A pointer to the calling thread.
+/// @param self A pointer to this thread pool.
+/// @return The number of workers.
+Arcadia_SizeValue
+Arcadia_ThreadPool_getNumberOfWorkers
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ThreadPool* self
+  );
+
+/// @brief Fork a task.
+/// @param thread A pointer to the calling thread.
+/// @param self A pointer to this thread pool.
+/// @param procedure A pointer to the procedure of the task.
+/// @param context The context pointer passed to the procedure.
+/// @return A pointer to the task. The task must be joined exactly once by Arcadia_ThreadPool_join.
+/// @error Arcadia_Status_ArgumentValueInvalid @a procedure is a null pointer
+/// @error Arcadia_Status_AllocationFailed an allocation failed
+Arcadia_ThreadPool_Task*
+Arcadia_ThreadPool_fork
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ThreadPool* self,
+    Arcadia_ThreadPool_TaskProcedure* procedure,
+    void* context
+  );
+
+/// @brief Wait for a task to complete and release the task.
+/// @param thread A pointer to the calling thread.
+/// @param self A pointer to this thread pool.
+/// @param task A pointer to the task.
+/// @remarks
+/// While the task is not completed, the calling thread executes other pending tasks.
+/// If there are no pending tasks, the calling thread waits in a safe region.
+/// @error If the procedure of the task raised an error, the status of that error is raised on the calling thread.
+void
+Arcadia_ThreadPool_join
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ThreadPool* self,
+    Arcadia_ThreadPool_Task* task
+  );
+
+#endif // ARCADIA_RING1_IMPLEMENTATION_CONCURRENCY_THREADPOOL_H_INCLUDED
@@ -80,4 +80,9 @@
 
 
 
+// 1 if the profiler is enabled, 0 otherwise.
+#define Arcadia_Configuration_Profiler_Enabled (@Arcadia.Ring1.Profiler.Enabled@)
+
+
+
 #endif // ARCADIA_RING1_IMPLEMENTATION_CONFIGURE_H_INCLUDED
@@ -47,16 +47,20 @@ typedef void Arcadia_Type;
     g_##_cName##_type = NULL; \
   } \
   \
+  static Arcadia_TypeValue \
+  _##_cName##_registerType \
+    ( \
+      Arcadia_Thread* thread \
+    ) \
+  { return Arcadia_registerEnumerationType(thread, Arcadia_Names_getOrCreateName(thread, _cilName, sizeof(_cilName) - 1), sizeof(_cName), _cTypeOperations, &_##_cName##_typeDestructing); } \
+  \
   Arcadia_TypeValue \
   _##_cName##_getType \
     ( \
       Arcadia_Thread* thread \
     ) \
   { \
-    if (!g_##_cName##_type) { \
-      g_##_cName##_type = Arcadia_registerEnumerationType(thread, Arcadia_Names_getOrCreateName(thread, _cilName, sizeof(_cilName) - 1), sizeof(_cName), _cTypeOperations, &_##_cName##_typeDestructing); \
-    } \
-    return g_##_cName##_type; \
+    return Arcadia_getOrRegisterType(thread, &g_##_cName##_type, &_##_cName##_registerType); \
   }
 
 typedef struct Arcadia_EnumerationValue {
@@ -20,7 +20,7 @@
 
 #define TypeName u8"Arcadia.ImmutableByteArray"
 
-static Arcadia_BooleanValue g_registered = Arcadia_BooleanValue_False;
+static uint32_t volatile g_registered = 0;
 
 static void
 onTypeRemoved
@@ -29,7 +29,7 @@ onTypeRemoved
     const uint8_t* bytes,
     size_t numberOfBytes
   )
-{ g_registered = Arcadia_BooleanValue_False; }
+{ g_registered = 0; }
 
 Arcadia_RuntimeByteArray*
 Arcadia_RuntimeByteArray_create
@@ -47,15 +47,13 @@ Arcadia_RuntimeByteArray_create
     Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
     Arcadia_Thread_jump(thread);
   }
-  if (!g_registered) {
-    Arcadia_Process_registerType(Arcadia_Thread_getProcess(thread),
-                                 TypeName, sizeof(TypeName) - 1,
-                                 Arcadia_Thread_getProcess(thread),
-                                 (Arcadia_Process_TypeRemovedCallback*)&onTypeRemoved,
-                                 NULL,
-                                 NULL);
-    g_registered = Arcadia_BooleanValue_True;
-  }
+  Arcadia_Process_registerTypeOnce(Arcadia_Thread_getProcess(thread),
+                                   &g_registered,
+                                   TypeName, sizeof(TypeName) - 1,
+                                   Arcadia_Thread_getProcess(thread),
+                                   (Arcadia_Process_TypeRemovedCallback*)&onTypeRemoved,
+                                   NULL,
+                                   NULL);
   Arcadia_RuntimeByteArray*array = NULL;
   Arcadia_Process_allocate(Arcadia_Thread_getProcess(thread), (void**)&array, TypeName, sizeof(TypeName) - 1, sizeof(Arcadia_RuntimeByteArray) + numberOfBytes);
   Arcadia_Memory_copy(thread, array->bytes, bytes, numberOfBytes);
@@ -198,14 +196,18 @@ typeDestructing
   g_type = NULL;
 }
 
+static Arcadia_TypeValue
+registerType
+  (
+    Arcadia_Thread* thread
+  )
+{ return Arcadia_registerInternalType(thread, Arcadia_Names_getOrCreateName(thread, TypeName, sizeof(TypeName) - 1), &_typeOperations, &typeDestructing); }
+
 Arcadia_TypeValue
 _Arcadia_RuntimeByteArrayValue_getType
   (
     Arcadia_Thread* thread
   )
 {
-  if (!g_type) {
-    g_type = Arcadia_registerInternalType(thread, Arcadia_Names_getOrCreateName(thread, TypeName, sizeof(TypeName) - 1), &_typeOperations, &typeDestructing);
-  }
-  return g_type;
+  return Arcadia_getOrRegisterType(thread, &g_type, &registerType);
 }
@@ -328,7 +328,7 @@ Arcadia_RuntimeUTF8String_toBoolean
     Arcadia_Thread* thread,
     Arcadia_RuntimeUTF8StringValue self
   )
-{ return _toBoolean(thread, self); }
+{ return _toBoolean(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_Integer16Value
 Arcadia_RuntimeUTF8String_toInteger16
@@ -336,7 +336,7 @@ Arcadia_RuntimeUTF8String_toInteger16
     Arcadia_Thread* thread,
     Arcadia_RuntimeUTF8StringValue self
   )
-{ return _toInteger16(thread, self); }
+{ return _toInteger16(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_Integer32Value
 Arcadia_RuntimeUTF8String_toInteger32
@@ -344,7 +344,7 @@ Arcadia_RuntimeUTF8String_toInteger32
     Arcadia_Thread* thread,
     Arcadia_RuntimeUTF8StringValue self
   )
-{ return _toInteger32(thread, self); }
+{ return _toInteger32(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_Integer64Value
 Arcadia_RuntimeUTF8String_toInteger64
@@ -352,7 +352,7 @@ Arcadia_RuntimeUTF8String_toInteger64
     Arcadia_Thread* thread,
     Arcadia_RuntimeUTF8StringValue self
   )
-{ return _toInteger64(thread, self); }
+{ return _toInteger64(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_Integer8Value
 Arcadia_RuntimeUTF8String_toInteger8
@@ -360,7 +360,7 @@ Arcadia_RuntimeUTF8String_toInteger8
     Arcadia_Thread* thread,
     Arcadia_RuntimeUTF8StringValue self
   )
-{ return _toInteger8(thread, self); }
+{ return _toInteger8(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_Natural16Value
 Arcadia_RuntimeUTF8String_toNatural16
@@ -368,7 +368,7 @@ Arcadia_RuntimeUTF8String_toNatural16
     Arcadia_Thread* thread,
     Arcadia_RuntimeUTF8StringValue self
   )
-{ return _toNatural16(thread, self); }
+{ return _toNatural16(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_Natural32Value
 Arcadia_RuntimeUTF8String_toNatural32
@@ -376,7 +376,7 @@ Arcadia_RuntimeUTF8String_toNatural32
     Arcadia_Thread* thread,
     Arcadia_RuntimeUTF8StringValue self
   )
-{ return _toNatural32(thread, self); }
+{ return _toNatural32(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_Natural64Value
 Arcadia_RuntimeUTF8String_toNatural64
@@ -384,7 +384,7 @@ Arcadia_RuntimeUTF8String_toNatural64
     Arcadia_Thread* thread,
     Arcadia_RuntimeUTF8StringValue self
   )
-{ return _toNatural64(thread, self); }
+{ return _toNatural64(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_Natural8Value
 Arcadia_RuntimeUTF8String_toNatural8
@@ -392,7 +392,7 @@ Arcadia_RuntimeUTF8String_toNatural8
     Arcadia_Thread* thread,
     Arcadia_RuntimeUTF8StringValue self
   )
-{ return _toNatural8(thread, self); }
+{ return _toNatural8(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_Real32Value
 Arcadia_RuntimeUTF8String_toReal32
@@ -400,7 +400,7 @@ Arcadia_RuntimeUTF8String_toReal32
     Arcadia_Thread* thread,
     Arcadia_RuntimeUTF8StringValue self
   )
-{ return _toReal32(thread, self); }
+{ return _toReal32(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_Real64Value
 Arcadia_RuntimeUTF8String_toReal64
@@ -408,7 +408,7 @@ Arcadia_RuntimeUTF8String_toReal64
     Arcadia_Thread* thread,
     Arcadia_RuntimeUTF8StringValue self
   )
-{ return _toReal64(thread, self); }
+{ return _toReal64(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_SizeValue
 Arcadia_RuntimeUTF8String_toSize
@@ -416,7 +416,7 @@ Arcadia_RuntimeUTF8String_toSize
     Arcadia_Thread* thread,
     Arcadia_RuntimeUTF8StringValue self
   )
-{ return _toSize(thread, self); }
+{ return _toSize(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_VoidValue
 Arcadia_RuntimeUTF8String_toVoid
@@ -424,7 +424,7 @@ Arcadia_RuntimeUTF8String_toVoid
     Arcadia_Thread* thread,
     Arcadia_RuntimeUTF8StringValue self
   )
-{ return _toVoid(thread, self); }
+{ return _toVoid(thread, self->bytes, self->numberOfBytes); }
 
 static void
 isEqualTo
@@ -545,14 +545,18 @@ typeDestructing
   g_type = NULL;
 }
 
+static Arcadia_TypeValue
+registerType
+  (
+    Arcadia_Thread* thread
+  )
+{ return Arcadia_registerInternalType(thread, Arcadia_Names_getOrCreateName(thread, TypeName, sizeof(TypeName) - 1), &_typeOperations, &typeDestructing); }
+
 Arcadia_TypeValue
 _Arcadia_RuntimeUTF8StringValue_getType
   (
     Arcadia_Thread* thread
   )
 {
-  if (!g_type) {
-    g_type = Arcadia_registerInternalType(thread, Arcadia_Names_getOrCreateName(thread, TypeName, sizeof(TypeName) - 1), &_typeOperations, &typeDestructing);
-  }
-  return g_type;
+  return Arcadia_getOrRegisterType(thread, &g_type, &registerType);
 }
@@ -0,0 +1,59 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_RING1_IMPLEMENTATION_IMMUTABLEUTF8STRING_FIND_H_INCLUDED)
+#define ARCADIA_RING1_IMPLEMENTATION_IMMUTABLEUTF8STRING_FIND_H_INCLUDED
+
+#include "Arcadia/Ring1/Include.h"
+
+// Get the zero-based code point index of the first occurrence of a code point in UTF-8 bytes.
+// Return an Arcadia.Size value if the code point was found, Arcadia.Void otherwise.
+Arcadia_Value
+_findFirstOccurrence
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes,
+    Arcadia_Natural32Value codePoint
+  );
+
+// Get the zero-based code point index of the last occurrence of a code point in UTF-8 bytes.
+// Return an Arcadia.Size value if the code point was found, Arcadia.Void otherwise.
+Arcadia_Value
+_findLastOccurrence
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes,
+    Arcadia_Natural32Value codePoint
+  );
+
+// Get the Byte range of the code points [start, start + length) in UTF-8 bytes.
+// "length" is either an Arcadia.Size value or Arcadia.Void (all code points from start to the end).
+// start must be within the bounds of [0,n].
+// in particular, if start = n then length must be 0.
+void
+_getSubstringByteRange
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes,
+    Arcadia_SizeValue start,
+    Arcadia_Value length,
+    Arcadia_SizeValue* byteIndex,
+    Arcadia_SizeValue* byteLength
+  );
+
+#endif // ARCADIA_RING1_IMPLEMENTATION_IMMUTABLEUTF8STRING_FIND_H_INCLUDED
@@ -24,10 +24,4 @@ _hashUTF8
     Arcadia_Natural8Value const* bytes,
     Arcadia_SizeValue numberOfBytes
   )
-{
-  Arcadia_SizeValue hash = numberOfBytes;
-  for (Arcadia_SizeValue i = 0, n = numberOfBytes; i < n; ++i) {
-    hash = hash * 37 + bytes[i];
-  }
-  return hash;
-}
+{ return Arcadia_hashBytes(thread, bytes, numberOfBytes); }
@@ -24,12 +24,12 @@ Arcadia_BooleanValue
 _toBoolean
   (
     Arcadia_Thread* thread,
-    Arcadia_RuntimeUTF8String* immutableUTF8StringValue
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
   )
 {
   _State state;
-  _State_init(&state, Arcadia_RuntimeUTF8String_getBytes(thread, immutableUTF8StringValue),
-                      Arcadia_RuntimeUTF8String_getNumberOfBytes(thread, immutableUTF8StringValue));
+  _State_init(&state, bytes, numberOfBytes);
   Arcadia_JumpTarget jumpTarget;
   Arcadia_BooleanValue value = Arcadia_BooleanValue_False;
   Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
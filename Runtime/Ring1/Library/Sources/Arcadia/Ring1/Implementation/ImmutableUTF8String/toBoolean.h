@@ -17,13 +17,15 @@
 #define ARCADIA_RING1_IMPLEMENTATION_IMMUTABLEUTF8STRING_TOBOOLEAN_H_INCLUDED
 
 #include "Arcadia/Ring1/Implementation/Boolean.h"
-typedef struct Arcadia_RuntimeUTF8String Arcadia_RuntimeUTF8String;
+#include "Arcadia/Ring1/Implementation/Natural8.h"
+#include "Arcadia/Ring1/Implementation/Size.h"
 
 Arcadia_BooleanValue
 _toBoolean
   (
     Arcadia_Thread* thread,
-    Arcadia_RuntimeUTF8String* immutableUTF8StringValue
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
   );
 
 #endif // ARCADIA_RING1_IMPLEMENTATION_IMMUTABLEUTF8STRING_TOBOOLEAN_H_INCLUDED
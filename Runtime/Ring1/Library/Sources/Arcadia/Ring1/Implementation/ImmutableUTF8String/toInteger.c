@@ -97,10 +97,11 @@ Arcadia_Integer16Value
 _toInteger16
   (
     Arcadia_Thread* thread,
-    Arcadia_RuntimeUTF8String* immutableUTF8StringValue
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
   )
 {
-  Arcadia_Integer64Value v = _toInteger64(thread, immutableUTF8StringValue);
+  Arcadia_Integer64Value v = _toInteger64(thread, bytes, numberOfBytes);
   if (v < Arcadia_Integer16Value_Minimum || v > Arcadia_Integer16Value_Maximum) {
     Arcadia_Thread_setStatus(thread, Arcadia_Status_ConversionFailed);
     Arcadia_Thread_jump(thread);
@@ -112,10 +113,11 @@ Arcadia_Integer32Value
 _toInteger32
   (
     Arcadia_Thread* thread,
-    Arcadia_RuntimeUTF8String* immutableUTF8StringValue
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
   )
 {
-  Arcadia_Integer64Value v = _toInteger64(thread, immutableUTF8StringValue);
+  Arcadia_Integer64Value v = _toInteger64(thread, bytes, numberOfBytes);
   if (v < Arcadia_Integer32Value_Minimum || v > Arcadia_Integer32Value_Maximum) {
     Arcadia_Thread_setStatus(thread, Arcadia_Status_ConversionFailed);
     Arcadia_Thread_jump(thread);
@@ -127,12 +129,12 @@ Arcadia_Integer64Value
 _toInteger64
   (
     Arcadia_Thread* thread,
-    Arcadia_RuntimeUTF8String* immutableUTF8StringValue
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
   )
 {
   _State state;
-  _State_init(&state, Arcadia_RuntimeUTF8String_getBytes(thread, immutableUTF8StringValue),
-                      Arcadia_RuntimeUTF8String_getNumberOfBytes(thread, immutableUTF8StringValue));
+  _State_init(&state, bytes, numberOfBytes);
   Arcadia_Integer64Value value;
   Arcadia_JumpTarget jumpTarget;
   Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
@@ -152,10 +154,11 @@ Arcadia_Integer8Value
 _toInteger8
   (
     Arcadia_Thread* thread,
-    Arcadia_RuntimeUTF8String* immutableUTF8StringValue
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
   )
 {
-  Arcadia_Integer64Value v = _toInteger64(thread, immutableUTF8StringValue);
+  Arcadia_Integer64Value v = _toInteger64(thread, bytes, numberOfBytes);
   if (v < Arcadia_Integer8Value_Minimum || v > Arcadia_Integer8Value_Maximum) {
     Arcadia_Thread_setStatus(thread, Arcadia_Status_ConversionFailed);
     Arcadia_Thread_jump(thread);
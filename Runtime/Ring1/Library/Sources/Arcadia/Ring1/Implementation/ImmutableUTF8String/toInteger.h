@@ -20,34 +20,39 @@
 #include "Arcadia/Ring1/Implementation/Integer32.h"
 #include "Arcadia/Ring1/Implementation/Integer64.h"
 #include "Arcadia/Ring1/Implementation/Integer8.h"
-typedef struct Arcadia_RuntimeUTF8String Arcadia_RuntimeUTF8String;
+#include "Arcadia/Ring1/Implementation/Natural8.h"
+#include "Arcadia/Ring1/Implementation/Size.h"
 
 Arcadia_Integer16Value
 _toInteger16
   (
     Arcadia_Thread* thread,
-    Arcadia_RuntimeUTF8String* immutableUTF8StringValue
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
   );
 
 Arcadia_Integer32Value
 _toInteger32
   (
     Arcadia_Thread* thread,
-    Arcadia_RuntimeUTF8String* immutableUTF8StringValue
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
   );
 
 Arcadia_Integer64Value
 _toInteger64
   (
     Arcadia_Thread* thread,
-    Arcadia_RuntimeUTF8String* immutableUTF8StringValue
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
   );
 
 Arcadia_Integer8Value
 _toInteger8
   (
     Arcadia_Thread* thread,
-    Arcadia_RuntimeUTF8String* immutableUTF8StringValue
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
   );
 
 #endif // ARCADIA_RING1_IMPLEMENTATION_IMMUTABLEUTF8STRING_TOINTEGER_H_INCLUDED
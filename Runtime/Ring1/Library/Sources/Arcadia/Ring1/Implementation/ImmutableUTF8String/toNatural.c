@@ -109,10 +109,11 @@ Arcadia_Natural16Value
 _toNatural16
   (
     Arcadia_Thread* thread,
-    Arcadia_RuntimeUTF8String* immutableUTF8StringValue
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
   )
 {
-  Arcadia_Natural64Value w = _toNatural64(thread, immutableUTF8StringValue);
+  Arcadia_Natural64Value w = _toNatural64(thread, bytes, numberOfBytes);
   if (w > Arcadia_Natural16Value_Maximum) {
     Arcadia_Thread_setStatus(thread, Arcadia_Status_ConversionFailed);
     Arcadia_Thread_jump(thread);
@@ -125,10 +126,11 @@ Arcadia_Natural32Value
 _toNatural32
   (
     Arcadia_Thread* thread,
-    Arcadia_RuntimeUTF8String* immutableUTF8StringValue
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
   )
 {
-  Arcadia_Natural64Value w = _toNatural64(thread, immutableUTF8StringValue);
+  Arcadia_Natural64Value w = _toNatural64(thread, bytes, numberOfBytes);
   if (w > Arcadia_Natural32Value_Maximum) {
     Arcadia_Thread_setStatus(thread, Arcadia_Status_ConversionFailed);
     Arcadia_Thread_jump(thread);
@@ -141,12 +143,12 @@ Arcadia_Natural64Value
 _toNatural64
   (
     Arcadia_Thread* thread,
-    Arcadia_RuntimeUTF8String* immutableUTF8StringValue
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
   )
 {
   _State state;
-  _State_init(&state, Arcadia_RuntimeUTF8String_getBytes(thread, immutableUTF8StringValue),
-                      Arcadia_RuntimeUTF8String_getNumberOfBytes(thread, immutableUTF8StringValue));
+  _State_init(&state, bytes, numberOfBytes);
   Arcadia_Natural64Value value;
   Arcadia_JumpTarget jumpTarget;
   Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
@@ -166,10 +168,11 @@ Arcadia_Natural8Value
 _toNatural8
   (
     Arcadia_Thread* thread,
-    Arcadia_RuntimeUTF8String* immutableUTF8StringValue
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
   )
 {
-  Arcadia_Natural64Value w = _toNatural64(thread, immutableUTF8StringValue);
+  Arcadia_Natural64Value w = _toNatural64(thread, bytes, numberOfBytes);
   if (w > Arcadia_Natural8Value_Maximum) {
     Arcadia_Thread_setStatus(thread, Arcadia_Status_ConversionFailed);
     Arcadia_Thread_jump(thread);
@@ -22,13 +22,14 @@ Arcadia_SizeValue
 _toSize
   (
     Arcadia_Thread* thread,
-    Arcadia_RuntimeUTF8String* immutableUTF8StringValue
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
   )
 {
 #if Arcadia_Configuration_InstructionSetArchitecture_X64 == Arcadia_Configuration_InstructionSetArchitecture
-  return _toNatural64(thread, immutableUTF8StringValue);
+  return _toNatural64(thread, bytes, numberOfBytes);
 #elif Arcadia_Configuration_InstructionSetArchitecture_X86 == Arcadia_Configuration_InstructionSetArchitecture
-  return _toNatural32(thread, immutableUTF8StringValue);
+  return _toNatural32(thread, bytes, numberOfBytes);
 #else
   #error("environemnt not (yet) supported");
 #endif
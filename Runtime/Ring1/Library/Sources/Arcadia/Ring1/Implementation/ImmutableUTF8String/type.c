@@ -17,7 +17,7 @@
 
 #include "Arcadia/Ring1/Include.h"
 
-static Arcadia_BooleanValue g_registered = Arcadia_BooleanValue_False;
+static uint32_t volatile g_registered = 0;
 
 static void
 _onTypeRemoved
@@ -26,7 +26,7 @@ _onTypeRemoved
     const uint8_t* bytes,
     size_t numberOfBytes
   )
-{ g_registered = Arcadia_BooleanValue_False; }
+{ g_registered = 0; }
 
 void
 _ensureTypeRegistered
@@ -34,13 +34,11 @@ _ensureTypeRegistered
     Arcadia_Thread* thread
   )
 {
-  if (!g_registered) {
-    Arcadia_Process_registerType(Arcadia_Thread_getProcess(thread),
-                                 TypeName, sizeof(TypeName) - 1,
-                                 Arcadia_Thread_getProcess(thread),
-                                 (Arcadia_Process_TypeRemovedCallback*)&_onTypeRemoved,
-                                 NULL,
-                                 NULL);
-    g_registered = Arcadia_BooleanValue_True;
-  }
+  Arcadia_Process_registerTypeOnce(Arcadia_Thread_getProcess(thread),
+                                   &g_registered,
+                                   TypeName, sizeof(TypeName) - 1,
+                                   Arcadia_Thread_getProcess(thread),
+                                   (Arcadia_Process_TypeRemovedCallback*)&_onTypeRemoved,
+                                   NULL,
+                                   NULL);
 }
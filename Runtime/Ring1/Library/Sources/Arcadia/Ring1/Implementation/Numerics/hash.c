@@ -17,6 +17,78 @@
 #include "Arcadia/Ring1/Implementation/Numerics/hash.h"
 
 #include "Arcadia/Ring1/Include.h"
+#include <string.h>
+
+// Constants and finalizer of MurmurHash3 (64 bit).
+#define C1 UINT64_C(0x87c37b91114253d5)
+#define C2 UINT64_C(0x4cf5ad432745937f)
+
+static inline Arcadia_Natural64Value
+rotateLeft
+  (
+    Arcadia_Natural64Value x,
+    int n
+  )
+{ return (x << n) | (x >> (64 - n)); }
+
+static inline Arcadia_Natural64Value
+mixWord
+  (
+    Arcadia_Natural64Value k
+  )
+{
+  k *= C1;
+  k = rotateLeft(k, 31);
+  k *= C2;
+  return k;
+}
+
+static inline Arcadia_Natural64Value
+finalize
+  (
+    Arcadia_Natural64Value h
+  )
+{
+  h ^= h >> 33;
+  h *= UINT64_C(0xff51afd7ed558ccd);
+  h ^= h >> 33;
+  h *= UINT64_C(0xc4ceb9fe1a85ec53);
+  h ^= h >> 33;
+  return h;
+}
+
+Arcadia_SizeValue
+Arcadia_hashBytes
+  (
+    Arcadia_Thread* thread,
+    void const* bytes,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  Arcadia_Natural8Value const* p = (Arcadia_Natural8Value const*)bytes;
+  Arcadia_SizeValue n = numberOfBytes;
+  Arcadia_Natural64Value h = UINT64_C(0x9e3779b97f4a7c15);
+  while (n >= 8) {
+    Arcadia_Natural64Value k;
+    memcpy(&k, p, 8);
+    h ^= mixWord(k);
+    h = rotateLeft(h, 27) * 5 + UINT64_C(0x52dce729);
+    p += 8;
+    n -= 8;
+  }
+  if (n) {
+    Arcadia_Natural64Value k = 0;
+    memcpy(&k, p, n);
+    h ^= mixWord(k);
+  }
+  h ^= (Arcadia_Natural64Value)numberOfBytes;
+  h = finalize(h);
+  if (Arcadia_SizeValue_NumberOfBits < 64) {
+    // Fold the upper bits into the lower bits.
+    h ^= h >> 32;
+  }
+  return (Arcadia_SizeValue)h;
+}
 
 Arcadia_SizeValue
 Arcadia_hashAtomValue
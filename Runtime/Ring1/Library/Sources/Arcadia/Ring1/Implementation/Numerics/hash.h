@@ -45,6 +45,23 @@
 
 #include "Arcadia/Ring1/Implementation/Void.h"
 
+/// @brief Compute the hash value of a sequence of Bytes.
+/// @param thread A pointer to this thread.
+/// @param bytes A pointer to an array of @a numberOfBytes Bytes.
+/// @param numberOfBytes The number of Bytes in the array pointed to by @a bytes.
+/// @return The hash value.
+/// @remarks
+/// This is the hash function of names, atoms, string tables, and immutable UTF-8 strings.
+/// It consumes its input eight Bytes at a time and its result is well-distributed over all bits.
+/// Hence tables can use power-of-two capacities and compute the bucket index by masking.
+Arcadia_SizeValue
+Arcadia_hashBytes
+  (
+    Arcadia_Thread* thread,
+    void const* bytes,
+    Arcadia_SizeValue numberOfBytes
+  );
+
 // https://michaelheilmann.com/Arcadia/Ring1/#Arcadia_hash*
 Arcadia_SizeValue
 Arcadia_hashAtomValue
@@ -34,6 +34,15 @@ Arcadia_Object_constructImpl
     Arcadia_Object* self
   );
 
+static void
+Arcadia_Object_constructNativeImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Object* self,
+    Arcadia_SizeValue numberOfArgumentValues,
+    Arcadia_Value const* argumentValues
+  );
+
 static void
 _Arcadia_Object_initializeDispatchImpl
   (
@@ -47,22 +56,27 @@ isIdenticalTo
     Arcadia_Thread* thread
   );
 
-static void
+static Arcadia_BooleanValue
 isEqualTo
   (
-    Arcadia_Thread* thread
+    Arcadia_Thread* thread,
+    Arcadia_Object* self,
+    Arcadia_Value const* other
   );
 
-static void
+static Arcadia_SizeValue
 getHash
   (
-    Arcadia_Thread* thread
+    Arcadia_Thread* thread,
+    Arcadia_Object* self
   );
 
-static void
+static Arcadia_BooleanValue
 isNotEqualTo
   (
-    Arcadia_Thread* thread
+    Arcadia_Thread* thread,
+    Arcadia_Object* self,
+    Arcadia_Value const* other
   );
 
 #define Operation(_Name) \
@@ -80,6 +94,7 @@ static const Arcadia_ObjectType_Operations _Arcadia_Object_objectTypeOperations
   Arcadia_ObjectType_Operations_Initializer,
   .construct = &Arcadia_Object_constructImpl,
   .initializeDispatch = &_Arcadia_Object_initializeDispatchImpl,
+  .constructNative = &Arcadia_Object_constructNativeImpl,
 };
 
 static const Arcadia_Type_Operations _Arcadia_Object_typeOperations = {
@@ -159,6 +174,23 @@ Arcadia_Object_constructImpl
   Arcadia_LeaveConstructor(Arcadia_Object);
 }
 
+static void
+Arcadia_Object_constructNativeImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Object* self,
+    Arcadia_SizeValue numberOfArgumentValues,
+    Arcadia_Value const* argumentValues
+  )
+{
+  Arcadia_EnterNativeConstructor(Arcadia_Object);
+  if (0 != numberOfArgumentValues) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_LeaveNativeConstructor(Arcadia_Object);
+}
+
 static void
 isIdenticalTo
   (
@@ -173,42 +205,100 @@ isIdenticalTo
   }
 }
 
-static void
+static Arcadia_BooleanValue
 isEqualTo
   (
-    Arcadia_Thread* thread
+    Arcadia_Thread* thread,
+    Arcadia_Object* self,
+    Arcadia_Value const* other
   )
 {
-  BINARY_OPERATION();
-  if (Arcadia_Value_isObjectReferenceValue(&y)) {
-    Arcadia_ValueStack_pushBooleanValue(thread, Arcadia_Value_getObjectReferenceValue(&x) == Arcadia_Value_getObjectReferenceValue(&y));
+  if (Arcadia_Value_isObjectReferenceValue(other)) {
+    return self == Arcadia_Value_getObjectReferenceValue(other);
   } else {
-    Arcadia_ValueStack_pushBooleanValue(thread, Arcadia_BooleanValue_False);
+    return Arcadia_BooleanValue_False;
   }
 }
 
-static void
+static Arcadia_SizeValue
 getHash
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Object* self
+  )
+{
+  // Object addresses are aligned, hence their low bits are zero.
+  // Hash the address such that these low bits can be used for indexing.
+  return Arcadia_hashBytes(thread, &self, sizeof(Arcadia_Object*));
+}
+
+static Arcadia_BooleanValue
+isNotEqualTo
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Object* self,
+    Arcadia_Value const* other
+  )
+{
+  if (Arcadia_Value_isObjectReferenceValue(other)) {
+    return self != Arcadia_Value_getObjectReferenceValue(other);
+  } else {
+    return Arcadia_BooleanValue_True;
+  }
+}
+
+static inline Arcadia_ObjectDispatch*
+getDispatch
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Object* self
+  )
+{
+  Arcadia_TypeValue type = Arcadia_Object_getType(thread, self);
+  assert(NULL != type);
+  Arcadia_ObjectDispatch* objectDispatch = (Arcadia_ObjectDispatch*)Arcadia_ObjectType_getDispatch(type);
+  assert(NULL != objectDispatch);
+  assert(((Arcadia_ObjectDispatch*)objectDispatch)->type == type);
+  return objectDispatch;
+}
+
+void
+Arcadia_Object_getHashProcedure
   (
     Arcadia_Thread* thread
   )
 {
   UNARY_OPERATION();
-  Arcadia_ValueStack_pushSizeValue(thread, (Arcadia_SizeValue)(uintptr_t)Arcadia_Value_getObjectReferenceValue(&x));
+  Arcadia_Object* self = Arcadia_Value_getObjectReferenceValue(&x);
+  Arcadia_ObjectDispatch* objectDispatch = getDispatch(thread, self);
+  assert(NULL != objectDispatch->getHashFunction);
+  Arcadia_ValueStack_pushSizeValue(thread, objectDispatch->getHashFunction(thread, self));
 }
 
-static void
-isNotEqualTo
+void
+Arcadia_Object_isEqualToProcedure
   (
     Arcadia_Thread* thread
   )
 {
   BINARY_OPERATION();
-  if (Arcadia_Value_isObjectReferenceValue(&y)) {
-    Arcadia_ValueStack_pushBooleanValue(thread, Arcadia_Value_getObjectReferenceValue(&x) != Arcadia_Value_getObjectReferenceValue(&y));
-  } else {
-    Arcadia_ValueStack_pushBooleanValue(thread, Arcadia_BooleanValue_True);
-  }
+  Arcadia_Object* self = Arcadia_Value_getObjectReferenceValue(&x);
+  Arcadia_ObjectDispatch* objectDispatch = getDispatch(thread, self);
+  assert(NULL != objectDispatch->isEqualToFunction);
+  Arcadia_ValueStack_pushBooleanValue(thread, objectDispatch->isEqualToFunction(thread, self, &y));
+}
+
+void
+Arcadia_Object_isNotEqualToProcedure
+  (
+    Arcadia_Thread* thread
+  )
+{
+  BINARY_OPERATION();
+  Arcadia_Object* self = Arcadia_Value_getObjectReferenceValue(&x);
+  Arcadia_ObjectDispatch* objectDispatch = getDispatch(thread, self);
+  assert(NULL != objectDispatch->isNotEqualToFunction);
+  Arcadia_ValueStack_pushBooleanValue(thread, objectDispatch->isNotEqualToFunction(thread, self, &y));
 }
 
 #define ObjectTypeName u8"Arcadia.Object"
@@ -301,11 +391,14 @@ _Arcadia_Object_onVisitObject
   }
 }
 
-static void*
-Arcadia_allocateObject
+// Allocate the memory of an object of the specified type followed by the specified number of trailing Bytes.
+// The memory is assigned the "Arcadia.Memory" type, however, that type is not locked.
+static ObjectTag*
+Arcadia_allocateObjectMemory
   (
     Arcadia_Thread* thread,
-    Arcadia_TypeValue type
+    Arcadia_TypeValue type,
+    Arcadia_SizeValue numberOfTrailingBytes
   )
 {
   if (!type) {
@@ -320,13 +413,25 @@ Arcadia_allocateObject
   Arcadia_Type* memoryType = _Arcadia_Memory_getType(thread);
 
   ObjectTag* tag = NULL;
-  if (SIZE_MAX - sizeof(ObjectTag) < Arcadia_ObjectType_getValueSize(thread, (Arcadia_ObjectType*)type)) {
+  Arcadia_SizeValue valueSize = Arcadia_ObjectType_getValueSize(thread, (Arcadia_ObjectType*)type);
+  if (SIZE_MAX - sizeof(ObjectTag) < valueSize || SIZE_MAX - sizeof(ObjectTag) - valueSize < numberOfTrailingBytes) {
     Arcadia_Thread_setStatus(thread, Arcadia_Status_AllocationFailed);
     Arcadia_Thread_jump(thread);
   }
-  Arcadia_Process_allocate(Arcadia_Thread_getProcess(thread), (void**)&tag, ObjectTypeName, sizeof(ObjectTypeName) - 1, sizeof(ObjectTag) + Arcadia_ObjectType_getValueSize(thread, (Arcadia_ObjectType*)type));
+  Arcadia_Process_allocate(Arcadia_Thread_getProcess(thread), (void**)&tag, ObjectTypeName, sizeof(ObjectTypeName) - 1, sizeof(ObjectTag) + valueSize + numberOfTrailingBytes);
   tag->type = memoryType;
-  if (Arcadia_Process_lockObject(Arcadia_Thread_getProcess(thread), memoryType)) {
+  return tag;
+}
+
+static void*
+Arcadia_allocateObject
+  (
+    Arcadia_Thread* thread,
+    Arcadia_TypeValue type
+  )
+{
+  ObjectTag* tag = Arcadia_allocateObjectMemory(thread, type, 0);
+  if (Arcadia_Process_lockObject(Arcadia_Thread_getProcess(thread), tag->type)) {
     Arcadia_logf(Arcadia_LogFlags_Error, "%s:%d: <error>\n", __FILE__, __LINE__);
   }
   Arcadia_Type_getOperations(type)->objectTypeOperations->construct(thread, (Arcadia_ObjectReferenceValue)(Arcadia_Object*)(tag + 1));
@@ -353,7 +458,106 @@ ARCADIA_CREATEOBJECT0
     return self;
   } else {
     Arcadia_Thread_popJumpTarget(thread);
-    if (oldValueStackSize < Arcadia_ValueStack_getSize(thread)) {
+    if (oldValueStackSize > Arcadia_ValueStack_getSize(thread)) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_StackCorruption);
+      Arcadia_Thread_jump(thread);
+    } else {
+      Arcadia_ValueStack_popValues(thread, Arcadia_ValueStack_getSize(thread) - oldValueStackSize);
+    }
+    Arcadia_Thread_jump(thread);
+  }
+}
+
+// Invoke the native constructor of the type "type" on the object "self".
+// The type "heldType" is locked on behalf of the object, the types the native constructors assign to the object are not locked.
+// On success, the object is assigned the type "type", that type is locked, and the type "heldType" is unlocked.
+// On failure, the type assigned to the object by the last native constructor which completed is locked and the type "heldType" is unlocked.
+static void
+Arcadia_Object_runNativeConstructor
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Object* self,
+    Arcadia_TypeValue type,
+    Arcadia_TypeValue heldType,
+    Arcadia_SizeValue numberOfArgumentValues,
+    Arcadia_Value const* argumentValues
+  )
+{
+  Arcadia_Process* process = Arcadia_Thread_getProcess(thread);
+  ObjectTag* tag = ((ObjectTag*)self) - 1;
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_Object_ConstructNativeCallbackFunction* constructNative = Arcadia_Type_getOperations(type)->objectTypeOperations->constructNative;
+    if (!constructNative) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_OperationInvalid);
+      Arcadia_Thread_jump(thread);
+    }
+    constructNative(thread, self, numberOfArgumentValues, argumentValues);
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    if (tag->type != heldType) {
+      if (Arcadia_Process_lockObject(process, tag->type)) {
+        Arcadia_logf(Arcadia_LogFlags_Error, "%s:%d: <error>\n", __FILE__, __LINE__);
+      }
+      if (Arcadia_Process_unlockObject(process, heldType)) {
+        Arcadia_logf(Arcadia_LogFlags_Error, "%s:%d: <error>\n", __FILE__, __LINE__);
+      }
+    }
+    Arcadia_Thread_jump(thread);
+  }
+  if (type != heldType) {
+    if (Arcadia_Process_lockObject(process, type)) {
+      Arcadia_logf(Arcadia_LogFlags_Error, "%s:%d: <error>\n", __FILE__, __LINE__);
+    }
+    if (Arcadia_Process_unlockObject(process, heldType)) {
+      Arcadia_logf(Arcadia_LogFlags_Error, "%s:%d: <error>\n", __FILE__, __LINE__);
+    }
+  }
+  tag->type = type;
+}
+
+void*
+Arcadia_Object_createNative
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Type* type,
+    Arcadia_SizeValue numberOfArgumentValues,
+    Arcadia_Value const* argumentValues
+  )
+{ return Arcadia_Object_createNativeWithTrailingBytes(thread, type, 0, numberOfArgumentValues, argumentValues); }
+
+void*
+Arcadia_Object_createNativeWithTrailingBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Type* type,
+    Arcadia_SizeValue numberOfTrailingBytes,
+    Arcadia_SizeValue numberOfArgumentValues,
+    Arcadia_Value const* argumentValues
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  ObjectTag* tag = Arcadia_allocateObjectMemory(thread, type, numberOfTrailingBytes);
+  // Lock the type the object is created with once.
+  // The types assigned to the object by the native constructors are not locked.
+  if (Arcadia_Process_lockObject(Arcadia_Thread_getProcess(thread), type)) {
+    Arcadia_logf(Arcadia_LogFlags_Error, "%s:%d: <error>\n", __FILE__, __LINE__);
+  }
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_Object_runNativeConstructor(thread, (Arcadia_Object*)(tag + 1), type, type, numberOfArgumentValues, argumentValues);
+    if (oldValueStackSize != Arcadia_ValueStack_getSize(thread)) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_StackCorruption);
+      Arcadia_Thread_jump(thread);
+    }
+    Arcadia_Thread_popJumpTarget(thread);
+    return (void*)(tag + 1);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    if (oldValueStackSize > Arcadia_ValueStack_getSize(thread)) {
       Arcadia_Thread_setStatus(thread, Arcadia_Status_StackCorruption);
       Arcadia_Thread_jump(thread);
     } else {
@@ -363,6 +567,102 @@ ARCADIA_CREATEOBJECT0
   }
 }
 
+void
+Arcadia_Object_constructNativeSuper
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Object* self,
+    Arcadia_TypeValue type,
+    Arcadia_SizeValue numberOfArgumentValues,
+    Arcadia_Value const* argumentValues
+  )
+{
+  Arcadia_ObjectType_Operations const* operations = Arcadia_Type_getOperations(Arcadia_ObjectType_getParentObjectType(thread, type))->objectTypeOperations;
+  if (operations->constructNative) {
+    operations->constructNative(thread, self, numberOfArgumentValues, argumentValues);
+    return;
+  }
+  // The parent type has no native constructor, invoke its constructor via the value stack protocol.
+  // That constructor locks the type it assigns to the object and unlocks the type it replaces.
+  // Lock the type of the object before and unlock the type of the object after the invocation to undo this.
+  if (numberOfArgumentValues >= Arcadia_Natural8Value_Maximum) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Process* process = Arcadia_Thread_getProcess(thread);
+  ObjectTag* tag = ((ObjectTag*)self) - 1;
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  if (Arcadia_Process_lockObject(process, tag->type)) {
+    Arcadia_logf(Arcadia_LogFlags_Error, "%s:%d: <error>\n", __FILE__, __LINE__);
+  }
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    for (Arcadia_SizeValue i = 0; i < numberOfArgumentValues; ++i) {
+      Arcadia_ValueStack_pushValue(thread, &argumentValues[i]);
+    }
+    Arcadia_ValueStack_pushNatural8Value(thread, (Arcadia_Natural8Value)numberOfArgumentValues);
+    operations->construct(thread, self);
+    Arcadia_Thread_popJumpTarget(thread);
+    if (Arcadia_Process_unlockObject(process, tag->type)) {
+      Arcadia_logf(Arcadia_LogFlags_Error, "%s:%d: <error>\n", __FILE__, __LINE__);
+    }
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    if (Arcadia_Process_unlockObject(process, tag->type)) {
+      Arcadia_logf(Arcadia_LogFlags_Error, "%s:%d: <error>\n", __FILE__, __LINE__);
+    }
+    if (oldValueStackSize < Arcadia_ValueStack_getSize(thread)) {
+      Arcadia_ValueStack_popValues(thread, Arcadia_ValueStack_getSize(thread) - oldValueStackSize);
+    }
+    Arcadia_Thread_jump(thread);
+  }
+}
+
+void
+Arcadia_Object_constructNativeFromValueStack
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Object* self,
+    Arcadia_TypeValue type
+  )
+{
+  if (Arcadia_ValueStack_getSize(thread) < 1) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_StackCorruption);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Natural8Value numberOfArgumentValues = Arcadia_ValueStack_getNatural8Value(thread, 0);
+  if (numberOfArgumentValues > Arcadia_Object_MaximumNumberOfNativeArgumentValues) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  if (Arcadia_ValueStack_getSize(thread) < (Arcadia_SizeValue)numberOfArgumentValues + 1) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_StackCorruption);
+    Arcadia_Thread_jump(thread);
+  }
+  // The argument values remain on the value stack (and hence reachable) until the native constructor returns.
+  Arcadia_Value argumentValues[Arcadia_Object_MaximumNumberOfNativeArgumentValues];
+  for (Arcadia_SizeValue i = 0; i < numberOfArgumentValues; ++i) {
+    argumentValues[i] = Arcadia_ValueStack_getValue(thread, numberOfArgumentValues - i);
+  }
+  // When a constructor is invoked via the value stack protocol, the type of the object is locked.
+  ObjectTag* tag = ((ObjectTag*)self) - 1;
+  Arcadia_Object_runNativeConstructor(thread, self, type, tag->type, numberOfArgumentValues, argumentValues);
+  Arcadia_ValueStack_popValues(thread, (Arcadia_SizeValue)numberOfArgumentValues + 1);
+}
+
+void
+Arcadia_Object_setNativelyConstructedType
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Object* self,
+    Arcadia_TypeValue type
+  )
+{
+  ObjectTag* objectTag = ((ObjectTag*)self) - 1;
+  objectTag->type = type;
+}
+
 static Arcadia_TypeValue g__Arcadia_Object_type = NULL;
 
 static void
@@ -373,9 +673,12 @@ _Arcadia_Object_initializeDispatchImpl
   )
 {
   self->isIdenticalTo = &isIdenticalTo;
-  self->isEqualTo = &isEqualTo;
-  self->getHash = &getHash;
-  self->isNotEqualTo = &isNotEqualTo;
+  self->isEqualTo = &Arcadia_Object_isEqualToProcedure;
+  self->getHash = &Arcadia_Object_getHashProcedure;
+  self->isNotEqualTo = &Arcadia_Object_isNotEqualToProcedure;
+  self->isEqualToFunction = &isEqualTo;
+  self->getHashFunction = &getHash;
+  self->isNotEqualToFunction = &isNotEqualTo;
 }
 
 static void
@@ -385,8 +688,8 @@ _Arcadia_Object_typeDestructing
   )
 { g__Arcadia_Object_type = NULL; }
 
-Arcadia_TypeValue
-_Arcadia_Object_getType
+static Arcadia_TypeValue
+_Arcadia_Object_registerType
   (
     Arcadia_Thread* thread
   )
@@ -400,14 +703,20 @@ _Arcadia_Object_getType
                                  (Arcadia_Process_FinalizeCallback*)&_Arcadia_Object_onFinalizeObject);
     g_objectRegistered = Arcadia_BooleanValue_True;
   }
-  if (!g__Arcadia_Object_type) {
-    g__Arcadia_Object_type = Arcadia_registerObjectType(thread,
-                                                        Arcadia_Names_getOrCreateName(thread, ObjectTypeName, sizeof(ObjectTypeName) - 1),
-                                                        sizeof(Arcadia_Object), NULL,
-                                                        sizeof(Arcadia_ObjectDispatch),
-                                                        &_Arcadia_Object_typeOperations, &_Arcadia_Object_typeDestructing);
-  }
-  return g__Arcadia_Object_type;
+  return Arcadia_registerObjectType(thread,
+                                    Arcadia_Names_getOrCreateName(thread, ObjectTypeName, sizeof(ObjectTypeName) - 1),
+                                    sizeof(Arcadia_Object), NULL,
+                                    sizeof(Arcadia_ObjectDispatch),
+                                    &_Arcadia_Object_typeOperations, &_Arcadia_Object_typeDestructing);
+}
+
+Arcadia_TypeValue
+_Arcadia_Object_getType
+  (
+    Arcadia_Thread* thread
+  )
+{
+  return Arcadia_getOrRegisterType(thread, &g__Arcadia_Object_type, &_Arcadia_Object_registerType);
 }
 
 void
@@ -576,6 +885,10 @@ Arcadia_Object_isEqualTo
   assert(((Arcadia_ObjectDispatch*)objectDispatch)->type == type);
   assert(NULL != objectDispatch->isEqualTo);
 
+  if (objectDispatch->isEqualTo == &Arcadia_Object_isEqualToProcedure) {
+    return objectDispatch->isEqualToFunction(thread, self, other);
+  }
+
   Arcadia_Value temporary = Arcadia_Value_makeObjectReferenceValue(self);
   Arcadia_Natural8Value n = Arcadia_ValueStack_getSize(thread);
   Arcadia_ValueStack_pushValue(thread, &temporary);
@@ -612,6 +925,10 @@ Arcadia_Object_isNotEqualTo
   assert(((Arcadia_ObjectDispatch*)objectDispatch)->type == type);
   assert(NULL != objectDispatch->isNotEqualTo);
 
+  if (objectDispatch->isNotEqualTo == &Arcadia_Object_isNotEqualToProcedure) {
+    return objectDispatch->isNotEqualToFunction(thread, self, other);
+  }
+
   Arcadia_Value temporary = Arcadia_Value_makeObjectReferenceValue(self);
   Arcadia_Natural8Value n = Arcadia_ValueStack_getSize(thread);
   Arcadia_ValueStack_pushValue(thread, &temporary);
@@ -642,6 +959,11 @@ Arcadia_Object_getHash
   Arcadia_ObjectDispatch* objectDispatch = (Arcadia_ObjectDispatch*)Arcadia_ObjectType_getDispatch(type);
   assert(NULL != objectDispatch);
   assert(((Arcadia_ObjectDispatch*)objectDispatch)->type == type);
+  assert(NULL != objectDispatch->getHash);
+
+  if (objectDispatch->getHash == &Arcadia_Object_getHashProcedure) {
+    return objectDispatch->getHashFunction(thread, self);
+  }
 
   Arcadia_Value temporary = Arcadia_Value_makeObjectReferenceValue(self);
   Arcadia_Natural8Value n = Arcadia_ValueStack_getSize(thread);
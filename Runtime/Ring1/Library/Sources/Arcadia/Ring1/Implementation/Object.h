@@ -44,6 +44,14 @@ typedef struct Arcadia_ObjectDispatch {
   Arcadia_ForeignProcedure* subtract;
   Arcadia_ForeignProcedure* toString;
 
+  // Direct-call variants of "getHash", "isEqualTo", and "isNotEqualTo".
+  // These are invoked without going through the value stack if the corresponding procedure above is
+  // Arcadia_Object_getHashProcedure, Arcadia_Object_isEqualToProcedure, or Arcadia_Object_isNotEqualToProcedure, respectively.
+  // Otherwise the procedure was overridden (e.g., by a script) and the value stack protocol is used.
+  Arcadia_SizeValue (*getHashFunction)(Arcadia_Thread* thread, Arcadia_Object* self);
+  Arcadia_BooleanValue (*isEqualToFunction)(Arcadia_Thread* thread, Arcadia_Object* self, Arcadia_Value const* other);
+  Arcadia_BooleanValue (*isNotEqualToFunction)(Arcadia_Thread* thread, Arcadia_Object* self, Arcadia_Value const* other);
+
 } Arcadia_ObjectDispatch;
 
 Arcadia_TypeValue
@@ -88,31 +96,37 @@ struct Arcadia_Object {
     g_##_cName##_type = NULL; \
   } \
   \
+  static Arcadia_TypeValue \
+  _##_cName##_registerType \
+    ( \
+      Arcadia_Thread* thread \
+    ) \
+  { \
+    Arcadia_TypeValue parentType = _##_cParentName##_getType(thread); \
+    return Arcadia_registerObjectType \
+      ( \
+        thread, \
+        Arcadia_Names_getOrCreateName \
+          ( \
+            thread, \
+            _cilName, \
+            sizeof(_cilName) - 1 \
+          ), \
+        sizeof(_cName), \
+        parentType, \
+        sizeof(_cName##Dispatch), \
+        _cTypeOperations, \
+        &_##_cName##_typeDestructing \
+      ); \
+  } \
+  \
   Arcadia_TypeValue \
   _##_cName##_getType \
     ( \
       Arcadia_Thread* thread \
     ) \
   { \
-    if (!g_##_cName##_type) { \
-      Arcadia_TypeValue parentType = _##_cParentName##_getType(thread); \
-      g_##_cName##_type = Arcadia_registerObjectType \
-        ( \
-          thread, \
-          Arcadia_Names_getOrCreateName \
-            ( \
-              thread, \
-              _cilName, \
-              sizeof(_cilName) - 1 \
-            ), \
-          sizeof(_cName), \
-          parentType, \
-          sizeof(_cName##Dispatch), \
-          _cTypeOperations, \
-          &_##_cName##_typeDestructing \
-        ); \
-    } \
-    return g_##_cName##_type; \
+    return Arcadia_getOrRegisterType(thread, &g_##_cName##_type, &_##_cName##_registerType); \
   }
 
 
@@ -144,6 +158,76 @@ ARCADIA_CREATEOBJECT0
 #define ARCADIA_CREATEOBJECT(type) \
   return ARCADIA_CREATEOBJECT0(thread, _##type##_getType(thread), oldValueStackSize);
 
+/// The maximum number of argument values a native constructor receives if it is invoked via the value stack protocol.
+#define Arcadia_Object_MaximumNumberOfNativeArgumentValues (16)
+
+/// @brief
+/// Create an "Arcadia.Object" or derived type value using native constructors.
+///
+/// @details
+/// Like ARCADIA_CREATEOBJECT0 except for
+/// - the argument values are passed directly and not via the value stack,
+/// - the native construct callback functions are invoked,
+///   a native construct callback function invokes the native construct callback function of its parent type directly,
+/// - the type "type" is locked once and not once per level of the type hierarchy.
+///
+/// If an object type in the type hierarchy of "type" has no native construct callback function,
+/// then its construct callback function is invoked via the value stack protocol.
+///
+/// Raise "Arcadia.Status.OperationInvalid" if "type" has no native construct callback function.
+void*
+Arcadia_Object_createNative
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Type* type,
+    Arcadia_SizeValue numberOfArgumentValues,
+    Arcadia_Value const* argumentValues
+  );
+
+/// @brief
+/// Create an "Arcadia.Object" or derived type value using native constructors.
+/// The memory of the object is followed by the specified number of Bytes.
+///
+/// @details
+/// Like Arcadia_Object_createNative.
+/// The trailing Bytes start at the address (char*)self + Arcadia_ObjectType_getValueSize(type).
+/// They are not initialized, not visited, and owned by the object (no separate allocation is required for them).
+void*
+Arcadia_Object_createNativeWithTrailingBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Type* type,
+    Arcadia_SizeValue numberOfTrailingBytes,
+    Arcadia_SizeValue numberOfArgumentValues,
+    Arcadia_Value const* argumentValues
+  );
+
+/// @brief Invoke the native constructor of the parent type of "type" on an object.
+/// @param self A pointer to the object.
+/// @param type The type of the invoking native constructor.
+void
+Arcadia_Object_constructNativeSuper
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Object* self,
+    Arcadia_TypeValue type,
+    Arcadia_SizeValue numberOfArgumentValues,
+    Arcadia_Value const* argumentValues
+  );
+
+/// @brief Invoke the native constructor of the type "type" on an object using the arguments on the value stack.
+/// @details
+/// The construct callback function of an object type with a native construct callback function delegates to this function.
+/// It accepts the arguments like a construct callback function and pops them from the value stack.
+/// Raise "Arcadia.Status.NumberOfArgumentsInvalid" if there are more than Arcadia_Object_MaximumNumberOfNativeArgumentValues arguments.
+void
+Arcadia_Object_constructNativeFromValueStack
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Object* self,
+    Arcadia_TypeValue type
+  );
+
 void
 Arcadia_Object_setType
   (
@@ -152,6 +236,19 @@ Arcadia_Object_setType
     Arcadia_TypeValue type
   );
 
+/// @brief Assign an object under native construction its type.
+/// @details
+/// In contrast to Arcadia_Object_setType, the type is not locked.
+/// The type the object is created with is locked instead.
+/// @warning Only invoke this from a native constructor (see Arcadia_LeaveNativeConstructor).
+void
+Arcadia_Object_setNativelyConstructedType
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Object* self,
+    Arcadia_TypeValue type
+  );
+
 /// @brief Visit an object.
 /// @param self A pointer to the object.
 void
@@ -244,6 +341,27 @@ Arcadia_Object_isInstanceOf
   )
 { return Arcadia_Type_isDescendantType(thread, Arcadia_Object_getType(thread, object), type); }
 
+/// The value stack procedure for "getHash" which forwards to Arcadia_ObjectDispatch.getHashFunction.
+void
+Arcadia_Object_getHashProcedure
+  (
+    Arcadia_Thread* thread
+  );
+
+/// The value stack procedure for "isEqualTo" which forwards to Arcadia_ObjectDispatch.isEqualToFunction.
+void
+Arcadia_Object_isEqualToProcedure
+  (
+    Arcadia_Thread* thread
+  );
+
+/// The value stack procedure for "isNotEqualTo" which forwards to Arcadia_ObjectDispatch.isNotEqualToFunction.
+void
+Arcadia_Object_isNotEqualToProcedure
+  (
+    Arcadia_Thread* thread
+  );
+
 /// "isEqualTo"
 Arcadia_BooleanValue
 Arcadia_Object_isEqualTo
@@ -313,4 +431,16 @@ Arcadia_Object_toString
   Arcadia_Object_setType(thread, (Arcadia_Object*)self, _type); \
   Arcadia_ValueStack_popValues(thread, _numberOfArguments + 1);
 
+/// Utility macro to define the header of a native constructor.
+#define Arcadia_EnterNativeConstructor(Type) \
+  Arcadia_TypeValue _type = _##Type##_getType(thread);
+
+/// Utility macro to invoke the native constructor of the parent type in a native constructor.
+#define Arcadia_superTypeNativeConstructor(_thread, _type, _self, _numberOfArgumentValues, _argumentValues) \
+  Arcadia_Object_constructNativeSuper(_thread, (Arcadia_Object*)_self, _type, _numberOfArgumentValues, _argumentValues);
+
+/// Utility macro to define the footer of a native constructor.
+#define Arcadia_LeaveNativeConstructor(Type) \
+  Arcadia_Object_setNativelyConstructedType(thread, (Arcadia_Object*)self, _type);
+
 #endif // ARCADIA_RING1_IMPLEMENTATION_OBJECT_H_INCLUDED
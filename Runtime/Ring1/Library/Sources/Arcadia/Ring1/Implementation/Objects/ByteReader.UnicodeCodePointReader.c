@@ -124,8 +124,9 @@ Arcadia_ByteReader_UnicodeCodePointReader_constructImpl
   self->codePointByteIndex = 0;
   self->codePointByteLength = 0;
   self->source = (Arcadia_ByteReader*)Arcadia_ValueStack_getObjectReferenceValueChecked(thread, 1, _Arcadia_ByteReader_getType(thread));
-  self->numberOfBytes = 0;
-  self->bytes[0] = self->bytes[1] = self->bytes[2] = self->bytes[3] = 0;
+  self->start = 0;
+  self->end = 0;
+  self->asciiRun = 0;
   next(thread, self);
   Arcadia_LeaveConstructor(Arcadia_ByteReader_UnicodeCodePointReader);
 }
@@ -158,6 +159,60 @@ Arcadia_ByteReader_UnicodeCodePointReader_visit
 
 #include <memory.h>
 
+// Get the number of leading ASCII Bytes of the specified Bytes.
+static Arcadia_SizeValue
+countAscii
+  (
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  Arcadia_SizeValue i = 0;
+  // A Byte is ASCII if its most significant bit is not set.
+  // Test eight Bytes at a time as long as possible.
+  for (; i + 8 <= numberOfBytes; i += 8) {
+    Arcadia_Natural64Value x;
+    memcpy(&x, bytes + i, 8);
+    if (x & UINT64_C(0x8080808080808080)) {
+      break;
+    }
+  }
+  while (i < numberOfBytes && bytes[i] < 0x80) {
+    i++;
+  }
+  return i;
+}
+
+// Move the undecoded Bytes to the front of the buffer and append as many Bytes of the source as fit into the buffer.
+static void
+fill
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteReader_UnicodeCodePointReader* self
+  )
+{
+  if (self->start > 0) {
+    memmove(&self->bytes[0], &self->bytes[self->start], self->end - self->start);
+    self->end -= self->start;
+    self->start = 0;
+  }
+  while (self->end < Arcadia_ByteReader_UnicodeCodePointReader_BufferSize) {
+    Arcadia_Natural8Value const* bytes = NULL;
+    Arcadia_SizeValue numberOfBytes = 0;
+    Arcadia_ByteReader_getSpan(thread, self->source, &bytes, &numberOfBytes);
+    if (!numberOfBytes) {
+      break;
+    }
+    if (numberOfBytes > Arcadia_ByteReader_UnicodeCodePointReader_BufferSize - self->end) {
+      numberOfBytes = Arcadia_ByteReader_UnicodeCodePointReader_BufferSize - self->end;
+    }
+    memcpy(&self->bytes[self->end], bytes, numberOfBytes);
+    Arcadia_ByteReader_advance(thread, self->source, numberOfBytes);
+    self->end += numberOfBytes;
+  }
+  self->asciiRun = countAscii(&self->bytes[self->start], self->end - self->start);
+}
+
 static void
 next
   (
@@ -175,25 +230,27 @@ next
     self->codePointByteLength = 0;
   }
   // Try to read at least one Byte.
-  if (!self->numberOfBytes) {
-    if (!Arcadia_ByteReader_hasValue(thread, self->source)) {
-      self->codePoint = FlagsEnd;
-      self->codePointByteLength = 0;
-      return;
-    }
-    self->bytes[self->numberOfBytes++] = Arcadia_ByteReader_getValue(thread, self->source);
-    Arcadia_ByteReader_nextValue(thread, self->source);
+  if (self->start == self->end) {
+    fill(thread, self);
   }
-  // If there are no Bytes, we reached the end or have an error. */
-  if (self->numberOfBytes == 0) {
+  // If there are no Bytes, we reached the end or have an error.
+  if (self->start == self->end) {
     if (Arcadia_ByteReader_hasError(thread, self->source)) {
       self->codePoint = FlagsError;
     } else {
       self->codePoint = FlagsEnd;
     }
+    self->codePointByteLength = 0;
+    return;
+  }
+  // Fast path: ASCII Bytes are decoded without further inspection.
+  if (self->asciiRun) {
+    self->codePoint = self->bytes[self->start++];
+    self->codePointByteLength = 1;
+    self->asciiRun--;
     return;
   }
-  uint8_t byte = self->bytes[0];
+  Arcadia_Natural8Value byte = self->bytes[self->start];
   self->codePointByteLength = 0;
   if ((byte & 0x80) == 0x00) {
     // To determine if the first Byte is in the range 0xxx xxxx,
@@ -220,11 +277,10 @@ next
     self->codePointByteLength = 0;
     return;
   }
-  while (self->codePointByteLength > self->numberOfBytes && Arcadia_ByteReader_hasValue(thread, self->source)) {
-    self->bytes[self->numberOfBytes++] = Arcadia_ByteReader_getValue(thread, self->source);
-    Arcadia_ByteReader_nextValue(thread, self->source); 
+  if (self->codePointByteLength > self->end - self->start) {
+    fill(thread, self);
   }
-  if (self->codePointByteLength > self->numberOfBytes) {
+  if (self->codePointByteLength > self->end - self->start) {
     // This is actually a short read and might be recoverable.
     self->codePoint = FlagsShortRead;
     self->codePointByteLength = 0;
@@ -239,9 +295,10 @@ next
     0b00000111,
   };
   
-  self->codePoint = self->bytes[0] & mask[self->codePointByteLength - 1];
+  Arcadia_Natural8Value const* bytes = &self->bytes[self->start];
+  self->codePoint = bytes[0] & mask[self->codePointByteLength - 1];
   for (Arcadia_SizeValue i = 1; i < self->codePointByteLength; ++i) {
-    byte = self->bytes[0 + i]; // We need to mask with 0011 1111
+    byte = bytes[i]; // We need to mask with 0011 1111
     if (0x80 != (byte & 0xC0)) {
       self->codePoint = FlagsError;
       self->codePointByteLength = 0;
@@ -255,14 +312,14 @@ next
   if (self->codePointByteLength == 1 && self->codePoint <= 0x7f) {
   } else if (self->codePointByteLength == 2 && 0x80 <= self->codePoint && self->codePoint <= 0x7ff) {
   } else if (self->codePointByteLength == 3 && 0x800 <= self->codePoint && self->codePoint <= 0xffff) {
-  } else if (self->codePointByteLength == 4 && 0x10000 <= self->codePoint && self->codePoint > 0x10ffff) {
+  } else if (self->codePointByteLength == 4 && 0x10000 <= self->codePoint && self->codePoint <= 0x10ffff) {
   } else {
     self->codePoint = FlagsError;
     self->codePointByteLength = 0;
     return;
   }
-  memmove(&self->bytes[0], &self->bytes[self->codePointByteLength], self->numberOfBytes - self->codePointByteLength);
-  self->numberOfBytes -= self->codePointByteLength;
+  self->start += self->codePointByteLength;
+  self->asciiRun = countAscii(&self->bytes[self->start], self->end - self->start);
 }
 
 static void
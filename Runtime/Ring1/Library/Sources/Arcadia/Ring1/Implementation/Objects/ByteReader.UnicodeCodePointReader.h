@@ -23,6 +23,9 @@
 #include "Arcadia/Ring1/Implementation/Objects/UnicodeCodePointReader.h"
 typedef struct Arcadia_ByteReader Arcadia_ByteReader;
 
+/// The number of Bytes a Arcadia.ByteReader.UnicodeCodePointReader reads ahead of the code point it decodes.
+#define Arcadia_ByteReader_UnicodeCodePointReader_BufferSize (256)
+
 /// @code
 /// class Arcadia.ByteReader.UnicodeCodePointReader extends Arcadia.UnicodeCodePointReader {
 ///   construct(source:Arcadia.ByteReader)
@@ -44,8 +47,12 @@ struct Arcadia_ByteReader_UnicodeCodePointReader {
 
   Arcadia_ByteReader* source;
 
-  Arcadia_SizeValue numberOfBytes;
-  Arcadia_Natural8Value bytes[4];
+  /// The Bytes read from the source but not yet decoded are bytes[start, end).
+  Arcadia_SizeValue start;
+  Arcadia_SizeValue end;
+  /// The number of Bytes starting at bytes[start] which are known to be ASCII.
+  Arcadia_SizeValue asciiRun;
+  Arcadia_Natural8Value bytes[Arcadia_ByteReader_UnicodeCodePointReader_BufferSize];
 };
 
 Arcadia_ByteReader_UnicodeCodePointReader*
@@ -39,6 +39,23 @@ Arcadia_ByteReader_visit
     Arcadia_ByteReader* self
   );
 
+static void
+Arcadia_ByteReader_getSpanImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteReader* self,
+    Arcadia_Natural8Value const** bytes,
+    Arcadia_SizeValue* numberOfBytes
+  );
+
+static void
+Arcadia_ByteReader_advanceImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteReader* self,
+    Arcadia_SizeValue numberOfBytes
+  );
+
 static const Arcadia_ObjectType_Operations _objectTypeOperations = {
   Arcadia_ObjectType_Operations_Initializer,
   .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_ByteReader_construct,
@@ -71,6 +88,7 @@ Arcadia_ByteReader_construct
     Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
     Arcadia_Thread_jump(thread);
   }
+  self->spanByte = 0;
   Arcadia_LeaveConstructor(Arcadia_ByteReader);
 }
 
@@ -80,7 +98,10 @@ Arcadia_ByteReader_initializeDispatch
     Arcadia_Thread* thread,
     Arcadia_ByteReader* self
   )
-{/*Intentionally empty.*/}
+{
+  ((Arcadia_ByteReaderDispatch*)self)->getSpan = &Arcadia_ByteReader_getSpanImpl;
+  ((Arcadia_ByteReaderDispatch*)self)->advance = &Arcadia_ByteReader_advanceImpl;
+}
 
 static void
 Arcadia_ByteReader_visit
@@ -90,6 +111,43 @@ Arcadia_ByteReader_visit
   )
 {/*Intentionally empty.*/}
 
+static void
+Arcadia_ByteReader_getSpanImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteReader* self,
+    Arcadia_Natural8Value const** bytes,
+    Arcadia_SizeValue* numberOfBytes
+  )
+{
+  // Backends which do not provide a span are read through the per-Byte interface.
+  if (!Arcadia_ByteReader_hasValue(thread, self)) {
+    *bytes = NULL;
+    *numberOfBytes = 0;
+    return;
+  }
+  self->spanByte = Arcadia_ByteReader_getValue(thread, self);
+  *bytes = &self->spanByte;
+  *numberOfBytes = 1;
+}
+
+static void
+Arcadia_ByteReader_advanceImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteReader* self,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  for (; numberOfBytes > 0; --numberOfBytes) {
+    if (!Arcadia_ByteReader_hasValue(thread, self)) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_OperationInvalid);
+      Arcadia_Thread_jump(thread);
+    }
+    Arcadia_ByteReader_nextValue(thread, self);
+  }
+}
+
 Arcadia_BooleanValue
 Arcadia_ByteReader_hasValue
   (
@@ -121,3 +179,28 @@ Arcadia_ByteReader_nextValue
     Arcadia_ByteReader* self
   )
 { Arcadia_VirtualCall(Arcadia_ByteReader, nextValue, self); }
+
+void
+Arcadia_ByteReader_getSpan
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteReader* self,
+    Arcadia_Natural8Value const** bytes,
+    Arcadia_SizeValue* numberOfBytes
+  )
+{
+  if (!bytes || !numberOfBytes) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_VirtualCall(Arcadia_ByteReader, getSpan, self, bytes, numberOfBytes);
+}
+
+void
+Arcadia_ByteReader_advance
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteReader* self,
+    Arcadia_SizeValue numberOfBytes
+  )
+{ Arcadia_VirtualCall(Arcadia_ByteReader, advance, self, numberOfBytes); }
@@ -31,10 +31,14 @@ struct Arcadia_ByteReaderDispatch {
   Arcadia_BooleanValue (*hasError)(Arcadia_Thread*, Arcadia_ByteReader*);
   Arcadia_Natural8Value (*getValue)(Arcadia_Thread*, Arcadia_ByteReader*);
   void (*nextValue)(Arcadia_Thread*, Arcadia_ByteReader*);
+  void (*getSpan)(Arcadia_Thread*, Arcadia_ByteReader*, Arcadia_Natural8Value const**, Arcadia_SizeValue*);
+  void (*advance)(Arcadia_Thread*, Arcadia_ByteReader*, Arcadia_SizeValue);
 };
 
 struct Arcadia_ByteReader {
   Arcadia_Object _parent;
+  /// The Byte backing the one Byte span of the default implementation of getSpan.
+  Arcadia_Natural8Value spanByte;
 };
 
 Arcadia_BooleanValue
@@ -65,4 +69,36 @@ Arcadia_ByteReader_nextValue
     Arcadia_ByteReader* self
   );
 
+/// @brief Get the contiguous window of Bytes readable from the current position of this Byte reader.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this Byte reader.
+/// @param bytes A pointer to a variable receiving a pointer to the first Byte of the window.
+/// @param numberOfBytes A pointer to a variable receiving the number of Bytes of the window.
+/// The number of Bytes is zero if and only if this Byte reader has no value.
+/// @remarks
+/// The window remains valid until the next call to a function of this Byte reader or a modification of its source.
+/// The default implementation returns a window of at most one Byte.
+/// Backends over contiguous memory return all remaining Bytes.
+void
+Arcadia_ByteReader_getSpan
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteReader* self,
+    Arcadia_Natural8Value const** bytes,
+    Arcadia_SizeValue* numberOfBytes
+  );
+
+/// @brief Advance the current position of this Byte reader by the specified number of Bytes.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this Byte reader.
+/// @param numberOfBytes The number of Bytes.
+/// @error Arcadia_Status_OperationInvalid less than @a numberOfBytes Bytes are readable
+void
+Arcadia_ByteReader_advance
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteReader* self,
+    Arcadia_SizeValue numberOfBytes
+  );
+
 #endif // ARCADIA_RING1_IMPLEMENTATION_OBJECTS_BYTEREADER_H_INCLUDED
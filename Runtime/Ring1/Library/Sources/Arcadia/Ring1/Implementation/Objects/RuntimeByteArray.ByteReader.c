@@ -67,6 +67,23 @@ Arcadia_RuntimeByteArray_ByteReader_nextValueImpl
     Arcadia_RuntimeByteArray_ByteReader* self
   );
 
+static void
+Arcadia_RuntimeByteArray_ByteReader_getSpanImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_RuntimeByteArray_ByteReader* self,
+    Arcadia_Natural8Value const** bytes,
+    Arcadia_SizeValue* numberOfBytes
+  );
+
+static void
+Arcadia_RuntimeByteArray_ByteReader_advanceImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_RuntimeByteArray_ByteReader* self,
+    Arcadia_SizeValue numberOfBytes
+  );
+
 static const Arcadia_ObjectType_Operations _objectTypeOperations = {
   Arcadia_ObjectType_Operations_Initializer,
   .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_RuntimeByteArray_ByteReader_construct,
@@ -115,6 +132,8 @@ Arcadia_RuntimeByteArray_ByteReader_initializeDispatch
   ((Arcadia_ByteReaderDispatch*)self)->hasError = (Arcadia_BooleanValue(*)(Arcadia_Thread*, Arcadia_ByteReader*)) & Arcadia_RuntimeByteArray_ByteReader_hasErrorImpl;
   ((Arcadia_ByteReaderDispatch*)self)->hasValue = (Arcadia_BooleanValue(*)(Arcadia_Thread*, Arcadia_ByteReader*)) & Arcadia_RuntimeByteArray_ByteReader_hasValueImpl;
   ((Arcadia_ByteReaderDispatch*)self)->nextValue = (void(*)(Arcadia_Thread*, Arcadia_ByteReader*)) & Arcadia_RuntimeByteArray_ByteReader_nextValueImpl;
+  ((Arcadia_ByteReaderDispatch*)self)->getSpan = (void(*)(Arcadia_Thread*, Arcadia_ByteReader*, Arcadia_Natural8Value const**, Arcadia_SizeValue*)) & Arcadia_RuntimeByteArray_ByteReader_getSpanImpl;
+  ((Arcadia_ByteReaderDispatch*)self)->advance = (void(*)(Arcadia_Thread*, Arcadia_ByteReader*, Arcadia_SizeValue)) & Arcadia_RuntimeByteArray_ByteReader_advanceImpl;
 }
 
 static void
@@ -171,6 +190,41 @@ Arcadia_RuntimeByteArray_ByteReader_nextValueImpl
   self->index++;
 }
 
+static void
+Arcadia_RuntimeByteArray_ByteReader_getSpanImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_RuntimeByteArray_ByteReader* self,
+    Arcadia_Natural8Value const** bytes,
+    Arcadia_SizeValue* numberOfBytes
+  )
+{
+  Arcadia_SizeValue n = self->source->numberOfBytes;
+  if (self->index < n) {
+    *bytes = self->source->bytes + self->index;
+    *numberOfBytes = n - self->index;
+  } else {
+    *bytes = NULL;
+    *numberOfBytes = 0;
+  }
+}
+
+static void
+Arcadia_RuntimeByteArray_ByteReader_advanceImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_RuntimeByteArray_ByteReader* self,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  Arcadia_SizeValue n = self->source->numberOfBytes;
+  if (self->index > n || numberOfBytes > n - self->index) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_OperationInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->index += numberOfBytes;
+}
+
 Arcadia_RuntimeByteArray_ByteReader*
 Arcadia_RuntimeByteArray_ByteReader_create
   (
@@ -18,6 +18,19 @@
 
 #include <assert.h>
 #include "Arcadia/Ring1/Include.h"
+#include "Arcadia/Ring1/Implementation/Thread.module.h"
+#include "Arcadia/Ring1/Implementation/Concurrency/Atomic.h"
+#include "Arcadia/Ring1/Implementation/ImmutableUTF8String/find.h"
+#include "Arcadia/Ring1/Implementation/ImmutableUTF8String/toBoolean.h"
+#include "Arcadia/Ring1/Implementation/ImmutableUTF8String/toInteger.h"
+#include "Arcadia/Ring1/Implementation/ImmutableUTF8String/toNatural.h"
+#include "Arcadia/Ring1/Implementation/ImmutableUTF8String/toVoid.h"
+
+#include "Arcadia/Ring1/Implementation/BooleanToString/Include.h"
+#include "Arcadia/Ring1/Implementation/IntegerToString/Include.h"
+#include "Arcadia/Ring1/Implementation/NaturalToString/Include.h"
+#include "Arcadia/Ring1/Implementation/SizeToString/Include.h"
+#include "Arcadia/Ring1/Implementation/VoidToString/Include.h"
 
 static void
 Arcadia_String_constructImpl
@@ -26,6 +39,22 @@ Arcadia_String_constructImpl
     Arcadia_String* self
   );
 
+static void
+Arcadia_String_constructNativeImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* self,
+    Arcadia_SizeValue numberOfArgumentValues,
+    Arcadia_Value const* argumentValues
+  );
+
+static void
+Arcadia_String_destruct
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* self
+  );
+
 static void
 Arcadia_String_initializeDispatchImpl
   (
@@ -33,22 +62,36 @@ Arcadia_String_initializeDispatchImpl
     Arcadia_StringDispatch* self
   );
 
-static void
+static Arcadia_BooleanValue
 isEqualToImpl
   (
-    Arcadia_Thread* thread
+    Arcadia_Thread* thread,
+    Arcadia_String* self,
+    Arcadia_Value const* other
   );
 
-static void
+static Arcadia_SizeValue
 getHashImpl
   (
-    Arcadia_Thread* thread
+    Arcadia_Thread* thread,
+    Arcadia_String* self
   );
 
-static void
+// Store the hash of the string in *hash and return Arcadia_BooleanValue_True if the hash was computed.
+// Return Arcadia_BooleanValue_False otherwise.
+static inline Arcadia_BooleanValue
+tryGetHash
+  (
+    Arcadia_String const* self,
+    Arcadia_SizeValue* hash
+  );
+
+static Arcadia_BooleanValue
 isNotEqualToImpl
   (
-    Arcadia_Thread* thread
+    Arcadia_Thread* thread,
+    Arcadia_String* self,
+    Arcadia_Value const* other
   );
 
 static void
@@ -61,6 +104,8 @@ Arcadia_String_visit
 static const Arcadia_ObjectType_Operations _objectTypeOperations = {
   Arcadia_ObjectType_Operations_Initializer,
   .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_String_constructImpl,
+  .constructNative = (Arcadia_Object_ConstructNativeCallbackFunction*)&Arcadia_String_constructNativeImpl,
+  .destruct = (Arcadia_Object_DestructCallbackFunction*)&Arcadia_String_destruct,
   .visit = (Arcadia_Object_VisitCallbackFunction*)&Arcadia_String_visit,
   .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_String_initializeDispatchImpl,
 };
@@ -70,35 +115,13 @@ static const Arcadia_Type_Operations _typeOperations = {
   .objectTypeOperations = &_objectTypeOperations,
 };
 
-#define BINARY_OPERATION() \
-  if (Arcadia_ValueStack_getSize(thread) < 3) { \
-    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid); \
-    Arcadia_Thread_jump(thread); \
-  } \
-  if (2 != Arcadia_ValueStack_getNatural8Value(thread, 0)) { \
-    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid); \
-    Arcadia_Thread_jump(thread); \
-  } \
-  Arcadia_Value x = Arcadia_ValueStack_getValue(thread, 2); \
-  Arcadia_Value y = Arcadia_ValueStack_getValue(thread, 1); \
-  Arcadia_ValueStack_popValues(thread, 3);
-
-#define UNARY_OPERATION() \
-  if (Arcadia_ValueStack_getSize(thread) < 2) { \
-    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid); \
-    Arcadia_Thread_jump(thread); \
-  } \
-  if (1 != Arcadia_ValueStack_getNatural8Value(thread, 0)) { \
-    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid); \
-    Arcadia_Thread_jump(thread); \
-  } \
-  Arcadia_Value x = Arcadia_ValueStack_getValue(thread, 1); \
-  Arcadia_ValueStack_popValues(thread, 2);
-
 Arcadia_defineObjectType(u8"Arcadia.String", Arcadia_String,
                          u8"Arcadia.Object", Arcadia_Object,
                          &_typeOperations);
 
+// The Bytes of empty strings.
+static const Arcadia_Natural8Value g_emptyBytes[] = { 0 };
+
 #define On(Type, Suffix) \
   static void \
   from##Suffix \
@@ -142,15 +165,46 @@ fromImmutableByteArray
       );
 }
 
+// Let "self" share the storage of "source".
+// The owner of a slice is never a slice itself such that chains of slices do not keep intermediate strings alive.
 static void
-fromRuntimeUTF8String
+shareStorage
   (
     Arcadia_Thread* thread,
-    Arcadia_RuntimeUTF8String** pRuntimeUTF8String,
-    Arcadia_RuntimeUTF8String* value
+    Arcadia_String* self,
+    Arcadia_String* source
   )
 {
-  *pRuntimeUTF8String = value;
+  if (Arcadia_StringStorage_RuntimeUTF8String == source->storage) {
+    self->storage = Arcadia_StringStorage_RuntimeUTF8String;
+    self->owner.runtimeUTF8String = source->owner.runtimeUTF8String;
+  } else if (Arcadia_StringStorage_Slice == source->storage) {
+    self->storage = Arcadia_StringStorage_Slice;
+    self->owner.string = source->owner.string;
+  } else {
+    self->storage = Arcadia_StringStorage_Slice;
+    self->owner.string = source;
+  }
+  thread->stringStatistics.numberOfSharedStrings++;
+}
+
+// Let "self" share the Bytes of "source".
+static void
+shareRuntimeUTF8String
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* self,
+    Arcadia_RuntimeUTF8String* source
+  )
+{
+  self->bytes = Arcadia_RuntimeUTF8String_getBytes(thread, source);
+  self->numberOfBytes = Arcadia_RuntimeUTF8String_getNumberOfBytes(thread, source);
+  // The hashes of runtime UTF-8 strings are computed eagerly.
+  self->hash = Arcadia_RuntimeUTF8String_getHash(thread, source);
+  self->hasHash = 1;
+  self->numberOfCodePoints = Arcadia_SizeValue_Maximum;
+  self->storage = Arcadia_StringStorage_RuntimeUTF8String;
+  self->owner.runtimeUTF8String = source;
 }
 
 static void
@@ -160,43 +214,69 @@ Arcadia_String_constructImpl
     Arcadia_String* self
   )
 {
-  Arcadia_EnterConstructor(Arcadia_String);
-  {
-    Arcadia_ValueStack_pushNatural8Value(thread, 0);
-    Arcadia_superTypeConstructor(thread, _type, self);
-  }
-  if (1 != _numberOfArguments) {
+  Arcadia_Object_constructNativeFromValueStack(thread, (Arcadia_Object*)self, _Arcadia_String_getType(thread));
+}
+
+static void
+Arcadia_String_constructNativeImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* self,
+    Arcadia_SizeValue numberOfArgumentValues,
+    Arcadia_Value const* argumentValues
+  )
+{
+  Arcadia_EnterNativeConstructor(Arcadia_String);
+  Arcadia_superTypeNativeConstructor(thread, _type, self, 0, NULL);
+  // Without arguments, the string is the empty string.
+  // The functions of this file creating inline strings and slices assign the Bytes afterwards.
+  if (1 < numberOfArgumentValues) {
     Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
     Arcadia_Thread_jump(thread);
   }
-  Arcadia_Value x = Arcadia_ValueStack_getValue(thread, 1);
+  self->bytes = g_emptyBytes;
+  self->numberOfBytes = 0;
+  self->hash = 0;
+  self->numberOfCodePoints = 0;
+  self->hasHash = 0;
+  self->storage = Arcadia_StringStorage_Inline;
+  self->owner.string = NULL;
+  thread->stringStatistics.numberOfStrings++;
+  thread->stringStatistics.numberOfAllocations++;
+  if (0 == numberOfArgumentValues) {
+    Arcadia_LeaveNativeConstructor(Arcadia_String);
+    return;
+  }
+  Arcadia_Value x = argumentValues[0];
+  Arcadia_RuntimeUTF8String* runtimeUTF8String = NULL;
   if (Arcadia_Value_isBooleanValue(&x)) {
-    fromBoolean(thread, &self->immutableUTF8String, Arcadia_Value_getBooleanValue(&x));
+    fromBoolean(thread, &runtimeUTF8String, Arcadia_Value_getBooleanValue(&x));
   } else if (Arcadia_Value_isInteger16Value(&x)) {
-    fromInteger16(thread, &self->immutableUTF8String, Arcadia_Value_getInteger16Value(&x));
+    fromInteger16(thread, &runtimeUTF8String, Arcadia_Value_getInteger16Value(&x));
   } else if (Arcadia_Value_isInteger32Value(&x)) {
-    fromInteger32(thread, &self->immutableUTF8String, Arcadia_Value_getInteger32Value(&x));
+    fromInteger32(thread, &runtimeUTF8String, Arcadia_Value_getInteger32Value(&x));
   } else if (Arcadia_Value_isInteger64Value(&x)) {
-    fromInteger64(thread, &self->immutableUTF8String, Arcadia_Value_getInteger64Value(&x));
+    fromInteger64(thread, &runtimeUTF8String, Arcadia_Value_getInteger64Value(&x));
   } else if (Arcadia_Value_isInteger8Value(&x)) {
-    fromInteger8(thread, &self->immutableUTF8String, Arcadia_Value_getInteger8Value(&x));
+    fromInteger8(thread, &runtimeUTF8String, Arcadia_Value_getInteger8Value(&x));
   } else if (Arcadia_Value_isNatural16Value(&x)) {
-    fromNatural16(thread, &self->immutableUTF8String, Arcadia_Value_getNatural16Value(&x));
+    fromNatural16(thread, &runtimeUTF8String, Arcadia_Value_getNatural16Value(&x));
   } else if (Arcadia_Value_isNatural32Value(&x)) {
-    fromNatural32(thread, &self->immutableUTF8String, Arcadia_Value_getNatural32Value(&x));
+    fromNatural32(thread, &runtimeUTF8String, Arcadia_Value_getNatural32Value(&x));
   } else if (Arcadia_Value_isNatural64Value(&x)) {
-    fromNatural64(thread, &self->immutableUTF8String, Arcadia_Value_getNatural64Value(&x));
+    fromNatural64(thread, &runtimeUTF8String, Arcadia_Value_getNatural64Value(&x));
   } else if (Arcadia_Value_isNatural8Value(&x)) {
-    fromNatural8(thread, &self->immutableUTF8String, Arcadia_Value_getNatural8Value(&x));
-  } if (Arcadia_Value_isRuntimeByteArrayValue(&x)) {
-    fromImmutableByteArray(thread, &self->immutableUTF8String, Arcadia_Value_getRuntimeByteArrayValue(&x));
+    fromNatural8(thread, &runtimeUTF8String, Arcadia_Value_getNatural8Value(&x));
+  } else if (Arcadia_Value_isRuntimeByteArrayValue(&x)) {
+    fromImmutableByteArray(thread, &runtimeUTF8String, Arcadia_Value_getRuntimeByteArrayValue(&x));
   } else if (Arcadia_Value_isRuntimeUTF8StringValue(&x)) {
-    fromRuntimeUTF8String(thread, &self->immutableUTF8String, Arcadia_Value_getRuntimeUTF8StringValue(&x));
+    shareRuntimeUTF8String(thread, self, Arcadia_Value_getRuntimeUTF8StringValue(&x));
+    thread->stringStatistics.numberOfSharedStrings++;
   } else if (Arcadia_Value_isObjectReferenceValue(&x)) {
     Arcadia_ObjectReferenceValue referenceValue = Arcadia_Value_getObjectReferenceValue(&x);
     if (Arcadia_Type_isDescendantType(thread, Arcadia_Object_getType(thread, referenceValue), _Arcadia_ByteArrayBuilder_getType(thread))) {
       Arcadia_ByteArrayBuilder* object = (Arcadia_ByteArrayBuilder*)referenceValue;
-      self->immutableUTF8String =
+      runtimeUTF8String =
         Arcadia_RuntimeUTF8String_create
           (
             thread,
@@ -205,21 +285,51 @@ Arcadia_String_constructImpl
           );
     } else if (Arcadia_Type_isDescendantType(thread, Arcadia_Object_getType(thread, referenceValue), _Arcadia_String_getType(thread))) {
       Arcadia_String* object = (Arcadia_String*)referenceValue;
-      self->immutableUTF8String = object->immutableUTF8String;
+      self->bytes = object->bytes;
+      self->numberOfBytes = object->numberOfBytes;
+      Arcadia_SizeValue hash;
+      if (tryGetHash(object, &hash)) {
+        self->hash = hash;
+        self->hasHash = 1;
+      }
+      self->numberOfCodePoints = Arcadia_Memory_atomicLoadSize(&object->numberOfCodePoints);
+      shareStorage(thread, self, object);
     } else if (Arcadia_Type_isDescendantType(thread, Arcadia_Object_getType(thread, referenceValue), _Arcadia_StringBuilder_getType(thread))) {
       Arcadia_StringBuilder* object = (Arcadia_StringBuilder*)referenceValue;
-      self->immutableUTF8String = Arcadia_RuntimeUTF8String_create(thread, Arcadia_StringBuilder_getBytes(thread, object), Arcadia_StringBuilder_getNumberOfBytes(thread, object));
+      runtimeUTF8String = Arcadia_RuntimeUTF8String_create(thread, Arcadia_StringBuilder_getBytes(thread, object), Arcadia_StringBuilder_getNumberOfBytes(thread, object));
     } else {
       Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentTypeInvalid);
       Arcadia_Thread_jump(thread);
     }
   } else if (Arcadia_Value_isVoidValue(&x)) {
-    fromVoid(thread, &self->immutableUTF8String, Arcadia_Value_getVoidValue(&x));
+    fromVoid(thread, &runtimeUTF8String, Arcadia_Value_getVoidValue(&x));
   } else {
     Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentTypeInvalid);
     Arcadia_Thread_jump(thread);
   }
-  Arcadia_LeaveConstructor(Arcadia_String);
+  if (runtimeUTF8String) {
+    // The value was converted into a runtime UTF-8 string.
+    // This is the slow path of callers using the value stack protocol: Arcadia_String_create stores such strings inline.
+    shareRuntimeUTF8String(thread, self, runtimeUTF8String);
+    thread->stringStatistics.numberOfAllocations++;
+    thread->stringStatistics.numberOfCopiedBytes += self->numberOfBytes;
+  }
+  Arcadia_LeaveNativeConstructor(Arcadia_String);
+}
+
+static void
+Arcadia_String_destruct
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* self
+  )
+{
+  if (Arcadia_StringStorage_Buffer == self->storage) {
+    Arcadia_Memory_deallocateUnmanaged(thread, (void*)self->bytes);
+    self->bytes = g_emptyBytes;
+    self->numberOfBytes = 0;
+    self->storage = Arcadia_StringStorage_Inline;
+  }
 }
 
 static void
@@ -229,118 +339,203 @@ Arcadia_String_initializeDispatchImpl
     Arcadia_StringDispatch* self
   )
 {
-  ((Arcadia_ObjectDispatch*)self)->isEqualTo = &isEqualToImpl;
-  ((Arcadia_ObjectDispatch*)self)->getHash = &getHashImpl;
-  ((Arcadia_ObjectDispatch*)self)->isNotEqualTo = &isNotEqualToImpl;
+  ((Arcadia_ObjectDispatch*)self)->isEqualToFunction = (Arcadia_BooleanValue (*)(Arcadia_Thread*, Arcadia_Object*, Arcadia_Value const*))&isEqualToImpl;
+  ((Arcadia_ObjectDispatch*)self)->getHashFunction = (Arcadia_SizeValue (*)(Arcadia_Thread*, Arcadia_Object*))&getHashImpl;
+  ((Arcadia_ObjectDispatch*)self)->isNotEqualToFunction = (Arcadia_BooleanValue (*)(Arcadia_Thread*, Arcadia_Object*, Arcadia_Value const*))&isNotEqualToImpl;
 }
 
-static void
+static Arcadia_BooleanValue
 isEqualToImpl
   (
-    Arcadia_Thread* thread
+    Arcadia_Thread* thread,
+    Arcadia_String* self,
+    Arcadia_Value const* other
   )
 {
-  BINARY_OPERATION();
-  Arcadia_Object* a0 = Arcadia_Value_getObjectReferenceValue(&x);
-  if (!Arcadia_Value_isObjectReferenceValue(&y)) {
-    Arcadia_ValueStack_pushBooleanValue(thread, Arcadia_BooleanValue_False);
-    return;
+  if (!Arcadia_Value_isObjectReferenceValue(other)) {
+    return Arcadia_BooleanValue_False;
   }
-  Arcadia_Object* b0 = Arcadia_Value_getObjectReferenceValue(&y);
-  if (a0 == b0) {
-    Arcadia_ValueStack_pushBooleanValue(thread, Arcadia_BooleanValue_True);
-    return;
+  Arcadia_Object* other0 = Arcadia_Value_getObjectReferenceValue(other);
+  if ((Arcadia_Object*)self == other0) {
+    return Arcadia_BooleanValue_True;
   }
-  assert(NULL != b0);
-  assert(Arcadia_Object_isInstanceOf(thread, b0, _Arcadia_Object_getType(thread)));
-  if (!Arcadia_Type_isDescendantType(thread, Arcadia_Object_getType(thread, b0), _Arcadia_String_getType(thread))) {
-    Arcadia_ValueStack_pushBooleanValue(thread, Arcadia_BooleanValue_False);
-    return;
+  assert(NULL != other0);
+  assert(Arcadia_Object_isInstanceOf(thread, other0, _Arcadia_Object_getType(thread)));
+  if (!Arcadia_Type_isDescendantType(thread, Arcadia_Object_getType(thread, other0), _Arcadia_String_getType(thread))) {
+    return Arcadia_BooleanValue_False;
   }
-  Arcadia_String* a1 = (Arcadia_String*)a0;
-  Arcadia_String* b1 = (Arcadia_String*)b0;
-  if (Arcadia_RuntimeUTF8String_getNumberOfBytes(thread, a1->immutableUTF8String) ==
-      Arcadia_RuntimeUTF8String_getNumberOfBytes(thread, b1->immutableUTF8String) &&
-      Arcadia_RuntimeUTF8String_getHash(thread, a1->immutableUTF8String) ==
-      Arcadia_RuntimeUTF8String_getHash(thread, b1->immutableUTF8String)) {
-    Arcadia_ValueStack_pushBooleanValue
-      (
-        thread,
-        !Arcadia_Memory_compare
-          (
-            thread,
-            Arcadia_RuntimeUTF8String_getBytes(thread, a1->immutableUTF8String),
-            Arcadia_RuntimeUTF8String_getBytes(thread, b1->immutableUTF8String),
-            Arcadia_RuntimeUTF8String_getNumberOfBytes(thread, a1->immutableUTF8String)
-          )
-      );
-  } else {
-    Arcadia_ValueStack_pushBooleanValue(thread, Arcadia_BooleanValue_False);
+  Arcadia_String* other1 = (Arcadia_String*)other0;
+  if (self->numberOfBytes != other1->numberOfBytes) {
+    return Arcadia_BooleanValue_False;
+  }
+  // The hashes are computed lazily.
+  // Computing them is not cheaper than the byte-wise comparison, hence they are only compared if both are available.
+  Arcadia_SizeValue selfHash, otherHash;
+  if (tryGetHash(self, &selfHash) && tryGetHash(other1, &otherHash) && selfHash != otherHash) {
+    return Arcadia_BooleanValue_False;
+  }
+  if (self->bytes == other1->bytes) {
+    return Arcadia_BooleanValue_True;
   }
+  return !Arcadia_Memory_compare(thread, self->bytes, other1->bytes, self->numberOfBytes);
 }
 
-static void
+static inline Arcadia_BooleanValue
+tryGetHash
+  (
+    Arcadia_String const* self,
+    Arcadia_SizeValue* hash
+  )
+{
+  if (!Arcadia_Memory_atomicLoad32((uint32_t volatile*)&self->hasHash)) {
+    return Arcadia_BooleanValue_False;
+  }
+  *hash = Arcadia_Memory_atomicLoadSize((Arcadia_SizeValue volatile*)&self->hash);
+  return Arcadia_BooleanValue_True;
+}
+
+static Arcadia_SizeValue
 getHashImpl
   (
-    Arcadia_Thread* thread
+    Arcadia_Thread* thread,
+    Arcadia_String* self
   )
 {
-  UNARY_OPERATION();
-  Arcadia_String* self1 = (Arcadia_String*)Arcadia_Value_getObjectReferenceValue(&x);
-  Arcadia_ValueStack_pushSizeValue(thread, Arcadia_RuntimeUTF8String_getHash(thread, self1->immutableUTF8String));
+  Arcadia_SizeValue hash;
+  if (!tryGetHash(self, &hash)) {
+    // Concurrent threads may compute the hash at the same time. They store the same value.
+    hash = Arcadia_hashBytes(thread, self->bytes, self->numberOfBytes);
+    Arcadia_Memory_atomicStoreSize(&self->hash, hash);
+    Arcadia_Memory_atomicStore32(&self->hasHash, 1);
+  }
+  return hash;
 }
 
-static void
+static Arcadia_BooleanValue
 isNotEqualToImpl
   (
-    Arcadia_Thread* thread
+    Arcadia_Thread* thread,
+    Arcadia_String* self,
+    Arcadia_Value const* other
+  )
+{ return !isEqualToImpl(thread, self, other); }
+
+static void
+Arcadia_String_visit
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* string
   )
 {
-  BINARY_OPERATION();
-  Arcadia_Object* a0 = Arcadia_Value_getObjectReferenceValue(&x);
-  if (!Arcadia_Value_isObjectReferenceValue(&y)) {
-    Arcadia_ValueStack_pushBooleanValue(thread, Arcadia_BooleanValue_True);
-    return;
+  if (Arcadia_StringStorage_RuntimeUTF8String == string->storage) {
+    Arcadia_RuntimeUTF8String_visit(thread, string->owner.runtimeUTF8String);
+  } else if (Arcadia_StringStorage_Slice == string->storage) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)string->owner.string);
   }
-  Arcadia_Object* b0 = Arcadia_Value_getObjectReferenceValue(&y);
-  if (a0 == b0) {
-    Arcadia_ValueStack_pushBooleanValue(thread, Arcadia_BooleanValue_False);
-    return;
-  }
-  if (!Arcadia_Type_isDescendantType(thread, Arcadia_Object_getType(thread, b0), _Arcadia_String_getType(thread))) {
-    Arcadia_ValueStack_pushBooleanValue(thread, Arcadia_BooleanValue_True);
-    return;
+}
+
+// Create a string with inline storage for the specified number of Bytes.
+// The storage trails the string object, that is, it starts at (self + 1).
+static Arcadia_String*
+createInline
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes,
+    Arcadia_SizeValue numberOfCodePoints
+  )
+{
+  Arcadia_String* self = Arcadia_Object_createNativeWithTrailingBytes(thread, _Arcadia_String_getType(thread), numberOfBytes, 0, NULL);
+  Arcadia_Natural8Value* storage = (Arcadia_Natural8Value*)(self + 1);
+  Arcadia_Memory_copy(thread, storage, bytes, numberOfBytes);
+  self->bytes = storage;
+  self->numberOfBytes = numberOfBytes;
+  self->numberOfCodePoints = numberOfCodePoints;
+  thread->stringStatistics.numberOfInlineStrings++;
+  thread->stringStatistics.numberOfCopiedBytes += numberOfBytes;
+  return self;
+}
+
+// Create a string with inline storage from the specified Bytes.
+// Raise Arcadia_Status_EncodingInvalid if the Bytes are not a valid UTF-8 sequence.
+static Arcadia_String*
+createInlineFromUTF8
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  Arcadia_SizeValue numberOfCodePoints;
+  if (!Arcadia_Unicode_isUTF8(thread, bytes, numberOfBytes, &numberOfCodePoints)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+    Arcadia_Thread_jump(thread);
   }
-  Arcadia_String* a1 = (Arcadia_String*)a0;
-  Arcadia_String* b1 = (Arcadia_String*)b0;
-  if (Arcadia_RuntimeUTF8String_getNumberOfBytes(thread, a1->immutableUTF8String) !=
-      Arcadia_RuntimeUTF8String_getNumberOfBytes(thread, b1->immutableUTF8String) ||
-      Arcadia_RuntimeUTF8String_getHash(thread, a1->immutableUTF8String) !=
-      Arcadia_RuntimeUTF8String_getHash(thread, b1->immutableUTF8String)) {
-    Arcadia_ValueStack_pushBooleanValue(thread, Arcadia_BooleanValue_True);
-    return;
+  return createInline(thread, bytes, numberOfBytes, numberOfCodePoints);
+}
+
+// Create a string sharing the Bytes [byteIndex, byteIndex + numberOfBytes) of the specified string.
+static Arcadia_String*
+createSlice
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* source,
+    Arcadia_SizeValue byteIndex,
+    Arcadia_SizeValue numberOfBytes,
+    Arcadia_SizeValue numberOfCodePoints
+  )
+{
+  Arcadia_String* self = Arcadia_Object_createNative(thread, _Arcadia_String_getType(thread), 0, NULL);
+  if (0 == numberOfBytes) {
+    // Do not keep the source alive for an empty string.
+    return self;
   }
-  Arcadia_ValueStack_pushBooleanValue
-    (
-      thread,
-      Arcadia_Memory_compare
-        (
-          thread,
-          Arcadia_RuntimeUTF8String_getBytes(thread, a1->immutableUTF8String),
-          Arcadia_RuntimeUTF8String_getBytes(thread, b1->immutableUTF8String),
-          Arcadia_RuntimeUTF8String_getNumberOfBytes(thread, a1->immutableUTF8String)
-        )
-    );
+  self->bytes = source->bytes + byteIndex;
+  self->numberOfBytes = numberOfBytes;
+  self->numberOfCodePoints = numberOfCodePoints;
+  shareStorage(thread, self, source);
+  return self;
+}
+
+// Create a string taking over an unmanaged buffer of a builder.
+// The builder receives a new empty buffer.
+static Arcadia_String*
+createFromBuffer
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value** buffer,
+    Arcadia_SizeValue numberOfBytes,
+    Arcadia_SizeValue numberOfCodePoints
+  )
+{
+  // Create the string and the new buffer before the buffer is taken over:
+  // If either allocation fails, then the builder is not modified.
+  Arcadia_String* self = Arcadia_Object_createNative(thread, _Arcadia_String_getType(thread), 0, NULL);
+  Arcadia_Natural8Value* newBuffer = Arcadia_Memory_allocateUnmanaged(thread, 0);
+  self->bytes = *buffer;
+  self->numberOfBytes = numberOfBytes;
+  self->numberOfCodePoints = numberOfCodePoints;
+  self->storage = Arcadia_StringStorage_Buffer;
+  *buffer = newBuffer;
+  thread->stringStatistics.numberOfTakenBuffers++;
+  return self;
 }
 
+typedef struct Context {
+  Arcadia_String* string;
+} Context;
+
 static void
-Arcadia_String_visit
+callback
   (
     Arcadia_Thread* thread,
-    Arcadia_String* string
+    Context* context,
+    const Arcadia_Natural8Value* p,
+    Arcadia_SizeValue n
   )
 {
-  Arcadia_RuntimeUTF8String_visit(thread, string->immutableUTF8String);
+  // The string representations of Boolean, number, and void values are ASCII.
+  context->string = createInline(thread, p, n, n);
 }
 
 Arcadia_String*
@@ -349,12 +544,7 @@ Arcadia_String_create_pn
     Arcadia_Thread* thread,
     Arcadia_RuntimeByteArray* runtimeByteArray
   )
-{
-  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
-  Arcadia_ValueStack_pushRuntimeByteArrayValue(thread, runtimeByteArray);
-  Arcadia_ValueStack_pushNatural8Value(thread, 1);
-  ARCADIA_CREATEOBJECT(Arcadia_String);
-}
+{ return createInlineFromUTF8(thread, Arcadia_RuntimeByteArray_getBytes(thread, runtimeByteArray), Arcadia_RuntimeByteArray_getNumberOfBytes(thread, runtimeByteArray)); }
 
 Arcadia_String*
 Arcadia_String_create
@@ -363,10 +553,41 @@ Arcadia_String_create
     Arcadia_Value value
   )
 {
-  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
-  Arcadia_ValueStack_pushValue(thread, &value);
-  Arcadia_ValueStack_pushNatural8Value(thread, 1);
-  ARCADIA_CREATEOBJECT(Arcadia_String);
+  // Values which are converted or copied are stored inline.
+  // Other values are passed to the constructor.
+  if (Arcadia_Value_isBooleanValue(&value)) {
+    return Arcadia_String_createFromBoolean(thread, Arcadia_Value_getBooleanValue(&value));
+  } else if (Arcadia_Value_isInteger16Value(&value)) {
+    return Arcadia_String_createFromInteger16(thread, Arcadia_Value_getInteger16Value(&value));
+  } else if (Arcadia_Value_isInteger32Value(&value)) {
+    return Arcadia_String_createFromInteger32(thread, Arcadia_Value_getInteger32Value(&value));
+  } else if (Arcadia_Value_isInteger64Value(&value)) {
+    return Arcadia_String_createFromInteger64(thread, Arcadia_Value_getInteger64Value(&value));
+  } else if (Arcadia_Value_isInteger8Value(&value)) {
+    return Arcadia_String_createFromInteger8(thread, Arcadia_Value_getInteger8Value(&value));
+  } else if (Arcadia_Value_isNatural16Value(&value)) {
+    return Arcadia_String_createFromNatural16(thread, Arcadia_Value_getNatural16Value(&value));
+  } else if (Arcadia_Value_isNatural32Value(&value)) {
+    return Arcadia_String_createFromNatural32(thread, Arcadia_Value_getNatural32Value(&value));
+  } else if (Arcadia_Value_isNatural64Value(&value)) {
+    return Arcadia_String_createFromNatural64(thread, Arcadia_Value_getNatural64Value(&value));
+  } else if (Arcadia_Value_isNatural8Value(&value)) {
+    return Arcadia_String_createFromNatural8(thread, Arcadia_Value_getNatural8Value(&value));
+  } else if (Arcadia_Value_isVoidValue(&value)) {
+    return Arcadia_String_createFromVoid(thread, Arcadia_Value_getVoidValue(&value));
+  } else if (Arcadia_Value_isRuntimeByteArrayValue(&value)) {
+    return Arcadia_String_create_pn(thread, Arcadia_Value_getRuntimeByteArrayValue(&value));
+  } else if (Arcadia_Value_isObjectReferenceValue(&value)) {
+    Arcadia_ObjectReferenceValue referenceValue = Arcadia_Value_getObjectReferenceValue(&value);
+    if (Arcadia_Type_isDescendantType(thread, Arcadia_Object_getType(thread, referenceValue), _Arcadia_ByteArrayBuilder_getType(thread))) {
+      Arcadia_ByteArrayBuilder* object = (Arcadia_ByteArrayBuilder*)referenceValue;
+      return createInlineFromUTF8(thread, Arcadia_ByteArrayBuilder_getBytes(thread, object), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, object));
+    } else if (Arcadia_Type_isDescendantType(thread, Arcadia_Object_getType(thread, referenceValue), _Arcadia_StringBuilder_getType(thread))) {
+      Arcadia_StringBuilder* object = (Arcadia_StringBuilder*)referenceValue;
+      return createInlineFromUTF8(thread, Arcadia_StringBuilder_getBytes(thread, object), Arcadia_StringBuilder_getNumberOfBytes(thread, object));
+    }
+  }
+  return Arcadia_Object_createNative(thread, _Arcadia_String_getType(thread), 1, &value);
 }
 
 Arcadia_BooleanValue
@@ -378,13 +599,11 @@ Arcadia_String_endsWith_pn
     Arcadia_SizeValue numberOfBytes
   )
 {
-  if (Arcadia_RuntimeUTF8String_getNumberOfBytes(thread, self->immutableUTF8String) < numberOfBytes) {
+  if (self->numberOfBytes < numberOfBytes) {
     return Arcadia_BooleanValue_False;
   }
-  Arcadia_SizeValue d = Arcadia_RuntimeUTF8String_getNumberOfBytes(thread, self->immutableUTF8String) - numberOfBytes;
-  return !Arcadia_Memory_compare(thread,
-                                 Arcadia_RuntimeUTF8String_getBytes(thread, self->immutableUTF8String) + d,
-                                 bytes, numberOfBytes);
+  Arcadia_SizeValue d = self->numberOfBytes - numberOfBytes;
+  return !Arcadia_Memory_compare(thread, self->bytes + d, bytes, numberOfBytes);
 }
 
 Arcadia_BooleanValue
@@ -396,12 +615,10 @@ Arcadia_String_startsWith_pn
     Arcadia_SizeValue numberOfBytes
   )
 {
-  if (Arcadia_RuntimeUTF8String_getNumberOfBytes(thread, self->immutableUTF8String) < numberOfBytes) {
+  if (self->numberOfBytes < numberOfBytes) {
     return Arcadia_BooleanValue_False;
   }
-  return !Arcadia_Memory_compare(thread,
-                                 Arcadia_RuntimeUTF8String_getBytes(thread, self->immutableUTF8String),
-                                 bytes, numberOfBytes);
+  return !Arcadia_Memory_compare(thread, self->bytes, bytes, numberOfBytes);
 }
 
 Arcadia_SizeValue
@@ -410,9 +627,7 @@ Arcadia_String_getNumberOfBytes
     Arcadia_Thread* thread,
     Arcadia_String const* self
   )
-{
-  return Arcadia_RuntimeUTF8String_getNumberOfBytes(thread, self->immutableUTF8String);
-}
+{ return self->numberOfBytes; }
 
 Arcadia_Natural8Value const*
 Arcadia_String_getBytes
@@ -420,9 +635,7 @@ Arcadia_String_getBytes
     Arcadia_Thread* thread,
     Arcadia_String const* self
   )
-{
-  return Arcadia_RuntimeUTF8String_getBytes(thread, self->immutableUTF8String);
-}
+{ return self->bytes; }
 
 Arcadia_Natural8Value
 Arcadia_String_getByteAt
@@ -446,7 +659,13 @@ Arcadia_String_getNumberOfCodePoints
     Arcadia_String const* self
   )
 {
-  return Arcadia_RuntimeUTF8String_getNumberOfCodePoints(thread, self->immutableUTF8String);
+  Arcadia_SizeValue numberOfCodePoints = Arcadia_Memory_atomicLoadSize((Arcadia_SizeValue volatile*)&self->numberOfCodePoints);
+  if (Arcadia_SizeValue_Maximum == numberOfCodePoints) {
+    // Concurrent threads may count the code points at the same time. They store the same value.
+    Arcadia_Unicode_isUTF8(thread, self->bytes, self->numberOfBytes, &numberOfCodePoints);
+    Arcadia_Memory_atomicStoreSize((Arcadia_SizeValue volatile*)&self->numberOfCodePoints, numberOfCodePoints);
+  }
+  return numberOfCodePoints;
 }
 
 Arcadia_BooleanValue
@@ -458,9 +677,8 @@ Arcadia_String_isEqualTo_pn
     Arcadia_SizeValue numberOfBytes
   )
 {
-  if (Arcadia_RuntimeUTF8String_getNumberOfBytes(thread, self->immutableUTF8String) == numberOfBytes) {
-    return !Arcadia_Memory_compare(thread, Arcadia_RuntimeUTF8String_getBytes(thread, self->immutableUTF8String),
-                                   bytes, numberOfBytes);
+  if (self->numberOfBytes == numberOfBytes) {
+    return !Arcadia_Memory_compare(thread, self->bytes, bytes, numberOfBytes);
   } else {
     return Arcadia_BooleanValue_False;
   }
@@ -472,7 +690,7 @@ Arcadia_String_toBoolean
     Arcadia_Thread* thread,
     Arcadia_String const* self
   )
-{ return Arcadia_RuntimeUTF8String_toBoolean(thread, self->immutableUTF8String); }
+{ return _toBoolean(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_Integer16Value
 Arcadia_String_toInteger16
@@ -480,7 +698,7 @@ Arcadia_String_toInteger16
     Arcadia_Thread* thread,
     Arcadia_String const* self
   )
-{ return Arcadia_RuntimeUTF8String_toInteger16(thread, self->immutableUTF8String); }
+{ return _toInteger16(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_Integer32Value
 Arcadia_String_toInteger32
@@ -488,7 +706,7 @@ Arcadia_String_toInteger32
     Arcadia_Thread* thread,
     Arcadia_String const* self
   )
-{ return Arcadia_RuntimeUTF8String_toInteger32(thread, self->immutableUTF8String); }
+{ return _toInteger32(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_Integer64Value
 Arcadia_String_toInteger64
@@ -496,7 +714,7 @@ Arcadia_String_toInteger64
     Arcadia_Thread* thread,
     Arcadia_String const* self
   )
-{ return Arcadia_RuntimeUTF8String_toInteger64(thread, self->immutableUTF8String); }
+{ return _toInteger64(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_Integer8Value
 Arcadia_String_toInteger8
@@ -504,7 +722,7 @@ Arcadia_String_toInteger8
     Arcadia_Thread* thread,
     Arcadia_String const* self
   )
-{ return Arcadia_RuntimeUTF8String_toInteger8(thread, self->immutableUTF8String); }
+{ return _toInteger8(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_Natural16Value
 Arcadia_String_toNatural16
@@ -512,7 +730,7 @@ Arcadia_String_toNatural16
     Arcadia_Thread* thread,
     Arcadia_String const* self
   )
-{ return Arcadia_RuntimeUTF8String_toNatural16(thread, self->immutableUTF8String); }
+{ return _toNatural16(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_Natural32Value
 Arcadia_String_toNatural32
@@ -520,7 +738,7 @@ Arcadia_String_toNatural32
     Arcadia_Thread* thread,
     Arcadia_String const* self
   )
-{ return Arcadia_RuntimeUTF8String_toNatural32(thread, self->immutableUTF8String); }
+{ return _toNatural32(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_Natural64Value
 Arcadia_String_toNatural64
@@ -528,7 +746,7 @@ Arcadia_String_toNatural64
     Arcadia_Thread* thread,
     Arcadia_String const* self
   )
-{ return Arcadia_RuntimeUTF8String_toNatural64(thread, self->immutableUTF8String); }
+{ return _toNatural64(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_Natural8Value
 Arcadia_String_toNatural8
@@ -536,7 +754,7 @@ Arcadia_String_toNatural8
     Arcadia_Thread* thread,
     Arcadia_String const* self
   )
-{ return Arcadia_RuntimeUTF8String_toNatural8(thread, self->immutableUTF8String); }
+{ return _toNatural8(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_Real32Value
 Arcadia_String_toReal32
@@ -560,7 +778,7 @@ Arcadia_String_toVoid
     Arcadia_Thread* thread,
     Arcadia_String const* self
   )
-{ return Arcadia_RuntimeUTF8String_toVoid(thread, self->immutableUTF8String); }
+{ return _toVoid(thread, self->bytes, self->numberOfBytes); }
 
 Arcadia_String*
 Arcadia_String_createFromBoolean
@@ -568,7 +786,11 @@ Arcadia_String_createFromBoolean
     Arcadia_Thread* thread,
     Arcadia_BooleanValue booleanValue
   )
-{ return Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_createFromBoolean(thread, booleanValue))); }
+{
+  Context context;
+  Arcadia_BooleanValue_toUTF8String(thread, booleanValue, &context, (void (*)(Arcadia_Thread*, void*, const Arcadia_Natural8Value*, Arcadia_SizeValue))&callback);
+  return context.string;
+}
 
 Arcadia_String*
 Arcadia_String_createFromInteger16
@@ -576,7 +798,11 @@ Arcadia_String_createFromInteger16
     Arcadia_Thread* thread,
     Arcadia_Integer16Value integer16Value
   )
-{ return Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_createFromInteger16(thread, integer16Value))); }
+{
+  Context context;
+  Arcadia_Integer16Value_toUTF8String(thread, integer16Value, &context, (void (*)(Arcadia_Thread*, void*, const Arcadia_Natural8Value*, Arcadia_SizeValue))&callback);
+  return context.string;
+}
 
 Arcadia_String*
 Arcadia_String_createFromInteger32
@@ -584,7 +810,11 @@ Arcadia_String_createFromInteger32
     Arcadia_Thread* thread,
     Arcadia_Integer32Value integer32Value
   )
-{ return Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_createFromInteger32(thread, integer32Value))); }
+{
+  Context context;
+  Arcadia_Integer32Value_toUTF8String(thread, integer32Value, &context, (void (*)(Arcadia_Thread*, void*, const Arcadia_Natural8Value*, Arcadia_SizeValue))&callback);
+  return context.string;
+}
 
 Arcadia_String*
 Arcadia_String_createFromInteger64
@@ -592,7 +822,11 @@ Arcadia_String_createFromInteger64
     Arcadia_Thread* thread,
     Arcadia_Integer64Value integer64Value
   )
-{ return Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_createFromInteger64(thread, integer64Value))); }
+{
+  Context context;
+  Arcadia_Integer64Value_toUTF8String(thread, integer64Value, &context, (void (*)(Arcadia_Thread*, void*, const Arcadia_Natural8Value*, Arcadia_SizeValue))&callback);
+  return context.string;
+}
 
 Arcadia_String*
 Arcadia_String_createFromInteger8
@@ -600,7 +834,11 @@ Arcadia_String_createFromInteger8
     Arcadia_Thread* thread,
     Arcadia_Integer8Value integer8Value
   )
-{ return Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_createFromInteger8(thread, integer8Value))); }
+{
+  Context context;
+  Arcadia_Integer8Value_toUTF8String(thread, integer8Value, &context, (void (*)(Arcadia_Thread*, void*, const Arcadia_Natural8Value*, Arcadia_SizeValue))&callback);
+  return context.string;
+}
 
 Arcadia_String*
 Arcadia_String_createFromNatural16
@@ -608,7 +846,11 @@ Arcadia_String_createFromNatural16
     Arcadia_Thread* thread,
     Arcadia_Natural16Value natural16Value
   )
-{ return Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_createFromNatural16(thread, natural16Value))); }
+{
+  Context context;
+  Arcadia_Natural16Value_toUTF8String(thread, natural16Value, &context, (void (*)(Arcadia_Thread*, void*, const Arcadia_Natural8Value*, Arcadia_SizeValue))&callback);
+  return context.string;
+}
 
 Arcadia_String*
 Arcadia_String_createFromNatural32
@@ -616,8 +858,11 @@ Arcadia_String_createFromNatural32
     Arcadia_Thread* thread,
     Arcadia_Natural32Value natural32Value
   )
-{ return Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_createFromNatural32(thread, natural32Value))); }
-
+{
+  Context context;
+  Arcadia_Natural32Value_toUTF8String(thread, natural32Value, &context, (void (*)(Arcadia_Thread*, void*, const Arcadia_Natural8Value*, Arcadia_SizeValue))&callback);
+  return context.string;
+}
 
 Arcadia_String*
 Arcadia_String_createFromNatural64
@@ -625,7 +870,11 @@ Arcadia_String_createFromNatural64
     Arcadia_Thread* thread,
     Arcadia_Natural64Value natural64Value
   )
-{ return Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_createFromNatural64(thread, natural64Value))); }
+{
+  Context context;
+  Arcadia_Natural64Value_toUTF8String(thread, natural64Value, &context, (void (*)(Arcadia_Thread*, void*, const Arcadia_Natural8Value*, Arcadia_SizeValue))&callback);
+  return context.string;
+}
 
 Arcadia_String*
 Arcadia_String_createFromNatural8
@@ -633,7 +882,11 @@ Arcadia_String_createFromNatural8
     Arcadia_Thread* thread,
     Arcadia_Natural8Value natural8Value
   )
-{ return Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_createFromNatural8(thread, natural8Value))); }
+{
+  Context context;
+  Arcadia_Natural8Value_toUTF8String(thread, natural8Value, &context, (void (*)(Arcadia_Thread*, void*, const Arcadia_Natural8Value*, Arcadia_SizeValue))&callback);
+  return context.string;
+}
 
 Arcadia_String*
 Arcadia_String_createFromReal32
@@ -641,7 +894,11 @@ Arcadia_String_createFromReal32
     Arcadia_Thread* thread,
     Arcadia_Real32Value real32Value
   )
-{ return Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_createFromReal32(thread, real32Value))); }
+{
+  Context context;
+  Arcadia_Real32Value_toUTF8String(thread, real32Value, &context, (void (*)(Arcadia_Thread*, void*, const Arcadia_Natural8Value*, Arcadia_SizeValue))&callback);
+  return context.string;
+}
 
 Arcadia_String*
 Arcadia_String_createFromReal64
@@ -649,7 +906,11 @@ Arcadia_String_createFromReal64
     Arcadia_Thread* thread,
     Arcadia_Real64Value real64Value
   )
-{ return Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_createFromReal64(thread, real64Value))); }
+{
+  Context context;
+  Arcadia_Real64Value_toUTF8String(thread, real64Value, &context, (void (*)(Arcadia_Thread*, void*, const Arcadia_Natural8Value*, Arcadia_SizeValue))&callback);
+  return context.string;
+}
 
 Arcadia_String*
 Arcadia_String_createFromSize
@@ -657,7 +918,11 @@ Arcadia_String_createFromSize
     Arcadia_Thread* thread,
     Arcadia_SizeValue sizeValue
   )
-{ return Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_createFromSize(thread, sizeValue))); }
+{
+  Context context;
+  Arcadia_SizeValue_toUTF8String(thread, sizeValue, &context, (void (*)(Arcadia_Thread*, void*, const Arcadia_Natural8Value*, Arcadia_SizeValue))&callback);
+  return context.string;
+}
 
 Arcadia_String*
 Arcadia_String_createFromVoid
@@ -665,7 +930,11 @@ Arcadia_String_createFromVoid
     Arcadia_Thread* thread,
     Arcadia_VoidValue voidValue
   )
-{ return Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_createFromVoid(thread, voidValue))); }
+{
+  Context context;
+  Arcadia_VoidValue_toUTF8String(thread, voidValue, &context, (void (*)(Arcadia_Thread*, void*, const Arcadia_Natural8Value*, Arcadia_SizeValue))&callback);
+  return context.string;
+}
 
 Arcadia_Value
 Arcadia_String_findFirstOccurrence
@@ -674,7 +943,7 @@ Arcadia_String_findFirstOccurrence
     Arcadia_String* self,
     Arcadia_Natural32Value codePoint
   )
-{ return Arcadia_RuntimeUTF8String_findFirstOccurrence(thread, self->immutableUTF8String, codePoint); }
+{ return _findFirstOccurrence(thread, self->bytes, self->numberOfBytes, codePoint); }
 
 Arcadia_Value
 Arcadia_String_findLastOccurrence
@@ -683,14 +952,14 @@ Arcadia_String_findLastOccurrence
     Arcadia_String* self,
     Arcadia_Natural32Value codePoint
   )
-{ return Arcadia_RuntimeUTF8String_findLastOccurrence(thread, self->immutableUTF8String, codePoint); }
+{ return _findLastOccurrence(thread, self->bytes, self->numberOfBytes, codePoint); }
 
 Arcadia_String*
 Arcadia_String_createEmpty
   (
     Arcadia_Thread* thread
   )
-{ return Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_createEmpty(thread))); }
+{ return Arcadia_Object_createNative(thread, _Arcadia_String_getType(thread), 0, NULL); }
 
 Arcadia_String*
 Arcadia_String_substring
@@ -700,7 +969,92 @@ Arcadia_String_substring
     Arcadia_SizeValue start,
     Arcadia_Value length
   )
-{ return Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_substring(thread, self->immutableUTF8String, start, length))); }
+{
+  Arcadia_SizeValue byteIndex, byteLength;
+  _getSubstringByteRange(thread, self->bytes, self->numberOfBytes, start, length, &byteIndex, &byteLength);
+  Arcadia_SizeValue numberOfCodePoints = Arcadia_SizeValue_Maximum;
+  if (Arcadia_Value_isSizeValue(&length)) {
+    numberOfCodePoints = Arcadia_Value_getSizeValue(&length);
+  } else {
+    Arcadia_SizeValue selfNumberOfCodePoints = Arcadia_Memory_atomicLoadSize(&self->numberOfCodePoints);
+    if (Arcadia_SizeValue_Maximum != selfNumberOfCodePoints) {
+      numberOfCodePoints = selfNumberOfCodePoints - start;
+    }
+  }
+  return createSlice(thread, self, byteIndex, byteLength, numberOfCodePoints);
+}
+
+Arcadia_String*
+Arcadia_String_slice
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* self,
+    Arcadia_SizeValue byteIndex,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  if (byteIndex > self->numberOfBytes || numberOfBytes > self->numberOfBytes - byteIndex) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  // A code point boundary is either the end of the Bytes or a Byte which is not a continuation Byte (10xxxxxx).
+  Arcadia_SizeValue end = byteIndex + numberOfBytes;
+  if ((byteIndex < self->numberOfBytes && 0x80 == (self->bytes[byteIndex] & 0xc0)) ||
+      (end < self->numberOfBytes && 0x80 == (self->bytes[end] & 0xc0))) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  if (0 == byteIndex && self->numberOfBytes == numberOfBytes) {
+    return self;
+  }
+  return createSlice(thread, self, byteIndex, numberOfBytes, Arcadia_SizeValue_Maximum);
+}
+
+Arcadia_String*
+Arcadia_String_takeFromStringBuilder
+  (
+    Arcadia_Thread* thread,
+    Arcadia_StringBuilder* builder
+  )
+{
+  Arcadia_String* self = NULL;
+  Arcadia_SizeValue numberOfCodePoints;
+  if (!Arcadia_Unicode_isUTF8(thread, builder->elements, builder->size, &numberOfCodePoints)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  if (builder->size <= Arcadia_String_MaximumNumberOfCopiedBuilderBytes) {
+    self = createInline(thread, builder->elements, builder->size, numberOfCodePoints);
+  } else {
+    self = createFromBuffer(thread, &builder->elements, builder->size, numberOfCodePoints);
+    builder->capacity = 0;
+  }
+  builder->size = 0;
+  return self;
+}
+
+Arcadia_String*
+Arcadia_String_takeFromByteArrayBuilder
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* builder
+  )
+{
+  Arcadia_String* self = NULL;
+  Arcadia_SizeValue numberOfCodePoints;
+  if (!Arcadia_Unicode_isUTF8(thread, builder->p, builder->sz, &numberOfCodePoints)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EncodingInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  if (builder->sz <= Arcadia_String_MaximumNumberOfCopiedBuilderBytes) {
+    self = createInline(thread, (Arcadia_Natural8Value const*)builder->p, builder->sz, numberOfCodePoints);
+  } else {
+    self = createFromBuffer(thread, (Arcadia_Natural8Value**)&builder->p, builder->sz, numberOfCodePoints);
+    builder->cp = 0;
+  }
+  builder->sz = 0;
+  return self;
+}
 
 Arcadia_ByteArray*
 Arcadia_String_toByteArray
@@ -709,3 +1063,24 @@ Arcadia_String_toByteArray
     Arcadia_String* self
   )
 { return Arcadia_ByteArray_createByteArray(thread,Arcadia_RuntimeByteArray_create(thread, Arcadia_String_getBytes(thread, self), Arcadia_String_getNumberOfBytes(thread, self))); }
+
+void
+Arcadia_String_getStatistics
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String_Statistics* statistics
+  )
+{
+  if (!statistics) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  *statistics = thread->stringStatistics;
+}
+
+void
+Arcadia_String_resetStatistics
+  (
+    Arcadia_Thread* thread
+  )
+{ Arcadia_Memory_fillZero(thread, &thread->stringStatistics, sizeof(Arcadia_String_Statistics)); }
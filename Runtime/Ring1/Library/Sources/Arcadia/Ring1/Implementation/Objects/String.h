@@ -22,6 +22,8 @@
 
 #include "Arcadia/Ring1/Implementation/Object.h"
 typedef struct Arcadia_ByteArray Arcadia_ByteArray;
+typedef struct Arcadia_ByteArrayBuilder Arcadia_ByteArrayBuilder;
+typedef struct Arcadia_StringBuilder Arcadia_StringBuilder;
 
 /// @code
 /// class Arcadia.String {
@@ -47,11 +49,83 @@ struct Arcadia_StringDispatch {
   Arcadia_ObjectDispatch _parent;
 };
 
+/// The Bytes of the string trail the string object in the same allocation.
+#define Arcadia_StringStorage_Inline (0)
+
+/// The Bytes of the string are the Bytes of an Arcadia_RuntimeUTF8String value.
+#define Arcadia_StringStorage_RuntimeUTF8String (1)
+
+/// The Bytes of the string are a range of the Bytes of another string.
+#define Arcadia_StringStorage_Slice (2)
+
+/// The Bytes of the string are an unmanaged buffer taken over from a builder.
+/// The string deallocates the buffer when it is destructed.
+#define Arcadia_StringStorage_Buffer (3)
+
 struct Arcadia_String {
   Arcadia_Object _parent;
-  Arcadia_RuntimeUTF8String* immutableUTF8String;
+  /// @brief A pointer to the Bytes of this string.
+  Arcadia_Natural8Value const* bytes;
+  /// @brief The number of Bytes of this string.
+  Arcadia_SizeValue numberOfBytes;
+  // The hash and the number of code points are computed lazily and a string can be shared between threads.
+  // Hence they are accessed with the Arcadia_Memory_atomic* functions once the string was created.
+  /// @brief The hash of this string. Only valid if @a hasHash is not zero.
+  Arcadia_SizeValue volatile hash;
+  /// @brief The number of code points of this string or Arcadia_SizeValue_Maximum if it was not computed yet.
+  Arcadia_SizeValue volatile numberOfCodePoints;
+  /// @brief 1 if @a hash is valid, 0 otherwise.
+  /// Stored after @a hash was stored such that a thread which loads 1 also loads the hash.
+  uint32_t volatile hasHash;
+  /// @brief One of the Arcadia_StringStorage_* constants.
+  Arcadia_Natural8Value storage;
+  /// @brief The owner of the Bytes of this string if the storage is Arcadia_StringStorage_RuntimeUTF8String or Arcadia_StringStorage_Slice.
+  /// The owner of a slice is never a slice itself.
+  union {
+    Arcadia_RuntimeUTF8String* runtimeUTF8String;
+    Arcadia_String* string;
+  } owner;
 };
 
+/// @brief Counters of the strings created by a thread.
+typedef struct Arcadia_String_Statistics {
+  /// @brief The number of strings created.
+  Arcadia_SizeValue numberOfStrings;
+  /// @brief The number of strings with their Bytes stored inline.
+  Arcadia_SizeValue numberOfInlineStrings;
+  /// @brief The number of strings sharing the Bytes of another string or of an Arcadia_RuntimeUTF8String value.
+  Arcadia_SizeValue numberOfSharedStrings;
+  /// @brief The number of strings which took over the buffer of a builder.
+  Arcadia_SizeValue numberOfTakenBuffers;
+  /// @brief The number of allocations of string objects and their storages.
+  Arcadia_SizeValue numberOfAllocations;
+  /// @brief The number of Bytes copied into strings.
+  Arcadia_SizeValue numberOfCopiedBytes;
+} Arcadia_String_Statistics;
+
+/// @brief Get the counters of the strings created by this thread.
+/// @param thread A pointer to this thread.
+/// @param statistics A pointer to the Arcadia_String_Statistics object receiving the counters.
+void
+Arcadia_String_getStatistics
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String_Statistics* statistics
+  );
+
+/// @brief Reset the counters of the strings created by this thread to zero.
+/// @param thread A pointer to this thread.
+void
+Arcadia_String_resetStatistics
+  (
+    Arcadia_Thread* thread
+  );
+
+/// Builders with at most this number of Bytes are copied into an inline string by
+/// Arcadia_String_takeFromStringBuilder and Arcadia_String_takeFromByteArrayBuilder.
+/// Builders with more Bytes hand their buffer over to the string.
+#define Arcadia_String_MaximumNumberOfCopiedBuilderBytes (64)
+
 // https://michaelheilmann.com/Arcadia/Ring2/#Arcadia_String_create_pn
 Arcadia_String*
 Arcadia_String_create_pn
@@ -366,6 +440,7 @@ Arcadia_String_createEmpty
   );
 
 /// @brief Create a string that is a substring of the specified string.
+/// The substring shares the Bytes of the specified string.
 /// @param start The code point index of at which the substring starts at.
 /// @param length The length, in code points, of the substring as a Arcadia_SizeValue or an Arcadia_Void value.
 /// @return A pointer to the substring.
@@ -378,6 +453,46 @@ Arcadia_String_substring
     Arcadia_Value length
   );
 
+/// @brief Create a string that shares the Bytes [byteIndex, byteIndex + numberOfBytes) of the specified string.
+/// @param byteIndex The index of the first Byte of the slice.
+/// @param numberOfBytes The number of Bytes of the slice.
+/// @return A pointer to the slice.
+/// @error Arcadia_Status_ArgumentValueInvalid the range exceeds the Bytes of the string or does not start and end at code point boundaries.
+Arcadia_String*
+Arcadia_String_slice
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* self,
+    Arcadia_SizeValue byteIndex,
+    Arcadia_SizeValue numberOfBytes
+  );
+
+/// @brief Create a string from the Bytes of a string builder and clear the string builder.
+/// @param builder A pointer to the string builder.
+/// @return A pointer to the string.
+/// @remarks
+/// If the string builder has more than Arcadia_String_MaximumNumberOfCopiedBuilderBytes Bytes,
+/// then its buffer is handed over to the string (no Bytes are copied) and the string builder receives a new empty buffer.
+/// Otherwise the Bytes are copied into an inline string and the string builder keeps its buffer.
+Arcadia_String*
+Arcadia_String_takeFromStringBuilder
+  (
+    Arcadia_Thread* thread,
+    Arcadia_StringBuilder* builder
+  );
+
+/// @brief Create a string from the Bytes of a Byte array builder and clear the Byte array builder.
+/// @param builder A pointer to the Byte array builder.
+/// @return A pointer to the string.
+/// @error Arcadia_Status_EncodingInvalid the Bytes are not a valid UTF-8 sequence. The Byte array builder is not modified.
+/// @remarks See Arcadia_String_takeFromStringBuilder.
+Arcadia_String*
+Arcadia_String_takeFromByteArrayBuilder
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* builder
+  );
+
 Arcadia_ByteArray*
 Arcadia_String_toByteArray
   (
@@ -22,7 +22,12 @@
 #include "Arcadia/Ring1/Implementation/TypeSystem/Names.module.h"
 #include "Arcadia/Ring1/Implementation/Atoms.module.h"
 #include "Arcadia/Ring1/Implementation/Thread.module.h"
+#include "Arcadia/Ring1/Implementation/Profiler.module.h"
 #include "Arcadia/Ring1/Implementation/TypeSystem/Types.module.h"
+#include "Arcadia/Ring1/Implementation/Annotations/ThreadLocal.h"
+#include "Arcadia/Ring1/Implementation/Concurrency/Atomic.h"
+#include "Arcadia/Ring1/Implementation/Concurrency/Condition.h"
+#include "Arcadia/Ring1/Implementation/Concurrency/Mutex.h"
 #include <stdbool.h>
 
 typedef const ModuleInfo* (GetModuleInfo)();
@@ -117,24 +122,127 @@ static inline ReferenceCount ReferenceCount_get(ReferenceCount* referenceCount)
 
 struct Arcadia_Process {
   ReferenceCount referenceCount;
+  // The main thread.
   Arcadia_Thread thread;
   ARMSCallbackNode* armsCallbackNodes;
+  // The runtime lock.
+  // See Arcadia_Process_lockRuntime for more information.
+  Arcadia_Concurrency_Mutex runtimeMutex;
+  // Guards the list of threads, the reference counter, and the stop request.
+  Arcadia_Concurrency_Mutex threadsMutex;
+  // Signaled if a thread entered a safe region, was detached, or if the stop request was revoked.
+  Arcadia_Concurrency_Condition threadsCondition;
+  // The list of attached threads. The main thread is always in this list.
+  Arcadia_Thread* threads;
+  // 1 if the thread holding the runtime lock requested all other threads to stop, 0 otherwise.
+  // Only modified while holding both the runtime lock and the threads mutex.
+  uint32_t volatile stopRequested;
+  // The number of objects reclaimed by the last call to Arcadia_Process_stepARMS or Arcadia_Process_runARMS.
+  // Only modified while holding the runtime lock.
+  size_t numberOfReclaimedObjects;
+  // The cumulative statistics.
+  // Only modified while holding the runtime lock.
+  Arcadia_Process_Statistics statistics;
 };
 
 static Arcadia_Process* g_process = NULL;
 
-// @brief Visit the stack and the raised value of the main thread.
-// @remarks There is only one thread, the aforementioned main thread, at the moment.
+// The thread attached to the calling operating system thread.
+static Arcadia_ThreadLocal() Arcadia_Thread* g_currentThread = NULL;
+
+// @brief Visit the stacks and the raised values of all threads.
 static void
 ThreadVisitCallback
   (
     Arcadia_Thread* thread
   )
 {
-  for (Arcadia_SizeValue i = 0, n = thread->stack.size; i < n; ++i) {
-    Arcadia_Value_visit(thread, &thread->stack.elements[i]);
+  for (Arcadia_Thread* current = thread->process->threads; NULL != current; current = current->next) {
+    for (Arcadia_SizeValue i = 0, n = current->stack.size; i < n; ++i) {
+      Arcadia_Value_visit(thread, &current->stack.elements[i]);
+    }
+    Arcadia_Value_visit(thread, &current->raisedValue);
+  }
+}
+
+// @brief Request all threads except for the specified thread to stop and wait until they are stopped.
+// @remarks
+// The specified thread must not hold the runtime lock: a thread waiting for that lock is not stopped.
+// If another thread is collecting, the specified thread waits in a safe region until that collection is finished.
+static void
+stopTheWorld
+  (
+    Arcadia_Process* process,
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Concurrency_Mutex_lock(&process->threadsMutex);
+  while (Arcadia_Memory_atomicLoad32(&process->stopRequested)) {
+    Arcadia_Memory_atomicExchange32(&thread->state, Arcadia_ThreadState_Safe);
+    Arcadia_Concurrency_Condition_signalAll(&process->threadsCondition);
+    Arcadia_Concurrency_Condition_wait(&process->threadsCondition, &process->threadsMutex);
+    Arcadia_Memory_atomicExchange32(&thread->state, Arcadia_ThreadState_Running);
+  }
+  Arcadia_Memory_atomicExchange32(&process->stopRequested, 1);
+  while (true) {
+    bool stopped = true;
+    for (Arcadia_Thread* current = process->threads; NULL != current; current = current->next) {
+      if (current != thread && Arcadia_ThreadState_Running == Arcadia_Memory_atomicLoad32(&current->state)) {
+        stopped = false;
+        break;
+      }
+    }
+    if (stopped) {
+      break;
+    }
+    Arcadia_Concurrency_Condition_wait(&process->threadsCondition, &process->threadsMutex);
   }
-  Arcadia_Value_visit(thread, &thread->raisedValue);
+  Arcadia_Concurrency_Mutex_unlock(&process->threadsMutex);
+}
+
+// @brief Add the last collection which started to stop the world at the specified point in time to the cumulative statistics.
+// @remarks The calling thread must hold the runtime lock.
+static void
+updateStatistics
+  (
+    Arcadia_Process* process,
+    Arcadia_Natural64Value start
+  )
+{
+  process->statistics.numberOfCollections++;
+  process->statistics.numberOfReclaimedObjects += process->numberOfReclaimedObjects;
+  process->statistics.collectionTime += Arcadia_Profiler_getTimestamp() - start;
+}
+
+#if 1 == Arcadia_Configuration_Profiler_Enabled
+
+// @brief Record the end of a collection which started to stop the world at the specified point in time.
+static void
+recordPause
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural64Value start,
+    size_t numberOfReclaimedObjects
+  )
+{
+  Arcadia_Profiler_endZone(thread);
+  Arcadia_Profiler_setCounter(thread, "ARMS pause [us]", (Arcadia_Integer64Value)((Arcadia_Profiler_getTimestamp() - start) / 1000));
+  Arcadia_Profiler_setCounter(thread, "ARMS reclaimed objects", (Arcadia_Integer64Value)numberOfReclaimedObjects);
+}
+
+#endif
+
+// @brief Revoke the stop request and wake up all stopped threads.
+static void
+resumeTheWorld
+  (
+    Arcadia_Process* process
+  )
+{
+  Arcadia_Concurrency_Mutex_lock(&process->threadsMutex);
+  Arcadia_Memory_atomicExchange32(&process->stopRequested, 0);
+  Arcadia_Concurrency_Condition_signalAll(&process->threadsCondition);
+  Arcadia_Concurrency_Mutex_unlock(&process->threadsMutex);
 }
 
 Arcadia_Thread*
@@ -142,7 +250,156 @@ Arcadia_Process_getThread
   (
     Arcadia_Process* process
   )
-{ return &process->thread; }
+{
+  Arcadia_Thread* thread = g_currentThread;
+  return thread ? thread : &process->thread;
+}
+
+Arcadia_ProcessStatus
+Arcadia_Process_attachThread
+  (
+    Arcadia_Process* process,
+    Arcadia_Thread** thread
+  )
+{
+  if (!process || !thread) {
+    return Arcadia_ProcessStatus_ArgumentValueInvalid;
+  }
+  if (g_currentThread) {
+    return Arcadia_ProcessStatus_OperationInvalid;
+  }
+  Arcadia_Thread* newThread = NULL;
+  if (Arcadia_ARMS_MemoryManager_allocate(Arcadia_ARMS_getDefaultMemoryManager(), (void**)&newThread, sizeof(Arcadia_Thread))) {
+    return Arcadia_ProcessStatus_AllocationFailed;
+  }
+  if (Arcadia_Thread_initialize(newThread)) {
+    Arcadia_ARMS_MemoryManager_deallocate(Arcadia_ARMS_getDefaultMemoryManager(), newThread);
+    return Arcadia_ProcessStatus_AllocationFailed;
+  }
+  newThread->process = process;
+  Arcadia_Concurrency_Mutex_lock(&process->threadsMutex);
+  if (ReferenceCount_Maximum == ReferenceCount_get(&process->referenceCount)) {
+    Arcadia_Concurrency_Mutex_unlock(&process->threadsMutex);
+    Arcadia_Thread_uninitialize(newThread);
+    Arcadia_ARMS_MemoryManager_deallocate(Arcadia_ARMS_getDefaultMemoryManager(), newThread);
+    return Arcadia_ProcessStatus_OperationInvalid;
+  }
+  // A thread must not start running while a collection is in progress.
+  while (Arcadia_Memory_atomicLoad32(&process->stopRequested)) {
+    Arcadia_Concurrency_Condition_wait(&process->threadsCondition, &process->threadsMutex);
+  }
+  ReferenceCount_increment(&process->referenceCount);
+  newThread->next = process->threads;
+  process->threads = newThread;
+  Arcadia_Concurrency_Mutex_unlock(&process->threadsMutex);
+  g_currentThread = newThread;
+  *thread = newThread;
+  return Arcadia_ProcessStatus_Success;
+}
+
+Arcadia_ProcessStatus
+Arcadia_Process_detachThread
+  (
+    Arcadia_Process* process,
+    Arcadia_Thread* thread
+  )
+{
+  if (!process || !thread || thread == &process->thread) {
+    return Arcadia_ProcessStatus_ArgumentValueInvalid;
+  }
+  if (g_currentThread != thread || thread->runtimeLockCount) {
+    return Arcadia_ProcessStatus_OperationInvalid;
+  }
+  Arcadia_Concurrency_Mutex_lock(&process->threadsMutex);
+  Arcadia_Thread** previous = &process->threads;
+  while (*previous != thread) {
+    previous = &(*previous)->next;
+  }
+  *previous = thread->next;
+  // A collecting thread might wait for this thread.
+  Arcadia_Concurrency_Condition_signalAll(&process->threadsCondition);
+  Arcadia_Concurrency_Mutex_unlock(&process->threadsMutex);
+  g_currentThread = NULL;
+  Arcadia_Thread_uninitialize(thread);
+  Arcadia_ARMS_MemoryManager_deallocate(Arcadia_ARMS_getDefaultMemoryManager(), thread);
+  return Arcadia_Process_relinquish(process);
+}
+
+void
+Arcadia_Process_lockRuntime
+  (
+    Arcadia_Process* process
+  )
+{
+  Arcadia_Thread* thread = Arcadia_Process_getThread(process);
+  if (0 == thread->runtimeLockCount) {
+    Arcadia_Concurrency_Mutex_lock(&process->runtimeMutex);
+  }
+  thread->runtimeLockCount++;
+}
+
+void
+Arcadia_Process_unlockRuntime
+  (
+    Arcadia_Process* process
+  )
+{
+  Arcadia_Thread* thread = Arcadia_Process_getThread(process);
+  if (0 == --thread->runtimeLockCount) {
+    Arcadia_Concurrency_Mutex_unlock(&process->runtimeMutex);
+  }
+}
+
+void
+Arcadia_Thread_safepoint
+  (
+    Arcadia_Thread* thread
+  )
+{
+  if (Arcadia_Memory_atomicLoad32(&thread->process->stopRequested) && 0 == thread->runtimeLockCount) {
+    Arcadia_Thread_enterSafeRegion(thread);
+    Arcadia_Thread_leaveSafeRegion(thread);
+  }
+}
+
+void
+Arcadia_Thread_enterSafeRegion
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Process* process = thread->process;
+  Arcadia_Memory_atomicExchange32(&thread->state, Arcadia_ThreadState_Safe);
+  if (Arcadia_Memory_atomicLoad32(&process->stopRequested)) {
+    Arcadia_Concurrency_Mutex_lock(&process->threadsMutex);
+    Arcadia_Concurrency_Condition_signalAll(&process->threadsCondition);
+    Arcadia_Concurrency_Mutex_unlock(&process->threadsMutex);
+  }
+}
+
+void
+Arcadia_Thread_leaveSafeRegion
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Process* process = thread->process;
+  while (true) {
+    // Either the collecting thread observes this thread running and waits for it,
+    // or this thread observes the stop request and waits for the collecting thread.
+    Arcadia_Memory_atomicExchange32(&thread->state, Arcadia_ThreadState_Running);
+    if (!Arcadia_Memory_atomicLoad32(&process->stopRequested)) {
+      return;
+    }
+    Arcadia_Memory_atomicExchange32(&thread->state, Arcadia_ThreadState_Safe);
+    Arcadia_Concurrency_Mutex_lock(&process->threadsMutex);
+    Arcadia_Concurrency_Condition_signalAll(&process->threadsCondition);
+    while (Arcadia_Memory_atomicLoad32(&process->stopRequested)) {
+      Arcadia_Concurrency_Condition_wait(&process->threadsCondition, &process->threadsMutex);
+    }
+    Arcadia_Concurrency_Mutex_unlock(&process->threadsMutex);
+  }
+}
 
 Arcadia_ProcessStatus
 Arcadia_Process_acquire
@@ -153,10 +410,13 @@ Arcadia_Process_acquire
   if (!process) {
     return Arcadia_ProcessStatus_ArgumentValueInvalid;
   }
+  Arcadia_Concurrency_Mutex_lock(&process->threadsMutex);
   if (ReferenceCount_Minimum == ReferenceCount_get(&process->referenceCount) || ReferenceCount_Maximum == process->referenceCount) {
+    Arcadia_Concurrency_Mutex_unlock(&process->threadsMutex);
     return Arcadia_ProcessStatus_OperationInvalid;
   }
   process->referenceCount++;
+  Arcadia_Concurrency_Mutex_unlock(&process->threadsMutex);
   return Arcadia_ProcessStatus_Success;
 }
 
@@ -169,11 +429,20 @@ Arcadia_Process_relinquish
   if (!process) {
     return Arcadia_ProcessStatus_ArgumentValueInvalid;
   }
-  if (ReferenceCount_Minimum == ReferenceCount_get(&process->referenceCount) || !g_process) {
+  if (!g_process) {
+    /* This is, actually, undefined behavior. */
+    return Arcadia_ProcessStatus_OperationInvalid;
+  }
+  Arcadia_Concurrency_Mutex_lock(&process->threadsMutex);
+  if (ReferenceCount_Minimum == ReferenceCount_get(&process->referenceCount)) {
+    Arcadia_Concurrency_Mutex_unlock(&process->threadsMutex);
     /* This is, actually, undefined behavior. */
     return Arcadia_ProcessStatus_OperationInvalid;
   }
-  if (ReferenceCount_Minimum == ReferenceCount_decrement(&process->referenceCount)) {
+  ReferenceCount referenceCount = ReferenceCount_decrement(&process->referenceCount);
+  Arcadia_Concurrency_Mutex_unlock(&process->threadsMutex);
+  if (ReferenceCount_Minimum == referenceCount) {
+    // Attached threads hold references to the process, hence the main thread is the only thread.
     if (Arcadia_ValueStack_getSize(&process->thread)) {
       //Arcadia_logf(Arcadia_LogFlags_Error, "%s:%d: value stack is not empty\n", __FILE__, __LINE__);
       process->thread.stack.size = 0;
@@ -184,9 +453,15 @@ Arcadia_Process_relinquish
     }
     Arcadia_Process_runARMS(process, true);
     shutdownModules(process);
+    Arcadia_Process_removeArenaVisitCallback(process, &ThreadVisitCallback);
+    Arcadia_Concurrency_Condition_uninitialize(&process->threadsCondition);
+    Arcadia_Concurrency_Mutex_uninitialize(&process->threadsMutex);
+    Arcadia_Concurrency_Mutex_uninitialize(&process->runtimeMutex);
     Arcadia_Thread_uninitialize(&process->thread);
+    g_currentThread = NULL;
     Arcadia_ARMS_MemoryManager_deallocate(Arcadia_ARMS_getDefaultMemoryManager(), g_process);
     g_process = NULL;
+    Arcadia_Profiler_releaseBuffers();
     if (Arcadia_ARMS_shutdown()) {
       Arcadia_logf(Arcadia_LogFlags_Error, "%s:%d: %s failed\n", __FILE__, __LINE__, "Arcadia_ARMS_shutdown");
     }
@@ -214,9 +489,42 @@ Arcadia_Process_get
       return Arcadia_ProcessStatus_AllocationFailed;
     }
     g_process->referenceCount = ReferenceCount_Minimum + 1;
-    Arcadia_Thread_initialize(&g_process->thread);
     g_process->armsCallbackNodes = NULL;
+    g_process->numberOfReclaimedObjects = 0;
+    g_process->statistics.numberOfAllocatedObjects = 0;
+    g_process->statistics.numberOfAllocatedBytes = 0;
+    g_process->statistics.numberOfCollections = 0;
+    g_process->statistics.numberOfReclaimedObjects = 0;
+    g_process->statistics.collectionTime = 0;
+    g_process->runtimeMutex.pimpl = NULL;
+    g_process->threadsMutex.pimpl = NULL;
+    g_process->threadsCondition.pimpl = NULL;
+    g_process->stopRequested = 0;
+    if (Arcadia_Thread_initialize(&g_process->thread)) {
+      Arcadia_ARMS_MemoryManager_deallocate(Arcadia_ARMS_getDefaultMemoryManager(), g_process);
+      g_process = NULL;
+      if (Arcadia_ARMS_shutdown()) {
+        Arcadia_logf(Arcadia_LogFlags_Error, "%s:%d: %s failed\n", __FILE__, __LINE__, "Arcadia_ARMS_shutdown");
+      }
+      return Arcadia_ProcessStatus_AllocationFailed;
+    }
+    if (Arcadia_Concurrency_Mutex_initialize(&g_process->runtimeMutex) ||
+        Arcadia_Concurrency_Mutex_initialize(&g_process->threadsMutex) ||
+        Arcadia_Concurrency_Condition_initialize(&g_process->threadsCondition)) {
+      Arcadia_Concurrency_Condition_uninitialize(&g_process->threadsCondition);
+      Arcadia_Concurrency_Mutex_uninitialize(&g_process->threadsMutex);
+      Arcadia_Concurrency_Mutex_uninitialize(&g_process->runtimeMutex);
+      Arcadia_Thread_uninitialize(&g_process->thread);
+      Arcadia_ARMS_MemoryManager_deallocate(Arcadia_ARMS_getDefaultMemoryManager(), g_process);
+      g_process = NULL;
+      if (Arcadia_ARMS_shutdown()) {
+        Arcadia_logf(Arcadia_LogFlags_Error, "%s:%d: %s failed\n", __FILE__, __LINE__, "Arcadia_ARMS_shutdown");
+      }
+      return Arcadia_ProcessStatus_EnvironmentFailed;
+    }
     g_process->thread.process = g_process;
+    g_process->threads = &g_process->thread;
+    g_currentThread = &g_process->thread;
 
     Arcadia_JumpTarget jumpTarget;
     Arcadia_Thread_pushJumpTarget(&g_process->thread, &jumpTarget);
@@ -228,7 +536,11 @@ Arcadia_Process_get
       Arcadia_Thread_popJumpTarget(&g_process->thread);
       shutdownModules(g_process);
       Arcadia_Process_removeArenaVisitCallback(g_process, &ThreadVisitCallback);
+      Arcadia_Concurrency_Condition_uninitialize(&g_process->threadsCondition);
+      Arcadia_Concurrency_Mutex_uninitialize(&g_process->threadsMutex);
+      Arcadia_Concurrency_Mutex_uninitialize(&g_process->runtimeMutex);
       Arcadia_Thread_uninitialize(&g_process->thread);
+      g_currentThread = NULL;
       Arcadia_ARMS_MemoryManager_deallocate(Arcadia_ARMS_getDefaultMemoryManager(), g_process);
       g_process = NULL;
       if (Arcadia_ARMS_shutdown()) {
@@ -239,10 +551,13 @@ Arcadia_Process_get
     *process = g_process;
     return Arcadia_ProcessStatus_Success;
   }
+  Arcadia_Concurrency_Mutex_lock(&g_process->threadsMutex);
   if (ReferenceCount_Maximum == g_process->referenceCount) {
+    Arcadia_Concurrency_Mutex_unlock(&g_process->threadsMutex);
     return Arcadia_ProcessStatus_OperationInvalid;
   }
   g_process->referenceCount++;
+  Arcadia_Concurrency_Mutex_unlock(&g_process->threadsMutex);
   *process = g_process;
   return Arcadia_ProcessStatus_Success;
 }
@@ -266,7 +581,9 @@ Arcadia_Process_lockObject
     void* object
   )
 {
+  Arcadia_Process_lockRuntime(process);
   Arcadia_ARMS_Status status = Arcadia_ARMS_lock(object);
+  Arcadia_Process_unlockRuntime(process);
   switch (status) {
     case Arcadia_ARMS_Status_Success: {
       return Arcadia_Status_Success;
@@ -294,7 +611,9 @@ Arcadia_Process_unlockObject
     void* object
   )
 {
+  Arcadia_Process_lockRuntime(process);
   Arcadia_ARMS_Status status = Arcadia_ARMS_unlock(object);
+  Arcadia_Process_unlockRuntime(process);
   switch (status) {
     case Arcadia_ARMS_Status_Success: {
       return Arcadia_Status_Success;
@@ -321,8 +640,25 @@ Arcadia_Process_stepARMS
     Arcadia_Process* process
   )
 {
+  Arcadia_Thread* thread = Arcadia_Process_getThread(process);
+  if (thread->runtimeLockCount) {
+    return Arcadia_Status_OperationInvalid;
+  }
   Arcadia_ARMS_RunStatistics statistics = Arcadia_ARMS_RunStatistics_StaticInitializer();
+  Arcadia_Natural64Value pauseStart = Arcadia_Profiler_getTimestamp();
+  Arcadia_Profiler_beginZone(thread, "Arcadia_Process_stepARMS");
+  Arcadia_Profiler_beginZone(thread, "stopTheWorld");
+  stopTheWorld(process, thread);
+  Arcadia_Profiler_endZone(thread);
+  Arcadia_Process_lockRuntime(process);
   Arcadia_ARMS_Status status = Arcadia_ARMS_run(&statistics);
+  process->numberOfReclaimedObjects = statistics.dead;
+  updateStatistics(process, pauseStart);
+#if 1 == Arcadia_Configuration_Profiler_Enabled
+  recordPause(thread, pauseStart, process->numberOfReclaimedObjects);
+#endif
+  Arcadia_Process_unlockRuntime(process);
+  resumeTheWorld(process);
   switch (status) {
     case Arcadia_ARMS_Status_Success:
     { return Arcadia_Status_Success; }
@@ -349,17 +685,34 @@ Arcadia_Process_runARMS
   )
 {
   Arcadia_Thread* thread = Arcadia_Process_getThread(process);
+  if (thread->runtimeLockCount) {
+    return Arcadia_Status_OperationInvalid;
+  }
   Arcadia_ARMS_RunStatistics statistics = Arcadia_ARMS_RunStatistics_StaticInitializer();
+  Arcadia_Natural64Value pauseStart = Arcadia_Profiler_getTimestamp();
+  Arcadia_Profiler_beginZone(thread, "Arcadia_Process_runARMS");
+  Arcadia_Profiler_beginZone(thread, "stopTheWorld");
+  stopTheWorld(process, thread);
+  Arcadia_Profiler_endZone(thread);
+  Arcadia_Process_lockRuntime(process);
+  process->numberOfReclaimedObjects = 0;
   do {
     for (ARMSCallbackNode* node = process->armsCallbackNodes; NULL != node; node = node->next) {
       if (node->onPreMark) {
         node->onPreMark(thread, purgeCaches);
       }
     }
+    for (ARMSCallbackNode* node = process->armsCallbackNodes; NULL != node; node = node->next) {
+      if (node->onVisit) {
+        node->onVisit(thread);
+      }
+    }
     Arcadia_ARMS_Status status = Arcadia_ARMS_run(&statistics);
     switch (status) {
       case Arcadia_ARMS_Status_Success:
-      {/*Intentionally empty.*/ }
+      {
+        process->numberOfReclaimedObjects += statistics.dead;
+      }
       break;
       case Arcadia_ARMS_Status_AllocationFailed:
       case Arcadia_ARMS_Status_OperationInvalid:
@@ -370,6 +723,12 @@ Arcadia_Process_runARMS
         // This should not happen.
         // @todo A different error code shall be returned if Arms_shutdown returns an unspecified error code.
         // Suggestion is Arcadia_Status_EnvironmentInvalid.
+        updateStatistics(process, pauseStart);
+      #if 1 == Arcadia_Configuration_Profiler_Enabled
+        recordPause(thread, pauseStart, process->numberOfReclaimedObjects);
+      #endif
+        Arcadia_Process_unlockRuntime(process);
+        resumeTheWorld(process);
         return Arcadia_Status_OperationInvalid;
       } break;
     };
@@ -385,9 +744,39 @@ Arcadia_Process_runARMS
       }
     }
   } while (statistics.finalized > 0);
+  updateStatistics(process, pauseStart);
+#if 1 == Arcadia_Configuration_Profiler_Enabled
+  recordPause(thread, pauseStart, process->numberOfReclaimedObjects);
+#endif
+  Arcadia_Process_unlockRuntime(process);
+  resumeTheWorld(process);
   return Arcadia_Status_Success;
 }
 
+size_t
+Arcadia_Process_getNumberOfReclaimedObjects
+  (
+    Arcadia_Process* process
+  )
+{
+  Arcadia_Process_lockRuntime(process);
+  size_t numberOfReclaimedObjects = process->numberOfReclaimedObjects;
+  Arcadia_Process_unlockRuntime(process);
+  return numberOfReclaimedObjects;
+}
+
+void
+Arcadia_Process_getStatistics
+  (
+    Arcadia_Process* process,
+    Arcadia_Process_Statistics* statistics
+  )
+{
+  Arcadia_Process_lockRuntime(process);
+  *statistics = process->statistics;
+  Arcadia_Process_unlockRuntime(process);
+}
+
 void
 Arcadia_Process_addArenaPreMarkCallback
   (
@@ -499,6 +888,34 @@ Arcadia_Process_removeArenaFinalizeCallback
   }
 }
 
+// @brief Raise the status corresponding to a status of Arcadia_ARMS_addType.
+static void
+raiseAddTypeStatus
+  (
+    Arcadia_Process* process,
+    Arcadia_ARMS_Status status
+  )
+{
+  switch (status) {
+    case Arcadia_ARMS_Status_AllocationFailed: {
+      Arcadia_Thread_setStatus(Arcadia_Process_getThread(process), Arcadia_Status_AllocationFailed);
+    } break;
+    case Arcadia_ARMS_Status_ArgumentValueInvalid: {
+      Arcadia_Thread_setStatus(Arcadia_Process_getThread(process), Arcadia_Status_ArgumentValueInvalid);
+    } break;
+    case Arcadia_ARMS_Status_OperationInvalid: {
+      Arcadia_Thread_setStatus(Arcadia_Process_getThread(process), Arcadia_Status_OperationInvalid);
+    } break;
+    case Arcadia_ARMS_Status_TypeExists: {
+      Arcadia_Thread_setStatus(Arcadia_Process_getThread(process), Arcadia_Status_OperationInvalid);
+    } break;
+    default: {
+      Arcadia_Thread_setStatus(Arcadia_Process_getThread(process), Arcadia_Status_OperationInvalid);
+    } break;
+  };
+  Arcadia_Thread_jump(Arcadia_Process_getThread(process));
+}
+
 void
 Arcadia_Process_registerType
   (
@@ -511,26 +928,41 @@ Arcadia_Process_registerType
     Arcadia_Process_FinalizeCallback* finalize
   )
 {
+  Arcadia_Process_lockRuntime(process);
   Arcadia_ARMS_Status status = Arcadia_ARMS_addType(name, nameLength, context, typeRemoved, visit, finalize);
+  Arcadia_Process_unlockRuntime(process);
   if (status) {
-    switch (status) {
-      case Arcadia_ARMS_Status_AllocationFailed: {
-        Arcadia_Thread_setStatus(Arcadia_Process_getThread(process), Arcadia_Status_AllocationFailed);
-      } break;
-      case Arcadia_ARMS_Status_ArgumentValueInvalid: {
-        Arcadia_Thread_setStatus(Arcadia_Process_getThread(process), Arcadia_Status_ArgumentValueInvalid);
-      } break;
-      case Arcadia_ARMS_Status_OperationInvalid: {
-        Arcadia_Thread_setStatus(Arcadia_Process_getThread(process), Arcadia_Status_OperationInvalid);
-      } break;
-      case Arcadia_ARMS_Status_TypeExists: {
-        Arcadia_Thread_setStatus(Arcadia_Process_getThread(process), Arcadia_Status_OperationInvalid);
-      } break;
-      default: {
-        Arcadia_Thread_setStatus(Arcadia_Process_getThread(process), Arcadia_Status_OperationInvalid);
-      } break;
-    };
-    Arcadia_Thread_jump(Arcadia_Process_getThread(process));
+    raiseAddTypeStatus(process, status);
+  }
+}
+
+void
+Arcadia_Process_registerTypeOnce
+  (
+    Arcadia_Process* process,
+    uint32_t volatile* registered,
+    const char* name,
+    size_t nameLength,
+    void* context,
+    Arcadia_Process_TypeRemovedCallback* typeRemoved,
+    Arcadia_Process_VisitCallback* visit,
+    Arcadia_Process_FinalizeCallback* finalize
+  )
+{
+  if (Arcadia_Memory_atomicLoad32(registered)) {
+    return;
+  }
+  Arcadia_ARMS_Status status = Arcadia_ARMS_Status_Success;
+  Arcadia_Process_lockRuntime(process);
+  if (!Arcadia_Memory_atomicLoad32(registered)) {
+    status = Arcadia_ARMS_addType(name, nameLength, context, typeRemoved, visit, finalize);
+    if (!status) {
+      Arcadia_Memory_atomicStore32(registered, 1);
+    }
+  }
+  Arcadia_Process_unlockRuntime(process);
+  if (status) {
+    raiseAddTypeStatus(process, status);
   }
 }
 
@@ -545,7 +977,13 @@ Arcadia_Process_allocate
   )
 {
   void* q = NULL;
+  Arcadia_Process_lockRuntime(process);
   Arcadia_ARMS_Status status = Arcadia_ARMS_allocate(&q, name, nameLength, size);
+  if (!status) {
+    process->statistics.numberOfAllocatedObjects++;
+    process->statistics.numberOfAllocatedBytes += size;
+  }
+  Arcadia_Process_unlockRuntime(process);
   if (status) {
     switch (status) {
       case Arcadia_ARMS_Status_AllocationFailed: {
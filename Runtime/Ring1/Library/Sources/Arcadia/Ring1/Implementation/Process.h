@@ -46,15 +46,104 @@ typedef uint32_t Arcadia_ProcessStatus;
 #define Arcadia_ProcessStatus_OperationInvalid (3)
 #define Arcadia_ProcessStatus_EnvironmentFailed (4)
 
-/// @brief Get the thread of this process.
+/// @brief Get the thread of this process attached to the calling operating system thread.
 /// @param process A pointer to this Arcadia_Process object.
-/// @return A pointer to the Arcadia_Thread object of this Arcadia_Process object.
+/// @return A pointer to the Arcadia_Thread object attached to the calling operating system thread.
+/// If the calling operating system thread is not attached, a pointer to the main thread is returned.
+/// The main thread is the thread of the operating system thread which created the process.
 Arcadia_Thread*
 Arcadia_Process_getThread
   (
     Arcadia_Process* process
   );
 
+/// @brief Attach the calling operating system thread to this process.
+/// @param process A pointer to this Arcadia_Process object.
+/// @param [out] thread A pointer to a <code>Arcadia_Thread*</code> variable.
+/// @post
+/// If the call to this function is successful:
+/// - <code>*thread</code> was assigned a pointer to a new Arcadia_Thread object with its own value stack and its own jump target stack.
+/// - the caller acquired a reference to the process which is relinquished by Arcadia_Process_detachThread.
+/// @return #Arcadia_ProcessStatus_Success on success.
+/// - #Arcadia_ProcessStatus_ArgumentValueInvalid @a process or @a thread is a null pointer
+/// - #Arcadia_ProcessStatus_OperationInvalid the calling operating system thread is already attached or the reference counter would overflow
+/// - #Arcadia_ProcessStatus_AllocationFailed an allocation failed
+/// @remarks
+/// The thread is running when this function returns.
+/// If a thread is collecting, this function waits until the collection is finished.
+Arcadia_ProcessStatus
+Arcadia_Process_attachThread
+  (
+    Arcadia_Process* process,
+    Arcadia_Thread** thread
+  );
+
+/// @brief Detach a thread from this process.
+/// @param process A pointer to this Arcadia_Process object.
+/// @param thread A pointer to the Arcadia_Thread object returned by Arcadia_Process_attachThread.
+/// @return #Arcadia_ProcessStatus_Success on success.
+/// - #Arcadia_ProcessStatus_ArgumentValueInvalid @a process or @a thread is a null pointer or @a thread is the main thread
+/// - #Arcadia_ProcessStatus_OperationInvalid @a thread is not attached to the calling operating system thread
+/// @remarks The values on the value stack of the thread are no longer roots.
+Arcadia_ProcessStatus
+Arcadia_Process_detachThread
+  (
+    Arcadia_Process* process,
+    Arcadia_Thread* thread
+  );
+
+/// @brief Acquire the runtime lock of this process.
+/// @param process A pointer to this Arcadia_Process object.
+/// @remarks
+/// The runtime lock guards the state shared by all threads of the process: the managed memory, the types, the names, and the atoms.
+/// The lock is recursive. A thread waiting for the lock is not stopped: objects referenced by its local variables survive collections.
+/// A thread holding the runtime lock must not wait for other threads, pass safepoints, or enter safe regions.
+void
+Arcadia_Process_lockRuntime
+  (
+    Arcadia_Process* process
+  );
+
+/// @brief Relinquish the runtime lock of this process.
+/// @param process A pointer to this Arcadia_Process object.
+void
+Arcadia_Process_unlockRuntime
+  (
+    Arcadia_Process* process
+  );
+
+/// @brief Park this thread if another thread requested to collect.
+/// @param thread A pointer to this Arcadia_Thread object.
+/// @remarks
+/// Threads other than the collecting thread must reach a safepoint or be in a safe region before the collection starts.
+/// Objects a thread still requires after a safepoint must be reachable from the value stack of the thread or must be locked.
+/// This function does nothing if the thread holds the runtime lock.
+void
+Arcadia_Thread_safepoint
+  (
+    Arcadia_Thread* thread
+  );
+
+/// @brief Enter a safe region.
+/// @param thread A pointer to this Arcadia_Thread object.
+/// @remarks
+/// A thread enters a safe region before it blocks (e.g., when it waits for a mutex or a condition).
+/// Inside the safe region the thread must not access managed memory, collections may run at any time.
+void
+Arcadia_Thread_enterSafeRegion
+  (
+    Arcadia_Thread* thread
+  );
+
+/// @brief Leave a safe region.
+/// @param thread A pointer to this Arcadia_Thread object.
+/// @remarks If a thread is collecting, this function waits until the collection is finished.
+void
+Arcadia_Thread_leaveSafeRegion
+  (
+    Arcadia_Thread* thread
+  );
+
 /// @return #Arcadia_ProcessStatus_Success on success.
 /// - #Arcadia_ProcessStatus_ArgumentValueInvalid @a process is a null pointer
 /// - #Arcadia_ProcessStatus_OperationInvalid the reference counter would overflow or underflow from this call
@@ -114,12 +203,23 @@ Arcadia_Process_unlockObject
     void* object
   );
 
+/// @brief Run one collection cycle without invoking the arena callbacks.
+/// @param process A pointer to this Arcadia_Process object.
+/// @return #Arcadia_Status_OperationInvalid if the calling thread holds the runtime lock.
+/// @remarks The other threads of the process are stopped for the duration of the cycle.
 Arcadia_Status
 Arcadia_Process_stepARMS
   (
     Arcadia_Process* process
   );
 
+/// @brief Run collection cycles until no more objects are finalized.
+/// @param process A pointer to this Arcadia_Process object.
+/// @param purgeCaches If @a true, caches (e.g., names and atoms) are purged.
+/// @remarks
+/// The calling thread waits until all other threads of the process are parked at safepoints or are in safe regions and then acquires the runtime lock.
+/// If the calling thread holds the runtime lock, #Arcadia_Status_OperationInvalid is returned.
+/// The value stacks and the raised values of all threads are roots.
 Arcadia_Status
 Arcadia_Process_runARMS
   (
@@ -127,6 +227,44 @@ Arcadia_Process_runARMS
     bool purgeCaches
   );
 
+/// @brief Get the number of objects reclaimed by the last collection.
+/// @param process A pointer to this Arcadia_Process object.
+/// @return The number of objects reclaimed by the last call to Arcadia_Process_stepARMS or Arcadia_Process_runARMS.
+/// @remarks
+/// If the collector is run once per frame, then this is the number of managed objects which became garbage during the preceding frame.
+size_t
+Arcadia_Process_getNumberOfReclaimedObjects
+  (
+    Arcadia_Process* process
+  );
+
+/// @brief The cumulative statistics of the managed memory of a process.
+typedef struct Arcadia_Process_Statistics {
+  /// @brief The number of objects allocated by Arcadia_Process_allocate.
+  uint64_t numberOfAllocatedObjects;
+  /// @brief The number of Bytes allocated by Arcadia_Process_allocate.
+  uint64_t numberOfAllocatedBytes;
+  /// @brief The number of calls to Arcadia_Process_stepARMS or Arcadia_Process_runARMS.
+  uint64_t numberOfCollections;
+  /// @brief The number of objects reclaimed by all calls to Arcadia_Process_stepARMS or Arcadia_Process_runARMS.
+  uint64_t numberOfReclaimedObjects;
+  /// @brief The time in nanoseconds spent in all calls to Arcadia_Process_stepARMS or Arcadia_Process_runARMS including the time to stop the world.
+  uint64_t collectionTime;
+} Arcadia_Process_Statistics;
+
+/// @brief Get the cumulative statistics of the managed memory of this process.
+/// @param process A pointer to this Arcadia_Process object.
+/// @param statistics A pointer to an Arcadia_Process_Statistics object.
+/// @remarks
+/// The statistics are counted from the creation of the process.
+/// To measure a piece of code, get the statistics before and after the code and subtract.
+void
+Arcadia_Process_getStatistics
+  (
+    Arcadia_Process* process,
+    Arcadia_Process_Statistics* statistics
+  );
+
 typedef void (Arcadia_Process_ArenaPreMarkCallback)(Arcadia_Thread* thread, bool purgeCaches);
 typedef void (Arcadia_Process_ArenaVisitCallback)(Arcadia_Thread* thread);
 typedef void (Arcadia_Process_ArenaFinalizeCallback)(Arcadia_Thread* thread, size_t* destroyed);
@@ -210,6 +348,25 @@ Arcadia_Process_registerType
     Arcadia_Process_FinalizeCallback* finalize
   );
 
+/// @brief Register a type unless it is registered.
+/// @param process A pointer to the process.
+/// @param registered A pointer to a flag. If the flag is @a 0, the type is registered and the flag is set to @a 1.
+/// The flag is tested again under the runtime lock: threads racing to register the same type register it exactly once.
+/// The type removed callback is expected to reset the flag to @a 0.
+/// @remarks The other parameters are the parameters of Arcadia_Process_registerType.
+void
+Arcadia_Process_registerTypeOnce
+  (
+    Arcadia_Process* process,
+    uint32_t volatile* registered,
+    const char* name,
+    size_t nameLength,
+    void* context,
+    Arcadia_Process_TypeRemovedCallback* typeRemoved,
+    Arcadia_Process_VisitCallback* visit,
+    Arcadia_Process_FinalizeCallback* finalize
+  );
+
 /// @brief Allocate managed memory.
 /// @param process A pointer to the process.
 /// @param p A pointer to a <code>void*</code> variable.
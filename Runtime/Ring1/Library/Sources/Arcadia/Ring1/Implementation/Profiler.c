@@ -0,0 +1,364 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#define ARCADIA_RING1_MODULE (1)
+#include "Arcadia/Ring1/Implementation/Profiler.module.h"
+
+#include "Arcadia/ARMS/Include.h"
+#include "Arcadia/Ring1/Implementation/Thread.module.h"
+#include "Arcadia/Ring1/Implementation/Concurrency/Atomic.h"
+#include "Arcadia/Ring1/Implementation/Concurrency/CompareAndSwap.h"
+#include <inttypes.h>
+#include <stdio.h>
+
+#if Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  #define WIN32_LEAN_AND_MEAN
+  #include <Windows.h>
+#elif Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem
+  #include <time.h>
+#else
+  #error("operating system not (yet) supported")
+#endif
+
+#define EventKind_BeginZone (1)
+#define EventKind_EndZone (2)
+#define EventKind_Counter (3)
+
+typedef struct Event Event;
+
+struct Event {
+  char const* name;
+  Arcadia_Natural64Value timestamp;
+  Arcadia_Integer64Value value;
+  uint32_t kind;
+};
+
+// The number of events in a chunk.
+#define ChunkCapacity (4096)
+
+typedef struct Chunk Chunk;
+
+struct Chunk {
+  // The next chunk. Accessed atomically.
+  Chunk* volatile next;
+  // The number of events in this chunk. Accessed atomically.
+  uint32_t volatile size;
+  Event events[ChunkCapacity];
+};
+
+struct Arcadia_Profiler_Buffer {
+  // The next buffer in the list of buffers.
+  Arcadia_Profiler_Buffer* next;
+  // The identifier of the thread in the trace.
+  uint32_t identifier;
+  Chunk* first;
+  Chunk* last;
+};
+
+// The list of buffers of all threads. Buffers are prepended by compare and swap.
+static Arcadia_Profiler_Buffer* volatile g_buffers = NULL;
+
+// The number of buffers created so far. Accessed atomically.
+static uint32_t volatile g_numberOfBuffers = 0;
+
+// The number of events dropped because a chunk could not be allocated. Accessed atomically.
+static uint32_t volatile g_numberOfDroppedEvents = 0;
+
+Arcadia_Natural64Value
+Arcadia_Profiler_getTimestamp
+  (
+  )
+{
+#if Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
+  LARGE_INTEGER counter, frequency;
+  QueryPerformanceCounter(&counter);
+  QueryPerformanceFrequency(&frequency);
+  // Split to avoid an overflow of counter * 10^9.
+  Arcadia_Natural64Value seconds = (Arcadia_Natural64Value)(counter.QuadPart / frequency.QuadPart);
+  Arcadia_Natural64Value remainder = (Arcadia_Natural64Value)(counter.QuadPart % frequency.QuadPart);
+  return seconds * UINT64_C(1000000000) + (remainder * UINT64_C(1000000000)) / (Arcadia_Natural64Value)frequency.QuadPart;
+#elif Arcadia_Configuration_OperatingSystem_Linux == Arcadia_Configuration_OperatingSystem
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (Arcadia_Natural64Value)t.tv_sec * UINT64_C(1000000000) + (Arcadia_Natural64Value)t.tv_nsec;
+#else
+  #error("operating system not (yet) supported")
+#endif
+}
+
+#if 1 == Arcadia_Configuration_Profiler_Enabled
+
+static Chunk*
+allocateChunk
+  (
+  )
+{
+  Chunk* chunk = NULL;
+  if (Arcadia_ARMS_MemoryManager_allocate(Arcadia_ARMS_getDefaultMemoryManager(), (void**)&chunk, sizeof(Chunk))) {
+    return NULL;
+  }
+  chunk->next = NULL;
+  chunk->size = 0;
+  return chunk;
+}
+
+// Get the slot for the next event of the calling thread.
+// Returns a null pointer if the buffer or a chunk could not be allocated.
+// The event is published by publishEvent.
+static Event*
+allocateEvent
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Profiler_Buffer* buffer = thread->profilerBuffer;
+  if (!buffer) {
+    if (Arcadia_ARMS_MemoryManager_allocate(Arcadia_ARMS_getDefaultMemoryManager(), (void**)&buffer, sizeof(Arcadia_Profiler_Buffer))) {
+      Arcadia_Memory_atomicAdd32(&g_numberOfDroppedEvents, 1);
+      return NULL;
+    }
+    buffer->first = allocateChunk();
+    if (!buffer->first) {
+      Arcadia_ARMS_MemoryManager_deallocate(Arcadia_ARMS_getDefaultMemoryManager(), buffer);
+      Arcadia_Memory_atomicAdd32(&g_numberOfDroppedEvents, 1);
+      return NULL;
+    }
+    buffer->last = buffer->first;
+    buffer->identifier = Arcadia_Memory_atomicAdd32(&g_numberOfBuffers, 1);
+    Arcadia_Profiler_Buffer* head;
+    do {
+      head = Arcadia_Memory_atomicLoadPointer((void* volatile*)&g_buffers);
+      buffer->next = head;
+    } while (head != Arcadia_Memory_compareAndSwap((void* volatile*)&g_buffers, head, buffer));
+    thread->profilerBuffer = buffer;
+  }
+  Chunk* chunk = buffer->last;
+  if (ChunkCapacity == chunk->size) {
+    Chunk* newChunk = allocateChunk();
+    if (!newChunk) {
+      Arcadia_Memory_atomicAdd32(&g_numberOfDroppedEvents, 1);
+      return NULL;
+    }
+    Arcadia_Memory_atomicStorePointer((void* volatile*)&chunk->next, newChunk);
+    buffer->last = newChunk;
+    chunk = newChunk;
+  }
+  return &chunk->events[chunk->size];
+}
+
+// Publish the event returned by the last call to allocateEvent.
+static inline void
+publishEvent
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Chunk* chunk = thread->profilerBuffer->last;
+  Arcadia_Memory_atomicStore32(&chunk->size, chunk->size + 1);
+}
+
+void
+Arcadia_Profiler_recordBeginZone
+  (
+    Arcadia_Thread* thread,
+    char const* name
+  )
+{
+  Event* event = allocateEvent(thread);
+  if (event) {
+    event->kind = EventKind_BeginZone;
+    event->name = name;
+    event->value = 0;
+    event->timestamp = Arcadia_Profiler_getTimestamp();
+    publishEvent(thread);
+  }
+}
+
+void
+Arcadia_Profiler_recordEndZone
+  (
+    Arcadia_Thread* thread
+  )
+{
+  // Read the clock first such that the allocation of a chunk is attributed to the zone.
+  Arcadia_Natural64Value timestamp = Arcadia_Profiler_getTimestamp();
+  Event* event = allocateEvent(thread);
+  if (event) {
+    event->kind = EventKind_EndZone;
+    event->name = NULL;
+    event->value = 0;
+    event->timestamp = timestamp;
+    publishEvent(thread);
+  }
+}
+
+void
+Arcadia_Profiler_recordCounter
+  (
+    Arcadia_Thread* thread,
+    char const* name,
+    Arcadia_Integer64Value value
+  )
+{
+  Event* event = allocateEvent(thread);
+  if (event) {
+    event->kind = EventKind_Counter;
+    event->name = name;
+    event->value = value;
+    event->timestamp = Arcadia_Profiler_getTimestamp();
+    publishEvent(thread);
+  }
+}
+
+#endif
+
+static void
+appendString
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    char const* string
+  )
+{
+  Arcadia_SizeValue n = 0;
+  while (string[n]) {
+    n++;
+  }
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, string, n);
+}
+
+#if 1 == Arcadia_Configuration_Profiler_Enabled
+
+// Append a name as a JSON string literal.
+static void
+appendName
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    char const* name
+  )
+{
+  appendString(thread, target, "\"");
+  for (char const* p = name; *p; ++p) {
+    char temporary[8];
+    unsigned char c = (unsigned char)*p;
+    if ('"' == c || '\\' == c) {
+      temporary[0] = '\\';
+      temporary[1] = (char)c;
+      temporary[2] = '\0';
+    } else if (c < 0x20) {
+      snprintf(temporary, sizeof(temporary), "\\u%04x", (unsigned int)c);
+    } else {
+      temporary[0] = (char)c;
+      temporary[1] = '\0';
+    }
+    appendString(thread, target, temporary);
+  }
+  appendString(thread, target, "\"");
+}
+
+// Append the common fields of an event: the phase, the process and thread identifiers, and the timestamp in microseconds.
+static void
+appendFields
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    char const* phase,
+    uint32_t identifier,
+    Arcadia_Natural64Value timestamp
+  )
+{
+  char temporary[128];
+  snprintf(temporary, sizeof(temporary), "\"ph\":\"%s\",\"pid\":1,\"tid\":%" PRIu32 ",\"ts\":%" PRIu64 ".%03" PRIu64,
+           phase, identifier, timestamp / UINT64_C(1000), timestamp % UINT64_C(1000));
+  appendString(thread, target, temporary);
+}
+
+#endif
+
+void
+Arcadia_Profiler_exportChromeTrace
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target
+  )
+{
+  appendString(thread, target, "{\"traceEvents\":[");
+#if 1 == Arcadia_Configuration_Profiler_Enabled
+  Arcadia_BooleanValue first = Arcadia_BooleanValue_True;
+  for (Arcadia_Profiler_Buffer* buffer = Arcadia_Memory_atomicLoadPointer((void* volatile*)&g_buffers); NULL != buffer; buffer = buffer->next) {
+    char temporary[128];
+    snprintf(temporary, sizeof(temporary), "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%" PRIu32 ",\"args\":{\"name\":\"Thread %" PRIu32 "\"}}",
+             first ? "" : ",", buffer->identifier, buffer->identifier);
+    appendString(thread, target, temporary);
+    first = Arcadia_BooleanValue_False;
+    for (Chunk* chunk = buffer->first; NULL != chunk; chunk = Arcadia_Memory_atomicLoadPointer((void* volatile*)&chunk->next)) {
+      for (uint32_t i = 0, n = Arcadia_Memory_atomicLoad32(&chunk->size); i < n; ++i) {
+        Event* event = &chunk->events[i];
+        switch (event->kind) {
+          case EventKind_BeginZone: {
+            appendString(thread, target, ",\n{\"name\":");
+            appendName(thread, target, event->name);
+            appendString(thread, target, ",");
+            appendFields(thread, target, "B", buffer->identifier, event->timestamp);
+            appendString(thread, target, "}");
+          } break;
+          case EventKind_EndZone: {
+            appendString(thread, target, ",\n{");
+            appendFields(thread, target, "E", buffer->identifier, event->timestamp);
+            appendString(thread, target, "}");
+          } break;
+          case EventKind_Counter: {
+            appendString(thread, target, ",\n{\"name\":");
+            appendName(thread, target, event->name);
+            appendString(thread, target, ",");
+            appendFields(thread, target, "C", buffer->identifier, event->timestamp);
+            snprintf(temporary, sizeof(temporary), ",\"args\":{\"value\":%" PRId64 "}}", event->value);
+            appendString(thread, target, temporary);
+          } break;
+        };
+      }
+    }
+  }
+#endif
+  appendString(thread, target, "\n],\"displayTimeUnit\":\"ns\"}\n");
+}
+
+Arcadia_Natural64Value
+Arcadia_Profiler_getNumberOfDroppedEvents
+  (
+    Arcadia_Thread* thread
+  )
+{ return Arcadia_Memory_atomicLoad32(&g_numberOfDroppedEvents); }
+
+void
+Arcadia_Profiler_releaseBuffers
+  (
+  )
+{
+  Arcadia_Profiler_Buffer* buffer = Arcadia_Memory_atomicLoadPointer((void* volatile*)&g_buffers);
+  Arcadia_Memory_atomicStorePointer((void* volatile*)&g_buffers, NULL);
+  while (buffer) {
+    Arcadia_Profiler_Buffer* nextBuffer = buffer->next;
+    Chunk* chunk = buffer->first;
+    while (chunk) {
+      Chunk* nextChunk = chunk->next;
+      Arcadia_ARMS_MemoryManager_deallocate(Arcadia_ARMS_getDefaultMemoryManager(), chunk);
+      chunk = nextChunk;
+    }
+    Arcadia_ARMS_MemoryManager_deallocate(Arcadia_ARMS_getDefaultMemoryManager(), buffer);
+    buffer = nextBuffer;
+  }
+}
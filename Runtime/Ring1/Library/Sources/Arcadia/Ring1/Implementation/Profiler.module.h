@@ -0,0 +1,37 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_RING1_IMPLEMENTATION_PROFILER_MODULE_H_INCLUDED)
+#define ARCADIA_RING1_IMPLEMENTATION_PROFILER_MODULE_H_INCLUDED
+
+#if !defined(ARCADIA_RING1_MODULE)
+  #error("do not include directly, include `Arcadia/Ring1/Include.h` instead")
+#endif
+#if defined(ARCADIA_RING1_EXPORT)
+  #error("this file is not supposed to be exported")
+#endif
+#include "Arcadia/Ring1/Implementation/Profiler.h"
+
+/// @brief The buffer of the events recorded by a thread.
+typedef struct Arcadia_Profiler_Buffer Arcadia_Profiler_Buffer;
+
+/// @brief Release the buffers of all threads.
+/// @remarks Invoked by the process when it is relinquished for the last time.
+void
+Arcadia_Profiler_releaseBuffers
+  (
+  );
+
+#endif // ARCADIA_RING1_IMPLEMENTATION_PROFILER_MODULE_H_INCLUDED
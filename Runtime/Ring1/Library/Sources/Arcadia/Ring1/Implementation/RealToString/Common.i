@@ -329,6 +329,7 @@ Buffer_append
 {
   if (buffer->m - buffer->n < numberOfBytes) {
     Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
   }
   Arcadia_Memory_copy(thread, buffer->p + buffer->n, bytes, numberOfBytes);
   buffer->n += numberOfBytes;
@@ -17,22 +17,23 @@
 #include "Arcadia/Ring1/Implementation/Thread.module.h"
 
 #include "Arcadia/ARMS/Include.h"
+#include "Arcadia/Ring1/Implementation/Memory.h"
 
-void
+Arcadia_Status
 Arcadia_Thread_initializeValueStack
   (
     Arcadia_Thread* thread
   )
 {
   if (Arcadia_ARMS_MemoryManager_allocate(Arcadia_ARMS_getDefaultMemoryManager(), (void**)&thread->stack.elements, sizeof(Arcadia_Value) * 8)) {
-    Arcadia_Thread_setStatus(thread, Arcadia_Status_AllocationFailed);
-    Arcadia_Thread_jump(thread);
+    return Arcadia_Status_AllocationFailed;
   }
   for (Arcadia_SizeValue i = 0; i < 8; ++i) {
     thread->stack.elements[i] = Arcadia_Value_Initializer();
   }
   thread->stack.size = 0;
   thread->stack.capacity = 8;
+  return Arcadia_Status_Success;
 }
 
 void
@@ -45,7 +46,7 @@ Arcadia_Thread_uninitializeValueStack
   thread->stack.elements = NULL;
 }
 
-void
+Arcadia_Status
 Arcadia_Thread_initialize
   (
     Arcadia_Thread* thread
@@ -55,7 +56,14 @@ Arcadia_Thread_initialize
   thread->status = Arcadia_Status_Success;
   thread->jumpTarget = NULL;
   thread->raisedValue = Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void);
-  Arcadia_Thread_initializeValueStack(thread);
+  thread->next = NULL;
+  thread->state = Arcadia_ThreadState_Running;
+  thread->runtimeLockCount = 0;
+  Arcadia_Memory_fillZero(thread, &thread->stringStatistics, sizeof(Arcadia_String_Statistics));
+#if 1 == Arcadia_Configuration_Profiler_Enabled
+  thread->profilerBuffer = NULL;
+#endif
+  return Arcadia_Thread_initializeValueStack(thread);
 }
 
 void
@@ -64,6 +72,12 @@ Arcadia_Thread_uninitialize
     Arcadia_Thread* thread
   )
 {
+#if 1 == Arcadia_Configuration_Profiler_Enabled
+  thread->profilerBuffer = NULL;
+#endif
+  thread->runtimeLockCount = 0;
+  thread->state = Arcadia_ThreadState_Running;
+  thread->next = NULL;
   thread->raisedValue = Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void);
   Arcadia_Thread_uninitializeValueStack(thread);
   thread->jumpTarget = NULL;
@@ -23,6 +23,16 @@
   #error("this file is not supposed to be exported")
 #endif
 #include "Arcadia/Ring1/Implementation/Thread.h"
+#include "Arcadia/Ring1/Implementation/Objects/String.h"
+#include "Arcadia/Ring1/Implementation/Profiler.module.h"
+#include <stdint.h>
+
+/// The thread executes code which may access managed memory.
+#define Arcadia_ThreadState_Running (0)
+
+/// The thread is parked at a safepoint or is inside a safe region.
+/// It does not access managed memory until it leaves that state.
+#define Arcadia_ThreadState_Safe (1)
 
 struct Arcadia_Thread {
   Arcadia_Status status;
@@ -38,10 +48,25 @@ struct Arcadia_Thread {
   Arcadia_Process* process;
   // The currently raised value.
   Arcadia_Value raisedValue;
+  // The next thread in the list of threads attached to the process.
+  Arcadia_Thread* next;
+  // The state of this thread, either Arcadia_ThreadState_Running or Arcadia_ThreadState_Safe.
+  // Accessed atomically as the collecting thread reads it.
+  uint32_t volatile state;
+  // How often this thread has acquired the runtime lock of the process.
+  Arcadia_SizeValue runtimeLockCount;
+  // The counters of the strings created by this thread.
+  Arcadia_String_Statistics stringStatistics;
+#if 1 == Arcadia_Configuration_Profiler_Enabled
+  // The buffer of the events recorded by this thread or a null pointer.
+  // The buffer is owned by the profiler and outlives this thread.
+  Arcadia_Profiler_Buffer* profilerBuffer;
+#endif
 };
 
 /*@undefined thread does not point to an uninitialized Arcadia_Thread object*/
-void
+/*@return Arcadia_Status_Success on success, Arcadia_Status_AllocationFailed on failure*/
+Arcadia_Status
 Arcadia_Thread_initializeValueStack
   (
     Arcadia_Thread* thread
@@ -55,7 +80,9 @@ Arcadia_Thread_uninitializeValueStack
   );
 
 /*@undefined thread does not point to an uninitialized Arcadia_Thread object*/
-void
+/*@return Arcadia_Status_Success on success, Arcadia_Status_AllocationFailed on failure*/
+/*@remarks The thread has no jump target when this function is invoked, hence it does not raise errors.*/
+Arcadia_Status
 Arcadia_Thread_initialize
   (
     Arcadia_Thread* thread
@@ -19,6 +19,7 @@
 #include "Arcadia/Ring1/Implementation/Thread.h"
 #include "Arcadia/Ring1/Implementation/Diagnostics.h"
 #include "Arcadia/Ring1/Implementation/Memory.h"
+#include "Arcadia/Ring1/Implementation/Numerics/hash.h"
 #include <assert.h>
 
 #if Arcadia_Configuration_OperatingSystem_Windows == Arcadia_Configuration_OperatingSystem
@@ -96,6 +97,7 @@ Arcadia_Names_destroy
 struct Arcadia_Names {
   Arcadia_Name** buckets;
   size_t size;
+  // The capacity is a power of two such that the index of a bucket can be computed by masking.
   size_t capacity;
 };
 
@@ -119,7 +121,7 @@ Arcadia_Name_finalizeCallback
     Arcadia_Name* name
   )
 {
-    size_t index = name->hashValue % g_names->capacity;
+    size_t index = name->hashValue & (g_names->capacity - 1);
     Arcadia_Name** previous = &g_names->buckets[index];
     Arcadia_Name* current = g_names->buckets[index];
     while (current) {
@@ -373,8 +375,42 @@ _Arcadia_Names_onShutDown
   }
 }
 
-Arcadia_Name*
-Arcadia_Names_getOrCreateName
+static void
+Arcadia_Names_maybeResize
+  (
+    Arcadia_Thread* thread
+  )
+{
+  if (g_names->size < g_names->capacity) {
+    return;
+  }
+  size_t oldCapacity = g_names->capacity;
+  if (oldCapacity > (SIZE_MAX / sizeof(Arcadia_Name*)) / 2) {
+    // Cannot double the capacity.
+    return;
+  }
+  size_t newCapacity = oldCapacity * 2;
+  Arcadia_Name** oldBuckets = g_names->buckets;
+  Arcadia_Name** newBuckets = Arcadia_Memory_allocateUnmanaged(thread, sizeof(Arcadia_Name*) * newCapacity);
+  for (size_t i = 0, n = newCapacity; i < n; ++i) {
+    newBuckets[i] = NULL;
+  }
+  for (size_t i = 0, n = oldCapacity; i < n; ++i) {
+    while (oldBuckets[i]) {
+      Arcadia_Name* node = oldBuckets[i];
+      oldBuckets[i] = node->next;
+      size_t j = node->hashValue & (newCapacity - 1);
+      node->next = newBuckets[j];
+      newBuckets[j] = node;
+    }
+  }
+  Arcadia_Memory_deallocateUnmanaged(thread, oldBuckets);
+  g_names->buckets = newBuckets;
+  g_names->capacity = newCapacity;
+}
+
+static Arcadia_Name*
+getOrCreateName
   (
     Arcadia_Thread* thread,
     char const* bytes,
@@ -383,11 +419,8 @@ Arcadia_Names_getOrCreateName
 {
   assert(NULL != thread);
   assert(NULL != bytes);
-  size_t hashValue = numberOfBytes;
-  for (size_t i = 0, n = numberOfBytes; i < n; ++i) {
-    hashValue = (hashValue << 3) ^ (hashValue >> 7) | (size_t)bytes[i];
-  }
-  size_t hashIndex = hashValue % g_names->capacity;
+  size_t hashValue = Arcadia_hashBytes(thread, bytes, numberOfBytes);
+  size_t hashIndex = hashValue & (g_names->capacity - 1);
   Arcadia_Name* name = NULL;
   for (name = g_names->buckets[hashIndex]; NULL != name; name = name->next) {
     if (name->numberOfBytes == numberOfBytes && name->hashValue == hashValue && !memcmp(name->bytes, bytes, numberOfBytes)) {
@@ -409,5 +442,32 @@ Arcadia_Names_getOrCreateName
   g_names->buckets[hashIndex] = name;
   g_names->size++;
 
+  Arcadia_Names_maybeResize(thread);
+
+  return name;
+}
+
+Arcadia_Name*
+Arcadia_Names_getOrCreateName
+  (
+    Arcadia_Thread* thread,
+    char const* bytes,
+    size_t numberOfBytes
+  )
+{
+  Arcadia_Process* process = Arcadia_Thread_getProcess(thread);
+  Arcadia_Name* name = NULL;
+  Arcadia_Process_lockRuntime(process);
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    name = getOrCreateName(thread, bytes, numberOfBytes);
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Process_unlockRuntime(process);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Process_unlockRuntime(process);
+    Arcadia_Thread_jump(thread);
+  }
   return name;
 }
@@ -30,6 +30,12 @@ typedef struct Arcadia_ObjectDispatch Arcadia_ObjectDispatch;
 /// For an object dispatch of type A1 <: A2 <: ... <: An the callback functions are invoked from the top mpost to the bottom most type.
 typedef void (Arcadia_Object_ConstructCallbackFunction)(Arcadia_Thread* thread, Arcadia_Object* self);
 
+/// @brief Type of a native construct callback function for values of Arcadia.Object or derived type.
+/// In contrast to a construct callback function, the argument values are passed directly and not via the value stack.
+/// Each object type may have its native construct callback function.
+/// For an object of type A1 <: A2 <: ... <: An the callback functions are invoked from the top most to the bottom most type.
+typedef void (Arcadia_Object_ConstructNativeCallbackFunction)(Arcadia_Thread* thread, Arcadia_Object* self, Arcadia_SizeValue numberOfArgumentValues, Arcadia_Value const* argumentValues);
+
 /// @brief Type of a destruct callback function for values of Arcadia.Object or derived type.
 /// Each object type may have its own destruct callback function.
 /// For an object of type A1 <: A2 <: ... <: An the callback functions are invoked from the bottom most to the top most type.
@@ -54,13 +60,15 @@ typedef struct Arcadia_ObjectType_Operations {
   Arcadia_Object_DestructCallbackFunction* destruct;
   Arcadia_Object_VisitCallbackFunction* visit;
   Arcadia_ObjectDispatch_InitializeCallbackFunction* initializeDispatch;
+  Arcadia_Object_ConstructNativeCallbackFunction* constructNative;
 } Arcadia_ObjectType_Operations;
 
 #define Arcadia_ObjectType_Operations_Initializer \
   .construct = NULL, \
   .destruct = NULL, \
   .visit = NULL, \
-  .initializeDispatch = NULL
+  .initializeDispatch = NULL, \
+  .constructNative = NULL
 
 /// Type operations for all types.
 typedef struct Arcadia_Type_Operations {
@@ -182,6 +190,25 @@ Arcadia_Type_isDescendantType
     Arcadia_TypeValue other
   );
 
+/// @brief The type of a function registering a type.
+typedef Arcadia_TypeValue (Arcadia_RegisterTypeFunction)(Arcadia_Thread* thread);
+
+/// @brief Get a lazily registered type.
+/// @param type A pointer to the variable caching the type.
+/// @param registerType A pointer to the function registering the type.
+/// @return The value of <code>*type</code>.
+/// If <code>*type</code> is the null pointer, then @a registerType is invoked and its result is assigned to <code>*type</code>.
+/// @remarks
+/// The registration is performed under the runtime lock such that threads do not register a type twice.
+/// The variable is read and written atomically such that a thread observing the type also observes its initialization.
+Arcadia_TypeValue
+Arcadia_getOrRegisterType
+  (
+    Arcadia_Thread* thread,
+    Arcadia_TypeValue* type,
+    Arcadia_RegisterTypeFunction* registerType
+  );
+
 /* Arcadia_Status_ArgumentValueInvalid, Arcadia_Status_AllocationFailed, Arcadia_Status_TypeExists */
 Arcadia_TypeValue
 Arcadia_registerEnumerationType
@@ -19,6 +19,7 @@
 #include "Arcadia/Ring1/Include.h"
 #include "Arcadia/Ring1/Implementation/TypeSystem/Names.module.h"
 #include "Arcadia/Ring1/Implementation/Atoms.module.h"
+#include "Arcadia/Ring1/Implementation/Concurrency/Atomic.h"
 
 #include <assert.h>
 #include <string.h>
@@ -166,6 +167,39 @@ Arcadia_Type_hasChildren
   return Arcadia_BooleanValue_False;
 }
 
+Arcadia_TypeValue
+Arcadia_getOrRegisterType
+  (
+    Arcadia_Thread* thread,
+    Arcadia_TypeValue* type,
+    Arcadia_RegisterTypeFunction* registerType
+  )
+{
+  Arcadia_TypeValue value = Arcadia_Memory_atomicLoadPointer((void* volatile*)type);
+  if (value) {
+    return value;
+  }
+  Arcadia_Process* process = Arcadia_Thread_getProcess(thread);
+  Arcadia_Process_lockRuntime(process);
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    // Another thread might have registered the type while this thread was waiting for the lock.
+    value = Arcadia_Memory_atomicLoadPointer((void* volatile*)type);
+    if (!value) {
+      value = registerType(thread);
+      Arcadia_Memory_atomicStorePointer((void* volatile*)type, value);
+    }
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Process_unlockRuntime(process);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Process_unlockRuntime(process);
+    Arcadia_Thread_jump(thread);
+  }
+  return value;
+}
+
 Arcadia_TypeValue
 Arcadia_registerEnumerationType
   (
@@ -476,16 +510,20 @@ memoryTypeDestructing
   )
 { g_memoryType = NULL; }
 
+static Arcadia_TypeValue
+registerMemoryType
+  (
+    Arcadia_Thread* thread
+  )
+{ return Arcadia_registerInternalType(thread, Arcadia_Names_getOrCreateName(thread, u8"Arcadia.Memory", sizeof(u8"Arcadia.Memory") - 1), NULL, &memoryTypeDestructing); }
+
 Arcadia_TypeValue
 _Arcadia_Memory_getType
   (
     Arcadia_Thread* thread
   )
 {
-  if (!g_memoryType) {
-    g_memoryType = Arcadia_registerInternalType(thread, Arcadia_Names_getOrCreateName(thread, u8"Arcadia.Memory", sizeof(u8"Arcadia.Memory") - 1), NULL, &memoryTypeDestructing);
-  }
-  return g_memoryType;
+  return Arcadia_getOrRegisterType(thread, (Arcadia_TypeValue*)&g_memoryType, &registerMemoryType);
 }
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -501,16 +539,20 @@ typeTypeDestructing
   g_typeType = NULL;
 }
 
+static Arcadia_TypeValue
+registerTypeType
+  (
+    Arcadia_Thread* thread
+  )
+{ return Arcadia_registerInternalType(thread, Arcadia_Names_getOrCreateName(thread, u8"Arcadia.Type", sizeof(u8"Arcadia.Type") - 1), NULL, &typeTypeDestructing); }
+
 Arcadia_TypeValue
 _Arcadia_Type_getType
   (
     Arcadia_Thread* thread
   )
 {
-  if (!g_typeType) {
-    g_typeType = Arcadia_registerInternalType(thread, Arcadia_Names_getOrCreateName(thread, u8"Arcadia.Type", sizeof(u8"Arcadia.Type") - 1), NULL, &typeTypeDestructing);
-  }
-  return g_typeType;
+  return Arcadia_getOrRegisterType(thread, (Arcadia_TypeValue*)&g_typeType, &registerTypeType);
 }
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -526,16 +568,20 @@ atomTypeDestructing
   g_atomType = NULL;
 }
 
+static Arcadia_TypeValue
+registerAtomType
+  (
+    Arcadia_Thread* thread
+  )
+{ return Arcadia_registerInternalType(thread, Arcadia_Names_getOrCreateName(thread, u8"Arcadia.Atom", sizeof(u8"Arcadia.Atom") - 1), NULL, &atomTypeDestructing); }
+
 Arcadia_TypeValue
 _Arcadia_AtomValue_getType
   (
     Arcadia_Thread* thread
   )
 {
-  if (!g_atomType) {
-    g_atomType = Arcadia_registerInternalType(thread, Arcadia_Names_getOrCreateName(thread, u8"Arcadia.Atom", sizeof(u8"Arcadia.Atom") - 1), NULL, &atomTypeDestructing);
-  }
-  return g_atomType;
+  return Arcadia_getOrRegisterType(thread, (Arcadia_TypeValue*)&g_atomType, &registerAtomType);
 }
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -36,7 +36,7 @@ Arcadia_Unicode_isUTF8
       _Arcadia_UTF8ArrayIterator_next(thread, &it);
     }
     Arcadia_BooleanValue result = !_Arcadia_UTF8ArrayIterator_hasError(thread, &it);
-    if (numberOfSymbols) *numberOfSymbols = _Arcadia_UTF8ArrayIterator_getCodePointIndex(thread, &it);
+    if (numberOfSymbols) *numberOfSymbols = _Arcadia_UTF8ArrayIterator_getNumberOfCodePoints(thread, &it);
     Arcadia_Thread_popJumpTarget(thread);
     _Arcadia_UTF8ArrayIterator_uninitialize(thread, &it);
     return result;
@@ -27,6 +27,13 @@
       void* context \
     ) \
   { g_##cName##_type = NULL; } \
+\
+  static Arcadia_TypeValue \
+  _##cName##_registerType \
+    ( \
+      Arcadia_Thread* thread \
+    ) \
+  { return Arcadia_registerScalarType(thread, Arcadia_Names_getOrCreateName(thread, cilName, sizeof(cilName) - 1), typeOperations, &_##cName##_typeDestructing); } \
 \
   Arcadia_TypeValue \
   _##cName##Value_getType \
@@ -34,10 +41,7 @@
       Arcadia_Thread* thread \
     ) \
   { \
-    if (!g_##cName##_type) { \
-      g_##cName##_type = Arcadia_registerScalarType(thread, Arcadia_Names_getOrCreateName(thread, cilName, sizeof(cilName) - 1), typeOperations, &_##cName##_typeDestructing); \
-    } \
-    return g_##cName##_type; \
+    return Arcadia_getOrRegisterType(thread, &g_##cName##_type, &_##cName##_registerType); \
   }
 
 #endif // ARCADIA_RING1_IMPLEMENTATION__DEFINESCALARTYPE_H_INCLUDED
@@ -32,6 +32,9 @@
 
 #include "Arcadia/Ring1/Implementation/Boolean.h"
 
+#include "Arcadia/Ring1/Implementation/Concurrency/MultiProducerQueue.h"
+#include "Arcadia/Ring1/Implementation/Concurrency/ThreadPool.h"
+
 #include "Arcadia/Ring1/Implementation/Diagnostics.h"
 
 #include "Arcadia/Ring1/Implementation/Enumeration.h"
@@ -80,6 +83,7 @@
 
 #include "Arcadia/Ring1/Implementation/Process.h"
 #include "Arcadia/Ring1/Implementation/ProcessExtensions.h"
+#include "Arcadia/Ring1/Implementation/Profiler.h"
 
 #include "Arcadia/Ring1/Implementation/Real32.h"
 #include "Arcadia/Ring1/Implementation/Real64.h"
@@ -0,0 +1,2693 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+// Identifiers used in the Arcadia headers.
+// Used to measure the distribution and the throughput of the hash function on identifier-heavy inputs.
+Identifier(u8"AL_LIBTYPE_STATIC")
+Identifier(u8"ARMS_TAG_H_INCLUDED")
+Identifier(u8"ARMS_Type")
+Identifier(u8"AddressFamily")
+Identifier(u8"ApplicationEvent")
+Identifier(u8"ApplicationQuitRequestedEvent")
+Identifier(u8"Arcadia_ADL_MaterialDefinition")
+Identifier(u8"Arcadia_ADL_MeshDefinition")
+Identifier(u8"Arcadia_ADL_ModelDefinition")
+Identifier(u8"Arcadia_ADL_PixelBufferDefinition")
+Identifier(u8"Arcadia_ADL_PixelBufferOperations_CheckerboardFillOperationDefinition")
+Identifier(u8"Arcadia_ADL_PixelBufferOperations_FillOperationDefinition")
+Identifier(u8"Arcadia_ADL_SampleBufferDefinition")
+Identifier(u8"Arcadia_ADL_SawtoothWaveDefinition")
+Identifier(u8"Arcadia_ADL_SineWaveDefinition")
+Identifier(u8"Arcadia_ADL_TextureDefinition")
+Identifier(u8"Arcadia_ADL_WhiteNoiseDefinition")
+Identifier(u8"Arcadia_ARMS_AlignOf")
+Identifier(u8"Arcadia_ARMS_AllocatorStatistics")
+Identifier(u8"Arcadia_ARMS_AllocatorStatistics_initialize")
+Identifier(u8"Arcadia_ARMS_AllocatorStatistics_onBlockAllocated")
+Identifier(u8"Arcadia_ARMS_AllocatorStatistics_onBlockDeallocated")
+Identifier(u8"Arcadia_ARMS_AllocatorStatistics_uninitialize")
+Identifier(u8"Arcadia_ARMS_Configuration_CompilerC")
+Identifier(u8"Arcadia_ARMS_Configuration_CompilerC_Gcc")
+Identifier(u8"Arcadia_ARMS_Configuration_CompilerC_Msvc")
+Identifier(u8"Arcadia_ARMS_Configuration_InstructionSetArchitecture")
+Identifier(u8"Arcadia_ARMS_Configuration_InstructionSetArchitecture_X32")
+Identifier(u8"Arcadia_ARMS_Configuration_InstructionSetArchitecture_X64")
+Identifier(u8"Arcadia_ARMS_Configuration_WithBarriers")
+Identifier(u8"Arcadia_ARMS_Configuration_WithLocks")
+Identifier(u8"Arcadia_ARMS_Configuration_WithNotifyDestroy")
+Identifier(u8"Arcadia_ARMS_DefaultMemoryManager")
+Identifier(u8"Arcadia_ARMS_DefaultMemoryManager_create")
+Identifier(u8"Arcadia_ARMS_FinalizeCallbackFunction")
+Identifier(u8"Arcadia_ARMS_MemoryManager")
+Identifier(u8"Arcadia_ARMS_MemoryManagerStartupShutdown_Status")
+Identifier(u8"Arcadia_ARMS_MemoryManagerStartupShutdown_Status_AllocationFailed")
+Identifier(u8"Arcadia_ARMS_MemoryManagerStartupShutdown_Status_ArgumentValueInvalid")
+Identifier(u8"Arcadia_ARMS_MemoryManagerStartupShutdown_Status_Success")
+Identifier(u8"Arcadia_ARMS_MemoryManager_Status")
+Identifier(u8"Arcadia_ARMS_MemoryManager_Status_AllocationFailed")
+Identifier(u8"Arcadia_ARMS_MemoryManager_Status_ArgumentValueInvalid")
+Identifier(u8"Arcadia_ARMS_MemoryManager_Status_Success")
+Identifier(u8"Arcadia_ARMS_MemoryManager_allocate")
+Identifier(u8"Arcadia_ARMS_MemoryManager_deallocate")
+Identifier(u8"Arcadia_ARMS_MemoryManager_destroy")
+Identifier(u8"Arcadia_ARMS_MemoryManager_reallocate")
+Identifier(u8"Arcadia_ARMS_Natural8")
+Identifier(u8"Arcadia_ARMS_Natural8_Maximum")
+Identifier(u8"Arcadia_ARMS_Natural8_Minimum")
+Identifier(u8"Arcadia_ARMS_NotifyDestroyCallback")
+Identifier(u8"Arcadia_ARMS_NotifyDestroyModule_notifyDestroy")
+Identifier(u8"Arcadia_ARMS_NotifyDestroyModule_shutdown")
+Identifier(u8"Arcadia_ARMS_NotifyDestroyModule_startup")
+Identifier(u8"Arcadia_ARMS_OffsetOf")
+Identifier(u8"Arcadia_ARMS_ReferenceCounter")
+Identifier(u8"Arcadia_ARMS_ReferenceCounter_Maximum")
+Identifier(u8"Arcadia_ARMS_ReferenceCounter_Minimum")
+Identifier(u8"Arcadia_ARMS_RunStatistics")
+Identifier(u8"Arcadia_ARMS_RunStatistics_StaticInitializer")
+Identifier(u8"Arcadia_ARMS_Size")
+Identifier(u8"Arcadia_ARMS_SizeOf")
+Identifier(u8"Arcadia_ARMS_Size_Maximum")
+Identifier(u8"Arcadia_ARMS_Size_Minimum")
+Identifier(u8"Arcadia_ARMS_SlabMemoryManager")
+Identifier(u8"Arcadia_ARMS_SlabMemoryManager_create")
+Identifier(u8"Arcadia_ARMS_Status")
+Identifier(u8"Arcadia_ARMS_Status_AllocationFailed")
+Identifier(u8"Arcadia_ARMS_Status_ArgumentValueInvalid")
+Identifier(u8"Arcadia_ARMS_Status_EnvironmentFailed")
+Identifier(u8"Arcadia_ARMS_Status_OperationInvalid")
+Identifier(u8"Arcadia_ARMS_Status_Success")
+Identifier(u8"Arcadia_ARMS_Status_TypeExists")
+Identifier(u8"Arcadia_ARMS_Status_TypeNotExists")
+Identifier(u8"Arcadia_ARMS_Tag")
+Identifier(u8"Arcadia_ARMS_TagFlags_Black")
+Identifier(u8"Arcadia_ARMS_TagFlags_Gray")
+Identifier(u8"Arcadia_ARMS_TagFlags_White")
+Identifier(u8"Arcadia_ARMS_Tag_isBlack")
+Identifier(u8"Arcadia_ARMS_Tag_isGray")
+Identifier(u8"Arcadia_ARMS_Tag_isWhite")
+Identifier(u8"Arcadia_ARMS_Tag_setBlack")
+Identifier(u8"Arcadia_ARMS_Tag_setGray")
+Identifier(u8"Arcadia_ARMS_Tag_setWhite")
+Identifier(u8"Arcadia_ARMS_TypeName")
+Identifier(u8"Arcadia_ARMS_TypeNameModule_shutdown")
+Identifier(u8"Arcadia_ARMS_TypeNameModule_startup")
+Identifier(u8"Arcadia_ARMS_TypeName_getData")
+Identifier(u8"Arcadia_ARMS_TypeName_getOrCreate")
+Identifier(u8"Arcadia_ARMS_TypeName_ref")
+Identifier(u8"Arcadia_ARMS_TypeName_unref")
+Identifier(u8"Arcadia_ARMS_TypeRemovedCallbackFunction")
+Identifier(u8"Arcadia_ARMS_VisitCallbackFunction")
+Identifier(u8"Arcadia_ARMS_addNotifyDestroy")
+Identifier(u8"Arcadia_ARMS_addType")
+Identifier(u8"Arcadia_ARMS_allocate")
+Identifier(u8"Arcadia_ARMS_backwardBarrier")
+Identifier(u8"Arcadia_ARMS_forwardBarrier")
+Identifier(u8"Arcadia_ARMS_getDefaultMemoryManager")
+Identifier(u8"Arcadia_ARMS_getSlabMemoryManager")
+Identifier(u8"Arcadia_ARMS_lock")
+Identifier(u8"Arcadia_ARMS_removeNotifyDestroy")
+Identifier(u8"Arcadia_ARMS_removeNotifyDestroyAll")
+Identifier(u8"Arcadia_ARMS_run")
+Identifier(u8"Arcadia_ARMS_shutdown")
+Identifier(u8"Arcadia_ARMS_startup")
+Identifier(u8"Arcadia_ARMS_unlock")
+Identifier(u8"Arcadia_ARMS_visit")
+Identifier(u8"Arcadia_ArgumentsValidation_getBooleanValue")
+Identifier(u8"Arcadia_ArgumentsValidation_getInteger32Value")
+Identifier(u8"Arcadia_ArgumentsValidation_getInteger64Value")
+Identifier(u8"Arcadia_ArgumentsValidation_getNatural16Value")
+Identifier(u8"Arcadia_ArgumentsValidation_getNatural32Value")
+Identifier(u8"Arcadia_ArgumentsValidation_getNatural64Value")
+Identifier(u8"Arcadia_ArgumentsValidation_getObjectReferenceValue")
+Identifier(u8"Arcadia_ArgumentsValidation_getObjectReferenceValueOrNull")
+Identifier(u8"Arcadia_ArgumentsValidation_getRuntimeUTF8StringValue")
+Identifier(u8"Arcadia_ArgumentsValidation_getRuntimeUTF8StringValueOrNull")
+Identifier(u8"Arcadia_ArrayDeque")
+Identifier(u8"Arcadia_ArrayDeque_create")
+Identifier(u8"Arcadia_ArrayList")
+Identifier(u8"Arcadia_ArrayListDispatch")
+Identifier(u8"Arcadia_ArrayList_create")
+Identifier(u8"Arcadia_ArrayStack")
+Identifier(u8"Arcadia_ArrayStackDispatch")
+Identifier(u8"Arcadia_ArrayStack_create")
+Identifier(u8"Arcadia_Arrays_ResizeStrategy")
+Identifier(u8"Arcadia_Arrays_ResizeStrategy_Type1")
+Identifier(u8"Arcadia_Arrays_ResizeStrategy_Type2")
+Identifier(u8"Arcadia_Arrays_ResizeStrategy_Type3")
+Identifier(u8"Arcadia_Arrays_ResizeStrategy_Type4")
+Identifier(u8"Arcadia_Arrays_resizeByAdditionalCapacity")
+Identifier(u8"Arcadia_Arrays_resizeByFreeCapacity")
+Identifier(u8"Arcadia_Atom")
+Identifier(u8"Arcadia_AtomValue")
+Identifier(u8"Arcadia_Atom_ensureGray")
+Identifier(u8"Arcadia_Atom_getBytes")
+Identifier(u8"Arcadia_Atom_getHash")
+Identifier(u8"Arcadia_Atom_getNumberOfBytes")
+Identifier(u8"Arcadia_Atom_isEqualTo")
+Identifier(u8"Arcadia_Atom_visit")
+Identifier(u8"Arcadia_Atoms")
+Identifier(u8"Arcadia_Atoms_getOrCreateAtom")
+Identifier(u8"Arcadia_BigInteger")
+Identifier(u8"Arcadia_BigIntegerValue")
+Identifier(u8"Arcadia_BigInteger_BitsPerLimp")
+Identifier(u8"Arcadia_BigInteger_BytesPerLimp")
+Identifier(u8"Arcadia_BigInteger_DoubleLimp")
+Identifier(u8"Arcadia_BigInteger_Limp")
+Identifier(u8"Arcadia_BigInteger_Limp_Literal")
+Identifier(u8"Arcadia_BigInteger_Limp_Maximum")
+Identifier(u8"Arcadia_BigInteger_Limp_Minimum")
+Identifier(u8"Arcadia_BigInteger_MaximumNumberOfLimps")
+Identifier(u8"Arcadia_BigInteger_add")
+Identifier(u8"Arcadia_BigInteger_add3")
+Identifier(u8"Arcadia_BigInteger_addInteger16")
+Identifier(u8"Arcadia_BigInteger_addInteger32")
+Identifier(u8"Arcadia_BigInteger_addInteger64")
+Identifier(u8"Arcadia_BigInteger_addInteger8")
+Identifier(u8"Arcadia_BigInteger_addNatural16")
+Identifier(u8"Arcadia_BigInteger_addNatural32")
+Identifier(u8"Arcadia_BigInteger_addNatural64")
+Identifier(u8"Arcadia_BigInteger_addNatural8")
+Identifier(u8"Arcadia_BigInteger_and")
+Identifier(u8"Arcadia_BigInteger_and3")
+Identifier(u8"Arcadia_BigInteger_compareByMagnitudeTo")
+Identifier(u8"Arcadia_BigInteger_compareTo")
+Identifier(u8"Arcadia_BigInteger_compareToInteger16")
+Identifier(u8"Arcadia_BigInteger_compareToInteger32")
+Identifier(u8"Arcadia_BigInteger_compareToInteger64")
+Identifier(u8"Arcadia_BigInteger_compareToInteger8")
+Identifier(u8"Arcadia_BigInteger_compareToNatural16")
+Identifier(u8"Arcadia_BigInteger_compareToNatural32")
+Identifier(u8"Arcadia_BigInteger_compareToNatural64")
+Identifier(u8"Arcadia_BigInteger_compareToNatural8")
+Identifier(u8"Arcadia_BigInteger_copy")
+Identifier(u8"Arcadia_BigInteger_countSignificandBits")
+Identifier(u8"Arcadia_BigInteger_create")
+Identifier(u8"Arcadia_BigInteger_divide")
+Identifier(u8"Arcadia_BigInteger_divide3")
+Identifier(u8"Arcadia_BigInteger_divideInteger16")
+Identifier(u8"Arcadia_BigInteger_divideInteger32")
+Identifier(u8"Arcadia_BigInteger_divideInteger64")
+Identifier(u8"Arcadia_BigInteger_divideInteger8")
+Identifier(u8"Arcadia_BigInteger_divideNatural16")
+Identifier(u8"Arcadia_BigInteger_divideNatural32")
+Identifier(u8"Arcadia_BigInteger_divideNatural64")
+Identifier(u8"Arcadia_BigInteger_divideNatural8")
+Identifier(u8"Arcadia_BigInteger_ensureGray")
+Identifier(u8"Arcadia_BigInteger_fromDecimalString")
+Identifier(u8"Arcadia_BigInteger_fromTwosComplement")
+Identifier(u8"Arcadia_BigInteger_getBitLength")
+Identifier(u8"Arcadia_BigInteger_getHigh64")
+Identifier(u8"Arcadia_BigInteger_isEqualTo")
+Identifier(u8"Arcadia_BigInteger_isEqualToInteger16")
+Identifier(u8"Arcadia_BigInteger_isEqualToInteger32")
+Identifier(u8"Arcadia_BigInteger_isEqualToInteger64")
+Identifier(u8"Arcadia_BigInteger_isEqualToInteger8")
+Identifier(u8"Arcadia_BigInteger_isEqualToNatural16")
+Identifier(u8"Arcadia_BigInteger_isEqualToNatural32")
+Identifier(u8"Arcadia_BigInteger_isEqualToNatural64")
+Identifier(u8"Arcadia_BigInteger_isEqualToNatural8")
+Identifier(u8"Arcadia_BigInteger_isGreaterThan")
+Identifier(u8"Arcadia_BigInteger_isGreaterThanInteger16")
+Identifier(u8"Arcadia_BigInteger_isGreaterThanInteger32")
+Identifier(u8"Arcadia_BigInteger_isGreaterThanInteger64")
+Identifier(u8"Arcadia_BigInteger_isGreaterThanInteger8")
+Identifier(u8"Arcadia_BigInteger_isGreaterThanNatural16")
+Identifier(u8"Arcadia_BigInteger_isGreaterThanNatural32")
+Identifier(u8"Arcadia_BigInteger_isGreaterThanNatural64")
+Identifier(u8"Arcadia_BigInteger_isGreaterThanNatural8")
+Identifier(u8"Arcadia_BigInteger_isGreaterThanOrEqualTo")
+Identifier(u8"Arcadia_BigInteger_isGreaterThanOrEqualToInteger16")
+Identifier(u8"Arcadia_BigInteger_isGreaterThanOrEqualToInteger32")
+Identifier(u8"Arcadia_BigInteger_isGreaterThanOrEqualToInteger64")
+Identifier(u8"Arcadia_BigInteger_isGreaterThanOrEqualToInteger8")
+Identifier(u8"Arcadia_BigInteger_isGreaterThanOrEqualToNatural16")
+Identifier(u8"Arcadia_BigInteger_isGreaterThanOrEqualToNatural32")
+Identifier(u8"Arcadia_BigInteger_isGreaterThanOrEqualToNatural64")
+Identifier(u8"Arcadia_BigInteger_isGreaterThanOrEqualToNatural8")
+Identifier(u8"Arcadia_BigInteger_isLowerThan")
+Identifier(u8"Arcadia_BigInteger_isLowerThanInteger16")
+Identifier(u8"Arcadia_BigInteger_isLowerThanInteger32")
+Identifier(u8"Arcadia_BigInteger_isLowerThanInteger64")
+Identifier(u8"Arcadia_BigInteger_isLowerThanInteger8")
+Identifier(u8"Arcadia_BigInteger_isLowerThanNatural16")
+Identifier(u8"Arcadia_BigInteger_isLowerThanNatural32")
+Identifier(u8"Arcadia_BigInteger_isLowerThanNatural64")
+Identifier(u8"Arcadia_BigInteger_isLowerThanNatural8")
+Identifier(u8"Arcadia_BigInteger_isLowerThanOrEqualTo")
+Identifier(u8"Arcadia_BigInteger_isLowerThanOrEqualToInteger16")
+Identifier(u8"Arcadia_BigInteger_isLowerThanOrEqualToInteger32")
+Identifier(u8"Arcadia_BigInteger_isLowerThanOrEqualToInteger64")
+Identifier(u8"Arcadia_BigInteger_isLowerThanOrEqualToOrEqualToInteger8")
+Identifier(u8"Arcadia_BigInteger_isLowerThanOrEqualToOrEqualToNatural16")
+Identifier(u8"Arcadia_BigInteger_isLowerThanOrEqualToOrEqualToNatural32")
+Identifier(u8"Arcadia_BigInteger_isLowerThanOrEqualToOrEqualToNatural64")
+Identifier(u8"Arcadia_BigInteger_isLowerThanOrEqualToOrEqualToNatural8")
+Identifier(u8"Arcadia_BigInteger_isNegative")
+Identifier(u8"Arcadia_BigInteger_isPositive")
+Identifier(u8"Arcadia_BigInteger_isZero")
+Identifier(u8"Arcadia_BigInteger_multiply")
+Identifier(u8"Arcadia_BigInteger_multiply3")
+Identifier(u8"Arcadia_BigInteger_multiplyInteger16")
+Identifier(u8"Arcadia_BigInteger_multiplyInteger32")
+Identifier(u8"Arcadia_BigInteger_multiplyInteger64")
+Identifier(u8"Arcadia_BigInteger_multiplyInteger8")
+Identifier(u8"Arcadia_BigInteger_multiplyNatural16")
+Identifier(u8"Arcadia_BigInteger_multiplyNatural32")
+Identifier(u8"Arcadia_BigInteger_multiplyNatural64")
+Identifier(u8"Arcadia_BigInteger_multiplyNatural8")
+Identifier(u8"Arcadia_BigInteger_notEqualTo")
+Identifier(u8"Arcadia_BigInteger_notEqualToInteger16")
+Identifier(u8"Arcadia_BigInteger_notEqualToInteger32")
+Identifier(u8"Arcadia_BigInteger_notEqualToInteger64")
+Identifier(u8"Arcadia_BigInteger_notEqualToInteger8")
+Identifier(u8"Arcadia_BigInteger_notEqualToNatural16")
+Identifier(u8"Arcadia_BigInteger_notEqualToNatural32")
+Identifier(u8"Arcadia_BigInteger_notEqualToNatural64")
+Identifier(u8"Arcadia_BigInteger_notEqualToNatural8")
+Identifier(u8"Arcadia_BigInteger_or")
+Identifier(u8"Arcadia_BigInteger_or3")
+Identifier(u8"Arcadia_BigInteger_setInteger16")
+Identifier(u8"Arcadia_BigInteger_setInteger32")
+Identifier(u8"Arcadia_BigInteger_setInteger64")
+Identifier(u8"Arcadia_BigInteger_setInteger8")
+Identifier(u8"Arcadia_BigInteger_setNatural16")
+Identifier(u8"Arcadia_BigInteger_setNatural32")
+Identifier(u8"Arcadia_BigInteger_setNatural64")
+Identifier(u8"Arcadia_BigInteger_setNatural8")
+Identifier(u8"Arcadia_BigInteger_setPowerOfFiveNatural16")
+Identifier(u8"Arcadia_BigInteger_setPowerOfFiveNatural32")
+Identifier(u8"Arcadia_BigInteger_setPowerOfFiveNatural64")
+Identifier(u8"Arcadia_BigInteger_setPowerOfFiveNatural8")
+Identifier(u8"Arcadia_BigInteger_setPowerOfTenNatural16")
+Identifier(u8"Arcadia_BigInteger_setPowerOfTenNatural32")
+Identifier(u8"Arcadia_BigInteger_setPowerOfTenNatural64")
+Identifier(u8"Arcadia_BigInteger_setPowerOfTenNatural8")
+Identifier(u8"Arcadia_BigInteger_setPowerOfTwoNatural16")
+Identifier(u8"Arcadia_BigInteger_setPowerOfTwoNatural32")
+Identifier(u8"Arcadia_BigInteger_setPowerOfTwoNatural64")
+Identifier(u8"Arcadia_BigInteger_setPowerOfTwoNatural8")
+Identifier(u8"Arcadia_BigInteger_setZero")
+Identifier(u8"Arcadia_BigInteger_shiftLeftInteger16")
+Identifier(u8"Arcadia_BigInteger_shiftLeftInteger32")
+Identifier(u8"Arcadia_BigInteger_shiftLeftInteger64")
+Identifier(u8"Arcadia_BigInteger_shiftLeftInteger8")
+Identifier(u8"Arcadia_BigInteger_shiftLeftNatural16")
+Identifier(u8"Arcadia_BigInteger_shiftLeftNatural32")
+Identifier(u8"Arcadia_BigInteger_shiftLeftNatural64")
+Identifier(u8"Arcadia_BigInteger_shiftLeftNatural8")
+Identifier(u8"Arcadia_BigInteger_shiftRightInteger16")
+Identifier(u8"Arcadia_BigInteger_shiftRightInteger32")
+Identifier(u8"Arcadia_BigInteger_shiftRightInteger64")
+Identifier(u8"Arcadia_BigInteger_shiftRightInteger8")
+Identifier(u8"Arcadia_BigInteger_shiftRightNatural16")
+Identifier(u8"Arcadia_BigInteger_shiftRightNatural32")
+Identifier(u8"Arcadia_BigInteger_shiftRightNatural64")
+Identifier(u8"Arcadia_BigInteger_shiftRightNatural8")
+Identifier(u8"Arcadia_BigInteger_subtract")
+Identifier(u8"Arcadia_BigInteger_subtract3")
+Identifier(u8"Arcadia_BigInteger_subtractInteger16")
+Identifier(u8"Arcadia_BigInteger_subtractInteger32")
+Identifier(u8"Arcadia_BigInteger_subtractInteger64")
+Identifier(u8"Arcadia_BigInteger_subtractInteger8")
+Identifier(u8"Arcadia_BigInteger_subtractNatural16")
+Identifier(u8"Arcadia_BigInteger_subtractNatural32")
+Identifier(u8"Arcadia_BigInteger_subtractNatural64")
+Identifier(u8"Arcadia_BigInteger_subtractNatural8")
+Identifier(u8"Arcadia_BigInteger_swap")
+Identifier(u8"Arcadia_BigInteger_toDecimalString")
+Identifier(u8"Arcadia_BigInteger_toInteger16")
+Identifier(u8"Arcadia_BigInteger_toInteger32")
+Identifier(u8"Arcadia_BigInteger_toInteger64")
+Identifier(u8"Arcadia_BigInteger_toInteger8")
+Identifier(u8"Arcadia_BigInteger_toNatural16")
+Identifier(u8"Arcadia_BigInteger_toNatural32")
+Identifier(u8"Arcadia_BigInteger_toNatural64")
+Identifier(u8"Arcadia_BigInteger_toNatural64WithTruncation")
+Identifier(u8"Arcadia_BigInteger_toNatural8")
+Identifier(u8"Arcadia_BigInteger_toStdoutDebug")
+Identifier(u8"Arcadia_BigInteger_toTwosComplement")
+Identifier(u8"Arcadia_BigInteger_visit")
+Identifier(u8"Arcadia_Boolean")
+Identifier(u8"Arcadia_BooleanValue")
+Identifier(u8"Arcadia_BooleanValue_False")
+Identifier(u8"Arcadia_BooleanValue_True")
+Identifier(u8"Arcadia_BooleanValue_toUTF8String")
+Identifier(u8"Arcadia_ByteArray")
+Identifier(u8"Arcadia_ByteArrayBuilder")
+Identifier(u8"Arcadia_ByteArrayBuilderDispatch")
+Identifier(u8"Arcadia_ByteArrayBuilder_ByteReader")
+Identifier(u8"Arcadia_ByteArrayBuilder_ByteReaderDispatch")
+Identifier(u8"Arcadia_ByteArrayBuilder_ByteReader_create")
+Identifier(u8"Arcadia_ByteArrayBuilder_clear")
+Identifier(u8"Arcadia_ByteArrayBuilder_create")
+Identifier(u8"Arcadia_ByteArrayBuilder_endsWith_pn")
+Identifier(u8"Arcadia_ByteArrayBuilder_getAt")
+Identifier(u8"Arcadia_ByteArrayBuilder_getBytes")
+Identifier(u8"Arcadia_ByteArrayBuilder_getNumberOfBytes")
+Identifier(u8"Arcadia_ByteArrayBuilder_getSize")
+Identifier(u8"Arcadia_ByteArrayBuilder_insertBackBytes")
+Identifier(u8"Arcadia_ByteArrayBuilder_insertBytes")
+Identifier(u8"Arcadia_ByteArrayBuilder_insertFrontBytes")
+Identifier(u8"Arcadia_ByteArrayBuilder_isEqualTo")
+Identifier(u8"Arcadia_ByteArrayBuilder_isEqualTo_pn")
+Identifier(u8"Arcadia_ByteArrayBuilder_startsWith_pn")
+Identifier(u8"Arcadia_ByteArrayBuilder_swap")
+Identifier(u8"Arcadia_ByteArrayBuilder_toByteArray")
+Identifier(u8"Arcadia_ByteArrayDefaultImpl")
+Identifier(u8"Arcadia_ByteArrayDefaultImplDispatch")
+Identifier(u8"Arcadia_ByteArrayDefaultImpl_create")
+Identifier(u8"Arcadia_ByteArrayDispatch")
+Identifier(u8"Arcadia_ByteArraySliceImpl")
+Identifier(u8"Arcadia_ByteArraySliceImplDispatch")
+Identifier(u8"Arcadia_ByteArraySliceImpl_create")
+Identifier(u8"Arcadia_ByteArray_ByteReader")
+Identifier(u8"Arcadia_ByteArray_ByteReaderDispatch")
+Identifier(u8"Arcadia_ByteArray_ByteReader_create")
+Identifier(u8"Arcadia_ByteArray_createByteArray")
+Identifier(u8"Arcadia_ByteArray_getAt")
+Identifier(u8"Arcadia_ByteArray_getBytes")
+Identifier(u8"Arcadia_ByteArray_getNumberOfBytes")
+Identifier(u8"Arcadia_ByteArray_getSize")
+Identifier(u8"Arcadia_ByteArray_isEmpty")
+Identifier(u8"Arcadia_ByteArray_slice")
+Identifier(u8"Arcadia_ByteReader")
+Identifier(u8"Arcadia_ByteReaderDispatch")
+Identifier(u8"Arcadia_ByteReader_UnicodeCodePointReader")
+Identifier(u8"Arcadia_ByteReader_UnicodeCodePointReaderDispatch")
+Identifier(u8"Arcadia_ByteReader_UnicodeCodePointReader_create")
+Identifier(u8"Arcadia_ByteReader_getValue")
+Identifier(u8"Arcadia_ByteReader_hasError")
+Identifier(u8"Arcadia_ByteReader_hasValue")
+Identifier(u8"Arcadia_ByteReader_nextValue")
+Identifier(u8"Arcadia_Collection")
+Identifier(u8"Arcadia_CollectionDispatch")
+Identifier(u8"Arcadia_Collection_clear")
+Identifier(u8"Arcadia_Collection_getSize")
+Identifier(u8"Arcadia_Collection_isEmpty")
+Identifier(u8"Arcadia_Collection_isImmutable")
+Identifier(u8"Arcadia_Collections_Tests_ListTests_removeAt")
+Identifier(u8"Arcadia_CommandLineArgument")
+Identifier(u8"Arcadia_CommandLineArgumentDispatch")
+Identifier(u8"Arcadia_CommandLineArgumentError_InvalidName")
+Identifier(u8"Arcadia_CommandLineArgumentError_InvalidValue")
+Identifier(u8"Arcadia_CommandLineArgumentError_MissingDoubleDash")
+Identifier(u8"Arcadia_CommandLineArgument_create")
+Identifier(u8"Arcadia_CommandLine_invalidCommandLineArgumentError")
+Identifier(u8"Arcadia_CommandLine_parseArgument")
+Identifier(u8"Arcadia_CommandLine_raiseAlreadySpecifiedError")
+Identifier(u8"Arcadia_CommandLine_raiseNoValueError")
+Identifier(u8"Arcadia_CommandLine_raiseRequiredArgumentMissingError")
+Identifier(u8"Arcadia_CommandLine_raiseUnknownArgumentError")
+Identifier(u8"Arcadia_CommandLine_raiseValueInvalidError")
+Identifier(u8"Arcadia_Concurrency_Condition")
+Identifier(u8"Arcadia_Concurrency_Condition_Result")
+Identifier(u8"Arcadia_Concurrency_Condition_Result_AllocationFailed")
+Identifier(u8"Arcadia_Concurrency_Condition_Result_ArgumentInvalid")
+Identifier(u8"Arcadia_Concurrency_Condition_Result_EnvironmentFailed")
+Identifier(u8"Arcadia_Concurrency_Condition_Result_Initialized")
+Identifier(u8"Arcadia_Concurrency_Condition_Result_Success")
+Identifier(u8"Arcadia_Concurrency_Condition_initialize")
+Identifier(u8"Arcadia_Concurrency_Condition_signalAll")
+Identifier(u8"Arcadia_Concurrency_Condition_signalOne")
+Identifier(u8"Arcadia_Concurrency_Condition_uninitialize")
+Identifier(u8"Arcadia_Concurrency_Condition_wait")
+Identifier(u8"Arcadia_Concurrency_Mutex")
+Identifier(u8"Arcadia_Concurrency_Mutex_Result")
+Identifier(u8"Arcadia_Concurrency_Mutex_Result_AllocationFailed")
+Identifier(u8"Arcadia_Concurrency_Mutex_Result_ArgumentInvalid")
+Identifier(u8"Arcadia_Concurrency_Mutex_Result_EnvironmentFailed")
+Identifier(u8"Arcadia_Concurrency_Mutex_Result_Initialized")
+Identifier(u8"Arcadia_Concurrency_Mutex_Result_Success")
+Identifier(u8"Arcadia_Concurrency_Mutex_initialize")
+Identifier(u8"Arcadia_Concurrency_Mutex_lock")
+Identifier(u8"Arcadia_Concurrency_Mutex_uninitialize")
+Identifier(u8"Arcadia_Concurrency_Mutex_unlock")
+Identifier(u8"Arcadia_Configuragion_BigInteger_LimpSize")
+Identifier(u8"Arcadia_Configuration_BigInteger_LimpOrder")
+Identifier(u8"Arcadia_Configuration_BigInteger_LimpOrder_BigEndian")
+Identifier(u8"Arcadia_Configuration_BigInteger_LimpOrder_LittleEndian")
+Identifier(u8"Arcadia_Configuration_BigInteger_LimpSize")
+Identifier(u8"Arcadia_Configuration_CompilerC")
+Identifier(u8"Arcadia_Configuration_CompilerC_Clang")
+Identifier(u8"Arcadia_Configuration_CompilerC_Gcc")
+Identifier(u8"Arcadia_Configuration_CompilerC_Msvc")
+Identifier(u8"Arcadia_Configuration_InstructionSetArchitecture")
+Identifier(u8"Arcadia_Configuration_InstructionSetArchitecture_X64")
+Identifier(u8"Arcadia_Configuration_InstructionSetArchitecture_X86")
+Identifier(u8"Arcadia_Configuration_OperatingSystem")
+Identifier(u8"Arcadia_Configuration_OperatingSystem_Cygwin")
+Identifier(u8"Arcadia_Configuration_OperatingSystem_Linux")
+Identifier(u8"Arcadia_Configuration_OperatingSystem_Macos")
+Identifier(u8"Arcadia_Configuration_OperatingSystem_Windows")
+Identifier(u8"Arcadia_Configuration_Unicode_UTF8_ClassifyFirstByteOptimization")
+Identifier(u8"Arcadia_Configuration_withBarriers")
+Identifier(u8"Arcadia_ConsoleLog")
+Identifier(u8"Arcadia_ConsoleLogDispatch")
+Identifier(u8"Arcadia_ConsoleLog_create")
+Identifier(u8"Arcadia_ConsoleLog_getColorEnabled")
+Identifier(u8"Arcadia_ConsoleLog_setColorEnabled")
+Identifier(u8"Arcadia_DDL_Node")
+Identifier(u8"Arcadia_DeclareModule")
+Identifier(u8"Arcadia_DefaultFileHandle")
+Identifier(u8"Arcadia_DefaultFileHandleDispatch")
+Identifier(u8"Arcadia_DefaultFileHandle_create")
+Identifier(u8"Arcadia_DefaultFileSystem")
+Identifier(u8"Arcadia_DefaultFileSystemDispatch")
+Identifier(u8"Arcadia_DefaultFileSystem_deleteDirectoryFileHelper")
+Identifier(u8"Arcadia_DefaultFileSystem_deleteRegularFileHelper")
+Identifier(u8"Arcadia_DefaultFileSystem_getFileTypeHelper")
+Identifier(u8"Arcadia_DefaultFileSystem_getHomeFolderHelper")
+Identifier(u8"Arcadia_DefaultFileSystem_getLocalFolderHelper")
+Identifier(u8"Arcadia_DefaultFileSystem_getOrCreate")
+Identifier(u8"Arcadia_DefaultFileSystem_getRoamingFolderHelper")
+Identifier(u8"Arcadia_DefineModule")
+Identifier(u8"Arcadia_Deque")
+Identifier(u8"Arcadia_DequeDispatch")
+Identifier(u8"Arcadia_Deque_get")
+Identifier(u8"Arcadia_Deque_getAt")
+Identifier(u8"Arcadia_Deque_getBack")
+Identifier(u8"Arcadia_Deque_getFront")
+Identifier(u8"Arcadia_Deque_insert")
+Identifier(u8"Arcadia_Deque_insertAt")
+Identifier(u8"Arcadia_Deque_insertBack")
+Identifier(u8"Arcadia_Deque_insertFront")
+Identifier(u8"Arcadia_Deque_is")
+Identifier(u8"Arcadia_Deque_removeAt")
+Identifier(u8"Arcadia_Deque_removeBack")
+Identifier(u8"Arcadia_Deque_removeFront")
+Identifier(u8"Arcadia_Diagnostics_logObjectType")
+Identifier(u8"Arcadia_Diagnostics_logValue")
+Identifier(u8"Arcadia_Diagnostics_logValueStack")
+Identifier(u8"Arcadia_Diagnostics_logValueStackElement")
+Identifier(u8"Arcadia_DirectoryIterator")
+Identifier(u8"Arcadia_DirectoryIteratorDispatch")
+Identifier(u8"Arcadia_DirectoryIteratorLinux")
+Identifier(u8"Arcadia_DirectoryIteratorLinuxDispatch")
+Identifier(u8"Arcadia_DirectoryIteratorLinux_create")
+Identifier(u8"Arcadia_DirectoryIteratorWindows")
+Identifier(u8"Arcadia_DirectoryIteratorWindowsDispatch")
+Identifier(u8"Arcadia_DirectoryIteratorWindows_create")
+Identifier(u8"Arcadia_DirectoryIterator_getValue")
+Identifier(u8"Arcadia_DirectoryIterator_hasValue")
+Identifier(u8"Arcadia_DirectoryIterator_nextValue")
+Identifier(u8"Arcadia_Engine")
+Identifier(u8"Arcadia_EngineDispatch")
+Identifier(u8"Arcadia_Engine_Application")
+Identifier(u8"Arcadia_Engine_ApplicationDispatch")
+Identifier(u8"Arcadia_Engine_Application_getQuitRequested")
+Identifier(u8"Arcadia_Engine_Application_setQuitRequested")
+Identifier(u8"Arcadia_Engine_Application_shutdown")
+Identifier(u8"Arcadia_Engine_Application_startup")
+Identifier(u8"Arcadia_Engine_Audials_Backend")
+Identifier(u8"Arcadia_Engine_Audials_BackendContext")
+Identifier(u8"Arcadia_Engine_Audials_BackendContextDispatch")
+Identifier(u8"Arcadia_Engine_Audials_BackendContext_createSoundSourceResource")
+Identifier(u8"Arcadia_Engine_Audials_BackendContext_createStreamingSoundSourceResource")
+Identifier(u8"Arcadia_Engine_Audials_BackendDispatch")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_BackendContext")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_Configuration_OpenAL_Backend_Enabled")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_OpenAL_Backend")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_OpenAL_BackendContextDispatch")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext_create")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_OpenAL_BackendContext_getOrCreate")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_OpenAL_BackendDispatch")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_OpenAL_Backend_create")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_OpenAL_SoundSourceResource")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_OpenAL_SoundSourceResourceDispatch")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_OpenAL_SoundSourceResource_create")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResourceDispatch")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_BufferSize")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_NumberOfBuffers")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_OpenAL_StreamingSoundSourceResource_create")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_Resource")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_ResourceDispatch")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_Resource_load")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_Resource_ref")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_Resource_render")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_Resource_unlink")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_Resource_unload")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_Resource_unref")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_SoundSourceResource")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_SoundSourceResourceDispatch")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_SoundSourceResource_getIsLooping")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_SoundSourceResource_getNumberOfUnderruns")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_SoundSourceResource_getVolume")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_SoundSourceResource_isPlaying")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_SoundSourceResource_pause")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_SoundSourceResource_play")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_SoundSourceResource_setIsLooping")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_SoundSourceResource_setVolume")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_SoundSourceResource_stop")
+Identifier(u8"Arcadia_Engine_Audials_Implementation_registerBackends")
+Identifier(u8"Arcadia_Engine_Audials_Node")
+Identifier(u8"Arcadia_Engine_Audials_NodeDispatch")
+Identifier(u8"Arcadia_Engine_Audials_NodeFactory")
+Identifier(u8"Arcadia_Engine_Audials_NodeFactoryDispatch")
+Identifier(u8"Arcadia_Engine_Audials_NodeFactory_create")
+Identifier(u8"Arcadia_Engine_Audials_NodeFactory_createSoundSourceNode")
+Identifier(u8"Arcadia_Engine_Audials_Node_render")
+Identifier(u8"Arcadia_Engine_Audials_SoundSourceNode")
+Identifier(u8"Arcadia_Engine_Audials_SoundSourceNodeDispatch")
+Identifier(u8"Arcadia_Engine_Audials_SoundSourceNode_create")
+Identifier(u8"Arcadia_Engine_Audials_SoundSourceNode_getIsLooping")
+Identifier(u8"Arcadia_Engine_Audials_SoundSourceNode_getVolume")
+Identifier(u8"Arcadia_Engine_Audials_SoundSourceNode_isPlaying")
+Identifier(u8"Arcadia_Engine_Audials_SoundSourceNode_pause")
+Identifier(u8"Arcadia_Engine_Audials_SoundSourceNode_play")
+Identifier(u8"Arcadia_Engine_Audials_SoundSourceNode_setIsLooping")
+Identifier(u8"Arcadia_Engine_Audials_SoundSourceNode_setVolume")
+Identifier(u8"Arcadia_Engine_Audials_SoundSourceNode_stop")
+Identifier(u8"Arcadia_Engine_Audials_registerNodeFactories")
+Identifier(u8"Arcadia_Engine_Backend")
+Identifier(u8"Arcadia_Engine_BackendContext")
+Identifier(u8"Arcadia_Engine_BackendContextDispatch")
+Identifier(u8"Arcadia_Engine_BackendContext_update")
+Identifier(u8"Arcadia_Engine_BackendDispatch")
+Identifier(u8"Arcadia_Engine_Backend_createBackendContext")
+Identifier(u8"Arcadia_Engine_Backend_getName")
+Identifier(u8"Arcadia_Engine_Event")
+Identifier(u8"Arcadia_Engine_EventDispatch")
+Identifier(u8"Arcadia_Engine_Node")
+Identifier(u8"Arcadia_Engine_NodeDispatch")
+Identifier(u8"Arcadia_Engine_NodeFactory")
+Identifier(u8"Arcadia_Engine_NodeFactoryDispatch")
+Identifier(u8"Arcadia_Engine_Node_setAudialsBackendContext")
+Identifier(u8"Arcadia_Engine_Node_setVisualsBackendContext")
+Identifier(u8"Arcadia_Engine_Visuals_Backend")
+Identifier(u8"Arcadia_Engine_Visuals_BackendContext")
+Identifier(u8"Arcadia_Engine_Visuals_BackendContextDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_BackendContext_createConstantBufferResource")
+Identifier(u8"Arcadia_Engine_Visuals_BackendContext_createEnterPassResource")
+Identifier(u8"Arcadia_Engine_Visuals_BackendContext_createFrameBufferResource")
+Identifier(u8"Arcadia_Engine_Visuals_BackendContext_createIcon")
+Identifier(u8"Arcadia_Engine_Visuals_BackendContext_createMaterialResource")
+Identifier(u8"Arcadia_Engine_Visuals_BackendContext_createModelResource")
+Identifier(u8"Arcadia_Engine_Visuals_BackendContext_createProgramResource")
+Identifier(u8"Arcadia_Engine_Visuals_BackendContext_createTextureResource")
+Identifier(u8"Arcadia_Engine_Visuals_BackendContext_createVertexBufferResource")
+Identifier(u8"Arcadia_Engine_Visuals_BackendContext_createWindow")
+Identifier(u8"Arcadia_Engine_Visuals_BackendContext_getDisplayDevices")
+Identifier(u8"Arcadia_Engine_Visuals_BackendDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_CameraNode")
+Identifier(u8"Arcadia_Engine_Visuals_CameraNodeDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_CameraNode_create")
+Identifier(u8"Arcadia_Engine_Visuals_CameraNode_getViewToProjectionMatrix")
+Identifier(u8"Arcadia_Engine_Visuals_CameraNode_getWorldToViewMatrix")
+Identifier(u8"Arcadia_Engine_Visuals_CameraNode_setViewToProjectionMatrix")
+Identifier(u8"Arcadia_Engine_Visuals_CameraNode_setWorldToViewMatrix")
+Identifier(u8"Arcadia_Engine_Visuals_CullMode")
+Identifier(u8"Arcadia_Engine_Visuals_CullMode_Back")
+Identifier(u8"Arcadia_Engine_Visuals_CullMode_BackAndFront")
+Identifier(u8"Arcadia_Engine_Visuals_CullMode_Front")
+Identifier(u8"Arcadia_Engine_Visuals_CullMode_FrontAndBack")
+Identifier(u8"Arcadia_Engine_Visuals_CullMode_None")
+Identifier(u8"Arcadia_Engine_Visuals_DepthCompareFunction")
+Identifier(u8"Arcadia_Engine_Visuals_DepthCompareFunction_Always")
+Identifier(u8"Arcadia_Engine_Visuals_DepthCompareFunction_Equal")
+Identifier(u8"Arcadia_Engine_Visuals_DepthCompareFunction_GreaterThan")
+Identifier(u8"Arcadia_Engine_Visuals_DepthCompareFunction_GreaterThanOrEqualTo")
+Identifier(u8"Arcadia_Engine_Visuals_DepthCompareFunction_LessThan")
+Identifier(u8"Arcadia_Engine_Visuals_DepthCompareFunction_LessThanOrEqualTo")
+Identifier(u8"Arcadia_Engine_Visuals_DepthCompareFunction_Never")
+Identifier(u8"Arcadia_Engine_Visuals_DepthCompareFunction_NotEqual")
+Identifier(u8"Arcadia_Engine_Visuals_DisplayDevice")
+Identifier(u8"Arcadia_Engine_Visuals_DisplayDeviceDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_DisplayDevice_getAvailableDisplayModes")
+Identifier(u8"Arcadia_Engine_Visuals_DisplayDevice_getBounds")
+Identifier(u8"Arcadia_Engine_Visuals_DisplayDevice_getCurrentDisplayMode")
+Identifier(u8"Arcadia_Engine_Visuals_DisplayDevice_getId")
+Identifier(u8"Arcadia_Engine_Visuals_DisplayDevice_getName")
+Identifier(u8"Arcadia_Engine_Visuals_DisplayMode")
+Identifier(u8"Arcadia_Engine_Visuals_DisplayModeDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_DisplayMode_apply")
+Identifier(u8"Arcadia_Engine_Visuals_DisplayMode_getColorDepth")
+Identifier(u8"Arcadia_Engine_Visuals_DisplayMode_getFrequency")
+Identifier(u8"Arcadia_Engine_Visuals_DisplayMode_getHorizontalResolution")
+Identifier(u8"Arcadia_Engine_Visuals_DisplayMode_getVerticalResolution")
+Identifier(u8"Arcadia_Engine_Visuals_EnterPassNode")
+Identifier(u8"Arcadia_Engine_Visuals_EnterPassNodeDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_EnterPassNode_create")
+Identifier(u8"Arcadia_Engine_Visuals_EnterPassNode_getCameraNode")
+Identifier(u8"Arcadia_Engine_Visuals_EnterPassNode_getFrameBufferNode")
+Identifier(u8"Arcadia_Engine_Visuals_EnterPassNode_getViewportNode")
+Identifier(u8"Arcadia_Engine_Visuals_EnterPassNode_setCameraNode")
+Identifier(u8"Arcadia_Engine_Visuals_EnterPassNode_setFrameBufferNode")
+Identifier(u8"Arcadia_Engine_Visuals_EnterPassNode_setViewToProjectionMatrix")
+Identifier(u8"Arcadia_Engine_Visuals_EnterPassNode_setViewportNode")
+Identifier(u8"Arcadia_Engine_Visuals_EnterPassNode_setWorldToViewMatrix")
+Identifier(u8"Arcadia_Engine_Visuals_FillMode")
+Identifier(u8"Arcadia_Engine_Visuals_FillMode_Line")
+Identifier(u8"Arcadia_Engine_Visuals_FillMode_Point")
+Identifier(u8"Arcadia_Engine_Visuals_FillMode_Solid")
+Identifier(u8"Arcadia_Engine_Visuals_FrameBufferNode")
+Identifier(u8"Arcadia_Engine_Visuals_FrameBufferNodeDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_FrameBufferNode_create")
+Identifier(u8"Arcadia_Engine_Visuals_FrameBufferNode_getSize")
+Identifier(u8"Arcadia_Engine_Visuals_FrameBufferNode_setSize")
+Identifier(u8"Arcadia_Engine_Visuals_Icon")
+Identifier(u8"Arcadia_Engine_Visuals_IconDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_BackendContext")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_ConstantBufferResource")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_ConstantBufferResourceDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_ConstantBufferResource_clear")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_ConstantBufferResource_setData")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_ConstantBufferResource_writeColor4Real32")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_ConstantBufferResource_writeMatrix4x4Real32")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_EnterPassResource")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_EnterPassResourceDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_EnterPassResource_AllDirty")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_EnterPassResource_CanvasSizeDirty")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_EnterPassResource_ClearColorDirty")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_EnterPassResource_ClearDepthDirty")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_EnterPassResource_RelativeViewportRectangleDirty")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_EnterPassResource_ViewToProjectionMatrixDirty")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_EnterPassResource_WorldToViewMatrixDirty")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_EnterPassResource_setCanvasSize")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_EnterPassResource_setClearColor")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_EnterPassResource_setClearColorBuffer")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_EnterPassResource_setClearDepth")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_EnterPassResource_setClearDepthBuffer")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_EnterPassResource_setRelativeViewportRectangle")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_EnterPassResource_setTargetFrameBuffer")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_EnterPassResource_setViewToProjectionMatrix")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_EnterPassResource_setWorldToViewMatrix")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_FragmentProgramResource")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_FrameBufferResource")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_FrameBufferResourceDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_FrameBufferResource_activate")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_FrameBufferResource_deactivate")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_FrameBufferResource_getSize")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_FrameBufferResource_setSize")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_MaterialResource")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_MaterialResourceDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_MaterialResource_AmbientColorSource")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_MaterialResource_AmbientColorSource_Mesh")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_MaterialResource_AmbientColorSource_Texture")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_MaterialResource_AmbientColorSource_Vertex")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_ModelResource")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_ModelResourceDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_ModelResource_LocalToWorldMatrixDirty")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_ModelResource_setLocalToWorldMatrix")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_ProgramResource")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_ProgramResourceDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_Resource")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_ResourceDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_Resource_load")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_Resource_ref")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_Resource_render")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_Resource_unlink")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_Resource_unload")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_Resource_unref")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_TextureResource")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_TextureResourceDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_TextureResource_getAddressModeU")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_TextureResource_getAddressModeV")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_TextureResource_getHeight")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_TextureResource_getMagnificationFilter")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_TextureResource_getMinificationFilter")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_TextureResource_getWidth")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_TextureResource_setAddressModeU")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_TextureResource_setAddressModeV")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_TextureResource_setHeight")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_TextureResource_setMagnificationFilter")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_TextureResource_setMinificationFilter")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_TextureResource_setPixelBuffer")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_TextureResource_setWidth")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_VertexBufferResource")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_VertexBufferResourceDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_VertexBufferResource_VertexDataDirty")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_VertexBufferResource_VertexDescriptorDirty")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_VertexBufferResource_getNumberOfVertices")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_VertexBufferResource_setData")
+Identifier(u8"Arcadia_Engine_Visuals_Implementation_VertexProgramResource")
+Identifier(u8"Arcadia_Engine_Visuals_MaterialNode")
+Identifier(u8"Arcadia_Engine_Visuals_MaterialNodeDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_MaterialNode_create")
+Identifier(u8"Arcadia_Engine_Visuals_MeshNode")
+Identifier(u8"Arcadia_Engine_Visuals_MeshNodeDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_MeshNode_create")
+Identifier(u8"Arcadia_Engine_Visuals_MeshNode_getAmbientColor")
+Identifier(u8"Arcadia_Engine_Visuals_MeshNode_getNumberOfVertices")
+Identifier(u8"Arcadia_Engine_Visuals_MeshNode_setAmbientColor")
+Identifier(u8"Arcadia_Engine_Visuals_ModelNode")
+Identifier(u8"Arcadia_Engine_Visuals_ModelNodeDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_ModelNode_create")
+Identifier(u8"Arcadia_Engine_Visuals_Node")
+Identifier(u8"Arcadia_Engine_Visuals_NodeDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_NodeFactory")
+Identifier(u8"Arcadia_Engine_Visuals_NodeFactoryDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_NodeFactory_create")
+Identifier(u8"Arcadia_Engine_Visuals_NodeFactory_createCameraNode")
+Identifier(u8"Arcadia_Engine_Visuals_NodeFactory_createEnterPassNode")
+Identifier(u8"Arcadia_Engine_Visuals_NodeFactory_createFrameBufferNode")
+Identifier(u8"Arcadia_Engine_Visuals_NodeFactory_createMaterialNode")
+Identifier(u8"Arcadia_Engine_Visuals_NodeFactory_createMeshNode")
+Identifier(u8"Arcadia_Engine_Visuals_NodeFactory_createModelNode")
+Identifier(u8"Arcadia_Engine_Visuals_NodeFactory_createPixelBufferNode")
+Identifier(u8"Arcadia_Engine_Visuals_NodeFactory_createTextureNode")
+Identifier(u8"Arcadia_Engine_Visuals_NodeFactory_createViewportNode")
+Identifier(u8"Arcadia_Engine_Visuals_Node_render")
+Identifier(u8"Arcadia_Engine_Visuals_PixelBufferNode")
+Identifier(u8"Arcadia_Engine_Visuals_PixelBufferNodeDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_PixelBufferNode_create")
+Identifier(u8"Arcadia_Engine_Visuals_TextureAddressMode")
+Identifier(u8"Arcadia_Engine_Visuals_TextureAddressMode_ClampToBorder")
+Identifier(u8"Arcadia_Engine_Visuals_TextureAddressMode_ClampToEdge")
+Identifier(u8"Arcadia_Engine_Visuals_TextureAddressMode_MirroredRepeat")
+Identifier(u8"Arcadia_Engine_Visuals_TextureAddressMode_Repeat")
+Identifier(u8"Arcadia_Engine_Visuals_TextureFilter")
+Identifier(u8"Arcadia_Engine_Visuals_TextureFilter_Linear")
+Identifier(u8"Arcadia_Engine_Visuals_TextureFilter_Nearest")
+Identifier(u8"Arcadia_Engine_Visuals_TextureNode")
+Identifier(u8"Arcadia_Engine_Visuals_TextureNodeDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_TextureNode_create")
+Identifier(u8"Arcadia_Engine_Visuals_TextureNode_getAddressModeU")
+Identifier(u8"Arcadia_Engine_Visuals_TextureNode_getAddressModeV")
+Identifier(u8"Arcadia_Engine_Visuals_TextureNode_getHeight")
+Identifier(u8"Arcadia_Engine_Visuals_TextureNode_getMagnificationFilter")
+Identifier(u8"Arcadia_Engine_Visuals_TextureNode_getMinificationFilter")
+Identifier(u8"Arcadia_Engine_Visuals_TextureNode_getWidth")
+Identifier(u8"Arcadia_Engine_Visuals_ViewportNode")
+Identifier(u8"Arcadia_Engine_Visuals_ViewportNodeDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_ViewportNode_create")
+Identifier(u8"Arcadia_Engine_Visuals_ViewportNode_getCanvasSize")
+Identifier(u8"Arcadia_Engine_Visuals_ViewportNode_getClearColor")
+Identifier(u8"Arcadia_Engine_Visuals_ViewportNode_getClearColorBuffer")
+Identifier(u8"Arcadia_Engine_Visuals_ViewportNode_getClearDepth")
+Identifier(u8"Arcadia_Engine_Visuals_ViewportNode_getClearDepthBuffer")
+Identifier(u8"Arcadia_Engine_Visuals_ViewportNode_getRelativeViewportRectangle")
+Identifier(u8"Arcadia_Engine_Visuals_ViewportNode_setCanvasSize")
+Identifier(u8"Arcadia_Engine_Visuals_ViewportNode_setClearColor")
+Identifier(u8"Arcadia_Engine_Visuals_ViewportNode_setClearColorBuffer")
+Identifier(u8"Arcadia_Engine_Visuals_ViewportNode_setClearDepth")
+Identifier(u8"Arcadia_Engine_Visuals_ViewportNode_setClearDepthBuffer")
+Identifier(u8"Arcadia_Engine_Visuals_ViewportNode_setRelativeViewportRectangle")
+Identifier(u8"Arcadia_Engine_Visuals_WindingMode")
+Identifier(u8"Arcadia_Engine_Visuals_WindingMode_Clockwise")
+Identifier(u8"Arcadia_Engine_Visuals_WindingMode_CounterClockwise")
+Identifier(u8"Arcadia_Engine_Visuals_Window")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackend")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackendDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackend_beginRender")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackend_close")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackend_endRender")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackend_getBigIcon")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackend_getCanvasSize")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackend_getFullscreen")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackend_getPosition")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackend_getRequiredBigIconSize")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackend_getRequiredSmallIconSize")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackend_getSize")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackend_getSmallIcon")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackend_getTitle")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackend_open")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackend_setBigIcon")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackend_setFullscreen")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackend_setPosition")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackend_setSize")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackend_setSmallIcon")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackend_setTitle")
+Identifier(u8"Arcadia_Engine_Visuals_WindowBackend_update")
+Identifier(u8"Arcadia_Engine_Visuals_WindowClosedEvent")
+Identifier(u8"Arcadia_Engine_Visuals_WindowClosedEventDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_WindowClosedEvent_create")
+Identifier(u8"Arcadia_Engine_Visuals_WindowDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_WindowPositionChangedEvent")
+Identifier(u8"Arcadia_Engine_Visuals_WindowPositionChangedEventDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_WindowPositionChangedEvent_create")
+Identifier(u8"Arcadia_Engine_Visuals_WindowSizeChangedEvent")
+Identifier(u8"Arcadia_Engine_Visuals_WindowSizeChangedEventDispatch")
+Identifier(u8"Arcadia_Engine_Visuals_WindowSizeChangedEvent_create")
+Identifier(u8"Arcadia_Engine_Visuals_Window_beginRender")
+Identifier(u8"Arcadia_Engine_Visuals_Window_close")
+Identifier(u8"Arcadia_Engine_Visuals_Window_create")
+Identifier(u8"Arcadia_Engine_Visuals_Window_endRender")
+Identifier(u8"Arcadia_Engine_Visuals_Window_getBigIcon")
+Identifier(u8"Arcadia_Engine_Visuals_Window_getCanvasSize")
+Identifier(u8"Arcadia_Engine_Visuals_Window_getFullscreen")
+Identifier(u8"Arcadia_Engine_Visuals_Window_getPosition")
+Identifier(u8"Arcadia_Engine_Visuals_Window_getRequiredBigIconSize")
+Identifier(u8"Arcadia_Engine_Visuals_Window_getRequiredSmallIconSize")
+Identifier(u8"Arcadia_Engine_Visuals_Window_getSize")
+Identifier(u8"Arcadia_Engine_Visuals_Window_getSmallIcon")
+Identifier(u8"Arcadia_Engine_Visuals_Window_getTitle")
+Identifier(u8"Arcadia_Engine_Visuals_Window_open")
+Identifier(u8"Arcadia_Engine_Visuals_Window_setBigIcon")
+Identifier(u8"Arcadia_Engine_Visuals_Window_setFullscreen")
+Identifier(u8"Arcadia_Engine_Visuals_Window_setPosition")
+Identifier(u8"Arcadia_Engine_Visuals_Window_setSize")
+Identifier(u8"Arcadia_Engine_Visuals_Window_setSmallIcon")
+Identifier(u8"Arcadia_Engine_Visuals_Window_setTitle")
+Identifier(u8"Arcadia_Engine_Visuals_registerNodeFactories")
+Identifier(u8"Arcadia_Engine_Visuals_renderScene")
+Identifier(u8"Arcadia_Engine_dequeEvent")
+Identifier(u8"Arcadia_Engine_enqueEvent")
+Identifier(u8"Arcadia_Engine_getOrCreate")
+Identifier(u8"Arcadia_Engine_update")
+Identifier(u8"Arcadia_EnterConstructor")
+Identifier(u8"Arcadia_EnumerationType")
+Identifier(u8"Arcadia_EnumerationType_getValueSize")
+Identifier(u8"Arcadia_EnumerationValue")
+Identifier(u8"Arcadia_EnumerationValue_make")
+Identifier(u8"Arcadia_Exception")
+Identifier(u8"Arcadia_ExceptionDispatch")
+Identifier(u8"Arcadia_ExistingFilePolicy")
+Identifier(u8"Arcadia_ExistingFilePolicy_Retain")
+Identifier(u8"Arcadia_ExistingFilePolicy_Truncate")
+Identifier(u8"Arcadia_FileAccessMode")
+Identifier(u8"Arcadia_FileAccessMode_Read")
+Identifier(u8"Arcadia_FileAccessMode_ReadWrite")
+Identifier(u8"Arcadia_FileAccessMode_Write")
+Identifier(u8"Arcadia_FileAccessMode_WriteRead")
+Identifier(u8"Arcadia_FileHandle")
+Identifier(u8"Arcadia_FileHandleDispatch")
+Identifier(u8"Arcadia_FileHandle_close")
+Identifier(u8"Arcadia_FileHandle_isClosed")
+Identifier(u8"Arcadia_FileHandle_isOpened")
+Identifier(u8"Arcadia_FileHandle_isOpenedForReading")
+Identifier(u8"Arcadia_FileHandle_isOpenedForWriting")
+Identifier(u8"Arcadia_FileHandle_openForReading")
+Identifier(u8"Arcadia_FileHandle_openForWriting")
+Identifier(u8"Arcadia_FileHandle_openStandardError")
+Identifier(u8"Arcadia_FileHandle_openStandardInput")
+Identifier(u8"Arcadia_FileHandle_openStandardOutput")
+Identifier(u8"Arcadia_FileHandle_read")
+Identifier(u8"Arcadia_FileHandle_write")
+Identifier(u8"Arcadia_FileHandle_writeByteBuffer")
+Identifier(u8"Arcadia_FileHandle_writeString")
+Identifier(u8"Arcadia_FileHandle_writeStringBuffer")
+Identifier(u8"Arcadia_FileLog")
+Identifier(u8"Arcadia_FileLogDispatch")
+Identifier(u8"Arcadia_FileLog_create")
+Identifier(u8"Arcadia_FileMapping")
+Identifier(u8"Arcadia_FileMappingDispatch")
+Identifier(u8"Arcadia_FileMappingLinux")
+Identifier(u8"Arcadia_FileMappingLinuxDispatch")
+Identifier(u8"Arcadia_FileMappingLinux_create")
+Identifier(u8"Arcadia_FileMappingWindows")
+Identifier(u8"Arcadia_FileMappingWindowsDispatch")
+Identifier(u8"Arcadia_FileMappingWindows_create")
+Identifier(u8"Arcadia_FileMapping_getBytes")
+Identifier(u8"Arcadia_FileMapping_getNumberOfBytes")
+Identifier(u8"Arcadia_FilePath")
+Identifier(u8"Arcadia_FilePathDispatch")
+Identifier(u8"Arcadia_FilePath_addOrReplaceExtension")
+Identifier(u8"Arcadia_FilePath_append")
+Identifier(u8"Arcadia_FilePath_clone")
+Identifier(u8"Arcadia_FilePath_create")
+Identifier(u8"Arcadia_FilePath_getExtension")
+Identifier(u8"Arcadia_FilePath_getFullPath")
+Identifier(u8"Arcadia_FilePath_getParent")
+Identifier(u8"Arcadia_FilePath_getRelativePath")
+Identifier(u8"Arcadia_FilePath_getRootPath")
+Identifier(u8"Arcadia_FilePath_isAbsolute")
+Identifier(u8"Arcadia_FilePath_isEqualTo")
+Identifier(u8"Arcadia_FilePath_isRelative")
+Identifier(u8"Arcadia_FilePath_parseGeneric")
+Identifier(u8"Arcadia_FilePath_parseNative")
+Identifier(u8"Arcadia_FilePath_parseUnix")
+Identifier(u8"Arcadia_FilePath_parseWindows")
+Identifier(u8"Arcadia_FilePath_toGeneric")
+Identifier(u8"Arcadia_FilePath_toNative")
+Identifier(u8"Arcadia_FileSystem")
+Identifier(u8"Arcadia_FileSystemDispatch")
+Identifier(u8"Arcadia_FileSystem_createDirectoryFile")
+Identifier(u8"Arcadia_FileSystem_createDirectoryFiles")
+Identifier(u8"Arcadia_FileSystem_createDirectoryIterator")
+Identifier(u8"Arcadia_FileSystem_createFileHandle")
+Identifier(u8"Arcadia_FileSystem_createRegularFile")
+Identifier(u8"Arcadia_FileSystem_deleteDirectoryFile")
+Identifier(u8"Arcadia_FileSystem_deleteFile")
+Identifier(u8"Arcadia_FileSystem_deleteRegularFile")
+Identifier(u8"Arcadia_FileSystem_directoryFileExists")
+Identifier(u8"Arcadia_FileSystem_getConfigurationDirectory")
+Identifier(u8"Arcadia_FileSystem_getExecutable")
+Identifier(u8"Arcadia_FileSystem_getFileContents")
+Identifier(u8"Arcadia_FileSystem_getFileType")
+Identifier(u8"Arcadia_FileSystem_getLastWriteTime")
+Identifier(u8"Arcadia_FileSystem_getOrCreate")
+Identifier(u8"Arcadia_FileSystem_getSaveDirectory")
+Identifier(u8"Arcadia_FileSystem_getWorkingDirectory")
+Identifier(u8"Arcadia_FileSystem_mapFile")
+Identifier(u8"Arcadia_FileSystem_regularFileExists")
+Identifier(u8"Arcadia_FileSystem_setFileContents")
+Identifier(u8"Arcadia_FileType")
+Identifier(u8"Arcadia_FileType_Directory")
+Identifier(u8"Arcadia_FileType_Regular")
+Identifier(u8"Arcadia_FileType_Unknown")
+Identifier(u8"Arcadia_ForeignProcedure")
+Identifier(u8"Arcadia_ForeignProcedureValue")
+Identifier(u8"Arcadia_ForeignProcedureValue_Null")
+Identifier(u8"Arcadia_ForeignProcedureValue_NumberOfBits")
+Identifier(u8"Arcadia_ForeignProcedureValue_NumberOfBytes")
+Identifier(u8"Arcadia_HashMap")
+Identifier(u8"Arcadia_HashMapDispatch")
+Identifier(u8"Arcadia_HashMap_create")
+Identifier(u8"Arcadia_HashSet")
+Identifier(u8"Arcadia_HashSetDispatch")
+Identifier(u8"Arcadia_HashSet_create")
+Identifier(u8"Arcadia_HashSet_findFirst")
+Identifier(u8"Arcadia_ImmutableHashMap")
+Identifier(u8"Arcadia_ImmutableHashMapDispatch")
+Identifier(u8"Arcadia_ImmutableHashMap_create")
+Identifier(u8"Arcadia_ImmutableList")
+Identifier(u8"Arcadia_ImmutableListDispatch")
+Identifier(u8"Arcadia_ImmutableList_create")
+Identifier(u8"Arcadia_ImmutableMap")
+Identifier(u8"Arcadia_ImmutableMap_create")
+Identifier(u8"Arcadia_ImmutableSet")
+Identifier(u8"Arcadia_ImmutableSetDispatch")
+Identifier(u8"Arcadia_ImmutableSet_create")
+Identifier(u8"Arcadia_Integer16")
+Identifier(u8"Arcadia_Integer16Value")
+Identifier(u8"Arcadia_Integer16Value_Literal")
+Identifier(u8"Arcadia_Integer16Value_Maximum")
+Identifier(u8"Arcadia_Integer16Value_MaximumNumberOfDecimalDigits")
+Identifier(u8"Arcadia_Integer16Value_Minimum")
+Identifier(u8"Arcadia_Integer16Value_NumberOfBits")
+Identifier(u8"Arcadia_Integer16Value_NumberOfBytes")
+Identifier(u8"Arcadia_Integer16Value_toUTF8String")
+Identifier(u8"Arcadia_Integer32")
+Identifier(u8"Arcadia_Integer32Value")
+Identifier(u8"Arcadia_Integer32Value_Literal")
+Identifier(u8"Arcadia_Integer32Value_Maximum")
+Identifier(u8"Arcadia_Integer32Value_MaximumNumberOfDecimalDigits")
+Identifier(u8"Arcadia_Integer32Value_Minimum")
+Identifier(u8"Arcadia_Integer32Value_NumberOfBits")
+Identifier(u8"Arcadia_Integer32Value_NumberOfBytes")
+Identifier(u8"Arcadia_Integer32Value_toUTF8String")
+Identifier(u8"Arcadia_Integer64")
+Identifier(u8"Arcadia_Integer64Value")
+Identifier(u8"Arcadia_Integer64Value_Literal")
+Identifier(u8"Arcadia_Integer64Value_Maximum")
+Identifier(u8"Arcadia_Integer64Value_MaximumNumberOfDecimalDigits")
+Identifier(u8"Arcadia_Integer64Value_Minimum")
+Identifier(u8"Arcadia_Integer64Value_NumberOfBits")
+Identifier(u8"Arcadia_Integer64Value_NumberOfBytes")
+Identifier(u8"Arcadia_Integer64Value_toUTF8String")
+Identifier(u8"Arcadia_Integer8")
+Identifier(u8"Arcadia_Integer8Value")
+Identifier(u8"Arcadia_Integer8Value_Literal")
+Identifier(u8"Arcadia_Integer8Value_Maximum")
+Identifier(u8"Arcadia_Integer8Value_MaximumNumberOfDecimalDigits")
+Identifier(u8"Arcadia_Integer8Value_Minimum")
+Identifier(u8"Arcadia_Integer8Value_NumberOfBits")
+Identifier(u8"Arcadia_Integer8Value_NumberOfBytes")
+Identifier(u8"Arcadia_Integer8Value_toUTF8String")
+Identifier(u8"Arcadia_InterfaceType")
+Identifier(u8"Arcadia_InternalType")
+Identifier(u8"Arcadia_JumpTarget")
+Identifier(u8"Arcadia_JumpTarget_save")
+Identifier(u8"Arcadia_Languages_Diagnostic")
+Identifier(u8"Arcadia_Languages_DiagnosticDispatch")
+Identifier(u8"Arcadia_Languages_DiagnosticType")
+Identifier(u8"Arcadia_Languages_DiagnosticType_Error")
+Identifier(u8"Arcadia_Languages_DiagnosticType_Information")
+Identifier(u8"Arcadia_Languages_DiagnosticType_Warning")
+Identifier(u8"Arcadia_Languages_Diagnostic_getMessage")
+Identifier(u8"Arcadia_Languages_Diagnostic_getType")
+Identifier(u8"Arcadia_Languages_Diagnostics")
+Identifier(u8"Arcadia_Languages_DiagnosticsDispatch")
+Identifier(u8"Arcadia_Languages_DiagnosticsOld_emit")
+Identifier(u8"Arcadia_Languages_Diagnostics_add")
+Identifier(u8"Arcadia_Languages_Diagnostics_create")
+Identifier(u8"Arcadia_Languages_Diagnostics_emit")
+Identifier(u8"Arcadia_Languages_Diagnostics_hasErrors")
+Identifier(u8"Arcadia_Languages_Parser")
+Identifier(u8"Arcadia_Languages_ParserDispatch")
+Identifier(u8"Arcadia_Languages_Parser_getDiagnostics")
+Identifier(u8"Arcadia_Languages_Parser_getInput")
+Identifier(u8"Arcadia_Languages_Parser_getStringTable")
+Identifier(u8"Arcadia_Languages_Parser_run")
+Identifier(u8"Arcadia_Languages_Parser_setInput")
+Identifier(u8"Arcadia_Languages_Scanner")
+Identifier(u8"Arcadia_Languages_ScannerDispatch")
+Identifier(u8"Arcadia_Languages_Scanner_getDiagnostics")
+Identifier(u8"Arcadia_Languages_Scanner_getInput")
+Identifier(u8"Arcadia_Languages_Scanner_getStringTable")
+Identifier(u8"Arcadia_Languages_Scanner_getWordLength")
+Identifier(u8"Arcadia_Languages_Scanner_getWordStart")
+Identifier(u8"Arcadia_Languages_Scanner_getWordText")
+Identifier(u8"Arcadia_Languages_Scanner_getWordType")
+Identifier(u8"Arcadia_Languages_Scanner_setInput")
+Identifier(u8"Arcadia_Languages_Scanner_step")
+Identifier(u8"Arcadia_Languages_Scope")
+Identifier(u8"Arcadia_Languages_ScopeDispatch")
+Identifier(u8"Arcadia_Languages_Scope_clear")
+Identifier(u8"Arcadia_Languages_Scope_contains")
+Identifier(u8"Arcadia_Languages_Scope_count")
+Identifier(u8"Arcadia_Languages_Scope_create")
+Identifier(u8"Arcadia_Languages_Scope_enter")
+Identifier(u8"Arcadia_Languages_Scope_lookup")
+Identifier(u8"Arcadia_Languages_StringTable")
+Identifier(u8"Arcadia_Languages_StringTableDispatch")
+Identifier(u8"Arcadia_Languages_StringTable_Node")
+Identifier(u8"Arcadia_Languages_StringTable_getOrCreate")
+Identifier(u8"Arcadia_Languages_StringTable_getOrCreateString")
+Identifier(u8"Arcadia_Languages_StringTable_getOrCreateStringFromBytes")
+Identifier(u8"Arcadia_Languages_StringTable_getOrCreateStringFromCxxString")
+Identifier(u8"Arcadia_Languages_mangleName")
+Identifier(u8"Arcadia_LeaveConstructor")
+Identifier(u8"Arcadia_Likely")
+Identifier(u8"Arcadia_List")
+Identifier(u8"Arcadia_ListDispatch")
+Identifier(u8"Arcadia_List_contains")
+Identifier(u8"Arcadia_List_filter")
+Identifier(u8"Arcadia_List_forEach")
+Identifier(u8"Arcadia_List_get")
+Identifier(u8"Arcadia_List_getAt")
+Identifier(u8"Arcadia_List_getObjectReferenceValueAt")
+Identifier(u8"Arcadia_List_getObjectReferenceValueCheckedAt")
+Identifier(u8"Arcadia_List_insert")
+Identifier(u8"Arcadia_List_insertAt")
+Identifier(u8"Arcadia_List_insertBack")
+Identifier(u8"Arcadia_List_insertFront")
+Identifier(u8"Arcadia_List_is")
+Identifier(u8"Arcadia_List_removeAt")
+Identifier(u8"Arcadia_List_removeBack")
+Identifier(u8"Arcadia_List_removeFront")
+Identifier(u8"Arcadia_Log")
+Identifier(u8"Arcadia_LogCategory")
+Identifier(u8"Arcadia_LogCategory_Error")
+Identifier(u8"Arcadia_LogCategory_Information")
+Identifier(u8"Arcadia_LogCategory_Warning")
+Identifier(u8"Arcadia_LogDispatch")
+Identifier(u8"Arcadia_LogFlags")
+Identifier(u8"Arcadia_LogFlags_Debug")
+Identifier(u8"Arcadia_LogFlags_Error")
+Identifier(u8"Arcadia_LogFlags_Info")
+Identifier(u8"Arcadia_LogFlags_Trace")
+Identifier(u8"Arcadia_Log_error")
+Identifier(u8"Arcadia_Log_information")
+Identifier(u8"Arcadia_Log_warning")
+Identifier(u8"Arcadia_Map")
+Identifier(u8"Arcadia_MapDispatch")
+Identifier(u8"Arcadia_Map_get")
+Identifier(u8"Arcadia_Map_getBooleanValueChecked")
+Identifier(u8"Arcadia_Map_getKeys")
+Identifier(u8"Arcadia_Map_getNatural64ValueChecked")
+Identifier(u8"Arcadia_Map_getObjectReferenceValueChecked")
+Identifier(u8"Arcadia_Map_getValues")
+Identifier(u8"Arcadia_Map_remove")
+Identifier(u8"Arcadia_Map_set")
+Identifier(u8"Arcadia_Math_Color4Real32")
+Identifier(u8"Arcadia_Math_Matrix4Real32")
+Identifier(u8"Arcadia_Media_DSP")
+Identifier(u8"Arcadia_Media_DSPDispatch")
+Identifier(u8"Arcadia_Media_DSP_SawtoothWave")
+Identifier(u8"Arcadia_Media_DSP_SawtoothWaveDispatch")
+Identifier(u8"Arcadia_Media_DSP_SawtoothWave_create")
+Identifier(u8"Arcadia_Media_DSP_SineWave")
+Identifier(u8"Arcadia_Media_DSP_SineWaveDispatch")
+Identifier(u8"Arcadia_Media_DSP_SineWave_create")
+Identifier(u8"Arcadia_Media_DSP_WhiteNoise")
+Identifier(u8"Arcadia_Media_DSP_WhiteNoiseDispatch")
+Identifier(u8"Arcadia_Media_DSP_WhiteNoise_create")
+Identifier(u8"Arcadia_Media_DSP_generate")
+Identifier(u8"Arcadia_Media_PixelBuffer")
+Identifier(u8"Arcadia_Media_PixelBufferDispatch")
+Identifier(u8"Arcadia_Media_PixelBufferOperation")
+Identifier(u8"Arcadia_Media_PixelBufferOperationDispatch")
+Identifier(u8"Arcadia_Media_PixelBufferOperation_apply")
+Identifier(u8"Arcadia_Media_PixelBufferOperations_CheckerboardFill")
+Identifier(u8"Arcadia_Media_PixelBufferOperations_CheckerboardFillDispatch")
+Identifier(u8"Arcadia_Media_PixelBufferOperations_CheckerboardFill_create")
+Identifier(u8"Arcadia_Media_PixelBufferOperations_Fill")
+Identifier(u8"Arcadia_Media_PixelBufferOperations_FillDispatch")
+Identifier(u8"Arcadia_Media_PixelBufferOperations_Fill_create")
+Identifier(u8"Arcadia_Media_PixelBuffer_assign")
+Identifier(u8"Arcadia_Media_PixelBuffer_create")
+Identifier(u8"Arcadia_Media_PixelBuffer_createClone")
+Identifier(u8"Arcadia_Media_PixelBuffer_fill")
+Identifier(u8"Arcadia_Media_PixelBuffer_fillRectangle")
+Identifier(u8"Arcadia_Media_PixelBuffer_getBytesPerPixel")
+Identifier(u8"Arcadia_Media_PixelBuffer_getHeight")
+Identifier(u8"Arcadia_Media_PixelBuffer_getLinePadding")
+Identifier(u8"Arcadia_Media_PixelBuffer_getLineStride")
+Identifier(u8"Arcadia_Media_PixelBuffer_getNumberOfColumns")
+Identifier(u8"Arcadia_Media_PixelBuffer_getNumberOfRows")
+Identifier(u8"Arcadia_Media_PixelBuffer_getPixelFormat")
+Identifier(u8"Arcadia_Media_PixelBuffer_getPixelRGBA")
+Identifier(u8"Arcadia_Media_PixelBuffer_getWidth")
+Identifier(u8"Arcadia_Media_PixelBuffer_reflectHorizontally")
+Identifier(u8"Arcadia_Media_PixelBuffer_reflectVertically")
+Identifier(u8"Arcadia_Media_PixelBuffer_setHeight")
+Identifier(u8"Arcadia_Media_PixelBuffer_setLinePadding")
+Identifier(u8"Arcadia_Media_PixelBuffer_setNumberOfColumns")
+Identifier(u8"Arcadia_Media_PixelBuffer_setNumberOfRows")
+Identifier(u8"Arcadia_Media_PixelBuffer_setPixelFormat")
+Identifier(u8"Arcadia_Media_PixelBuffer_setPixelRGBA")
+Identifier(u8"Arcadia_Media_PixelBuffer_setWidth")
+Identifier(u8"Arcadia_Media_PixelBuffer_swap")
+Identifier(u8"Arcadia_Media_PixelBuffer_swapColumns")
+Identifier(u8"Arcadia_Media_PixelBuffer_swapRows")
+Identifier(u8"Arcadia_Media_PixelFormat")
+Identifier(u8"Arcadia_Media_PixelFormat_AlphaBlueGreenRedNatural8")
+Identifier(u8"Arcadia_Media_PixelFormat_AlphaGrayNatural8")
+Identifier(u8"Arcadia_Media_PixelFormat_AlphaRedGreenBlueNatural8")
+Identifier(u8"Arcadia_Media_PixelFormat_BlueGreenRedAlphaNatural8")
+Identifier(u8"Arcadia_Media_PixelFormat_BlueGreenRedNatural8")
+Identifier(u8"Arcadia_Media_PixelFormat_GrayAlphaNatural8")
+Identifier(u8"Arcadia_Media_PixelFormat_GrayNatural8")
+Identifier(u8"Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8")
+Identifier(u8"Arcadia_Media_PixelFormat_RedGreenBlueNatural8")
+Identifier(u8"Arcadia_Media_PixelFormat_getNumberOfBytes")
+Identifier(u8"Arcadia_Media_PixelFormat_getNumberOfComponents")
+Identifier(u8"Arcadia_Media_SampleBuffer")
+Identifier(u8"Arcadia_Media_SampleBufferDispatch")
+Identifier(u8"Arcadia_Media_SampleBuffer_create")
+Identifier(u8"Arcadia_Media_SampleBuffer_createClone")
+Identifier(u8"Arcadia_Media_SampleBuffer_fill")
+Identifier(u8"Arcadia_Media_SampleBuffer_getLength")
+Identifier(u8"Arcadia_Media_SampleBuffer_getSampleFormat")
+Identifier(u8"Arcadia_Media_SampleBuffer_getSampleRate")
+Identifier(u8"Arcadia_Media_SampleBuffer_swap")
+Identifier(u8"Arcadia_Media_SampleFormat")
+Identifier(u8"Arcadia_Media_SampleFormat_Integer16")
+Identifier(u8"Arcadia_Media_SampleFormat_Integer8")
+Identifier(u8"Arcadia_Media_SampleFormat_Natural16")
+Identifier(u8"Arcadia_Media_SampleFormat_Natural8")
+Identifier(u8"Arcadia_Media_SampleFormat_Real32")
+Identifier(u8"Arcadia_Media_SampleFormat_getNumberOfBytes")
+Identifier(u8"Arcadia_Media_SampleStream")
+Identifier(u8"Arcadia_Media_SampleStreamDispatch")
+Identifier(u8"Arcadia_Media_SampleStream_create")
+Identifier(u8"Arcadia_Media_SampleStream_getLength")
+Identifier(u8"Arcadia_Media_SampleStream_getSampleFormat")
+Identifier(u8"Arcadia_Media_SampleStream_getSampleRate")
+Identifier(u8"Arcadia_Media_SampleStream_isAtEnd")
+Identifier(u8"Arcadia_Media_SampleStream_read")
+Identifier(u8"Arcadia_Media_SampleStream_rewind")
+Identifier(u8"Arcadia_Media_VertexBuffer")
+Identifier(u8"Arcadia_Media_VertexBufferDispatch")
+Identifier(u8"Arcadia_Media_VertexBuffer_create")
+Identifier(u8"Arcadia_Media_VertexBuffer_getNumberOfVertices")
+Identifier(u8"Arcadia_Media_VertexBuffer_getVertexDescriptor")
+Identifier(u8"Arcadia_Media_VertexDescriptor")
+Identifier(u8"Arcadia_Media_VertexDescriptorBuilder")
+Identifier(u8"Arcadia_Media_VertexDescriptorBuilderDispatch")
+Identifier(u8"Arcadia_Media_VertexDescriptorBuilder_build")
+Identifier(u8"Arcadia_Media_VertexDescriptorBuilder_create")
+Identifier(u8"Arcadia_Media_VertexDescriptorDispatch")
+Identifier(u8"Arcadia_Media_VertexDescriptor_create")
+Identifier(u8"Arcadia_Media_VertexDescriptor_getVertexSize")
+Identifier(u8"Arcadia_Media_VertexElementDescriptor")
+Identifier(u8"Arcadia_Media_VertexElementDescriptorDispatch")
+Identifier(u8"Arcadia_Media_VertexElementDescriptor_create")
+Identifier(u8"Arcadia_Media_VertexElementDescriptor_getOffset")
+Identifier(u8"Arcadia_Media_VertexElementDescriptor_getSemantics")
+Identifier(u8"Arcadia_Media_VertexElementDescriptor_getSize")
+Identifier(u8"Arcadia_Media_VertexElementDescriptor_getSource")
+Identifier(u8"Arcadia_Media_VertexElementDescriptor_getSyntactics")
+Identifier(u8"Arcadia_Media_VertexElementSemantics")
+Identifier(u8"Arcadia_Media_VertexElementSemantics_AmbientRGBA")
+Identifier(u8"Arcadia_Media_VertexElementSemantics_AmbientUV")
+Identifier(u8"Arcadia_Media_VertexElementSemantics_PositionXYZ")
+Identifier(u8"Arcadia_Media_VertexElementSyntactics")
+Identifier(u8"Arcadia_Media_VertexElementSyntactics_Real32")
+Identifier(u8"Arcadia_Media_VertexElementSyntactics_Real32Real32")
+Identifier(u8"Arcadia_Media_VertexElementSyntactics_Real32Real32Real32")
+Identifier(u8"Arcadia_Media_VertexElementSyntactics_Real32Real32Real32Real32")
+Identifier(u8"Arcadia_Media_quantize")
+Identifier(u8"Arcadia_Media_quantizeInteger16")
+Identifier(u8"Arcadia_Media_quantizeInteger8")
+Identifier(u8"Arcadia_Media_quantizeNatural16")
+Identifier(u8"Arcadia_Media_quantizeNatural8")
+Identifier(u8"Arcadia_Media_sampleBuffer_setFormat")
+Identifier(u8"Arcadia_Memory_allocateUnmanaged")
+Identifier(u8"Arcadia_Memory_compare")
+Identifier(u8"Arcadia_Memory_compareAndSwap")
+Identifier(u8"Arcadia_Memory_copy")
+Identifier(u8"Arcadia_Memory_deallocateUnmanaged")
+Identifier(u8"Arcadia_Memory_endsWith")
+Identifier(u8"Arcadia_Memory_fill")
+Identifier(u8"Arcadia_Memory_fillZero")
+Identifier(u8"Arcadia_Memory_reallocateUnmanaged")
+Identifier(u8"Arcadia_Memory_reverseMemory32")
+Identifier(u8"Arcadia_Memory_reverseMemory64")
+Identifier(u8"Arcadia_Memory_reverseMemory8")
+Identifier(u8"Arcadia_Memory_startsWith")
+Identifier(u8"Arcadia_Memory_swap")
+Identifier(u8"Arcadia_Name")
+Identifier(u8"Arcadia_Name_getBytes")
+Identifier(u8"Arcadia_Name_getHash")
+Identifier(u8"Arcadia_Name_getNumberOfBytes")
+Identifier(u8"Arcadia_Name_visit")
+Identifier(u8"Arcadia_Names")
+Identifier(u8"Arcadia_Names_getOrCreateName")
+Identifier(u8"Arcadia_Names_parseTypeName")
+Identifier(u8"Arcadia_Natural16")
+Identifier(u8"Arcadia_Natural16Value")
+Identifier(u8"Arcadia_Natural16Value_Literal")
+Identifier(u8"Arcadia_Natural16Value_Maximum")
+Identifier(u8"Arcadia_Natural16Value_MaximumNumberOfDecimalDigits")
+Identifier(u8"Arcadia_Natural16Value_MaximumNumberOfHexadecimalDigits")
+Identifier(u8"Arcadia_Natural16Value_Minimum")
+Identifier(u8"Arcadia_Natural16Value_NumberOfBits")
+Identifier(u8"Arcadia_Natural16Value_NumberOfBytes")
+Identifier(u8"Arcadia_Natural16Value_toUTF8String")
+Identifier(u8"Arcadia_Natural32")
+Identifier(u8"Arcadia_Natural32Value")
+Identifier(u8"Arcadia_Natural32Value_Literal")
+Identifier(u8"Arcadia_Natural32Value_Maximum")
+Identifier(u8"Arcadia_Natural32Value_MaximumNumberOfDecimalDigits")
+Identifier(u8"Arcadia_Natural32Value_MaximumNumberOfHexadecimalDigits")
+Identifier(u8"Arcadia_Natural32Value_Minimum")
+Identifier(u8"Arcadia_Natural32Value_NumberOfBits")
+Identifier(u8"Arcadia_Natural32Value_NumberOfBytes")
+Identifier(u8"Arcadia_Natural32Value_toUTF8String")
+Identifier(u8"Arcadia_Natural64")
+Identifier(u8"Arcadia_Natural64Value")
+Identifier(u8"Arcadia_Natural64Value_Literal")
+Identifier(u8"Arcadia_Natural64Value_Maximum")
+Identifier(u8"Arcadia_Natural64Value_MaximumNumberOfDecimalDigits")
+Identifier(u8"Arcadia_Natural64Value_MaximumNumberOfHexadecimalDigits")
+Identifier(u8"Arcadia_Natural64Value_Minimum")
+Identifier(u8"Arcadia_Natural64Value_NumberOfBits")
+Identifier(u8"Arcadia_Natural64Value_NumberOfBytes")
+Identifier(u8"Arcadia_Natural64Value_toUTF8String")
+Identifier(u8"Arcadia_Natural8")
+Identifier(u8"Arcadia_Natural8Value")
+Identifier(u8"Arcadia_Natural8Value_Literal")
+Identifier(u8"Arcadia_Natural8Value_Maximum")
+Identifier(u8"Arcadia_Natural8Value_MaximumNumberOfDecimalDigits")
+Identifier(u8"Arcadia_Natural8Value_MaximumNumberOfHexadecimalDigits")
+Identifier(u8"Arcadia_Natural8Value_Minimum")
+Identifier(u8"Arcadia_Natural8Value_NumberOfBits")
+Identifier(u8"Arcadia_Natural8Value_NumberOfBytes")
+Identifier(u8"Arcadia_Natural8Value_toUTF8String")
+Identifier(u8"Arcadia_Network_AddressFamily")
+Identifier(u8"Arcadia_Network_AddressFamily_Ipv4")
+Identifier(u8"Arcadia_Network_AddressFamily_Ipv6")
+Identifier(u8"Arcadia_Network_Protocol")
+Identifier(u8"Arcadia_Network_Protocol_Tcp")
+Identifier(u8"Arcadia_Network_Protocol_Udp")
+Identifier(u8"Arcadia_Network_SocketType")
+Identifier(u8"Arcadia_Network_SocketType_Datagram")
+Identifier(u8"Arcadia_Network_SocketType_Stream")
+Identifier(u8"Arcadia_NoReturn")
+Identifier(u8"Arcadia_NonExistingFilePolicy")
+Identifier(u8"Arcadia_NonExistingFilePolicy_Create")
+Identifier(u8"Arcadia_NonExistingFilePolicy_Fail")
+Identifier(u8"Arcadia_NumberLiteral")
+Identifier(u8"Arcadia_NumberLiteral_Exponent")
+Identifier(u8"Arcadia_NumberLiteral_Fractional")
+Identifier(u8"Arcadia_NumberLiteral_Integral")
+Identifier(u8"Arcadia_NumberLiteral_Sign")
+Identifier(u8"Arcadia_Object")
+Identifier(u8"Arcadia_ObjectDispatch")
+Identifier(u8"Arcadia_ObjectDispatch_InitializeCallbackFunction")
+Identifier(u8"Arcadia_ObjectReference")
+Identifier(u8"Arcadia_ObjectReferenceValue")
+Identifier(u8"Arcadia_ObjectReferenceValue_Null")
+Identifier(u8"Arcadia_ObjectReferenceValue_NumberOfBits")
+Identifier(u8"Arcadia_ObjectReferenceValue_NumberOfBytes")
+Identifier(u8"Arcadia_ObjectType")
+Identifier(u8"Arcadia_ObjectType_Operations")
+Identifier(u8"Arcadia_ObjectType_Operations_Initializer")
+Identifier(u8"Arcadia_ObjectType_getDispatch")
+Identifier(u8"Arcadia_ObjectType_getParentObjectType")
+Identifier(u8"Arcadia_ObjectType_getValueSize")
+Identifier(u8"Arcadia_Object_ConstructCallbackFunction")
+Identifier(u8"Arcadia_Object_DestructCallbackFunction")
+Identifier(u8"Arcadia_Object_VisitCallbackFunction")
+Identifier(u8"Arcadia_Object_addNotifyDestroyCallback")
+Identifier(u8"Arcadia_Object_backwardBarrier")
+Identifier(u8"Arcadia_Object_forwardBarrier")
+Identifier(u8"Arcadia_Object_getHash")
+Identifier(u8"Arcadia_Object_getHashProcedure")
+Identifier(u8"Arcadia_Object_getType")
+Identifier(u8"Arcadia_Object_isEqualTo")
+Identifier(u8"Arcadia_Object_isEqualToProcedure")
+Identifier(u8"Arcadia_Object_isIdenticalTo")
+Identifier(u8"Arcadia_Object_isInstanceOf")
+Identifier(u8"Arcadia_Object_isNotEqualTo")
+Identifier(u8"Arcadia_Object_isNotEqualToProcedure")
+Identifier(u8"Arcadia_Object_lock")
+Identifier(u8"Arcadia_Object_removeNotifyDestroyCallback")
+Identifier(u8"Arcadia_Object_setType")
+Identifier(u8"Arcadia_Object_toString")
+Identifier(u8"Arcadia_Object_unlock")
+Identifier(u8"Arcadia_Object_visit")
+Identifier(u8"Arcadia_PointInTime")
+Identifier(u8"Arcadia_PointInTimeDispatch")
+Identifier(u8"Arcadia_PointInTime_create")
+Identifier(u8"Arcadia_PointInTime_getDayOfMonth")
+Identifier(u8"Arcadia_PointInTime_getDayOfWeek")
+Identifier(u8"Arcadia_PointInTime_getMonth")
+Identifier(u8"Arcadia_PointInTime_getYear")
+Identifier(u8"Arcadia_Process")
+Identifier(u8"Arcadia_ProcessStatus")
+Identifier(u8"Arcadia_ProcessStatus_AllocationFailed")
+Identifier(u8"Arcadia_ProcessStatus_ArgumentValueInvalid")
+Identifier(u8"Arcadia_ProcessStatus_EnvironmentFailed")
+Identifier(u8"Arcadia_ProcessStatus_OperationInvalid")
+Identifier(u8"Arcadia_ProcessStatus_Success")
+Identifier(u8"Arcadia_Process_ArenaFinalizeCallback")
+Identifier(u8"Arcadia_Process_ArenaPreMarkCallback")
+Identifier(u8"Arcadia_Process_ArenaVisitCallback")
+Identifier(u8"Arcadia_Process_FinalizeCallback")
+Identifier(u8"Arcadia_Process_TypeRemovedCallback")
+Identifier(u8"Arcadia_Process_VisitCallback")
+Identifier(u8"Arcadia_Process_acquire")
+Identifier(u8"Arcadia_Process_addArenaFinalizeCallback")
+Identifier(u8"Arcadia_Process_addArenaPreMarkCallback")
+Identifier(u8"Arcadia_Process_addArenaVisitCallback")
+Identifier(u8"Arcadia_Process_allocate")
+Identifier(u8"Arcadia_Process_get")
+Identifier(u8"Arcadia_Process_getThread")
+Identifier(u8"Arcadia_Process_lockObject")
+Identifier(u8"Arcadia_Process_registerType")
+Identifier(u8"Arcadia_Process_relinquish")
+Identifier(u8"Arcadia_Process_removeArenaFinalizeCallback")
+Identifier(u8"Arcadia_Process_removeArenaPreMarkCallback")
+Identifier(u8"Arcadia_Process_removeArenaVisitCallback")
+Identifier(u8"Arcadia_Process_reverseMemory16")
+Identifier(u8"Arcadia_Process_runARMS")
+Identifier(u8"Arcadia_Process_stepARMS")
+Identifier(u8"Arcadia_Process_unlockObject")
+Identifier(u8"Arcadia_Process_visitObject")
+Identifier(u8"Arcadia_Random")
+Identifier(u8"Arcadia_RandomDispatch")
+Identifier(u8"Arcadia_Random_create")
+Identifier(u8"Arcadia_Real32")
+Identifier(u8"Arcadia_Real32Value")
+Identifier(u8"Arcadia_Real32Value_ExponentBias")
+Identifier(u8"Arcadia_Real32Value_ExponentBitsMask")
+Identifier(u8"Arcadia_Real32Value_ExponentBitsShift")
+Identifier(u8"Arcadia_Real32Value_Literal")
+Identifier(u8"Arcadia_Real32Value_MaximalExponent")
+Identifier(u8"Arcadia_Real32Value_Maximum")
+Identifier(u8"Arcadia_Real32Value_MinimalExponent")
+Identifier(u8"Arcadia_Real32Value_Minimum")
+Identifier(u8"Arcadia_Real32Value_NegativeInfinity")
+Identifier(u8"Arcadia_Real32Value_NumberOfBits")
+Identifier(u8"Arcadia_Real32Value_NumberOfBytes")
+Identifier(u8"Arcadia_Real32Value_NumberOfExplicitSignificandBits")
+Identifier(u8"Arcadia_Real32Value_NumberOfExponentBits")
+Identifier(u8"Arcadia_Real32Value_NumberOfSignBits")
+Identifier(u8"Arcadia_Real32Value_NumberOfSignificandBitsIncludingImplicit")
+Identifier(u8"Arcadia_Real32Value_PositiveInfinity")
+Identifier(u8"Arcadia_Real32Value_SignBitsMask")
+Identifier(u8"Arcadia_Real32Value_SignBitsShift")
+Identifier(u8"Arcadia_Real32Value_SignificandBitsMask")
+Identifier(u8"Arcadia_Real32Value_SignificandBitsShift")
+Identifier(u8"Arcadia_Real32Value_getBits")
+Identifier(u8"Arcadia_Real32Value_isFinite")
+Identifier(u8"Arcadia_Real32Value_toUTF8String")
+Identifier(u8"Arcadia_Real64")
+Identifier(u8"Arcadia_Real64Value")
+Identifier(u8"Arcadia_Real64Value_ExponentBias")
+Identifier(u8"Arcadia_Real64Value_ExponentBitsMask")
+Identifier(u8"Arcadia_Real64Value_ExponentBitsShift")
+Identifier(u8"Arcadia_Real64Value_Literal")
+Identifier(u8"Arcadia_Real64Value_MaximalExponent")
+Identifier(u8"Arcadia_Real64Value_Maximum")
+Identifier(u8"Arcadia_Real64Value_MinimalExponent")
+Identifier(u8"Arcadia_Real64Value_Minimum")
+Identifier(u8"Arcadia_Real64Value_NegativeInfinity")
+Identifier(u8"Arcadia_Real64Value_NumberOfBits")
+Identifier(u8"Arcadia_Real64Value_NumberOfBytes")
+Identifier(u8"Arcadia_Real64Value_NumberOfExplicitSignificandBits")
+Identifier(u8"Arcadia_Real64Value_NumberOfExponentBits")
+Identifier(u8"Arcadia_Real64Value_NumberOfSignBits")
+Identifier(u8"Arcadia_Real64Value_NumberOfSignificandBitsIncludingImplicit")
+Identifier(u8"Arcadia_Real64Value_PositiveInfinity")
+Identifier(u8"Arcadia_Real64Value_SignBitsMask")
+Identifier(u8"Arcadia_Real64Value_SignBitsShift")
+Identifier(u8"Arcadia_Real64Value_SignificandBitsMask")
+Identifier(u8"Arcadia_Real64Value_SignificandBitsShift")
+Identifier(u8"Arcadia_Real64Value_getBits")
+Identifier(u8"Arcadia_Real64Value_isFinite")
+Identifier(u8"Arcadia_Real64Value_toUTF8String")
+Identifier(u8"Arcadia_Ring1_Tests_BigInteger_additiveOperations")
+Identifier(u8"Arcadia_Ring1_Tests_BigInteger_andOperations")
+Identifier(u8"Arcadia_Ring1_Tests_BigInteger_decimalStringOperations")
+Identifier(u8"Arcadia_Ring1_Tests_BigInteger_multiplicativeOperations")
+Identifier(u8"Arcadia_Ring1_Tests_BigInteger_orOperations")
+Identifier(u8"Arcadia_Ring1_Tests_BigInteger_powersOfOperations")
+Identifier(u8"Arcadia_Ring1_Tests_BigInteger_quotientRemainderOperations")
+Identifier(u8"Arcadia_Ring1_Tests_BigInteger_relationalOperations")
+Identifier(u8"Arcadia_Ring1_Tests_BigInteger_setIntegerOperations")
+Identifier(u8"Arcadia_Ring1_Tests_BigInteger_shiftOperations")
+Identifier(u8"Arcadia_Ring1_Tests_BigInteger_twosComplementOperations")
+Identifier(u8"Arcadia_Ring1_Tests_RealTypes_real32")
+Identifier(u8"Arcadia_Ring1_Tests_RealTypes_real64")
+Identifier(u8"Arcadia_RuntimeByteArray")
+Identifier(u8"Arcadia_RuntimeByteArrayValue")
+Identifier(u8"Arcadia_RuntimeByteArray_ByteReader")
+Identifier(u8"Arcadia_RuntimeByteArray_ByteReaderDispatch")
+Identifier(u8"Arcadia_RuntimeByteArray_ByteReader_create")
+Identifier(u8"Arcadia_RuntimeByteArray_create")
+Identifier(u8"Arcadia_RuntimeByteArray_ensureGray")
+Identifier(u8"Arcadia_RuntimeByteArray_getBytes")
+Identifier(u8"Arcadia_RuntimeByteArray_getNumberOfBytes")
+Identifier(u8"Arcadia_RuntimeByteArray_visit")
+Identifier(u8"Arcadia_RuntimeUTF8String")
+Identifier(u8"Arcadia_RuntimeUTF8StringValue")
+Identifier(u8"Arcadia_RuntimeUTF8String_create")
+Identifier(u8"Arcadia_RuntimeUTF8String_createEmpty")
+Identifier(u8"Arcadia_RuntimeUTF8String_createFromBoolean")
+Identifier(u8"Arcadia_RuntimeUTF8String_createFromInteger16")
+Identifier(u8"Arcadia_RuntimeUTF8String_createFromInteger32")
+Identifier(u8"Arcadia_RuntimeUTF8String_createFromInteger64")
+Identifier(u8"Arcadia_RuntimeUTF8String_createFromInteger8")
+Identifier(u8"Arcadia_RuntimeUTF8String_createFromNatural16")
+Identifier(u8"Arcadia_RuntimeUTF8String_createFromNatural32")
+Identifier(u8"Arcadia_RuntimeUTF8String_createFromNatural64")
+Identifier(u8"Arcadia_RuntimeUTF8String_createFromNatural8")
+Identifier(u8"Arcadia_RuntimeUTF8String_createFromReal32")
+Identifier(u8"Arcadia_RuntimeUTF8String_createFromReal64")
+Identifier(u8"Arcadia_RuntimeUTF8String_createFromSize")
+Identifier(u8"Arcadia_RuntimeUTF8String_createFromVoid")
+Identifier(u8"Arcadia_RuntimeUTF8String_endsWith")
+Identifier(u8"Arcadia_RuntimeUTF8String_ensureGray")
+Identifier(u8"Arcadia_RuntimeUTF8String_findFirstOccurrence")
+Identifier(u8"Arcadia_RuntimeUTF8String_findLastOccurrence")
+Identifier(u8"Arcadia_RuntimeUTF8String_getBytes")
+Identifier(u8"Arcadia_RuntimeUTF8String_getHash")
+Identifier(u8"Arcadia_RuntimeUTF8String_getNumberOfBytes")
+Identifier(u8"Arcadia_RuntimeUTF8String_getNumberOfCodePoints")
+Identifier(u8"Arcadia_RuntimeUTF8String_startsWith")
+Identifier(u8"Arcadia_RuntimeUTF8String_substring")
+Identifier(u8"Arcadia_RuntimeUTF8String_toBoolean")
+Identifier(u8"Arcadia_RuntimeUTF8String_toInteger16")
+Identifier(u8"Arcadia_RuntimeUTF8String_toInteger32")
+Identifier(u8"Arcadia_RuntimeUTF8String_toInteger64")
+Identifier(u8"Arcadia_RuntimeUTF8String_toInteger8")
+Identifier(u8"Arcadia_RuntimeUTF8String_toNatural16")
+Identifier(u8"Arcadia_RuntimeUTF8String_toNatural32")
+Identifier(u8"Arcadia_RuntimeUTF8String_toNatural64")
+Identifier(u8"Arcadia_RuntimeUTF8String_toNatural8")
+Identifier(u8"Arcadia_RuntimeUTF8String_toReal32")
+Identifier(u8"Arcadia_RuntimeUTF8String_toReal64")
+Identifier(u8"Arcadia_RuntimeUTF8String_toSize")
+Identifier(u8"Arcadia_RuntimeUTF8String_toVoid")
+Identifier(u8"Arcadia_RuntimeUTF8String_visit")
+Identifier(u8"Arcadia_ScalarType")
+Identifier(u8"Arcadia_Set")
+Identifier(u8"Arcadia_SetDispatch")
+Identifier(u8"Arcadia_Set_add")
+Identifier(u8"Arcadia_Set_contains")
+Identifier(u8"Arcadia_Set_get")
+Identifier(u8"Arcadia_Set_getAll")
+Identifier(u8"Arcadia_Set_remove")
+Identifier(u8"Arcadia_Signal")
+Identifier(u8"Arcadia_SignalDispatch")
+Identifier(u8"Arcadia_Signal_connect")
+Identifier(u8"Arcadia_Signal_create")
+Identifier(u8"Arcadia_Signal_emit")
+Identifier(u8"Arcadia_Size")
+Identifier(u8"Arcadia_SizeValue")
+Identifier(u8"Arcadia_SizeValue_Literal")
+Identifier(u8"Arcadia_SizeValue_Maximum")
+Identifier(u8"Arcadia_SizeValue_Minimum")
+Identifier(u8"Arcadia_SizeValue_NumberOfBits")
+Identifier(u8"Arcadia_SizeValue_NumberOfBytes")
+Identifier(u8"Arcadia_SizeValue_toUTF8String")
+Identifier(u8"Arcadia_Slot")
+Identifier(u8"Arcadia_SlotDispatch")
+Identifier(u8"Arcadia_Slot_create")
+Identifier(u8"Arcadia_Slot_disconnect")
+Identifier(u8"Arcadia_Stack")
+Identifier(u8"Arcadia_StackDispatch")
+Identifier(u8"Arcadia_Stack_get")
+Identifier(u8"Arcadia_Stack_is")
+Identifier(u8"Arcadia_Stack_peek")
+Identifier(u8"Arcadia_Stack_peekAt")
+Identifier(u8"Arcadia_Stack_peekObjectReferenceValue")
+Identifier(u8"Arcadia_Stack_pop")
+Identifier(u8"Arcadia_Stack_popObjectReferenceValueChecked")
+Identifier(u8"Arcadia_Stack_push")
+Identifier(u8"Arcadia_StaticAssert")
+Identifier(u8"Arcadia_Status")
+Identifier(u8"Arcadia_Status_AccessDenied")
+Identifier(u8"Arcadia_Status_AllocationFailed")
+Identifier(u8"Arcadia_Status_ArgumentTypeInvalid")
+Identifier(u8"Arcadia_Status_ArgumentValueInvalid")
+Identifier(u8"Arcadia_Status_ConversionFailed")
+Identifier(u8"Arcadia_Status_DivisionByZero")
+Identifier(u8"Arcadia_Status_Empty")
+Identifier(u8"Arcadia_Status_EncodingInvalid")
+Identifier(u8"Arcadia_Status_EnvironmentFailed")
+Identifier(u8"Arcadia_Status_Exists")
+Identifier(u8"Arcadia_Status_Found")
+Identifier(u8"Arcadia_Status_Full")
+Identifier(u8"Arcadia_Status_Initialized")
+Identifier(u8"Arcadia_Status_LexicalError")
+Identifier(u8"Arcadia_Status_NotEmpty")
+Identifier(u8"Arcadia_Status_NotExists")
+Identifier(u8"Arcadia_Status_NotFound")
+Identifier(u8"Arcadia_Status_NotImplemented")
+Identifier(u8"Arcadia_Status_NotInitialized")
+Identifier(u8"Arcadia_Status_NumberOfArgumentsInvalid")
+Identifier(u8"Arcadia_Status_OperationFailed")
+Identifier(u8"Arcadia_Status_OperationInvalid")
+Identifier(u8"Arcadia_Status_SemanticalError")
+Identifier(u8"Arcadia_Status_StackCorruption")
+Identifier(u8"Arcadia_Status_StackOverflow")
+Identifier(u8"Arcadia_Status_StackUnderflow")
+Identifier(u8"Arcadia_Status_Success")
+Identifier(u8"Arcadia_Status_SyntacticalError")
+Identifier(u8"Arcadia_Status_TestFailed")
+Identifier(u8"Arcadia_Status_TypeExists")
+Identifier(u8"Arcadia_Status_TypeNotExists")
+Identifier(u8"Arcadia_Status_Uninitialized")
+Identifier(u8"Arcadia_Status_ValueRaised")
+Identifier(u8"Arcadia_String")
+Identifier(u8"Arcadia_StringBuilder")
+Identifier(u8"Arcadia_StringBuilderDispatch")
+Identifier(u8"Arcadia_StringBuilder_ByteReader")
+Identifier(u8"Arcadia_StringBuilder_ByteReaderDispatch")
+Identifier(u8"Arcadia_StringBuilder_ByteReader_create")
+Identifier(u8"Arcadia_StringBuilder_clear")
+Identifier(u8"Arcadia_StringBuilder_compareTo")
+Identifier(u8"Arcadia_StringBuilder_create")
+Identifier(u8"Arcadia_StringBuilder_endsWith_pn")
+Identifier(u8"Arcadia_StringBuilder_getBytes")
+Identifier(u8"Arcadia_StringBuilder_getNumberOfBytes")
+Identifier(u8"Arcadia_StringBuilder_getNumberOfCodePoints")
+Identifier(u8"Arcadia_StringBuilder_insertAt")
+Identifier(u8"Arcadia_StringBuilder_insertBack")
+Identifier(u8"Arcadia_StringBuilder_insertBackCodePoint")
+Identifier(u8"Arcadia_StringBuilder_insertBackCodePoints")
+Identifier(u8"Arcadia_StringBuilder_insertBackCxxInt")
+Identifier(u8"Arcadia_StringBuilder_insertBackCxxString")
+Identifier(u8"Arcadia_StringBuilder_insertBackString")
+Identifier(u8"Arcadia_StringBuilder_insertFront")
+Identifier(u8"Arcadia_StringBuilder_insertFrontCodePoint")
+Identifier(u8"Arcadia_StringBuilder_insertFrontCodePoints")
+Identifier(u8"Arcadia_StringBuilder_insertFrontString")
+Identifier(u8"Arcadia_StringBuilder_removeCodePointsBack")
+Identifier(u8"Arcadia_StringBuilder_removeCodePointsFront")
+Identifier(u8"Arcadia_StringBuilder_startsWith_pn")
+Identifier(u8"Arcadia_StringBuilder_toLowerASCII")
+Identifier(u8"Arcadia_StringBuilder_toUpperASCII")
+Identifier(u8"Arcadia_StringDispatch")
+Identifier(u8"Arcadia_String_ByteReader")
+Identifier(u8"Arcadia_String_ByteReaderDispatch")
+Identifier(u8"Arcadia_String_ByteReader_create")
+Identifier(u8"Arcadia_String_create")
+Identifier(u8"Arcadia_String_createEmpty")
+Identifier(u8"Arcadia_String_createFromBoolean")
+Identifier(u8"Arcadia_String_createFromCxxInt")
+Identifier(u8"Arcadia_String_createFromCxxString")
+Identifier(u8"Arcadia_String_createFromInteger16")
+Identifier(u8"Arcadia_String_createFromInteger32")
+Identifier(u8"Arcadia_String_createFromInteger64")
+Identifier(u8"Arcadia_String_createFromInteger8")
+Identifier(u8"Arcadia_String_createFromNatural16")
+Identifier(u8"Arcadia_String_createFromNatural32")
+Identifier(u8"Arcadia_String_createFromNatural64")
+Identifier(u8"Arcadia_String_createFromNatural8")
+Identifier(u8"Arcadia_String_createFromReal32")
+Identifier(u8"Arcadia_String_createFromReal64")
+Identifier(u8"Arcadia_String_createFromSize")
+Identifier(u8"Arcadia_String_createFromVoid")
+Identifier(u8"Arcadia_String_create_pn")
+Identifier(u8"Arcadia_String_endsWith_pn")
+Identifier(u8"Arcadia_String_findFirstOccurrence")
+Identifier(u8"Arcadia_String_findLastOccurrence")
+Identifier(u8"Arcadia_String_getByteAt")
+Identifier(u8"Arcadia_String_getBytes")
+Identifier(u8"Arcadia_String_getNumberOfBytes")
+Identifier(u8"Arcadia_String_getNumberOfCodePoints")
+Identifier(u8"Arcadia_String_insertBackByteBuffer")
+Identifier(u8"Arcadia_String_insertByteBuffer")
+Identifier(u8"Arcadia_String_insertFrontByteBuffer")
+Identifier(u8"Arcadia_String_isEqualTo_pn")
+Identifier(u8"Arcadia_String_startsWith_pn")
+Identifier(u8"Arcadia_String_substring")
+Identifier(u8"Arcadia_String_toBoolean")
+Identifier(u8"Arcadia_String_toByteArray")
+Identifier(u8"Arcadia_String_toCxxInt")
+Identifier(u8"Arcadia_String_toInteger16")
+Identifier(u8"Arcadia_String_toInteger32")
+Identifier(u8"Arcadia_String_toInteger64")
+Identifier(u8"Arcadia_String_toInteger8")
+Identifier(u8"Arcadia_String_toNatural16")
+Identifier(u8"Arcadia_String_toNatural32")
+Identifier(u8"Arcadia_String_toNatural64")
+Identifier(u8"Arcadia_String_toNatural8")
+Identifier(u8"Arcadia_String_toReal32")
+Identifier(u8"Arcadia_String_toReal64")
+Identifier(u8"Arcadia_String_toVoid")
+Identifier(u8"Arcadia_Tests_UTF8_readWrite1")
+Identifier(u8"Arcadia_Tests_assertFalse")
+Identifier(u8"Arcadia_Tests_assertTrue")
+Identifier(u8"Arcadia_Tests_safeExecute")
+Identifier(u8"Arcadia_Thread")
+Identifier(u8"Arcadia_ThreadLocal")
+Identifier(u8"Arcadia_Thread_ensureValueStackFreeCapacity")
+Identifier(u8"Arcadia_Thread_getProcess")
+Identifier(u8"Arcadia_Thread_getRaisedValue")
+Identifier(u8"Arcadia_Thread_getStatus")
+Identifier(u8"Arcadia_Thread_increaseValueStackCapacity")
+Identifier(u8"Arcadia_Thread_initialize")
+Identifier(u8"Arcadia_Thread_initializeValueStack")
+Identifier(u8"Arcadia_Thread_jump")
+Identifier(u8"Arcadia_Thread_popJumpTarget")
+Identifier(u8"Arcadia_Thread_pushJumpTarget")
+Identifier(u8"Arcadia_Thread_raise")
+Identifier(u8"Arcadia_Thread_setRaisedValue")
+Identifier(u8"Arcadia_Thread_setStatus")
+Identifier(u8"Arcadia_Thread_uninitialize")
+Identifier(u8"Arcadia_Thread_uninitializeValueStack")
+Identifier(u8"Arcadia_TimeSpecification")
+Identifier(u8"Arcadia_TimeSpecification_LocalTime")
+Identifier(u8"Arcadia_TimeSpecification_Utc")
+Identifier(u8"Arcadia_TimeStamp_getNow")
+Identifier(u8"Arcadia_ToReal64_BitsToValue")
+Identifier(u8"Arcadia_ToReal64_Result")
+Identifier(u8"Arcadia_Type")
+Identifier(u8"Arcadia_TypeKind")
+Identifier(u8"Arcadia_TypeKind_Enumeration")
+Identifier(u8"Arcadia_TypeKind_Interface")
+Identifier(u8"Arcadia_TypeKind_Internal")
+Identifier(u8"Arcadia_TypeKind_Object")
+Identifier(u8"Arcadia_TypeKind_Scalar")
+Identifier(u8"Arcadia_TypeValue")
+Identifier(u8"Arcadia_Type_Operations")
+Identifier(u8"Arcadia_Type_Operations_Initializer")
+Identifier(u8"Arcadia_Type_TypeDestructingCallbackFunction")
+Identifier(u8"Arcadia_Type_getDestructObjectCallbackFunction")
+Identifier(u8"Arcadia_Type_getHash")
+Identifier(u8"Arcadia_Type_getKind")
+Identifier(u8"Arcadia_Type_getName")
+Identifier(u8"Arcadia_Type_getOperations")
+Identifier(u8"Arcadia_Type_getVisitObjectCallbackFunction")
+Identifier(u8"Arcadia_Type_hasChildren")
+Identifier(u8"Arcadia_Type_isDescendantType")
+Identifier(u8"Arcadia_Type_isEnumerationtKind")
+Identifier(u8"Arcadia_Type_isInterfacelKind")
+Identifier(u8"Arcadia_Type_isInternalKind")
+Identifier(u8"Arcadia_Type_isObjectKind")
+Identifier(u8"Arcadia_Type_isScalarKind")
+Identifier(u8"Arcadia_Type_visit")
+Identifier(u8"Arcadia_Types")
+Identifier(u8"Arcadia_UnicodeCodePointReader")
+Identifier(u8"Arcadia_UnicodeCodePointReaderDispatch")
+Identifier(u8"Arcadia_UnicodeCodePointReader_getByteRange")
+Identifier(u8"Arcadia_UnicodeCodePointReader_getValue")
+Identifier(u8"Arcadia_UnicodeCodePointReader_hasError")
+Identifier(u8"Arcadia_UnicodeCodePointReader_hasValue")
+Identifier(u8"Arcadia_UnicodeCodePointReader_nextValue")
+Identifier(u8"Arcadia_Unicode_CodePoint_Last")
+Identifier(u8"Arcadia_Unicode_EncodeCodePointCallbackContext")
+Identifier(u8"Arcadia_Unicode_EncodeCodePointCallbackFunction")
+Identifier(u8"Arcadia_Unicode_Encoder")
+Identifier(u8"Arcadia_Unicode_EncoderDispatch")
+Identifier(u8"Arcadia_Unicode_Encoder_encodeCodePoints")
+Identifier(u8"Arcadia_Unicode_Encoder_encodeImmutableByteArray")
+Identifier(u8"Arcadia_Unicode_Encoder_encodeRuntimeUTF8String")
+Identifier(u8"Arcadia_Unicode_Encoder_encodeString")
+Identifier(u8"Arcadia_Unicode_UTF8Encoder")
+Identifier(u8"Arcadia_Unicode_UTF8EncoderDispatch")
+Identifier(u8"Arcadia_Unicode_UTF8Encoder_create")
+Identifier(u8"Arcadia_Unicode_UTF8_classifyFirstByte")
+Identifier(u8"Arcadia_Unicode_UTF8_mapASCIIToASCII")
+Identifier(u8"Arcadia_Unicode_UTF8_toLowerASCII")
+Identifier(u8"Arcadia_Unicode_UTF8_toUpperASCII")
+Identifier(u8"Arcadia_Unicode_encodeBytesUTF8")
+Identifier(u8"Arcadia_Unicode_encodeCodePointsUTF8")
+Identifier(u8"Arcadia_Unicode_encodeCodePointsUtf32Be")
+Identifier(u8"Arcadia_Unicode_encodeCodePointsUtf32Le")
+Identifier(u8"Arcadia_Unicode_isUTF8")
+Identifier(u8"Arcadia_Unlikely")
+Identifier(u8"Arcadia_VPL_Symbols_Program")
+Identifier(u8"Arcadia_Value")
+Identifier(u8"Arcadia_ValueStack_get")
+Identifier(u8"Arcadia_ValueStack_getNatural8Value")
+Identifier(u8"Arcadia_ValueStack_getObjectReferenceValue")
+Identifier(u8"Arcadia_ValueStack_getObjectReferenceValueChecked")
+Identifier(u8"Arcadia_ValueStack_getSize")
+Identifier(u8"Arcadia_ValueStack_getValue")
+Identifier(u8"Arcadia_ValueStack_is")
+Identifier(u8"Arcadia_ValueStack_popValues")
+Identifier(u8"Arcadia_ValueStack_push")
+Identifier(u8"Arcadia_ValueStack_pushValue")
+Identifier(u8"Arcadia_ValueStack_reverse")
+Identifier(u8"Arcadia_ValueTag_")
+Identifier(u8"Arcadia_ValueTag_Atom")
+Identifier(u8"Arcadia_ValueTag_BigInteger")
+Identifier(u8"Arcadia_ValueTag_Boolean")
+Identifier(u8"Arcadia_ValueTag_Enumeration")
+Identifier(u8"Arcadia_ValueTag_ForeignProcedure")
+Identifier(u8"Arcadia_ValueTag_Integer16")
+Identifier(u8"Arcadia_ValueTag_Integer32")
+Identifier(u8"Arcadia_ValueTag_Integer64")
+Identifier(u8"Arcadia_ValueTag_Integer8")
+Identifier(u8"Arcadia_ValueTag_Natural16")
+Identifier(u8"Arcadia_ValueTag_Natural32")
+Identifier(u8"Arcadia_ValueTag_Natural64")
+Identifier(u8"Arcadia_ValueTag_Natural8")
+Identifier(u8"Arcadia_ValueTag_ObjectReference")
+Identifier(u8"Arcadia_ValueTag_Real32")
+Identifier(u8"Arcadia_ValueTag_Real64")
+Identifier(u8"Arcadia_ValueTag_RuntimeByteArray")
+Identifier(u8"Arcadia_ValueTag_RuntimeUTF8String")
+Identifier(u8"Arcadia_ValueTag_Size")
+Identifier(u8"Arcadia_ValueTag_Type")
+Identifier(u8"Arcadia_ValueTag_Void")
+Identifier(u8"Arcadia_Value_Initializer")
+Identifier(u8"Arcadia_Value_get")
+Identifier(u8"Arcadia_Value_getBooleanValue")
+Identifier(u8"Arcadia_Value_getHash")
+Identifier(u8"Arcadia_Value_getInteger32Value")
+Identifier(u8"Arcadia_Value_getInteger64Value")
+Identifier(u8"Arcadia_Value_getNatural16Value")
+Identifier(u8"Arcadia_Value_getNatural32Value")
+Identifier(u8"Arcadia_Value_getNatural64Value")
+Identifier(u8"Arcadia_Value_getObjectReferenceValue")
+Identifier(u8"Arcadia_Value_getObjectReferenceValueChecked")
+Identifier(u8"Arcadia_Value_getRuntimeUTF8StringValue")
+Identifier(u8"Arcadia_Value_getTag")
+Identifier(u8"Arcadia_Value_getType")
+Identifier(u8"Arcadia_Value_is")
+Identifier(u8"Arcadia_Value_isBooleanValue")
+Identifier(u8"Arcadia_Value_isEqualTo")
+Identifier(u8"Arcadia_Value_isGreaterThan")
+Identifier(u8"Arcadia_Value_isGreaterThanOrEqualTo")
+Identifier(u8"Arcadia_Value_isInstanceOf")
+Identifier(u8"Arcadia_Value_isInteger32Value")
+Identifier(u8"Arcadia_Value_isInteger64Value")
+Identifier(u8"Arcadia_Value_isLowerThan")
+Identifier(u8"Arcadia_Value_isLowerThanOrEqualTo")
+Identifier(u8"Arcadia_Value_isNatural16Value")
+Identifier(u8"Arcadia_Value_isNatural32Value")
+Identifier(u8"Arcadia_Value_isNatural64Value")
+Identifier(u8"Arcadia_Value_isNotEqualTo")
+Identifier(u8"Arcadia_Value_isObjectReferenceValue")
+Identifier(u8"Arcadia_Value_isRuntimeUTF8StringValue")
+Identifier(u8"Arcadia_Value_isVoidValue")
+Identifier(u8"Arcadia_Value_make")
+Identifier(u8"Arcadia_Value_set")
+Identifier(u8"Arcadia_Value_visit")
+Identifier(u8"Arcadia_VirtualCall")
+Identifier(u8"Arcadia_VirtualCallWithReturn")
+Identifier(u8"Arcadia_Visuals_ApplicationEvent")
+Identifier(u8"Arcadia_Visuals_ApplicationEventDispatch")
+Identifier(u8"Arcadia_Visuals_ApplicationQuitRequestedEvent")
+Identifier(u8"Arcadia_Visuals_ApplicationQuitRequestedEventDispatch")
+Identifier(u8"Arcadia_Visuals_ApplicationQuitRequestedEvent_create")
+Identifier(u8"Arcadia_Visuals_CanvasActivationStateChangedEvent")
+Identifier(u8"Arcadia_Visuals_CanvasActivationStateChangedEventDispatch")
+Identifier(u8"Arcadia_Visuals_CanvasDPIChangedEvent")
+Identifier(u8"Arcadia_Visuals_CanvasDPIChangedEventDispatch")
+Identifier(u8"Arcadia_Visuals_CanvasEvent")
+Identifier(u8"Arcadia_Visuals_CanvasEventDispatch")
+Identifier(u8"Arcadia_Visuals_CanvasSizeChangedEvent")
+Identifier(u8"Arcadia_Visuals_CanvasSizeChangedEventDispatch")
+Identifier(u8"Arcadia_Visuals_Configuration")
+Identifier(u8"Arcadia_Visuals_ConfigurationDispatch")
+Identifier(u8"Arcadia_Visuals_Configuration_create")
+Identifier(u8"Arcadia_Visuals_Diagnostics_dumpDevices")
+Identifier(u8"Arcadia_Visuals_KeyboardKey")
+Identifier(u8"Arcadia_Visuals_KeyboardKeyAction")
+Identifier(u8"Arcadia_Visuals_KeyboardKeyAction_Pressed")
+Identifier(u8"Arcadia_Visuals_KeyboardKeyAction_Released")
+Identifier(u8"Arcadia_Visuals_KeyboardKeyEvent")
+Identifier(u8"Arcadia_Visuals_KeyboardKeyEventDispatch")
+Identifier(u8"Arcadia_Visuals_KeyboardKeyEvent_create")
+Identifier(u8"Arcadia_Visuals_KeyboardKeyEvent_getAction")
+Identifier(u8"Arcadia_Visuals_KeyboardKeyEvent_getKey")
+Identifier(u8"Arcadia_Visuals_KeyboardKey_")
+Identifier(u8"Arcadia_Visuals_KeyboardKey_toString")
+Identifier(u8"Arcadia_Visuals_MouseButtonAction")
+Identifier(u8"Arcadia_Visuals_MouseButtonAction_Pressed")
+Identifier(u8"Arcadia_Visuals_MouseButtonAction_Released")
+Identifier(u8"Arcadia_Visuals_MouseButtonEvent")
+Identifier(u8"Arcadia_Visuals_MouseButtonEventDispatch")
+Identifier(u8"Arcadia_Visuals_MouseButtonEvent_create")
+Identifier(u8"Arcadia_Visuals_MousePointerAction")
+Identifier(u8"Arcadia_Visuals_MousePointerAction_Entered")
+Identifier(u8"Arcadia_Visuals_MousePointerAction_Exited")
+Identifier(u8"Arcadia_Visuals_MousePointerAction_Moved")
+Identifier(u8"Arcadia_Visuals_MousePointerEvent")
+Identifier(u8"Arcadia_Visuals_MousePointerEventDispatch")
+Identifier(u8"Arcadia_Visuals_MousePointerEvent_create")
+Identifier(u8"Arcadia_Void")
+Identifier(u8"Arcadia_VoidValue")
+Identifier(u8"Arcadia_VoidValue_NumberOfBits")
+Identifier(u8"Arcadia_VoidValue_NumberOfBytes")
+Identifier(u8"Arcadia_VoidValue_Void")
+Identifier(u8"Arcadia_VoidValue_toUTF8String")
+Identifier(u8"Arcadia_WeakReference")
+Identifier(u8"Arcadia_WeakReferenceDispatch")
+Identifier(u8"Arcadia_WeakReference_create")
+Identifier(u8"Arcadia_WeakReference_getValue")
+Identifier(u8"Arcadia_ceilReal32Value")
+Identifier(u8"Arcadia_ceilReal64Value")
+Identifier(u8"Arcadia_clamp")
+Identifier(u8"Arcadia_clingerReal64")
+Identifier(u8"Arcadia_computeProductApproximation")
+Identifier(u8"Arcadia_cosReal32Value")
+Identifier(u8"Arcadia_cosReal64Value")
+Identifier(u8"Arcadia_countLeadingZeroes")
+Identifier(u8"Arcadia_countSignificandBits")
+Identifier(u8"Arcadia_countTrailingZeroes")
+Identifier(u8"Arcadia_declareEnumerationType")
+Identifier(u8"Arcadia_declareObjectType")
+Identifier(u8"Arcadia_declareScalarType")
+Identifier(u8"Arcadia_defineEnumerationType")
+Identifier(u8"Arcadia_defineObjectType")
+Identifier(u8"Arcadia_defineScalarType")
+Identifier(u8"Arcadia_floorReal32Value")
+Identifier(u8"Arcadia_floorReal64Value")
+Identifier(u8"Arcadia_gayReal64")
+Identifier(u8"Arcadia_getNumberOfCores")
+Identifier(u8"Arcadia_getPageSize")
+Identifier(u8"Arcadia_getTickCount")
+Identifier(u8"Arcadia_getType")
+Identifier(u8"Arcadia_hashAtomValue")
+Identifier(u8"Arcadia_hashBytes")
+Identifier(u8"Arcadia_hashTypeValue")
+Identifier(u8"Arcadia_isDivisibleByPowerOfFiveNatural16")
+Identifier(u8"Arcadia_isDivisibleByPowerOfFiveNatural32")
+Identifier(u8"Arcadia_isDivisibleByPowerOfFiveNatural64")
+Identifier(u8"Arcadia_isDivisibleByPowerOfFiveNatural8")
+Identifier(u8"Arcadia_isPowerOfTwoInteger16Value")
+Identifier(u8"Arcadia_isPowerOfTwoInteger32Value")
+Identifier(u8"Arcadia_isPowerOfTwoInteger64Value")
+Identifier(u8"Arcadia_isPowerOfTwoInteger8Value")
+Identifier(u8"Arcadia_isPowerOfTwoNatural16Value")
+Identifier(u8"Arcadia_isPowerOfTwoNatural32Value")
+Identifier(u8"Arcadia_isPowerOfTwoNatural64Value")
+Identifier(u8"Arcadia_isPowerOfTwoNatural8Value")
+Identifier(u8"Arcadia_isPowerOfTwoSizeValue")
+Identifier(u8"Arcadia_lemireReal64")
+Identifier(u8"Arcadia_logf")
+Identifier(u8"Arcadia_logfv")
+Identifier(u8"Arcadia_makeBitmaskN16")
+Identifier(u8"Arcadia_makeBitmaskN32")
+Identifier(u8"Arcadia_makeBitmaskN64")
+Identifier(u8"Arcadia_makeBitmaskN8")
+Identifier(u8"Arcadia_maximum")
+Identifier(u8"Arcadia_minimum")
+Identifier(u8"Arcadia_nextPowerOfTwoGreaterThan")
+Identifier(u8"Arcadia_nextPowerOfTwoGreaterThanOrEqualTo")
+Identifier(u8"Arcadia_parseNumberLiteral")
+Identifier(u8"Arcadia_power")
+Identifier(u8"Arcadia_print")
+Identifier(u8"Arcadia_quotientRemainderInteger16")
+Identifier(u8"Arcadia_quotientRemainderInteger64")
+Identifier(u8"Arcadia_quotientRemainderInteger8")
+Identifier(u8"Arcadia_quotientRemainderIntegerl32")
+Identifier(u8"Arcadia_quotientRemainderNatural16")
+Identifier(u8"Arcadia_quotientRemainderNatural32")
+Identifier(u8"Arcadia_quotientRemainderNatural64")
+Identifier(u8"Arcadia_quotientRemainderNatural8")
+Identifier(u8"Arcadia_registerEnumerationType")
+Identifier(u8"Arcadia_registerInterfaceType")
+Identifier(u8"Arcadia_registerInternalType")
+Identifier(u8"Arcadia_registerObjectType")
+Identifier(u8"Arcadia_registerScalarType")
+Identifier(u8"Arcadia_safeAddFullInteger16Value")
+Identifier(u8"Arcadia_safeAddFullInteger32Value")
+Identifier(u8"Arcadia_safeAddFullInteger64Value")
+Identifier(u8"Arcadia_safeAddFullInteger8Value")
+Identifier(u8"Arcadia_safeAddFullNatural16Value")
+Identifier(u8"Arcadia_safeAddFullNatural32Value")
+Identifier(u8"Arcadia_safeAddFullNatural64Value")
+Identifier(u8"Arcadia_safeAddFullNatural8Value")
+Identifier(u8"Arcadia_safeAddFullSizeValue")
+Identifier(u8"Arcadia_safeAddInteger16Value")
+Identifier(u8"Arcadia_safeAddInteger32Value")
+Identifier(u8"Arcadia_safeAddInteger64Value")
+Identifier(u8"Arcadia_safeAddInteger8Value")
+Identifier(u8"Arcadia_safeMultiplyInteger16Value")
+Identifier(u8"Arcadia_safeMultiplyInteger32Value")
+Identifier(u8"Arcadia_safeMultiplyInteger64Value")
+Identifier(u8"Arcadia_safeMultiplyInteger8Value")
+Identifier(u8"Arcadia_safeMultiplyNatural16Value")
+Identifier(u8"Arcadia_safeMultiplyNatural32Value")
+Identifier(u8"Arcadia_safeMultiplyNatural64Value")
+Identifier(u8"Arcadia_safeMultiplyNatural8Value")
+Identifier(u8"Arcadia_safeMultiplySizeValue")
+Identifier(u8"Arcadia_sinReal32Value")
+Identifier(u8"Arcadia_sinReal64Value")
+Identifier(u8"Arcadia_sqrtReal32Value")
+Identifier(u8"Arcadia_sqrtReal64Value")
+Identifier(u8"Arcadia_superTypeConstructor")
+Identifier(u8"Arcadia_swap")
+Identifier(u8"Arcadia_swapPointer")
+Identifier(u8"Arcadia_swapSize")
+Identifier(u8"Arcadia_tanReal32Value")
+Identifier(u8"Arcadia_tanReal64Value")
+Identifier(u8"Arcadia_toInteger16")
+Identifier(u8"Arcadia_toInteger32")
+Identifier(u8"Arcadia_toInteger64")
+Identifier(u8"Arcadia_toInteger8")
+Identifier(u8"Arcadia_toNatural16")
+Identifier(u8"Arcadia_toNatural32")
+Identifier(u8"Arcadia_toNatural64")
+Identifier(u8"Arcadia_toNatural8")
+Identifier(u8"Arcadia_toReal32")
+Identifier(u8"Arcadia_toReal64")
+Identifier(u8"ArgumentsValidation")
+Identifier(u8"ArrayDeque")
+Identifier(u8"ArrayList")
+Identifier(u8"ArrayStack")
+Identifier(u8"AtomValue")
+Identifier(u8"BackendContext")
+Identifier(u8"BigInteger")
+Identifier(u8"BigIntegerValue")
+Identifier(u8"BooleanValue")
+Identifier(u8"ByteArray")
+Identifier(u8"ByteArrayBuilder")
+Identifier(u8"ByteArrayDefaultImpl")
+Identifier(u8"ByteArraySliceImpl")
+Identifier(u8"ByteReader")
+Identifier(u8"CameraNode")
+Identifier(u8"CanvasActivationStateChangedEvent")
+Identifier(u8"CanvasDPIChangedEvent")
+Identifier(u8"CanvasEvent")
+Identifier(u8"CanvasSizeChangedEvent")
+Identifier(u8"CheckerboardFill")
+Identifier(u8"CodePoint_End")
+Identifier(u8"CodePoint_Error")
+Identifier(u8"CodePoint_Start")
+Identifier(u8"CommandLine")
+Identifier(u8"CommandLineArgument")
+Identifier(u8"ConsoleLog")
+Identifier(u8"ConstantBufferResource")
+Identifier(u8"Core_Compiler_C")
+Identifier(u8"Core_Compiler_C_Msvc")
+Identifier(u8"CullMode")
+Identifier(u8"Cxx_fatalError")
+Identifier(u8"Cxx_staticAssert")
+Identifier(u8"DBL_MANT_DIG")
+Identifier(u8"DBL_MAX")
+Identifier(u8"DefaultFileHandle")
+Identifier(u8"DefaultFileSystem")
+Identifier(u8"DepthCompareFunction")
+Identifier(u8"DiagnosticType")
+Identifier(u8"DiagnosticsOld")
+Identifier(u8"DirectoryITerator")
+Identifier(u8"DirectoryIterator")
+Identifier(u8"DirectoryIteratorLinux")
+Identifier(u8"DirectoryIteratorWindows")
+Identifier(u8"DisplayDevice")
+Identifier(u8"DisplayMode")
+Identifier(u8"DynamicTypeSystem")
+Identifier(u8"EXIT_FAILURE")
+Identifier(u8"EnterPassNode")
+Identifier(u8"EnterPassResource")
+Identifier(u8"EnumerationTypeNode")
+Identifier(u8"EnumerationTypeNodeName")
+Identifier(u8"EnumerationTypeNode_allocate")
+Identifier(u8"EnumerationValue")
+Identifier(u8"ExistingFilePolicy")
+Identifier(u8"FLT_MANT_DIG")
+Identifier(u8"FLT_MAX")
+Identifier(u8"FileAccessMode")
+Identifier(u8"FileHandle")
+Identifier(u8"FileHandleExtensions")
+Identifier(u8"FileLog")
+Identifier(u8"FileMapping")
+Identifier(u8"FileMappingLinux")
+Identifier(u8"FileMappingWindows")
+Identifier(u8"FilePath")
+Identifier(u8"FileSystem")
+Identifier(u8"FileType")
+Identifier(u8"FillMode")
+Identifier(u8"ForeignProcedure")
+Identifier(u8"ForeignProcedureValue")
+Identifier(u8"FrameBufferNode")
+Identifier(u8"FrameBufferResource")
+Identifier(u8"HashMap")
+Identifier(u8"HashSet")
+Identifier(u8"INT16_C")
+Identifier(u8"INT16_MAX")
+Identifier(u8"INT16_MIN")
+Identifier(u8"INT32_C")
+Identifier(u8"INT32_MAX")
+Identifier(u8"INT32_MIN")
+Identifier(u8"INT64_C")
+Identifier(u8"INT64_MAX")
+Identifier(u8"INT64_MIN")
+Identifier(u8"INT8_C")
+Identifier(u8"INT8_MAX")
+Identifier(u8"INT8_MIN")
+Identifier(u8"INT_MAX")
+Identifier(u8"ImmutableByteArray")
+Identifier(u8"ImmutableHashMap")
+Identifier(u8"ImmutableList")
+Identifier(u8"ImmutableMap")
+Identifier(u8"ImmutableSet")
+Identifier(u8"ImmutableUTF8String")
+Identifier(u8"ImmutableUTF8StringExtensions")
+Identifier(u8"InterfaceTypeNode")
+Identifier(u8"InterfaceTypeNodeName")
+Identifier(u8"InterfaceTypeNode_allocate")
+Identifier(u8"InternalTypeNode")
+Identifier(u8"InternalTypeNodeName")
+Identifier(u8"InternalTypeNode_allocate")
+Identifier(u8"KeyboardKey")
+Identifier(u8"KeyboardKeyAction")
+Identifier(u8"KeyboardKeyEvent")
+Identifier(u8"LogCategory")
+Identifier(u8"MaterialNode")
+Identifier(u8"MaterialResource")
+Identifier(u8"MaximumNumberOfSlots")
+Identifier(u8"MemoryManager")
+Identifier(u8"MeshNode")
+Identifier(u8"ModelNode")
+Identifier(u8"ModelResource")
+Identifier(u8"ModuleInfo")
+Identifier(u8"MouseButtonAction")
+Identifier(u8"MouseButtonEvent")
+Identifier(u8"MousePointerAction")
+Identifier(u8"MousePointerEvent")
+Identifier(u8"NoReturn")
+Identifier(u8"NodeFactory")
+Identifier(u8"NonExistingFilePolicy")
+Identifier(u8"NotifyDestroy")
+Identifier(u8"NumberLiteral")
+Identifier(u8"NumberOfByes")
+Identifier(u8"NumberOfBytes")
+Identifier(u8"ObjectReference")
+Identifier(u8"ObjectReferenceValue")
+Identifier(u8"ObjectTypeNode")
+Identifier(u8"ObjectTypeNodeName")
+Identifier(u8"ObjectTypeNode_allocate")
+Identifier(u8"OpenAL")
+Identifier(u8"PixelBuffer")
+Identifier(u8"PixelBufferIO")
+Identifier(u8"PixelBufferNode")
+Identifier(u8"PixelBufferOperation")
+Identifier(u8"PixelBufferOperations")
+Identifier(u8"PixelFormat")
+Identifier(u8"PixelOperation")
+Identifier(u8"PointInTime")
+Identifier(u8"ProcessExtensions")
+Identifier(u8"ProgramResource")
+Identifier(u8"R_INTEGER64VALUE_H_INCLUDED")
+Identifier(u8"Real32ToString")
+Identifier(u8"Real32_getBits")
+Identifier(u8"Real32_isFinite")
+Identifier(u8"Real64ToString")
+Identifier(u8"Real64_getBits")
+Identifier(u8"Real64_isFinite")
+Identifier(u8"RealToString")
+Identifier(u8"RenderScene")
+Identifier(u8"RuntimeByteArray")
+Identifier(u8"RuntimeByteArrayValue")
+Identifier(u8"RuntimeUTF8String")
+Identifier(u8"RuntimeUTF8StringValue")
+Identifier(u8"SIZE_MAX")
+Identifier(u8"SampleBuffer")
+Identifier(u8"SampleFormat")
+Identifier(u8"SampleStream")
+Identifier(u8"SawtoothWave")
+Identifier(u8"ScalarTypeNode")
+Identifier(u8"ScalarTypeNodeName")
+Identifier(u8"ScalarTypeNode_allocate")
+Identifier(u8"SineWave")
+Identifier(u8"SizeType")
+Identifier(u8"SizeValue")
+Identifier(u8"SocketType")
+Identifier(u8"SoundSourceNode")
+Identifier(u8"SoundSourceResource")
+Identifier(u8"StaticAssert")
+Identifier(u8"StatusType")
+Identifier(u8"StreamingSoundSourceResource")
+Identifier(u8"StringBuilder")
+Identifier(u8"StringExtensions")
+Identifier(u8"StringTable")
+Identifier(u8"StringToInteger")
+Identifier(u8"StringToNatural")
+Identifier(u8"StringToReal")
+Identifier(u8"TextureAddressMode")
+Identifier(u8"TextureFilter")
+Identifier(u8"TextureNode")
+Identifier(u8"TextureResource")
+Identifier(u8"ThreadExtensions")
+Identifier(u8"ThreadLocal")
+Identifier(u8"TimeSpecification")
+Identifier(u8"TypeFunctions")
+Identifier(u8"TypeKind")
+Identifier(u8"TypeName")
+Identifier(u8"TypeNode")
+Identifier(u8"TypeNodeName")
+Identifier(u8"TypeNodes")
+Identifier(u8"TypeSystem")
+Identifier(u8"TypeValue")
+Identifier(u8"UINT16_")
+Identifier(u8"UINT16_C")
+Identifier(u8"UINT16_MAX")
+Identifier(u8"UINT32_")
+Identifier(u8"UINT32_C")
+Identifier(u8"UINT32_MAX")
+Identifier(u8"UINT64_C")
+Identifier(u8"UINT64_MAX")
+Identifier(u8"UINT8_")
+Identifier(u8"UINT8_C")
+Identifier(u8"UINT8_MAX")
+Identifier(u8"UTF8ArrayIterator")
+Identifier(u8"UnicodeCodePointReader")
+Identifier(u8"ValueAt")
+Identifier(u8"Value_getType")
+Identifier(u8"VertexBuffer")
+Identifier(u8"VertexBufferResource")
+Identifier(u8"VertexDescriptor")
+Identifier(u8"VertexDescriptorBuilder")
+Identifier(u8"VertexElementDescriptor")
+Identifier(u8"VertexElementSemantics")
+Identifier(u8"VertexElementSyntactics")
+Identifier(u8"ViewportNode")
+Identifier(u8"VoidValue")
+Identifier(u8"WIN32_FIND_DATAA")
+Identifier(u8"WIN32_LEAN_AND_MEAN")
+Identifier(u8"WeakReference")
+Identifier(u8"WhiteNoise")
+Identifier(u8"WindingMode")
+Identifier(u8"WindowBackend")
+Identifier(u8"WindowClosedEvent")
+Identifier(u8"WindowPositionChangedEvent")
+Identifier(u8"WindowSizeChangedEvent")
+Identifier(u8"_Alignof")
+Identifier(u8"_Arcadia_AtomValue_getType")
+Identifier(u8"_Arcadia_BigIntegerValue_getType")
+Identifier(u8"_Arcadia_BigInteger_stripLeadingZeroes")
+Identifier(u8"_Arcadia_HashMap_Node")
+Identifier(u8"_Arcadia_HashSet_Node")
+Identifier(u8"_Arcadia_ImmutableHashMap_Node")
+Identifier(u8"_Arcadia_Memory_getType")
+Identifier(u8"_Arcadia_Object_getType")
+Identifier(u8"_Arcadia_RuntimeByteArrayValue_getType")
+Identifier(u8"_Arcadia_RuntimeUTF8StringValue_getType")
+Identifier(u8"_Arcadia_Type_getType")
+Identifier(u8"_Arcadia_UTF8ArrayIterator")
+Identifier(u8"_Arcadia_UTF8ArrayIterator_getByteIndex")
+Identifier(u8"_Arcadia_UTF8ArrayIterator_getCodePoint")
+Identifier(u8"_Arcadia_UTF8ArrayIterator_getCodePointIndex")
+Identifier(u8"_Arcadia_UTF8ArrayIterator_getCodePointLength")
+Identifier(u8"_Arcadia_UTF8ArrayIterator_getNumberOfCodePoints")
+Identifier(u8"_Arcadia_UTF8ArrayIterator_hasCodePoint")
+Identifier(u8"_Arcadia_UTF8ArrayIterator_hasError")
+Identifier(u8"_Arcadia_UTF8ArrayIterator_initialize")
+Identifier(u8"_Arcadia_UTF8ArrayIterator_next")
+Identifier(u8"_Arcadia_UTF8ArrayIterator_uninitialize")
+Identifier(u8"_DEBUG")
+Identifier(u8"_State")
+Identifier(u8"_State_init")
+Identifier(u8"_State_uninit")
+Identifier(u8"_Static_assert")
+Identifier(u8"_Unicode_CodePoint_End")
+Identifier(u8"_Unicode_CodePoint_Error")
+Identifier(u8"_Unicode_CodePoint_Last")
+Identifier(u8"_Unicode_CodePoint_Start")
+Identifier(u8"__FILE__")
+Identifier(u8"__LINE__")
+Identifier(u8"__STDC_VERSION__")
+Identifier(u8"__VA_ARGS__")
+Identifier(u8"__attribute__")
+Identifier(u8"__builtin_expect")
+Identifier(u8"__declspec")
+Identifier(u8"__thread")
+Identifier(u8"_cName")
+Identifier(u8"_cParentName")
+Identifier(u8"_cTypeOperations")
+Identifier(u8"_cilName")
+Identifier(u8"_cilParentName")
+Identifier(u8"_createFromBytes")
+Identifier(u8"_declareScalarType")
+Identifier(u8"_ensureTypeRegistered")
+Identifier(u8"_getModule")
+Identifier(u8"_getType")
+Identifier(u8"_hashUTF8")
+Identifier(u8"_moduleInfo")
+Identifier(u8"_numberOfArguments")
+Identifier(u8"_onFinalize")
+Identifier(u8"_onPreMark")
+Identifier(u8"_onShutDown")
+Identifier(u8"_onStartUp")
+Identifier(u8"_onVisit")
+Identifier(u8"_parent")
+Identifier(u8"_self")
+Identifier(u8"_thread")
+Identifier(u8"_toBoolean")
+Identifier(u8"_toInteger16")
+Identifier(u8"_toInteger32")
+Identifier(u8"_toInteger64")
+Identifier(u8"_toInteger8")
+Identifier(u8"_toNatural16")
+Identifier(u8"_toNatural32")
+Identifier(u8"_toNatural64")
+Identifier(u8"_toNatural8")
+Identifier(u8"_toReal32")
+Identifier(u8"_toReal64")
+Identifier(u8"_toSize")
+Identifier(u8"_toVoid")
+Identifier(u8"_type")
+Identifier(u8"_typeDestructing")
+Identifier(u8"additionalCapacity")
+Identifier(u8"addressMode")
+Identifier(u8"addressModeU")
+Identifier(u8"addressModeV")
+Identifier(u8"alBufferID")
+Identifier(u8"alBufferIDs")
+Identifier(u8"alFreeBufferIDs")
+Identifier(u8"alSourceID")
+Identifier(u8"alcContext")
+Identifier(u8"alcDevice")
+Identifier(u8"allNext")
+Identifier(u8"alphaBits")
+Identifier(u8"ambientColor")
+Identifier(u8"ambientColorSource")
+Identifier(u8"ambientColorTexture")
+Identifier(u8"ambientTexture")
+Identifier(u8"appendZeroTerminator")
+Identifier(u8"audialsBackendContext")
+Identifier(u8"audialsBackendTypes")
+Identifier(u8"audialsNodeFactory")
+Identifier(u8"audialsNodeFactoryTypes")
+Identifier(u8"backendContext")
+Identifier(u8"baseColor")
+Identifier(u8"beginRender")
+Identifier(u8"bigIcon")
+Identifier(u8"bigInteger")
+Identifier(u8"blueBits")
+Identifier(u8"booleanValue")
+Identifier(u8"byteArray")
+Identifier(u8"byteBuffer")
+Identifier(u8"byteIndex")
+Identifier(u8"bytesRead")
+Identifier(u8"bytesToRead")
+Identifier(u8"bytesToWrite")
+Identifier(u8"bytesWritten")
+Identifier(u8"cName")
+Identifier(u8"cameraNode")
+Identifier(u8"canvasSize")
+Identifier(u8"cilName")
+Identifier(u8"clearColor")
+Identifier(u8"clearColorBuffer")
+Identifier(u8"clearDepth")
+Identifier(u8"clearDepthBuffer")
+Identifier(u8"codePoint")
+Identifier(u8"codePointByteIndex")
+Identifier(u8"codePointByteLength")
+Identifier(u8"codePointIndex")
+Identifier(u8"codePointLength")
+Identifier(u8"codePoints")
+Identifier(u8"colorBuffer")
+Identifier(u8"colorEnabled")
+Identifier(u8"compareByMagnitudeTo")
+Identifier(u8"compareTo")
+Identifier(u8"constantBuffer")
+Identifier(u8"constantBufferResource")
+Identifier(u8"countLeadingZeroes")
+Identifier(u8"countSignificandBits")
+Identifier(u8"countTrailingZeroes")
+Identifier(u8"createBackendContext")
+Identifier(u8"createCameraNode")
+Identifier(u8"createConstantBufferResource")
+Identifier(u8"createDirectoryFile")
+Identifier(u8"createDirectoryIterator")
+Identifier(u8"createEnterPassNode")
+Identifier(u8"createEnterPassResource")
+Identifier(u8"createFileHandle")
+Identifier(u8"createFrameBufferNode")
+Identifier(u8"createFrameBufferResource")
+Identifier(u8"createIcon")
+Identifier(u8"createMaterialNode")
+Identifier(u8"createMaterialResource")
+Identifier(u8"createMeshNode")
+Identifier(u8"createModelNode")
+Identifier(u8"createModelResource")
+Identifier(u8"createPixelBufferNode")
+Identifier(u8"createProgramResource")
+Identifier(u8"createRegularFile")
+Identifier(u8"createSoundSourceNode")
+Identifier(u8"createSoundSourceResource")
+Identifier(u8"createStreamingSoundSourceResource")
+Identifier(u8"createTextureNode")
+Identifier(u8"createTextureResource")
+Identifier(u8"createVertexBufferResource")
+Identifier(u8"createViewportNode")
+Identifier(u8"createWindow")
+Identifier(u8"deleteDirectoryFile")
+Identifier(u8"deleteFile")
+Identifier(u8"deleteRegularFile")
+Identifier(u8"depthBits")
+Identifier(u8"depthBuffer")
+Identifier(u8"directoryFileExists")
+Identifier(u8"dirtyBits")
+Identifier(u8"dirtyFlags")
+Identifier(u8"dispatchSize")
+Identifier(u8"elementSize")
+Identifier(u8"encodeCodePoints")
+Identifier(u8"encodeImmutableByteArray")
+Identifier(u8"encodeRuntimeUTF8String")
+Identifier(u8"encodeString")
+Identifier(u8"endRender")
+Identifier(u8"enterPassNode")
+Identifier(u8"enterPassResource")
+Identifier(u8"equalTo")
+Identifier(u8"exponentTruncated")
+Identifier(u8"fastFlow")
+Identifier(u8"fileHandle")
+Identifier(u8"fileNames")
+Identifier(u8"fileSystem")
+Identifier(u8"findFirstOccurrenceTests1")
+Identifier(u8"findFirstOccurrenceTests2")
+Identifier(u8"findFirstOccurrenceTests3")
+Identifier(u8"findLastOccurrenceTests1")
+Identifier(u8"findLastOccurrenceTests2")
+Identifier(u8"findLastOccurrenceTests3")
+Identifier(u8"foreignProcedure")
+Identifier(u8"frameBuffer")
+Identifier(u8"frameBufferNode")
+Identifier(u8"frameBufferResource")
+Identifier(u8"fromDecimalString")
+Identifier(u8"fromTwosComplement")
+Identifier(u8"getAddressModeU")
+Identifier(u8"getAddressModeV")
+Identifier(u8"getAll")
+Identifier(u8"getAt")
+Identifier(u8"getAvailableDisplayModes")
+Identifier(u8"getBack")
+Identifier(u8"getBigIcon")
+Identifier(u8"getBitLength")
+Identifier(u8"getBounds")
+Identifier(u8"getByteRange")
+Identifier(u8"getBytes")
+Identifier(u8"getCanvasSize")
+Identifier(u8"getClearColor")
+Identifier(u8"getClearColorBuffer")
+Identifier(u8"getClearDepth")
+Identifier(u8"getClearDepthBuffer")
+Identifier(u8"getColorDepth")
+Identifier(u8"getConfigurationDirectory")
+Identifier(u8"getCurrentDisplayMode")
+Identifier(u8"getDaysInMonth")
+Identifier(u8"getDiagnostics")
+Identifier(u8"getDisplayDevices")
+Identifier(u8"getExecutable")
+Identifier(u8"getFileContents")
+Identifier(u8"getFileType")
+Identifier(u8"getFrequency")
+Identifier(u8"getFront")
+Identifier(u8"getFullscreen")
+Identifier(u8"getHash")
+Identifier(u8"getHashFunction")
+Identifier(u8"getHeight")
+Identifier(u8"getHigh64")
+Identifier(u8"getHorizontalResolution")
+Identifier(u8"getId")
+Identifier(u8"getInput")
+Identifier(u8"getIsLooping")
+Identifier(u8"getKeys")
+Identifier(u8"getLastWriteTime")
+Identifier(u8"getMagnificationFilter")
+Identifier(u8"getMessage")
+Identifier(u8"getMinificationFilter")
+Identifier(u8"getName")
+Identifier(u8"getNumberOVertices")
+Identifier(u8"getNumberOfBytes")
+Identifier(u8"getNumberOfUnderruns")
+Identifier(u8"getPosition")
+Identifier(u8"getRelativeViewportRectangle")
+Identifier(u8"getRequiredBigIconSize")
+Identifier(u8"getRequiredSmallIconSize")
+Identifier(u8"getSaveDirectory")
+Identifier(u8"getSize")
+Identifier(u8"getSmallIcon")
+Identifier(u8"getStringTable")
+Identifier(u8"getTickCount")
+Identifier(u8"getTitle")
+Identifier(u8"getValue")
+Identifier(u8"getValues")
+Identifier(u8"getVerticalResolution")
+Identifier(u8"getViewToProjectionMatrix")
+Identifier(u8"getVolume")
+Identifier(u8"getWidth")
+Identifier(u8"getWordLength")
+Identifier(u8"getWordStart")
+Identifier(u8"getWordText")
+Identifier(u8"getWordType")
+Identifier(u8"getWorkingDirectory")
+Identifier(u8"getWorldToViewMatrix")
+Identifier(u8"grayNext")
+Identifier(u8"greaterThan")
+Identifier(u8"greaterThanOrEqualTo")
+Identifier(u8"greenBits")
+Identifier(u8"hasError")
+Identifier(u8"hasValue")
+Identifier(u8"hashValue")
+Identifier(u8"horizontalDpi")
+Identifier(u8"horizontalPosition")
+Identifier(u8"horizontalSize")
+Identifier(u8"immutableUTF8String")
+Identifier(u8"immutableUTF8StringValue")
+Identifier(u8"inWindow")
+Identifier(u8"initializeDispatch")
+Identifier(u8"insertAt")
+Identifier(u8"insertBack")
+Identifier(u8"insertFront")
+Identifier(u8"int16_t")
+Identifier(u8"int32_t")
+Identifier(u8"int64_t")
+Identifier(u8"int8_t")
+Identifier(u8"isClosed")
+Identifier(u8"isDigit")
+Identifier(u8"isEmpty")
+Identifier(u8"isEnd")
+Identifier(u8"isEqualTo")
+Identifier(u8"isEqualToFunction")
+Identifier(u8"isExponentPrefix")
+Identifier(u8"isGreaterThan")
+Identifier(u8"isGreaterThanOrEqualTo")
+Identifier(u8"isIdenticalTo")
+Identifier(u8"isImmutable")
+Identifier(u8"isLeapYear")
+Identifier(u8"isLooping")
+Identifier(u8"isLowerThan")
+Identifier(u8"isLowerThanOrEqualTo")
+Identifier(u8"isMinus")
+Identifier(u8"isNotEqualTo")
+Identifier(u8"isNotEqualToFunction")
+Identifier(u8"isOpened")
+Identifier(u8"isOpenedForReading")
+Identifier(u8"isOpenedForWriting")
+Identifier(u8"isPeriod")
+Identifier(u8"isPlaying")
+Identifier(u8"isPlus")
+Identifier(u8"isPowerOfTwo")
+Identifier(u8"isSign")
+Identifier(u8"isUTF8")
+Identifier(u8"isZero")
+Identifier(u8"jmp_buf")
+Identifier(u8"jumpTarget")
+Identifier(u8"lastVisited")
+Identifier(u8"leadingZeroes")
+Identifier(u8"leapDays")
+Identifier(u8"linePadding")
+Identifier(u8"localToWorldMatrix")
+Identifier(u8"logFlags")
+Identifier(u8"lowerProduct")
+Identifier(u8"lowerThan")
+Identifier(u8"lowerThanOrEqualTo")
+Identifier(u8"magnificationFilter")
+Identifier(u8"makeBitmask")
+Identifier(u8"mangleName")
+Identifier(u8"mapFile")
+Identifier(u8"mappingHandle")
+Identifier(u8"materialResource")
+Identifier(u8"memoryManager")
+Identifier(u8"meshConstantBuffer")
+Identifier(u8"meshConstantBufferResource")
+Identifier(u8"meshVertexBuffer")
+Identifier(u8"minificationFilter")
+Identifier(u8"modelNode")
+Identifier(u8"modelResource")
+Identifier(u8"nameLength")
+Identifier(u8"nextByteIndex")
+Identifier(u8"nextCodePoint")
+Identifier(u8"nextCodePointIndex")
+Identifier(u8"nextCodePointLength")
+Identifier(u8"nextPowerOfTwoGreaterThan")
+Identifier(u8"nextPowerOfTwoGreaterThanOrEqualTo")
+Identifier(u8"nextValue")
+Identifier(u8"nonLeapDays")
+Identifier(u8"notEqualTo")
+Identifier(u8"numberLiteral")
+Identifier(u8"numberOfBlocks")
+Identifier(u8"numberOfBytes")
+Identifier(u8"numberOfCodePoints")
+Identifier(u8"numberOfColumns")
+Identifier(u8"numberOfFreeBuffers")
+Identifier(u8"numberOfLimps")
+Identifier(u8"numberOfRows")
+Identifier(u8"numberOfSamples")
+Identifier(u8"numberOfSymbols")
+Identifier(u8"numberOfUnderruns")
+Identifier(u8"numberOfVertices")
+Identifier(u8"objectReference")
+Identifier(u8"objectReferenceValue")
+Identifier(u8"objectTypeOperations")
+Identifier(u8"objectValue")
+Identifier(u8"oldKey")
+Identifier(u8"oldValue")
+Identifier(u8"oldValueStackSize")
+Identifier(u8"onApplicationQuitRequestedEvent")
+Identifier(u8"onFinalize")
+Identifier(u8"onKeyboardKeyEvent")
+Identifier(u8"onPreMark")
+Identifier(u8"onShutDown")
+Identifier(u8"onStartUp")
+Identifier(u8"onVisit")
+Identifier(u8"onWindowClosedEvent")
+Identifier(u8"openForReading")
+Identifier(u8"openForWriting")
+Identifier(u8"openStandardError")
+Identifier(u8"openStandardInput")
+Identifier(u8"openStandardOutput")
+Identifier(u8"pObject")
+Identifier(u8"parentObjectType")
+Identifier(u8"parentType")
+Identifier(u8"peekAt")
+Identifier(u8"pixelBuffer")
+Identifier(u8"pixelFormat")
+Identifier(u8"pop_macro")
+Identifier(u8"powerSymbol")
+Identifier(u8"productHigh")
+Identifier(u8"productLow")
+Identifier(u8"purgeCache")
+Identifier(u8"purgeCaches")
+Identifier(u8"push_macro")
+Identifier(u8"quitRequested")
+Identifier(u8"quotientRemainder")
+Identifier(u8"radixPoint")
+Identifier(u8"raisedValue")
+Identifier(u8"redBits")
+Identifier(u8"reentrancyCount")
+Identifier(u8"referenceCount")
+Identifier(u8"regularFileExists")
+Identifier(u8"relativeViewportRectangle")
+Identifier(u8"removeAt")
+Identifier(u8"removeBack")
+Identifier(u8"removeFront")
+Identifier(u8"renderingContextResource")
+Identifier(u8"requiredAdditionalCapacity")
+Identifier(u8"requiredFreeCapacity")
+Identifier(u8"runtimeByteArray")
+Identifier(u8"runtimeUTF8String")
+Identifier(u8"safeAdd")
+Identifier(u8"safeMultiply")
+Identifier(u8"sampleBuffer")
+Identifier(u8"sampleBufferDefinition")
+Identifier(u8"sampleFormat")
+Identifier(u8"sampleRate")
+Identifier(u8"sampleStream")
+Identifier(u8"setAddressModeU")
+Identifier(u8"setAddressModeV")
+Identifier(u8"setAudialsBackendContext")
+Identifier(u8"setBigIcon")
+Identifier(u8"setCanvasSize")
+Identifier(u8"setClearColor")
+Identifier(u8"setClearColorBuffer")
+Identifier(u8"setClearDepth")
+Identifier(u8"setClearDepthBuffer")
+Identifier(u8"setData")
+Identifier(u8"setFileContents")
+Identifier(u8"setFullscreen")
+Identifier(u8"setHeight")
+Identifier(u8"setInput")
+Identifier(u8"setInteger")
+Identifier(u8"setIsLooping")
+Identifier(u8"setLocalToWorldMatrix")
+Identifier(u8"setMagnificationFilter")
+Identifier(u8"setMinificationFilter")
+Identifier(u8"setNatural")
+Identifier(u8"setPixelBuffer")
+Identifier(u8"setPosition")
+Identifier(u8"setPowerOfFive")
+Identifier(u8"setPowerOfTen")
+Identifier(u8"setPowerOfTwo")
+Identifier(u8"setRelativeViewportRectangle")
+Identifier(u8"setSize")
+Identifier(u8"setSmallIcon")
+Identifier(u8"setTargetFrameBuffer")
+Identifier(u8"setTitle")
+Identifier(u8"setViewToProjectionMatrix")
+Identifier(u8"setVisualsBackendContext")
+Identifier(u8"setVolume")
+Identifier(u8"setWidth")
+Identifier(u8"setWorldToViewMatrix")
+Identifier(u8"shiftLeft")
+Identifier(u8"shiftRight")
+Identifier(u8"significandTruncated")
+Identifier(u8"sizeValue")
+Identifier(u8"size_t")
+Identifier(u8"smallIcon")
+Identifier(u8"soundSourceResource")
+Identifier(u8"static_assert")
+Identifier(u8"stringBuffer")
+Identifier(u8"subStringTests1")
+Identifier(u8"subStringTests2")
+Identifier(u8"subStringTests3")
+Identifier(u8"sumHigh")
+Identifier(u8"sumLow")
+Identifier(u8"syntacticalError")
+Identifier(u8"textureResource")
+Identifier(u8"timeSpecification")
+Identifier(u8"timeStamp")
+Identifier(u8"toDecimalString")
+Identifier(u8"toInteger")
+Identifier(u8"toLowerASCII")
+Identifier(u8"toNatural")
+Identifier(u8"toReal32")
+Identifier(u8"toReal64")
+Identifier(u8"toString")
+Identifier(u8"toTwosComplement")
+Identifier(u8"toUpperASCII")
+Identifier(u8"trailingZeroes")
+Identifier(u8"typeDestructing")
+Identifier(u8"typeName")
+Identifier(u8"typeOperations")
+Identifier(u8"typeRemoved")
+Identifier(u8"uint16_t")
+Identifier(u8"uint32_t")
+Identifier(u8"uint64_t")
+Identifier(u8"uint8_t")
+Identifier(u8"upperProduct")
+Identifier(u8"va_list")
+Identifier(u8"valueSize")
+Identifier(u8"vertexBuffer")
+Identifier(u8"vertexBufferResource")
+Identifier(u8"vertexDescriptor")
+Identifier(u8"vertexElementDescriptors")
+Identifier(u8"vertexSize")
+Identifier(u8"verticalDpi")
+Identifier(u8"verticalPosition")
+Identifier(u8"verticalSize")
+Identifier(u8"viewToProjectionMatrix")
+Identifier(u8"viewerConstantBuffer")
+Identifier(u8"viewportClearColor")
+Identifier(u8"viewportClearDepth")
+Identifier(u8"viewportNode")
+Identifier(u8"visualsBackendContext")
+Identifier(u8"visualsBackendTypes")
+Identifier(u8"visualsNodeFactory")
+Identifier(u8"visualsNodeFactoryTypes")
+Identifier(u8"voidValue")
+Identifier(u8"withAliases")
+Identifier(u8"worldToViewMatrix")
+Identifier(u8"writeColor4Real32")
+Identifier(u8"writeMatrix4x4Real32")
@@ -0,0 +1,182 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Arcadia/Ring1/Include.h"
+#include "Arcadia/Languages/Include.h"
+
+static char const* const g_identifiers[] = {
+#define Identifier(x) x,
+#include "Arcadia.Ring1.Tests.HashTests/Identifiers.i"
+#undef Identifier
+};
+
+#define NumberOfIdentifiers (sizeof(g_identifiers) / sizeof(char const*))
+
+static int
+compareSizeValues
+  (
+    void const* x,
+    void const* y
+  )
+{
+  Arcadia_SizeValue a = *(Arcadia_SizeValue const*)x;
+  Arcadia_SizeValue b = *(Arcadia_SizeValue const*)y;
+  return a < b ? -1 : (a > b ? +1 : 0);
+}
+
+// No two distinct identifiers have the same hash value.
+static void
+collisionTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_SizeValue hashes[NumberOfIdentifiers];
+  for (Arcadia_SizeValue i = 0; i < NumberOfIdentifiers; ++i) {
+    hashes[i] = Arcadia_hashBytes(thread, g_identifiers[i], strlen(g_identifiers[i]));
+  }
+  qsort(hashes, NumberOfIdentifiers, sizeof(Arcadia_SizeValue), &compareSizeValues);
+  Arcadia_SizeValue numberOfCollisions = 0;
+  for (Arcadia_SizeValue i = 1; i < NumberOfIdentifiers; ++i) {
+    if (hashes[i - 1] == hashes[i]) {
+      numberOfCollisions++;
+    }
+  }
+  Arcadia_Tests_assertTrue(thread, 0 == numberOfCollisions);
+}
+
+// Distribute the identifiers over a power-of-two number of buckets using mask indexing.
+// The number of empty buckets must be close to the number expected for a uniform hash function
+// and the longest chain must be short.
+static void
+chainLengthTestsForCapacity
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SizeValue capacity
+  )
+{
+  Arcadia_SizeValue* chainLengths = Arcadia_Memory_allocateUnmanaged(thread, sizeof(Arcadia_SizeValue) * capacity);
+  for (Arcadia_SizeValue i = 0; i < capacity; ++i) {
+    chainLengths[i] = 0;
+  }
+  for (Arcadia_SizeValue i = 0; i < NumberOfIdentifiers; ++i) {
+    Arcadia_SizeValue hash = Arcadia_hashBytes(thread, g_identifiers[i], strlen(g_identifiers[i]));
+    chainLengths[hash & (capacity - 1)]++;
+  }
+  Arcadia_SizeValue numberOfEmptyBuckets = 0, maximumChainLength = 0;
+  for (Arcadia_SizeValue i = 0; i < capacity; ++i) {
+    if (!chainLengths[i]) {
+      numberOfEmptyBuckets++;
+    }
+    if (chainLengths[i] > maximumChainLength) {
+      maximumChainLength = chainLengths[i];
+    }
+  }
+  Arcadia_Memory_deallocateUnmanaged(thread, chainLengths);
+  double loadFactor = (double)NumberOfIdentifiers / (double)capacity;
+  double emptyFraction = (double)numberOfEmptyBuckets / (double)capacity;
+  // For a uniform hash function the expected fraction of empty buckets is e^(-loadFactor).
+  double expectedEmptyFraction = exp(-loadFactor);
+  Arcadia_Tests_assertTrue(thread, fabs(emptyFraction - expectedEmptyFraction) < 0.05);
+  Arcadia_Tests_assertTrue(thread, maximumChainLength <= 6);
+}
+
+static void
+chainLengthTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_SizeValue capacity = 1;
+  while (capacity < NumberOfIdentifiers) {
+    capacity *= 2;
+  }
+  chainLengthTestsForCapacity(thread, capacity / 2);
+  chainLengthTestsForCapacity(thread, capacity);
+  chainLengthTestsForCapacity(thread, capacity * 2);
+}
+
+// The hash values cached by immutable UTF-8 strings, atoms, names, and the strings of the string table are the values of Arcadia_hashBytes.
+static void
+consistencyTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Languages_StringTable* stringTable = Arcadia_Languages_StringTable_getOrCreate(thread);
+  for (Arcadia_SizeValue i = 0; i < NumberOfIdentifiers; ++i) {
+    Arcadia_SizeValue n = strlen(g_identifiers[i]);
+    Arcadia_SizeValue hash = Arcadia_hashBytes(thread, g_identifiers[i], n);
+    Arcadia_RuntimeUTF8String* string = Arcadia_RuntimeUTF8String_create(thread, g_identifiers[i], n);
+    Arcadia_Tests_assertTrue(thread, hash == Arcadia_RuntimeUTF8String_getHash(thread, string));
+    Arcadia_AtomValue atom = Arcadia_Atoms_getOrCreateAtom(thread, 0, g_identifiers[i], n);
+    Arcadia_Tests_assertTrue(thread, hash == Arcadia_Atom_getHash(thread, atom));
+    Arcadia_Tests_assertTrue(thread, atom == Arcadia_Atoms_getOrCreateAtom(thread, 0, g_identifiers[i], n));
+    Arcadia_Name* name = Arcadia_Names_getOrCreateName(thread, g_identifiers[i], n);
+    Arcadia_Tests_assertTrue(thread, hash == Arcadia_Name_getHash(thread, name));
+    Arcadia_Tests_assertTrue(thread, name == Arcadia_Names_getOrCreateName(thread, g_identifiers[i], n));
+    Arcadia_String* stringTableString = Arcadia_Languages_StringTable_getOrCreateStringFromBytes(thread, stringTable, g_identifiers[i], n);
+    Arcadia_Tests_assertTrue(thread, hash == Arcadia_Object_getHash(thread, (Arcadia_Object*)stringTableString));
+    Arcadia_Tests_assertTrue(thread, Arcadia_String_isEqualTo_pn(thread, stringTableString, g_identifiers[i], n));
+  }
+  // The string table grew while the strings were added. Each string is found in its bucket.
+  for (Arcadia_SizeValue i = 0; i < NumberOfIdentifiers; ++i) {
+    Arcadia_SizeValue n = strlen(g_identifiers[i]);
+    Arcadia_String* stringTableString = Arcadia_Languages_StringTable_getOrCreateStringFromBytes(thread, stringTable, g_identifiers[i], n);
+    Arcadia_Tests_assertTrue(thread, stringTableString == Arcadia_Languages_StringTable_getOrCreateStringFromBytes(thread, stringTable, g_identifiers[i], n));
+  }
+  Arcadia_Tests_assertTrue(thread, NumberOfIdentifiers <= stringTable->size);
+}
+
+// Sequences of zero Bytes of different lengths have different hash values.
+static void
+lengthTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static Arcadia_Natural8Value const zeroes[33] = { 0 };
+  for (Arcadia_SizeValue i = 0; i < 33; ++i) {
+    for (Arcadia_SizeValue j = i + 1; j < 33; ++j) {
+      Arcadia_Tests_assertTrue(thread, Arcadia_hashBytes(thread, zeroes, i) != Arcadia_hashBytes(thread, zeroes, j));
+    }
+  }
+}
+
+int
+main
+  (
+    int argc,
+    char **argv
+  )
+{
+  if (!Arcadia_Tests_safeExecute(&collisionTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&chainLengthTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&consistencyTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&lengthTests)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,320 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <stdlib.h>
+
+#include "Arcadia/Ring1/Include.h"
+#include "Arcadia/Ring1/Implementation/Concurrency/Atomic.h"
+#include "Arcadia/Ring1/Implementation/Concurrency/NativeThread.h"
+
+#define NumberOfProducers (4)
+#define NumberOfElementsPerProducer (1024 * 16)
+#define BatchSize (64)
+
+// An element is the producer index in the upper 8 Bits and the element index + 1 in the lower 24 Bits.
+#define makeElement(producer, index) ((void*)(uintptr_t)(((uintptr_t)(producer) << 24) | ((uintptr_t)(index) + 1)))
+#define getProducer(element) ((Arcadia_SizeValue)((uintptr_t)(element) >> 24))
+#define getIndex(element) ((Arcadia_SizeValue)(((uintptr_t)(element) & 0xffffff) - 1))
+
+typedef struct ProducerContext {
+  Arcadia_MultiProducerQueue* queue;
+  Arcadia_SizeValue index;
+  // The number of elements which were rejected.
+  Arcadia_SizeValue numberOfRejectedElements;
+  // The number of finished producers. Accessed atomically.
+  uint32_t volatile* numberOfFinishedProducers;
+} ProducerContext;
+
+static void
+producerTask
+  (
+    Arcadia_Thread* thread,
+    void* context
+  )
+{
+  ProducerContext* self = (ProducerContext*)context;
+  for (Arcadia_SizeValue i = 0; i < NumberOfElementsPerProducer; ++i) {
+    if (!Arcadia_MultiProducerQueue_enqueue(thread, self->queue, makeElement(self->index, i))) {
+      self->numberOfRejectedElements++;
+    }
+  }
+  Arcadia_Memory_atomicAdd32(self->numberOfFinishedProducers, 1);
+}
+
+// Producers enqueue elements while the consumer dequeues them in batches.
+// Assert that the elements of each producer are dequeued in the order in which they were enqueued.
+// Assert that the elements which were not rejected are dequeued exactly once.
+static void
+stressTest
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SizeValue capacity,
+    Arcadia_MultiProducerQueue_OverflowPolicy overflowPolicy
+  )
+{
+  Arcadia_ThreadPool* pool = Arcadia_ThreadPool_create(thread, NumberOfProducers);
+  Arcadia_MultiProducerQueue* queue = Arcadia_MultiProducerQueue_create(thread, capacity, overflowPolicy);
+  uint32_t volatile numberOfFinishedProducers = 0;
+  ProducerContext contexts[NumberOfProducers];
+  Arcadia_ThreadPool_Task* tasks[NumberOfProducers];
+  for (Arcadia_SizeValue i = 0; i < NumberOfProducers; ++i) {
+    contexts[i] = (ProducerContext){ .queue = queue, .index = i, .numberOfRejectedElements = 0, .numberOfFinishedProducers = &numberOfFinishedProducers };
+    tasks[i] = Arcadia_ThreadPool_fork(thread, pool, &producerTask, &contexts[i]);
+  }
+  // The index of the next element expected from each producer.
+  Arcadia_SizeValue next[NumberOfProducers] = { 0 };
+  Arcadia_SizeValue numberOfDequeuedElements = 0;
+  void* elements[BatchSize];
+  while (Arcadia_BooleanValue_True) {
+    // Read the number of finished producers before dequeueing: If all producers finished, the batch drains the queue.
+    Arcadia_BooleanValue finished = NumberOfProducers == Arcadia_Memory_atomicLoad32(&numberOfFinishedProducers);
+    Arcadia_SizeValue n = Arcadia_MultiProducerQueue_dequeueBatch(thread, queue, elements, BatchSize);
+    for (Arcadia_SizeValue i = 0; i < n; ++i) {
+      Arcadia_SizeValue producer = getProducer(elements[i]);
+      Arcadia_Tests_assertTrue(thread, producer < NumberOfProducers);
+      Arcadia_Tests_assertTrue(thread, getIndex(elements[i]) >= next[producer]);
+      if (Arcadia_MultiProducerQueue_OverflowPolicy_Wait == overflowPolicy) {
+        Arcadia_Tests_assertTrue(thread, getIndex(elements[i]) == next[producer]);
+      }
+      next[producer] = getIndex(elements[i]) + 1;
+    }
+    numberOfDequeuedElements += n;
+    if (finished && 0 == n) {
+      break;
+    }
+    Arcadia_Thread_safepoint(thread);
+    if (0 == n) {
+      // Let the producers run.
+      Arcadia_Concurrency_NativeThread_yield();
+    }
+  }
+  Arcadia_SizeValue numberOfRejectedElements = 0;
+  for (Arcadia_SizeValue i = 0; i < NumberOfProducers; ++i) {
+    Arcadia_ThreadPool_join(thread, pool, tasks[i]);
+    numberOfRejectedElements += contexts[i].numberOfRejectedElements;
+  }
+  Arcadia_MultiProducerQueue_Statistics statistics;
+  Arcadia_MultiProducerQueue_getStatistics(thread, queue, &statistics);
+  Arcadia_MultiProducerQueue_destroy(thread, queue);
+  Arcadia_ThreadPool_destroy(thread, pool);
+
+  Arcadia_Tests_assertTrue(thread, NumberOfProducers * NumberOfElementsPerProducer == numberOfDequeuedElements + numberOfRejectedElements);
+  Arcadia_Tests_assertTrue(thread, numberOfDequeuedElements == statistics.numberOfDequeuedElements);
+  Arcadia_Tests_assertTrue(thread, numberOfRejectedElements == statistics.numberOfRejectedElements);
+  Arcadia_Tests_assertTrue(thread, statistics.highWaterMark <= capacity);
+  if (Arcadia_MultiProducerQueue_OverflowPolicy_Wait == overflowPolicy) {
+    Arcadia_Tests_assertTrue(thread, 0 == numberOfRejectedElements);
+  }
+}
+
+static void
+waitTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  // A small capacity such that the producers wait.
+  stressTest(thread, 16, Arcadia_MultiProducerQueue_OverflowPolicy_Wait);
+  stressTest(thread, 1024, Arcadia_MultiProducerQueue_OverflowPolicy_Wait);
+}
+
+static void
+rejectTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  stressTest(thread, 16, Arcadia_MultiProducerQueue_OverflowPolicy_Reject);
+  stressTest(thread, 1024, Arcadia_MultiProducerQueue_OverflowPolicy_Reject);
+}
+
+#define NumberOfObjectsPerProducer (1024)
+
+// The queue of the object tests. Its elements are visited by visitObjectQueue.
+static Arcadia_MultiProducerQueue* g_objectQueue = NULL;
+
+static void
+visitObject
+  (
+    Arcadia_Thread* thread,
+    void* element
+  )
+{ Arcadia_Object_visit(thread, (Arcadia_Object*)element); }
+
+static void
+visitObjectQueue
+  (
+    Arcadia_Thread* thread
+  )
+{
+  if (g_objectQueue) {
+    Arcadia_MultiProducerQueue_visit(thread, g_objectQueue, &visitObject);
+  }
+}
+
+typedef struct CollectorContext {
+  // Non-zero if the collector must stop. Accessed atomically.
+  uint32_t volatile stop;
+  // The number of collections.
+  Arcadia_SizeValue numberOfCollections;
+} CollectorContext;
+
+static void
+collectorTask
+  (
+    Arcadia_Thread* thread,
+    void* context
+  )
+{
+  CollectorContext* self = (CollectorContext*)context;
+  while (!Arcadia_Memory_atomicLoad32(&self->stop)) {
+    Arcadia_Process_runARMS(Arcadia_Thread_getProcess(thread), false);
+    self->numberOfCollections++;
+    Arcadia_Concurrency_NativeThread_yield();
+  }
+}
+
+static void
+objectProducerTask
+  (
+    Arcadia_Thread* thread,
+    void* context
+  )
+{
+  ProducerContext* self = (ProducerContext*)context;
+  for (Arcadia_SizeValue i = 0; i < NumberOfObjectsPerProducer; ++i) {
+    Arcadia_String* string = Arcadia_String_createFromSize(thread, self->index * NumberOfObjectsPerProducer + i);
+    // The producer passes safepoints while it waits: Keep the string alive until it is in the queue.
+    Arcadia_Object_lock(thread, (Arcadia_Object*)string);
+    Arcadia_MultiProducerQueue_enqueue(thread, self->queue, string);
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)string);
+  }
+  Arcadia_Memory_atomicAdd32(self->numberOfFinishedProducers, 1);
+}
+
+// Producers enqueue strings into a full queue and wait while another thread runs collections.
+// Assert that every string is dequeued intact and in order.
+static void
+objectWaitTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Process* process = Arcadia_Thread_getProcess(thread);
+  Arcadia_ThreadPool* pool = Arcadia_ThreadPool_create(thread, NumberOfProducers + 1);
+  g_objectQueue = Arcadia_MultiProducerQueue_create(thread, 16, Arcadia_MultiProducerQueue_OverflowPolicy_Wait);
+  Arcadia_Process_addArenaVisitCallback(process, &visitObjectQueue);
+  CollectorContext collectorContext = { .stop = 0, .numberOfCollections = 0 };
+  Arcadia_ThreadPool_Task* collector = Arcadia_ThreadPool_fork(thread, pool, &collectorTask, &collectorContext);
+  uint32_t volatile numberOfFinishedProducers = 0;
+  ProducerContext contexts[NumberOfProducers];
+  Arcadia_ThreadPool_Task* tasks[NumberOfProducers];
+  for (Arcadia_SizeValue i = 0; i < NumberOfProducers; ++i) {
+    contexts[i] = (ProducerContext){ .queue = g_objectQueue, .index = i, .numberOfRejectedElements = 0, .numberOfFinishedProducers = &numberOfFinishedProducers };
+    tasks[i] = Arcadia_ThreadPool_fork(thread, pool, &objectProducerTask, &contexts[i]);
+  }
+  Arcadia_SizeValue next[NumberOfProducers] = { 0 };
+  Arcadia_SizeValue numberOfDequeuedElements = 0;
+  void* elements[BatchSize];
+  while (Arcadia_BooleanValue_True) {
+    Arcadia_BooleanValue finished = NumberOfProducers == Arcadia_Memory_atomicLoad32(&numberOfFinishedProducers);
+    Arcadia_SizeValue n = Arcadia_MultiProducerQueue_dequeueBatch(thread, g_objectQueue, elements, BatchSize);
+    // The dequeued strings are not reachable: Check them before the next safepoint.
+    for (Arcadia_SizeValue i = 0; i < n; ++i) {
+      Arcadia_String* string = (Arcadia_String*)elements[i];
+      Arcadia_Tests_assertTrue(thread, Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)string, _Arcadia_String_getType(thread)));
+      Arcadia_SizeValue value = 0;
+      Arcadia_Natural8Value const* p = Arcadia_String_getBytes(thread, string);
+      for (Arcadia_SizeValue j = 0, m = Arcadia_String_getNumberOfBytes(thread, string); j < m; ++j) {
+        Arcadia_Tests_assertTrue(thread, '0' <= p[j] && p[j] <= '9');
+        value = value * 10 + (p[j] - '0');
+      }
+      Arcadia_SizeValue producer = value / NumberOfObjectsPerProducer;
+      Arcadia_Tests_assertTrue(thread, producer < NumberOfProducers);
+      Arcadia_Tests_assertTrue(thread, value % NumberOfObjectsPerProducer == next[producer]);
+      next[producer]++;
+    }
+    numberOfDequeuedElements += n;
+    if (finished && 0 == n) {
+      break;
+    }
+    Arcadia_Thread_safepoint(thread);
+    if (0 == n) {
+      Arcadia_Concurrency_NativeThread_yield();
+    }
+  }
+  for (Arcadia_SizeValue i = 0; i < NumberOfProducers; ++i) {
+    Arcadia_ThreadPool_join(thread, pool, tasks[i]);
+  }
+  Arcadia_Memory_atomicStore32(&collectorContext.stop, 1);
+  Arcadia_ThreadPool_join(thread, pool, collector);
+  Arcadia_MultiProducerQueue_Statistics statistics;
+  Arcadia_MultiProducerQueue_getStatistics(thread, g_objectQueue, &statistics);
+  Arcadia_Process_removeArenaVisitCallback(process, &visitObjectQueue);
+  Arcadia_MultiProducerQueue_destroy(thread, g_objectQueue);
+  g_objectQueue = NULL;
+  Arcadia_ThreadPool_destroy(thread, pool);
+
+  Arcadia_Tests_assertTrue(thread, NumberOfProducers * NumberOfObjectsPerProducer == numberOfDequeuedElements);
+  Arcadia_Tests_assertTrue(thread, 0 < collectorContext.numberOfCollections);
+}
+
+// Enqueue and dequeue without concurrency.
+static void
+sequentialTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_MultiProducerQueue* queue = Arcadia_MultiProducerQueue_create(thread, 3, Arcadia_MultiProducerQueue_OverflowPolicy_Reject);
+  Arcadia_Tests_assertTrue(thread, 4 == Arcadia_MultiProducerQueue_getCapacity(thread, queue));
+  Arcadia_Tests_assertTrue(thread, NULL == Arcadia_MultiProducerQueue_dequeue(thread, queue));
+  for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+    Arcadia_Tests_assertTrue(thread, Arcadia_MultiProducerQueue_enqueue(thread, queue, makeElement(0, i)));
+  }
+  Arcadia_Tests_assertTrue(thread, !Arcadia_MultiProducerQueue_enqueue(thread, queue, makeElement(0, 4)));
+  for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+    Arcadia_Tests_assertTrue(thread, makeElement(0, i) == Arcadia_MultiProducerQueue_dequeue(thread, queue));
+  }
+  Arcadia_Tests_assertTrue(thread, NULL == Arcadia_MultiProducerQueue_dequeue(thread, queue));
+  Arcadia_MultiProducerQueue_Statistics statistics;
+  Arcadia_MultiProducerQueue_getStatistics(thread, queue, &statistics);
+  Arcadia_Tests_assertTrue(thread, 4 == statistics.numberOfDequeuedElements);
+  Arcadia_Tests_assertTrue(thread, 1 == statistics.numberOfRejectedElements);
+  Arcadia_Tests_assertTrue(thread, 4 == statistics.highWaterMark);
+  Arcadia_MultiProducerQueue_destroy(thread, queue);
+}
+
+int
+main
+  (
+    int argc,
+    char **argv
+  )
+{
+  if (!Arcadia_Tests_safeExecute(&sequentialTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&waitTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&rejectTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&objectWaitTests)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,133 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "Arcadia/Ring1/Include.h"
+
+// The number of zones recorded by each thread. Exceeds the capacity of a chunk.
+#define NumberOfZones (1024 * 5)
+
+#define NumberOfTasks (4)
+
+// Count the occurrences of a string in the contents of a byte array builder.
+static Arcadia_SizeValue
+count
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* builder,
+    char const* string
+  )
+{
+  char const* bytes = Arcadia_ByteArrayBuilder_getBytes(thread, builder);
+  Arcadia_SizeValue numberOfBytes = Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, builder);
+  Arcadia_SizeValue length = strlen(string);
+  Arcadia_SizeValue n = 0;
+  for (Arcadia_SizeValue i = 0; i + length <= numberOfBytes; ++i) {
+    if (!memcmp(bytes + i, string, length)) {
+      n++;
+    }
+  }
+  return n;
+}
+
+static void
+recordZones
+  (
+    Arcadia_Thread* thread,
+    void* context
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < NumberOfZones; ++i) {
+    Arcadia_Profiler_beginZone(thread, "task");
+    Arcadia_Profiler_endZone(thread);
+  }
+}
+
+// Record zones and counters on the main thread and on the workers of a thread pool.
+// Assert that the trace contains all of them.
+static void
+exportTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Profiler_beginZone(thread, "outer");
+  Arcadia_Profiler_beginZone(thread, "inner \"zone\"");
+  Arcadia_Profiler_setCounter(thread, "counter", 42);
+  Arcadia_Profiler_endZone(thread);
+  Arcadia_Profiler_endZone(thread);
+
+  Arcadia_ThreadPool* pool = Arcadia_ThreadPool_create(thread, 2);
+  Arcadia_ThreadPool_Task* tasks[NumberOfTasks];
+  for (Arcadia_SizeValue i = 0; i < NumberOfTasks; ++i) {
+    tasks[i] = Arcadia_ThreadPool_fork(thread, pool, &recordZones, NULL);
+  }
+  for (Arcadia_SizeValue i = 0; i < NumberOfTasks; ++i) {
+    Arcadia_ThreadPool_join(thread, pool, tasks[i]);
+  }
+  Arcadia_ThreadPool_destroy(thread, pool);
+
+  Arcadia_ByteArrayBuilder* trace = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_Profiler_exportChromeTrace(thread, trace);
+  Arcadia_Tests_assertTrue(thread, 1 == count(thread, trace, "{\"traceEvents\":["));
+  Arcadia_Tests_assertTrue(thread, 1 == count(thread, trace, "],\"displayTimeUnit\":\"ns\"}"));
+#if 1 == Arcadia_Configuration_Profiler_Enabled
+  Arcadia_Tests_assertTrue(thread, 1 == count(thread, trace, "{\"name\":\"outer\",\"ph\":\"B\""));
+  Arcadia_Tests_assertTrue(thread, 1 == count(thread, trace, "{\"name\":\"inner \\\"zone\\\"\",\"ph\":\"B\""));
+  Arcadia_Tests_assertTrue(thread, 1 == count(thread, trace, "{\"name\":\"counter\",\"ph\":\"C\""));
+  Arcadia_Tests_assertTrue(thread, 1 == count(thread, trace, "\"args\":{\"value\":42}"));
+  Arcadia_Tests_assertTrue(thread, NumberOfTasks * NumberOfZones == count(thread, trace, "{\"name\":\"task\",\"ph\":\"B\""));
+  // The main thread and the workers which executed tasks have a name each.
+  Arcadia_SizeValue numberOfThreads = count(thread, trace, "\"ph\":\"M\"");
+  Arcadia_Tests_assertTrue(thread, numberOfThreads >= 1 && numberOfThreads <= 3);
+  Arcadia_Tests_assertTrue(thread, count(thread, trace, "\"ph\":\"B\"") == count(thread, trace, "\"ph\":\"E\""));
+  Arcadia_Tests_assertTrue(thread, 0 == Arcadia_Profiler_getNumberOfDroppedEvents(thread));
+#else
+  Arcadia_Tests_assertTrue(thread, 0 == count(thread, trace, "\"ph\""));
+#endif
+}
+
+// Assert that the timestamps are monotonic.
+static void
+timestampTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Natural64Value previous = Arcadia_Profiler_getTimestamp();
+  for (Arcadia_SizeValue i = 0; i < 1000; ++i) {
+    Arcadia_Natural64Value current = Arcadia_Profiler_getTimestamp();
+    Arcadia_Tests_assertTrue(thread, current >= previous);
+    previous = current;
+  }
+}
+
+int
+main
+  (
+    int argc,
+    char **argv
+  )
+{
+  if (!Arcadia_Tests_safeExecute(&timestampTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&exportTests)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
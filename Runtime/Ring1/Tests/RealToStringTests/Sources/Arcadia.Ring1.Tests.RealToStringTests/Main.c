@@ -30,6 +30,7 @@ testFixture32
   Arcadia_RuntimeUTF8String* u = Arcadia_RuntimeUTF8String_createFromReal32(thread, v);
   Arcadia_Real32Value w = Arcadia_RuntimeUTF8String_toReal32(thread, u);
   Arcadia_Tests_assertTrue(thread, v == w);
+  Arcadia_Tests_assertTrue(thread, !signbit(v) == !signbit(w));
 }
 
 static void
@@ -42,6 +43,35 @@ testFixture64
   Arcadia_RuntimeUTF8String* u = Arcadia_RuntimeUTF8String_createFromReal64(thread, v);
   Arcadia_Real64Value w = Arcadia_RuntimeUTF8String_toReal64(thread, u);
   Arcadia_Tests_assertTrue(thread, v == w);
+  Arcadia_Tests_assertTrue(thread, !signbit(v) == !signbit(w));
+}
+
+// Infinities do not round-trip. Assert their textual representations.
+static void
+testTextFixture32
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Real32Value v,
+    const char* expected
+  )
+{
+  Arcadia_RuntimeUTF8String* u = Arcadia_RuntimeUTF8String_createFromReal32(thread, v);
+  Arcadia_Tests_assertTrue(thread, strlen(expected) == Arcadia_RuntimeUTF8String_getNumberOfBytes(thread, u));
+  Arcadia_Tests_assertTrue(thread, !memcmp(expected, Arcadia_RuntimeUTF8String_getBytes(thread, u), strlen(expected)));
+}
+
+// Infinities do not round-trip. Assert their textual representations.
+static void
+testTextFixture64
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Real64Value v,
+    const char* expected
+  )
+{
+  Arcadia_RuntimeUTF8String* u = Arcadia_RuntimeUTF8String_createFromReal64(thread, v);
+  Arcadia_Tests_assertTrue(thread, strlen(expected) == Arcadia_RuntimeUTF8String_getNumberOfBytes(thread, u));
+  Arcadia_Tests_assertTrue(thread, !memcmp(expected, Arcadia_RuntimeUTF8String_getBytes(thread, u), strlen(expected)));
 }
 
 static void
@@ -53,6 +83,9 @@ testReal32
   testFixture32(thread, Arcadia_Real32Value_Minimum);
   testFixture32(thread, Arcadia_Real32Value_Maximum);
   testFixture32(thread, Arcadia_Real32Value_Literal(0.));
+  testFixture32(thread, Arcadia_Real32Value_Literal(-0.));
+  testTextFixture32(thread, Arcadia_Real32Value_PositiveInfinity, u8"<positive infinity>");
+  testTextFixture32(thread, Arcadia_Real32Value_NegativeInfinity, u8"<negative infinity>");
 }
 
 static void
@@ -64,6 +97,9 @@ testReal64
   testFixture64(thread, Arcadia_Real64Value_Minimum);
   testFixture64(thread, Arcadia_Real64Value_Maximum);
   testFixture64(thread, Arcadia_Real64Value_Literal(0.));
+  testFixture64(thread, Arcadia_Real64Value_Literal(-0.));
+  testTextFixture64(thread, Arcadia_Real64Value_PositiveInfinity, u8"<positive infinity>");
+  testTextFixture64(thread, Arcadia_Real64Value_NegativeInfinity, u8"<negative infinity>");
 }
 
 int
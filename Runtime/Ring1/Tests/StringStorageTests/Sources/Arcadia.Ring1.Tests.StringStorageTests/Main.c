@@ -0,0 +1,224 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "Arcadia/Ring1/Include.h"
+
+// The numbers of strings created, allocations, and copied Bytes since the statistics were reset.
+static void
+assertStatistics
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SizeValue numberOfStrings,
+    Arcadia_SizeValue numberOfAllocations,
+    Arcadia_SizeValue numberOfCopiedBytes
+  )
+{
+  Arcadia_String_Statistics statistics;
+  Arcadia_String_getStatistics(thread, &statistics);
+  Arcadia_Tests_assertTrue(thread, numberOfStrings == statistics.numberOfStrings);
+  Arcadia_Tests_assertTrue(thread, numberOfAllocations == statistics.numberOfAllocations);
+  Arcadia_Tests_assertTrue(thread, numberOfCopiedBytes == statistics.numberOfCopiedBytes);
+}
+
+// Strings created from C values are stored inline: one allocation per string.
+static void
+inlineTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_String_resetStatistics(thread);
+  Arcadia_String* a = Arcadia_String_createFromInteger32(thread, -42);
+  assertStatistics(thread, 1, 1, 3);
+  Arcadia_Tests_assertTrue(thread, Arcadia_String_isEqualTo_pn(thread, a, u8"-42", sizeof(u8"-42") - 1));
+  Arcadia_Tests_assertTrue(thread, Arcadia_StringStorage_Inline == a->storage);
+  Arcadia_Tests_assertTrue(thread, (void const*)(a + 1) == (void const*)a->bytes);
+  Arcadia_Tests_assertTrue(thread, 3 == Arcadia_String_getNumberOfCodePoints(thread, a));
+
+  Arcadia_String_resetStatistics(thread);
+  Arcadia_String* b = Arcadia_String_create_pn(thread, Arcadia_RuntimeByteArray_create(thread, u8"-42", sizeof(u8"-42") - 1));
+  assertStatistics(thread, 1, 1, 3);
+  Arcadia_Value a1 = Arcadia_Value_makeObjectReferenceValue(a),
+                b1 = Arcadia_Value_makeObjectReferenceValue(b);
+  Arcadia_Tests_assertTrue(thread, Arcadia_Value_isEqualTo(thread, &a1, &b1));
+  // The hash is computed lazily and is the same as the hash of the equivalent runtime UTF-8 string.
+  Arcadia_Tests_assertTrue(thread, !b->hasHash);
+  Arcadia_RuntimeUTF8String* c = Arcadia_RuntimeUTF8String_create(thread, u8"-42", sizeof(u8"-42") - 1);
+  Arcadia_Tests_assertTrue(thread, Arcadia_RuntimeUTF8String_getHash(thread, c) == Arcadia_Value_getHash(thread, &b1));
+  Arcadia_Tests_assertTrue(thread, b->hasHash);
+  Arcadia_Tests_assertTrue(thread, -42 == Arcadia_String_toInteger32(thread, b));
+
+  // Code points are counted once.
+  Arcadia_String_resetStatistics(thread);
+  Arcadia_String* d = Arcadia_String_create(thread, Arcadia_Value_makeRuntimeUTF8StringValue(Arcadia_RuntimeUTF8String_create(thread, u8"äöü", sizeof(u8"äöü") - 1)));
+  assertStatistics(thread, 1, 1, 0);
+  Arcadia_Tests_assertTrue(thread, Arcadia_SizeValue_Maximum == d->numberOfCodePoints);
+  Arcadia_Tests_assertTrue(thread, 3 == Arcadia_String_getNumberOfCodePoints(thread, d));
+  Arcadia_Tests_assertTrue(thread, 3 == d->numberOfCodePoints);
+}
+
+// Substrings and slices share the Bytes of their string.
+static void
+sliceTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_String* a = Arcadia_String_create_pn(thread, Arcadia_RuntimeByteArray_create(thread, u8"hello, wörld", sizeof(u8"hello, wörld") - 1));
+
+  Arcadia_String_resetStatistics(thread);
+  Arcadia_String* b = Arcadia_String_substring(thread, a, 7, Arcadia_Value_makeSizeValue(5));
+  assertStatistics(thread, 1, 1, 0);
+  Arcadia_Tests_assertTrue(thread, Arcadia_String_isEqualTo_pn(thread, b, u8"wörld", sizeof(u8"wörld") - 1));
+  Arcadia_Tests_assertTrue(thread, a->bytes + 7 == b->bytes);
+  Arcadia_Tests_assertTrue(thread, Arcadia_StringStorage_Slice == b->storage && a == b->owner.string);
+  Arcadia_Tests_assertTrue(thread, 5 == Arcadia_String_getNumberOfCodePoints(thread, b));
+
+  // The owner of a slice of a slice is the original string.
+  Arcadia_String* c = Arcadia_String_substring(thread, b, 1, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
+  Arcadia_Tests_assertTrue(thread, Arcadia_String_isEqualTo_pn(thread, c, u8"örld", sizeof(u8"örld") - 1));
+  Arcadia_Tests_assertTrue(thread, a == c->owner.string);
+  Arcadia_Tests_assertTrue(thread, 4 == c->numberOfCodePoints);
+
+  Arcadia_String* d = Arcadia_String_slice(thread, a, 0, 5);
+  Arcadia_Tests_assertTrue(thread, Arcadia_String_isEqualTo_pn(thread, d, u8"hello", sizeof(u8"hello") - 1));
+  assertStatistics(thread, 3, 3, 0);
+
+  // A slice must start and end at code point boundaries.
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_String_slice(thread, a, 9, 2);
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+    Arcadia_Thread_jump(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_Status_ArgumentValueInvalid == Arcadia_Thread_getStatus(thread));
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+}
+
+// Builders with more than Arcadia_String_MaximumNumberOfCopiedBuilderBytes Bytes hand their buffers over.
+static void
+takeTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  char bytes[Arcadia_String_MaximumNumberOfCopiedBuilderBytes * 2];
+  memset(bytes, 'x', sizeof(bytes));
+
+  Arcadia_ByteArrayBuilder* byteArrayBuilder = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, byteArrayBuilder, bytes, sizeof(bytes));
+  Arcadia_Natural8Value const* buffer = Arcadia_ByteArrayBuilder_getBytes(thread, byteArrayBuilder);
+  Arcadia_String_resetStatistics(thread);
+  Arcadia_String* a = Arcadia_String_takeFromByteArrayBuilder(thread, byteArrayBuilder);
+  assertStatistics(thread, 1, 1, 0);
+  Arcadia_Tests_assertTrue(thread, buffer == a->bytes);
+  Arcadia_Tests_assertTrue(thread, Arcadia_StringStorage_Buffer == a->storage);
+  Arcadia_Tests_assertTrue(thread, Arcadia_String_isEqualTo_pn(thread, a, bytes, sizeof(bytes)));
+  Arcadia_Tests_assertTrue(thread, 0 == Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, byteArrayBuilder));
+  // The builder remains usable.
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, byteArrayBuilder, u8"y", 1);
+  Arcadia_Tests_assertTrue(thread, Arcadia_ByteArrayBuilder_isEqualTo_pn(thread, byteArrayBuilder, u8"y", 1));
+
+  // Short contents are copied inline.
+  Arcadia_String_resetStatistics(thread);
+  Arcadia_String* b = Arcadia_String_takeFromByteArrayBuilder(thread, byteArrayBuilder);
+  assertStatistics(thread, 1, 1, 1);
+  Arcadia_Tests_assertTrue(thread, Arcadia_StringStorage_Inline == b->storage);
+  Arcadia_Tests_assertTrue(thread, 0 == Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, byteArrayBuilder));
+
+  Arcadia_StringBuilder* stringBuilder = Arcadia_StringBuilder_create(thread);
+  Arcadia_StringBuilder_insertBack(thread, stringBuilder, Arcadia_Value_makeObjectReferenceValue(a));
+  Arcadia_StringBuilder_insertBack(thread, stringBuilder, Arcadia_Value_makeObjectReferenceValue(a));
+  Arcadia_String_resetStatistics(thread);
+  Arcadia_String* c = Arcadia_String_takeFromStringBuilder(thread, stringBuilder);
+  assertStatistics(thread, 1, 1, 0);
+  Arcadia_Tests_assertTrue(thread, sizeof(bytes) * 2 == Arcadia_String_getNumberOfCodePoints(thread, c));
+  Arcadia_Tests_assertTrue(thread, 0 == Arcadia_StringBuilder_getNumberOfBytes(thread, stringBuilder));
+
+  // Invalid UTF-8 is rejected and the builder is not modified.
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, byteArrayBuilder, "\xff", 1);
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_String_takeFromByteArrayBuilder(thread, byteArrayBuilder);
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+    Arcadia_Thread_jump(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_Status_EncodingInvalid == Arcadia_Thread_getStatus(thread));
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+  Arcadia_Tests_assertTrue(thread, 1 == Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, byteArrayBuilder));
+}
+
+// A slice keeps the string owning its Bytes alive.
+static void
+lifetimeTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  char bytes[Arcadia_String_MaximumNumberOfCopiedBuilderBytes * 2];
+  memset(bytes, 'x', sizeof(bytes));
+  bytes[0] = 'a';
+  Arcadia_ByteArrayBuilder* byteArrayBuilder = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, byteArrayBuilder, bytes, sizeof(bytes));
+  Arcadia_String* a = Arcadia_String_substring(thread, Arcadia_String_takeFromByteArrayBuilder(thread, byteArrayBuilder), 0, Arcadia_Value_makeSizeValue(2));
+  Arcadia_Object_lock(thread, (Arcadia_Object*)a);
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_Process_runARMS(Arcadia_Thread_getProcess(thread), false);
+    Arcadia_Tests_assertTrue(thread, Arcadia_String_isEqualTo_pn(thread, a, u8"ax", sizeof(u8"ax") - 1));
+    Arcadia_Tests_assertTrue(thread, Arcadia_StringStorage_Buffer == a->owner.string->storage);
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)a);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Object_unlock(thread, (Arcadia_Object*)a);
+  Arcadia_Process_runARMS(Arcadia_Thread_getProcess(thread), false);
+}
+
+int
+main
+  (
+    int argc,
+    char **argv
+  )
+{
+  if (!Arcadia_Tests_safeExecute(&inlineTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&sliceTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&takeTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&lifetimeTests)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
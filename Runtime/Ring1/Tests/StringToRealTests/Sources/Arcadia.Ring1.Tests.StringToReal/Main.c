@@ -68,6 +68,38 @@ testFixtureStringToReal64
   Arcadia_Tests_assertTrue(thread, expected == received);
 }
 
+// Parses a string into a real64 value using Arcadia.Ring1 functionality.
+// The test terminates with success if the result is equal to the expected value. Otherwise it terminates with failure.
+static void
+testFixtureStringToReal64Exact
+  (
+    Arcadia_Thread* thread,
+    const char* p,
+    Arcadia_Real64Value expected
+  )
+{
+  Arcadia_Real64Value received = Arcadia_toReal64(thread, p, strlen(p));
+  Arcadia_Tests_assertTrue(thread, expected == received);
+}
+
+// Exponents with leading zeroes must be read as if the leading zeroes were absent.
+static void
+exponentTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  testFixtureStringToReal64Exact(thread, u8"9.6E0", 9.6);
+  testFixtureStringToReal64Exact(thread, u8"9.6E00", 9.6);
+  testFixtureStringToReal64Exact(thread, u8"1E00", 1.);
+  testFixtureStringToReal64Exact(thread, u8"1e007", 1e7);
+  testFixtureStringToReal64Exact(thread, u8"1e+007", 1e7);
+  testFixtureStringToReal64Exact(thread, u8"2.5E-01", 0.25);
+  testFixtureStringToReal64Exact(thread, u8"1.5e-0010", 1.5e-10);
+  testFixtureStringToReal64Exact(thread, u8"-3.25e0002", -325.);
+  testFixtureStringToReal64Exact(thread, u8"1e0000000000000000000022", 1e22);
+}
+
 static void
 test
   (
@@ -96,6 +128,9 @@ test
   // Typical values from data files.
   On(u8"0.5"); On(u8"-0.5"); On(u8"+0.5");
 
+  // Exponents with leading zeroes.
+  On(u8"9.60986328125E0"); On(u8"2.5E-01"); On(u8"1e007");
+
 #undef On
 }
 
@@ -109,6 +144,9 @@ main
   if (!Arcadia_Tests_safeExecute(&safeRangeTests)) {
     return EXIT_FAILURE;
   }
+  if (!Arcadia_Tests_safeExecute(&exponentTests)) {
+    return EXIT_FAILURE;
+  }
   if (!Arcadia_Tests_safeExecute(&test)) {
     return EXIT_FAILURE;
   }
@@ -0,0 +1,189 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Arcadia/Ring1/Include.h"
+
+#define NumberOfValues (1024 * 64)
+#define SequentialThreshold (1024)
+
+typedef struct SumContext {
+  Arcadia_ThreadPool* pool;
+  Arcadia_Natural64Value const* values;
+  Arcadia_SizeValue numberOfValues;
+  Arcadia_Natural64Value sum;
+} SumContext;
+
+static void
+sumTask
+  (
+    Arcadia_Thread* thread,
+    void* context
+  )
+{
+  SumContext* self = (SumContext*)context;
+  if (self->numberOfValues <= SequentialThreshold) {
+    self->sum = 0;
+    for (Arcadia_SizeValue i = 0; i < self->numberOfValues; ++i) {
+      self->sum += self->values[i];
+    }
+    return;
+  }
+  Arcadia_SizeValue half = self->numberOfValues / 2;
+  SumContext left = { .pool = self->pool, .values = self->values, .numberOfValues = half, .sum = 0 };
+  SumContext right = { .pool = self->pool, .values = self->values + half, .numberOfValues = self->numberOfValues - half, .sum = 0 };
+  Arcadia_ThreadPool_Task* task = Arcadia_ThreadPool_fork(thread, self->pool, &sumTask, &left);
+  sumTask(thread, &right);
+  Arcadia_ThreadPool_join(thread, self->pool, task);
+  self->sum = left.sum + right.sum;
+}
+
+// Recursively split a sum into tasks forked by the workers and compare with the sequential sum.
+static void
+forkJoinTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Natural64Value* values = Arcadia_Memory_allocateUnmanaged(thread, sizeof(Arcadia_Natural64Value) * NumberOfValues);
+  Arcadia_Natural64Value expected = 0;
+  for (Arcadia_SizeValue i = 0; i < NumberOfValues; ++i) {
+    values[i] = i * 7 + 3;
+    expected += values[i];
+  }
+  Arcadia_SizeValue numbersOfWorkers[] = { 1, 4, 0 };
+  for (Arcadia_SizeValue i = 0; i < sizeof(numbersOfWorkers) / sizeof(Arcadia_SizeValue); ++i) {
+    Arcadia_ThreadPool* pool = Arcadia_ThreadPool_create(thread, numbersOfWorkers[i]);
+    SumContext context = { .pool = pool, .values = values, .numberOfValues = NumberOfValues, .sum = 0 };
+    Arcadia_ThreadPool_Task* task = Arcadia_ThreadPool_fork(thread, pool, &sumTask, &context);
+    Arcadia_ThreadPool_join(thread, pool, task);
+    Arcadia_ThreadPool_destroy(thread, pool);
+    Arcadia_Tests_assertTrue(thread, expected == context.sum);
+  }
+  Arcadia_Memory_deallocateUnmanaged(thread, values);
+}
+
+#define NumberOfTasks (64)
+#define NumberOfIterations (256)
+#define CollectInterval (64)
+
+// Each task allocates strings and names, keeps the strings on its value stack, and verifies them.
+// Some tasks run collections while the other tasks are allocating.
+static void
+stressTask
+  (
+    Arcadia_Thread* thread,
+    void* context
+  )
+{
+  Arcadia_SizeValue index = (Arcadia_SizeValue)(uintptr_t)context;
+  Arcadia_SizeValue base = Arcadia_ValueStack_getSize(thread);
+  for (Arcadia_SizeValue i = 0; i < NumberOfIterations; ++i) {
+    Arcadia_String* string = Arcadia_String_createFromSize(thread, index * NumberOfIterations + i);
+    Arcadia_ValueStack_pushObjectReferenceValue(thread, (Arcadia_ObjectReferenceValue)string);
+    Arcadia_Name* name = Arcadia_Names_getOrCreateName(thread, Arcadia_String_getBytes(thread, string), Arcadia_String_getNumberOfBytes(thread, string));
+    Arcadia_Tests_assertTrue(thread, name == Arcadia_Names_getOrCreateName(thread, Arcadia_String_getBytes(thread, string), Arcadia_String_getNumberOfBytes(thread, string)));
+    if (0 == index % 8 && 0 == (i + 1) % CollectInterval) {
+      Arcadia_Process_runARMS(Arcadia_Thread_getProcess(thread), false);
+    }
+    Arcadia_Thread_safepoint(thread);
+  }
+  for (Arcadia_SizeValue i = 0; i < NumberOfIterations; ++i) {
+    char expected[32];
+    snprintf(expected, sizeof(expected), "%zu", (size_t)(index * NumberOfIterations + i));
+    Arcadia_String* string = (Arcadia_String*)Arcadia_ValueStack_getObjectReferenceValue(thread, NumberOfIterations - 1 - i);
+    Arcadia_Tests_assertTrue(thread, strlen(expected) == Arcadia_String_getNumberOfBytes(thread, string));
+    Arcadia_Tests_assertTrue(thread, !memcmp(expected, Arcadia_String_getBytes(thread, string), strlen(expected)));
+  }
+  Arcadia_ValueStack_popValues(thread, Arcadia_ValueStack_getSize(thread) - base);
+}
+
+static void
+stressTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_ThreadPool* pool = Arcadia_ThreadPool_create(thread, 4);
+  Arcadia_ThreadPool_Task* tasks[NumberOfTasks];
+  for (Arcadia_SizeValue i = 0; i < NumberOfTasks; ++i) {
+    tasks[i] = Arcadia_ThreadPool_fork(thread, pool, &stressTask, (void*)(uintptr_t)i);
+  }
+  // Collect while the workers are allocating.
+  for (Arcadia_SizeValue i = 0; i < 8; ++i) {
+    Arcadia_Process_runARMS(Arcadia_Thread_getProcess(thread), false);
+  }
+  for (Arcadia_SizeValue i = 0; i < NumberOfTasks; ++i) {
+    Arcadia_ThreadPool_join(thread, pool, tasks[i]);
+  }
+  Arcadia_ThreadPool_destroy(thread, pool);
+}
+
+static void
+raiseTask
+  (
+    Arcadia_Thread* thread,
+    void* context
+  )
+{
+  Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+  Arcadia_Thread_jump(thread);
+}
+
+// The status raised by a task is raised by Arcadia_ThreadPool_join.
+static void
+errorTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_ThreadPool* pool = Arcadia_ThreadPool_create(thread, 2);
+  Arcadia_ThreadPool_Task* task = Arcadia_ThreadPool_fork(thread, pool, &raiseTask, NULL);
+  Arcadia_Status status = Arcadia_Status_Success;
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_ThreadPool_join(thread, pool, task);
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    status = Arcadia_Thread_getStatus(thread);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+  Arcadia_ThreadPool_destroy(thread, pool);
+  Arcadia_Tests_assertTrue(thread, Arcadia_Status_ArgumentValueInvalid == status);
+}
+
+int
+main
+  (
+    int argc,
+    char **argv
+  )
+{
+  if (!Arcadia_Tests_safeExecute(&forkJoinTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&stressTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&errorTests)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -19,6 +19,7 @@
 #include <string.h>
 
 #include "Arcadia/Ring1/Include.h"
+#include "Arcadia/FileSystem/Include.h"
 
 typedef struct Result {
   Arcadia_Natural32Value codePoint;
@@ -282,6 +283,192 @@ Arcadia_Ring1_Tests_UnicodeCodePointReaderTest3
   }
 }
 
+static void
+Arcadia_Ring1_Tests_UnicodeCodePointReaderTest4
+  (
+    Arcadia_Thread* thread
+  )
+{
+  {
+    Arcadia_Natural8Value bytes[] = {
+      0xF0, 0x9F, 0x98, 0x80, // "GRINNING FACE"/U+1F600/https://www.compart.com/de/unicode/U+1F600
+      0x61, // "a"/https://www.compart.com/de/unicode/U+0061
+    };
+    Result results[] = {
+      {.byteIndex = 0, .codePointLength = 4, .codePoint = 0x1F600, .error = false, },
+      {.byteIndex = 4, .codePointLength = 1, .codePoint = 0x0061, .error = false, },
+    };
+    testFixture(thread, &bytes[0], sizeof(bytes) / sizeof(Arcadia_Natural8Value), &results[0], sizeof(results) / sizeof(Result));
+  }
+  {
+    // Check if the parser rejects code points above U+10FFFF.
+    // b(11110100 10010000 10000000 10000000) = h(F4 90 80 80) would be U+110000.
+    Arcadia_Natural8Value bytes[] = {
+      0xF4,
+      0x90,
+      0x80,
+      0x80,
+    };
+    Result results[] = {
+      {.byteIndex = 0, .codePointLength = 0, .codePoint = 0, .error = true },
+    };
+    testFixture(thread, &bytes[0], sizeof(bytes) / sizeof(Arcadia_Natural8Value), &results[0], sizeof(results) / sizeof(Result));
+  }
+}
+
+// Decode ASCII runs and multi-Byte sequences which straddle the boundaries of the read-ahead buffer.
+static void
+Arcadia_Ring1_Tests_UnicodeCodePointReaderTest5
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static const Arcadia_Natural8Value pattern[] = {
+    'h', 'e', 'l', 'l', 'o', ',', ' ', 'w', 'o', 'r', 'l', 'd', ' ',
+    0xCF, 0x80, // "GREEK SMALL LETTER PI"/U+03C0/https://www.compart.com/de/unicode/U+03C0
+    0xE2, 0x80, 0x93, // "EN DASH"/U+2013/https://www.compart.com/de/unicode/U+2013
+    0xF0, 0x9F, 0x98, 0x80, // "GRINNING FACE"/U+1F600/https://www.compart.com/de/unicode/U+1F600
+  };
+  static const Arcadia_Natural32Value codePoints[] = {
+    'h', 'e', 'l', 'l', 'o', ',', ' ', 'w', 'o', 'r', 'l', 'd', ' ',
+    0x03C0,
+    0x2013,
+    0x1F600,
+  };
+  static const Arcadia_SizeValue numberOfRepetitions = 257;
+  Arcadia_ByteArrayBuilder* source = Arcadia_ByteArrayBuilder_create(thread);
+  for (Arcadia_SizeValue i = 0; i < numberOfRepetitions; ++i) {
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, source, pattern, sizeof(pattern));
+    // Shift the pattern by one Byte relative to the buffer boundaries.
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, source, "x", 1);
+  }
+  Arcadia_ByteReader* readers[] = {
+    (Arcadia_ByteReader*)Arcadia_ByteArrayBuilder_ByteReader_create(thread, source),
+    (Arcadia_ByteReader*)Arcadia_String_ByteReader_create(thread, Arcadia_String_create(thread, Arcadia_Value_makeObjectReferenceValue(source))),
+  };
+  for (Arcadia_SizeValue r = 0; r < sizeof(readers) / sizeof(readers[0]); ++r) {
+    Arcadia_UnicodeCodePointReader* x = (Arcadia_UnicodeCodePointReader*)Arcadia_ByteReader_UnicodeCodePointReader_create(thread, readers[r]);
+    Arcadia_SizeValue byteIndex = 0;
+    for (Arcadia_SizeValue i = 0; i < numberOfRepetitions; ++i) {
+      for (Arcadia_SizeValue j = 0; j < sizeof(codePoints) / sizeof(codePoints[0]); ++j) {
+        Arcadia_Tests_assertTrue(thread, Arcadia_UnicodeCodePointReader_hasValue(thread, x));
+        Arcadia_Tests_assertTrue(thread, codePoints[j] == Arcadia_UnicodeCodePointReader_getValue(thread, x));
+        Arcadia_SizeValue s, n;
+        Arcadia_UnicodeCodePointReader_getByteRange(thread, x, &s, &n);
+        Arcadia_Tests_assertTrue(thread, byteIndex == s);
+        byteIndex += n;
+        Arcadia_UnicodeCodePointReader_nextValue(thread, x);
+      }
+      Arcadia_Tests_assertTrue(thread, 'x' == Arcadia_UnicodeCodePointReader_getValue(thread, x));
+      byteIndex += 1;
+      Arcadia_UnicodeCodePointReader_nextValue(thread, x);
+    }
+    Arcadia_Tests_assertTrue(thread, !Arcadia_UnicodeCodePointReader_hasValue(thread, x));
+    Arcadia_Tests_assertTrue(thread, !Arcadia_UnicodeCodePointReader_hasError(thread, x));
+    Arcadia_Tests_assertTrue(thread, byteIndex == Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, source));
+  }
+}
+
+// The span interface and the per-Byte interface of a Byte reader observe the same position.
+static void
+Arcadia_Ring1_Tests_UnicodeCodePointReaderTest6
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_ByteArrayBuilder* source = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, source, "abcdef", 6);
+  Arcadia_ByteReader* x = (Arcadia_ByteReader*)Arcadia_ByteArrayBuilder_ByteReader_create(thread, source);
+  Arcadia_Natural8Value const* bytes = NULL;
+  Arcadia_SizeValue numberOfBytes = 0;
+  Arcadia_ByteReader_getSpan(thread, x, &bytes, &numberOfBytes);
+  Arcadia_Tests_assertTrue(thread, 6 == numberOfBytes && 'a' == bytes[0]);
+  Arcadia_ByteReader_advance(thread, x, 2);
+  Arcadia_Tests_assertTrue(thread, 'c' == Arcadia_ByteReader_getValue(thread, x));
+  Arcadia_ByteReader_nextValue(thread, x);
+  Arcadia_ByteReader_getSpan(thread, x, &bytes, &numberOfBytes);
+  Arcadia_Tests_assertTrue(thread, 3 == numberOfBytes && 'd' == bytes[0]);
+  // Advancing past the end is an error and does not change the position.
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_ByteReader_advance(thread, x, 4);
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+    Arcadia_Thread_jump(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_Status_OperationInvalid == Arcadia_Thread_getStatus(thread));
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+  Arcadia_ByteReader_advance(thread, x, 3);
+  Arcadia_Tests_assertTrue(thread, !Arcadia_ByteReader_hasValue(thread, x));
+  Arcadia_ByteReader_getSpan(thread, x, &bytes, &numberOfBytes);
+  Arcadia_Tests_assertTrue(thread, 0 == numberOfBytes);
+}
+
+// Decode a file through a file mapping Byte reader and check its span and advance against its per-Byte interface.
+static void
+Arcadia_Ring1_Tests_UnicodeCodePointReaderTest7
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static const Arcadia_Natural8Value bytes[] = {
+    'a', 'b',
+    0xCF, 0x80, // "GREEK SMALL LETTER PI"/U+03C0/https://www.compart.com/de/unicode/U+03C0
+    0xF0, 0x9F, 0x98, 0x80, // "GRINNING FACE"/U+1F600/https://www.compart.com/de/unicode/U+1F600
+    'c',
+  };
+  static const Arcadia_Natural32Value codePoints[] = {
+    'a', 'b', 0x03C0, 0x1F600, 'c',
+  };
+  Arcadia_FileSystem* fileSystem = Arcadia_FileSystem_getOrCreate(thread);
+  Arcadia_FilePath* path = Arcadia_FilePath_parseGeneric(thread, Arcadia_String_createFromCxxString(thread, u8"FileMappingByteReader.txt"));
+  Arcadia_ByteArrayBuilder* contents = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, contents, bytes, sizeof(bytes));
+  Arcadia_FileSystem_setFileContents(thread, fileSystem, path, contents);
+  Arcadia_FileMapping* mapping = Arcadia_FileSystem_mapFile(thread, fileSystem, path);
+
+  Arcadia_UnicodeCodePointReader* x = (Arcadia_UnicodeCodePointReader*)Arcadia_ByteReader_UnicodeCodePointReader_create(thread, (Arcadia_ByteReader*)Arcadia_FileMapping_ByteReader_create(thread, mapping));
+  for (Arcadia_SizeValue i = 0; i < sizeof(codePoints) / sizeof(codePoints[0]); ++i) {
+    Arcadia_Tests_assertTrue(thread, Arcadia_UnicodeCodePointReader_hasValue(thread, x));
+    Arcadia_Tests_assertTrue(thread, codePoints[i] == Arcadia_UnicodeCodePointReader_getValue(thread, x));
+    Arcadia_UnicodeCodePointReader_nextValue(thread, x);
+  }
+  Arcadia_Tests_assertTrue(thread, !Arcadia_UnicodeCodePointReader_hasValue(thread, x));
+  Arcadia_Tests_assertTrue(thread, !Arcadia_UnicodeCodePointReader_hasError(thread, x));
+
+  Arcadia_ByteReader* y = (Arcadia_ByteReader*)Arcadia_FileMapping_ByteReader_create(thread, mapping);
+  Arcadia_Natural8Value const* span = NULL;
+  Arcadia_SizeValue numberOfBytes = 0;
+  Arcadia_ByteReader_getSpan(thread, y, &span, &numberOfBytes);
+  Arcadia_Tests_assertTrue(thread, sizeof(bytes) == numberOfBytes && !Arcadia_Memory_compare(thread, span, bytes, sizeof(bytes)));
+  Arcadia_ByteReader_advance(thread, y, 2);
+  Arcadia_Tests_assertTrue(thread, 0xCF == Arcadia_ByteReader_getValue(thread, y));
+  Arcadia_ByteReader_nextValue(thread, y);
+  Arcadia_ByteReader_getSpan(thread, y, &span, &numberOfBytes);
+  Arcadia_Tests_assertTrue(thread, sizeof(bytes) - 3 == numberOfBytes && 0x80 == span[0]);
+  // Advancing past the end is an error and does not change the position.
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_ByteReader_advance(thread, y, sizeof(bytes) - 2);
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+    Arcadia_Thread_jump(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_Status_OperationInvalid == Arcadia_Thread_getStatus(thread));
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+  Arcadia_Tests_assertTrue(thread, 0x80 == Arcadia_ByteReader_getValue(thread, y));
+  Arcadia_ByteReader_advance(thread, y, sizeof(bytes) - 3);
+  Arcadia_Tests_assertTrue(thread, !Arcadia_ByteReader_hasValue(thread, y));
+  Arcadia_ByteReader_getSpan(thread, y, &span, &numberOfBytes);
+  Arcadia_Tests_assertTrue(thread, 0 == numberOfBytes);
+}
+
 int
 main
   (
@@ -298,5 +485,17 @@ main
   if (!Arcadia_Tests_safeExecute(&Arcadia_Ring1_Tests_UnicodeCodePointReaderTest3)) {
     return EXIT_FAILURE;
   }
+  if (!Arcadia_Tests_safeExecute(&Arcadia_Ring1_Tests_UnicodeCodePointReaderTest4)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&Arcadia_Ring1_Tests_UnicodeCodePointReaderTest5)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&Arcadia_Ring1_Tests_UnicodeCodePointReaderTest6)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&Arcadia_Ring1_Tests_UnicodeCodePointReaderTest7)) {
+    return EXIT_FAILURE;
+  }
   return EXIT_SUCCESS;
 }
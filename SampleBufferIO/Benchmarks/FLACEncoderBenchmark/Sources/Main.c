@@ -0,0 +1,274 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <math.h>
+#include <stdio.h>
+
+#include "Arcadia/SampleBufferIO/Include.h"
+#include "Arcadia/Benchmarks/Harness/Driver.h"
+
+// The sample rate.
+#define SampleRate (44100)
+
+// The length, in seconds, of the generated signals.
+#define Length (5)
+
+// The signal to encode.
+static Arcadia_Media_SampleBuffer* g_sampleBuffer = NULL;
+
+// The encoder.
+static Arcadia_SampleBufferIO_FLACEncoder* g_encoder = NULL;
+
+// The number of recording benchmarks.
+#define NumberOfRecordingBenchmarks (6)
+
+// The benchmarks of the recording.
+// The number of operations is updated by setUp when the recording was loaded.
+static Arcadia_Benchmarks_Benchmark g_recordingBenchmarks[NumberOfRecordingBenchmarks];
+
+static Arcadia_Media_SampleBuffer*
+createSineWave
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Media_SampleBuffer* sampleBuffer = Arcadia_Media_SampleBuffer_create(thread, Length, SampleRate, Arcadia_Media_SampleFormat_Integer16);
+  Arcadia_Media_SampleBuffer_fill(thread, sampleBuffer, (Arcadia_Media_DSP*)Arcadia_Media_DSP_SineWave_create(thread, 440));
+  return sampleBuffer;
+}
+
+static Arcadia_Media_SampleBuffer*
+createWhiteNoise
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Media_SampleBuffer* sampleBuffer = Arcadia_Media_SampleBuffer_create(thread, Length, SampleRate, Arcadia_Media_SampleFormat_Integer16);
+  Arcadia_Media_SampleBuffer_fill(thread, sampleBuffer, (Arcadia_Media_DSP*)Arcadia_Media_DSP_WhiteNoise_create(thread));
+  return sampleBuffer;
+}
+
+// A stand-in for recorded material: notes of a piano-like instrument (decaying harmonics) over a noise floor.
+static void
+fillInstrument
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleBuffer* sampleBuffer
+  )
+{
+  static const double frequencies[] = { 261.63, 329.63, 392.00, 523.25, 440.00, 349.23 };
+  Arcadia_Integer16Value* samples = (Arcadia_Integer16Value*)sampleBuffer->bytes;
+  Arcadia_Natural32Value seed = 5;
+  for (Arcadia_SizeValue i = 0; i < (Arcadia_SizeValue)Length * SampleRate; ++i) {
+    double t = (double)(i % (SampleRate / 2)) / (double)SampleRate;
+    double f = frequencies[(i / (SampleRate / 2)) % (sizeof(frequencies) / sizeof(frequencies[0]))];
+    double x = 0.;
+    for (Arcadia_SizeValue h = 1; h <= 6; ++h) {
+      x += sin(2. * 3.14159265358979323846 * f * (double)h * t) * exp(-t * 3. * (double)h) / (double)h;
+    }
+    seed = seed * 1664525 + 1013904223;
+    double noise = ((double)(seed >> 16) / 65536. - 0.5) * 0.002;
+    x = x * 0.4 + noise;
+    x = x > 1. ? 1. : x < -1. ? -1. : x;
+    samples[i] = (Arcadia_Integer16Value)(x * 32767.);
+  }
+}
+
+static Arcadia_Media_SampleBuffer*
+createInstrument
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Media_SampleBuffer* sampleBuffer = Arcadia_Media_SampleBuffer_create(thread, Length, SampleRate, Arcadia_Media_SampleFormat_Integer16);
+  fillInstrument(thread, sampleBuffer);
+  return sampleBuffer;
+}
+
+// Load recorded material (raw 16 bit signed little endian mono samples at 44100 Hz) from the `--input` file.
+static Arcadia_Media_SampleBuffer*
+createRecording
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_ByteArrayBuilder* contents = Arcadia_FileSystem_getFileContents(thread, Arcadia_FileSystem_getOrCreate(thread), Arcadia_FilePath_parseNative(thread, Arcadia_Benchmarks_getInput()));
+  Arcadia_Natural8Value const* bytes = Arcadia_ByteArrayBuilder_getBytes(thread, contents);
+  Arcadia_Integer32Value length = (Arcadia_Integer32Value)(Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, contents) / (2 * SampleRate));
+  if (length < 1) {
+    fprintf(stderr, "the recording is shorter than one second\n");
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Media_SampleBuffer* sampleBuffer = Arcadia_Media_SampleBuffer_create(thread, length, SampleRate, Arcadia_Media_SampleFormat_Integer16);
+  Arcadia_SizeValue numberOfSamples = (Arcadia_SizeValue)length * SampleRate;
+  for (Arcadia_SizeValue i = 0; i < numberOfSamples; ++i) {
+    ((Arcadia_Integer16Value*)sampleBuffer->bytes)[i] = (Arcadia_Integer16Value)(Arcadia_Natural16Value)(bytes[2 * i] | (bytes[2 * i + 1] << 8));
+  }
+  return sampleBuffer;
+}
+
+static void
+setUp
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleBuffer* (*create)(Arcadia_Thread* thread),
+    Arcadia_Integer32Value compressionLevel,
+    Arcadia_SizeValue numberOfWorkers
+  )
+{
+  g_sampleBuffer = create(thread);
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_sampleBuffer);
+  if (create == &createRecording) {
+    for (Arcadia_SizeValue i = 0; i < NumberOfRecordingBenchmarks; ++i) {
+      g_recordingBenchmarks[i].numberOfOperations = (Arcadia_SizeValue)Arcadia_Media_SampleBuffer_getLength(thread, g_sampleBuffer) * SampleRate;
+    }
+  }
+  g_encoder = Arcadia_SampleBufferIO_FLACEncoder_create(thread);
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_encoder);
+  Arcadia_SampleBufferIO_FLACEncoder_setCompressionLevel(thread, g_encoder, compressionLevel);
+  Arcadia_SampleBufferIO_FLACEncoder_setNumberOfWorkers(thread, g_encoder, numberOfWorkers);
+}
+
+static void
+tearDown
+  (
+    Arcadia_Thread* thread
+  )
+{
+  if (g_encoder) {
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)g_encoder);
+    g_encoder = NULL;
+  }
+  if (g_sampleBuffer) {
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)g_sampleBuffer);
+    g_sampleBuffer = NULL;
+  }
+}
+
+static void
+run
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_ByteArrayBuilder* target = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_SampleBufferIO_FLACEncoder_encodeToByteArrayBuilder(thread, g_encoder, g_sampleBuffer, target);
+}
+
+// A numberOfWorkers of 0 uses all cores.
+#define DefineSetUp(Name, Create, CompressionLevel, NumberOfWorkers) \
+  static void \
+  setUp##Name \
+    ( \
+      Arcadia_Thread* thread \
+    ) \
+  { setUp(thread, Create, CompressionLevel, NumberOfWorkers); }
+
+DefineSetUp(SineWaveLevel0SingleWorker, &createSineWave, 0, 1)
+DefineSetUp(SineWaveLevel0AllCores, &createSineWave, 0, 0)
+DefineSetUp(SineWaveLevel5SingleWorker, &createSineWave, 5, 1)
+DefineSetUp(SineWaveLevel5AllCores, &createSineWave, 5, 0)
+DefineSetUp(SineWaveLevel8SingleWorker, &createSineWave, 8, 1)
+DefineSetUp(SineWaveLevel8AllCores, &createSineWave, 8, 0)
+
+DefineSetUp(WhiteNoiseLevel0SingleWorker, &createWhiteNoise, 0, 1)
+DefineSetUp(WhiteNoiseLevel0AllCores, &createWhiteNoise, 0, 0)
+DefineSetUp(WhiteNoiseLevel5SingleWorker, &createWhiteNoise, 5, 1)
+DefineSetUp(WhiteNoiseLevel5AllCores, &createWhiteNoise, 5, 0)
+DefineSetUp(WhiteNoiseLevel8SingleWorker, &createWhiteNoise, 8, 1)
+DefineSetUp(WhiteNoiseLevel8AllCores, &createWhiteNoise, 8, 0)
+
+DefineSetUp(InstrumentLevel0SingleWorker, &createInstrument, 0, 1)
+DefineSetUp(InstrumentLevel0AllCores, &createInstrument, 0, 0)
+DefineSetUp(InstrumentLevel5SingleWorker, &createInstrument, 5, 1)
+DefineSetUp(InstrumentLevel5AllCores, &createInstrument, 5, 0)
+DefineSetUp(InstrumentLevel8SingleWorker, &createInstrument, 8, 1)
+DefineSetUp(InstrumentLevel8AllCores, &createInstrument, 8, 0)
+
+DefineSetUp(RecordingLevel0SingleWorker, &createRecording, 0, 1)
+DefineSetUp(RecordingLevel0AllCores, &createRecording, 0, 0)
+DefineSetUp(RecordingLevel5SingleWorker, &createRecording, 5, 1)
+DefineSetUp(RecordingLevel5AllCores, &createRecording, 5, 0)
+DefineSetUp(RecordingLevel8SingleWorker, &createRecording, 8, 1)
+DefineSetUp(RecordingLevel8AllCores, &createRecording, 8, 0)
+
+
+// One operation is one sample.
+static Arcadia_Benchmarks_Benchmark const g_benchmarks[] = {
+  { u8"sine wave L0 1 worker", Length * SampleRate, &setUpSineWaveLevel0SingleWorker, &run, &tearDown },
+  { u8"sine wave L0 all cores", Length * SampleRate, &setUpSineWaveLevel0AllCores, &run, &tearDown },
+  { u8"sine wave L5 1 worker", Length * SampleRate, &setUpSineWaveLevel5SingleWorker, &run, &tearDown },
+  { u8"sine wave L5 all cores", Length * SampleRate, &setUpSineWaveLevel5AllCores, &run, &tearDown },
+  { u8"sine wave L8 1 worker", Length * SampleRate, &setUpSineWaveLevel8SingleWorker, &run, &tearDown },
+  { u8"sine wave L8 all cores", Length * SampleRate, &setUpSineWaveLevel8AllCores, &run, &tearDown },
+  { u8"white noise L0 1 worker", Length * SampleRate, &setUpWhiteNoiseLevel0SingleWorker, &run, &tearDown },
+  { u8"white noise L0 all cores", Length * SampleRate, &setUpWhiteNoiseLevel0AllCores, &run, &tearDown },
+  { u8"white noise L5 1 worker", Length * SampleRate, &setUpWhiteNoiseLevel5SingleWorker, &run, &tearDown },
+  { u8"white noise L5 all cores", Length * SampleRate, &setUpWhiteNoiseLevel5AllCores, &run, &tearDown },
+  { u8"white noise L8 1 worker", Length * SampleRate, &setUpWhiteNoiseLevel8SingleWorker, &run, &tearDown },
+  { u8"white noise L8 all cores", Length * SampleRate, &setUpWhiteNoiseLevel8AllCores, &run, &tearDown },
+  { u8"instrument L0 1 worker", Length * SampleRate, &setUpInstrumentLevel0SingleWorker, &run, &tearDown },
+  { u8"instrument L0 all cores", Length * SampleRate, &setUpInstrumentLevel0AllCores, &run, &tearDown },
+  { u8"instrument L5 1 worker", Length * SampleRate, &setUpInstrumentLevel5SingleWorker, &run, &tearDown },
+  { u8"instrument L5 all cores", Length * SampleRate, &setUpInstrumentLevel5AllCores, &run, &tearDown },
+  { u8"instrument L8 1 worker", Length * SampleRate, &setUpInstrumentLevel8SingleWorker, &run, &tearDown },
+  { u8"instrument L8 all cores", Length * SampleRate, &setUpInstrumentLevel8AllCores, &run, &tearDown },
+};
+
+static Arcadia_Benchmarks_Benchmark g_recordingBenchmarks[NumberOfRecordingBenchmarks] = {
+  { u8"recording L0 1 worker", 1, &setUpRecordingLevel0SingleWorker, &run, &tearDown },
+  { u8"recording L0 all cores", 1, &setUpRecordingLevel0AllCores, &run, &tearDown },
+  { u8"recording L5 1 worker", 1, &setUpRecordingLevel5SingleWorker, &run, &tearDown },
+  { u8"recording L5 all cores", 1, &setUpRecordingLevel5AllCores, &run, &tearDown },
+  { u8"recording L8 1 worker", 1, &setUpRecordingLevel8SingleWorker, &run, &tearDown },
+  { u8"recording L8 all cores", 1, &setUpRecordingLevel8AllCores, &run, &tearDown },
+};
+
+static Arcadia_Benchmarks_Benchmark const*
+getBenchmarks
+  (
+    Arcadia_SizeValue* numberOfBenchmarks
+  )
+{
+  *numberOfBenchmarks = sizeof(g_benchmarks) / sizeof(Arcadia_Benchmarks_Benchmark);
+  return g_benchmarks;
+}
+
+// The recording benchmarks are only run if a recording was specified.
+static Arcadia_Benchmarks_Benchmark const*
+getRecordingBenchmarks
+  (
+    Arcadia_SizeValue* numberOfBenchmarks
+  )
+{
+  *numberOfBenchmarks = Arcadia_Benchmarks_getInput() ? NumberOfRecordingBenchmarks : 0;
+  return g_recordingBenchmarks;
+}
+
+static Arcadia_Benchmarks_GetBenchmarks* const g_groups[] = {
+  &getBenchmarks,
+  &getRecordingBenchmarks,
+};
+
+// Usage: Arcadia.SampleBufferIO.Benchmarks.FLACEncoderBenchmark [--input=<path to raw 16 bit signed little endian mono samples at 44100 Hz>]
+// See Arcadia_Benchmarks_main for the other command line arguments.
+int
+main
+  (
+    int argc,
+    char** argv
+  )
+{ return Arcadia_Benchmarks_main(argc, argv, g_groups, sizeof(g_groups) / sizeof(Arcadia_Benchmarks_GetBenchmarks*)); }
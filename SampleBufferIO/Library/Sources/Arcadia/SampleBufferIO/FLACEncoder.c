@@ -0,0 +1,1475 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/SampleBufferIO/FLACEncoder.h"
+
+#include <math.h>
+#include <string.h>
+
+/// The default compression level.
+#define DefaultCompressionLevel (5)
+
+/// The default block size.
+#define DefaultBlockSize (4096)
+
+/// The number of frames per job.
+#define FramesPerJob (4)
+
+/// The number of jobs per worker which are in flight.
+#define JobsPerWorker (2)
+
+/// The maximum order of a fixed predictor.
+#define MaximumFixedOrder (4)
+
+/// The maximum order of a linear predictor.
+#define MaximumLPCOrder (32)
+
+/// The maximum partition order.
+#define MaximumPartitionOrder (8)
+
+/// The maximum Rice parameter of the residual coding method with 4 bit parameters.
+/// The parameter 15 is the escape code.
+#define MaximumRice4Parameter (14)
+
+/// The maximum Rice parameter of the residual coding method with 5 bit parameters.
+/// The parameter 31 is the escape code.
+#define MaximumRice5Parameter (30)
+
+typedef struct Settings {
+  // The maximum order of linear predictors. If 0, then only fixed predictors are used.
+  Arcadia_SizeValue maximumLPCOrder;
+  // The maximum partition order.
+  Arcadia_SizeValue maximumPartitionOrder;
+  // If all orders of linear predictors are tried or only the order with the smallest estimated size.
+  Arcadia_BooleanValue exhaustiveLPCOrderSearch;
+} Settings;
+
+// The settings of the compression levels 0 to 8.
+static const Settings g_settings[] = {
+  { 0, 3, Arcadia_BooleanValue_False },
+  { 0, 4, Arcadia_BooleanValue_False },
+  { 0, 5, Arcadia_BooleanValue_False },
+  { 6, 4, Arcadia_BooleanValue_False },
+  { 8, 4, Arcadia_BooleanValue_False },
+  { 8, 5, Arcadia_BooleanValue_False },
+  { 8, 6, Arcadia_BooleanValue_False },
+  { 12, 6, Arcadia_BooleanValue_False },
+  { 12, 6, Arcadia_BooleanValue_True },
+};
+
+// The CRC-16 table (polynomial x^16 + x^15 + x^2 + 1).
+static const Arcadia_Natural16Value g_crc16[256] = {
+  0x0000, 0x8005, 0x800f, 0x000a, 0x801b, 0x001e, 0x0014, 0x8011,
+  0x8033, 0x0036, 0x003c, 0x8039, 0x0028, 0x802d, 0x8027, 0x0022,
+  0x8063, 0x0066, 0x006c, 0x8069, 0x0078, 0x807d, 0x8077, 0x0072,
+  0x0050, 0x8055, 0x805f, 0x005a, 0x804b, 0x004e, 0x0044, 0x8041,
+  0x80c3, 0x00c6, 0x00cc, 0x80c9, 0x00d8, 0x80dd, 0x80d7, 0x00d2,
+  0x00f0, 0x80f5, 0x80ff, 0x00fa, 0x80eb, 0x00ee, 0x00e4, 0x80e1,
+  0x00a0, 0x80a5, 0x80af, 0x00aa, 0x80bb, 0x00be, 0x00b4, 0x80b1,
+  0x8093, 0x0096, 0x009c, 0x8099, 0x0088, 0x808d, 0x8087, 0x0082,
+  0x8183, 0x0186, 0x018c, 0x8189, 0x0198, 0x819d, 0x8197, 0x0192,
+  0x01b0, 0x81b5, 0x81bf, 0x01ba, 0x81ab, 0x01ae, 0x01a4, 0x81a1,
+  0x01e0, 0x81e5, 0x81ef, 0x01ea, 0x81fb, 0x01fe, 0x01f4, 0x81f1,
+  0x81d3, 0x01d6, 0x01dc, 0x81d9, 0x01c8, 0x81cd, 0x81c7, 0x01c2,
+  0x0140, 0x8145, 0x814f, 0x014a, 0x815b, 0x015e, 0x0154, 0x8151,
+  0x8173, 0x0176, 0x017c, 0x8179, 0x0168, 0x816d, 0x8167, 0x0162,
+  0x8123, 0x0126, 0x012c, 0x8129, 0x0138, 0x813d, 0x8137, 0x0132,
+  0x0110, 0x8115, 0x811f, 0x011a, 0x810b, 0x010e, 0x0104, 0x8101,
+  0x8303, 0x0306, 0x030c, 0x8309, 0x0318, 0x831d, 0x8317, 0x0312,
+  0x0330, 0x8335, 0x833f, 0x033a, 0x832b, 0x032e, 0x0324, 0x8321,
+  0x0360, 0x8365, 0x836f, 0x036a, 0x837b, 0x037e, 0x0374, 0x8371,
+  0x8353, 0x0356, 0x035c, 0x8359, 0x0348, 0x834d, 0x8347, 0x0342,
+  0x03c0, 0x83c5, 0x83cf, 0x03ca, 0x83db, 0x03de, 0x03d4, 0x83d1,
+  0x83f3, 0x03f6, 0x03fc, 0x83f9, 0x03e8, 0x83ed, 0x83e7, 0x03e2,
+  0x83a3, 0x03a6, 0x03ac, 0x83a9, 0x03b8, 0x83bd, 0x83b7, 0x03b2,
+  0x0390, 0x8395, 0x839f, 0x039a, 0x838b, 0x038e, 0x0384, 0x8381,
+  0x0280, 0x8285, 0x828f, 0x028a, 0x829b, 0x029e, 0x0294, 0x8291,
+  0x82b3, 0x02b6, 0x02bc, 0x82b9, 0x02a8, 0x82ad, 0x82a7, 0x02a2,
+  0x82e3, 0x02e6, 0x02ec, 0x82e9, 0x02f8, 0x82fd, 0x82f7, 0x02f2,
+  0x02d0, 0x82d5, 0x82df, 0x02da, 0x82cb, 0x02ce, 0x02c4, 0x82c1,
+  0x8243, 0x0246, 0x024c, 0x8249, 0x0258, 0x825d, 0x8257, 0x0252,
+  0x0270, 0x8275, 0x827f, 0x027a, 0x826b, 0x026e, 0x0264, 0x8261,
+  0x0220, 0x8225, 0x822f, 0x022a, 0x823b, 0x023e, 0x0234, 0x8231,
+  0x8213, 0x0216, 0x021c, 0x8219, 0x0208, 0x820d, 0x8207, 0x0202,
+};
+
+typedef struct Stream {
+  Arcadia_Natural8Value const* bytes;
+  Arcadia_Media_SampleFormat sampleFormat;
+  Arcadia_SizeValue numberOfSamples;
+  Arcadia_Natural32Value sampleRate;
+  // The number of bits per sample, 8 or 16.
+  Arcadia_SizeValue bitsPerSample;
+  Arcadia_SizeValue blockSize;
+  Arcadia_SizeValue numberOfFrames;
+  Settings settings;
+} Stream;
+
+typedef struct Job {
+  Stream const* stream;
+  Arcadia_SizeValue firstFrame;
+  Arcadia_SizeValue numberOfFrames;
+  // The encoded Bytes.
+  Arcadia_Natural8Value* bytes;
+  Arcadia_SizeValue numberOfBytes;
+  // The task if this job was forked into a thread pool, null otherwise.
+  Arcadia_ThreadPool_Task* task;
+} Job;
+
+typedef struct BitWriter {
+  // The Bytes. The capacity is sufficient for all Bytes written.
+  Arcadia_Natural8Value* bytes;
+  // The number of Bytes written.
+  Arcadia_SizeValue position;
+  // The lower numberOfBits bits are the bits not yet written.
+  Arcadia_Natural64Value accumulator;
+  Arcadia_SizeValue numberOfBits;
+} BitWriter;
+
+// Write the lower n bits of a value, n in [0,32].
+static inline void
+writeBits
+  (
+    BitWriter* w,
+    Arcadia_Natural32Value value,
+    Arcadia_SizeValue n
+  )
+{
+  w->accumulator = (w->accumulator << n) | (value & ((((Arcadia_Natural64Value)1) << n) - 1));
+  w->numberOfBits += n;
+  while (w->numberOfBits >= 8) {
+    w->numberOfBits -= 8;
+    w->bytes[w->position++] = (Arcadia_Natural8Value)(w->accumulator >> w->numberOfBits);
+  }
+}
+
+// Write a signed value in two's complement with n bits, n in [1,32].
+static inline void
+writeSignedBits
+  (
+    BitWriter* w,
+    Arcadia_Integer32Value value,
+    Arcadia_SizeValue n
+  )
+{ writeBits(w, (Arcadia_Natural32Value)value, n); }
+
+// Write a value with a Rice parameter k: the quotient value >> k in unary, then the lower k bits of value.
+static inline void
+writeRice
+  (
+    BitWriter* w,
+    Arcadia_Natural32Value value,
+    Arcadia_SizeValue k
+  )
+{
+  Arcadia_Natural32Value q = value >> k;
+  while (q >= 32) {
+    writeBits(w, 0, 32);
+    q -= 32;
+  }
+  if (q + 1 + k <= 32) {
+    writeBits(w, (((Arcadia_Natural32Value)1) << k) | (value & ((((Arcadia_Natural32Value)1) << k) - 1)), q + 1 + k);
+  } else {
+    writeBits(w, 1, q + 1);
+    writeBits(w, value, k);
+  }
+}
+
+// Pad with zero bits to the next Byte boundary.
+static inline void
+alignToByte
+  (
+    BitWriter* w
+  )
+{
+  if (w->numberOfBits) {
+    writeBits(w, 0, 8 - w->numberOfBits);
+  }
+}
+
+static Arcadia_Natural8Value
+crc8
+  (
+    Arcadia_Natural8Value const* p,
+    Arcadia_SizeValue n
+  )
+{
+  Arcadia_Natural8Value crc = 0;
+  for (Arcadia_SizeValue i = 0; i < n; ++i) {
+    crc ^= p[i];
+    for (Arcadia_SizeValue j = 0; j < 8; ++j) {
+      crc = (Arcadia_Natural8Value)(crc & 0x80 ? (crc << 1) ^ 0x07 : crc << 1);
+    }
+  }
+  return crc;
+}
+
+static Arcadia_Natural16Value
+crc16
+  (
+    Arcadia_Natural8Value const* p,
+    Arcadia_SizeValue n
+  )
+{
+  Arcadia_Natural16Value crc = 0;
+  for (Arcadia_SizeValue i = 0; i < n; ++i) {
+    crc = (Arcadia_Natural16Value)((crc << 8) ^ g_crc16[(crc >> 8) ^ p[i]]);
+  }
+  return crc;
+}
+
+// Map a signed value to an unsigned value: 0, -1, 1, -2, 2, ... to 0, 1, 2, 3, 4, ...
+static inline Arcadia_Natural32Value
+fold
+  (
+    Arcadia_Integer32Value x
+  )
+{ return (((Arcadia_Natural32Value)x) << 1) ^ (Arcadia_Natural32Value)(x >> 31); }
+
+// Load samples and convert them to signed samples.
+static void
+loadSamples
+  (
+    Stream const* stream,
+    Arcadia_SizeValue first,
+    Arcadia_SizeValue n,
+    Arcadia_Integer32Value* target
+  )
+{
+  switch (stream->sampleFormat) {
+    case Arcadia_Media_SampleFormat_Integer8: {
+      Arcadia_Integer8Value const* p = ((Arcadia_Integer8Value const*)stream->bytes) + first;
+      for (Arcadia_SizeValue i = 0; i < n; ++i) {
+        target[i] = p[i];
+      }
+    } break;
+    case Arcadia_Media_SampleFormat_Natural8: {
+      Arcadia_Natural8Value const* p = ((Arcadia_Natural8Value const*)stream->bytes) + first;
+      for (Arcadia_SizeValue i = 0; i < n; ++i) {
+        target[i] = (Arcadia_Integer32Value)p[i] - 128;
+      }
+    } break;
+    case Arcadia_Media_SampleFormat_Integer16: {
+      Arcadia_Integer16Value const* p = ((Arcadia_Integer16Value const*)stream->bytes) + first;
+      for (Arcadia_SizeValue i = 0; i < n; ++i) {
+        target[i] = p[i];
+      }
+    } break;
+    case Arcadia_Media_SampleFormat_Natural16: {
+      Arcadia_Natural16Value const* p = ((Arcadia_Natural16Value const*)stream->bytes) + first;
+      for (Arcadia_SizeValue i = 0; i < n; ++i) {
+        target[i] = (Arcadia_Integer32Value)p[i] - 32768;
+      }
+    } break;
+    default: {
+      /*Intentionally empty.*/
+    } break;
+  };
+}
+
+// MD5 (RFC 1321) of the samples as signed little endian values.
+typedef struct MD5 {
+  Arcadia_Natural32Value state[4];
+  Arcadia_Natural64Value numberOfBytes;
+  Arcadia_Natural8Value buffer[64];
+} MD5;
+
+static const Arcadia_Natural32Value g_md5K[64] = {
+  0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+  0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+  0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+  0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+  0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+  0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+  0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+  0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391,
+};
+
+static const Arcadia_Natural8Value g_md5S[64] = {
+  7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+  5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20,
+  4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+  6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21,
+};
+
+static void
+MD5_initialize
+  (
+    MD5* self
+  )
+{
+  self->state[0] = 0x67452301;
+  self->state[1] = 0xefcdab89;
+  self->state[2] = 0x98badcfe;
+  self->state[3] = 0x10325476;
+  self->numberOfBytes = 0;
+}
+
+static void
+MD5_transform
+  (
+    MD5* self,
+    Arcadia_Natural8Value const* block
+  )
+{
+  Arcadia_Natural32Value m[16];
+  for (Arcadia_SizeValue i = 0; i < 16; ++i) {
+    m[i] = (Arcadia_Natural32Value)block[i * 4 + 0]
+         | ((Arcadia_Natural32Value)block[i * 4 + 1] << 8)
+         | ((Arcadia_Natural32Value)block[i * 4 + 2] << 16)
+         | ((Arcadia_Natural32Value)block[i * 4 + 3] << 24);
+  }
+  Arcadia_Natural32Value a = self->state[0], b = self->state[1], c = self->state[2], d = self->state[3];
+  for (Arcadia_SizeValue i = 0; i < 64; ++i) {
+    Arcadia_Natural32Value f;
+    Arcadia_SizeValue g;
+    if (i < 16) {
+      f = (b & c) | (~b & d);
+      g = i;
+    } else if (i < 32) {
+      f = (d & b) | (~d & c);
+      g = (5 * i + 1) % 16;
+    } else if (i < 48) {
+      f = b ^ c ^ d;
+      g = (3 * i + 5) % 16;
+    } else {
+      f = c ^ (b | ~d);
+      g = (7 * i) % 16;
+    }
+    f = f + a + g_md5K[i] + m[g];
+    a = d;
+    d = c;
+    c = b;
+    b = b + ((f << g_md5S[i]) | (f >> (32 - g_md5S[i])));
+  }
+  self->state[0] += a;
+  self->state[1] += b;
+  self->state[2] += c;
+  self->state[3] += d;
+}
+
+static void
+MD5_update
+  (
+    MD5* self,
+    Arcadia_Natural8Value const* p,
+    Arcadia_SizeValue n
+  )
+{
+  Arcadia_SizeValue used = (Arcadia_SizeValue)(self->numberOfBytes % 64);
+  self->numberOfBytes += n;
+  if (used) {
+    Arcadia_SizeValue m = 64 - used < n ? 64 - used : n;
+    memcpy(self->buffer + used, p, m);
+    p += m;
+    n -= m;
+    if (used + m < 64) {
+      return;
+    }
+    MD5_transform(self, self->buffer);
+  }
+  while (n >= 64) {
+    MD5_transform(self, p);
+    p += 64;
+    n -= 64;
+  }
+  memcpy(self->buffer, p, n);
+}
+
+static void
+MD5_finalize
+  (
+    MD5* self,
+    Arcadia_Natural8Value digest[16]
+  )
+{
+  Arcadia_Natural64Value numberOfBits = self->numberOfBytes * 8;
+  Arcadia_Natural8Value padding[72] = { 0x80 };
+  Arcadia_SizeValue used = (Arcadia_SizeValue)(self->numberOfBytes % 64);
+  Arcadia_SizeValue n = used < 56 ? 56 - used : 120 - used;
+  for (Arcadia_SizeValue i = 0; i < 8; ++i) {
+    padding[n + i] = (Arcadia_Natural8Value)(numberOfBits >> (8 * i));
+  }
+  MD5_update(self, padding, n + 8);
+  for (Arcadia_SizeValue i = 0; i < 16; ++i) {
+    digest[i] = (Arcadia_Natural8Value)(self->state[i / 4] >> (8 * (i % 4)));
+  }
+}
+
+typedef struct MD5Job {
+  Stream const* stream;
+  Arcadia_Natural8Value digest[16];
+  // The task if this job was forked into a thread pool, null otherwise.
+  Arcadia_ThreadPool_Task* task;
+} MD5Job;
+
+// Compute the MD5 of the samples of the stream.
+static void
+MD5Job_run
+  (
+    Arcadia_Thread* thread,
+    MD5Job* job
+  )
+{
+  Stream const* stream = job->stream;
+  Arcadia_SizeValue bytesPerSample = stream->bitsPerSample / 8;
+  Arcadia_Integer32Value samples[1024];
+  Arcadia_Natural8Value bytes[1024 * 2];
+  MD5 md5;
+  MD5_initialize(&md5);
+  for (Arcadia_SizeValue i = 0; i < stream->numberOfSamples; i += 1024) {
+    Arcadia_SizeValue n = stream->numberOfSamples - i < 1024 ? stream->numberOfSamples - i : 1024;
+    loadSamples(stream, i, n, samples);
+    for (Arcadia_SizeValue j = 0; j < n; ++j) {
+      for (Arcadia_SizeValue k = 0; k < bytesPerSample; ++k) {
+        bytes[j * bytesPerSample + k] = (Arcadia_Natural8Value)(((Arcadia_Natural32Value)samples[j]) >> (8 * k));
+      }
+    }
+    MD5_update(&md5, bytes, n * bytesPerSample);
+  }
+  MD5_finalize(&md5, job->digest);
+}
+
+static void
+MD5Job_runTask
+  (
+    Arcadia_Thread* thread,
+    void* context
+  )
+{ MD5Job_run(thread, (MD5Job*)context); }
+
+// The subframe types.
+#define SubframeType_Constant (0)
+#define SubframeType_Verbatim (1)
+#define SubframeType_Fixed (2)
+#define SubframeType_LPC (3)
+
+typedef struct Subframe {
+  Arcadia_Natural8Value type;
+  // The order of the predictor of a fixed or LPC subframe.
+  Arcadia_SizeValue order;
+  // The quantized coefficients, their precision in bits, and their shift of a LPC subframe.
+  Arcadia_Integer32Value coefficients[MaximumLPCOrder];
+  Arcadia_SizeValue precision;
+  Arcadia_Integer32Value shift;
+  // The partition order, the Rice parameters, and the number of bits per Rice parameter of a fixed or LPC subframe.
+  Arcadia_SizeValue partitionOrder;
+  Arcadia_Natural8Value parameters[1 << MaximumPartitionOrder];
+  Arcadia_SizeValue parameterBits;
+  // The number of bits of this subframe.
+  // For fixed and LPC subframes, this is an upper bound.
+  Arcadia_Natural64Value numberOfBits;
+} Subframe;
+
+typedef struct Workspace {
+  // The samples of the current frame.
+  Arcadia_Integer32Value* samples;
+  // The residuals of the best subframe so far and the residuals of the candidate subframe.
+  Arcadia_Integer32Value* residuals;
+  Arcadia_Integer32Value* candidateResiduals;
+  // The window for the number of samples windowSize and the windowed samples.
+  double* window;
+  Arcadia_SizeValue windowSize;
+  double* windowedSamples;
+  Arcadia_Natural64Value partitionSums[1 << MaximumPartitionOrder];
+} Workspace;
+
+// Choose a Rice parameter for a partition.
+// The number of bits for a parameter k is count * (k + 1) + sum_i (u_i >> k) which is bounded by count * (k + 1) + (sum >> k).
+// The parameter is chosen around log2 of the mean of the partition such that this upper bound is minimal.
+static Arcadia_SizeValue
+chooseRiceParameter
+  (
+    Arcadia_Natural64Value sum,
+    Arcadia_SizeValue count,
+    Arcadia_Natural64Value* numberOfBits
+  )
+{
+  if (!count) {
+    *numberOfBits = 0;
+    return 0;
+  }
+  Arcadia_Natural64Value mean = sum / count;
+  Arcadia_SizeValue k = 0;
+  while (k < MaximumRice5Parameter && (((Arcadia_Natural64Value)2) << k) <= mean) {
+    k++;
+  }
+  Arcadia_SizeValue bestK = k;
+  Arcadia_Natural64Value best = (Arcadia_Natural64Value)count * (k + 1) + (sum >> k);
+  if (k > 0) {
+    Arcadia_Natural64Value bits = (Arcadia_Natural64Value)count * k + (sum >> (k - 1));
+    if (bits < best) {
+      best = bits;
+      bestK = k - 1;
+    }
+  }
+  if (k < MaximumRice5Parameter) {
+    Arcadia_Natural64Value bits = (Arcadia_Natural64Value)count * (k + 2) + (sum >> (k + 1));
+    if (bits < best) {
+      best = bits;
+      bestK = k + 1;
+    }
+  }
+  *numberOfBits = best;
+  return bestK;
+}
+
+// Choose the partition order and the Rice parameters for the residuals of a fixed or LPC subframe.
+// The number of bits of the residual is stored in the subframe.
+// The partition sums are computed for the largest partition order and are then merged pairwise for the smaller partition orders.
+static void
+chooseRiceParameters
+  (
+    Workspace* workspace,
+    Arcadia_Integer32Value const* residuals,
+    Arcadia_SizeValue n,
+    Arcadia_SizeValue maximumPartitionOrder,
+    Subframe* subframe
+  )
+{
+  Arcadia_SizeValue order = subframe->order;
+  // A partition order is valid if the number of samples is divisible by the number of partitions
+  // and the first partition contains more samples than the order of the predictor.
+  Arcadia_SizeValue partitionOrder = maximumPartitionOrder;
+  while (partitionOrder > 0 && ((n & ((((Arcadia_SizeValue)1) << partitionOrder) - 1)) || (n >> partitionOrder) <= order)) {
+    partitionOrder--;
+  }
+  Arcadia_Natural64Value* sums = workspace->partitionSums;
+  Arcadia_SizeValue numberOfPartitions = ((Arcadia_SizeValue)1) << partitionOrder;
+  for (Arcadia_SizeValue p = 0, i = 0; p < numberOfPartitions; ++p) {
+    Arcadia_SizeValue count = (n >> partitionOrder) - (0 == p ? order : 0);
+    Arcadia_Natural64Value sum = 0;
+    for (Arcadia_SizeValue j = 0; j < count; ++j) {
+      sum += fold(residuals[i++]);
+    }
+    sums[p] = sum;
+  }
+  Arcadia_Natural64Value best = (Arcadia_Natural64Value)-1;
+  for (Arcadia_SizeValue o = partitionOrder; ; --o) {
+    Arcadia_SizeValue m = ((Arcadia_SizeValue)1) << o;
+    Arcadia_Natural8Value parameters[1 << MaximumPartitionOrder];
+    Arcadia_SizeValue maximumParameter = 0;
+    // 2 bits for the coding method, 4 bits for the partition order.
+    Arcadia_Natural64Value bits = 6;
+    for (Arcadia_SizeValue p = 0; p < m; ++p) {
+      Arcadia_Natural64Value partitionBits;
+      Arcadia_SizeValue count = (n >> o) - (0 == p ? order : 0);
+      Arcadia_SizeValue k = chooseRiceParameter(sums[p], count, &partitionBits);
+      parameters[p] = (Arcadia_Natural8Value)k;
+      maximumParameter = k > maximumParameter ? k : maximumParameter;
+      bits += partitionBits;
+    }
+    Arcadia_SizeValue parameterBits = maximumParameter > MaximumRice4Parameter ? 5 : 4;
+    bits += m * parameterBits;
+    if (bits < best) {
+      best = bits;
+      subframe->partitionOrder = o;
+      subframe->parameterBits = parameterBits;
+      memcpy(subframe->parameters, parameters, m);
+    }
+    if (0 == o) {
+      break;
+    }
+    for (Arcadia_SizeValue p = 0; p < m / 2; ++p) {
+      sums[p] = sums[2 * p] + sums[2 * p + 1];
+    }
+  }
+  subframe->numberOfBits += best;
+}
+
+// Compute the residuals of the fixed predictor of the specified order.
+static void
+computeFixedResiduals
+  (
+    Arcadia_Integer32Value const* s,
+    Arcadia_SizeValue n,
+    Arcadia_SizeValue order,
+    Arcadia_Integer32Value* residuals
+  )
+{
+  switch (order) {
+    case 0: {
+      for (Arcadia_SizeValue i = 0; i < n; ++i) {
+        residuals[i] = s[i];
+      }
+    } break;
+    case 1: {
+      for (Arcadia_SizeValue i = 1; i < n; ++i) {
+        residuals[i - 1] = s[i] - s[i - 1];
+      }
+    } break;
+    case 2: {
+      for (Arcadia_SizeValue i = 2; i < n; ++i) {
+        residuals[i - 2] = s[i] - 2 * s[i - 1] + s[i - 2];
+      }
+    } break;
+    case 3: {
+      for (Arcadia_SizeValue i = 3; i < n; ++i) {
+        residuals[i - 3] = s[i] - 3 * s[i - 1] + 3 * s[i - 2] - s[i - 3];
+      }
+    } break;
+    case 4: {
+      for (Arcadia_SizeValue i = 4; i < n; ++i) {
+        residuals[i - 4] = s[i] - 4 * s[i - 1] + 6 * s[i - 2] - 4 * s[i - 3] + s[i - 4];
+      }
+    } break;
+  };
+}
+
+// Estimate the best order of a fixed predictor by the sum of the absolute values of the residuals of each order.
+// n must be greater than MaximumFixedOrder.
+static Arcadia_SizeValue
+estimateFixedOrder
+  (
+    Arcadia_Integer32Value const* s,
+    Arcadia_SizeValue n
+  )
+{
+  Arcadia_Natural64Value sums[MaximumFixedOrder + 1] = { 0, 0, 0, 0, 0 };
+  Arcadia_Integer32Value last0 = s[3];
+  Arcadia_Integer32Value last1 = s[3] - s[2];
+  Arcadia_Integer32Value last2 = last1 - (s[2] - s[1]);
+  Arcadia_Integer32Value last3 = last2 - (s[2] - 2 * s[1] + s[0]);
+  for (Arcadia_SizeValue i = MaximumFixedOrder; i < n; ++i) {
+    Arcadia_Integer32Value e0 = s[i];
+    Arcadia_Integer32Value e1 = e0 - last0;
+    Arcadia_Integer32Value e2 = e1 - last1;
+    Arcadia_Integer32Value e3 = e2 - last2;
+    Arcadia_Integer32Value e4 = e3 - last3;
+    sums[0] += (Arcadia_Natural32Value)(e0 < 0 ? -e0 : e0);
+    sums[1] += (Arcadia_Natural32Value)(e1 < 0 ? -e1 : e1);
+    sums[2] += (Arcadia_Natural32Value)(e2 < 0 ? -e2 : e2);
+    sums[3] += (Arcadia_Natural32Value)(e3 < 0 ? -e3 : e3);
+    sums[4] += (Arcadia_Natural32Value)(e4 < 0 ? -e4 : e4);
+    last0 = e0;
+    last1 = e1;
+    last2 = e2;
+    last3 = e3;
+  }
+  Arcadia_SizeValue order = 0;
+  for (Arcadia_SizeValue i = 1; i <= MaximumFixedOrder; ++i) {
+    if (sums[i] < sums[order]) {
+      order = i;
+    }
+  }
+  return order;
+}
+
+// Compute a Tukey window with a taper of 50% (a rectangular window with cosine tapered edges).
+static void
+computeWindow
+  (
+    double* window,
+    Arcadia_SizeValue n
+  )
+{
+  Arcadia_SizeValue taper = n / 4;
+  for (Arcadia_SizeValue i = 0; i < n; ++i) {
+    window[i] = 1.;
+  }
+  if (taper > 1) {
+    for (Arcadia_SizeValue i = 0; i < taper; ++i) {
+      double w = 0.5 - 0.5 * cos(3.14159265358979323846 * (double)i / (double)taper);
+      window[i] = w;
+      window[n - 1 - i] = w;
+    }
+  }
+}
+
+// Compute the coefficients of the linear predictors of order 1 to maximumOrder from the autocorrelation by the Levinson-Durbin recursion.
+// The coefficients of the predictor of order i + 1 are stored in coefficients[i][0..i] and the prediction error is stored in errors[i].
+// Returns the number of predictors computed.
+static Arcadia_SizeValue
+computeLPCoefficients
+  (
+    double const* autocorrelation,
+    Arcadia_SizeValue maximumOrder,
+    double coefficients[MaximumLPCOrder][MaximumLPCOrder],
+    double* errors
+  )
+{
+  double lpc[MaximumLPCOrder];
+  double error = autocorrelation[0];
+  for (Arcadia_SizeValue i = 0; i < maximumOrder; ++i) {
+    if (error <= 0.) {
+      return i;
+    }
+    double r = -autocorrelation[i + 1];
+    for (Arcadia_SizeValue j = 0; j < i; ++j) {
+      r -= lpc[j] * autocorrelation[i - j];
+    }
+    r /= error;
+    lpc[i] = r;
+    for (Arcadia_SizeValue j = 0; j < i / 2; ++j) {
+      double t = lpc[j];
+      lpc[j] += r * lpc[i - 1 - j];
+      lpc[i - 1 - j] += r * t;
+    }
+    if (i & 1) {
+      lpc[i / 2] += lpc[i / 2] * r;
+    }
+    error *= 1. - r * r;
+    for (Arcadia_SizeValue j = 0; j <= i; ++j) {
+      coefficients[i][j] = -lpc[j];
+    }
+    errors[i] = error;
+  }
+  return maximumOrder;
+}
+
+// Quantize the coefficients of a linear predictor.
+// Returns false if the coefficients can not be quantized.
+static Arcadia_BooleanValue
+quantizeLPCoefficients
+  (
+    double const* coefficients,
+    Arcadia_SizeValue order,
+    Arcadia_SizeValue precision,
+    Subframe* subframe
+  )
+{
+  double maximum = 0.;
+  for (Arcadia_SizeValue i = 0; i < order; ++i) {
+    double c = fabs(coefficients[i]);
+    maximum = c > maximum ? c : maximum;
+  }
+  if (maximum <= 0.) {
+    return Arcadia_BooleanValue_False;
+  }
+  int exponent;
+  frexp(maximum, &exponent);
+  // maximum < 2^exponent, hence |coefficient| * 2^shift < 2^(precision - 1).
+  Arcadia_Integer32Value shift = (Arcadia_Integer32Value)precision - 1 - exponent;
+  if (shift > 15) {
+    shift = 15;
+  }
+  if (shift < 0) {
+    return Arcadia_BooleanValue_False;
+  }
+  Arcadia_Integer32Value maximumValue = (1 << (precision - 1)) - 1, minimumValue = -(1 << (precision - 1));
+  // The rounding error is carried over to the next coefficient.
+  double error = 0.;
+  for (Arcadia_SizeValue i = 0; i < order; ++i) {
+    error += coefficients[i] * (double)(1 << shift);
+    long q = lround(error);
+    q = q > maximumValue ? maximumValue : q < minimumValue ? minimumValue : q;
+    error -= (double)q;
+    subframe->coefficients[i] = (Arcadia_Integer32Value)q;
+  }
+  subframe->precision = precision;
+  subframe->shift = shift;
+  return Arcadia_BooleanValue_True;
+}
+
+// Compute the residuals of the quantized linear predictor of a subframe.
+// Returns false if a residual does not fit into 31 bits.
+static Arcadia_BooleanValue
+computeLPCResiduals
+  (
+    Arcadia_Integer32Value const* s,
+    Arcadia_SizeValue n,
+    Subframe const* subframe,
+    Arcadia_Integer32Value* residuals
+  )
+{
+  Arcadia_SizeValue order = subframe->order;
+  Arcadia_Integer32Value const* c = subframe->coefficients;
+  for (Arcadia_SizeValue i = order; i < n; ++i) {
+    Arcadia_Integer64Value sum = 0;
+    for (Arcadia_SizeValue j = 0; j < order; ++j) {
+      sum += (Arcadia_Integer64Value)c[j] * s[i - 1 - j];
+    }
+    Arcadia_Integer64Value r = (Arcadia_Integer64Value)s[i] - (sum >> subframe->shift);
+    if (r > (1 << 30) || r < -(1 << 30)) {
+      return Arcadia_BooleanValue_False;
+    }
+    residuals[i - order] = (Arcadia_Integer32Value)r;
+  }
+  return Arcadia_BooleanValue_True;
+}
+
+// The precision of the quantized coefficients of linear predictors depending on the block size.
+static Arcadia_SizeValue
+getLPCPrecision
+  (
+    Arcadia_SizeValue blockSize,
+    Arcadia_SizeValue bitsPerSample,
+    Arcadia_SizeValue order
+  )
+{
+  Arcadia_SizeValue precision = blockSize <= 192 ? 7
+                              : blockSize <= 384 ? 8
+                              : blockSize <= 576 ? 9
+                              : blockSize <= 1152 ? 10
+                              : blockSize <= 2304 ? 11
+                              : blockSize <= 4608 ? 12
+                              : 13;
+  // Decoders may compute the prediction with 32 bit arithmetic if bitsPerSample + precision + log2(order) <= 32.
+  Arcadia_SizeValue log2Order = 0;
+  while ((((Arcadia_SizeValue)2) << log2Order) <= order) {
+    log2Order++;
+  }
+  Arcadia_SizeValue limit = 32 - bitsPerSample - log2Order;
+  precision = precision > limit ? limit : precision;
+  return precision > 15 ? 15 : precision;
+}
+
+// Try a candidate subframe. If it is smaller than the best subframe so far, it becomes the best subframe.
+static void
+tryCandidate
+  (
+    Workspace* workspace,
+    Subframe* best,
+    Subframe const* candidate
+  )
+{
+  if (candidate->numberOfBits < best->numberOfBits) {
+    *best = *candidate;
+    Arcadia_Integer32Value* temporary = workspace->residuals;
+    workspace->residuals = workspace->candidateResiduals;
+    workspace->candidateResiduals = temporary;
+  }
+}
+
+static void
+chooseSubframe
+  (
+    Stream const* stream,
+    Workspace* workspace,
+    Arcadia_SizeValue n,
+    Subframe* best
+  )
+{
+  Arcadia_Integer32Value const* s = workspace->samples;
+  Arcadia_SizeValue bitsPerSample = stream->bitsPerSample;
+  Settings const* settings = &stream->settings;
+
+  Arcadia_BooleanValue isConstant = Arcadia_BooleanValue_True;
+  for (Arcadia_SizeValue i = 1; i < n && isConstant; ++i) {
+    isConstant = s[i] == s[0];
+  }
+  if (isConstant) {
+    best->type = SubframeType_Constant;
+    best->numberOfBits = 8 + bitsPerSample;
+    return;
+  }
+  best->type = SubframeType_Verbatim;
+  best->numberOfBits = 8 + (Arcadia_Natural64Value)n * bitsPerSample;
+
+  Subframe candidate;
+  if (n > MaximumFixedOrder) {
+    Arcadia_SizeValue first = 0, last = MaximumFixedOrder;
+    if (!settings->exhaustiveLPCOrderSearch) {
+      first = last = estimateFixedOrder(s, n);
+    }
+    for (Arcadia_SizeValue order = first; order <= last; ++order) {
+      candidate.type = SubframeType_Fixed;
+      candidate.order = order;
+      candidate.numberOfBits = 8 + order * bitsPerSample;
+      computeFixedResiduals(s, n, order, workspace->candidateResiduals);
+      chooseRiceParameters(workspace, workspace->candidateResiduals, n, settings->maximumPartitionOrder, &candidate);
+      tryCandidate(workspace, best, &candidate);
+    }
+  }
+
+  Arcadia_SizeValue maximumOrder = settings->maximumLPCOrder < n - 1 ? settings->maximumLPCOrder : n - 1;
+  if (maximumOrder > 0 && n > MaximumFixedOrder) {
+    if (workspace->windowSize != n) {
+      computeWindow(workspace->window, n);
+      workspace->windowSize = n;
+    }
+    double* x = workspace->windowedSamples;
+    for (Arcadia_SizeValue i = 0; i < n; ++i) {
+      x[i] = (double)s[i] * workspace->window[i];
+    }
+    double autocorrelation[MaximumLPCOrder + 1];
+    for (Arcadia_SizeValue lag = 0; lag <= maximumOrder; ++lag) {
+      double sum = 0.;
+      for (Arcadia_SizeValue i = lag; i < n; ++i) {
+        sum += x[i] * x[i - lag];
+      }
+      autocorrelation[lag] = sum;
+    }
+    double coefficients[MaximumLPCOrder][MaximumLPCOrder];
+    double errors[MaximumLPCOrder];
+    maximumOrder = computeLPCoefficients(autocorrelation, maximumOrder, coefficients, errors);
+    // Unless all orders are searched, the order with the smallest estimated number of bits and the maximum order are tried.
+    // The estimate ignores the cost of quantizing the coefficients and tends to pick low orders for strongly tonal signals.
+    Arcadia_SizeValue estimatedOrder = maximumOrder;
+    if (!settings->exhaustiveLPCOrderSearch && maximumOrder > 0) {
+      double errorScale = 0.5 / (double)n;
+      double bestEstimate = 0.;
+      for (Arcadia_SizeValue order = 1; order <= maximumOrder; ++order) {
+        double bitsPerResidual = errors[order - 1] > 0. ? 0.5 * log2(errorScale * errors[order - 1]) : 0.;
+        bitsPerResidual = bitsPerResidual > 0. ? bitsPerResidual : 0.;
+        double estimate = bitsPerResidual * (double)(n - order) + (double)(order * getLPCPrecision(stream->blockSize, bitsPerSample, order));
+        if (1 == order || estimate < bestEstimate) {
+          bestEstimate = estimate;
+          estimatedOrder = order;
+        }
+      }
+    }
+    for (Arcadia_SizeValue order = 1; order <= maximumOrder; ++order) {
+      if (!settings->exhaustiveLPCOrderSearch && order != estimatedOrder && order != maximumOrder) {
+        continue;
+      }
+      candidate.type = SubframeType_LPC;
+      candidate.order = order;
+      if (!quantizeLPCoefficients(coefficients[order - 1], order, getLPCPrecision(stream->blockSize, bitsPerSample, order), &candidate)) {
+        continue;
+      }
+      if (!computeLPCResiduals(s, n, &candidate, workspace->candidateResiduals)) {
+        continue;
+      }
+      // 4 bits for the precision, 5 bits for the shift.
+      candidate.numberOfBits = 8 + order * bitsPerSample + 4 + 5 + order * candidate.precision;
+      chooseRiceParameters(workspace, workspace->candidateResiduals, n, settings->maximumPartitionOrder, &candidate);
+      tryCandidate(workspace, best, &candidate);
+    }
+  }
+}
+
+static void
+writeSubframe
+  (
+    Stream const* stream,
+    Workspace const* workspace,
+    Arcadia_SizeValue n,
+    Subframe const* subframe,
+    BitWriter* w
+  )
+{
+  Arcadia_Integer32Value const* s = workspace->samples;
+  Arcadia_SizeValue bitsPerSample = stream->bitsPerSample;
+  // The subframe header consists of a zero bit, the 6 bit type, and a zero bit (no wasted bits).
+  switch (subframe->type) {
+    case SubframeType_Constant: {
+      writeBits(w, 0x00 << 1, 8);
+      writeSignedBits(w, s[0], bitsPerSample);
+      return;
+    } break;
+    case SubframeType_Verbatim: {
+      writeBits(w, 0x01 << 1, 8);
+      for (Arcadia_SizeValue i = 0; i < n; ++i) {
+        writeSignedBits(w, s[i], bitsPerSample);
+      }
+      return;
+    } break;
+    case SubframeType_Fixed: {
+      writeBits(w, (Arcadia_Natural32Value)((0x08 | subframe->order) << 1), 8);
+      for (Arcadia_SizeValue i = 0; i < subframe->order; ++i) {
+        writeSignedBits(w, s[i], bitsPerSample);
+      }
+    } break;
+    case SubframeType_LPC: {
+      writeBits(w, (Arcadia_Natural32Value)((0x20 | (subframe->order - 1)) << 1), 8);
+      for (Arcadia_SizeValue i = 0; i < subframe->order; ++i) {
+        writeSignedBits(w, s[i], bitsPerSample);
+      }
+      writeBits(w, (Arcadia_Natural32Value)(subframe->precision - 1), 4);
+      writeSignedBits(w, subframe->shift, 5);
+      for (Arcadia_SizeValue i = 0; i < subframe->order; ++i) {
+        writeSignedBits(w, subframe->coefficients[i], subframe->precision);
+      }
+    } break;
+  };
+  // The residual coding method (0 for 4 bit Rice parameters, 1 for 5 bit Rice parameters) and the partition order.
+  writeBits(w, 5 == subframe->parameterBits ? 1 : 0, 2);
+  writeBits(w, (Arcadia_Natural32Value)subframe->partitionOrder, 4);
+  Arcadia_Integer32Value const* r = workspace->residuals;
+  Arcadia_SizeValue numberOfPartitions = ((Arcadia_SizeValue)1) << subframe->partitionOrder;
+  for (Arcadia_SizeValue p = 0; p < numberOfPartitions; ++p) {
+    Arcadia_SizeValue k = subframe->parameters[p];
+    Arcadia_SizeValue count = (n >> subframe->partitionOrder) - (0 == p ? subframe->order : 0);
+    writeBits(w, (Arcadia_Natural32Value)k, subframe->parameterBits);
+    for (Arcadia_SizeValue i = 0; i < count; ++i) {
+      writeRice(w, fold(*r++), k);
+    }
+  }
+}
+
+// Get the sample rate code of a frame header and the number of bits of the sample rate following the frame header.
+static Arcadia_Natural32Value
+getSampleRateCode
+  (
+    Arcadia_Natural32Value sampleRate,
+    Arcadia_SizeValue* numberOfBits
+  )
+{
+  *numberOfBits = 0;
+  switch (sampleRate) {
+    case 88200: return 1;
+    case 176400: return 2;
+    case 192000: return 3;
+    case 8000: return 4;
+    case 16000: return 5;
+    case 22050: return 6;
+    case 24000: return 7;
+    case 32000: return 8;
+    case 44100: return 9;
+    case 48000: return 10;
+    case 96000: return 11;
+  };
+  if (0 == sampleRate % 1000 && sampleRate / 1000 <= 255) {
+    *numberOfBits = 8;
+    return 12;
+  } else if (sampleRate <= 65535) {
+    *numberOfBits = 16;
+    return 13;
+  } else if (0 == sampleRate % 10 && sampleRate / 10 <= 65535) {
+    *numberOfBits = 16;
+    return 14;
+  } else {
+    // Use the sample rate of the stream information.
+    return 0;
+  }
+}
+
+// The maximum number of Bytes of a frame: a frame with a verbatim subframe is never exceeded.
+// The frame header has at most 16 Bytes, the subframe header has 1 Byte, and the frame footer has 2 Bytes.
+static Arcadia_SizeValue
+getMaximumFrameSize
+  (
+    Stream const* stream
+  )
+{ return 16 + 1 + stream->blockSize * (stream->bitsPerSample / 8) + 2; }
+
+static void
+writeFrame
+  (
+    Stream const* stream,
+    Workspace* workspace,
+    Arcadia_SizeValue frameIndex,
+    BitWriter* w
+  )
+{
+  Arcadia_SizeValue first = frameIndex * stream->blockSize;
+  Arcadia_SizeValue n = stream->numberOfSamples - first < stream->blockSize ? stream->numberOfSamples - first : stream->blockSize;
+  loadSamples(stream, first, n, workspace->samples);
+
+  Arcadia_SizeValue start = w->position;
+  // The sync code, a reserved zero bit, and the blocking strategy (fixed block size).
+  writeBits(w, 0xfff8, 16);
+  // The block size is stored as a 16 bit value following the frame number.
+  writeBits(w, 7, 4);
+  Arcadia_SizeValue sampleRateBits;
+  Arcadia_Natural32Value sampleRateCode = getSampleRateCode(stream->sampleRate, &sampleRateBits);
+  writeBits(w, sampleRateCode, 4);
+  // One channel.
+  writeBits(w, 0, 4);
+  // The sample size (1 for 8 bits, 4 for 16 bits) and a reserved zero bit.
+  writeBits(w, 8 == stream->bitsPerSample ? 1 : 4, 3);
+  writeBits(w, 0, 1);
+  // The frame number in the variable length code of UTF-8.
+  if (frameIndex < 0x80) {
+    writeBits(w, (Arcadia_Natural32Value)frameIndex, 8);
+  } else {
+    Arcadia_SizeValue numberOfBytes = frameIndex < 0x800 ? 2 : frameIndex < 0x10000 ? 3 : frameIndex < 0x200000 ? 4 : frameIndex < 0x4000000 ? 5 : 6;
+    writeBits(w, (Arcadia_Natural32Value)((0xff00 >> numberOfBytes) & 0xff) | (Arcadia_Natural32Value)(frameIndex >> (6 * (numberOfBytes - 1))), 8);
+    for (Arcadia_SizeValue i = numberOfBytes - 1; i > 0; --i) {
+      writeBits(w, 0x80 | (Arcadia_Natural32Value)((frameIndex >> (6 * (i - 1))) & 0x3f), 8);
+    }
+  }
+  writeBits(w, (Arcadia_Natural32Value)(n - 1), 16);
+  if (12 == sampleRateCode) {
+    writeBits(w, stream->sampleRate / 1000, 8);
+  } else if (13 == sampleRateCode) {
+    writeBits(w, stream->sampleRate, 16);
+  } else if (14 == sampleRateCode) {
+    writeBits(w, stream->sampleRate / 10, 16);
+  }
+  writeBits(w, crc8(w->bytes + start, w->position - start), 8);
+
+  Subframe subframe;
+  chooseSubframe(stream, workspace, n, &subframe);
+  writeSubframe(stream, workspace, n, &subframe, w);
+
+  alignToByte(w);
+  writeBits(w, crc16(w->bytes + start, w->position - start), 16);
+}
+
+static void
+Job_run
+  (
+    Arcadia_Thread* thread,
+    Job* job
+  )
+{
+  Stream const* stream = job->stream;
+  Workspace workspace;
+  workspace.windowSize = 0;
+  Arcadia_Natural8Value* scratch = NULL;
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_SizeValue blockSize = stream->blockSize;
+    scratch = Arcadia_Memory_allocateUnmanaged(thread, blockSize * (3 * sizeof(Arcadia_Integer32Value) + 2 * sizeof(double)));
+    workspace.window = (double*)scratch;
+    workspace.windowedSamples = workspace.window + blockSize;
+    workspace.samples = (Arcadia_Integer32Value*)(workspace.windowedSamples + blockSize);
+    workspace.residuals = workspace.samples + blockSize;
+    workspace.candidateResiduals = workspace.residuals + blockSize;
+    job->bytes = Arcadia_Memory_allocateUnmanaged(thread, job->numberOfFrames * getMaximumFrameSize(stream));
+    BitWriter w = { .bytes = job->bytes, .position = 0, .accumulator = 0, .numberOfBits = 0 };
+    for (Arcadia_SizeValue i = 0; i < job->numberOfFrames; ++i) {
+      writeFrame(stream, &workspace, job->firstFrame + i, &w);
+    }
+    job->numberOfBytes = w.position;
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    if (scratch) {
+      Arcadia_Memory_deallocateUnmanaged(thread, scratch);
+      scratch = NULL;
+    }
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Memory_deallocateUnmanaged(thread, scratch);
+  scratch = NULL;
+}
+
+static void
+Job_runTask
+  (
+    Arcadia_Thread* thread,
+    void* context
+  )
+{ Job_run(thread, (Job*)context); }
+
+// Write the signature and the stream information.
+static void
+writeHeader
+  (
+    Arcadia_Thread* thread,
+    Stream const* stream,
+    Arcadia_Natural8Value const digest[16],
+    Arcadia_ByteArrayBuilder* target
+  )
+{
+  Arcadia_Natural8Value bytes[4 + 4 + 34];
+  BitWriter w = { .bytes = bytes, .position = 0, .accumulator = 0, .numberOfBits = 0 };
+  writeBits(&w, 0x664c6143, 32); // "fLaC"
+  // The metadata block header: the last metadata block, the type (stream information), the length.
+  writeBits(&w, 1, 1);
+  writeBits(&w, 0, 7);
+  writeBits(&w, 34, 24);
+  // The minimum and the maximum block size.
+  writeBits(&w, (Arcadia_Natural32Value)stream->blockSize, 16);
+  writeBits(&w, (Arcadia_Natural32Value)stream->blockSize, 16);
+  // The minimum and the maximum frame size are unknown.
+  writeBits(&w, 0, 24);
+  writeBits(&w, 0, 24);
+  writeBits(&w, stream->sampleRate, 20);
+  // One channel.
+  writeBits(&w, 0, 3);
+  writeBits(&w, (Arcadia_Natural32Value)(stream->bitsPerSample - 1), 5);
+  writeBits(&w, (Arcadia_Natural32Value)((Arcadia_Natural64Value)stream->numberOfSamples >> 32), 4);
+  writeBits(&w, (Arcadia_Natural32Value)stream->numberOfSamples, 32);
+  for (Arcadia_SizeValue i = 0; i < 16; ++i) {
+    writeBits(&w, digest[i], 8);
+  }
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, bytes, w.position);
+}
+
+// Release the jobs.
+// Jobs which were forked but not joined are joined, errors raised by these jobs are ignored.
+static void
+releaseJobs
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ThreadPool* pool,
+    Job* jobs,
+    Arcadia_SizeValue numberOfJobs
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < numberOfJobs; ++i) {
+    Job* job = &jobs[i];
+    if (job->task) {
+      Arcadia_ThreadPool_Task* task = job->task;
+      job->task = NULL;
+      Arcadia_JumpTarget jumpTarget;
+      Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+      if (Arcadia_JumpTarget_save(&jumpTarget)) {
+        Arcadia_ThreadPool_join(thread, pool, task);
+      }
+      Arcadia_Thread_popJumpTarget(thread);
+    }
+    if (job->bytes) {
+      Arcadia_Memory_deallocateUnmanaged(thread, job->bytes);
+      job->bytes = NULL;
+    }
+  }
+}
+
+static void
+describeStream
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SampleBufferIO_FLACEncoder* self,
+    Arcadia_Media_SampleBuffer* source,
+    Stream* stream
+  )
+{
+  stream->sampleFormat = Arcadia_Media_SampleBuffer_getSampleFormat(thread, source);
+  switch (stream->sampleFormat) {
+    case Arcadia_Media_SampleFormat_Integer8:
+    case Arcadia_Media_SampleFormat_Natural8: {
+      stream->bitsPerSample = 8;
+    } break;
+    case Arcadia_Media_SampleFormat_Integer16:
+    case Arcadia_Media_SampleFormat_Natural16: {
+      stream->bitsPerSample = 16;
+    } break;
+    default: {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+      Arcadia_Thread_jump(thread);
+    } break;
+  };
+  Arcadia_Integer32Value sampleRate = Arcadia_Media_SampleBuffer_getSampleRate(thread, source);
+  Arcadia_Integer32Value length = Arcadia_Media_SampleBuffer_getLength(thread, source);
+  if (sampleRate < 1 || sampleRate > 1048575 || length < 0) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  stream->bytes = source->bytes;
+  stream->sampleRate = (Arcadia_Natural32Value)sampleRate;
+  stream->numberOfSamples = (Arcadia_SizeValue)sampleRate * (Arcadia_SizeValue)length;
+  stream->blockSize = self->blockSize;
+  stream->numberOfFrames = (stream->numberOfSamples + stream->blockSize - 1) / stream->blockSize;
+  stream->settings = g_settings[self->compressionLevel];
+}
+
+static void
+Arcadia_SampleBufferIO_FLACEncoder_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SampleBufferIO_FLACEncoder* self
+  );
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_SampleBufferIO_FLACEncoder_constructImpl,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.SampleBufferIO.FLACEncoder", Arcadia_SampleBufferIO_FLACEncoder,
+                         u8"Arcadia.Object", Arcadia_Object,
+                         &_typeOperations);
+
+static void
+Arcadia_SampleBufferIO_FLACEncoder_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SampleBufferIO_FLACEncoder* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_SampleBufferIO_FLACEncoder);
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  if (0 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->compressionLevel = DefaultCompressionLevel;
+  self->blockSize = DefaultBlockSize;
+  self->numberOfWorkers = 0;
+  Arcadia_LeaveConstructor(Arcadia_SampleBufferIO_FLACEncoder);
+}
+
+Arcadia_SampleBufferIO_FLACEncoder*
+Arcadia_SampleBufferIO_FLACEncoder_create
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  Arcadia_ValueStack_pushNatural8Value(thread, 0);
+  ARCADIA_CREATEOBJECT(Arcadia_SampleBufferIO_FLACEncoder);
+}
+
+Arcadia_Integer32Value
+Arcadia_SampleBufferIO_FLACEncoder_getCompressionLevel
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SampleBufferIO_FLACEncoder* self
+  )
+{ return self->compressionLevel; }
+
+void
+Arcadia_SampleBufferIO_FLACEncoder_setCompressionLevel
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SampleBufferIO_FLACEncoder* self,
+    Arcadia_Integer32Value compressionLevel
+  )
+{
+  if (compressionLevel < 0 || compressionLevel > 8) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->compressionLevel = compressionLevel;
+}
+
+Arcadia_SizeValue
+Arcadia_SampleBufferIO_FLACEncoder_getBlockSize
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SampleBufferIO_FLACEncoder* self
+  )
+{ return self->blockSize; }
+
+void
+Arcadia_SampleBufferIO_FLACEncoder_setBlockSize
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SampleBufferIO_FLACEncoder* self,
+    Arcadia_SizeValue blockSize
+  )
+{
+  if (blockSize < 16 || blockSize > 65535) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->blockSize = blockSize;
+}
+
+Arcadia_SizeValue
+Arcadia_SampleBufferIO_FLACEncoder_getNumberOfWorkers
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SampleBufferIO_FLACEncoder* self
+  )
+{ return self->numberOfWorkers; }
+
+void
+Arcadia_SampleBufferIO_FLACEncoder_setNumberOfWorkers
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SampleBufferIO_FLACEncoder* self,
+    Arcadia_SizeValue numberOfWorkers
+  )
+{ self->numberOfWorkers = numberOfWorkers; }
+
+void
+Arcadia_SampleBufferIO_FLACEncoder_encodeToByteArrayBuilder
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SampleBufferIO_FLACEncoder* self,
+    Arcadia_Media_SampleBuffer* source,
+    Arcadia_ByteArrayBuilder* target
+  )
+{
+  Stream stream;
+  describeStream(thread, self, source, &stream);
+  Arcadia_SizeValue numberOfJobs = (stream.numberOfFrames + FramesPerJob - 1) / FramesPerJob;
+
+  Arcadia_ThreadPool* pool = NULL;
+  Job* jobs = NULL;
+  MD5Job md5Job = { .stream = &stream, .task = NULL };
+  // The workers read the samples of the sample buffer.
+  Arcadia_Object_lock(thread, (Arcadia_Object*)source);
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    jobs = Arcadia_Memory_allocateUnmanaged(thread, (numberOfJobs ? numberOfJobs : 1) * sizeof(Job));
+    for (Arcadia_SizeValue i = 0; i < numberOfJobs; ++i) {
+      jobs[i].stream = &stream;
+      jobs[i].firstFrame = i * FramesPerJob;
+      jobs[i].numberOfFrames = i + 1 < numberOfJobs ? FramesPerJob : stream.numberOfFrames - i * FramesPerJob;
+      jobs[i].bytes = NULL;
+      jobs[i].numberOfBytes = 0;
+      jobs[i].task = NULL;
+    }
+    Arcadia_SizeValue numberOfJobsInFlight = 1;
+    if (numberOfJobs > 1 && 1 != self->numberOfWorkers) {
+      pool = Arcadia_ThreadPool_create(thread, self->numberOfWorkers);
+      numberOfJobsInFlight = JobsPerWorker * Arcadia_ThreadPool_getNumberOfWorkers(thread, pool);
+    }
+
+    // The MD5 of the samples is required by the stream information which precedes the frames.
+    // It is computed while the first frames are encoded.
+    Arcadia_SizeValue forked = 0;
+    if (pool) {
+      md5Job.task = Arcadia_ThreadPool_fork(thread, pool, &MD5Job_runTask, &md5Job);
+      while (forked < numberOfJobs && forked < numberOfJobsInFlight) {
+        jobs[forked].task = Arcadia_ThreadPool_fork(thread, pool, &Job_runTask, &jobs[forked]);
+        forked++;
+      }
+      Arcadia_ThreadPool_Task* task = md5Job.task;
+      md5Job.task = NULL;
+      Arcadia_ThreadPool_join(thread, pool, task);
+    } else {
+      MD5Job_run(thread, &md5Job);
+    }
+    writeHeader(thread, &stream, md5Job.digest, target);
+
+    for (Arcadia_SizeValue i = 0; i < numberOfJobs; ++i) {
+      Job* job = &jobs[i];
+      if (pool) {
+        while (forked < numberOfJobs && forked < i + numberOfJobsInFlight) {
+          jobs[forked].task = Arcadia_ThreadPool_fork(thread, pool, &Job_runTask, &jobs[forked]);
+          forked++;
+        }
+        Arcadia_ThreadPool_Task* task = job->task;
+        job->task = NULL;
+        Arcadia_ThreadPool_join(thread, pool, task);
+      } else {
+        Job_run(thread, job);
+      }
+      Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, job->bytes, job->numberOfBytes);
+      Arcadia_Memory_deallocateUnmanaged(thread, job->bytes);
+      job->bytes = NULL;
+    }
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Status status = Arcadia_Thread_getStatus(thread);
+    if (md5Job.task) {
+      Arcadia_ThreadPool_Task* task = md5Job.task;
+      md5Job.task = NULL;
+      Arcadia_JumpTarget jumpTarget1;
+      Arcadia_Thread_pushJumpTarget(thread, &jumpTarget1);
+      if (Arcadia_JumpTarget_save(&jumpTarget1)) {
+        Arcadia_ThreadPool_join(thread, pool, task);
+      }
+      Arcadia_Thread_popJumpTarget(thread);
+    }
+    if (jobs) {
+      releaseJobs(thread, pool, jobs, numberOfJobs);
+      Arcadia_Memory_deallocateUnmanaged(thread, jobs);
+      jobs = NULL;
+    }
+    if (pool) {
+      Arcadia_ThreadPool_destroy(thread, pool);
+      pool = NULL;
+    }
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)source);
+    Arcadia_Thread_setStatus(thread, status);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Memory_deallocateUnmanaged(thread, jobs);
+  jobs = NULL;
+  if (pool) {
+    Arcadia_ThreadPool_destroy(thread, pool);
+    pool = NULL;
+  }
+  Arcadia_Object_unlock(thread, (Arcadia_Object*)source);
+}
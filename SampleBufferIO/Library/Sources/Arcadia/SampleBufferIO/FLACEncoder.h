@@ -0,0 +1,162 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_SAMPLEBUFFERIO_FLACENCODER_H_INCLUDED)
+#define ARCADIA_SAMPLEBUFFERIO_FLACENCODER_H_INCLUDED
+
+#include "Arcadia/Media/Include.h"
+
+// An encoder for the "FLAC" file format.
+//
+// The samples are split into blocks of a fixed size and each block is encoded as a frame.
+// Frames are encoded independently of each other such that frames can be encoded in parallel.
+// The frames are written to the target in order as soon as they are available.
+// At most two jobs of a few frames each per worker are in flight such that the memory used does not depend on the length of the sample buffer.
+//
+// The samples of a frame are encoded as a
+// - constant subframe if all samples are equal,
+// - fixed subframe (a polynomial predictor of order 0 to 4),
+// - LPC subframe (a linear predictor with quantized coefficients computed from the autocorrelation of the windowed samples), or
+// - verbatim subframe
+// whichever is the smallest.
+// The residuals of fixed and LPC subframes are Rice coded.
+// The residuals are split into 2^k partitions with individual Rice parameters, the partition order k with the smallest size is used.
+//
+// The sample formats
+// - Arcadia_Media_SampleFormat_Integer8 and
+// - Arcadia_Media_SampleFormat_Natural8
+// are encoded as 8 bit mono streams.
+// The sample formats
+// - Arcadia_Media_SampleFormat_Integer16 and
+// - Arcadia_Media_SampleFormat_Natural16
+// are encoded as 16 bit mono streams.
+// The samples of natural sample formats are converted to signed samples by subtracting 128 and 32768, respectively.
+Arcadia_declareObjectType(u8"Arcadia.SampleBufferIO.FLACEncoder", Arcadia_SampleBufferIO_FLACEncoder,
+                          u8"Arcadia.Object");
+
+struct Arcadia_SampleBufferIO_FLACEncoderDispatch {
+  Arcadia_ObjectDispatch _parent;
+};
+
+struct Arcadia_SampleBufferIO_FLACEncoder {
+  Arcadia_Object _parent;
+  // The compression level, a value from 0 (fastest) to 8 (best compression).
+  Arcadia_Integer32Value compressionLevel;
+  // The number of samples per block.
+  Arcadia_SizeValue blockSize;
+  // The number of workers. If 0, then the number of cores is used.
+  Arcadia_SizeValue numberOfWorkers;
+};
+
+/// @brief Create a FLAC encoder.
+/// @param thread A pointer to this thread.
+/// @return A pointer to the FLAC encoder.
+/// The compression level is 5, the block size is 4096, and the number of workers is 0.
+Arcadia_SampleBufferIO_FLACEncoder*
+Arcadia_SampleBufferIO_FLACEncoder_create
+  (
+    Arcadia_Thread* thread
+  );
+
+/// @brief Get the compression level.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this FLAC encoder.
+/// @return The compression level.
+Arcadia_Integer32Value
+Arcadia_SampleBufferIO_FLACEncoder_getCompressionLevel
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SampleBufferIO_FLACEncoder* self
+  );
+
+/// @brief Set the compression level.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this FLAC encoder.
+/// @param compressionLevel The compression level, a value from 0 (fastest) to 8 (best compression).
+/// Levels 0 to 2 use fixed predictors only, levels 3 to 8 also use linear predictors of increasing maximum order.
+/// Level 8 searches all orders of linear predictors.
+/// @error #Arcadia_Status_ArgumentValueInvalid @a compressionLevel is not within the bounds of [0,8]
+void
+Arcadia_SampleBufferIO_FLACEncoder_setCompressionLevel
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SampleBufferIO_FLACEncoder* self,
+    Arcadia_Integer32Value compressionLevel
+  );
+
+/// @brief Get the block size.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this FLAC encoder.
+/// @return The block size.
+Arcadia_SizeValue
+Arcadia_SampleBufferIO_FLACEncoder_getBlockSize
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SampleBufferIO_FLACEncoder* self
+  );
+
+/// @brief Set the block size.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this FLAC encoder.
+/// @param blockSize The number of samples per frame.
+/// @error #Arcadia_Status_ArgumentValueInvalid @a blockSize is not within the bounds of [16,65535]
+void
+Arcadia_SampleBufferIO_FLACEncoder_setBlockSize
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SampleBufferIO_FLACEncoder* self,
+    Arcadia_SizeValue blockSize
+  );
+
+/// @brief Get the number of workers.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this FLAC encoder.
+/// @return The number of workers.
+Arcadia_SizeValue
+Arcadia_SampleBufferIO_FLACEncoder_getNumberOfWorkers
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SampleBufferIO_FLACEncoder* self
+  );
+
+/// @brief Set the number of workers.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this FLAC encoder.
+/// @param numberOfWorkers The number of workers. If @a 0, then the number of cores is used. If @a 1, then the samples are encoded on the calling thread.
+void
+Arcadia_SampleBufferIO_FLACEncoder_setNumberOfWorkers
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SampleBufferIO_FLACEncoder* self,
+    Arcadia_SizeValue numberOfWorkers
+  );
+
+/// @brief Encode a sample buffer and append the Bytes to a byte array builder.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this FLAC encoder.
+/// @param source A pointer to the sample buffer.
+/// @param target A pointer to the byte array builder.
+/// @error #Arcadia_Status_ArgumentValueInvalid the sample format of @a source is not supported
+/// @error #Arcadia_Status_ArgumentValueInvalid the sample rate of @a source is not within the bounds of [1,1048575]
+void
+Arcadia_SampleBufferIO_FLACEncoder_encodeToByteArrayBuilder
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SampleBufferIO_FLACEncoder* self,
+    Arcadia_Media_SampleBuffer* source,
+    Arcadia_ByteArrayBuilder* target
+  );
+
+#endif // ARCADIA_SAMPLEBUFFERIO_FLACENCODER_H_INCLUDED
@@ -15,23 +15,14 @@
 
 #include "Arcadia/SampleBufferIO/Include.h"
 
-#define FLAC__NO_DLL
-#include "FLAC/metadata.h"
-#include "FLAC/stream_encoder.h"
-
 void
 Arcadia_SampleBufferIO_encodeFLAC
   (
-    Arcadia_Thread* thread
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleBuffer* source,
+    Arcadia_ByteArrayBuilder* target
   )
 {
-  // (1) Open the encoder.
-  FLAC__StreamEncoder* encoder = FLAC__stream_encoder_new();
-  if (!encoder) {
-    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
-    Arcadia_Thread_jump(thread);
-  }
-  // (2) Close the encoder.
-  FLAC__stream_encoder_finish(encoder);
-  encoder = NULL;
+  Arcadia_SampleBufferIO_FLACEncoder* encoder = Arcadia_SampleBufferIO_FLACEncoder_create(thread);
+  Arcadia_SampleBufferIO_FLACEncoder_encodeToByteArrayBuilder(thread, encoder, source, target);
 }
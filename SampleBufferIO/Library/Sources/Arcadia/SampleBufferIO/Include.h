@@ -17,11 +17,19 @@
 #define ARCADIA_SAMPLEBUFFERIO_INCLUDE_H_INCLUDED
 
 #include "Arcadia/Media/Include.h"
+#include "Arcadia/SampleBufferIO/FLACEncoder.h"
 
+/// @brief Encode a sample buffer in the "FLAC" file format with the default settings of the FLAC encoder.
+/// @param thread A pointer to this thread.
+/// @param source A pointer to the sample buffer.
+/// @param target A pointer to the byte array builder to which the Bytes are appended.
+/// @error #Arcadia_Status_ArgumentValueInvalid the sample format or the sample rate of @a source is not supported
 void
 Arcadia_SampleBufferIO_encodeFLAC
   (
-    Arcadia_Thread* thread
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleBuffer* source,
+    Arcadia_ByteArrayBuilder* target
   );
 
 #endif // ARCADIA_SAMPLEBUFFERIO_INCLUDE_H_INCLUDED
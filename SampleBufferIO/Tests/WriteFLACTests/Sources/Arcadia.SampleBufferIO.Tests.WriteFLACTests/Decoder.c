@@ -0,0 +1,440 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia.SampleBufferIO.Tests.WriteFLACTests/Decoder.h"
+
+typedef struct BitReader {
+  Arcadia_Natural8Value const* bytes;
+  Arcadia_SizeValue numberOfBytes;
+  // The position in bits.
+  Arcadia_SizeValue position;
+} BitReader;
+
+static void
+fail
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Status status
+  )
+{
+  Arcadia_Thread_setStatus(thread, status);
+  Arcadia_Thread_jump(thread);
+}
+
+// Read n bits, n in [0,32].
+static Arcadia_Natural32Value
+readBits
+  (
+    Arcadia_Thread* thread,
+    BitReader* r,
+    Arcadia_SizeValue n
+  )
+{
+  if (r->position + n > r->numberOfBytes * 8) {
+    fail(thread, Arcadia_Status_EncodingInvalid);
+  }
+  Arcadia_Natural64Value value = 0;
+  for (Arcadia_SizeValue i = 0; i < n; ++i) {
+    Arcadia_SizeValue p = r->position++;
+    value = (value << 1) | ((r->bytes[p / 8] >> (7 - p % 8)) & 1);
+  }
+  return (Arcadia_Natural32Value)value;
+}
+
+// Read a signed value of n bits in two's complement, n in [1,32].
+static Arcadia_Integer32Value
+readSignedBits
+  (
+    Arcadia_Thread* thread,
+    BitReader* r,
+    Arcadia_SizeValue n
+  )
+{
+  Arcadia_Natural32Value value = readBits(thread, r, n);
+  if (n < 32 && (value & (((Arcadia_Natural32Value)1) << (n - 1)))) {
+    value |= ~((((Arcadia_Natural32Value)1) << n) - 1);
+  }
+  return (Arcadia_Integer32Value)value;
+}
+
+static Arcadia_Natural32Value
+readUnary
+  (
+    Arcadia_Thread* thread,
+    BitReader* r
+  )
+{
+  Arcadia_Natural32Value q = 0;
+  while (!readBits(thread, r, 1)) {
+    q++;
+  }
+  return q;
+}
+
+static Arcadia_Natural8Value
+computeCrc8
+  (
+    Arcadia_Natural8Value const* p,
+    Arcadia_SizeValue n
+  )
+{
+  Arcadia_Natural8Value crc = 0;
+  for (Arcadia_SizeValue i = 0; i < n; ++i) {
+    crc ^= p[i];
+    for (Arcadia_SizeValue j = 0; j < 8; ++j) {
+      crc = (Arcadia_Natural8Value)(crc & 0x80 ? (crc << 1) ^ 0x07 : crc << 1);
+    }
+  }
+  return crc;
+}
+
+static Arcadia_Natural16Value
+computeCrc16
+  (
+    Arcadia_Natural8Value const* p,
+    Arcadia_SizeValue n
+  )
+{
+  Arcadia_Natural16Value crc = 0;
+  for (Arcadia_SizeValue i = 0; i < n; ++i) {
+    crc ^= (Arcadia_Natural16Value)(p[i] << 8);
+    for (Arcadia_SizeValue j = 0; j < 8; ++j) {
+      crc = (Arcadia_Natural16Value)(crc & 0x8000 ? (crc << 1) ^ 0x8005 : crc << 1);
+    }
+  }
+  return crc;
+}
+
+static void
+decodeResidual
+  (
+    Arcadia_Thread* thread,
+    BitReader* r,
+    Arcadia_SizeValue blockSize,
+    Arcadia_SizeValue order,
+    Arcadia_Integer32Value* residuals
+  )
+{
+  Arcadia_Natural32Value method = readBits(thread, r, 2);
+  if (method > 1) {
+    fail(thread, Arcadia_Status_EncodingInvalid);
+  }
+  Arcadia_SizeValue parameterBits = 0 == method ? 4 : 5;
+  Arcadia_Natural32Value escape = 0 == method ? 15 : 31;
+  Arcadia_SizeValue partitionOrder = readBits(thread, r, 4);
+  Arcadia_SizeValue numberOfPartitions = ((Arcadia_SizeValue)1) << partitionOrder;
+  if (blockSize % numberOfPartitions || (blockSize >> partitionOrder) < order) {
+    fail(thread, Arcadia_Status_EncodingInvalid);
+  }
+  for (Arcadia_SizeValue p = 0; p < numberOfPartitions; ++p) {
+    Arcadia_SizeValue count = (blockSize >> partitionOrder) - (0 == p ? order : 0);
+    Arcadia_Natural32Value k = readBits(thread, r, parameterBits);
+    if (escape == k) {
+      Arcadia_SizeValue n = readBits(thread, r, 5);
+      for (Arcadia_SizeValue i = 0; i < count; ++i) {
+        *residuals++ = n ? readSignedBits(thread, r, n) : 0;
+      }
+    } else {
+      for (Arcadia_SizeValue i = 0; i < count; ++i) {
+        Arcadia_Natural32Value u = (readUnary(thread, r) << k) | readBits(thread, r, k);
+        *residuals++ = (Arcadia_Integer32Value)(u >> 1) ^ -(Arcadia_Integer32Value)(u & 1);
+      }
+    }
+  }
+}
+
+static void
+decodeSubframe
+  (
+    Arcadia_Thread* thread,
+    BitReader* r,
+    Arcadia_SizeValue blockSize,
+    Arcadia_SizeValue bitsPerSample,
+    Arcadia_Integer32Value* samples
+  )
+{
+  static const Arcadia_Integer32Value fixedCoefficients[5][4] = {
+    { 0, 0, 0, 0 },
+    { 1, 0, 0, 0 },
+    { 2, -1, 0, 0 },
+    { 3, -3, 1, 0 },
+    { 4, -6, 4, -1 },
+  };
+  if (readBits(thread, r, 1)) {
+    fail(thread, Arcadia_Status_EncodingInvalid);
+  }
+  Arcadia_Natural32Value type = readBits(thread, r, 6);
+  Arcadia_SizeValue wastedBits = 0;
+  if (readBits(thread, r, 1)) {
+    wastedBits = 1 + readUnary(thread, r);
+  }
+  if (wastedBits >= bitsPerSample) {
+    fail(thread, Arcadia_Status_EncodingInvalid);
+  }
+  bitsPerSample -= wastedBits;
+  if (0 == type) {
+    Arcadia_Integer32Value value = readSignedBits(thread, r, bitsPerSample);
+    for (Arcadia_SizeValue i = 0; i < blockSize; ++i) {
+      samples[i] = value;
+    }
+  } else if (1 == type) {
+    for (Arcadia_SizeValue i = 0; i < blockSize; ++i) {
+      samples[i] = readSignedBits(thread, r, bitsPerSample);
+    }
+  } else if (type >= 8 && type <= 12) {
+    Arcadia_SizeValue order = type - 8;
+    if (order > blockSize) {
+      fail(thread, Arcadia_Status_EncodingInvalid);
+    }
+    for (Arcadia_SizeValue i = 0; i < order; ++i) {
+      samples[i] = readSignedBits(thread, r, bitsPerSample);
+    }
+    decodeResidual(thread, r, blockSize, order, samples + order);
+    for (Arcadia_SizeValue i = order; i < blockSize; ++i) {
+      Arcadia_Integer64Value prediction = 0;
+      for (Arcadia_SizeValue j = 0; j < order; ++j) {
+        prediction += (Arcadia_Integer64Value)fixedCoefficients[order][j] * samples[i - 1 - j];
+      }
+      samples[i] = (Arcadia_Integer32Value)(samples[i] + prediction);
+    }
+  } else if (type >= 32) {
+    Arcadia_SizeValue order = type - 31;
+    if (order > blockSize) {
+      fail(thread, Arcadia_Status_EncodingInvalid);
+    }
+    for (Arcadia_SizeValue i = 0; i < order; ++i) {
+      samples[i] = readSignedBits(thread, r, bitsPerSample);
+    }
+    Arcadia_SizeValue precision = readBits(thread, r, 4) + 1;
+    if (16 == precision) {
+      fail(thread, Arcadia_Status_EncodingInvalid);
+    }
+    Arcadia_Integer32Value shift = readSignedBits(thread, r, 5);
+    if (shift < 0) {
+      fail(thread, Arcadia_Status_EncodingInvalid);
+    }
+    Arcadia_Integer32Value coefficients[32];
+    for (Arcadia_SizeValue i = 0; i < order; ++i) {
+      coefficients[i] = readSignedBits(thread, r, precision);
+    }
+    decodeResidual(thread, r, blockSize, order, samples + order);
+    for (Arcadia_SizeValue i = order; i < blockSize; ++i) {
+      Arcadia_Integer64Value prediction = 0;
+      for (Arcadia_SizeValue j = 0; j < order; ++j) {
+        prediction += (Arcadia_Integer64Value)coefficients[j] * samples[i - 1 - j];
+      }
+      samples[i] = (Arcadia_Integer32Value)(samples[i] + (prediction >> shift));
+    }
+  } else {
+    fail(thread, Arcadia_Status_EncodingInvalid);
+  }
+  if (wastedBits) {
+    for (Arcadia_SizeValue i = 0; i < blockSize; ++i) {
+      samples[i] = (Arcadia_Integer32Value)((Arcadia_Natural32Value)samples[i] << wastedBits);
+    }
+  }
+}
+
+// Decode a frame. Returns the number of samples of the frame.
+static Arcadia_SizeValue
+decodeFrame
+  (
+    Arcadia_Thread* thread,
+    BitReader* r,
+    FLACStream* stream,
+    Arcadia_Natural64Value frameIndex,
+    Arcadia_Integer32Value* samples,
+    Arcadia_Natural64Value numberOfSamplesLeft
+  )
+{
+  Arcadia_SizeValue start = r->position / 8;
+  if (0x7ffc != readBits(thread, r, 15)) {
+    fail(thread, Arcadia_Status_EncodingInvalid);
+  }
+  if (readBits(thread, r, 1)) {
+    // Variable block size streams are not supported.
+    fail(thread, Arcadia_Status_NotImplemented);
+  }
+  Arcadia_Natural32Value blockSizeCode = readBits(thread, r, 4);
+  Arcadia_Natural32Value sampleRateCode = readBits(thread, r, 4);
+  Arcadia_Natural32Value channelAssignment = readBits(thread, r, 4);
+  Arcadia_Natural32Value sampleSizeCode = readBits(thread, r, 3);
+  if (readBits(thread, r, 1)) {
+    fail(thread, Arcadia_Status_EncodingInvalid);
+  }
+  // The frame number in the variable length code of UTF-8.
+  Arcadia_Natural32Value first = readBits(thread, r, 8);
+  Arcadia_Natural64Value number;
+  if (!(first & 0x80)) {
+    number = first;
+  } else {
+    Arcadia_SizeValue numberOfBytes = 0;
+    while (numberOfBytes < 8 && (first & (0x80 >> numberOfBytes))) {
+      numberOfBytes++;
+    }
+    if (numberOfBytes < 2 || numberOfBytes > 7) {
+      fail(thread, Arcadia_Status_EncodingInvalid);
+    }
+    number = first & (0x7f >> numberOfBytes);
+    for (Arcadia_SizeValue i = 1; i < numberOfBytes; ++i) {
+      Arcadia_Natural32Value x = readBits(thread, r, 8);
+      if (0x80 != (x & 0xc0)) {
+        fail(thread, Arcadia_Status_EncodingInvalid);
+      }
+      number = (number << 6) | (x & 0x3f);
+    }
+  }
+  if (number != frameIndex) {
+    fail(thread, Arcadia_Status_EncodingInvalid);
+  }
+  Arcadia_SizeValue blockSize = 0;
+  if (0 == blockSizeCode) {
+    fail(thread, Arcadia_Status_EncodingInvalid);
+  } else if (1 == blockSizeCode) {
+    blockSize = 192;
+  } else if (blockSizeCode <= 5) {
+    blockSize = 576 << (blockSizeCode - 2);
+  } else if (6 == blockSizeCode) {
+    blockSize = readBits(thread, r, 8) + 1;
+  } else if (7 == blockSizeCode) {
+    blockSize = readBits(thread, r, 16) + 1;
+  } else {
+    blockSize = 256 << (blockSizeCode - 8);
+  }
+  static const Arcadia_Natural32Value sampleRates[] = { 0, 88200, 176400, 192000, 8000, 16000, 22050, 24000, 32000, 44100, 48000, 96000 };
+  Arcadia_Natural32Value sampleRate = 0;
+  if (sampleRateCode < 12) {
+    sampleRate = 0 == sampleRateCode ? stream->sampleRate : sampleRates[sampleRateCode];
+  } else if (12 == sampleRateCode) {
+    sampleRate = readBits(thread, r, 8) * 1000;
+  } else if (13 == sampleRateCode) {
+    sampleRate = readBits(thread, r, 16);
+  } else if (14 == sampleRateCode) {
+    sampleRate = readBits(thread, r, 16) * 10;
+  } else {
+    fail(thread, Arcadia_Status_EncodingInvalid);
+  }
+  static const Arcadia_SizeValue sampleSizes[] = { 0, 8, 12, 0, 16, 20, 24, 32 };
+  Arcadia_SizeValue bitsPerSample = 0 == sampleSizeCode ? stream->bitsPerSample : sampleSizes[sampleSizeCode];
+  if (3 == sampleSizeCode) {
+    fail(thread, Arcadia_Status_EncodingInvalid);
+  }
+  if (0 != channelAssignment) {
+    fail(thread, Arcadia_Status_NotImplemented);
+  }
+  if (sampleRate != stream->sampleRate || bitsPerSample != stream->bitsPerSample) {
+    fail(thread, Arcadia_Status_EncodingInvalid);
+  }
+  // All frames but the last have the block size of the stream information.
+  if (blockSize > numberOfSamplesLeft || (blockSize < numberOfSamplesLeft && blockSize != stream->maximumBlockSize) || blockSize > stream->maximumBlockSize) {
+    fail(thread, Arcadia_Status_EncodingInvalid);
+  }
+  Arcadia_SizeValue end = r->position / 8;
+  if (computeCrc8(r->bytes + start, end - start) != readBits(thread, r, 8)) {
+    fail(thread, Arcadia_Status_EncodingInvalid);
+  }
+  decodeSubframe(thread, r, blockSize, bitsPerSample, samples);
+  // Zero padding to the next Byte boundary.
+  if (r->position % 8) {
+    if (readBits(thread, r, 8 - r->position % 8)) {
+      fail(thread, Arcadia_Status_EncodingInvalid);
+    }
+  }
+  end = r->position / 8;
+  if (computeCrc16(r->bytes + start, end - start) != readBits(thread, r, 16)) {
+    fail(thread, Arcadia_Status_EncodingInvalid);
+  }
+  return blockSize;
+}
+
+void
+FLACStream_decode
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes,
+    FLACStream* stream
+  )
+{
+  stream->samples = NULL;
+  BitReader r = { .bytes = bytes, .numberOfBytes = numberOfBytes, .position = 0 };
+  if (0x664c6143 != readBits(thread, &r, 32)) {
+    fail(thread, Arcadia_Status_EncodingInvalid);
+  }
+  Arcadia_BooleanValue hasStreamInformation = Arcadia_BooleanValue_False;
+  Arcadia_BooleanValue isLast = Arcadia_BooleanValue_False;
+  while (!isLast) {
+    isLast = readBits(thread, &r, 1);
+    Arcadia_Natural32Value type = readBits(thread, &r, 7);
+    Arcadia_Natural32Value length = readBits(thread, &r, 24);
+    if (0 == type) {
+      if (hasStreamInformation || 34 != length) {
+        fail(thread, Arcadia_Status_EncodingInvalid);
+      }
+      hasStreamInformation = Arcadia_BooleanValue_True;
+      stream->minimumBlockSize = readBits(thread, &r, 16);
+      stream->maximumBlockSize = readBits(thread, &r, 16);
+      readBits(thread, &r, 24);
+      readBits(thread, &r, 24);
+      stream->sampleRate = readBits(thread, &r, 20);
+      stream->numberOfChannels = readBits(thread, &r, 3) + 1;
+      stream->bitsPerSample = readBits(thread, &r, 5) + 1;
+      stream->numberOfSamples = ((Arcadia_Natural64Value)readBits(thread, &r, 4) << 32) | readBits(thread, &r, 32);
+      for (Arcadia_SizeValue i = 0; i < 16; ++i) {
+        stream->md5[i] = (Arcadia_Natural8Value)readBits(thread, &r, 8);
+      }
+    } else {
+      if (!hasStreamInformation) {
+        fail(thread, Arcadia_Status_EncodingInvalid);
+      }
+      for (Arcadia_SizeValue i = 0; i < length; ++i) {
+        readBits(thread, &r, 8);
+      }
+    }
+  }
+  if (stream->minimumBlockSize < 16 || stream->minimumBlockSize != stream->maximumBlockSize || 1 != stream->numberOfChannels || 0 == stream->sampleRate) {
+    fail(thread, Arcadia_Status_NotImplemented);
+  }
+  stream->samples = Arcadia_Memory_allocateUnmanaged(thread, (stream->numberOfSamples + 1) * sizeof(Arcadia_Integer32Value));
+  Arcadia_Natural64Value numberOfSamples = 0;
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    for (Arcadia_Natural64Value frameIndex = 0; numberOfSamples < stream->numberOfSamples; ++frameIndex) {
+      numberOfSamples += decodeFrame(thread, &r, stream, frameIndex, stream->samples + numberOfSamples, stream->numberOfSamples - numberOfSamples);
+    }
+    if (r.position != numberOfBytes * 8) {
+      fail(thread, Arcadia_Status_EncodingInvalid);
+    }
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    FLACStream_uninitialize(thread, stream);
+    Arcadia_Thread_jump(thread);
+  }
+}
+
+void
+FLACStream_uninitialize
+  (
+    Arcadia_Thread* thread,
+    FLACStream* stream
+  )
+{
+  if (stream->samples) {
+    Arcadia_Memory_deallocateUnmanaged(thread, stream->samples);
+    stream->samples = NULL;
+  }
+}
@@ -0,0 +1,64 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_SAMPLEBUFFERIO_TESTS_WRITEFLACTESTS_DECODER_H_INCLUDED)
+#define ARCADIA_SAMPLEBUFFERIO_TESTS_WRITEFLACTESTS_DECODER_H_INCLUDED
+
+#include "Arcadia/Ring2/Include.h"
+
+/// @summary
+/// A decoder for "FLAC" streams written against the specification (RFC 9639) independently of the encoder.
+/// The decoder supports streams with one channel and a stream information metadata block.
+/// It verifies the CRC-8 of each frame header and the CRC-16 of each frame,
+/// and it verifies that the frame headers are consistent with the stream information.
+typedef struct FLACStream {
+  Arcadia_SizeValue minimumBlockSize;
+  Arcadia_SizeValue maximumBlockSize;
+  Arcadia_Natural32Value sampleRate;
+  Arcadia_SizeValue numberOfChannels;
+  Arcadia_SizeValue bitsPerSample;
+  Arcadia_Natural64Value numberOfSamples;
+  Arcadia_Natural8Value md5[16];
+  // The decoded samples.
+  Arcadia_Integer32Value* samples;
+} FLACStream;
+
+/// @brief Decode a FLAC stream.
+/// @param thread A pointer to this thread.
+/// @param bytes A pointer to the Bytes of the stream.
+/// @param numberOfBytes The number of Bytes of the stream.
+/// @param stream A pointer to the FLAC stream. The samples must be released with FLACStream_uninitialize.
+/// @error #Arcadia_Status_EncodingInvalid the stream is not a valid FLAC stream
+/// @error #Arcadia_Status_NotImplemented the stream is not supported
+void
+FLACStream_decode
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes,
+    FLACStream* stream
+  );
+
+/// @brief Release the samples of a FLAC stream.
+/// @param thread A pointer to this thread.
+/// @param stream A pointer to the FLAC stream.
+void
+FLACStream_uninitialize
+  (
+    Arcadia_Thread* thread,
+    FLACStream* stream
+  );
+
+#endif // ARCADIA_SAMPLEBUFFERIO_TESTS_WRITEFLACTESTS_DECODER_H_INCLUDED
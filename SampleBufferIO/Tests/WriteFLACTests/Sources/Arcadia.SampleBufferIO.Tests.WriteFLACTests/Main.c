@@ -17,13 +17,416 @@
 #include <string.h>
 
 #include "Arcadia/SampleBufferIO/Include.h"
+#include "Arcadia.SampleBufferIO.Tests.WriteFLACTests/Decoder.h"
+#include "Arcadia.SampleBufferIO.Tests.WriteFLACTests/Reference.h"
 
+static const Arcadia_Media_SampleFormat g_sampleFormats[] = {
+  Arcadia_Media_SampleFormat_Integer16,
+  Arcadia_Media_SampleFormat_Integer8,
+  Arcadia_Media_SampleFormat_Natural16,
+  Arcadia_Media_SampleFormat_Natural8,
+};
+
+#define NumberOfSampleFormats (sizeof(g_sampleFormats) / sizeof(g_sampleFormats[0]))
+
+static Arcadia_SizeValue
+getBitsPerSample
+  (
+    Arcadia_Media_SampleFormat sampleFormat
+  )
+{
+  return Arcadia_Media_SampleFormat_Integer16 == sampleFormat || Arcadia_Media_SampleFormat_Natural16 == sampleFormat ? 16 : 8;
+}
+
+static Arcadia_SizeValue
+getNumberOfSamples
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleBuffer* sampleBuffer
+  )
+{ return (Arcadia_SizeValue)Arcadia_Media_SampleBuffer_getLength(thread, sampleBuffer) * (Arcadia_SizeValue)Arcadia_Media_SampleBuffer_getSampleRate(thread, sampleBuffer); }
+
+// Get a sample as a signed value.
+static Arcadia_Integer32Value
+getSample
+  (
+    Arcadia_Media_SampleBuffer* sampleBuffer,
+    Arcadia_SizeValue i
+  )
+{
+  switch (sampleBuffer->sampleFormat) {
+    case Arcadia_Media_SampleFormat_Integer16: return ((Arcadia_Integer16Value*)sampleBuffer->bytes)[i];
+    case Arcadia_Media_SampleFormat_Integer8: return ((Arcadia_Integer8Value*)sampleBuffer->bytes)[i];
+    case Arcadia_Media_SampleFormat_Natural16: return (Arcadia_Integer32Value)((Arcadia_Natural16Value*)sampleBuffer->bytes)[i] - 32768;
+    case Arcadia_Media_SampleFormat_Natural8: return (Arcadia_Integer32Value)((Arcadia_Natural8Value*)sampleBuffer->bytes)[i] - 128;
+    default: return 0;
+  };
+}
+
+// Set a sample from a signed value.
 static void
-test1
+setSample
+  (
+    Arcadia_Media_SampleBuffer* sampleBuffer,
+    Arcadia_SizeValue i,
+    Arcadia_Integer32Value value
+  )
+{
+  switch (sampleBuffer->sampleFormat) {
+    case Arcadia_Media_SampleFormat_Integer16: ((Arcadia_Integer16Value*)sampleBuffer->bytes)[i] = (Arcadia_Integer16Value)value; break;
+    case Arcadia_Media_SampleFormat_Integer8: ((Arcadia_Integer8Value*)sampleBuffer->bytes)[i] = (Arcadia_Integer8Value)value; break;
+    case Arcadia_Media_SampleFormat_Natural16: ((Arcadia_Natural16Value*)sampleBuffer->bytes)[i] = (Arcadia_Natural16Value)(value + 32768); break;
+    case Arcadia_Media_SampleFormat_Natural8: ((Arcadia_Natural8Value*)sampleBuffer->bytes)[i] = (Arcadia_Natural8Value)(value + 128); break;
+    default: break;
+  };
+}
+
+// Fill a sample buffer with a signal which switches between tones, noise, silence, steps, and full scale values.
+static void
+fillMixed
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_SampleBuffer* sampleBuffer
+  )
+{
+  Arcadia_SizeValue bitsPerSample = getBitsPerSample(sampleBuffer->sampleFormat);
+  Arcadia_Integer32Value maximum = (1 << (bitsPerSample - 1)) - 1, minimum = -(1 << (bitsPerSample - 1));
+  Arcadia_Natural32Value seed = 13;
+  Arcadia_Integer32Value tone = 0, step = 0;
+  for (Arcadia_SizeValue i = 0, n = getNumberOfSamples(thread, sampleBuffer); i < n; ++i) {
+    seed = seed * 1664525 + 1013904223;
+    Arcadia_Integer32Value noise = (Arcadia_Integer32Value)(seed >> (32 - bitsPerSample)) + minimum;
+    // A triangle wave with a period of 200 samples.
+    tone = (Arcadia_Integer32Value)(i % 200 < 100 ? i % 200 : 200 - i % 200) * (maximum / 100) + minimum / 2;
+    Arcadia_Integer32Value value;
+    switch ((i / 1000) % 6) {
+      case 0: value = tone; break;
+      case 1: value = noise; break;
+      case 2: value = 0; break;
+      case 3: value = tone / 2 + noise / 16; break;
+      case 4: value = (i / 100) % 2 ? maximum : minimum; break;
+      default: {
+        step = 0 == i % 50 ? noise : step;
+        value = step;
+      } break;
+    };
+    setSample(sampleBuffer, i, value);
+  }
+}
+
+// Compare a decoded FLAC stream with the sample buffer it was encoded from and release the samples of the FLAC stream.
+static void
+assertEqual
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SampleBufferIO_FLACEncoder* encoder,
+    Arcadia_Media_SampleBuffer* sampleBuffer,
+    FLACStream* stream
+  )
+{
+  Arcadia_BooleanValue equal = stream->numberOfSamples == getNumberOfSamples(thread, sampleBuffer)
+                            && stream->sampleRate == (Arcadia_Natural32Value)Arcadia_Media_SampleBuffer_getSampleRate(thread, sampleBuffer)
+                            && stream->bitsPerSample == getBitsPerSample(sampleBuffer->sampleFormat)
+                            && stream->maximumBlockSize == Arcadia_SampleBufferIO_FLACEncoder_getBlockSize(thread, encoder);
+  for (Arcadia_SizeValue i = 0; equal && i < stream->numberOfSamples; ++i) {
+    equal = stream->samples[i] == getSample(sampleBuffer, i);
+  }
+  FLACStream_uninitialize(thread, stream);
+  Arcadia_Tests_assertTrue(thread, equal);
+}
+
+// Encode a sample buffer, decode it, and compare the samples.
+// If libFLAC is available, the encoded Bytes are also decoded by libFLAC, the reference decoder.
+static void
+assertRoundTrip
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SampleBufferIO_FLACEncoder* encoder,
+    Arcadia_Media_SampleBuffer* sampleBuffer,
+    Arcadia_ByteArrayBuilder* target
+  )
+{
+  Arcadia_ByteArrayBuilder_clear(thread, target);
+  Arcadia_SampleBufferIO_FLACEncoder_encodeToByteArrayBuilder(thread, encoder, sampleBuffer, target);
+  FLACStream stream;
+  FLACStream_decode(thread, Arcadia_ByteArrayBuilder_getBytes(thread, target), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, target), &stream);
+  assertEqual(thread, encoder, sampleBuffer, &stream);
+#if Arcadia_SampleBufferIO_Tests_WriteFLACTests_Configuration_libFLAC_Enabled
+  FLACStream_decodeWithReferenceDecoder(thread, Arcadia_ByteArrayBuilder_getBytes(thread, target), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, target), &stream);
+  assertEqual(thread, encoder, sampleBuffer, &stream);
+#endif
+}
+
+// Encode signals of all sample formats with all compression levels.
+static void
+testCompressionLevels
   (
     Arcadia_Thread* thread
   )
-{ Arcadia_SampleBufferIO_encodeFLAC(thread); }
+{
+  Arcadia_SampleBufferIO_FLACEncoder* encoder = Arcadia_SampleBufferIO_FLACEncoder_create(thread);
+  Arcadia_ByteArrayBuilder* target = Arcadia_ByteArrayBuilder_create(thread);
+  for (Arcadia_SizeValue i = 0; i < NumberOfSampleFormats; ++i) {
+    for (Arcadia_SizeValue j = 0; j < 4; ++j) {
+      Arcadia_Media_SampleBuffer* sampleBuffer = Arcadia_Media_SampleBuffer_create(thread, 1, 8000, g_sampleFormats[i]);
+      switch (j) {
+        case 0: {
+          Arcadia_Media_SampleBuffer_fill(thread, sampleBuffer, (Arcadia_Media_DSP*)Arcadia_Media_DSP_SineWave_create(thread, 440));
+        } break;
+        case 1: {
+          Arcadia_Media_SampleBuffer_fill(thread, sampleBuffer, (Arcadia_Media_DSP*)Arcadia_Media_DSP_WhiteNoise_create(thread));
+        } break;
+        case 2: {
+          fillMixed(thread, sampleBuffer);
+        } break;
+        case 3: {
+          /* Silence. */
+        } break;
+      };
+      for (Arcadia_Integer32Value level = 0; level <= 8; ++level) {
+        Arcadia_SampleBufferIO_FLACEncoder_setCompressionLevel(thread, encoder, level);
+        assertRoundTrip(thread, encoder, sampleBuffer, target);
+      }
+    }
+  }
+}
+
+// Encode signals with different block sizes and sample rates.
+static void
+testBlockSizesAndSampleRates
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static const Arcadia_SizeValue blockSizes[] = { 16, 100, 1152, 4096, 65535 };
+  // Sample rates with a predefined code, in kHz, in Hz, in 10 Hz, and only in the stream information.
+  static const Arcadia_Integer32Value sampleRates[] = { 44100, 37000, 11025, 100000, 200001 };
+  Arcadia_SampleBufferIO_FLACEncoder* encoder = Arcadia_SampleBufferIO_FLACEncoder_create(thread);
+  Arcadia_ByteArrayBuilder* target = Arcadia_ByteArrayBuilder_create(thread);
+  for (Arcadia_SizeValue i = 0; i < sizeof(blockSizes) / sizeof(blockSizes[0]); ++i) {
+    Arcadia_SampleBufferIO_FLACEncoder_setBlockSize(thread, encoder, blockSizes[i]);
+    for (Arcadia_SizeValue j = 0; j < sizeof(sampleRates) / sizeof(sampleRates[0]); ++j) {
+      Arcadia_Media_SampleBuffer* sampleBuffer = Arcadia_Media_SampleBuffer_create(thread, 1, sampleRates[j], Arcadia_Media_SampleFormat_Integer16);
+      fillMixed(thread, sampleBuffer);
+      assertRoundTrip(thread, encoder, sampleBuffer, target);
+    }
+  }
+}
+
+// The encoded Bytes do not depend on the number of workers.
+static void
+testWorkers
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Media_SampleBuffer* sampleBuffer = Arcadia_Media_SampleBuffer_create(thread, 5, 44100, Arcadia_Media_SampleFormat_Integer16);
+  fillMixed(thread, sampleBuffer);
+  Arcadia_SampleBufferIO_FLACEncoder* encoder = Arcadia_SampleBufferIO_FLACEncoder_create(thread);
+  Arcadia_SampleBufferIO_FLACEncoder_setNumberOfWorkers(thread, encoder, 1);
+  Arcadia_ByteArrayBuilder* expected = Arcadia_ByteArrayBuilder_create(thread);
+  assertRoundTrip(thread, encoder, sampleBuffer, expected);
+  static const Arcadia_SizeValue numberOfWorkers[] = { 0, 2, 3 };
+  for (Arcadia_SizeValue i = 0; i < sizeof(numberOfWorkers) / sizeof(numberOfWorkers[0]); ++i) {
+    Arcadia_SampleBufferIO_FLACEncoder_setNumberOfWorkers(thread, encoder, numberOfWorkers[i]);
+    Arcadia_ByteArrayBuilder* actual = Arcadia_ByteArrayBuilder_create(thread);
+    assertRoundTrip(thread, encoder, sampleBuffer, actual);
+    Arcadia_Tests_assertTrue(thread, Arcadia_ByteArrayBuilder_isEqualTo(thread, expected, actual));
+  }
+}
+
+// The MD5 of the stream information is the MD5 of the signed samples in little endian.
+static void
+testMD5
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static const Arcadia_Natural8Value expected16[16] = {
+    0xd2, 0xa0, 0xa3, 0x24, 0xaf, 0xd5, 0xd3, 0xd7, 0x79, 0x09, 0x21, 0x75, 0x5d, 0x55, 0xa3, 0xb7,
+  };
+  static const Arcadia_Natural8Value expected8[16] = {
+    0x37, 0xb3, 0xb4, 0xf9, 0x9a, 0x69, 0xc4, 0x70, 0xd5, 0xbd, 0x43, 0x72, 0x9c, 0x1c, 0x4d, 0x30,
+  };
+  Arcadia_ByteArrayBuilder* target = Arcadia_ByteArrayBuilder_create(thread);
+  FLACStream stream;
+
+  Arcadia_Media_SampleBuffer* sampleBuffer = Arcadia_Media_SampleBuffer_create(thread, 1, 8000, Arcadia_Media_SampleFormat_Integer16);
+  for (Arcadia_SizeValue i = 0; i < 8000; ++i) {
+    setSample(sampleBuffer, i, (Arcadia_Integer32Value)((i * 37) % 65536) - 32768);
+  }
+  Arcadia_SampleBufferIO_encodeFLAC(thread, sampleBuffer, target);
+  FLACStream_decode(thread, Arcadia_ByteArrayBuilder_getBytes(thread, target), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, target), &stream);
+  FLACStream_uninitialize(thread, &stream);
+  Arcadia_Tests_assertTrue(thread, !memcmp(stream.md5, expected16, 16));
+
+  sampleBuffer = Arcadia_Media_SampleBuffer_create(thread, 1, 8000, Arcadia_Media_SampleFormat_Natural8);
+  for (Arcadia_SizeValue i = 0; i < 8000; ++i) {
+    ((Arcadia_Natural8Value*)sampleBuffer->bytes)[i] = (Arcadia_Natural8Value)((i * 7) % 256);
+  }
+  Arcadia_ByteArrayBuilder_clear(thread, target);
+  Arcadia_SampleBufferIO_encodeFLAC(thread, sampleBuffer, target);
+  FLACStream_decode(thread, Arcadia_ByteArrayBuilder_getBytes(thread, target), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, target), &stream);
+  FLACStream_uninitialize(thread, &stream);
+  Arcadia_Tests_assertTrue(thread, !memcmp(stream.md5, expected8, 16));
+}
+
+// Decode the stream of the decoding example in appendix D.3 of RFC 9639, which was produced by the reference encoder.
+// The stream has one frame of 24 8 bit samples at 32000 Hz with a linear predictor of order 3.
+// The decoder must reconstruct the samples listed in the example,
+// and the MD5 signature computed by the encoder for these samples must be the MD5 signature of the stream.
+static void
+testReferenceVectors
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static const Arcadia_Natural8Value bytes[] = {
+    0x66, 0x4c, 0x61, 0x43, 0x80, 0x00, 0x00, 0x22, 0x10, 0x00, 0x10, 0x00,
+    0x00, 0x00, 0x1f, 0x00, 0x00, 0x1f, 0x07, 0xd0, 0x00, 0x70, 0x00, 0x00,
+    0x00, 0x18, 0xf8, 0xf9, 0xe3, 0x96, 0xf5, 0xcb, 0xcf, 0xc6, 0xdc, 0x80,
+    0x7f, 0x99, 0x77, 0x90, 0x6b, 0x32, 0xff, 0xf8, 0x68, 0x02, 0x00, 0x17,
+    0xe9, 0x44, 0x00, 0x4f, 0x6f, 0x31, 0x3d, 0x10, 0x47, 0xd2, 0x27, 0xcb,
+    0x6d, 0x09, 0x08, 0x31, 0x45, 0x2b, 0xdc, 0x28, 0x22, 0x22, 0x80, 0x57,
+    0xa3,
+  };
+  static const Arcadia_Integer32Value samples[] = {
+    0, 79, 111, 78, 8, -61, -90, -68, -13, 42, 67, 53, 13, -27, -46, -38, -12, 14, 24, 19, 6, -4, -5, 0,
+  };
+  static const Arcadia_SizeValue numberOfSamples = sizeof(samples) / sizeof(samples[0]);
+  FLACStream expected;
+  FLACStream_decode(thread, bytes, sizeof(bytes), &expected);
+  Arcadia_BooleanValue equal = expected.numberOfSamples == numberOfSamples
+                            && expected.sampleRate == 32000
+                            && expected.bitsPerSample == 8;
+  for (Arcadia_SizeValue i = 0; equal && i < numberOfSamples; ++i) {
+    equal = expected.samples[i] == samples[i];
+  }
+  FLACStream_uninitialize(thread, &expected);
+  Arcadia_Tests_assertTrue(thread, equal);
+  // The number of samples of a sample buffer is a multiple of its sample rate.
+  // The MD5 signature does not depend on the sample rate: use a sample rate of 24 Hz to encode exactly the 24 samples.
+  Arcadia_Media_SampleBuffer* sampleBuffer = Arcadia_Media_SampleBuffer_create(thread, 1, (Arcadia_Integer32Value)numberOfSamples, Arcadia_Media_SampleFormat_Integer8);
+  for (Arcadia_SizeValue i = 0; i < numberOfSamples; ++i) {
+    setSample(sampleBuffer, i, samples[i]);
+  }
+  Arcadia_SampleBufferIO_FLACEncoder* encoder = Arcadia_SampleBufferIO_FLACEncoder_create(thread);
+  Arcadia_ByteArrayBuilder* target = Arcadia_ByteArrayBuilder_create(thread);
+  for (Arcadia_Integer32Value level = 0; level <= 8; ++level) {
+    FLACStream actual;
+    Arcadia_SampleBufferIO_FLACEncoder_setCompressionLevel(thread, encoder, level);
+    Arcadia_ByteArrayBuilder_clear(thread, target);
+    Arcadia_SampleBufferIO_FLACEncoder_encodeToByteArrayBuilder(thread, encoder, sampleBuffer, target);
+    FLACStream_decode(thread, Arcadia_ByteArrayBuilder_getBytes(thread, target), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, target), &actual);
+    equal = actual.numberOfSamples == numberOfSamples
+         && !memcmp(actual.md5, expected.md5, 16);
+    for (Arcadia_SizeValue i = 0; equal && i < numberOfSamples; ++i) {
+      equal = actual.samples[i] == samples[i];
+    }
+    FLACStream_uninitialize(thread, &actual);
+    Arcadia_Tests_assertTrue(thread, equal);
+  }
+}
+
+#if Arcadia_SampleBufferIO_Tests_WriteFLACTests_Configuration_libFLAC_Enabled
+
+// Encode signals of all sample formats with libFLAC, the reference encoder, and decode them with the decoder of these tests.
+// The MD5 signature computed by libFLAC must be the MD5 signature computed by the encoder.
+static void
+testReferenceEncoder
+  (
+    Arcadia_Thread* thread
+  )
+{
+  static const Arcadia_Natural32Value compressionLevels[] = { 0, 5, 8 };
+  Arcadia_ByteArrayBuilder* target = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ByteArrayBuilder* expected = Arcadia_ByteArrayBuilder_create(thread);
+  for (Arcadia_SizeValue i = 0; i < NumberOfSampleFormats; ++i) {
+    for (Arcadia_SizeValue j = 0; j < 3; ++j) {
+      Arcadia_Media_SampleBuffer* sampleBuffer = Arcadia_Media_SampleBuffer_create(thread, 1, 8000, g_sampleFormats[i]);
+      switch (j) {
+        case 0: {
+          Arcadia_Media_SampleBuffer_fill(thread, sampleBuffer, (Arcadia_Media_DSP*)Arcadia_Media_DSP_SineWave_create(thread, 440));
+        } break;
+        case 1: {
+          Arcadia_Media_SampleBuffer_fill(thread, sampleBuffer, (Arcadia_Media_DSP*)Arcadia_Media_DSP_WhiteNoise_create(thread));
+        } break;
+        case 2: {
+          fillMixed(thread, sampleBuffer);
+        } break;
+      };
+      Arcadia_SizeValue numberOfSamples = getNumberOfSamples(thread, sampleBuffer);
+      Arcadia_Integer32Value* samples = Arcadia_Memory_allocateUnmanaged(thread, numberOfSamples * sizeof(Arcadia_Integer32Value));
+      for (Arcadia_SizeValue k = 0; k < numberOfSamples; ++k) {
+        samples[k] = getSample(sampleBuffer, k);
+      }
+      FLACStream expectedStream;
+      Arcadia_ByteArrayBuilder_clear(thread, expected);
+      Arcadia_SampleBufferIO_encodeFLAC(thread, sampleBuffer, expected);
+      FLACStream_decode(thread, Arcadia_ByteArrayBuilder_getBytes(thread, expected), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, expected), &expectedStream);
+      FLACStream_uninitialize(thread, &expectedStream);
+      Arcadia_BooleanValue equal = Arcadia_BooleanValue_True;
+      for (Arcadia_SizeValue k = 0; equal && k < sizeof(compressionLevels) / sizeof(compressionLevels[0]); ++k) {
+        FLACStream stream;
+        Arcadia_ByteArrayBuilder_clear(thread, target);
+        FLACStream_encodeWithReferenceEncoder(thread, samples, numberOfSamples, 8000, getBitsPerSample(g_sampleFormats[i]), compressionLevels[k], target);
+        FLACStream_decode(thread, Arcadia_ByteArrayBuilder_getBytes(thread, target), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, target), &stream);
+        equal = stream.numberOfSamples == numberOfSamples
+             && stream.sampleRate == 8000
+             && stream.bitsPerSample == getBitsPerSample(g_sampleFormats[i])
+             && !memcmp(stream.md5, expectedStream.md5, 16);
+        for (Arcadia_SizeValue l = 0; equal && l < numberOfSamples; ++l) {
+          equal = stream.samples[l] == samples[l];
+        }
+        FLACStream_uninitialize(thread, &stream);
+      }
+      Arcadia_Memory_deallocateUnmanaged(thread, samples);
+      Arcadia_Tests_assertTrue(thread, equal);
+    }
+  }
+}
+
+#endif
+
+static void
+assertArgumentValueInvalid
+  (
+    Arcadia_Thread* thread,
+    Arcadia_SampleBufferIO_FLACEncoder* encoder,
+    Arcadia_Integer32Value compressionLevel,
+    Arcadia_SizeValue blockSize
+  )
+{
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    if (compressionLevel >= 0) {
+      Arcadia_SampleBufferIO_FLACEncoder_setCompressionLevel(thread, encoder, compressionLevel);
+    } else {
+      Arcadia_SampleBufferIO_FLACEncoder_setBlockSize(thread, encoder, blockSize);
+    }
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_BooleanValue_False);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Tests_assertTrue(thread, Arcadia_Status_ArgumentValueInvalid == Arcadia_Thread_getStatus(thread));
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+}
+
+static void
+testInvalidArguments
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_SampleBufferIO_FLACEncoder* encoder = Arcadia_SampleBufferIO_FLACEncoder_create(thread);
+  assertArgumentValueInvalid(thread, encoder, 9, 0);
+  assertArgumentValueInvalid(thread, encoder, -1, 15);
+  assertArgumentValueInvalid(thread, encoder, -1, 65536);
+  Arcadia_Tests_assertTrue(thread, 5 == Arcadia_SampleBufferIO_FLACEncoder_getCompressionLevel(thread, encoder));
+  Arcadia_Tests_assertTrue(thread, 4096 == Arcadia_SampleBufferIO_FLACEncoder_getBlockSize(thread, encoder));
+}
 
 int
 main
@@ -32,7 +435,27 @@ main
     char **argv
   )
 {
-  if (!Arcadia_Tests_safeExecute(&test1)) {
+  if (!Arcadia_Tests_safeExecute(&testCompressionLevels)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testBlockSizesAndSampleRates)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testWorkers)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testMD5)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&testReferenceVectors)) {
+    return EXIT_FAILURE;
+  }
+#if Arcadia_SampleBufferIO_Tests_WriteFLACTests_Configuration_libFLAC_Enabled
+  if (!Arcadia_Tests_safeExecute(&testReferenceEncoder)) {
+    return EXIT_FAILURE;
+  }
+#endif
+  if (!Arcadia_Tests_safeExecute(&testInvalidArguments)) {
     return EXIT_FAILURE;
   }
   return EXIT_SUCCESS;
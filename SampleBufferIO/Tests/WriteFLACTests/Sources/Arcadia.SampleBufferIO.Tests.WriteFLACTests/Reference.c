@@ -0,0 +1,297 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia.SampleBufferIO.Tests.WriteFLACTests/Reference.h"
+
+#if Arcadia_SampleBufferIO_Tests_WriteFLACTests_Configuration_libFLAC_Enabled
+
+#include <string.h>
+#include <FLAC/stream_decoder.h>
+#include <FLAC/stream_encoder.h>
+
+typedef struct DecoderContext {
+  Arcadia_Natural8Value const* bytes;
+  Arcadia_SizeValue numberOfBytes;
+  // The position in Bytes.
+  Arcadia_SizeValue position;
+  FLACStream* stream;
+  Arcadia_BooleanValue hasStreamInformation;
+  // The number of samples decoded so far.
+  Arcadia_Natural64Value numberOfSamples;
+  // Arcadia_BooleanValue_True if libFLAC reported an error or a frame was rejected.
+  Arcadia_BooleanValue hasError;
+} DecoderContext;
+
+static FLAC__StreamDecoderReadStatus
+onDecoderRead
+  (
+    FLAC__StreamDecoder const* decoder,
+    FLAC__byte buffer[],
+    size_t* bytes,
+    void* clientData
+  )
+{
+  DecoderContext* context = (DecoderContext*)clientData;
+  Arcadia_SizeValue n = context->numberOfBytes - context->position;
+  if (n > *bytes) {
+    n = *bytes;
+  }
+  memcpy(buffer, context->bytes + context->position, n);
+  context->position += n;
+  *bytes = n;
+  return n ? FLAC__STREAM_DECODER_READ_STATUS_CONTINUE : FLAC__STREAM_DECODER_READ_STATUS_END_OF_STREAM;
+}
+
+static FLAC__StreamDecoderWriteStatus
+onDecoderWrite
+  (
+    FLAC__StreamDecoder const* decoder,
+    FLAC__Frame const* frame,
+    FLAC__int32 const* const buffer[],
+    void* clientData
+  )
+{
+  DecoderContext* context = (DecoderContext*)clientData;
+  // The samples are allocated after the metadata was decoded.
+  if (!context->stream->samples || 1 != frame->header.channels
+   || frame->header.blocksize > context->stream->numberOfSamples - context->numberOfSamples) {
+    context->hasError = Arcadia_BooleanValue_True;
+    return FLAC__STREAM_DECODER_WRITE_STATUS_ABORT;
+  }
+  for (Arcadia_SizeValue i = 0; i < frame->header.blocksize; ++i) {
+    context->stream->samples[context->numberOfSamples++] = buffer[0][i];
+  }
+  return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
+}
+
+static void
+onDecoderMetadata
+  (
+    FLAC__StreamDecoder const* decoder,
+    FLAC__StreamMetadata const* metadata,
+    void* clientData
+  )
+{
+  DecoderContext* context = (DecoderContext*)clientData;
+  if (FLAC__METADATA_TYPE_STREAMINFO == metadata->type) {
+    FLACStream* stream = context->stream;
+    stream->minimumBlockSize = metadata->data.stream_info.min_blocksize;
+    stream->maximumBlockSize = metadata->data.stream_info.max_blocksize;
+    stream->sampleRate = metadata->data.stream_info.sample_rate;
+    stream->numberOfChannels = metadata->data.stream_info.channels;
+    stream->bitsPerSample = metadata->data.stream_info.bits_per_sample;
+    stream->numberOfSamples = metadata->data.stream_info.total_samples;
+    memcpy(stream->md5, metadata->data.stream_info.md5sum, 16);
+    context->hasStreamInformation = Arcadia_BooleanValue_True;
+  }
+}
+
+static void
+onDecoderError
+  (
+    FLAC__StreamDecoder const* decoder,
+    FLAC__StreamDecoderErrorStatus status,
+    void* clientData
+  )
+{
+  DecoderContext* context = (DecoderContext*)clientData;
+  context->hasError = Arcadia_BooleanValue_True;
+}
+
+void
+FLACStream_decodeWithReferenceDecoder
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes,
+    FLACStream* stream
+  )
+{
+  stream->samples = NULL;
+  DecoderContext context = {
+    .bytes = bytes,
+    .numberOfBytes = numberOfBytes,
+    .position = 0,
+    .stream = stream,
+    .hasStreamInformation = Arcadia_BooleanValue_False,
+    .numberOfSamples = 0,
+    .hasError = Arcadia_BooleanValue_False,
+  };
+  FLAC__StreamDecoder* decoder = FLAC__stream_decoder_new();
+  if (!decoder) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_AllocationFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  FLAC__stream_decoder_set_md5_checking(decoder, 1);
+  if (FLAC__STREAM_DECODER_INIT_STATUS_OK != FLAC__stream_decoder_init_stream(decoder, &onDecoderRead, NULL, NULL, NULL, NULL, &onDecoderWrite, &onDecoderMetadata, &onDecoderError, &context)) {
+    FLAC__stream_decoder_delete(decoder);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Status status = Arcadia_Status_Success;
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    if (!FLAC__stream_decoder_process_until_end_of_metadata(decoder) || !context.hasStreamInformation || context.hasError) {
+      status = Arcadia_Status_EncodingInvalid;
+    } else if (1 != stream->numberOfChannels || 0 == stream->numberOfSamples) {
+      status = Arcadia_Status_NotImplemented;
+    } else {
+      stream->samples = Arcadia_Memory_allocateUnmanaged(thread, stream->numberOfSamples * sizeof(Arcadia_Integer32Value));
+      if (!FLAC__stream_decoder_process_until_end_of_stream(decoder) || context.hasError) {
+        status = Arcadia_Status_EncodingInvalid;
+      }
+    }
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    status = Arcadia_Thread_getStatus(thread);
+  }
+  // Finishing fails if the MD5 signature of the decoded samples does not match the MD5 signature of the stream information.
+  if (!FLAC__stream_decoder_finish(decoder) && Arcadia_Status_Success == status) {
+    status = Arcadia_Status_EncodingInvalid;
+  }
+  FLAC__stream_decoder_delete(decoder);
+  if (Arcadia_Status_Success == status && context.numberOfSamples != stream->numberOfSamples) {
+    status = Arcadia_Status_EncodingInvalid;
+  }
+  if (Arcadia_Status_Success != status) {
+    FLACStream_uninitialize(thread, stream);
+    Arcadia_Thread_setStatus(thread, status);
+    Arcadia_Thread_jump(thread);
+  }
+}
+
+typedef struct EncoderContext {
+  // Unmanaged memory for the stream.
+  Arcadia_Natural8Value* bytes;
+  Arcadia_SizeValue capacity;
+  Arcadia_SizeValue numberOfBytes;
+  // The position in Bytes.
+  Arcadia_SizeValue position;
+} EncoderContext;
+
+static FLAC__StreamEncoderWriteStatus
+onEncoderWrite
+  (
+    FLAC__StreamEncoder const* encoder,
+    FLAC__byte const buffer[],
+    size_t bytes,
+    uint32_t samples,
+    uint32_t currentFrame,
+    void* clientData
+  )
+{
+  EncoderContext* context = (EncoderContext*)clientData;
+  if (bytes > context->capacity - context->position) {
+    return FLAC__STREAM_ENCODER_WRITE_STATUS_FATAL_ERROR;
+  }
+  memcpy(context->bytes + context->position, buffer, bytes);
+  context->position += bytes;
+  if (context->numberOfBytes < context->position) {
+    context->numberOfBytes = context->position;
+  }
+  return FLAC__STREAM_ENCODER_WRITE_STATUS_OK;
+}
+
+// libFLAC seeks to the beginning of the stream to update the stream information when encoding is finished.
+static FLAC__StreamEncoderSeekStatus
+onEncoderSeek
+  (
+    FLAC__StreamEncoder const* encoder,
+    FLAC__uint64 absoluteByteOffset,
+    void* clientData
+  )
+{
+  EncoderContext* context = (EncoderContext*)clientData;
+  if (absoluteByteOffset > context->numberOfBytes) {
+    return FLAC__STREAM_ENCODER_SEEK_STATUS_ERROR;
+  }
+  context->position = (Arcadia_SizeValue)absoluteByteOffset;
+  return FLAC__STREAM_ENCODER_SEEK_STATUS_OK;
+}
+
+static FLAC__StreamEncoderTellStatus
+onEncoderTell
+  (
+    FLAC__StreamEncoder const* encoder,
+    FLAC__uint64* absoluteByteOffset,
+    void* clientData
+  )
+{
+  EncoderContext* context = (EncoderContext*)clientData;
+  *absoluteByteOffset = context->position;
+  return FLAC__STREAM_ENCODER_TELL_STATUS_OK;
+}
+
+void
+FLACStream_encodeWithReferenceEncoder
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Integer32Value const* samples,
+    Arcadia_SizeValue numberOfSamples,
+    Arcadia_Natural32Value sampleRate,
+    Arcadia_SizeValue bitsPerSample,
+    Arcadia_Natural32Value compressionLevel,
+    Arcadia_ByteArrayBuilder* target
+  )
+{
+  // A frame is never greater than its samples stored verbatim plus the frame header and the frame footer.
+  // The memory is allocated before encoding such that the callbacks do not need to allocate.
+  EncoderContext context = {
+    .bytes = NULL,
+    .capacity = numberOfSamples * sizeof(Arcadia_Integer32Value) + 65536,
+    .numberOfBytes = 0,
+    .position = 0,
+  };
+  context.bytes = Arcadia_Memory_allocateUnmanaged(thread, context.capacity);
+  FLAC__StreamEncoder* encoder = FLAC__stream_encoder_new();
+  if (!encoder) {
+    Arcadia_Memory_deallocateUnmanaged(thread, context.bytes);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_AllocationFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  FLAC__bool success = FLAC__stream_encoder_set_channels(encoder, 1)
+                    && FLAC__stream_encoder_set_bits_per_sample(encoder, (uint32_t)bitsPerSample)
+                    && FLAC__stream_encoder_set_sample_rate(encoder, sampleRate)
+                    && FLAC__stream_encoder_set_compression_level(encoder, compressionLevel)
+                    && FLAC__stream_encoder_set_blocksize(encoder, 4096)
+                    && FLAC__stream_encoder_set_total_samples_estimate(encoder, numberOfSamples)
+                    && FLAC__STREAM_ENCODER_INIT_STATUS_OK == FLAC__stream_encoder_init_stream(encoder, &onEncoderWrite, &onEncoderSeek, &onEncoderTell, NULL, &context);
+  if (success) {
+    success = FLAC__stream_encoder_process(encoder, (FLAC__int32 const* const*)&samples, (uint32_t)numberOfSamples);
+    // Finishing flushes the last frame and updates the stream information.
+    success = FLAC__stream_encoder_finish(encoder) && success;
+  }
+  FLAC__stream_encoder_delete(encoder);
+  if (!success) {
+    Arcadia_Memory_deallocateUnmanaged(thread, context.bytes);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, context.bytes, context.numberOfBytes);
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Memory_deallocateUnmanaged(thread, context.bytes);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Memory_deallocateUnmanaged(thread, context.bytes);
+    Arcadia_Thread_jump(thread);
+  }
+}
+
+#endif
@@ -0,0 +1,68 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_SAMPLEBUFFERIO_TESTS_WRITEFLACTESTS_REFERENCE_H_INCLUDED)
+#define ARCADIA_SAMPLEBUFFERIO_TESTS_WRITEFLACTESTS_REFERENCE_H_INCLUDED
+
+#include "Arcadia.SampleBufferIO.Tests.WriteFLACTests/Configure.h"
+#include "Arcadia.SampleBufferIO.Tests.WriteFLACTests/Decoder.h"
+
+#if Arcadia_SampleBufferIO_Tests_WriteFLACTests_Configuration_libFLAC_Enabled
+
+// libFLAC is the reference implementation of FLAC.
+// It is used by the tests to verify the encoder against the reference decoder and the decoder of the tests against the reference encoder.
+
+/// @brief Decode a FLAC stream with libFLAC, the reference decoder.
+/// libFLAC verifies the CRC-8 and CRC-16 of each frame and the MD5 signature of the decoded samples.
+/// @param thread A pointer to this thread.
+/// @param bytes A pointer to the Bytes of the stream.
+/// @param numberOfBytes The number of Bytes of the stream.
+/// @param stream A pointer to the FLAC stream. The samples must be released with FLACStream_uninitialize.
+/// @error #Arcadia_Status_EncodingInvalid libFLAC rejected the stream
+/// @error #Arcadia_Status_NotImplemented the stream is not supported
+void
+FLACStream_decodeWithReferenceDecoder
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Natural8Value const* bytes,
+    Arcadia_SizeValue numberOfBytes,
+    FLACStream* stream
+  );
+
+/// @brief Encode samples with libFLAC, the reference encoder.
+/// The stream has one channel and a block size of 4096 samples.
+/// @param thread A pointer to this thread.
+/// @param samples A pointer to the samples.
+/// @param numberOfSamples The number of samples.
+/// @param sampleRate The sample rate, in Hz.
+/// @param bitsPerSample The number of bits per sample.
+/// @param compressionLevel The compression level of libFLAC.
+/// @param target The byte array builder to append the stream to.
+/// @error #Arcadia_Status_EnvironmentFailed libFLAC failed to encode the samples
+void
+FLACStream_encodeWithReferenceEncoder
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Integer32Value const* samples,
+    Arcadia_SizeValue numberOfSamples,
+    Arcadia_Natural32Value sampleRate,
+    Arcadia_SizeValue bitsPerSample,
+    Arcadia_Natural32Value compressionLevel,
+    Arcadia_ByteArrayBuilder* target
+  );
+
+#endif
+
+#endif // ARCADIA_SAMPLEBUFFERIO_TESTS_WRITEFLACTESTS_REFERENCE_H_INCLUDED
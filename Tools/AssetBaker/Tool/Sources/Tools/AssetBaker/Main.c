@@ -0,0 +1,279 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <stdlib.h>
+#include "Arcadia/Ring2/Include.h"
+#include "Arcadia/Logging/Include.h"
+#include "Arcadia/Media/Include.h"
+#include "Arcadia/ADL/Include.h"
+
+Arcadia_NoReturn() static void
+raiseADLPixelBufferOperationNotYetSupported
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* key
+  )
+{
+  Arcadia_ADL_Diagnostics_raisePixelBufferOperationNotYetSupported(thread, key);
+}
+
+static Arcadia_FilePath*
+makePath
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* pathString
+  )
+{
+  Arcadia_FileSystem* fileSystem = Arcadia_FileSystem_getOrCreate(thread);
+  Arcadia_FilePath* path = Arcadia_FileSystem_getWorkingDirectory(thread, fileSystem);
+  Arcadia_FilePath_append(thread, path, Arcadia_FilePath_parseGeneric(thread, pathString));
+  return path;
+}
+
+static void
+loadADL
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Definitions* definitions,
+    Arcadia_String* pathString
+  )
+{
+  Arcadia_FileSystem* fileSystem = Arcadia_FileSystem_getOrCreate(thread);
+  Arcadia_ADL_Context* context = Arcadia_ADL_Context_getOrCreate(thread);
+  Arcadia_ByteArrayBuilder* contents = Arcadia_FileSystem_getFileContents(thread, fileSystem, makePath(thread, pathString));
+  Arcadia_ADL_Context_readFromString(thread, context, definitions, Arcadia_String_create(thread, Arcadia_Value_makeObjectReferenceValue(contents)), Arcadia_BooleanValue_True);
+}
+
+static Arcadia_Media_DSP*
+makeDSP
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_Reference* reference
+  )
+{
+  Arcadia_ADL_Definition* definition = reference->definition;
+  if (Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)definition, _Arcadia_ADL_SineWaveDefinition_getType(thread))) {
+    Arcadia_ADL_SineWaveDefinition* sineWaveDefinition = (Arcadia_ADL_SineWaveDefinition*)definition;
+    return (Arcadia_Media_DSP*)Arcadia_Media_DSP_SineWave_create(thread, sineWaveDefinition->frequency);
+  } else if (Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)definition, _Arcadia_ADL_WhiteNoiseDefinition_getType(thread))) {
+    return (Arcadia_Media_DSP*)Arcadia_Media_DSP_WhiteNoise_create(thread);
+  } else if (Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)definition, _Arcadia_ADL_SawtoothWaveDefinition_getType(thread))) {
+    Arcadia_ADL_SawtoothWaveDefinition* sawtoothWaveDefinition = (Arcadia_ADL_SawtoothWaveDefinition*)definition;
+    return (Arcadia_Media_DSP*)Arcadia_Media_DSP_SawtoothWave_create(thread, sawtoothWaveDefinition->frequency);
+  } else {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+}
+
+// Evaluate the operations of a pixel buffer definition and add the pixels as an Arcadia_ADL_PackFormat_Kind_PixelBuffer entry.
+static void
+bakePixelBuffer
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackWriter* writer,
+    Arcadia_ADL_PixelBufferDefinition* definition
+  )
+{
+  Arcadia_Media_PixelBuffer* pixelBuffer = Arcadia_Media_PixelBuffer_create(thread, 0, definition->width, definition->height, (Arcadia_Media_PixelFormat)definition->pixelFormat);
+  for (Arcadia_SizeValue i = 0, n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)definition->operations); i < n; ++i) {
+    Arcadia_ADL_Reference* e = (Arcadia_ADL_Reference*)Arcadia_List_getObjectReferenceValueAt(thread, definition->operations, i);
+    Arcadia_Media_PixelBufferOperation* operation;
+    if (!e->definition) {
+      raiseADLPixelBufferOperationNotYetSupported(thread, e->definitionName);
+    }
+    if (Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)e->definition, _Arcadia_ADL_PixelBufferOperations_CheckerboardFillOperationDefinition_getType(thread))) {
+      operation = (Arcadia_Media_PixelBufferOperation*)Arcadia_Media_PixelBufferOperations_CheckerboardFill_create(thread, (Arcadia_ADL_PixelBufferOperations_CheckerboardFillOperationDefinition*)e->definition);
+    } else if (Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)e->definition, _Arcadia_ADL_PixelBufferOperations_FillOperationDefinition_getType(thread))) {
+      operation = (Arcadia_Media_PixelBufferOperation*)Arcadia_Media_PixelBufferOperations_Fill_create(thread, (Arcadia_ADL_PixelBufferOperations_FillOperationDefinition*)e->definition);
+    } else {
+      raiseADLPixelBufferOperationNotYetSupported(thread, e->definitionName);
+    }
+    Arcadia_Media_PixelBufferOperation_apply(thread, operation, pixelBuffer);
+  }
+  // Store the rows without line padding.
+  Arcadia_SizeValue width = Arcadia_Media_PixelBuffer_getWidth(thread, pixelBuffer),
+                    height = Arcadia_Media_PixelBuffer_getHeight(thread, pixelBuffer),
+                    lineStride = Arcadia_Media_PixelBuffer_getLineStride(thread, pixelBuffer),
+                    bytesPerPixel = Arcadia_Media_PixelBuffer_getBytesPerPixel(thread, pixelBuffer);
+  Arcadia_ByteArrayBuilder* pixels = Arcadia_ByteArrayBuilder_create(thread);
+  for (Arcadia_SizeValue y = 0; y < height; ++y) {
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, pixels, pixelBuffer->bytes + y * lineStride, width * bytesPerPixel);
+  }
+  Arcadia_Natural32Value const parameters[4] = {
+    (Arcadia_Natural32Value)width,
+    (Arcadia_Natural32Value)height,
+    (Arcadia_Natural32Value)Arcadia_Media_PixelBuffer_getPixelFormat(thread, pixelBuffer),
+    0,
+  };
+  Arcadia_ADL_PackWriter_addEntry(thread, writer, ((Arcadia_ADL_Definition*)definition)->name, Arcadia_ADL_PackFormat_Kind_PixelBuffer, parameters,
+                                  Arcadia_ByteArrayBuilder_getBytes(thread, pixels), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, pixels));
+}
+
+// Render the digital signal processor of a sample buffer definition and add the samples as an Arcadia_ADL_PackFormat_Kind_SampleBuffer entry.
+static void
+bakeSampleBuffer
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackWriter* writer,
+    Arcadia_ADL_SampleBufferDefinition* definition
+  )
+{
+  if (definition->duration > Arcadia_Integer32Value_Maximum || definition->sampleRate > Arcadia_Integer32Value_Maximum) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Media_SampleBuffer* sampleBuffer = Arcadia_Media_SampleBuffer_create(thread, (Arcadia_Integer32Value)definition->duration, (Arcadia_Integer32Value)definition->sampleRate,
+                                                                               (Arcadia_Media_SampleFormat)definition->sampleFormat);
+  Arcadia_Media_SampleBuffer_fill(thread, sampleBuffer, makeDSP(thread, definition->dsp));
+  Arcadia_SizeValue numberOfBytes = Arcadia_Media_SampleFormat_getNumberOfBytes(thread, Arcadia_Media_SampleBuffer_getSampleFormat(thread, sampleBuffer))
+                                  * (Arcadia_SizeValue)Arcadia_Media_SampleBuffer_getLength(thread, sampleBuffer)
+                                  * (Arcadia_SizeValue)Arcadia_Media_SampleBuffer_getSampleRate(thread, sampleBuffer);
+  Arcadia_Natural32Value const parameters[4] = {
+    (Arcadia_Natural32Value)Arcadia_Media_SampleBuffer_getLength(thread, sampleBuffer),
+    (Arcadia_Natural32Value)Arcadia_Media_SampleBuffer_getSampleRate(thread, sampleBuffer),
+    (Arcadia_Natural32Value)Arcadia_Media_SampleBuffer_getSampleFormat(thread, sampleBuffer),
+    1,
+  };
+  Arcadia_ADL_PackWriter_addEntry(thread, writer, ((Arcadia_ADL_Definition*)definition)->name, Arcadia_ADL_PackFormat_Kind_SampleBuffer, parameters,
+                                  sampleBuffer->bytes, numberOfBytes);
+}
+
+// Interleave the vertex data of a mesh definition and add the vertices followed by the name of the ambient color as an Arcadia_ADL_PackFormat_Kind_Mesh entry.
+// The layout of the vertices is the layout of the vertex buffer of Arcadia.Engine.Visuals.MeshNode.
+static void
+bakeMesh
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ADL_PackWriter* writer,
+    Arcadia_ADL_MeshDefinition* definition
+  )
+{
+  Arcadia_Real32Value const* positions = (Arcadia_Real32Value const*)Arcadia_RuntimeByteArray_getBytes(thread, Arcadia_ADL_MeshDefinition_getVertexPositions(thread, definition));
+  Arcadia_Real32Value const* ambientColors = (Arcadia_Real32Value const*)Arcadia_RuntimeByteArray_getBytes(thread, Arcadia_ADL_MeshDefinition_getVertexAmbientColors(thread, definition));
+  Arcadia_Real32Value const* ambientTextureCoordinates = (Arcadia_Real32Value const*)Arcadia_RuntimeByteArray_getBytes(thread, Arcadia_ADL_MeshDefinition_getVertexAmbientTextureCoordinates(thread, definition));
+  Arcadia_SizeValue numberOfVertices = Arcadia_ADL_MeshDefinition_getNumberOfVertices(thread, definition);
+  Arcadia_ByteArrayBuilder* vertices = Arcadia_ByteArrayBuilder_create(thread);
+  for (Arcadia_SizeValue i = 0; i < numberOfVertices; ++i) {
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, vertices, &positions[i * 3], sizeof(Arcadia_Real32Value) * 3);
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, vertices, &ambientColors[i * 4], sizeof(Arcadia_Real32Value) * 4);
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, vertices, &ambientTextureCoordinates[i * 2], sizeof(Arcadia_Real32Value) * 2);
+  }
+  Arcadia_String* ambientColorName = definition->ambientColor->definitionName;
+  if (Arcadia_String_getNumberOfBytes(thread, ambientColorName) > Arcadia_Natural32Value_Maximum) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, vertices, Arcadia_String_getBytes(thread, ambientColorName), Arcadia_String_getNumberOfBytes(thread, ambientColorName));
+  Arcadia_Natural32Value const parameters[4] = {
+    (Arcadia_Natural32Value)numberOfVertices,
+    Arcadia_ADL_PackFormat_MeshVertexStride,
+    (Arcadia_Natural32Value)Arcadia_String_getNumberOfBytes(thread, ambientColorName),
+    0,
+  };
+  Arcadia_ADL_PackWriter_addEntry(thread, writer, ((Arcadia_ADL_Definition*)definition)->name, Arcadia_ADL_PackFormat_Kind_Mesh, parameters,
+                                  Arcadia_ByteArrayBuilder_getBytes(thread, vertices), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, vertices));
+}
+
+// Expects
+// `--definition=<path>` (one or more times)
+// `--target=<path>`
+// Bakes all pixel buffer, sample buffer, and mesh definitions into the asset pack `<target>`.
+// Other definitions are not baked, they are only used to evaluate the baked definitions.
+static void
+main1
+  (
+    Arcadia_Thread* thread,
+    int argc,
+    char** argv
+  )
+{
+  Arcadia_Log* log = (Arcadia_Log*)Arcadia_ConsoleLog_create(thread);
+  Arcadia_ADL_Definitions* definitions = Arcadia_ADL_Definitions_create(thread);
+
+  Arcadia_Value target;
+  Arcadia_Value_setVoidValue(&target, Arcadia_VoidValue_Void);
+
+  for (int argi = 1; argi < argc; ++argi) {
+    Arcadia_String* argumentString = Arcadia_String_createFromCxxString(thread, argv[argi]);
+    Arcadia_UnicodeCodePointReader* r = (Arcadia_UnicodeCodePointReader*)Arcadia_ByteReader_UnicodeCodePointReader_create(thread, (Arcadia_ByteReader*)Arcadia_String_ByteReader_create(thread, argumentString));
+    Arcadia_CommandLineArgument* argument = Arcadia_CommandLine_parseArgument(thread, (Arcadia_UnicodeCodePointReader*)r);
+    if (argument->syntacticalError) {
+      Arcadia_CommandLine_invalidCommandLineArgumentError(thread, argumentString, log);
+    }
+    if (Arcadia_String_isEqualTo_pn(thread, argument->name, u8"definition", sizeof(u8"definition") - 1)) {
+      if (!argument->value) {
+        Arcadia_CommandLine_raiseNoValueError(thread, argument->name, log);
+      }
+      loadADL(thread, definitions, argument->value);
+    } else if (Arcadia_String_isEqualTo_pn(thread, argument->name, u8"target", sizeof(u8"target") - 1)) {
+      if (!argument->value) {
+        Arcadia_CommandLine_raiseNoValueError(thread, argument->name, log);
+      }
+      Arcadia_Value_setObjectReferenceValue(&target, argument->value);
+    } else {
+      Arcadia_CommandLine_raiseUnknownArgumentError(thread, argument->name, argument->value, log);
+    }
+  }
+  if (!Arcadia_Value_isInstanceOf(thread, &target, _Arcadia_String_getType(thread))) {
+    Arcadia_CommandLine_raiseRequiredArgumentMissingError(thread, Arcadia_String_createFromCxxString(thread, u8"target"), log);
+  }
+  Arcadia_ADL_Definitions_link(thread, definitions);
+
+  Arcadia_ADL_PackWriter* writer = Arcadia_ADL_PackWriter_create(thread);
+  Arcadia_List* values = Arcadia_Map_getValues(thread, definitions->definitions);
+  for (Arcadia_SizeValue i = 0, n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)values); i < n; ++i) {
+    Arcadia_ADL_Definition* definition = (Arcadia_ADL_Definition*)Arcadia_List_getObjectReferenceValueAt(thread, values, i);
+    if (Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)definition, _Arcadia_ADL_PixelBufferDefinition_getType(thread))) {
+      bakePixelBuffer(thread, writer, (Arcadia_ADL_PixelBufferDefinition*)definition);
+    } else if (Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)definition, _Arcadia_ADL_SampleBufferDefinition_getType(thread))) {
+      bakeSampleBuffer(thread, writer, (Arcadia_ADL_SampleBufferDefinition*)definition);
+    } else if (Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)definition, _Arcadia_ADL_MeshDefinition_getType(thread))) {
+      bakeMesh(thread, writer, (Arcadia_ADL_MeshDefinition*)definition);
+    }
+  }
+  Arcadia_ByteArrayBuilder* contents = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ADL_PackWriter_write(thread, writer, contents);
+  Arcadia_FileSystem* fileSystem = Arcadia_FileSystem_getOrCreate(thread);
+  Arcadia_FileSystem_setFileContents(thread, fileSystem, makePath(thread, (Arcadia_String*)Arcadia_Value_getObjectReferenceValue(&target)), contents);
+}
+
+int
+main
+  (
+    int argc,
+    char** argv
+  )
+{
+  Arcadia_Process* process = NULL;
+  if (Arcadia_Process_get(&process)) {
+    return EXIT_FAILURE;
+  }
+  Arcadia_Thread* thread = Arcadia_Process_getThread(process);
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    main1(thread, argc, argv);
+  }
+  Arcadia_Thread_popJumpTarget(thread);
+  Arcadia_Status status = Arcadia_Thread_getStatus(thread);
+  thread = NULL;
+  Arcadia_Process_relinquish(process);
+  process = NULL;
+  if (status) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -147,7 +147,7 @@ main1
   }
   if (Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)definition, _Arcadia_ADL_PixelBufferDefinition_getType(thread))) {
     Arcadia_ADL_PixelBufferDefinition* p = (Arcadia_ADL_PixelBufferDefinition*)definition;
-    pixelBuffer = Arcadia_Media_PixelBuffer_create(thread, 0, p->width, p->height, Arcadia_Media_PixelFormat_AlphaRedGreenBlueNatural8);
+    pixelBuffer = Arcadia_Media_PixelBuffer_create(thread, 0, p->width, p->height, (Arcadia_Media_PixelFormat)p->pixelFormat);
     for (Arcadia_SizeValue i = 0, n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)p->operations); i < n; ++i) {
       Arcadia_ADL_Reference* e = (Arcadia_ADL_Reference*)Arcadia_List_getObjectReferenceValueAt(thread, p->operations, i);
       Arcadia_Media_PixelBufferOperation* operation;
@@ -105,6 +105,9 @@ Context_constructImpl
 
   self->files = (Arcadia_List*)Arcadia_ArrayList_create(thread);
   self->dependenciesContext = DependenciesContext_create(thread);
+  self->templates = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
+  self->incremental = Arcadia_BooleanValue_False;
+  self->upToDate = Arcadia_BooleanValue_False;
   self->consoleLog = (Arcadia_Log*)Arcadia_ConsoleLog_create(thread);
 
   self->stack = (Arcadia_Stack*)Arcadia_ArrayStack_create(thread);
@@ -189,6 +192,9 @@ Context_visit
   if (self->dependenciesContext) {
     Arcadia_Object_visit(thread, (Arcadia_Object*)self->dependenciesContext);
   }
+  if (self->templates) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->templates);
+  }
 }
 
 Context*
@@ -262,6 +268,17 @@ Context_onRun
 {
   self->dependenciesContext->dependenciesFilePath = self->dependenciesFilePath;
 
+  self->upToDate = Arcadia_BooleanValue_False;
+  if (self->incremental && DependenciesContext_isUpToDate(thread, self->dependenciesContext, self->targetFilePath)) {
+    self->upToDate = Arcadia_BooleanValue_True;
+    return;
+  }
+  if (self->environmentFilePath) {
+    Arcadia_ByteArrayBuilder* environmentBytes = Arcadia_FileSystem_getFileContents(thread, Arcadia_FileSystem_getOrCreate(thread), self->environmentFilePath);
+    DependenciesContext_onInput(thread, self->dependenciesContext, self->environmentFilePath,
+                                Arcadia_ByteArrayBuilder_getBytes(thread, environmentBytes), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, environmentBytes));
+  }
+
 #if 0
   Arcadia_StringBuilder* message = Arcadia_StringBuilder_create(thread);
   Arcadia_FilePath* workingDirectory = Arcadia_FileSystem_getWorkingDirectory(thread, Arcadia_FileSystem_getOrCreate(thread));
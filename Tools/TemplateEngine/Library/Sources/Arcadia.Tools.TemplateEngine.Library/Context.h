@@ -59,6 +59,15 @@ struct Context {
 
   DependenciesContext* dependenciesContext;
 
+  /// Map from the full paths of files (as native path strings) to their parsed trees.
+  Arcadia_Map* templates;
+
+  /// If this is true, then Context_onRun does not render the target file
+  /// if neither the target file nor any of its inputs changed since the last run.
+  Arcadia_BooleanValue incremental;
+  /// Set by Context_onRun to true if the target file was not rendered because it is up to date.
+  Arcadia_BooleanValue upToDate;
+
   /// The console log.
   Arcadia_Log* consoleLog;
 };
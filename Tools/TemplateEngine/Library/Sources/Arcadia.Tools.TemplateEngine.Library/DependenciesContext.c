@@ -15,7 +15,10 @@
 
 #include "Arcadia.Tools.TemplateEngine.Library/DependenciesContext.h"
 
+#include <string.h>
+
 #include "Arcadia/DDL/Include.h"
+#include "Arcadia/Logging/Include.h"
 
 static void
 DependenciesContext_constructImpl
@@ -81,6 +84,7 @@ DependenciesContext_constructImpl
 
   self->dependenciesFilePath = NULL;
   self->dependencies = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
+  self->inputs = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
 
   Arcadia_LeaveConstructor(DependenciesContext);
 }
@@ -117,6 +121,9 @@ DependenciesContext_visit
   if (self->dependencies) {
     Arcadia_Object_visit(thread, (Arcadia_Object*)self->dependencies);
   }
+  if (self->inputs) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->inputs);
+  }
 }
 
 DependenciesContext*
@@ -206,6 +213,256 @@ DependenciesContext_write
   Arcadia_FileSystem_setFileContents(thread, Arcadia_FileSystem_getOrCreate(thread), self->dependenciesFilePath, byteBuffer);
 }
 
+// Get if two strings are equal.
+static Arcadia_BooleanValue
+isEqualTo
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* x,
+    Arcadia_String* y
+  )
+{ return Arcadia_String_isEqualTo_pn(thread, x, Arcadia_String_getBytes(thread, y), Arcadia_String_getNumberOfBytes(thread, y)); }
+
+// Get the hash string of the contents of a file.
+// The hash string is the number of Bytes followed by a colon followed by the hash value of the Bytes.
+static Arcadia_String*
+getHashString
+  (
+    Arcadia_Thread* thread,
+    void const* bytes,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  Arcadia_StringBuilder* sb = Arcadia_StringBuilder_create(thread);
+  Arcadia_StringBuilder_insertBackString(thread, sb, Arcadia_String_createFromSize(thread, numberOfBytes));
+  Arcadia_StringBuilder_insertBackCxxString(thread, sb, u8":");
+  Arcadia_StringBuilder_insertBackString(thread, sb, Arcadia_String_createFromSize(thread, Arcadia_hashBytes(thread, bytes, numberOfBytes)));
+  return Arcadia_String_create(thread, Arcadia_Value_makeObjectReferenceValue(sb));
+}
+
+// Get the hash string of the contents of a file.
+// Returns null if the file does not exist or can not be read.
+static Arcadia_String*
+getFileHashString
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FilePath* path
+  )
+{
+  Arcadia_FileSystem* fileSystem = Arcadia_FileSystem_getOrCreate(thread);
+  if (!Arcadia_FileSystem_regularFileExists(thread, fileSystem, path)) {
+    return NULL;
+  }
+  Arcadia_String* hashString = NULL;
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_ByteArrayBuilder* contents = Arcadia_FileSystem_getFileContents(thread, fileSystem, path);
+    hashString = getHashString(thread, Arcadia_ByteArrayBuilder_getBytes(thread, contents), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, contents));
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+  return hashString;
+}
+
+// Get the path of the dependency manifest.
+static Arcadia_FilePath*
+getManifestFilePath
+  (
+    Arcadia_Thread* thread,
+    DependenciesContext* self
+  )
+{
+  if (!self->dependenciesFilePath) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_StringBuilder* sb = Arcadia_StringBuilder_create(thread);
+  Arcadia_StringBuilder_insertBackString(thread, sb, Arcadia_FilePath_toNative(thread, Arcadia_FilePath_getFullPath(thread, self->dependenciesFilePath), Arcadia_BooleanValue_False));
+  Arcadia_StringBuilder_insertBackCxxString(thread, sb, u8".manifest");
+  return Arcadia_FilePath_parseNative(thread, Arcadia_String_create(thread, Arcadia_Value_makeObjectReferenceValue(sb)));
+}
+
+// Create a map node `{ path : <path>, hash : <hash> }`.
+static Arcadia_DDL_MapNode*
+createFileNode
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* path,
+    Arcadia_String* hash
+  )
+{
+  Arcadia_DDL_MapNode* node = Arcadia_DDL_MapNode_create(thread);
+  Arcadia_DDL_MapNode_insertBack(thread, node, Arcadia_DDL_MapEntryNode_create(thread, Arcadia_DDL_NameNode_create(thread, Arcadia_String_createFromCxxString(thread, u8"path")),
+                                                                                       (Arcadia_DDL_Node*)Arcadia_DDL_StringNode_createString(thread, path)));
+  Arcadia_DDL_MapNode_insertBack(thread, node, Arcadia_DDL_MapEntryNode_create(thread, Arcadia_DDL_NameNode_create(thread, Arcadia_String_createFromCxxString(thread, u8"hash")),
+                                                                                       (Arcadia_DDL_Node*)Arcadia_DDL_StringNode_createString(thread, hash)));
+  return node;
+}
+
+// Get the value of the entry of the specified name in a map node.
+// Raises Arcadia_Status_SemanticalError if the node is not a map node or there is no such entry.
+static Arcadia_DDL_Node*
+getEntryValue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_Node* node,
+    const char* name
+  )
+{
+  if (!Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)node, _Arcadia_DDL_MapNode_getType(thread))) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_SemanticalError);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_DDL_MapNode* mapNode = (Arcadia_DDL_MapNode*)node;
+  for (Arcadia_SizeValue i = 0, n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)mapNode->entries); i < n; ++i) {
+    Arcadia_DDL_MapEntryNode* entryNode = (Arcadia_DDL_MapEntryNode*)Arcadia_List_getObjectReferenceValueCheckedAt(thread, mapNode->entries, i, _Arcadia_DDL_MapEntryNode_getType(thread));
+    if (Arcadia_String_isEqualTo_pn(thread, entryNode->key->value, name, strlen(name))) {
+      return entryNode->value;
+    }
+  }
+  Arcadia_Thread_setStatus(thread, Arcadia_Status_SemanticalError);
+  Arcadia_Thread_jump(thread);
+}
+
+// Get the string value of the entry of the specified name in a map node.
+// Raises Arcadia_Status_SemanticalError if the node is not a map node, there is no such entry, or the value is not a string.
+static Arcadia_String*
+getEntryString
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_Node* node,
+    const char* name
+  )
+{
+  Arcadia_DDL_Node* value = getEntryValue(thread, node, name);
+  if (!Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)value, _Arcadia_DDL_StringNode_getType(thread))) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_SemanticalError);
+    Arcadia_Thread_jump(thread);
+  }
+  return ((Arcadia_DDL_StringNode*)value)->value;
+}
+
+// Get if the file of the path stored in a file node `{ path : <path>, hash : <hash> }` exists and the hash of its contents is the hash stored in the file node.
+static Arcadia_BooleanValue
+isFileUpToDate
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_Node* fileNode
+  )
+{
+  Arcadia_String* pathString = getEntryString(thread, fileNode, u8"path");
+  Arcadia_String* hashString = getEntryString(thread, fileNode, u8"hash");
+  Arcadia_String* currentHashString = getFileHashString(thread, Arcadia_FilePath_parseNative(thread, pathString));
+  return NULL != currentHashString
+      && isEqualTo(thread, hashString, currentHashString);
+}
+
+void
+DependenciesContext_writeManifest
+  (
+    Arcadia_Thread* thread,
+    DependenciesContext* self,
+    Arcadia_FilePath* targetFilePath,
+    Arcadia_ByteArrayBuilder* targetContents
+  )
+{
+  Arcadia_FilePath* manifestFilePath = getManifestFilePath(thread, self);
+  // (1) Create the manifest.
+  // @code
+  // {
+  //   target : { path : <path>, hash : <hash> },
+  //   inputs : [ { path : <path>, hash : <hash> }, ... ],
+  // }
+  // @endcode
+  Arcadia_DDL_MapNode* manifestNode = Arcadia_DDL_MapNode_create(thread);
+  Arcadia_String* targetPathString = Arcadia_FilePath_toNative(thread, Arcadia_FilePath_getFullPath(thread, targetFilePath), Arcadia_BooleanValue_False);
+  Arcadia_String* targetHashString = getHashString(thread, Arcadia_ByteArrayBuilder_getBytes(thread, targetContents), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, targetContents));
+  Arcadia_DDL_MapNode_insertBack(thread, manifestNode, Arcadia_DDL_MapEntryNode_create(thread, Arcadia_DDL_NameNode_create(thread, Arcadia_String_createFromCxxString(thread, u8"target")),
+                                                                                               (Arcadia_DDL_Node*)createFileNode(thread, targetPathString, targetHashString)));
+  Arcadia_DDL_ListNode* inputsNode = Arcadia_DDL_ListNode_create(thread);
+  Arcadia_List* inputs = Arcadia_Map_getKeys(thread, self->inputs);
+  for (Arcadia_SizeValue i = 0, n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)inputs); i < n; ++i) {
+    Arcadia_String* pathString = (Arcadia_String*)Arcadia_List_getObjectReferenceValueCheckedAt(thread, inputs, i, _Arcadia_String_getType(thread));
+    Arcadia_String* hashString = (Arcadia_String*)Arcadia_Map_getObjectReferenceValueChecked(thread, self->inputs, Arcadia_Value_makeObjectReferenceValue(pathString), _Arcadia_String_getType(thread));
+    Arcadia_List_insertBackObjectReferenceValue(thread, inputsNode->elements, (Arcadia_Object*)createFileNode(thread, pathString, hashString));
+  }
+  Arcadia_DDL_MapNode_insertBack(thread, manifestNode, Arcadia_DDL_MapEntryNode_create(thread, Arcadia_DDL_NameNode_create(thread, Arcadia_String_createFromCxxString(thread, u8"inputs")),
+                                                                                               (Arcadia_DDL_Node*)inputsNode));
+  // (2) Write the manifest.
+  Arcadia_ByteArrayBuilder* byteBuffer = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_DataDefinitionLanguage_Unparser* unparser = Arcadia_DataDefinitionLanguage_Unparser_create(thread, (Arcadia_Unicode_Encoder*)Arcadia_Unicode_UTF8Encoder_create(thread));
+  Arcadia_DataDefinitionLanguage_Unparser_run(thread, unparser, (Arcadia_DDL_Node*)manifestNode, byteBuffer);
+  Arcadia_FileSystem_setFileContents(thread, Arcadia_FileSystem_getOrCreate(thread), manifestFilePath, byteBuffer);
+}
+
+Arcadia_BooleanValue
+DependenciesContext_isUpToDate
+  (
+    Arcadia_Thread* thread,
+    DependenciesContext* self,
+    Arcadia_FilePath* targetFilePath
+  )
+{
+  Arcadia_FileSystem* fileSystem = Arcadia_FileSystem_getOrCreate(thread);
+  Arcadia_FilePath* manifestFilePath = getManifestFilePath(thread, self);
+  if (!Arcadia_FileSystem_regularFileExists(thread, fileSystem, self->dependenciesFilePath) ||
+      !Arcadia_FileSystem_regularFileExists(thread, fileSystem, manifestFilePath)) {
+    return Arcadia_BooleanValue_False;
+  }
+  Arcadia_BooleanValue upToDate = Arcadia_BooleanValue_False;
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    // (1) Read the manifest.
+    Arcadia_ByteArrayBuilder* manifestBytes = Arcadia_FileSystem_getFileContents(thread, fileSystem, manifestFilePath);
+    Arcadia_DDL_Parser* parser = Arcadia_DDL_Parser_create(thread, Arcadia_DDL_Scanner_create(thread, Arcadia_Languages_StringTable_getOrCreate(thread),
+                                                                                                     Arcadia_Languages_Diagnostics_create(thread, (Arcadia_Log*)Arcadia_ConsoleLog_create(thread))));
+    Arcadia_ByteArray* byteArray = Arcadia_ByteArray_createByteArray(thread, Arcadia_RuntimeByteArray_create(thread, Arcadia_ByteArrayBuilder_getBytes(thread, manifestBytes), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, manifestBytes)));
+    Arcadia_UnicodeCodePointReader* reader = (Arcadia_UnicodeCodePointReader*)Arcadia_ByteReader_UnicodeCodePointReader_create(thread, (Arcadia_ByteReader*)Arcadia_ByteArray_ByteReader_create(thread, byteArray));
+    Arcadia_Languages_Parser_setInput(thread, (Arcadia_Languages_Parser*)parser, reader);
+    Arcadia_DDL_Node* manifestNode = (Arcadia_DDL_Node*)Arcadia_Value_getObjectReferenceValueChecked(thread, Arcadia_Languages_Parser_run(thread, (Arcadia_Languages_Parser*)parser), _Arcadia_DDL_Node_getType(thread));
+    // (2) The manifest must have been written for the target file and the target file must not have changed.
+    Arcadia_DDL_Node* targetNode = getEntryValue(thread, manifestNode, u8"target");
+    Arcadia_String* targetPathString = Arcadia_FilePath_toNative(thread, Arcadia_FilePath_getFullPath(thread, targetFilePath), Arcadia_BooleanValue_False);
+    upToDate = isEqualTo(thread, getEntryString(thread, targetNode, u8"path"), targetPathString)
+            && isFileUpToDate(thread, targetNode);
+    // (3) The input files must not have changed.
+    Arcadia_DDL_Node* inputsNode = getEntryValue(thread, manifestNode, u8"inputs");
+    if (!Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)inputsNode, _Arcadia_DDL_ListNode_getType(thread))) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_SemanticalError);
+      Arcadia_Thread_jump(thread);
+    }
+    for (Arcadia_SizeValue i = 0, n = Arcadia_DDL_ListNode_getNumberOfElements(thread, (Arcadia_DDL_ListNode*)inputsNode); upToDate && i < n; ++i) {
+      upToDate = isFileUpToDate(thread, Arcadia_DDL_ListNode_getElementAt(thread, (Arcadia_DDL_ListNode*)inputsNode, i));
+    }
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    // The manifest is invalid. Treat the target file as out of date.
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+    upToDate = Arcadia_BooleanValue_False;
+  }
+  return upToDate;
+}
+
+void
+DependenciesContext_onInput
+  (
+    Arcadia_Thread* thread,
+    DependenciesContext* self,
+    Arcadia_FilePath* path,
+    void const* bytes,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  Arcadia_String* pathString = Arcadia_FilePath_toNative(thread, Arcadia_FilePath_getFullPath(thread, path), Arcadia_BooleanValue_False);
+  Arcadia_Map_set(thread, self->inputs, Arcadia_Value_makeObjectReferenceValue(pathString),
+                                        Arcadia_Value_makeObjectReferenceValue(getHashString(thread, bytes, numberOfBytes)), NULL, NULL);
+}
+
 void
 DependencyContext_onFile
   (
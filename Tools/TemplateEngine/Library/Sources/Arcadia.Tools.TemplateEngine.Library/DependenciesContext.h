@@ -32,6 +32,8 @@ struct DependenciesContext {
   Arcadia_FilePath* dependenciesFilePath;
   // Map from absolute file name strings to a set list of absolute file name strings
   Arcadia_Map* dependencies;
+  // Map from absolute file name strings of input files to the hash strings of their contents.
+  Arcadia_Map* inputs;
 };
 
 DependenciesContext*
@@ -47,6 +49,45 @@ DependenciesContext_write
     DependenciesContext* self
   );
 
+/*
+ * Write the dependency manifest.
+ * The dependency manifest is written to the path of the dependencies file with the suffix ".manifest".
+ * It stores the hashes of the contents of the target file and the input files.
+ * Invoke this after the target file was written.
+ */
+void
+DependenciesContext_writeManifest
+  (
+    Arcadia_Thread* thread,
+    DependenciesContext* self,
+    Arcadia_FilePath* targetFilePath,
+    Arcadia_ByteArrayBuilder* targetContents
+  );
+
+/*
+ * Get if the target file is up to date.
+ * This is the case if the dependencies file and the dependency manifest exist
+ * and the contents of the target file and the input files recorded in the dependency manifest did not change.
+ */
+Arcadia_BooleanValue
+DependenciesContext_isUpToDate
+  (
+    Arcadia_Thread* thread,
+    DependenciesContext* self,
+    Arcadia_FilePath* targetFilePath
+  );
+
+/* Invoke this if the contents of an input file were read. This may be invoked multiple times for the same file. */
+void
+DependenciesContext_onInput
+  (
+    Arcadia_Thread* thread,
+    DependenciesContext* self,
+    Arcadia_FilePath* path,
+    void const* bytes,
+    Arcadia_SizeValue numberOfBytes
+  );
+
 /* Invoke this if a source file was discovered. This may be invoked multiple times for the same file. */
 void
 DependencyContext_onFile
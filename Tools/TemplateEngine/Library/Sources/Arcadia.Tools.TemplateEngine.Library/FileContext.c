@@ -20,6 +20,7 @@
 #include "Arcadia.Tools.TemplateEngine.Library/Parser/Parser.h"
 #include "Arcadia.Tools.TemplateEngine.Library/Parser/Tree.h"
 #include "Arcadia.Tools.TemplateEngine.Library/Context.h"
+#include "Arcadia.Tools.TemplateEngine.Library/DependenciesContext.h"
 #include "Arcadia.Tools.TemplateEngine.Library/Environment.h"
 
 static void
@@ -358,8 +359,9 @@ FileContext_create
   ARCADIA_CREATEOBJECT(FileContext);
 }
 
-void
-FileContext_execute
+// Read and parse the included file.
+static Directives_Tree*
+parseFile
   (
     Arcadia_Thread* thread,
     FileContext* context
@@ -387,6 +389,8 @@ FileContext_execute
 
     Arcadia_Thread_jump(thread);
   }
+  DependenciesContext_onInput(thread, context->context->dependenciesContext, context->includedFilePath,
+                              Arcadia_ByteArrayBuilder_getBytes(thread, sourceByteBuffer), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, sourceByteBuffer));
   context->fileBytes = Arcadia_ByteArray_createByteArray(thread, Arcadia_RuntimeByteArray_create(thread, Arcadia_ByteArrayBuilder_getBytes(thread, sourceByteBuffer), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, sourceByteBuffer)));
   context->reader = (Arcadia_UnicodeCodePointReader*)Arcadia_ByteReader_UnicodeCodePointReader_create(thread, (Arcadia_ByteReader*)Arcadia_ByteArray_ByteReader_create(thread, context->fileBytes));
   if (!context->parser) {
@@ -397,7 +401,27 @@ FileContext_execute
   }
   Arcadia_TemplateEngine_Parser_setPosition(thread, context->parser, Arcadia_FilePath_toGeneric(thread, context->includedFilePath), 1);
   Arcadia_Languages_Parser_setInput(thread, (Arcadia_Languages_Parser*)context->parser, context->reader);
-  Directives_Tree* fileAST = (Directives_Tree*)Arcadia_Value_getObjectReferenceValueChecked(thread, Arcadia_Languages_Parser_run(thread, (Arcadia_Languages_Parser*)context->parser), _Directives_Tree_getType(thread));
+  return (Directives_Tree*)Arcadia_Value_getObjectReferenceValueChecked(thread, Arcadia_Languages_Parser_run(thread, (Arcadia_Languages_Parser*)context->parser), _Directives_Tree_getType(thread));
+}
+
+void
+FileContext_execute
+  (
+    Arcadia_Thread* thread,
+    FileContext* context
+  )
+{
+  // The tree of a file is cached under the file's full path.
+  // The tree is not modified by the evaluation, hence it can be evaluated any number of times.
+  Arcadia_String* key = Arcadia_FilePath_toNative(thread, Arcadia_FilePath_getFullPath(thread, context->includedFilePath), Arcadia_BooleanValue_False);
+  Arcadia_Value fileASTValue = Arcadia_Map_get(thread, context->context->templates, Arcadia_Value_makeObjectReferenceValue(key));
+  Directives_Tree* fileAST = NULL;
+  if (Arcadia_Value_isVoidValue(&fileASTValue)) {
+    fileAST = parseFile(thread, context);
+    Arcadia_Map_set(thread, context->context->templates, Arcadia_Value_makeObjectReferenceValue(key), Arcadia_Value_makeObjectReferenceValue(fileAST), NULL, NULL);
+  } else {
+    fileAST = (Directives_Tree*)Arcadia_Value_getObjectReferenceValueChecked(thread, fileASTValue, _Directives_Tree_getType(thread));
+  }
   for (Arcadia_SizeValue i = 0, n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)fileAST->file.children); i < n; ++i) {
     Directives_Tree* ast = (Directives_Tree*)Arcadia_List_getObjectReferenceValueCheckedAt(thread, fileAST->file.children, i, _Directives_Tree_getType(thread));
     eval(thread, context, ast);
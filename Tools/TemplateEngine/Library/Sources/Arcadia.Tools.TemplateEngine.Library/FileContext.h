@@ -30,6 +30,7 @@ typedef struct Environment Environment;
 // It then iterates over the file's tree children from left to right
 // text trees is directly written to an output buffer
 // directive trees directives are evaluated.
+// The tree of a file is cached in the context: A file included multiple times is only read and parsed once.
 Arcadia_declareObjectType(u8"Arcadia.TemplateEngine.FileContext", FileContext,
                           u8"Arcadia.Object");
 
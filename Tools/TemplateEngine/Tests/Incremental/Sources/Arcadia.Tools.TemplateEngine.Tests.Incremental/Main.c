@@ -0,0 +1,118 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "Arcadia/Ring2/Include.h"
+#include "Arcadia.Tools.TemplateEngine.Library/Context.h"
+#include "Arcadia.Tools.TemplateEngine.Library/DependenciesContext.h"
+#include "Arcadia.Tools.TemplateEngine.Library/Environment.h"
+#include "Arcadia.Tools.TemplateEngine.Library/FileContext.h"
+
+static void
+setFileContents
+  (
+    Arcadia_Thread* thread,
+    const char* path,
+    const char* contents
+  )
+{
+  Arcadia_ByteArrayBuilder* byteArrayBuilder = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, byteArrayBuilder, contents, strlen(contents));
+  Arcadia_FileSystem_setFileContents(thread, Arcadia_FileSystem_getOrCreate(thread), Arcadia_FilePath_parseGeneric(thread, Arcadia_String_createFromCxxString(thread, path)), byteArrayBuilder);
+}
+
+// Render "main.t" to "main.txt" incrementally.
+// Assert that the target file was rendered (was not rendered) if @a expectRendered is true (false).
+// Assert that the target file has the contents @a expectedContents if it was rendered.
+static void
+render
+  (
+    Arcadia_Thread* thread,
+    Arcadia_BooleanValue expectRendered,
+    const char* expectedContents
+  )
+{
+  Arcadia_FileSystem* fileSystem = Arcadia_FileSystem_getOrCreate(thread);
+  Context* context = Context_create(thread);
+
+  context->sourceFilePath = Arcadia_FilePath_parseGeneric(thread, Arcadia_String_createFromCxxString(thread, u8"main.t"));
+  context->targetFilePath = Arcadia_FilePath_parseGeneric(thread, Arcadia_String_createFromCxxString(thread, u8"main.txt"));
+  context->dependenciesFilePath = Arcadia_FilePath_parseGeneric(thread, Arcadia_String_createFromCxxString(thread, u8"main.txt.dependencies"));
+  context->environmentFilePath = NULL;
+  context->incremental = Arcadia_BooleanValue_True;
+
+  Context_onRun(thread, context);
+  if (expectRendered == context->upToDate) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  if (context->upToDate) {
+    return;
+  }
+  // "main.t" and "part.t" are read and parsed once although "part.t" is included twice.
+  if (2 != Arcadia_Collection_getSize(thread, (Arcadia_Collection*)context->templates)) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  if (Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, context->targetBuffer) != strlen(expectedContents) ||
+      Arcadia_Memory_compare(thread, Arcadia_ByteArrayBuilder_getBytes(thread, context->targetBuffer), expectedContents, strlen(expectedContents))) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_FileSystem_setFileContents(thread, fileSystem, context->targetFilePath, context->targetBuffer);
+  DependenciesContext_writeManifest(thread, context->dependenciesContext, context->targetFilePath, context->targetBuffer);
+}
+
+static void
+incrementalTest
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_FileSystem* fileSystem = Arcadia_FileSystem_getOrCreate(thread);
+  Arcadia_FilePath* manifestFilePath = Arcadia_FilePath_parseGeneric(thread, Arcadia_String_createFromCxxString(thread, u8"main.txt.dependencies.manifest"));
+  if (Arcadia_FileSystem_regularFileExists(thread, fileSystem, manifestFilePath)) {
+    Arcadia_FileSystem_deleteRegularFile(thread, fileSystem, manifestFilePath);
+  }
+  setFileContents(thread, u8"main.t", u8"<@{include(\"part.t\")}|@{include(\"part.t\")}>");
+  setFileContents(thread, u8"part.t", u8"x");
+  // No manifest: Render.
+  render(thread, Arcadia_BooleanValue_True, u8"<x|x>");
+  // Nothing changed: Do not render.
+  render(thread, Arcadia_BooleanValue_False, NULL);
+  // An included file changed: Render.
+  setFileContents(thread, u8"part.t", u8"y");
+  render(thread, Arcadia_BooleanValue_True, u8"<y|y>");
+  render(thread, Arcadia_BooleanValue_False, NULL);
+  // The target file changed: Render.
+  setFileContents(thread, u8"main.txt", u8"");
+  render(thread, Arcadia_BooleanValue_True, u8"<y|y>");
+  render(thread, Arcadia_BooleanValue_False, NULL);
+}
+
+int
+main
+  (
+    int argc,
+    char** argv
+  )
+{
+  if (!Arcadia_Tests_safeExecute(&incrementalTest)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
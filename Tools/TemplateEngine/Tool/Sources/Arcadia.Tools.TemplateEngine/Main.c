@@ -19,6 +19,7 @@
 #include "Arcadia/Ring2/Include.h"
 #include "Arcadia/Logging/Include.h"
 #include "Arcadia.Tools.TemplateEngine.Library/Context.h"
+#include "Arcadia.Tools.TemplateEngine.Library/DependenciesContext.h"
 #include "Arcadia.Tools.TemplateEngine.Library/Environment.h"
 
 static void
@@ -256,9 +257,21 @@ main1
   environment->enclosing = context->environment;
   context->environment = environment;
 
+  // Do not render the target file if neither the target file nor any of its inputs changed since the last run.
+  context->incremental = Arcadia_BooleanValue_True;
   Context_onRun(thread, context);
+  if (context->upToDate) {
+    return;
+  }
 
   Arcadia_FileSystem_setFileContents(thread, fileSystem, context->targetFilePath, context->targetBuffer);
+
+  // The template engine is an input, too.
+  Arcadia_FilePath* executableFilePath = Arcadia_FileSystem_getExecutable(thread, fileSystem);
+  Arcadia_ByteArrayBuilder* executableBytes = Arcadia_FileSystem_getFileContents(thread, fileSystem, executableFilePath);
+  DependenciesContext_onInput(thread, context->dependenciesContext, executableFilePath,
+                              Arcadia_ByteArrayBuilder_getBytes(thread, executableBytes), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, executableBytes));
+  DependenciesContext_writeManifest(thread, context->dependenciesContext, context->targetFilePath, context->targetBuffer);
 }
 
 int
@@ -16,4 +16,9 @@
 #if !defined(ARCADIA_VPL_CONFIGURE_H_INCLUDED)
 #define ARCADIA_VPL_CONFIGURE_H_INCLUDED
 
+// The fingerprint of the GLSL transpiler, a string of 16 hexadecimal digits.
+// The fingerprint changes if the sources of the GLSL transpiler change.
+// Caches of the output of the GLSL transpiler include the fingerprint in their keys.
+#define Arcadia_VPL_Configuration_GLSL_TranspilerFingerprint u8"@Arcadia.VPL.GLSL.TranspilerFingerprint@"
+
 #endif // ARCADIA_VPL_CONFIGURE_H_INCLUDED
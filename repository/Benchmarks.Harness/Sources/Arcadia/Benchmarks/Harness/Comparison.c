@@ -0,0 +1,191 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/Benchmarks/Harness/Comparison.h"
+
+#include "Arcadia/Logging/Include.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// Get the value of the entry of the specified name in a map node.
+// Return a null pointer if the node is not a map node or there is no such entry.
+static Arcadia_DDL_Node*
+getEntryValue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_Node* node,
+    const char* name
+  )
+{
+  if (!Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)node, _Arcadia_DDL_MapNode_getType(thread))) {
+    return NULL;
+  }
+  Arcadia_DDL_MapNode* mapNode = (Arcadia_DDL_MapNode*)node;
+  for (Arcadia_SizeValue i = 0, n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)mapNode->entries); i < n; ++i) {
+    Arcadia_DDL_MapEntryNode* entryNode = (Arcadia_DDL_MapEntryNode*)Arcadia_List_getObjectReferenceValueCheckedAt(thread, mapNode->entries, i, _Arcadia_DDL_MapEntryNode_getType(thread));
+    if (Arcadia_String_isEqualTo_pn(thread, entryNode->key->value, name, strlen(name))) {
+      return entryNode->value;
+    }
+  }
+  return NULL;
+}
+
+// Get the string value of the entry of the specified name in a map node.
+// Raises Arcadia_Status_SemanticalError if the node is not a map node, there is no such entry, or the value is not a string.
+static Arcadia_String*
+getEntryString
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_Node* node,
+    const char* name
+  )
+{
+  Arcadia_DDL_Node* value = getEntryValue(thread, node, name);
+  if (!value || !Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)value, _Arcadia_DDL_StringNode_getType(thread))) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_SemanticalError);
+    Arcadia_Thread_jump(thread);
+  }
+  return ((Arcadia_DDL_StringNode*)value)->value;
+}
+
+// Get the number value of the entry of the specified name in a map node.
+// Raises Arcadia_Status_SemanticalError if the node is not a map node, there is no such entry, or the value is not a number.
+static Arcadia_Real64Value
+getEntryNumber
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_Node* node,
+    const char* name
+  )
+{
+  Arcadia_DDL_Node* value = getEntryValue(thread, node, name);
+  if (!value || !Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)value, _Arcadia_DDL_NumberNode_getType(thread))) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_SemanticalError);
+    Arcadia_Thread_jump(thread);
+  }
+  return Arcadia_String_toReal64(thread, ((Arcadia_DDL_NumberNode*)value)->value);
+}
+
+// Find the result of the benchmark of the specified name.
+// Return a null pointer if there is no such result.
+static Arcadia_DDL_Node*
+findResult
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_ListNode* results,
+    Arcadia_String* name
+  )
+{
+  for (Arcadia_SizeValue i = 0, n = Arcadia_DDL_ListNode_getNumberOfElements(thread, results); i < n; ++i) {
+    Arcadia_DDL_Node* result = Arcadia_DDL_ListNode_getElementAt(thread, results, i);
+    if (Arcadia_String_isEqualTo_pn(thread, getEntryString(thread, result, u8"name"), Arcadia_String_getBytes(thread, name), Arcadia_String_getNumberOfBytes(thread, name))) {
+      return result;
+    }
+  }
+  return NULL;
+}
+
+Arcadia_DDL_ListNode*
+Arcadia_Benchmarks_readResults
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FilePath* path
+  )
+{
+  Arcadia_ByteArrayBuilder* bytes = Arcadia_FileSystem_getFileContents(thread, Arcadia_FileSystem_getOrCreate(thread), path);
+  Arcadia_DDL_Parser* parser = Arcadia_DDL_Parser_create(thread, Arcadia_DDL_Scanner_create(thread, Arcadia_Languages_StringTable_getOrCreate(thread),
+                                                                                                   Arcadia_Languages_Diagnostics_create(thread, (Arcadia_Log*)Arcadia_ConsoleLog_create(thread))));
+  Arcadia_ByteArray* byteArray = Arcadia_ByteArray_createByteArray(thread, Arcadia_RuntimeByteArray_create(thread, Arcadia_ByteArrayBuilder_getBytes(thread, bytes), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, bytes)));
+  Arcadia_UnicodeCodePointReader* reader = (Arcadia_UnicodeCodePointReader*)Arcadia_ByteReader_UnicodeCodePointReader_create(thread, (Arcadia_ByteReader*)Arcadia_ByteArray_ByteReader_create(thread, byteArray));
+  Arcadia_Languages_Parser_setInput(thread, (Arcadia_Languages_Parser*)parser, reader);
+  Arcadia_DDL_Node* node = (Arcadia_DDL_Node*)Arcadia_Value_getObjectReferenceValueChecked(thread, Arcadia_Languages_Parser_run(thread, (Arcadia_Languages_Parser*)parser), _Arcadia_DDL_Node_getType(thread));
+  Arcadia_DDL_Node* results = getEntryValue(thread, node, u8"benchmarks");
+  if (!results || !Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)results, _Arcadia_DDL_ListNode_getType(thread))) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_SemanticalError);
+    Arcadia_Thread_jump(thread);
+  }
+  return (Arcadia_DDL_ListNode*)results;
+}
+
+void
+Arcadia_Benchmarks_writeResults
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FilePath* path,
+    Arcadia_Benchmarks_Result const* results,
+    Arcadia_SizeValue numberOfResults
+  )
+{
+  // @code
+  // {
+  //   benchmarks : [ <result>, ... ],
+  // }
+  // @endcode
+  Arcadia_DDL_ListNode* resultsNode = Arcadia_DDL_ListNode_create(thread);
+  for (Arcadia_SizeValue i = 0; i < numberOfResults; ++i) {
+    Arcadia_List_insertBackObjectReferenceValue(thread, resultsNode->elements, (Arcadia_Object*)Arcadia_Benchmarks_Result_toNode(thread, &results[i]));
+  }
+  Arcadia_DDL_MapNode* node = Arcadia_DDL_MapNode_create(thread);
+  Arcadia_DDL_MapNode_insertBack(thread, node, Arcadia_DDL_MapEntryNode_create(thread, Arcadia_DDL_NameNode_create(thread, Arcadia_String_createFromCxxString(thread, u8"benchmarks")),
+                                                                               (Arcadia_DDL_Node*)resultsNode));
+  Arcadia_ByteArrayBuilder* byteBuffer = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_DataDefinitionLanguage_Unparser* unparser = Arcadia_DataDefinitionLanguage_Unparser_create(thread, (Arcadia_Unicode_Encoder*)Arcadia_Unicode_UTF8Encoder_create(thread));
+  Arcadia_DataDefinitionLanguage_Unparser_run(thread, unparser, (Arcadia_DDL_Node*)node, byteBuffer);
+  Arcadia_FileSystem_setFileContents(thread, Arcadia_FileSystem_getOrCreate(thread), path, byteBuffer);
+}
+
+Arcadia_BooleanValue
+Arcadia_Benchmarks_compareResults
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_ListNode* baseline,
+    Arcadia_DDL_ListNode* current,
+    Arcadia_Real64Value threshold
+  )
+{
+  Arcadia_BooleanValue regressed = Arcadia_BooleanValue_False;
+  fprintf(stdout, "%-28s %16s %16s %10s\n", "benchmark", "baseline [ns/op]", "current [ns/op]", "change");
+  for (Arcadia_SizeValue i = 0, n = Arcadia_DDL_ListNode_getNumberOfElements(thread, current); i < n; ++i) {
+    Arcadia_DDL_Node* currentResult = Arcadia_DDL_ListNode_getElementAt(thread, current, i);
+    Arcadia_String* name = getEntryString(thread, currentResult, u8"name");
+    int nameLength = (int)Arcadia_String_getNumberOfBytes(thread, name);
+    char const* nameBytes = (char const*)Arcadia_String_getBytes(thread, name);
+    Arcadia_Real64Value currentMedian = getEntryNumber(thread, currentResult, u8"median");
+    Arcadia_DDL_Node* baselineResult = findResult(thread, baseline, name);
+    if (!baselineResult) {
+      fprintf(stdout, "%-28.*s %16s %16.2f %10s\n", nameLength, nameBytes, "-", currentMedian, "new");
+      continue;
+    }
+    Arcadia_Real64Value baselineMedian = getEntryNumber(thread, baselineResult, u8"median");
+    Arcadia_Real64Value change = baselineMedian > 0. ? (currentMedian - baselineMedian) / baselineMedian * 100. : 0.;
+    char const* verdict = "";
+    if (change > threshold) {
+      verdict = "regression";
+      regressed = Arcadia_BooleanValue_True;
+    } else if (change < -threshold) {
+      verdict = "improvement";
+    }
+    fprintf(stdout, "%-28.*s %16.2f %16.2f %+9.1f%% %s\n", nameLength, nameBytes, baselineMedian, currentMedian, change, verdict);
+  }
+  for (Arcadia_SizeValue i = 0, n = Arcadia_DDL_ListNode_getNumberOfElements(thread, baseline); i < n; ++i) {
+    Arcadia_String* name = getEntryString(thread, Arcadia_DDL_ListNode_getElementAt(thread, baseline, i), u8"name");
+    if (!findResult(thread, current, name)) {
+      fprintf(stdout, "%-28.*s %16.2f %16s %10s\n", (int)Arcadia_String_getNumberOfBytes(thread, name), (char const*)Arcadia_String_getBytes(thread, name),
+                      getEntryNumber(thread, Arcadia_DDL_ListNode_getElementAt(thread, baseline, i), u8"median"), "-", "removed");
+    }
+  }
+  return regressed;
+}
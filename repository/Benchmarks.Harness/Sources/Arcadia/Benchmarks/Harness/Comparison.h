@@ -0,0 +1,66 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_BENCHMARKS_HARNESS_COMPARISON_H_INCLUDED)
+#define ARCADIA_BENCHMARKS_HARNESS_COMPARISON_H_INCLUDED
+
+#include "Arcadia/Benchmarks/Harness/Harness.h"
+#include "Arcadia/FileSystem/Include.h"
+
+/// @brief Read results from a file.
+/// @param thread A pointer to this thread.
+/// @param path A pointer to the path of the file.
+/// @return A pointer to the DDL list node of the results.
+/// @remarks The file must be of the form `{ benchmarks : [ <result>, ... ] }` where `<result>` is the form created by Arcadia_Benchmarks_Result_toNode.
+/// @error Arcadia_Status_SemanticalError the file is not of the form described above
+Arcadia_DDL_ListNode*
+Arcadia_Benchmarks_readResults
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FilePath* path
+  );
+
+/// @brief Write results to a file.
+/// @param thread A pointer to this thread.
+/// @param path A pointer to the path of the file.
+/// @param results A pointer to an array of @a numberOfResults results.
+/// @param numberOfResults The number of results.
+void
+Arcadia_Benchmarks_writeResults
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FilePath* path,
+    Arcadia_Benchmarks_Result const* results,
+    Arcadia_SizeValue numberOfResults
+  );
+
+/// @brief Compare the medians of current results with the medians of baseline results and print the differences to the standard output.
+/// @param thread A pointer to this thread.
+/// @param baseline A pointer to the DDL list node of the baseline results.
+/// @param current A pointer to the DDL list node of the current results.
+/// @param threshold The threshold in percent.
+/// Differences of the medians smaller than or equal to the threshold are considered as noise.
+/// @return #Arcadia_BooleanValue_True if the median of at least one benchmark increased by more than the threshold, #Arcadia_BooleanValue_False otherwise.
+/// @remarks Benchmarks which are not in both results are reported but are not considered as regressions.
+Arcadia_BooleanValue
+Arcadia_Benchmarks_compareResults
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_ListNode* baseline,
+    Arcadia_DDL_ListNode* current,
+    Arcadia_Real64Value threshold
+  );
+
+#endif // ARCADIA_BENCHMARKS_HARNESS_COMPARISON_H_INCLUDED
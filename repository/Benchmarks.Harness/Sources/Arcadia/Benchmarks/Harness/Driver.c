@@ -0,0 +1,246 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/Benchmarks/Harness/Driver.h"
+
+#include "Arcadia/Benchmarks/Harness/Comparison.h"
+#include "Arcadia/Logging/Include.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// The value of the `--input` command line argument or a null pointer.
+static Arcadia_String* g_input = NULL;
+
+Arcadia_String*
+Arcadia_Benchmarks_getInput
+  (
+  )
+{ return g_input; }
+
+// Get if the name of a benchmark starts with the filter.
+static Arcadia_BooleanValue
+isSelected
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Benchmarks_Benchmark const* benchmark,
+    Arcadia_String* filter
+  )
+{
+  if (!filter) {
+    return Arcadia_BooleanValue_True;
+  }
+  Arcadia_SizeValue n = Arcadia_String_getNumberOfBytes(thread, filter);
+  return strlen(benchmark->name) >= n
+      && !memcmp(benchmark->name, Arcadia_String_getBytes(thread, filter), n);
+}
+
+// Run the selected benchmarks, print their results, and write them to the output file if any.
+static void
+runBenchmarks
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Benchmarks_GetBenchmarks* const* groups,
+    Arcadia_SizeValue numberOfGroups,
+    Arcadia_Benchmarks_Configuration const* configuration,
+    Arcadia_String* filter,
+    Arcadia_String* output
+  )
+{
+  Arcadia_SizeValue numberOfResults = 0, maximalNumberOfResults = 0;
+  for (Arcadia_SizeValue i = 0; i < numberOfGroups; ++i) {
+    Arcadia_SizeValue numberOfBenchmarks;
+    groups[i](&numberOfBenchmarks);
+    maximalNumberOfResults += numberOfBenchmarks;
+  }
+  Arcadia_Benchmarks_Result* results = Arcadia_Memory_allocateUnmanaged(thread, sizeof(Arcadia_Benchmarks_Result) * maximalNumberOfResults);
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_Benchmarks_printHeader();
+    for (Arcadia_SizeValue i = 0; i < numberOfGroups; ++i) {
+      Arcadia_SizeValue numberOfBenchmarks;
+      Arcadia_Benchmarks_Benchmark const* benchmarks = groups[i](&numberOfBenchmarks);
+      for (Arcadia_SizeValue j = 0; j < numberOfBenchmarks; ++j) {
+        if (isSelected(thread, &benchmarks[j], filter)) {
+          Arcadia_Benchmarks_run(thread, &benchmarks[j], configuration, &results[numberOfResults]);
+          Arcadia_Benchmarks_printResult(&results[numberOfResults]);
+          numberOfResults++;
+        }
+      }
+    }
+    if (output) {
+      Arcadia_Benchmarks_writeResults(thread, Arcadia_FilePath_parseNative(thread, output), results, numberOfResults);
+    }
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Memory_deallocateUnmanaged(thread, results);
+    results = NULL;
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Memory_deallocateUnmanaged(thread, results);
+  results = NULL;
+}
+
+static Arcadia_SizeValue
+toSize
+  (
+    Arcadia_Thread* thread,
+    Arcadia_CommandLineArgument* argument,
+    Arcadia_Log* log
+  )
+{
+  if (!argument->value) {
+    Arcadia_CommandLine_raiseNoValueError(thread, argument->name, log);
+  }
+  return (Arcadia_SizeValue)Arcadia_String_toNatural32(thread, argument->value);
+}
+
+static Arcadia_String*
+toString
+  (
+    Arcadia_Thread* thread,
+    Arcadia_CommandLineArgument* argument,
+    Arcadia_Log* log
+  )
+{
+  if (!argument->value) {
+    Arcadia_CommandLine_raiseNoValueError(thread, argument->name, log);
+  }
+  return argument->value;
+}
+
+// Returns true if a comparison found a regression, false otherwise.
+static Arcadia_BooleanValue
+main1
+  (
+    Arcadia_Thread* thread,
+    int argc,
+    char** argv,
+    Arcadia_Benchmarks_GetBenchmarks* const* groups,
+    Arcadia_SizeValue numberOfGroups
+  )
+{
+  Arcadia_Log* log = (Arcadia_Log*)Arcadia_ConsoleLog_create(thread);
+  Arcadia_Benchmarks_Configuration configuration = { .numberOfWarmupRepetitions = 3, .numberOfRepetitions = 21 };
+  Arcadia_SizeValue threshold = 5;
+  Arcadia_String* filter = NULL, * output = NULL, * input = NULL, * baseline = NULL, * compare = NULL;
+  for (int argi = 1; argi < argc; ++argi) {
+    Arcadia_String* argumentString = Arcadia_String_createFromCxxString(thread, argv[argi]);
+    Arcadia_UnicodeCodePointReader* r = (Arcadia_UnicodeCodePointReader*)Arcadia_ByteReader_UnicodeCodePointReader_create(thread, (Arcadia_ByteReader*)Arcadia_String_ByteReader_create(thread, argumentString));
+    Arcadia_CommandLineArgument* argument = Arcadia_CommandLine_parseArgument(thread, (Arcadia_UnicodeCodePointReader*)r);
+    if (argument->syntacticalError) {
+      Arcadia_CommandLine_invalidCommandLineArgumentError(thread, argumentString, log);
+    }
+    if (Arcadia_String_isEqualTo_pn(thread, argument->name, u8"warmup", sizeof(u8"warmup") - 1)) {
+      configuration.numberOfWarmupRepetitions = toSize(thread, argument, log);
+    } else if (Arcadia_String_isEqualTo_pn(thread, argument->name, u8"repetitions", sizeof(u8"repetitions") - 1)) {
+      configuration.numberOfRepetitions = toSize(thread, argument, log);
+      if (!configuration.numberOfRepetitions) {
+        Arcadia_CommandLine_raiseValueInvalidError(thread, argument->name, argument->value, log);
+      }
+    } else if (Arcadia_String_isEqualTo_pn(thread, argument->name, u8"threshold", sizeof(u8"threshold") - 1)) {
+      threshold = toSize(thread, argument, log);
+    } else if (Arcadia_String_isEqualTo_pn(thread, argument->name, u8"filter", sizeof(u8"filter") - 1)) {
+      filter = toString(thread, argument, log);
+    } else if (Arcadia_String_isEqualTo_pn(thread, argument->name, u8"output", sizeof(u8"output") - 1)) {
+      output = toString(thread, argument, log);
+    } else if (Arcadia_String_isEqualTo_pn(thread, argument->name, u8"input", sizeof(u8"input") - 1)) {
+      input = toString(thread, argument, log);
+    } else if (Arcadia_String_isEqualTo_pn(thread, argument->name, u8"baseline", sizeof(u8"baseline") - 1)) {
+      baseline = toString(thread, argument, log);
+    } else if (Arcadia_String_isEqualTo_pn(thread, argument->name, u8"compare", sizeof(u8"compare") - 1)) {
+      compare = toString(thread, argument, log);
+    } else {
+      Arcadia_CommandLine_raiseUnknownArgumentError(thread, argument->name, argument->value, log);
+    }
+  }
+  if (baseline || compare) {
+    if (!baseline) {
+      Arcadia_CommandLine_raiseRequiredArgumentMissingError(thread, Arcadia_String_createFromCxxString(thread, u8"baseline"), log);
+    }
+    if (!compare) {
+      Arcadia_CommandLine_raiseRequiredArgumentMissingError(thread, Arcadia_String_createFromCxxString(thread, u8"compare"), log);
+    }
+    return Arcadia_Benchmarks_compareResults(thread, Arcadia_Benchmarks_readResults(thread, Arcadia_FilePath_parseNative(thread, baseline)),
+                                                     Arcadia_Benchmarks_readResults(thread, Arcadia_FilePath_parseNative(thread, compare)),
+                                                     (Arcadia_Real64Value)threshold);
+  }
+  // The collector runs between the repetitions.
+  // Lock the arguments such that they survive.
+  if (filter) {
+    Arcadia_Object_lock(thread, (Arcadia_Object*)filter);
+  }
+  if (output) {
+    Arcadia_Object_lock(thread, (Arcadia_Object*)output);
+  }
+  if (input) {
+    Arcadia_Object_lock(thread, (Arcadia_Object*)input);
+  }
+  g_input = input;
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    runBenchmarks(thread, groups, numberOfGroups, &configuration, filter, output);
+  }
+  Arcadia_Thread_popJumpTarget(thread);
+  g_input = NULL;
+  if (input) {
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)input);
+  }
+  if (output) {
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)output);
+  }
+  if (filter) {
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)filter);
+  }
+  if (Arcadia_Thread_getStatus(thread)) {
+    Arcadia_Thread_jump(thread);
+  }
+  return Arcadia_BooleanValue_False;
+}
+
+int
+Arcadia_Benchmarks_main
+  (
+    int argc,
+    char** argv,
+    Arcadia_Benchmarks_GetBenchmarks* const* groups,
+    Arcadia_SizeValue numberOfGroups
+  )
+{
+  Arcadia_BooleanValue regressed = Arcadia_BooleanValue_False;
+  Arcadia_Process* process = NULL;
+  if (Arcadia_Process_get(&process)) {
+    return 2;
+  }
+  Arcadia_Thread* thread = Arcadia_Process_getThread(process);
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    regressed = main1(thread, argc, argv, groups, numberOfGroups);
+  }
+  Arcadia_Thread_popJumpTarget(thread);
+  Arcadia_Status status = Arcadia_Thread_getStatus(thread);
+  thread = NULL;
+  Arcadia_Process_relinquish(process);
+  process = NULL;
+  if (status) {
+    return 2;
+  }
+  return regressed ? 1 : 0;
+}
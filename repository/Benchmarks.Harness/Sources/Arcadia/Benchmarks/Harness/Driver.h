@@ -0,0 +1,58 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_BENCHMARKS_HARNESS_DRIVER_H_INCLUDED)
+#define ARCADIA_BENCHMARKS_HARNESS_DRIVER_H_INCLUDED
+
+#include "Arcadia/Benchmarks/Harness/Harness.h"
+
+/// @brief The type of a function returning a group of benchmarks.
+/// @param numberOfBenchmarks A pointer to a variable receiving the number of benchmarks.
+/// @return A pointer to the array of benchmarks.
+typedef Arcadia_Benchmarks_Benchmark const* (Arcadia_Benchmarks_GetBenchmarks)(Arcadia_SizeValue* numberOfBenchmarks);
+
+/// @brief Get the value of the `--input` command line argument.
+/// @return A pointer to the value or a null pointer if there is no such argument.
+/// @remarks Benchmarks which read an input file call this function from their set up functions.
+/// The value is locked while the benchmarks run.
+Arcadia_String*
+Arcadia_Benchmarks_getInput
+  (
+  );
+
+/// @brief The entry point of a benchmark executable.
+/// @param argc, argv The arguments of the `main` function.
+/// @param groups A pointer to an array of @a numberOfGroups functions returning the benchmarks of the executable.
+/// @param numberOfGroups The number of groups.
+/// @return 0 on success, 1 if a comparison found a regression, 2 on failure.
+/// @remarks
+/// The following command line arguments are supported:
+/// - `--warmup=<n>` The number of repetitions of each benchmark which are not measured. Default is 3.
+/// - `--repetitions=<n>` The number of repetitions of each benchmark which are measured. Default is 21.
+/// - `--filter=<string>` Run only the benchmarks of which the names start with `<string>`.
+/// - `--output=<path>` Write the results to the file `<path>`.
+/// - `--input=<path>` The path of an input file, see Arcadia_Benchmarks_getInput.
+/// - `--baseline=<path>` `--compare=<path>` Do not run the benchmarks. Compare the results in the file `<compare>` with the results in the file `<baseline>`.
+/// - `--threshold=<n>` The threshold in percent below which differences are considered as noise. Default is 5.
+int
+Arcadia_Benchmarks_main
+  (
+    int argc,
+    char** argv,
+    Arcadia_Benchmarks_GetBenchmarks* const* groups,
+    Arcadia_SizeValue numberOfGroups
+  );
+
+#endif // ARCADIA_BENCHMARKS_HARNESS_DRIVER_H_INCLUDED
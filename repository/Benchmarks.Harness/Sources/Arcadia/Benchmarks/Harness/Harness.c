@@ -0,0 +1,194 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/Benchmarks/Harness/Harness.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static int
+compareSamples
+  (
+    void const* a,
+    void const* b
+  )
+{
+  Arcadia_Natural64Value x = *(Arcadia_Natural64Value const*)a,
+                         y = *(Arcadia_Natural64Value const*)b;
+  return x < y ? -1 : (x > y ? +1 : 0);
+}
+
+// Get the sample of the specified percentile from the sorted samples by the nearest-rank method.
+static Arcadia_Natural64Value
+getPercentile
+  (
+    Arcadia_Natural64Value const* samples,
+    Arcadia_SizeValue numberOfSamples,
+    Arcadia_SizeValue percentile
+  )
+{
+  Arcadia_SizeValue rank = (percentile * numberOfSamples + 99) / 100;
+  return samples[rank > 0 ? rank - 1 : 0];
+}
+
+static void
+measure
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Benchmarks_Benchmark const* benchmark,
+    Arcadia_Benchmarks_Configuration const* configuration,
+    Arcadia_Natural64Value* samples,
+    Arcadia_Benchmarks_Result* result
+  )
+{
+  Arcadia_Process* process = Arcadia_Thread_getProcess(thread);
+  for (Arcadia_SizeValue i = 0; i < configuration->numberOfWarmupRepetitions; ++i) {
+    benchmark->run(thread);
+  }
+  // Collect the garbage of the set up and the warmup such that it is not attributed to the first repetition.
+  Arcadia_Process_stepARMS(process);
+  Arcadia_Process_Statistics before, afterRun, afterCollection;
+  Arcadia_Process_getStatistics(process, &before);
+  Arcadia_Natural64Value allocatedObjects = 0, allocatedBytes = 0, reclaimedObjects = 0, collectionTime = 0;
+  for (Arcadia_SizeValue i = 0; i < configuration->numberOfRepetitions; ++i) {
+    Arcadia_Natural64Value start = Arcadia_Profiler_getTimestamp();
+    benchmark->run(thread);
+    samples[i] = Arcadia_Profiler_getTimestamp() - start;
+    Arcadia_Process_getStatistics(process, &afterRun);
+    Arcadia_Process_stepARMS(process);
+    Arcadia_Process_getStatistics(process, &afterCollection);
+    allocatedObjects += afterRun.numberOfAllocatedObjects - before.numberOfAllocatedObjects;
+    allocatedBytes += afterRun.numberOfAllocatedBytes - before.numberOfAllocatedBytes;
+    reclaimedObjects += afterCollection.numberOfReclaimedObjects - afterRun.numberOfReclaimedObjects;
+    collectionTime += afterCollection.collectionTime - afterRun.collectionTime;
+    before = afterCollection;
+  }
+  qsort(samples, configuration->numberOfRepetitions, sizeof(Arcadia_Natural64Value), &compareSamples);
+  Arcadia_Real64Value numberOfOperations = (Arcadia_Real64Value)benchmark->numberOfOperations;
+  Arcadia_Real64Value numberOfMeasuredOperations = numberOfOperations * (Arcadia_Real64Value)configuration->numberOfRepetitions;
+  result->name = benchmark->name;
+  result->numberOfOperations = benchmark->numberOfOperations;
+  result->numberOfRepetitions = configuration->numberOfRepetitions;
+  result->minimum = (Arcadia_Real64Value)samples[0] / numberOfOperations;
+  result->median = (Arcadia_Real64Value)getPercentile(samples, configuration->numberOfRepetitions, 50) / numberOfOperations;
+  result->percentile90 = (Arcadia_Real64Value)getPercentile(samples, configuration->numberOfRepetitions, 90) / numberOfOperations;
+  result->maximum = (Arcadia_Real64Value)samples[configuration->numberOfRepetitions - 1] / numberOfOperations;
+  result->allocatedObjects = (Arcadia_Real64Value)allocatedObjects / numberOfMeasuredOperations;
+  result->allocatedBytes = (Arcadia_Real64Value)allocatedBytes / numberOfMeasuredOperations;
+  result->reclaimedObjects = (Arcadia_Real64Value)reclaimedObjects / numberOfMeasuredOperations;
+  result->collectionTime = (Arcadia_Real64Value)collectionTime / numberOfMeasuredOperations;
+}
+
+void
+Arcadia_Benchmarks_run
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Benchmarks_Benchmark const* benchmark,
+    Arcadia_Benchmarks_Configuration const* configuration,
+    Arcadia_Benchmarks_Result* result
+  )
+{
+  if (!configuration->numberOfRepetitions || !benchmark->numberOfOperations) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Natural64Value* samples = Arcadia_Memory_allocateUnmanaged(thread, sizeof(Arcadia_Natural64Value) * configuration->numberOfRepetitions);
+  if (benchmark->setUp) {
+    Arcadia_JumpTarget jumpTarget;
+    Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+    if (Arcadia_JumpTarget_save(&jumpTarget)) {
+      benchmark->setUp(thread);
+      Arcadia_Thread_popJumpTarget(thread);
+    } else {
+      Arcadia_Thread_popJumpTarget(thread);
+      Arcadia_Memory_deallocateUnmanaged(thread, samples);
+      samples = NULL;
+      Arcadia_Thread_jump(thread);
+    }
+  }
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    measure(thread, benchmark, configuration, samples, result);
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    if (benchmark->tearDown) {
+      benchmark->tearDown(thread);
+    }
+    Arcadia_Memory_deallocateUnmanaged(thread, samples);
+    samples = NULL;
+    Arcadia_Thread_jump(thread);
+  }
+  if (benchmark->tearDown) {
+    benchmark->tearDown(thread);
+  }
+  Arcadia_Memory_deallocateUnmanaged(thread, samples);
+  samples = NULL;
+}
+
+void
+Arcadia_Benchmarks_printHeader
+  (
+  )
+{
+  fprintf(stdout, "%-32s %12s %12s %12s %12s %12s %12s %12s\n", "benchmark", "median", "p90", "minimum", "objects", "bytes", "reclaimed", "collection");
+  fprintf(stdout, "%-32s %12s %12s %12s %12s %12s %12s %12s\n", "", "[ns/op]", "[ns/op]", "[ns/op]", "[1/op]", "[B/op]", "[1/op]", "[ns/op]");
+}
+
+void
+Arcadia_Benchmarks_printResult
+  (
+    Arcadia_Benchmarks_Result const* result
+  )
+{
+  fprintf(stdout, "%-32s %12.2f %12.2f %12.2f %12.2f %12.2f %12.2f %12.2f\n", result->name, result->median, result->percentile90, result->minimum,
+                  result->allocatedObjects, result->allocatedBytes, result->reclaimedObjects, result->collectionTime);
+  fflush(stdout);
+}
+
+static void
+insertEntry
+  (
+    Arcadia_Thread* thread,
+    Arcadia_DDL_MapNode* node,
+    char const* name,
+    Arcadia_DDL_Node* value
+  )
+{
+  Arcadia_DDL_MapNode_insertBack(thread, node, Arcadia_DDL_MapEntryNode_create(thread, Arcadia_DDL_NameNode_create(thread, Arcadia_String_createFromCxxString(thread, name)), value));
+}
+
+Arcadia_DDL_MapNode*
+Arcadia_Benchmarks_Result_toNode
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Benchmarks_Result const* result
+  )
+{
+  Arcadia_DDL_MapNode* node = Arcadia_DDL_MapNode_create(thread);
+  insertEntry(thread, node, u8"name", (Arcadia_DDL_Node*)Arcadia_DDL_StringNode_createString(thread, Arcadia_String_createFromCxxString(thread, result->name)));
+  insertEntry(thread, node, u8"operations", (Arcadia_DDL_Node*)Arcadia_DDL_NumberNode_createNatural64(thread, (Arcadia_Natural64Value)result->numberOfOperations));
+  insertEntry(thread, node, u8"repetitions", (Arcadia_DDL_Node*)Arcadia_DDL_NumberNode_createNatural64(thread, (Arcadia_Natural64Value)result->numberOfRepetitions));
+  insertEntry(thread, node, u8"minimum", (Arcadia_DDL_Node*)Arcadia_DDL_NumberNode_createReal64(thread, result->minimum));
+  insertEntry(thread, node, u8"median", (Arcadia_DDL_Node*)Arcadia_DDL_NumberNode_createReal64(thread, result->median));
+  insertEntry(thread, node, u8"percentile90", (Arcadia_DDL_Node*)Arcadia_DDL_NumberNode_createReal64(thread, result->percentile90));
+  insertEntry(thread, node, u8"maximum", (Arcadia_DDL_Node*)Arcadia_DDL_NumberNode_createReal64(thread, result->maximum));
+  insertEntry(thread, node, u8"allocatedObjects", (Arcadia_DDL_Node*)Arcadia_DDL_NumberNode_createReal64(thread, result->allocatedObjects));
+  insertEntry(thread, node, u8"allocatedBytes", (Arcadia_DDL_Node*)Arcadia_DDL_NumberNode_createReal64(thread, result->allocatedBytes));
+  insertEntry(thread, node, u8"reclaimedObjects", (Arcadia_DDL_Node*)Arcadia_DDL_NumberNode_createReal64(thread, result->reclaimedObjects));
+  insertEntry(thread, node, u8"collectionTime", (Arcadia_DDL_Node*)Arcadia_DDL_NumberNode_createReal64(thread, result->collectionTime));
+  return node;
+}
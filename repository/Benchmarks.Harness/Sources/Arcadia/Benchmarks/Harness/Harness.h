@@ -0,0 +1,123 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_BENCHMARKS_HARNESS_HARNESS_H_INCLUDED)
+#define ARCADIA_BENCHMARKS_HARNESS_HARNESS_H_INCLUDED
+
+#include "Arcadia/DDL/Include.h"
+
+/// @brief A benchmark.
+/// @remarks
+/// One call to @a run is one repetition of the benchmark and performs @a numberOfOperations operations.
+/// Objects which must survive the repetitions are created by @a setUp and must be locked by it.
+typedef struct Arcadia_Benchmarks_Benchmark {
+  /// @brief The name of the benchmark e.g. "HashMap.get".
+  char const* name;
+  /// @brief The number of operations performed by one call to @a run.
+  Arcadia_SizeValue numberOfOperations;
+  /// @brief A pointer to a function creating the state of the benchmark or a null pointer.
+  void (*setUp)(Arcadia_Thread* thread);
+  /// @brief A pointer to a function performing one repetition of the benchmark.
+  void (*run)(Arcadia_Thread* thread);
+  /// @brief A pointer to a function destroying the state of the benchmark or a null pointer.
+  void (*tearDown)(Arcadia_Thread* thread);
+} Arcadia_Benchmarks_Benchmark;
+
+/// @brief The configuration of a benchmark run.
+typedef struct Arcadia_Benchmarks_Configuration {
+  /// @brief The number of repetitions which are performed but not measured.
+  Arcadia_SizeValue numberOfWarmupRepetitions;
+  /// @brief The number of repetitions which are measured.
+  Arcadia_SizeValue numberOfRepetitions;
+} Arcadia_Benchmarks_Configuration;
+
+/// @brief The result of a benchmark run.
+/// @remarks Times are in nanoseconds per operation, counters are per operation.
+typedef struct Arcadia_Benchmarks_Result {
+  /// @brief The name of the benchmark.
+  char const* name;
+  /// @brief The number of operations per repetition.
+  Arcadia_SizeValue numberOfOperations;
+  /// @brief The number of measured repetitions.
+  Arcadia_SizeValue numberOfRepetitions;
+  /// @brief The time of the fastest repetition.
+  Arcadia_Real64Value minimum;
+  /// @brief The median of the times of the repetitions.
+  Arcadia_Real64Value median;
+  /// @brief The 90th percentile of the times of the repetitions.
+  Arcadia_Real64Value percentile90;
+  /// @brief The time of the slowest repetition.
+  Arcadia_Real64Value maximum;
+  /// @brief The number of allocated objects.
+  Arcadia_Real64Value allocatedObjects;
+  /// @brief The number of allocated Bytes.
+  Arcadia_Real64Value allocatedBytes;
+  /// @brief The number of reclaimed objects.
+  Arcadia_Real64Value reclaimedObjects;
+  /// @brief The time spent in collections.
+  Arcadia_Real64Value collectionTime;
+} Arcadia_Benchmarks_Result;
+
+/// @brief Run a benchmark.
+/// @param thread A pointer to this thread.
+/// @param benchmark A pointer to the benchmark.
+/// @param configuration A pointer to the configuration.
+/// @param result A pointer to the result.
+/// @remarks
+/// The collector is run after each repetition and is not included in the time of the repetition.
+/// Its time and the number of objects it reclaimed are reported separately.
+/// @error Arcadia_Status_ArgumentValueInvalid the number of repetitions is zero
+void
+Arcadia_Benchmarks_run
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Benchmarks_Benchmark const* benchmark,
+    Arcadia_Benchmarks_Configuration const* configuration,
+    Arcadia_Benchmarks_Result* result
+  );
+
+/// @brief Print a header for the results to the standard output.
+void
+Arcadia_Benchmarks_printHeader
+  (
+  );
+
+/// @brief Print a result to the standard output.
+/// @param result A pointer to the result.
+void
+Arcadia_Benchmarks_printResult
+  (
+    Arcadia_Benchmarks_Result const* result
+  );
+
+/// @brief Create a DDL node for a result.
+/// @param thread A pointer to this thread.
+/// @param result A pointer to the result.
+/// @return A pointer to the DDL map node
+/// @code
+/// {
+///   name : <string>, operations : <number>, repetitions : <number>,
+///   minimum : <number>, median : <number>, percentile90 : <number>, maximum : <number>,
+///   allocatedObjects : <number>, allocatedBytes : <number>, reclaimedObjects : <number>, collectionTime : <number>
+/// }
+/// @endcode
+Arcadia_DDL_MapNode*
+Arcadia_Benchmarks_Result_toNode
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Benchmarks_Result const* result
+  );
+
+#endif // ARCADIA_BENCHMARKS_HARNESS_HARNESS_H_INCLUDED
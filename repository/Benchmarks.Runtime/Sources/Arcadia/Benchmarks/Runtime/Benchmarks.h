@@ -0,0 +1,57 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_BENCHMARKS_RUNTIME_BENCHMARKS_H_INCLUDED)
+#define ARCADIA_BENCHMARKS_RUNTIME_BENCHMARKS_H_INCLUDED
+
+#include "Arcadia/Benchmarks/Harness/Harness.h"
+
+/// @brief Get the benchmarks of Arcadia_HashMap, Arcadia_ArrayList, and Arcadia_Real32ArrayList.
+/// @param numberOfBenchmarks A pointer to a variable receiving the number of benchmarks.
+/// @return A pointer to the array of benchmarks.
+Arcadia_Benchmarks_Benchmark const*
+Arcadia_Benchmarks_getCollectionsBenchmarks
+  (
+    Arcadia_SizeValue* numberOfBenchmarks
+  );
+
+/// @brief Get the benchmarks of Arcadia_StringBuilder and Arcadia_String.
+/// @param numberOfBenchmarks A pointer to a variable receiving the number of benchmarks.
+/// @return A pointer to the array of benchmarks.
+Arcadia_Benchmarks_Benchmark const*
+Arcadia_Benchmarks_getStringsBenchmarks
+  (
+    Arcadia_SizeValue* numberOfBenchmarks
+  );
+
+/// @brief Get the benchmarks of Arcadia_BigInteger and the string to number conversions.
+/// @param numberOfBenchmarks A pointer to a variable receiving the number of benchmarks.
+/// @return A pointer to the array of benchmarks.
+Arcadia_Benchmarks_Benchmark const*
+Arcadia_Benchmarks_getNumbersBenchmarks
+  (
+    Arcadia_SizeValue* numberOfBenchmarks
+  );
+
+/// @brief Get the benchmarks of the DDL scanner and the MIL scanner.
+/// @param numberOfBenchmarks A pointer to a variable receiving the number of benchmarks.
+/// @return A pointer to the array of benchmarks.
+Arcadia_Benchmarks_Benchmark const*
+Arcadia_Benchmarks_getScannersBenchmarks
+  (
+    Arcadia_SizeValue* numberOfBenchmarks
+  );
+
+#endif // ARCADIA_BENCHMARKS_RUNTIME_BENCHMARKS_H_INCLUDED
@@ -0,0 +1,281 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/Benchmarks/Runtime/Benchmarks.h"
+
+#include <stdio.h>
+
+// The number of keys in the map.
+#define NumberOfKeys (1024)
+
+// The number of elements in the list.
+#define NumberOfElements (4096)
+
+// The map of HashMap.get.
+static Arcadia_Map* g_map = NULL;
+
+// The keys of HashMap.set and HashMap.get.
+// The keys looked up are equal to but not identical with the keys in the map.
+static Arcadia_List* g_keys = NULL;
+
+// The list of ArrayList.getAt and ArrayList.collect.
+static Arcadia_List* g_list = NULL;
+
+// The list of Real32ArrayList.getAt and Real32ArrayList.collect.
+static Arcadia_Real32ArrayList* g_real32List = NULL;
+
+// The elements of Real32ArrayList.insertBackMany.
+static Arcadia_Real32Value g_real32Elements[NumberOfElements];
+
+static void
+setUpKeys
+  (
+    Arcadia_Thread* thread
+  )
+{
+  g_keys = (Arcadia_List*)Arcadia_ArrayList_create(thread);
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_keys);
+  for (Arcadia_SizeValue i = 0; i < NumberOfKeys; ++i) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "key%zu", (size_t)i);
+    Arcadia_List_insertBackObjectReferenceValue(thread, g_keys, Arcadia_String_createFromCxxString(thread, buffer));
+  }
+}
+
+static void
+tearDownKeys
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Object_unlock(thread, (Arcadia_Object*)g_keys);
+  g_keys = NULL;
+}
+
+// Create a map and set all keys.
+static void
+runHashMapSet
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Map* map = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
+  for (Arcadia_SizeValue i = 0; i < NumberOfKeys; ++i) {
+    Arcadia_Map_set(thread, map, Arcadia_List_getAt(thread, g_keys, i), Arcadia_Value_makeSizeValue(i), NULL, NULL);
+  }
+}
+
+static void
+setUpHashMapGet
+  (
+    Arcadia_Thread* thread
+  )
+{
+  setUpKeys(thread);
+  g_map = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_map);
+  for (Arcadia_SizeValue i = 0; i < NumberOfKeys; ++i) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "key%zu", (size_t)i);
+    Arcadia_Map_set(thread, g_map, Arcadia_Value_makeObjectReferenceValue(Arcadia_String_createFromCxxString(thread, buffer)), Arcadia_Value_makeSizeValue(i), NULL, NULL);
+  }
+}
+
+// Look up all keys.
+static void
+runHashMapGet
+  (
+    Arcadia_Thread* thread
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < NumberOfKeys; ++i) {
+    Arcadia_Value v = Arcadia_Map_get(thread, g_map, Arcadia_List_getAt(thread, g_keys, i));
+    if (!Arcadia_Value_isSizeValue(&v) || i != Arcadia_Value_getSizeValue(&v)) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+      Arcadia_Thread_jump(thread);
+    }
+  }
+}
+
+static void
+tearDownHashMapGet
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Object_unlock(thread, (Arcadia_Object*)g_map);
+  g_map = NULL;
+  tearDownKeys(thread);
+}
+
+// Create a list and insert all elements at its back.
+static void
+runArrayListInsertBack
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_List* list = (Arcadia_List*)Arcadia_ArrayList_create(thread);
+  for (Arcadia_SizeValue i = 0; i < NumberOfElements; ++i) {
+    Arcadia_List_insertBack(thread, list, Arcadia_Value_makeSizeValue(i));
+  }
+}
+
+static void
+setUpArrayListGetAt
+  (
+    Arcadia_Thread* thread
+  )
+{
+  g_list = (Arcadia_List*)Arcadia_ArrayList_create(thread);
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_list);
+  for (Arcadia_SizeValue i = 0; i < NumberOfElements; ++i) {
+    Arcadia_List_insertBack(thread, g_list, Arcadia_Value_makeSizeValue(i));
+  }
+}
+
+// Get all elements.
+static void
+runArrayListGetAt
+  (
+    Arcadia_Thread* thread
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < NumberOfElements; ++i) {
+    Arcadia_Value v = Arcadia_List_getAt(thread, g_list, i);
+    if (!Arcadia_Value_isSizeValue(&v) || i != Arcadia_Value_getSizeValue(&v)) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+      Arcadia_Thread_jump(thread);
+    }
+  }
+}
+
+static void
+tearDownArrayListGetAt
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Object_unlock(thread, (Arcadia_Object*)g_list);
+  g_list = NULL;
+}
+
+// Run the garbage collector.
+// The list of the benchmark is locked, hence the collector visits it.
+static void
+runCollect
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Process_runARMS(Arcadia_Thread_getProcess(thread), false);
+}
+
+// Create a list and insert all elements at its back.
+static void
+runReal32ArrayListInsertBack
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Real32ArrayList* list = Arcadia_Real32ArrayList_create(thread);
+  for (Arcadia_SizeValue i = 0; i < NumberOfElements; ++i) {
+    Arcadia_Real32ArrayList_insertBack(thread, list, (Arcadia_Real32Value)i);
+  }
+}
+
+static void
+setUpReal32ArrayListInsertBackMany
+  (
+    Arcadia_Thread* thread
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < NumberOfElements; ++i) {
+    g_real32Elements[i] = (Arcadia_Real32Value)i;
+  }
+}
+
+// Create a list and insert all elements at its back in groups of three (the size of a vertex position).
+static void
+runReal32ArrayListInsertBackMany
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Real32ArrayList* list = Arcadia_Real32ArrayList_create(thread);
+  for (Arcadia_SizeValue i = 0; i + 3 <= NumberOfElements; i += 3) {
+    Arcadia_Real32ArrayList_insertBackMany(thread, list, g_real32Elements + i, 3);
+  }
+}
+
+static void
+setUpReal32ArrayListGetAt
+  (
+    Arcadia_Thread* thread
+  )
+{
+  g_real32List = Arcadia_Real32ArrayList_create(thread);
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_real32List);
+  for (Arcadia_SizeValue i = 0; i < NumberOfElements; ++i) {
+    Arcadia_Real32ArrayList_insertBack(thread, g_real32List, (Arcadia_Real32Value)i);
+  }
+}
+
+// Get all elements.
+static void
+runReal32ArrayListGetAt
+  (
+    Arcadia_Thread* thread
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < NumberOfElements; ++i) {
+    if ((Arcadia_Real32Value)i != Arcadia_Real32ArrayList_getAt(thread, g_real32List, i)) {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+      Arcadia_Thread_jump(thread);
+    }
+  }
+}
+
+static void
+tearDownReal32ArrayListGetAt
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Object_unlock(thread, (Arcadia_Object*)g_real32List);
+  g_real32List = NULL;
+}
+
+static Arcadia_Benchmarks_Benchmark const g_benchmarks[] = {
+  { u8"HashMap.set", NumberOfKeys, &setUpKeys, &runHashMapSet, &tearDownKeys },
+  { u8"HashMap.get", NumberOfKeys, &setUpHashMapGet, &runHashMapGet, &tearDownHashMapGet },
+  { u8"ArrayList.insertBack", NumberOfElements, NULL, &runArrayListInsertBack, NULL },
+  { u8"ArrayList.getAt", NumberOfElements, &setUpArrayListGetAt, &runArrayListGetAt, &tearDownArrayListGetAt },
+  { u8"ArrayList.collect", NumberOfElements, &setUpArrayListGetAt, &runCollect, &tearDownArrayListGetAt },
+  { u8"Real32ArrayList.insertBack", NumberOfElements, NULL, &runReal32ArrayListInsertBack, NULL },
+  { u8"Real32ArrayList.insertBackMany", NumberOfElements, &setUpReal32ArrayListInsertBackMany, &runReal32ArrayListInsertBackMany, NULL },
+  { u8"Real32ArrayList.getAt", NumberOfElements, &setUpReal32ArrayListGetAt, &runReal32ArrayListGetAt, &tearDownReal32ArrayListGetAt },
+  { u8"Real32ArrayList.collect", NumberOfElements, &setUpReal32ArrayListGetAt, &runCollect, &tearDownReal32ArrayListGetAt },
+};
+
+Arcadia_Benchmarks_Benchmark const*
+Arcadia_Benchmarks_getCollectionsBenchmarks
+  (
+    Arcadia_SizeValue* numberOfBenchmarks
+  )
+{
+  *numberOfBenchmarks = sizeof(g_benchmarks) / sizeof(Arcadia_Benchmarks_Benchmark);
+  return g_benchmarks;
+}
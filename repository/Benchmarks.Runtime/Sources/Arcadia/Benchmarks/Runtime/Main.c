@@ -0,0 +1,33 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/Benchmarks/Runtime/Benchmarks.h"
+#include "Arcadia/Benchmarks/Harness/Driver.h"
+
+static Arcadia_Benchmarks_GetBenchmarks* const g_groups[] = {
+  &Arcadia_Benchmarks_getCollectionsBenchmarks,
+  &Arcadia_Benchmarks_getStringsBenchmarks,
+  &Arcadia_Benchmarks_getNumbersBenchmarks,
+  &Arcadia_Benchmarks_getScannersBenchmarks,
+};
+
+// See Arcadia_Benchmarks_main for the command line arguments.
+int
+main
+  (
+    int argc,
+    char** argv
+  )
+{ return Arcadia_Benchmarks_main(argc, argv, g_groups, sizeof(g_groups) / sizeof(Arcadia_Benchmarks_GetBenchmarks*)); }
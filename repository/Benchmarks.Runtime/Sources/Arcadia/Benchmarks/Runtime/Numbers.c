@@ -0,0 +1,138 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/Benchmarks/Runtime/Benchmarks.h"
+
+#include <string.h>
+
+// The number of conversions and arithmetic operations per repetition.
+#define NumberOfOperations (256)
+
+// A number with 64 decimal digits.
+static char const g_decimalString[] = u8"3141592653589793238462643383279502884197169399375105820974944592";
+
+// The strings converted by toReal64.
+// They cover the fast path, the slow path with big integers, subnormal numbers, and the limits.
+static char const* const g_realStrings[] = {
+  u8"0.1",
+  u8"3.14159",
+  u8"123456789.123456789",
+  u8"2.2250738585072014e-308",
+  u8"4.9406564584124654e-324",
+  u8"1.7976931348623157e308",
+  u8"9007199254740993",
+  u8"6.02214076e23",
+};
+
+// The factors of BigInteger.multiply.
+static Arcadia_BigInteger* g_a = NULL;
+static Arcadia_BigInteger* g_b = NULL;
+
+// Convert a decimal string to a big integer.
+static void
+runBigIntegerFromDecimalString
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_BigInteger* x = Arcadia_BigInteger_create(thread);
+  for (Arcadia_SizeValue i = 0; i < NumberOfOperations; ++i) {
+    Arcadia_BigInteger_fromDecimalString(thread, x, (Arcadia_Natural8Value const*)g_decimalString, sizeof(g_decimalString) - 1);
+  }
+}
+
+static void
+setUpBigInteger
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Process* process = Arcadia_Thread_getProcess(thread);
+  g_a = Arcadia_BigInteger_create(thread);
+  Arcadia_Process_lockObject(process, g_a);
+  Arcadia_BigInteger_fromDecimalString(thread, g_a, (Arcadia_Natural8Value const*)g_decimalString, sizeof(g_decimalString) - 1);
+  g_b = Arcadia_BigInteger_create(thread);
+  Arcadia_Process_lockObject(process, g_b);
+  Arcadia_BigInteger_fromDecimalString(thread, g_b, (Arcadia_Natural8Value const*)g_decimalString, (sizeof(g_decimalString) - 1) / 2);
+}
+
+// Multiply a big integer with 64 decimal digits by a big integer with 32 decimal digits.
+static void
+runBigIntegerMultiply
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_BigInteger* x = Arcadia_BigInteger_create(thread);
+  for (Arcadia_SizeValue i = 0; i < NumberOfOperations; ++i) {
+    Arcadia_BigInteger_multiply3(thread, x, g_a, g_b);
+  }
+}
+
+// Convert a big integer with 64 decimal digits to a decimal string.
+static void
+runBigIntegerToDecimalString
+  (
+    Arcadia_Thread* thread
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < NumberOfOperations; ++i) {
+    Arcadia_BigInteger_toDecimalString(thread, g_a);
+  }
+}
+
+static void
+tearDownBigInteger
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Process* process = Arcadia_Thread_getProcess(thread);
+  Arcadia_Process_unlockObject(process, g_b);
+  g_b = NULL;
+  Arcadia_Process_unlockObject(process, g_a);
+  g_a = NULL;
+}
+
+// Convert decimal strings to Real64 values.
+static void
+runToReal64
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_SizeValue numberOfStrings = sizeof(g_realStrings) / sizeof(char const*);
+  for (Arcadia_SizeValue i = 0; i < NumberOfOperations; ++i) {
+    char const* p = g_realStrings[i % numberOfStrings];
+    Arcadia_toReal64(thread, (Arcadia_Natural8Value const*)p, strlen(p));
+  }
+}
+
+static Arcadia_Benchmarks_Benchmark const g_benchmarks[] = {
+  { u8"BigInteger.fromDecimalString", NumberOfOperations, NULL, &runBigIntegerFromDecimalString, NULL },
+  { u8"BigInteger.multiply", NumberOfOperations, &setUpBigInteger, &runBigIntegerMultiply, &tearDownBigInteger },
+  { u8"BigInteger.toDecimalString", NumberOfOperations, &setUpBigInteger, &runBigIntegerToDecimalString, &tearDownBigInteger },
+  { u8"toReal64", NumberOfOperations, NULL, &runToReal64, NULL },
+};
+
+Arcadia_Benchmarks_Benchmark const*
+Arcadia_Benchmarks_getNumbersBenchmarks
+  (
+    Arcadia_SizeValue* numberOfBenchmarks
+  )
+{
+  *numberOfBenchmarks = sizeof(g_benchmarks) / sizeof(Arcadia_Benchmarks_Benchmark);
+  return g_benchmarks;
+}
@@ -0,0 +1,150 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/Benchmarks/Runtime/Benchmarks.h"
+
+#include "Arcadia/Logging/Include.h"
+#include "Arcadia/MILC/Include.h"
+
+#include <string.h>
+
+// The number of lines of the inputs.
+#define NumberOfLines (256)
+
+// A line of the DDL input.
+#define DDLLine u8"  { name : \"Hello, World!\", number : 12345.678, integer : 42, flags : [ true, false, void ] },\n"
+
+// A line of the MIL input.
+#define MILLine u8"procedure Name : $0 = add $1, 17 \"Hello, World!\" 17.23 // comment\n"
+
+// The DDL input.
+static Arcadia_ByteArray* g_ddlInput = NULL;
+
+// The scanner of DDL.Scanner.
+static Arcadia_DDL_Scanner* g_ddlScanner = NULL;
+
+// The MIL input.
+static Arcadia_ByteArray* g_milInput = NULL;
+
+// The context of MIL.Scanner.
+static Arcadia_MILC_Context* g_milContext = NULL;
+
+// Create a Byte array of the specified line repeated NumberOfLines times.
+static Arcadia_ByteArray*
+createInput
+  (
+    Arcadia_Thread* thread,
+    char const* line
+  )
+{
+  Arcadia_SizeValue lineLength = strlen(line);
+  Arcadia_ByteArrayBuilder* builder = Arcadia_ByteArrayBuilder_create(thread);
+  for (Arcadia_SizeValue i = 0; i < NumberOfLines; ++i) {
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, builder, line, lineLength);
+  }
+  return Arcadia_ByteArray_createByteArray(thread, Arcadia_RuntimeByteArray_create(thread, Arcadia_ByteArrayBuilder_getBytes(thread, builder), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, builder)));
+}
+
+static void
+setUpDDLScanner
+  (
+    Arcadia_Thread* thread
+  )
+{
+  g_ddlInput = createInput(thread, DDLLine);
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_ddlInput);
+  g_ddlScanner = Arcadia_DDL_Scanner_create(thread, Arcadia_Languages_StringTable_getOrCreate(thread),
+                                            Arcadia_Languages_Diagnostics_create(thread, (Arcadia_Log*)Arcadia_ConsoleLog_create(thread)));
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_ddlScanner);
+}
+
+// Scan the DDL input.
+static void
+runDDLScanner
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_DDL_Scanner_setInputBytes(thread, g_ddlScanner, g_ddlInput);
+  while (Arcadia_DDL_WordType_EndOfInput != Arcadia_Languages_Scanner_getWordType(thread, (Arcadia_Languages_Scanner*)g_ddlScanner)) {
+    Arcadia_Languages_Scanner_step(thread, (Arcadia_Languages_Scanner*)g_ddlScanner);
+  }
+}
+
+static void
+tearDownDDLScanner
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Object_unlock(thread, (Arcadia_Object*)g_ddlScanner);
+  g_ddlScanner = NULL;
+  Arcadia_Object_unlock(thread, (Arcadia_Object*)g_ddlInput);
+  g_ddlInput = NULL;
+}
+
+static void
+setUpMILScanner
+  (
+    Arcadia_Thread* thread
+  )
+{
+  g_milInput = createInput(thread, MILLine);
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_milInput);
+  g_milContext = Arcadia_MILC_Context_create(thread);
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_milContext);
+}
+
+// Scan the MIL input.
+static void
+runMILScanner
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_MILC_Scanner* scanner = Arcadia_MILC_Scanner_create(thread, g_milContext);
+  Arcadia_Languages_Scanner_setInput(thread, (Arcadia_Languages_Scanner*)scanner, (Arcadia_UnicodeCodePointReader*)Arcadia_ByteReader_UnicodeCodePointReader_create(thread, (Arcadia_ByteReader*)Arcadia_ByteArray_ByteReader_create(thread, g_milInput)));
+  while (Arcadia_MILC_WordType_EndOfInput != Arcadia_Languages_Scanner_getWordType(thread, (Arcadia_Languages_Scanner*)scanner)) {
+    Arcadia_Languages_Scanner_step(thread, (Arcadia_Languages_Scanner*)scanner);
+  }
+}
+
+static void
+tearDownMILScanner
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Object_unlock(thread, (Arcadia_Object*)g_milContext);
+  g_milContext = NULL;
+  Arcadia_Object_unlock(thread, (Arcadia_Object*)g_milInput);
+  g_milInput = NULL;
+}
+
+// The operation of the scanner benchmarks is one Byte of input.
+static Arcadia_Benchmarks_Benchmark const g_benchmarks[] = {
+  { u8"DDL.Scanner", NumberOfLines * (sizeof(DDLLine) - 1), &setUpDDLScanner, &runDDLScanner, &tearDownDDLScanner },
+  { u8"MIL.Scanner", NumberOfLines * (sizeof(MILLine) - 1), &setUpMILScanner, &runMILScanner, &tearDownMILScanner },
+};
+
+Arcadia_Benchmarks_Benchmark const*
+Arcadia_Benchmarks_getScannersBenchmarks
+  (
+    Arcadia_SizeValue* numberOfBenchmarks
+  )
+{
+  *numberOfBenchmarks = sizeof(g_benchmarks) / sizeof(Arcadia_Benchmarks_Benchmark);
+  return g_benchmarks;
+}
@@ -0,0 +1,88 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/Benchmarks/Runtime/Benchmarks.h"
+
+// The number of insertions into the string builder.
+#define NumberOfInsertions (4096)
+
+// The number of strings created from the string builder.
+#define NumberOfStrings (256)
+
+// The string builder of String.create.
+static Arcadia_StringBuilder* g_stringBuilder = NULL;
+
+// Create a string builder and insert a short string at its back.
+static void
+runStringBuilderInsertBack
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_StringBuilder* stringBuilder = Arcadia_StringBuilder_create(thread);
+  for (Arcadia_SizeValue i = 0; i < NumberOfInsertions; ++i) {
+    Arcadia_StringBuilder_insertBackCxxString(thread, stringBuilder, u8"Hello, World!\n");
+  }
+}
+
+static void
+setUpStringCreate
+  (
+    Arcadia_Thread* thread
+  )
+{
+  g_stringBuilder = Arcadia_StringBuilder_create(thread);
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_stringBuilder);
+  for (Arcadia_SizeValue i = 0; i < 16; ++i) {
+    Arcadia_StringBuilder_insertBackCxxString(thread, g_stringBuilder, u8"Hello, World!\n");
+  }
+}
+
+// Create strings from the contents of a string builder.
+static void
+runStringCreate
+  (
+    Arcadia_Thread* thread
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < NumberOfStrings; ++i) {
+    Arcadia_String_create(thread, Arcadia_Value_makeObjectReferenceValue(g_stringBuilder));
+  }
+}
+
+static void
+tearDownStringCreate
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Object_unlock(thread, (Arcadia_Object*)g_stringBuilder);
+  g_stringBuilder = NULL;
+}
+
+static Arcadia_Benchmarks_Benchmark const g_benchmarks[] = {
+  { u8"StringBuilder.insertBack", NumberOfInsertions, NULL, &runStringBuilderInsertBack, NULL },
+  { u8"String.create", NumberOfStrings, &setUpStringCreate, &runStringCreate, &tearDownStringCreate },
+};
+
+Arcadia_Benchmarks_Benchmark const*
+Arcadia_Benchmarks_getStringsBenchmarks
+  (
+    Arcadia_SizeValue* numberOfBenchmarks
+  )
+{
+  *numberOfBenchmarks = sizeof(g_benchmarks) / sizeof(Arcadia_Benchmarks_Benchmark);
+  return g_benchmarks;
+}
@@ -44,6 +44,32 @@ Arcadia_Engine_Demo_AssetUtilities_enumerateFiles
   }
 }
 
+/// Mount an asset pack into a set of definitions if the asset pack exists.
+/// The definitions baked into the asset pack are created when they are first looked up.
+/// If the asset pack does not exist, the definitions are read from their text files.
+/// @param filePath The path of the asset pack.
+/// @param definitions The set of definitions to mount the asset pack into.
+static inline void
+Arcadia_Engine_Demo_AssetUtilities_mountPack
+  (
+    Arcadia_Thread* thread,
+    Arcadia_FilePath* filePath,
+    Arcadia_ADL_Definitions* definitions
+  )
+{
+  Arcadia_FileSystem* fileSystem = Arcadia_FileSystem_getOrCreate(thread);
+
+  if (Arcadia_FilePath_isRelative(thread, filePath)) {
+    Arcadia_FilePath* newFilePath = Arcadia_FileSystem_getWorkingDirectory(thread, fileSystem);
+    Arcadia_FilePath_append(thread, newFilePath, filePath);
+    filePath = newFilePath;
+  }
+
+  if (Arcadia_FileSystem_regularFileExists(thread, fileSystem, filePath)) {
+    Arcadia_ADL_Definitions_addPack(thread, definitions, Arcadia_ADL_Pack_createFromFile(thread, filePath));
+  }
+}
+
 static inline Arcadia_ADL_ColorDefinition*
 getColorDefinition
   (
@@ -130,10 +130,13 @@ main1
     newTick = oldTick;
     deltaTick = (newTick > oldTick) ? newTick - oldTick : 0;
     while (!Arcadia_Engine_Application_getQuitRequested(thread, (Arcadia_Engine_Application*)application)) {
+      Arcadia_Profiler_beginZone(thread, "frame");
       Arcadia_Process_stepARMS(process);
+      Arcadia_Profiler_beginZone(thread, "update");
       Arcadia_Engine_BackendContext_update(thread, (Arcadia_Engine_BackendContext*)((Arcadia_Engine_Application*)application)->engine->audialsBackendContext);
       Arcadia_Engine_BackendContext_update(thread, (Arcadia_Engine_BackendContext*)((Arcadia_Engine_Application*)application)->engine->visualsBackendContext);
       Arcadia_Engine_Demo_Scene_updateLogics(thread, Arcadia_Engine_Demo_SceneManager_getScene(thread, application->sceneManager), deltaTick);
+      Arcadia_Profiler_endZone(thread);
 
       for (Arcadia_SizeValue i = 0, n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)((Arcadia_Engine_Application*)application)->windows); i < n; ++i) {
         Arcadia_Engine_Visuals_Window* window =
@@ -145,6 +148,7 @@ main1
               i,
               _Arcadia_Engine_Visuals_Window_getType(thread)
             );
+        Arcadia_Profiler_beginZone(thread, "render");
         Arcadia_Engine_Visuals_Window_beginRender(thread, window);
         {
           Arcadia_Integer32Value width, height;
@@ -154,9 +158,12 @@ main1
           Arcadia_Engine_Demo_Scene_updateVisuals(thread, Arcadia_Engine_Demo_SceneManager_getScene(thread, application->sceneManager), deltaTick, width, height);
         }
         Arcadia_Engine_Visuals_Window_endRender(thread, window);
+        Arcadia_Profiler_endZone(thread);
       }
-      Arcadia_Engine_Event* event = Arcadia_Engine_dequeEvent(thread, ((Arcadia_Engine_Application*)application)->engine);
-      if (NULL != event) {
+      // Process all pending events.
+      Arcadia_Profiler_beginZone(thread, "events");
+      Arcadia_Engine_Event* event = NULL;
+      while (NULL != (event = Arcadia_Engine_dequeEvent(thread, ((Arcadia_Engine_Application*)application)->engine))) {
         if (Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)event, _Arcadia_Engine_Visuals_WindowClosedEvent_getType(thread))) {
           Arcadia_Engine_Visuals_WindowClosedEvent* windowClosedEvent = (Arcadia_Engine_Visuals_WindowClosedEvent*)event;
           Arcadia_Engine_Demo_Application_onWindowClosedEvent(thread, application, windowClosedEvent);
@@ -177,10 +184,23 @@ main1
           Arcadia_Engine_Demo_Scene_handleKeyboardKeyEvent(thread, scene, e);
         }
       }
+      Arcadia_Profiler_endZone(thread);
+    #if 1 == Arcadia_Configuration_Profiler_Enabled
+      Arcadia_MultiProducerQueue_Statistics eventQueueStatistics;
+      Arcadia_Engine_getEventQueueStatistics(thread, ((Arcadia_Engine_Application*)application)->engine, &eventQueueStatistics);
+      Arcadia_Profiler_setCounter(thread, "rejected events", (Arcadia_Integer64Value)eventQueueStatistics.numberOfRejectedElements);
+    #endif
       oldTick = newTick;
       newTick = Arcadia_getTickCount(thread);
       deltaTick = (newTick > oldTick) ? newTick - oldTick : 0;
+      Arcadia_Profiler_endZone(thread);
     }
+  #if 1 == Arcadia_Configuration_Profiler_Enabled
+    // Write the events recorded by the profiler to `Engine.Demo.trace.json`.
+    Arcadia_ByteArrayBuilder* trace = Arcadia_ByteArrayBuilder_create(thread);
+    Arcadia_Profiler_exportChromeTrace(thread, trace);
+    Arcadia_FileSystem_setFileContents(thread, Arcadia_FileSystem_getOrCreate(thread), Arcadia_FilePath_parseGeneric(thread, Arcadia_String_createFromCxxString(thread, u8"Engine.Demo.trace.json")), trace);
+  #endif
     Arcadia_Engine_Application_shutdown(thread, (Arcadia_Engine_Application*)application);
     Arcadia_Thread_popJumpTarget(thread);
     if (application) {
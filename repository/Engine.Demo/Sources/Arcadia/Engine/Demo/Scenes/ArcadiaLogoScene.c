@@ -117,6 +117,7 @@ Arcadia_Engine_Demo_ArcadiaLogoScene_construct
   self->modelNode = NULL;
   //
   self->definitions = Arcadia_ADL_Definitions_create(thread);
+  Arcadia_Engine_Demo_AssetUtilities_mountPack(thread, Arcadia_FilePath_parseGeneric(thread, Arcadia_String_createFromCxxString(thread, "Assets/LogoScene.apak")), self->definitions);
   //
   self->toLoad = (Arcadia_List*)Arcadia_ArrayList_create(thread);
   //
@@ -131,7 +131,8 @@ Arcadia_Engine_Demo_MainMenuScene_constructImpl
   //
   self->cameraNode = NULL;
   self->enterPassNode = NULL;
-  self->modelNode = NULL;
+  self->sceneNode = NULL;
+  self->temporary = Arcadia_Math_Matrix4Real32_create(thread);
   self->viewportNode = NULL;
   //
   self->soundSourceNode = NULL;
@@ -152,6 +153,7 @@ Arcadia_Engine_Demo_MainMenuScene_constructImpl
   Arcadia_Real32Value values[] = { +1.f, 0.f, 0.f };
   self->viewer.right = Arcadia_Math_Vector3Real32_createWithValues(thread, &values[0]);
   }
+  self->viewer.displacement = Arcadia_Math_Vector3Real32_create(thread);
   self->viewer.yaw = 0.f;
   self->viewer.pitch = 0.f;
   self->viewer.roll = 0.f;
@@ -201,6 +203,10 @@ Arcadia_Engine_Demo_MainMenuScene_visit
     Arcadia_Object_visit(thread, (Arcadia_Object*)self->cameraNode);
   }
 
+  if (self->temporary) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->temporary);
+  }
+
   if (self->viewer.forward) {
     Arcadia_Object_visit(thread, (Arcadia_Object*)self->viewer.forward);
   }
@@ -212,11 +218,13 @@ Arcadia_Engine_Demo_MainMenuScene_visit
   }
   if (self->viewer.position) {
     Arcadia_Object_visit(thread, (Arcadia_Object*)self->viewer.position);
-
+  }
+  if (self->viewer.displacement) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->viewer.displacement);
   }
 
-  if (self->modelNode) {
-    Arcadia_Object_visit(thread, (Arcadia_Object*)self->modelNode);
+  if (self->sceneNode) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->sceneNode);
   }
   if (self->viewportNode) {
     Arcadia_Object_visit(thread, (Arcadia_Object*)self->viewportNode);
@@ -236,6 +244,7 @@ load
 {
   if (!self->definitions) {
     Arcadia_ADL_Definitions* definitions = Arcadia_ADL_Definitions_create(thread);
+    Arcadia_Engine_Demo_AssetUtilities_mountPack(thread, Arcadia_FilePath_parseGeneric(thread, Arcadia_String_createFromCxxString(thread, "Assets/MainMenuScene.apak")), definitions);
     Arcadia_FileSystem* fileSystem = Arcadia_FileSystem_getOrCreate(thread);
     Arcadia_ADL_Context* context = Arcadia_ADL_Context_getOrCreate(thread);
     Arcadia_List* files = (Arcadia_List*)Arcadia_ArrayList_create(thread);
@@ -287,28 +296,6 @@ Arcadia_Engine_Demo_MainMenuScene_updateAudialsImpl
   }
 }
 
-static void
-Arcadia_Math_Matrix4x4Real32_transformDirection
-  (
-    Arcadia_Thread* thread,
-    Arcadia_Math_Matrix4Real32* self,
-    Arcadia_Math_Vector3Real32* direction
-  )
-{
-  direction->elements[0] = self->elements[0][0] * direction->elements[0]
-                         + self->elements[0][1] * direction->elements[1]
-                         + self->elements[0][2] * direction->elements[2]
-                         + self->elements[0][3] * 0.f;
-  direction->elements[1] = self->elements[1][0] * direction->elements[0]
-                         + self->elements[1][1] * direction->elements[1]
-                         + self->elements[1][2] * direction->elements[2]
-                         + self->elements[1][3] * 0.f;
-  direction->elements[2] = self->elements[2][0] * direction->elements[0]
-                         + self->elements[2][1] * direction->elements[1]
-                         + self->elements[2][2] * direction->elements[2]
-                         + self->elements[2][3] * 0.f;
-}
-
 static void
 Arcadia_Engine_Demo_MainMenuScene_updateLogicsImpl
   (
@@ -317,44 +304,35 @@ Arcadia_Engine_Demo_MainMenuScene_updateLogicsImpl
     Arcadia_Real64Value tick
   )
 {
-  Arcadia_Math_Matrix4Real32* rx = Arcadia_Math_Matrix4Real32_create(thread);
-  Arcadia_Math_Matrix4x4Real32Value_setRotationX(thread, rx, self->viewer.pitch);
-
-  Arcadia_Math_Matrix4Real32* ry = Arcadia_Math_Matrix4Real32_create(thread);
-  Arcadia_Math_Matrix4x4Real32Value_setRotationY(thread, ry, self->viewer.yaw);
-
-  Arcadia_Math_Matrix4Real32* tmp = Arcadia_Math_Matrix4Real32_multiply(thread, ry, rx);
-
-  Arcadia_Math_Vector3Real32* v = Arcadia_Math_Vector3Real32_create(thread);
-
+  // The rotation of the viewer is Ry*Rx.
+  Arcadia_Math_Matrix4x4Real32Value rx, ry;
+  Arcadia_Math_Matrix4x4Real32Value_setRotationXValue(thread, &rx, self->viewer.pitch);
+  Arcadia_Math_Matrix4x4Real32Value_setRotationYValue(thread, &ry, self->viewer.yaw);
+  Arcadia_Math_Matrix4x4Real32Value_multiply(thread, &ry, &ry, &rx);
+
+  // The direction of the movement in the space of the viewer.
+  Arcadia_Real32Value direction[] = { 0.f, 0.f, 0.f };
   if (self->latches[0]) {
     // 'W' / forward
-    Arcadia_Real32Value values[] = { 0.f, 0.f, -1.f };
-    Arcadia_Math_Vector3Real32* t = Arcadia_Math_Vector3Real32_createWithValues(thread, &values[0]);
-    Arcadia_Math_Matrix4x4Real32_transformDirection(thread, tmp, t);
-    Arcadia_Math_Vector3Real32_add(thread, v, t);
+    direction[2] -= 1.f;
   }
   if (self->latches[1]) {
     // 'A' / left
-    Arcadia_Real32Value values[] = { -1.f, 0.f, 0.f };
-    Arcadia_Math_Vector3Real32* t = Arcadia_Math_Vector3Real32_createWithValues(thread, &values[0]);
-    Arcadia_Math_Matrix4x4Real32_transformDirection(thread, tmp, t);
-    Arcadia_Math_Vector3Real32_add(thread, v, t);
+    direction[0] -= 1.f;
   }
   if (self->latches[2]) {
     // 'S' / backward
-    Arcadia_Real32Value values[] = { 0.f, 0.f, +1.f };
-    Arcadia_Math_Vector3Real32* t = Arcadia_Math_Vector3Real32_createWithValues(thread, &values[0]);
-    Arcadia_Math_Matrix4x4Real32_transformDirection(thread, tmp, t);
-    Arcadia_Math_Vector3Real32_add(thread, v, t);
+    direction[2] += 1.f;
   }
   if (self->latches[3]) {
     // 'D' / right
-    Arcadia_Real32Value values[] = { +1.f, 0.f, 0.f };
-    Arcadia_Math_Vector3Real32* t = Arcadia_Math_Vector3Real32_createWithValues(thread, &values[0]);
-    Arcadia_Math_Matrix4x4Real32_transformDirection(thread, tmp, t);
-    Arcadia_Math_Vector3Real32_add(thread, v, t);
+    direction[0] += 1.f;
   }
+  // The direction of the movement in world space.
+  Arcadia_Math_Matrix4x4Real32Value_transformDirections(thread, &ry, direction, sizeof(direction), direction, sizeof(direction), 1);
+
+  Arcadia_Math_Vector3Real32* v = self->viewer.displacement;
+  Arcadia_Math_Vector3Real32_setWithValues(thread, v, &direction[0]);
   if (Arcadia_Math_Vector3Real32_getSquaredLength(thread, v)) {
     Arcadia_Math_Vector3Real32_normalize(thread, v);
   }
@@ -401,10 +379,11 @@ Arcadia_Engine_Demo_MainMenuScene_updateVisualsImpl
   // Viewer located at (0,0,+1).
   // Variant #1: Perspective projection looking down the negative z-axis.
   // Variant #2: Orthographic projection looking down the negative z-axis.
-  Arcadia_Math_Matrix4Real32* viewToProjectionMatrix = Arcadia_Math_Matrix4Real32_create(thread);
-  Arcadia_Math_Matrix4x4Real32_setPerspectiveProjection(thread, viewToProjectionMatrix, 60.f, 4.f/3.f, 0.1f, 100.f);
-  //Arcadia_Math_Matrix4x4Real32_setOrthographicProjection(thread, viewToProjectionMatrix, -1, +1, -1, +1, -1, +1);
-  Arcadia_Engine_Visuals_CameraNode_setViewToProjectionMatrix(thread, self->cameraNode, viewToProjectionMatrix);
+  Arcadia_Math_Matrix4x4Real32Value viewToProjectionMatrix;
+  Arcadia_Math_Matrix4x4Real32Value_setPerspectiveProjection(thread, &viewToProjectionMatrix, 60.f, 4.f/3.f, 0.1f, 100.f);
+  //Arcadia_Math_Matrix4x4Real32Value_setOrthographicProjection(thread, &viewToProjectionMatrix, -1, +1, -1, +1, -1, +1);
+  Arcadia_Math_Matrix4Real32_setValue(thread, self->temporary, &viewToProjectionMatrix);
+  Arcadia_Engine_Visuals_CameraNode_setViewToProjectionMatrix(thread, self->cameraNode, self->temporary);
   // The transformation matrix M of the viewer is given by
   // M = (T*Ry)*Rx
   // where
@@ -416,34 +395,21 @@ Arcadia_Engine_Demo_MainMenuScene_updateVisualsImpl
   // = inv((T*Ry)*Rx)
   // = inv(Rx)*inv(T*Ry)
   // = inv(Rx)*(inv(Ry)*inv(T))
-  Arcadia_Math_Matrix4Real32* rx = Arcadia_Math_Matrix4Real32_create(thread);
-  Arcadia_Math_Matrix4x4Real32Value_setRotationX(thread, rx, -self->viewer.pitch);
-
-  Arcadia_Math_Matrix4Real32* ry = Arcadia_Math_Matrix4Real32_create(thread);
-  Arcadia_Math_Matrix4x4Real32Value_setRotationY(thread, ry, -self->viewer.yaw);
-
-  Arcadia_Math_Matrix4Real32* t = Arcadia_Math_Matrix4Real32_create(thread);
-  Arcadia_Math_Matrix4x4Real32Value_setTranslation(thread, t, -self->viewer.position->elements[0], -self->viewer.position->elements[1], -self->viewer.position->elements[2]);
-
-  Arcadia_Math_Matrix4Real32* tmp = Arcadia_Math_Matrix4Real32_multiply(thread, ry, t);
-  tmp = Arcadia_Math_Matrix4Real32_multiply(thread, rx, tmp);
-
-  Arcadia_Math_Matrix4Real32* worldToViewMatrix = tmp;
-  Arcadia_Engine_Visuals_CameraNode_setWorldToViewMatrix(thread, self->cameraNode, worldToViewMatrix);
-
-  Arcadia_ADL_ColorDefinition* CLEARCOLORS[] =
-    {
-      getColorDefinition(thread, self->definitions, Arcadia_String_createFromCxxString(thread, "Assets/Colors/CSS/Red.adl"),
-                                                    Arcadia_String_createFromCxxString(thread, "Colors.Red")),
-    };
-
-  Arcadia_ADL_ModelDefinition* MODELS[] =
-    {
-      getModelDefinition(thread, self->definitions, Arcadia_String_createFromCxxString(thread, "Assets/MainMenuScene/TextureColorModel.adl"),
-                                                    Arcadia_String_createFromCxxString(thread, "MainMenuScene.TextureColorModel")),
-    };
+  Arcadia_Math_Matrix4x4Real32Value rx, ry, worldToViewMatrix;
+  Arcadia_Math_Matrix4x4Real32Value_setRotationXValue(thread, &rx, -self->viewer.pitch);
+  Arcadia_Math_Matrix4x4Real32Value_setRotationYValue(thread, &ry, -self->viewer.yaw);
+  Arcadia_Math_Matrix4x4Real32Value_setTranslationValue(thread, &worldToViewMatrix, -self->viewer.position->elements[0], -self->viewer.position->elements[1], -self->viewer.position->elements[2]);
+  Arcadia_Math_Matrix4x4Real32Value_multiply(thread, &worldToViewMatrix, &ry, &worldToViewMatrix);
+  Arcadia_Math_Matrix4x4Real32Value_multiply(thread, &worldToViewMatrix, &rx, &worldToViewMatrix);
+  Arcadia_Math_Matrix4Real32_setValue(thread, self->temporary, &worldToViewMatrix);
+  Arcadia_Engine_Visuals_CameraNode_setWorldToViewMatrix(thread, self->cameraNode, self->temporary);
 
   if (!self->viewportNode) {
+    Arcadia_ADL_ColorDefinition* CLEARCOLORS[] =
+      {
+        getColorDefinition(thread, self->definitions, Arcadia_String_createFromCxxString(thread, "Assets/Colors/CSS/Red.adl"),
+                                                      Arcadia_String_createFromCxxString(thread, "Colors.Red")),
+      };
     Arcadia_ADL_ColorDefinition* d = CLEARCOLORS[0];
     self->viewportNode =
       (Arcadia_Engine_Visuals_ViewportNode*)
@@ -459,29 +425,61 @@ Arcadia_Engine_Demo_MainMenuScene_updateVisualsImpl
 
   Arcadia_Engine_Visuals_ViewportNode_setCanvasSize(thread, self->viewportNode, width, height);
 
-  if (!self->modelNode) {
-    Arcadia_ADL_ModelDefinition* modelDefinition = MODELS[0];
-    if (NULL == modelDefinition) {
-      Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
-      Arcadia_Thread_jump(thread);
-    }
-    Arcadia_ADL_Definition_link(thread, (Arcadia_ADL_Definition*)modelDefinition);
-    self->modelNode =
-      (Arcadia_Engine_Visuals_ModelNode*)
-      Arcadia_Engine_Visuals_NodeFactory_createModelNode
+  if (!self->sceneNode) {
+    Arcadia_ADL_ModelDefinition* MODELS[] =
+      {
+        getModelDefinition(thread, self->definitions, Arcadia_String_createFromCxxString(thread, "Assets/MainMenuScene/TextureColorModel.adl"),
+                                                      Arcadia_String_createFromCxxString(thread, "MainMenuScene.TextureColorModel")),
+        getModelDefinition(thread, self->definitions, Arcadia_String_createFromCxxString(thread, "Assets/MainMenuScene/MeshColorModel.adl"),
+                                                      Arcadia_String_createFromCxxString(thread, "MainMenuScene.MeshColorModel")),
+        getModelDefinition(thread, self->definitions, Arcadia_String_createFromCxxString(thread, "Assets/MainMenuScene/VertexColorModel.adl"),
+                                                      Arcadia_String_createFromCxxString(thread, "MainMenuScene.VertexColorModel")),
+      };
+    // The texture color model is at the origin.
+    // The mesh color model and the vertex color model are left and right of it and further away from the viewer.
+    static const Arcadia_Real32Value TRANSLATIONS[][3] = {
+      {  0.00f, 0.f,  0.f },
+      { -1.25f, 0.f, -2.f },
+      { +1.25f, 0.f, -2.f },
+    };
+    Arcadia_Engine_Visuals_SceneNode* sceneNode =
+      Arcadia_Engine_Visuals_SceneNode_create
         (
           thread,
-          (Arcadia_Engine_Visuals_NodeFactory*)engine->visualsNodeFactory,
-          (Arcadia_Engine_Visuals_BackendContext*)engine->visualsBackendContext,
-          modelDefinition
+          (Arcadia_Engine_Visuals_BackendContext*)engine->visualsBackendContext
         );
+    Arcadia_SizeValue root = Arcadia_SizeValue_Maximum;
+    for (Arcadia_SizeValue i = 0; i < sizeof(MODELS) / sizeof(MODELS[0]); ++i) {
+      Arcadia_ADL_ModelDefinition* modelDefinition = MODELS[i];
+      if (NULL == modelDefinition) {
+        Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+        Arcadia_Thread_jump(thread);
+      }
+      Arcadia_ADL_Definition_link(thread, (Arcadia_ADL_Definition*)modelDefinition);
+      Arcadia_Engine_Visuals_ModelNode* modelNode =
+        Arcadia_Engine_Visuals_NodeFactory_createModelNode
+          (
+            thread,
+            (Arcadia_Engine_Visuals_NodeFactory*)engine->visualsNodeFactory,
+            (Arcadia_Engine_Visuals_BackendContext*)engine->visualsBackendContext,
+            modelDefinition
+          );
+      Arcadia_SizeValue index = Arcadia_Engine_Visuals_SceneNode_addModelNode(thread, sceneNode, root, modelNode);
+      Arcadia_Math_Matrix4x4Real32Value localToParentMatrix;
+      Arcadia_Math_Matrix4x4Real32Value_setTranslationValue(thread, &localToParentMatrix, TRANSLATIONS[i][0], TRANSLATIONS[i][1], TRANSLATIONS[i][2]);
+      Arcadia_Engine_Visuals_SceneNode_setLocalToParentMatrix(thread, sceneNode, index, &localToParentMatrix);
+      if (Arcadia_SizeValue_Maximum == root) {
+        root = index;
+      }
+    }
+    self->sceneNode = sceneNode;
   }
   Arcadia_Engine_Visuals_ViewportNode_setCanvasSize(thread, self->viewportNode, width, height);
   // Assign the "viewport" node and "camera" node to the "enter pass" node.
   Arcadia_Engine_Visuals_EnterPassNode_setViewportNode(thread, self->enterPassNode, self->viewportNode);
   Arcadia_Engine_Visuals_EnterPassNode_setCameraNode(thread, self->enterPassNode, self->cameraNode);
-  // Render the models.
-  Arcadia_Engine_Visuals_renderScene(thread, self->enterPassNode, self->modelNode, (Arcadia_Engine_Visuals_BackendContext*)engine->visualsBackendContext);
+  // Cull, sort, and render the models.
+  Arcadia_Engine_Visuals_renderSceneNode(thread, self->enterPassNode, self->sceneNode, (Arcadia_Engine_Visuals_BackendContext*)engine->visualsBackendContext);
 }
 
 static void
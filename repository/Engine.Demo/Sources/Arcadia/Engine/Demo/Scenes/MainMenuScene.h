@@ -39,9 +39,12 @@ struct Arcadia_Engine_Demo_MainMenuScene {
   Arcadia_Engine_Visuals_CameraNode* cameraNode;
   // A single context, re-update with the information for the respective viewport / model combination for rendering.
   Arcadia_Engine_Visuals_EnterPassNode* enterPassNode;
+  // Temporary used to pass matrices to the camera node.
+  Arcadia_Math_Matrix4Real32* temporary;
 
-  // The models, thee of them.
-  Arcadia_Engine_Visuals_ModelNode* modelNode;
+  // The models, three of them.
+  // The texture color model is the root, the mesh color model and the vertex color model are its children.
+  Arcadia_Engine_Visuals_SceneNode* sceneNode;
 
   // The 'W', 'A', 'S', and 'D' latches.
   Arcadia_BooleanValue latches[4];
@@ -68,6 +71,9 @@ struct Arcadia_Engine_Demo_MainMenuScene {
     /// The position of the viewer.
     Arcadia_Math_Vector3Real32* position;
 
+    /// The displacement of the viewer in the current update.
+    Arcadia_Math_Vector3Real32* displacement;
+
     /// "pitch" is the angle, in degrees, of a counter-clockwise rotation of the camera around its local x-axis
     /// The initial value is @a 0.
     Arcadia_Real32Value pitch;
@@ -128,6 +128,8 @@ Arcadia_Engine_Demo_MainScene_constructImpl
   }
   //
   self->definitions = Arcadia_ADL_Definitions_create(thread);
+  Arcadia_Engine_Demo_AssetUtilities_mountPack(thread, Arcadia_FilePath_parseGeneric(thread, Arcadia_String_createFromCxxString(thread, "Assets/MainScene.apak")), self->definitions);
+  Arcadia_Engine_Demo_AssetUtilities_mountPack(thread, Arcadia_FilePath_parseGeneric(thread, Arcadia_String_createFromCxxString(thread, "Assets/LogoScene.apak")), self->definitions);
   //
   self->cameraNode = NULL;
   self->enterPassNode = NULL;
@@ -481,15 +481,24 @@ Arcadia_MILC_CompilationTask_run
     moduleNode->moduleDirectoryPath = Arcadia_FilePath_clone(thread, moduleDirectoryPath);
     Arcadia_List_insertBackObjectReferenceValue(thread, self->context->moduleNodes, moduleNode);
   }
+  Arcadia_Profiler_beginZone(thread, "Arcadia_MILC_CompilationTask_run");
   // (1)
+  Arcadia_Profiler_beginZone(thread, "step1");
   step1(thread, self);
+  Arcadia_Profiler_endZone(thread);
   // (2)
+  Arcadia_Profiler_beginZone(thread, "step2");
   step2(thread, self);
+  Arcadia_Profiler_endZone(thread);
   // (3)
+  Arcadia_Profiler_beginZone(thread, "step3");
   step3(thread, self);
+  Arcadia_Profiler_endZone(thread);
   // (4) Enter the top-level symbols (classes, enumerations, procedures, modules).
   self->context->enterPhase = self->context->enterPhase ? self->context->enterPhase : Arcadia_MILC_EnterPhase_create(thread, self->context);
+  Arcadia_Profiler_beginZone(thread, "Arcadia_MILC_EnterPhase_run");
   Arcadia_MILC_EnterPhase_run(thread, self->context->enterPhase);
+  Arcadia_Profiler_endZone(thread);
   // (5) Enter the member-level symbols (constructors, methods, fields, enumeration elements).
   // This must be deferred because types are resolved.
   self->context->memberEnterPhase = self->context->memberEnterPhase ? self->context->memberEnterPhase : Arcadia_MILC_MemberEnterPhase_create(thread, self->context);
@@ -503,6 +512,7 @@ Arcadia_MILC_CompilationTask_run
   }
   Arcadia_Log_information(thread, self->context->log, Arcadia_String_create(thread, Arcadia_Value_makeObjectReferenceValue(stringBuffer)));
 #endif
+  Arcadia_Profiler_endZone(thread);
   //
   Arcadia_Languages_Diagnostics_emit(thread, self->context->diagnostics);
   if (Arcadia_Languages_Diagnostics_hasErrors(thread, self->context->diagnostics)) {
@@ -168,6 +168,8 @@ R_executeProcedure
     R_Interpreter_Procedure* procedure
   )
 {
+  Arcadia_Profiler_beginZone(Arcadia_Process_getThread(process), "R_executeProcedure");
   R_Interpreter_ThreadState_beginProcedureCall(process, R_Interpreter_ProcessState_getMainThread(interpreterProcess), 0, procedure);
   execute(process, interpreterProcess);
+  Arcadia_Profiler_endZone(Arcadia_Process_getThread(process));
 }
@@ -0,0 +1,185 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/Math/Include.h"
+#include "Arcadia/Benchmarks/Harness/Driver.h"
+
+// The number of scene nodes.
+#define NumberOfNodes (1000)
+
+// The number of vertices of the mesh of each scene node.
+#define NumberOfVertices (24)
+
+// The model-to-world matrices of the scene nodes.
+static Arcadia_Math_Matrix4x4Real32Value g_localMatrices[NumberOfNodes];
+
+// The vertices of the mesh.
+static Arcadia_Real32Value g_vertices[NumberOfVertices][3];
+
+// The transformed vertices.
+static Arcadia_Real32Value g_transformedVertices[NumberOfVertices][3];
+
+// The index of the frame.
+static Arcadia_SizeValue g_frame = 0;
+
+// The matrix objects of the allocating benchmark.
+static Arcadia_Math_Matrix4Real32* g_worldToView = NULL;
+static Arcadia_Math_Matrix4Real32* g_localToWorld = NULL;
+
+// Prevent the compiler from removing the computation of the transformed vertices.
+static volatile Arcadia_Real32Value g_sink = 0.f;
+
+static void
+setUp
+  (
+    Arcadia_Thread* thread
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < NumberOfNodes; ++i) {
+    Arcadia_Math_Matrix4x4Real32Value_setRotationYValue(thread, &g_localMatrices[i], (Arcadia_Real32Value)(i % 360));
+    g_localMatrices[i].elements[0][3] = (Arcadia_Real32Value)(i % 17);
+    g_localMatrices[i].elements[2][3] = (Arcadia_Real32Value)(i % 13);
+  }
+  for (Arcadia_SizeValue i = 0; i < NumberOfVertices; ++i) {
+    g_vertices[i][0] = (i & 1) ? +1.f : -1.f;
+    g_vertices[i][1] = (i & 2) ? +1.f : -1.f;
+    g_vertices[i][2] = (i & 4) ? +1.f : -1.f;
+  }
+  g_frame = 0;
+}
+
+static void
+setUpAllocating
+  (
+    Arcadia_Thread* thread
+  )
+{
+  setUp(thread);
+  g_worldToView = Arcadia_Math_Matrix4Real32_create(thread);
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_worldToView);
+  g_localToWorld = Arcadia_Math_Matrix4Real32_create(thread);
+  Arcadia_Object_lock(thread, (Arcadia_Object*)g_localToWorld);
+}
+
+static void
+tearDownAllocating
+  (
+    Arcadia_Thread* thread
+  )
+{
+  if (g_localToWorld) {
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)g_localToWorld);
+    g_localToWorld = NULL;
+  }
+  if (g_worldToView) {
+    Arcadia_Object_unlock(thread, (Arcadia_Object*)g_worldToView);
+    g_worldToView = NULL;
+  }
+}
+
+static void
+setWorldToViewMatrix
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4x4Real32Value* target,
+    Arcadia_SizeValue frame
+  )
+{
+  Arcadia_Math_Matrix4x4Real32Value_setRotationXValue(thread, target, (Arcadia_Real32Value)(frame % 360));
+  target->elements[2][3] = -10.f;
+}
+
+// Compute the model-to-view matrices of one frame by Arcadia_Math_Matrix4Real32_multiply.
+// This allocates one matrix per node.
+static void
+runAllocating
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Math_Matrix4x4Real32Value worldToViewValue;
+  Arcadia_Real32Value sink = 0.f;
+  setWorldToViewMatrix(thread, &worldToViewValue, g_frame++);
+  Arcadia_Math_Matrix4Real32_setValue(thread, g_worldToView, &worldToViewValue);
+  for (Arcadia_SizeValue i = 0; i < NumberOfNodes; ++i) {
+    Arcadia_Math_Matrix4Real32_setValue(thread, g_localToWorld, &g_localMatrices[i]);
+    Arcadia_Math_Matrix4Real32* m = Arcadia_Math_Matrix4Real32_multiply(thread, g_worldToView, g_localToWorld);
+    for (Arcadia_SizeValue j = 0; j < NumberOfVertices; ++j) {
+      Arcadia_Real32Value const* p = g_vertices[j];
+      for (Arcadia_SizeValue k = 0; k < 3; ++k) {
+        g_transformedVertices[j][k] = m->elements[k][0] * p[0] + m->elements[k][1] * p[1] + m->elements[k][2] * p[2] + m->elements[k][3];
+      }
+    }
+    sink += g_transformedVertices[0][0];
+  }
+  g_sink = sink;
+}
+
+// Compute the model-to-view matrices of one frame by Arcadia_Math_Matrix4x4Real32Value_multiply and
+// transform the vertices by Arcadia_Math_Matrix4x4Real32Value_transformPoints.
+// This does not allocate.
+static void
+runValues
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Process* process = Arcadia_Thread_getProcess(thread);
+  Arcadia_Process_Statistics before, after;
+  Arcadia_Process_getStatistics(process, &before);
+  Arcadia_Math_Matrix4x4Real32Value worldToView, localToView;
+  Arcadia_Real32Value sink = 0.f;
+  setWorldToViewMatrix(thread, &worldToView, g_frame++);
+  for (Arcadia_SizeValue i = 0; i < NumberOfNodes; ++i) {
+    Arcadia_Math_Matrix4x4Real32Value_multiply(thread, &localToView, &worldToView, &g_localMatrices[i]);
+    Arcadia_Math_Matrix4x4Real32Value_transformPoints(thread, &localToView, g_transformedVertices, sizeof(g_transformedVertices[0]),
+                                                      g_vertices, sizeof(g_vertices[0]), NumberOfVertices);
+    sink += g_transformedVertices[0][0];
+  }
+  g_sink = sink;
+  Arcadia_Process_getStatistics(process, &after);
+  if (after.numberOfAllocatedObjects != before.numberOfAllocatedObjects) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_TestFailed);
+    Arcadia_Thread_jump(thread);
+  }
+}
+
+// One operation is one scene node. One repetition is one frame.
+static Arcadia_Benchmarks_Benchmark const g_benchmarks[] = {
+  { u8"allocating", NumberOfNodes, &setUpAllocating, &runAllocating, &tearDownAllocating },
+  { u8"values", NumberOfNodes, &setUp, &runValues, NULL },
+};
+
+static Arcadia_Benchmarks_Benchmark const*
+getBenchmarks
+  (
+    Arcadia_SizeValue* numberOfBenchmarks
+  )
+{
+  *numberOfBenchmarks = sizeof(g_benchmarks) / sizeof(Arcadia_Benchmarks_Benchmark);
+  return g_benchmarks;
+}
+
+static Arcadia_Benchmarks_GetBenchmarks* const g_groups[] = {
+  &getBenchmarks,
+};
+
+int
+main
+  (
+    int argc,
+    char** argv
+  )
+{ return Arcadia_Benchmarks_main(argc, argv, g_groups, sizeof(g_groups) / sizeof(Arcadia_Benchmarks_GetBenchmarks*)); }
@@ -39,6 +39,11 @@
     <tr><td><code>Real64Value</code>         </td><td><code>Arcadia_Real64Value</code></td></tr>
   </table>
 
+  <p>
+  <code>Arcadia_Math_Matrix4x4Real32Value_setRotationZValue</code> is the variant of this function for <code>Arcadia_Math_Matrix4x4Real32Value</code> structs.
+  It writes the elements of the struct directly instead of going through a matrix object.
+  </p>
+
   </my-summary>
 
   <section class="cxx parameters">
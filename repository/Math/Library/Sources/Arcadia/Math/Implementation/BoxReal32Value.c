@@ -0,0 +1,88 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/Math/Implementation/BoxReal32Value.h"
+
+#include <string.h>
+
+void
+Arcadia_Math_BoxReal32Value_setFromPoints
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_BoxReal32Value* target,
+    void const* points,
+    Arcadia_SizeValue stride,
+    Arcadia_SizeValue numberOfPoints
+  )
+{
+  if (!numberOfPoints) {
+    for (Arcadia_SizeValue i = 0; i < 3; ++i) {
+      target->minimum[i] = 0.f;
+      target->maximum[i] = 0.f;
+    }
+    return;
+  }
+  Arcadia_Natural8Value const* s = (Arcadia_Natural8Value const*)points;
+  Arcadia_Real32Value p[3];
+  memcpy(p, s, sizeof(p));
+  Arcadia_Real32Value minimum[3] = { p[0], p[1], p[2] },
+                      maximum[3] = { p[0], p[1], p[2] };
+  s += stride;
+  for (Arcadia_SizeValue i = 1; i < numberOfPoints; ++i) {
+    memcpy(p, s, sizeof(p));
+    for (Arcadia_SizeValue j = 0; j < 3; ++j) {
+      minimum[j] = p[j] < minimum[j] ? p[j] : minimum[j];
+      maximum[j] = p[j] > maximum[j] ? p[j] : maximum[j];
+    }
+    s += stride;
+  }
+  for (Arcadia_SizeValue i = 0; i < 3; ++i) {
+    target->minimum[i] = minimum[i];
+    target->maximum[i] = maximum[i];
+  }
+}
+
+void
+Arcadia_Math_BoxReal32Value_transform
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_BoxReal32Value* target,
+    Arcadia_Math_BoxReal32Value const* source,
+    Arcadia_Math_Matrix4x4Real32Value const* matrix
+  )
+{
+  // J. Arvo, "Transforming Axis-Aligned Bounding Boxes", Graphics Gems, 1990.
+  // Start with the translation and add, per row, the smaller and the larger contribution of each axis.
+  Arcadia_Real32Value minimum[3], maximum[3];
+  for (Arcadia_SizeValue i = 0; i < 3; ++i) {
+    minimum[i] = matrix->elements[i][3];
+    maximum[i] = matrix->elements[i][3];
+    for (Arcadia_SizeValue j = 0; j < 3; ++j) {
+      Arcadia_Real32Value a = matrix->elements[i][j] * source->minimum[j],
+                          b = matrix->elements[i][j] * source->maximum[j];
+      if (a < b) {
+        minimum[i] += a;
+        maximum[i] += b;
+      } else {
+        minimum[i] += b;
+        maximum[i] += a;
+      }
+    }
+  }
+  for (Arcadia_SizeValue i = 0; i < 3; ++i) {
+    target->minimum[i] = minimum[i];
+    target->maximum[i] = maximum[i];
+  }
+}
@@ -0,0 +1,66 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_MATH_IMPLEMENTATION_BOXREAL32VALUE_H_INCLUDED)
+#define ARCADIA_MATH_IMPLEMENTATION_BOXREAL32VALUE_H_INCLUDED
+
+#include "Arcadia/Math/Implementation/Matrix4x4Real32Value.h"
+
+/// @brief An axis-aligned box of Arcadia_Real32Value values.
+/// This is a plain value which is not managed by the garbage collector.
+/// The box contains the points (x, y, z) with @code{minimum[i] <= p[i] <= maximum[i]}.
+typedef struct Arcadia_Math_BoxReal32Value {
+  Arcadia_Real32Value minimum[3];
+  Arcadia_Real32Value maximum[3];
+} Arcadia_Math_BoxReal32Value;
+
+/// @brief Assign the target box the smallest box containing the specified points.
+/// @param thread A pointer to this thread.
+/// @param target A pointer to the target box.
+/// @param points A pointer to the first point.
+/// @param stride The distance, in Bytes, between two consecutive points.
+/// @param numberOfPoints The number of points.
+/// @remarks
+/// A point consists of three consecutive Arcadia_Real32Value values (x, y, z), for example, the position of a vertex in a vertex array.
+/// The points are not required to be aligned.
+/// If the number of points is zero, the target box is assigned the box containing only the origin.
+void
+Arcadia_Math_BoxReal32Value_setFromPoints
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_BoxReal32Value* target,
+    void const* points,
+    Arcadia_SizeValue stride,
+    Arcadia_SizeValue numberOfPoints
+  );
+
+/// @brief Assign the target box the smallest box containing the source box transformed by the specified matrix.
+/// @param thread A pointer to this thread.
+/// @param target A pointer to the target box.
+/// @param source A pointer to the source box.
+/// @param matrix A pointer to the matrix.
+/// @remarks
+/// The matrix is meant to be an affine transformation.
+/// @a target and @a source may refer to the same box.
+void
+Arcadia_Math_BoxReal32Value_transform
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_BoxReal32Value* target,
+    Arcadia_Math_BoxReal32Value const* source,
+    Arcadia_Math_Matrix4x4Real32Value const* matrix
+  );
+
+#endif // ARCADIA_MATH_IMPLEMENTATION_BOXREAL32VALUE_H_INCLUDED
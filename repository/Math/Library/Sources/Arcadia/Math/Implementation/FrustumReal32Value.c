@@ -0,0 +1,88 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/Math/Implementation/FrustumReal32Value.h"
+
+#include <math.h>
+
+void
+Arcadia_Math_FrustumReal32Value_setFromMatrix
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_FrustumReal32Value* target,
+    Arcadia_Math_Matrix4x4Real32Value const* matrix
+  )
+{
+  // A point p is visible if -w <= x, y, z <= +w where (x, y, z, w) = M * p.
+  // That is, row3 . p + row_i . p >= 0 and row3 . p - row_i . p >= 0 for i = 0, 1, 2.
+  for (Arcadia_SizeValue i = 0; i < 3; ++i) {
+    for (Arcadia_SizeValue j = 0; j < 4; ++j) {
+      target->planes[2 * i + 0][j] = matrix->elements[3][j] + matrix->elements[i][j];
+      target->planes[2 * i + 1][j] = matrix->elements[3][j] - matrix->elements[i][j];
+    }
+  }
+  for (Arcadia_SizeValue i = 0; i < 6; ++i) {
+    Arcadia_Real32Value length = sqrtf(target->planes[i][0] * target->planes[i][0]
+                                     + target->planes[i][1] * target->planes[i][1]
+                                     + target->planes[i][2] * target->planes[i][2]);
+    if (length > 0.f) {
+      for (Arcadia_SizeValue j = 0; j < 4; ++j) {
+        target->planes[i][j] /= length;
+      }
+    }
+  }
+}
+
+Arcadia_BooleanValue
+Arcadia_Math_FrustumReal32Value_intersectsSphere
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_FrustumReal32Value const* self,
+    Arcadia_Math_SphereReal32Value const* sphere
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < 6; ++i) {
+    Arcadia_Real32Value distance = self->planes[i][0] * sphere->center[0]
+                                 + self->planes[i][1] * sphere->center[1]
+                                 + self->planes[i][2] * sphere->center[2]
+                                 + self->planes[i][3];
+    if (distance < -sphere->radius) {
+      return Arcadia_BooleanValue_False;
+    }
+  }
+  return Arcadia_BooleanValue_True;
+}
+
+Arcadia_BooleanValue
+Arcadia_Math_FrustumReal32Value_intersectsBox
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_FrustumReal32Value const* self,
+    Arcadia_Math_BoxReal32Value const* box
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < 6; ++i) {
+    // The corner of the box farthest along the normal of the plane.
+    // If that corner is in the negative half-space, then the entire box is.
+    Arcadia_Real32Value distance = self->planes[i][3];
+    for (Arcadia_SizeValue j = 0; j < 3; ++j) {
+      distance += self->planes[i][j] * (self->planes[i][j] >= 0.f ? box->maximum[j] : box->minimum[j]);
+    }
+    if (distance < 0.f) {
+      return Arcadia_BooleanValue_False;
+    }
+  }
+  return Arcadia_BooleanValue_True;
+}
@@ -0,0 +1,78 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_MATH_IMPLEMENTATION_FRUSTUMREAL32VALUE_H_INCLUDED)
+#define ARCADIA_MATH_IMPLEMENTATION_FRUSTUMREAL32VALUE_H_INCLUDED
+
+#include "Arcadia/Math/Implementation/BoxReal32Value.h"
+#include "Arcadia/Math/Implementation/SphereReal32Value.h"
+
+/// @brief A view frustum of Arcadia_Real32Value values.
+/// This is a plain value which is not managed by the garbage collector.
+/// The frustum is the intersection of the positive half-spaces of six planes (left, right, bottom, top, near, far).
+/// The plane @code{planes[i]} is given by (a, b, c, d) such that a point (x, y, z) is in its positive half-space if @code{a * x + b * y + c * z + d >= 0}.
+/// The normal (a, b, c) of each plane is of unit length.
+typedef struct Arcadia_Math_FrustumReal32Value {
+  Arcadia_Real32Value planes[6][4];
+} Arcadia_Math_FrustumReal32Value;
+
+/// @brief Assign the target frustum the frustum of the specified matrix.
+/// @param thread A pointer to this thread.
+/// @param target A pointer to the target frustum.
+/// @param matrix A pointer to the matrix.
+/// @remarks
+/// The matrix maps points to clip space, the visible points satisfying @code{-w <= x, y, z <= +w}.
+/// For example, @code{viewToProjection * worldToView} yields the frustum in world space,
+/// @code{viewToProjection * worldToView * localToWorld} yields the frustum in the local space of a model.
+/// The planes are extracted as described by G. Gribb and K. Hartmann, "Fast Extraction of Viewing Frustum Planes from the World-View-Projection Matrix", 2001.
+void
+Arcadia_Math_FrustumReal32Value_setFromMatrix
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_FrustumReal32Value* target,
+    Arcadia_Math_Matrix4x4Real32Value const* matrix
+  );
+
+/// @brief Get if a sphere intersects with or is contained in this frustum.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this frustum.
+/// @param sphere A pointer to the sphere.
+/// @return #Arcadia_BooleanValue_False if the sphere is certainly outside of this frustum. #Arcadia_BooleanValue_True otherwise.
+/// @remarks
+/// The test is conservative: Spheres close to the edges of the frustum may be reported as intersecting even though they are outside.
+Arcadia_BooleanValue
+Arcadia_Math_FrustumReal32Value_intersectsSphere
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_FrustumReal32Value const* self,
+    Arcadia_Math_SphereReal32Value const* sphere
+  );
+
+/// @brief Get if a box intersects with or is contained in this frustum.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this frustum.
+/// @param box A pointer to the box.
+/// @return #Arcadia_BooleanValue_False if the box is certainly outside of this frustum. #Arcadia_BooleanValue_True otherwise.
+/// @remarks
+/// The test is conservative: Boxes close to the edges of the frustum may be reported as intersecting even though they are outside.
+Arcadia_BooleanValue
+Arcadia_Math_FrustumReal32Value_intersectsBox
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_FrustumReal32Value const* self,
+    Arcadia_Math_BoxReal32Value const* box
+  );
+
+#endif // ARCADIA_MATH_IMPLEMENTATION_FRUSTUMREAL32VALUE_H_INCLUDED
@@ -0,0 +1,439 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/Math/Implementation/Matrix4x4Real32Value.h"
+
+#include <string.h>
+
+#if Arcadia_Configuration_InstructionSetArchitecture == Arcadia_Configuration_InstructionSetArchitecture_X64
+  #include <emmintrin.h>
+  #define Arcadia_Math_Matrix4x4Real32Value_WithSSE2 (1)
+  #define Arcadia_Math_Matrix4x4Real32Value_WithNEON (0)
+#elif defined(__ARM_NEON)
+  #include <arm_neon.h>
+  #define Arcadia_Math_Matrix4x4Real32Value_WithSSE2 (0)
+  #define Arcadia_Math_Matrix4x4Real32Value_WithNEON (1)
+#else
+  #define Arcadia_Math_Matrix4x4Real32Value_WithSSE2 (0)
+  #define Arcadia_Math_Matrix4x4Real32Value_WithNEON (0)
+#endif
+
+#if 1 == Arcadia_Math_Matrix4x4Real32Value_WithSSE2
+
+#define Shuffle(a, b, x, y, z, w) _mm_shuffle_ps((a), (b), _MM_SHUFFLE((w), (z), (y), (x)))
+#define Swizzle(a, x, y, z, w) Shuffle(a, a, x, y, z, w)
+#define Broadcast(a, x) Swizzle(a, x, x, x, x)
+
+// A 2x2 matrix is stored in a __m128 in row-major order (e00, e01, e10, e11).
+// Compute A * B.
+static inline __m128
+mul2x2
+  (
+    __m128 a,
+    __m128 b
+  )
+{
+  return _mm_add_ps(_mm_mul_ps(a, Swizzle(b, 0, 3, 0, 3)),
+                    _mm_mul_ps(Swizzle(a, 1, 0, 3, 2), Swizzle(b, 2, 1, 2, 1)));
+}
+
+// Compute adj(A) * B.
+static inline __m128
+adjMul2x2
+  (
+    __m128 a,
+    __m128 b
+  )
+{
+  return _mm_sub_ps(_mm_mul_ps(Swizzle(a, 3, 3, 0, 0), b),
+                    _mm_mul_ps(Swizzle(a, 1, 1, 2, 2), Swizzle(b, 2, 3, 0, 1)));
+}
+
+// Compute A * adj(B).
+static inline __m128
+mulAdj2x2
+  (
+    __m128 a,
+    __m128 b
+  )
+{
+  return _mm_sub_ps(_mm_mul_ps(a, Swizzle(b, 3, 0, 3, 0)),
+                    _mm_mul_ps(Swizzle(a, 1, 0, 3, 2), Swizzle(b, 2, 1, 2, 1)));
+}
+
+#endif
+
+void
+Arcadia_Math_Matrix4x4Real32Value_setIdentity
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4x4Real32Value* target
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+    for (Arcadia_SizeValue j = 0; j < 4; ++j) {
+      target->elements[i][j] = i == j ? 1.f : 0.f;
+    }
+  }
+}
+
+void
+Arcadia_Math_Matrix4x4Real32Value_multiply
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4x4Real32Value* target,
+    Arcadia_Math_Matrix4x4Real32Value const* a,
+    Arcadia_Math_Matrix4x4Real32Value const* b
+  )
+{
+#if 1 == Arcadia_Math_Matrix4x4Real32Value_WithSSE2
+  // The i-th row of the product is the linear combination of the rows of b with the i-th row of a as coefficients.
+  __m128 b0 = _mm_loadu_ps(b->elements[0]),
+         b1 = _mm_loadu_ps(b->elements[1]),
+         b2 = _mm_loadu_ps(b->elements[2]),
+         b3 = _mm_loadu_ps(b->elements[3]);
+  __m128 a0 = _mm_loadu_ps(a->elements[0]),
+         a1 = _mm_loadu_ps(a->elements[1]),
+         a2 = _mm_loadu_ps(a->elements[2]),
+         a3 = _mm_loadu_ps(a->elements[3]);
+  __m128 r[4];
+  __m128 const rows[4] = { a0, a1, a2, a3 };
+  for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+    __m128 t = _mm_mul_ps(Broadcast(rows[i], 0), b0);
+    t = _mm_add_ps(t, _mm_mul_ps(Broadcast(rows[i], 1), b1));
+    t = _mm_add_ps(t, _mm_mul_ps(Broadcast(rows[i], 2), b2));
+    t = _mm_add_ps(t, _mm_mul_ps(Broadcast(rows[i], 3), b3));
+    r[i] = t;
+  }
+  _mm_storeu_ps(target->elements[0], r[0]);
+  _mm_storeu_ps(target->elements[1], r[1]);
+  _mm_storeu_ps(target->elements[2], r[2]);
+  _mm_storeu_ps(target->elements[3], r[3]);
+#elif 1 == Arcadia_Math_Matrix4x4Real32Value_WithNEON
+  float32x4_t b0 = vld1q_f32(b->elements[0]),
+              b1 = vld1q_f32(b->elements[1]),
+              b2 = vld1q_f32(b->elements[2]),
+              b3 = vld1q_f32(b->elements[3]);
+  float32x4_t r[4];
+  for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+    float32x4_t t = vmulq_n_f32(b0, a->elements[i][0]);
+    t = vmlaq_n_f32(t, b1, a->elements[i][1]);
+    t = vmlaq_n_f32(t, b2, a->elements[i][2]);
+    t = vmlaq_n_f32(t, b3, a->elements[i][3]);
+    r[i] = t;
+  }
+  vst1q_f32(target->elements[0], r[0]);
+  vst1q_f32(target->elements[1], r[1]);
+  vst1q_f32(target->elements[2], r[2]);
+  vst1q_f32(target->elements[3], r[3]);
+#else
+  Arcadia_Math_Matrix4x4Real32Value r;
+  for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+    for (Arcadia_SizeValue j = 0; j < 4; ++j) {
+      r.elements[i][j] = a->elements[i][0] * b->elements[0][j]
+                       + a->elements[i][1] * b->elements[1][j]
+                       + a->elements[i][2] * b->elements[2][j]
+                       + a->elements[i][3] * b->elements[3][j];
+    }
+  }
+  *target = r;
+#endif
+}
+
+void
+Arcadia_Math_Matrix4x4Real32Value_transpose
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4x4Real32Value* target,
+    Arcadia_Math_Matrix4x4Real32Value const* source
+  )
+{
+#if 1 == Arcadia_Math_Matrix4x4Real32Value_WithSSE2
+  __m128 r0 = _mm_loadu_ps(source->elements[0]),
+         r1 = _mm_loadu_ps(source->elements[1]),
+         r2 = _mm_loadu_ps(source->elements[2]),
+         r3 = _mm_loadu_ps(source->elements[3]);
+  _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+  _mm_storeu_ps(target->elements[0], r0);
+  _mm_storeu_ps(target->elements[1], r1);
+  _mm_storeu_ps(target->elements[2], r2);
+  _mm_storeu_ps(target->elements[3], r3);
+#elif 1 == Arcadia_Math_Matrix4x4Real32Value_WithNEON
+  // De-interleaving load: the i-th register receives the i-th column.
+  float32x4x4_t c = vld4q_f32(&source->elements[0][0]);
+  vst1q_f32(target->elements[0], c.val[0]);
+  vst1q_f32(target->elements[1], c.val[1]);
+  vst1q_f32(target->elements[2], c.val[2]);
+  vst1q_f32(target->elements[3], c.val[3]);
+#else
+  Arcadia_Math_Matrix4x4Real32Value r;
+  for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+    for (Arcadia_SizeValue j = 0; j < 4; ++j) {
+      r.elements[i][j] = source->elements[j][i];
+    }
+  }
+  *target = r;
+#endif
+}
+
+Arcadia_BooleanValue
+Arcadia_Math_Matrix4x4Real32Value_invert
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4x4Real32Value* target,
+    Arcadia_Math_Matrix4x4Real32Value const* source
+  )
+{
+#if 1 == Arcadia_Math_Matrix4x4Real32Value_WithSSE2
+  // Block-wise inversion: the matrix is partitioned into the 2x2 matrices
+  // A B
+  // C D
+  // and the inverse is computed from the adjugates and determinants of these.
+  __m128 r0 = _mm_loadu_ps(source->elements[0]),
+         r1 = _mm_loadu_ps(source->elements[1]),
+         r2 = _mm_loadu_ps(source->elements[2]),
+         r3 = _mm_loadu_ps(source->elements[3]);
+  __m128 A = _mm_movelh_ps(r0, r1),
+         B = _mm_movehl_ps(r1, r0),
+         C = _mm_movelh_ps(r2, r3),
+         D = _mm_movehl_ps(r3, r2);
+  // The determinants of A, B, C, and D.
+  __m128 detSub = _mm_sub_ps(_mm_mul_ps(Shuffle(r0, r2, 0, 2, 0, 2), Shuffle(r1, r3, 1, 3, 1, 3)),
+                             _mm_mul_ps(Shuffle(r0, r2, 1, 3, 1, 3), Shuffle(r1, r3, 0, 2, 0, 2)));
+  __m128 detA = Broadcast(detSub, 0),
+         detB = Broadcast(detSub, 1),
+         detC = Broadcast(detSub, 2),
+         detD = Broadcast(detSub, 3);
+
+  __m128 DC = adjMul2x2(D, C);
+  __m128 AB = adjMul2x2(A, B);
+  __m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), mul2x2(B, DC));
+  __m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), mul2x2(C, AB));
+  __m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), mulAdj2x2(D, AB));
+  __m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), mulAdj2x2(A, DC));
+
+  // det(M) = det(A) det(D) + det(B) det(C) - tr(adj(A) B adj(D) C).
+  __m128 detM = _mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC));
+  __m128 tr = _mm_mul_ps(AB, Swizzle(DC, 0, 2, 1, 3));
+  tr = _mm_add_ps(tr, Swizzle(tr, 2, 3, 0, 1));
+  tr = _mm_add_ps(tr, Swizzle(tr, 1, 0, 3, 2));
+  detM = _mm_sub_ps(detM, tr);
+  if (0.f == _mm_cvtss_f32(detM)) {
+    return Arcadia_BooleanValue_False;
+  }
+  __m128 rDetM = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), detM);
+  X = _mm_mul_ps(X, rDetM);
+  Y = _mm_mul_ps(Y, rDetM);
+  Z = _mm_mul_ps(Z, rDetM);
+  W = _mm_mul_ps(W, rDetM);
+
+  _mm_storeu_ps(target->elements[0], Shuffle(X, Y, 3, 1, 3, 1));
+  _mm_storeu_ps(target->elements[1], Shuffle(X, Y, 2, 0, 2, 0));
+  _mm_storeu_ps(target->elements[2], Shuffle(Z, W, 3, 1, 3, 1));
+  _mm_storeu_ps(target->elements[3], Shuffle(Z, W, 2, 0, 2, 0));
+  return Arcadia_BooleanValue_True;
+#else
+  // Cofactor expansion.
+  Arcadia_Real32Value const* m = &source->elements[0][0];
+  Arcadia_Real32Value inv[16];
+
+  inv[0] = m[5] * m[10] * m[15] - m[5] * m[11] * m[14] - m[9] * m[6] * m[15]
+         + m[9] * m[7] * m[14] + m[13] * m[6] * m[11] - m[13] * m[7] * m[10];
+  inv[4] = -m[4] * m[10] * m[15] + m[4] * m[11] * m[14] + m[8] * m[6] * m[15]
+         - m[8] * m[7] * m[14] - m[12] * m[6] * m[11] + m[12] * m[7] * m[10];
+  inv[8] = m[4] * m[9] * m[15] - m[4] * m[11] * m[13] - m[8] * m[5] * m[15]
+         + m[8] * m[7] * m[13] + m[12] * m[5] * m[11] - m[12] * m[7] * m[9];
+  inv[12] = -m[4] * m[9] * m[14] + m[4] * m[10] * m[13] + m[8] * m[5] * m[14]
+          - m[8] * m[6] * m[13] - m[12] * m[5] * m[10] + m[12] * m[6] * m[9];
+  inv[1] = -m[1] * m[10] * m[15] + m[1] * m[11] * m[14] + m[9] * m[2] * m[15]
+         - m[9] * m[3] * m[14] - m[13] * m[2] * m[11] + m[13] * m[3] * m[10];
+  inv[5] = m[0] * m[10] * m[15] - m[0] * m[11] * m[14] - m[8] * m[2] * m[15]
+         + m[8] * m[3] * m[14] + m[12] * m[2] * m[11] - m[12] * m[3] * m[10];
+  inv[9] = -m[0] * m[9] * m[15] + m[0] * m[11] * m[13] + m[8] * m[1] * m[15]
+         - m[8] * m[3] * m[13] - m[12] * m[1] * m[11] + m[12] * m[3] * m[9];
+  inv[13] = m[0] * m[9] * m[14] - m[0] * m[10] * m[13] - m[8] * m[1] * m[14]
+          + m[8] * m[2] * m[13] + m[12] * m[1] * m[10] - m[12] * m[2] * m[9];
+  inv[2] = m[1] * m[6] * m[15] - m[1] * m[7] * m[14] - m[5] * m[2] * m[15]
+         + m[5] * m[3] * m[14] + m[13] * m[2] * m[7] - m[13] * m[3] * m[6];
+  inv[6] = -m[0] * m[6] * m[15] + m[0] * m[7] * m[14] + m[4] * m[2] * m[15]
+         - m[4] * m[3] * m[14] - m[12] * m[2] * m[7] + m[12] * m[3] * m[6];
+  inv[10] = m[0] * m[5] * m[15] - m[0] * m[7] * m[13] - m[4] * m[1] * m[15]
+          + m[4] * m[3] * m[13] + m[12] * m[1] * m[7] - m[12] * m[3] * m[5];
+  inv[14] = -m[0] * m[5] * m[14] + m[0] * m[6] * m[13] + m[4] * m[1] * m[14]
+          - m[4] * m[2] * m[13] - m[12] * m[1] * m[6] + m[12] * m[2] * m[5];
+  inv[3] = -m[1] * m[6] * m[11] + m[1] * m[7] * m[10] + m[5] * m[2] * m[11]
+         - m[5] * m[3] * m[10] - m[9] * m[2] * m[7] + m[9] * m[3] * m[6];
+  inv[7] = m[0] * m[6] * m[11] - m[0] * m[7] * m[10] - m[4] * m[2] * m[11]
+         + m[4] * m[3] * m[10] + m[8] * m[2] * m[7] - m[8] * m[3] * m[6];
+  inv[11] = -m[0] * m[5] * m[11] + m[0] * m[7] * m[9] + m[4] * m[1] * m[11]
+          - m[4] * m[3] * m[9] - m[8] * m[1] * m[7] + m[8] * m[3] * m[5];
+  inv[15] = m[0] * m[5] * m[10] - m[0] * m[6] * m[9] - m[4] * m[1] * m[10]
+          + m[4] * m[2] * m[9] + m[8] * m[1] * m[6] - m[8] * m[2] * m[5];
+
+  Arcadia_Real32Value det = m[0] * inv[0] + m[1] * inv[4] + m[2] * inv[8] + m[3] * inv[12];
+  if (0.f == det) {
+    return Arcadia_BooleanValue_False;
+  }
+  det = 1.f / det;
+  for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+    for (Arcadia_SizeValue j = 0; j < 4; ++j) {
+      target->elements[i][j] = inv[i * 4 + j] * det;
+    }
+  }
+  return Arcadia_BooleanValue_True;
+#endif
+}
+
+void
+Arcadia_Math_Matrix4x4Real32Value_transformPoints
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4x4Real32Value const* self,
+    void* target,
+    Arcadia_SizeValue targetStride,
+    void const* source,
+    Arcadia_SizeValue sourceStride,
+    Arcadia_SizeValue numberOfPoints
+  )
+{
+  Arcadia_Natural8Value* t = (Arcadia_Natural8Value*)target;
+  Arcadia_Natural8Value const* s = (Arcadia_Natural8Value const*)source;
+#if 1 == Arcadia_Math_Matrix4x4Real32Value_WithSSE2
+  // The result is x * c0 + y * c1 + z * c2 + c3 where ci is the i-th column of the matrix.
+  __m128 c0 = _mm_loadu_ps(self->elements[0]),
+         c1 = _mm_loadu_ps(self->elements[1]),
+         c2 = _mm_loadu_ps(self->elements[2]),
+         c3 = _mm_loadu_ps(self->elements[3]);
+  _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+  for (Arcadia_SizeValue i = 0; i < numberOfPoints; ++i) {
+    Arcadia_Real32Value p[3];
+    memcpy(p, s, sizeof(p));
+    __m128 r = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(p[0]), c0), c3);
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(p[1]), c1));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(p[2]), c2));
+    _mm_storel_pi((__m64*)t, r);
+    _mm_store_ss((float*)(t + 2 * sizeof(Arcadia_Real32Value)), _mm_movehl_ps(r, r));
+    t += targetStride;
+    s += sourceStride;
+  }
+#elif 1 == Arcadia_Math_Matrix4x4Real32Value_WithNEON
+  float32x4x4_t c = vld4q_f32(&self->elements[0][0]);
+  for (Arcadia_SizeValue i = 0; i < numberOfPoints; ++i) {
+    Arcadia_Real32Value p[3];
+    memcpy(p, s, sizeof(p));
+    float32x4_t r = vmlaq_n_f32(c.val[3], c.val[0], p[0]);
+    r = vmlaq_n_f32(r, c.val[1], p[1]);
+    r = vmlaq_n_f32(r, c.val[2], p[2]);
+    float32_t q[4];
+    vst1q_f32(q, r);
+    memcpy(t, q, sizeof(p));
+    t += targetStride;
+    s += sourceStride;
+  }
+#else
+  for (Arcadia_SizeValue i = 0; i < numberOfPoints; ++i) {
+    Arcadia_Real32Value p[3], q[3];
+    memcpy(p, s, sizeof(p));
+    for (Arcadia_SizeValue j = 0; j < 3; ++j) {
+      q[j] = self->elements[j][0] * p[0] + self->elements[j][1] * p[1] + self->elements[j][2] * p[2] + self->elements[j][3];
+    }
+    memcpy(t, q, sizeof(q));
+    t += targetStride;
+    s += sourceStride;
+  }
+#endif
+}
+
+void
+Arcadia_Math_Matrix4x4Real32Value_transformDirections
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4x4Real32Value const* self,
+    void* target,
+    Arcadia_SizeValue targetStride,
+    void const* source,
+    Arcadia_SizeValue sourceStride,
+    Arcadia_SizeValue numberOfDirections
+  )
+{
+  Arcadia_Natural8Value* t = (Arcadia_Natural8Value*)target;
+  Arcadia_Natural8Value const* s = (Arcadia_Natural8Value const*)source;
+#if 1 == Arcadia_Math_Matrix4x4Real32Value_WithSSE2
+  // The result is x * c0 + y * c1 + z * c2 where ci is the i-th column of the matrix.
+  __m128 c0 = _mm_loadu_ps(self->elements[0]),
+         c1 = _mm_loadu_ps(self->elements[1]),
+         c2 = _mm_loadu_ps(self->elements[2]),
+         c3 = _mm_loadu_ps(self->elements[3]);
+  _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+  for (Arcadia_SizeValue i = 0; i < numberOfDirections; ++i) {
+    Arcadia_Real32Value p[3];
+    memcpy(p, s, sizeof(p));
+    __m128 r = _mm_mul_ps(_mm_set1_ps(p[0]), c0);
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(p[1]), c1));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(p[2]), c2));
+    _mm_storel_pi((__m64*)t, r);
+    _mm_store_ss((float*)(t + 2 * sizeof(Arcadia_Real32Value)), _mm_movehl_ps(r, r));
+    t += targetStride;
+    s += sourceStride;
+  }
+#elif 1 == Arcadia_Math_Matrix4x4Real32Value_WithNEON
+  float32x4x4_t c = vld4q_f32(&self->elements[0][0]);
+  for (Arcadia_SizeValue i = 0; i < numberOfDirections; ++i) {
+    Arcadia_Real32Value p[3];
+    memcpy(p, s, sizeof(p));
+    float32x4_t r = vmulq_n_f32(c.val[0], p[0]);
+    r = vmlaq_n_f32(r, c.val[1], p[1]);
+    r = vmlaq_n_f32(r, c.val[2], p[2]);
+    float32_t q[4];
+    vst1q_f32(q, r);
+    memcpy(t, q, sizeof(p));
+    t += targetStride;
+    s += sourceStride;
+  }
+#else
+  for (Arcadia_SizeValue i = 0; i < numberOfDirections; ++i) {
+    Arcadia_Real32Value p[3], q[3];
+    memcpy(p, s, sizeof(p));
+    for (Arcadia_SizeValue j = 0; j < 3; ++j) {
+      q[j] = self->elements[j][0] * p[0] + self->elements[j][1] * p[1] + self->elements[j][2] * p[2];
+    }
+    memcpy(t, q, sizeof(q));
+    t += targetStride;
+    s += sourceStride;
+  }
+#endif
+}
+
+void
+Arcadia_Math_Matrix4Real32_getValue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4Real32* self,
+    Arcadia_Math_Matrix4x4Real32Value* target
+  )
+{
+  memcpy(target->elements, self->elements, sizeof(target->elements));
+}
+
+void
+Arcadia_Math_Matrix4Real32_setValue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4Real32* self,
+    Arcadia_Math_Matrix4x4Real32Value const* source
+  )
+{
+  memcpy(self->elements, source->elements, sizeof(self->elements));
+}
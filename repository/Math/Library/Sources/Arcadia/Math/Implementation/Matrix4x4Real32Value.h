@@ -0,0 +1,166 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_MATH_IMPLEMENTATION_MATRIX4X4REAL32VALUE_H_INCLUDED)
+#define ARCADIA_MATH_IMPLEMENTATION_MATRIX4X4REAL32VALUE_H_INCLUDED
+
+#include "Arcadia/Math/Implementation/Matrix4Real32.h"
+
+/// @brief A 4x4 matrix of Arcadia_Real32Value values.
+/// In contrast to Arcadia_Math_Matrix4Real32, this is a plain value which is not managed by the garbage collector.
+/// It can be placed on the stack, in arrays, or in other structures.
+/// The element @code{elements[i][j]} is the element in the i-th row and the j-th column.
+/// Vectors are column vectors, that is, the matrix is the left operand of a matrix-vector product.
+/// @remarks
+/// The operations on values of this type do not allocate.
+/// Where available, they use SSE2 (x64) or NEON kernels with a scalar fallback.
+typedef struct Arcadia_Math_Matrix4x4Real32Value {
+  Arcadia_Real32Value elements[4][4];
+} Arcadia_Math_Matrix4x4Real32Value;
+
+/// @brief Assign the target matrix the values of an identity matrix.
+/// @param thread A pointer to this thread.
+/// @param target A pointer to the target matrix.
+void
+Arcadia_Math_Matrix4x4Real32Value_setIdentity
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4x4Real32Value* target
+  );
+
+/// @brief Compute the product of two matrices and assign the result to the target matrix.
+/// @param thread A pointer to this thread.
+/// @param target A pointer to the target matrix.
+/// @param a A pointer to the first factor.
+/// @param b A pointer to the second factor.
+/// @remarks @a target, @a a, and @a b may refer to the same matrix.
+/// @post The target matrix was assigned the product @code{a * b}.
+void
+Arcadia_Math_Matrix4x4Real32Value_multiply
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4x4Real32Value* target,
+    Arcadia_Math_Matrix4x4Real32Value const* a,
+    Arcadia_Math_Matrix4x4Real32Value const* b
+  );
+
+/// @brief Compute the transpose of a matrix and assign the result to the target matrix.
+/// @param thread A pointer to this thread.
+/// @param target A pointer to the target matrix.
+/// @param source A pointer to the source matrix.
+/// @remarks @a target and @a source may refer to the same matrix.
+/// @post The target matrix was assigned the transpose of the source matrix.
+void
+Arcadia_Math_Matrix4x4Real32Value_transpose
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4x4Real32Value* target,
+    Arcadia_Math_Matrix4x4Real32Value const* source
+  );
+
+/// @brief Compute the inverse of a matrix and assign the result to the target matrix.
+/// @param thread A pointer to this thread.
+/// @param target A pointer to the target matrix.
+/// @param source A pointer to the source matrix.
+/// @return #Arcadia_BooleanValue_True if the source matrix is invertible. #Arcadia_BooleanValue_False otherwise.
+/// @remarks @a target and @a source may refer to the same matrix.
+/// @post
+/// If the source matrix is invertible, then the target matrix was assigned the inverse of the source matrix.
+/// Otherwise the target matrix was not modified.
+Arcadia_BooleanValue
+Arcadia_Math_Matrix4x4Real32Value_invert
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4x4Real32Value* target,
+    Arcadia_Math_Matrix4x4Real32Value const* source
+  );
+
+/// @brief Transform an array of points by this matrix.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this matrix.
+/// @param target A pointer to the first target point.
+/// @param targetStride The distance, in Bytes, between two consecutive target points.
+/// @param source A pointer to the first source point.
+/// @param sourceStride The distance, in Bytes, between two consecutive source points.
+/// @param numberOfPoints The number of points.
+/// @remarks
+/// A point consists of three consecutive Arcadia_Real32Value values (x, y, z), for example, the position of a vertex in a vertex array.
+/// Each point is transformed as the column vector (x, y, z, 1).
+/// The fourth component of the result is discarded, that is, this function is meant for affine transformations.
+/// The points are not required to be aligned.
+/// The source points and the target points may be the same points.
+void
+Arcadia_Math_Matrix4x4Real32Value_transformPoints
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4x4Real32Value const* self,
+    void* target,
+    Arcadia_SizeValue targetStride,
+    void const* source,
+    Arcadia_SizeValue sourceStride,
+    Arcadia_SizeValue numberOfPoints
+  );
+
+/// @brief Transform directions by a matrix.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this matrix.
+/// @param target A pointer to the first target direction.
+/// @param targetStride The distance, in Bytes, between two consecutive target directions.
+/// @param source A pointer to the first source direction.
+/// @param sourceStride The distance, in Bytes, between two consecutive source directions.
+/// @param numberOfDirections The number of directions.
+/// @remarks
+/// A direction consists of three consecutive Arcadia_Real32Value values (x, y, z).
+/// Each direction is transformed as the column vector (x, y, z, 0), that is, the translation of the matrix does not apply.
+/// The fourth component of the result is discarded.
+/// The directions are not required to be aligned.
+/// The source directions and the target directions may be the same directions.
+void
+Arcadia_Math_Matrix4x4Real32Value_transformDirections
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4x4Real32Value const* self,
+    void* target,
+    Arcadia_SizeValue targetStride,
+    void const* source,
+    Arcadia_SizeValue sourceStride,
+    Arcadia_SizeValue numberOfDirections
+  );
+
+/// @brief Assign the values of this matrix to the target matrix value.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this matrix.
+/// @param target A pointer to the target matrix value.
+void
+Arcadia_Math_Matrix4Real32_getValue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4Real32* self,
+    Arcadia_Math_Matrix4x4Real32Value* target
+  );
+
+/// @brief Assign the values of the source matrix value to this matrix.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this matrix.
+/// @param source A pointer to the source matrix value.
+void
+Arcadia_Math_Matrix4Real32_setValue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4Real32* self,
+    Arcadia_Math_Matrix4x4Real32Value const* source
+  );
+
+#endif // ARCADIA_MATH_IMPLEMENTATION_MATRIX4X4REAL32VALUE_H_INCLUDED
@@ -0,0 +1,35 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/Math/Implementation/SphereReal32Value.h"
+
+#include <math.h>
+
+void
+Arcadia_Math_SphereReal32Value_setFromBox
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_SphereReal32Value* target,
+    Arcadia_Math_BoxReal32Value const* source
+  )
+{
+  Arcadia_Real32Value squaredLength = 0.f;
+  for (Arcadia_SizeValue i = 0; i < 3; ++i) {
+    Arcadia_Real32Value d = source->maximum[i] - source->minimum[i];
+    squaredLength += d * d;
+    target->center[i] = source->minimum[i] + 0.5f * d;
+  }
+  target->radius = 0.5f * sqrtf(squaredLength);
+}
@@ -0,0 +1,41 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_MATH_IMPLEMENTATION_SPHEREREAL32VALUE_H_INCLUDED)
+#define ARCADIA_MATH_IMPLEMENTATION_SPHEREREAL32VALUE_H_INCLUDED
+
+#include "Arcadia/Math/Implementation/BoxReal32Value.h"
+
+/// @brief A sphere of Arcadia_Real32Value values.
+/// This is a plain value which is not managed by the garbage collector.
+typedef struct Arcadia_Math_SphereReal32Value {
+  Arcadia_Real32Value center[3];
+  Arcadia_Real32Value radius;
+} Arcadia_Math_SphereReal32Value;
+
+/// @brief Assign the target sphere the smallest sphere containing the specified box.
+/// @param thread A pointer to this thread.
+/// @param target A pointer to the target sphere.
+/// @param source A pointer to the box.
+/// @post The center of the target sphere is the center of the box and its radius is half of the length of the diagonal of the box.
+void
+Arcadia_Math_SphereReal32Value_setFromBox
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_SphereReal32Value* target,
+    Arcadia_Math_BoxReal32Value const* source
+  );
+
+#endif // ARCADIA_MATH_IMPLEMENTATION_SPHEREREAL32VALUE_H_INCLUDED
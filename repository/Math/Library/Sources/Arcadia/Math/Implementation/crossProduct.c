@@ -48,3 +48,43 @@ Arcadia_Math_Vector3Real64_crossProduct
   };
   return Arcadia_Math_Vector3Real64_createWithValues(thread, values);
 }
+
+void
+Arcadia_Math_Vector3Real32_setCrossProduct
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Vector3Real32* self,
+    Arcadia_Math_Vector3Real32* u,
+    Arcadia_Math_Vector3Real32* v
+  )
+{
+  Arcadia_Real32Value values[] =
+    {
+      u->elements[1] * v->elements[2] - u->elements[2] * v->elements[1],
+      u->elements[2] * v->elements[0] - u->elements[0] * v->elements[2],
+      u->elements[0] * v->elements[1] - u->elements[1] * v->elements[0],
+    };
+  self->elements[0] = values[0];
+  self->elements[1] = values[1];
+  self->elements[2] = values[2];
+}
+
+void
+Arcadia_Math_Vector3Real64_setCrossProduct
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Vector3Real64* self,
+    Arcadia_Math_Vector3Real64* u,
+    Arcadia_Math_Vector3Real64* v
+  )
+{
+  Arcadia_Real64Value values[] =
+  {
+    u->elements[1] * v->elements[2] - u->elements[2] * v->elements[1],
+    u->elements[2] * v->elements[0] - u->elements[0] * v->elements[2],
+    u->elements[0] * v->elements[1] - u->elements[1] * v->elements[0],
+  };
+  self->elements[0] = values[0];
+  self->elements[1] = values[1];
+  self->elements[2] = values[2];
+}
@@ -42,6 +42,29 @@ Arcadia_Math_Vector3Real64_crossProduct
     Arcadia_Math_Vector3Real64* v
   );
 
+/// @brief Compute the cross product of two vectors and assign the result to this vector.
+/// @param self A pointer to this vector.
+/// @param u The first vector.
+/// @param v The other vector.
+/// @remarks @a self, @a u, and @a v may refer to the same object.
+void
+Arcadia_Math_Vector3Real32_setCrossProduct
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Vector3Real32* self,
+    Arcadia_Math_Vector3Real32* u,
+    Arcadia_Math_Vector3Real32* v
+  );
+
+void
+Arcadia_Math_Vector3Real64_setCrossProduct
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Vector3Real64* self,
+    Arcadia_Math_Vector3Real64* u,
+    Arcadia_Math_Vector3Real64* v
+  );
+
 /// @}
 
 #endif // ARCADIA_MATH_IMPLEMENTATION_CROSSPRODUCT_H_INCLUDE
@@ -16,10 +16,10 @@
 #include "Arcadia/Math/Implementation/setOrthographicProjection.h"
 
 void
-Arcadia_Math_Matrix4x4Real32_setOrthographicProjection
+Arcadia_Math_Matrix4x4Real32Value_setOrthographicProjection
   (
     Arcadia_Thread* thread,
-    Arcadia_Math_Matrix4Real32* self,
+    Arcadia_Math_Matrix4x4Real32Value* self,
     Arcadia_Real32Value left,
     Arcadia_Real32Value right,
     Arcadia_Real32Value bottom,
@@ -56,6 +56,24 @@ Arcadia_Math_Matrix4x4Real32_setOrthographicProjection
   self->elements[3][3] = 1.f;
 }
 
+void
+Arcadia_Math_Matrix4x4Real32_setOrthographicProjection
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4Real32* self,
+    Arcadia_Real32Value left,
+    Arcadia_Real32Value right,
+    Arcadia_Real32Value bottom,
+    Arcadia_Real32Value top,
+    Arcadia_Real64Value near,
+    Arcadia_Real64Value far
+  )
+{
+  Arcadia_Math_Matrix4x4Real32Value value;
+  Arcadia_Math_Matrix4x4Real32Value_setOrthographicProjection(thread, &value, left, right, bottom, top, near, far);
+  Arcadia_Math_Matrix4Real32_setValue(thread, self, &value);
+}
+
 void
 Arcadia_Math_Matrix4x4Real64_setOrthographicProjection
   (
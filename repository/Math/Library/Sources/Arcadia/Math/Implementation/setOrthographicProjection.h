@@ -16,7 +16,7 @@
 #if !defined(ARCADIA_MATH_IMPLEMENTATION_SETORTHOGRAPHICPROJECTION_H_INCLUDED)
 #define ARCADIA_MATH_IMPLEMENTATION_SETORTHOGRAPHICPROJECTION_H_INCLUDED
 
-#include "Arcadia/Math/Implementation/Matrix4Real32.h"
+#include "Arcadia/Math/Implementation/Matrix4x4Real32Value.h"
 #include "Arcadia/Math/Implementation/Matrix4Real64.h"
 
 #pragma push_macro("near")
@@ -26,6 +26,19 @@
 #undef far
 
 // https://michaelheilmann.com/Arcadia/Math/#Arcadia_Math_Matrix*x**_setOrthographicProjection
+void
+Arcadia_Math_Matrix4x4Real32Value_setOrthographicProjection
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4x4Real32Value* self,
+    Arcadia_Real32Value left,
+    Arcadia_Real32Value right,
+    Arcadia_Real32Value bottom,
+    Arcadia_Real32Value top,
+    Arcadia_Real64Value near,
+    Arcadia_Real64Value far
+  );
+
 void
 Arcadia_Math_Matrix4x4Real32_setOrthographicProjection
   (
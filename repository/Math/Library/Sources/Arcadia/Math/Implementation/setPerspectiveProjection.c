@@ -18,10 +18,10 @@
 #include "Arcadia/Math/Implementation/trigonometry.h"
 
 void
-Arcadia_Math_Matrix4x4Real32_setPerspectiveProjection
+Arcadia_Math_Matrix4x4Real32Value_setPerspectiveProjection
   (
     Arcadia_Thread* thread,
-    Arcadia_Math_Matrix4Real32* self,
+    Arcadia_Math_Matrix4x4Real32Value* self,
     Arcadia_Real32Value fieldOfView,
     Arcadia_Real32Value aspectRatio,
     Arcadia_Real32Value near,
@@ -52,6 +52,22 @@ Arcadia_Math_Matrix4x4Real32_setPerspectiveProjection
   self->elements[3][3] = 0.f;
 }
 
+void
+Arcadia_Math_Matrix4x4Real32_setPerspectiveProjection
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4Real32* self,
+    Arcadia_Real32Value fieldOfView,
+    Arcadia_Real32Value aspectRatio,
+    Arcadia_Real32Value near,
+    Arcadia_Real32Value far
+  )
+{
+  Arcadia_Math_Matrix4x4Real32Value value;
+  Arcadia_Math_Matrix4x4Real32Value_setPerspectiveProjection(thread, &value, fieldOfView, aspectRatio, near, far);
+  Arcadia_Math_Matrix4Real32_setValue(thread, self, &value);
+}
+
 void
 Arcadia_Math_Matrix4x4Real64_setPerspectiveProjection
   (
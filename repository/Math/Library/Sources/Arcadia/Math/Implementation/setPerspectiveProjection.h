@@ -16,7 +16,7 @@
 #if !defined(ARCADIA_MATH_IMPLEMENTATION_SETPERSPECTIVEPROJECTION_H_INCLUDED)
 #define ARCADIA_MATH_IMPLEMENTATION_SETPERSPECTIVEPROJECTION_H_INCLUDED
 
-#include "Arcadia/Math/Implementation/Matrix4Real32.h"
+#include "Arcadia/Math/Implementation/Matrix4x4Real32Value.h"
 #include "Arcadia/Math/Implementation/Matrix4Real64.h"
 
 #pragma push_macro("near")
@@ -26,6 +26,17 @@
 #undef far
 
 // https://michaelheilmann.com/Arcadia/Math/#Arcadia_Math_Matrix*x**_setPerspectiveProjection
+void
+Arcadia_Math_Matrix4x4Real32Value_setPerspectiveProjection
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4x4Real32Value* self,
+    Arcadia_Real32Value fieldOfView,
+    Arcadia_Real32Value aspectRatio,
+    Arcadia_Real32Value near,
+    Arcadia_Real32Value far
+  );
+
 void
 Arcadia_Math_Matrix4x4Real32_setPerspectiveProjection
   (
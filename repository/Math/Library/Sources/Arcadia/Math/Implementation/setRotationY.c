@@ -18,10 +18,10 @@
 #include "Arcadia/Math/Implementation/trigonometry.h"
 
 void
-Arcadia_Math_Matrix4x4Real32Value_setRotationY
+Arcadia_Math_Matrix4x4Real32Value_setRotationYValue
   (
     Arcadia_Thread* thread,
-    Arcadia_Math_Matrix4Real32* self,
+    Arcadia_Math_Matrix4x4Real32Value* self,
     Arcadia_Real32Value a
   )
 {
@@ -54,6 +54,19 @@ Arcadia_Math_Matrix4x4Real32Value_setRotationY
   self->elements[3][3] = 1.f;
 }
 
+void
+Arcadia_Math_Matrix4x4Real32Value_setRotationY
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4Real32* self,
+    Arcadia_Real32Value a
+  )
+{
+  Arcadia_Math_Matrix4x4Real32Value value;
+  Arcadia_Math_Matrix4x4Real32Value_setRotationYValue(thread, &value, a);
+  Arcadia_Math_Matrix4Real32_setValue(thread, self, &value);
+}
+
 void
 Arcadia_Math_Matrix4x4Real64Value_setRotationY
   (
@@ -16,10 +16,19 @@
 #if !defined(ARCADIA_MATH_IMPLEMENTATION_SETROTATIONY_H_INCLUDE)
 #define ARCADIA_MATH_IMPLEMENTATION_SETROTATIONY_H_INCLUDE
 
+#include "Arcadia/Math/Implementation/Matrix4x4Real32Value.h"
 #include "Arcadia/Math/Implementation/Matrix4Real32.h"
 #include "Arcadia/Math/Implementation/Matrix4Real64.h"
 
 // https://michaelheilmann.com/Arcadia/Math/#Arcadia_Math_Matrix*x**_setRotationY
+void
+Arcadia_Math_Matrix4x4Real32Value_setRotationYValue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4x4Real32Value* self,
+    Arcadia_Real32Value a
+  );
+
 void
 Arcadia_Math_Matrix4x4Real32Value_setRotationY
   (
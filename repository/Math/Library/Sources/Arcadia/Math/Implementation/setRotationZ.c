@@ -18,10 +18,10 @@
 #include "Arcadia/Math/Implementation/trigonometry.h"
 
 void
-Arcadia_Math_Matrix4x4Real32Value_setRotationZ
+Arcadia_Math_Matrix4x4Real32Value_setRotationZValue
   (
     Arcadia_Thread* thread,
-    Arcadia_Math_Matrix4Real32* self,
+    Arcadia_Math_Matrix4x4Real32Value* self,
     Arcadia_Real32Value a
   )
 {
@@ -54,6 +54,19 @@ Arcadia_Math_Matrix4x4Real32Value_setRotationZ
   self->elements[3][3] = 1.f;
 }
 
+void
+Arcadia_Math_Matrix4x4Real32Value_setRotationZ
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4Real32* self,
+    Arcadia_Real32Value a
+  )
+{
+  Arcadia_Math_Matrix4x4Real32Value value;
+  Arcadia_Math_Matrix4x4Real32Value_setRotationZValue(thread, &value, a);
+  Arcadia_Math_Matrix4Real32_setValue(thread, self, &value);
+}
+
 void
 Arcadia_Math_Matrix4x4Real64Value_setRotationZ
   (
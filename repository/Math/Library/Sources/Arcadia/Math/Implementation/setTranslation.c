@@ -16,10 +16,10 @@
 #include "Arcadia/Math/Implementation/setTranslation.h"
 
 void
-Arcadia_Math_Matrix4x4Real32Value_setTranslation
+Arcadia_Math_Matrix4x4Real32Value_setTranslationValue
   (
     Arcadia_Thread* thread,
-    Arcadia_Math_Matrix4Real32* self,
+    Arcadia_Math_Matrix4x4Real32Value* self,
     Arcadia_Real32Value x,
     Arcadia_Real32Value y,
     Arcadia_Real32Value z
@@ -46,6 +46,21 @@ Arcadia_Math_Matrix4x4Real32Value_setTranslation
   self->elements[3][3] = 1.f;
 }
 
+void
+Arcadia_Math_Matrix4x4Real32Value_setTranslation
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4Real32* self,
+    Arcadia_Real32Value x,
+    Arcadia_Real32Value y,
+    Arcadia_Real32Value z
+  )
+{
+  Arcadia_Math_Matrix4x4Real32Value value;
+  Arcadia_Math_Matrix4x4Real32Value_setTranslationValue(thread, &value, x, y, z);
+  Arcadia_Math_Matrix4Real32_setValue(thread, self, &value);
+}
+
 void
 Arcadia_Math_Matrix4x4Real64Value_setTranslation
   (
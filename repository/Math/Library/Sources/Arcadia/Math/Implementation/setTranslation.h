@@ -16,10 +16,21 @@
 #if !defined(ARCADIA_MATH_IMPLEMENTATION_SETTRANSLATION_H_INCLUDE)
 #define ARCADIA_MATH_IMPLEMENTATION_SETTRANSLATION_H_INCLUDE
 
+#include "Arcadia/Math/Implementation/Matrix4x4Real32Value.h"
 #include "Arcadia/Math/Implementation/Matrix4Real32.h"
 #include "Arcadia/Math/Implementation/Matrix4Real64.h"
 
 // https://michaelheilmann.com/Arcadia/Math/#Arcadia_Math_Matrix*x**_setTranslation
+void
+Arcadia_Math_Matrix4x4Real32Value_setTranslationValue
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_Matrix4x4Real32Value* self,
+    Arcadia_Real32Value x,
+    Arcadia_Real32Value y,
+    Arcadia_Real32Value z
+  );
+
 void
 Arcadia_Math_Matrix4x4Real32Value_setTranslation
   (
@@ -26,8 +26,11 @@
 
 #include "Arcadia/Math/Implementation/crossProduct.h"
 #include "Arcadia/Math/Implementation/Configure.h"
+#include "Arcadia/Math/Implementation/BoxReal32Value.h"
 #include "Arcadia/Math/Implementation/Color4Real32.h"
 #include "Arcadia/Math/Implementation/Color4Real64.h"
+#include "Arcadia/Math/Implementation/FrustumReal32Value.h"
+#include "Arcadia/Math/Implementation/Matrix4x4Real32Value.h"
 #include "Arcadia/Math/Implementation/QuaternionReal32.h"
 #include "Arcadia/Math/Implementation/setOrthographicProjection.h"
 #include "Arcadia/Math/Implementation/setPerspectiveProjection.h"
@@ -36,6 +39,7 @@
 #include "Arcadia/Math/Implementation/setRotationZ.h"
 #include "Arcadia/Math/Implementation/setScaling.h"
 #include "Arcadia/Math/Implementation/setTranslation.h"
+#include "Arcadia/Math/Implementation/SphereReal32Value.h"
 #include "Arcadia/Math/Implementation/Vector3Real32.h"
 #include "Arcadia/Math/Implementation/Vector3Real64.h"
 
@@ -0,0 +1,196 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "Arcadia/Math/Include.h"
+
+static void
+setBox
+  (
+    Arcadia_Math_BoxReal32Value* target,
+    Arcadia_Real32Value x0,
+    Arcadia_Real32Value y0,
+    Arcadia_Real32Value z0,
+    Arcadia_Real32Value x1,
+    Arcadia_Real32Value y1,
+    Arcadia_Real32Value z1
+  )
+{
+  target->minimum[0] = x0; target->minimum[1] = y0; target->minimum[2] = z0;
+  target->maximum[0] = x1; target->maximum[1] = y1; target->maximum[2] = z1;
+}
+
+static Arcadia_BooleanValue
+intersectsSphere
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_FrustumReal32Value const* frustum,
+    Arcadia_Real32Value x,
+    Arcadia_Real32Value y,
+    Arcadia_Real32Value z,
+    Arcadia_Real32Value radius
+  )
+{
+  Arcadia_Math_SphereReal32Value sphere = { { x, y, z }, radius };
+  return Arcadia_Math_FrustumReal32Value_intersectsSphere(thread, frustum, &sphere);
+}
+
+// The frustum of a perspective projection with a field of view of 90 degrees, an aspect ratio of 1, and near and far distances of 1 and 100.
+// The viewer is at the origin looking along the negative z-axis. A point (x, y, z) is inside if |x| <= -z, |y| <= -z, and 1 <= -z <= 100.
+static void
+setFrustum
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Math_FrustumReal32Value* target,
+    Arcadia_Math_Matrix4x4Real32Value const* worldToView
+  )
+{
+  Arcadia_Math_Matrix4Real32* projection = Arcadia_Math_Matrix4Real32_create(thread);
+  Arcadia_Math_Matrix4x4Real32_setPerspectiveProjection(thread, projection, 90.f, 1.f, 1.f, 100.f);
+  Arcadia_Math_Matrix4x4Real32Value matrix;
+  Arcadia_Math_Matrix4Real32_getValue(thread, projection, &matrix);
+  if (worldToView) {
+    Arcadia_Math_Matrix4x4Real32Value_multiply(thread, &matrix, &matrix, worldToView);
+  }
+  Arcadia_Math_FrustumReal32Value_setFromMatrix(thread, target, &matrix);
+}
+
+static void
+sphereTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Math_FrustumReal32Value frustum;
+  setFrustum(thread, &frustum, NULL);
+  // The normals are of unit length.
+  for (Arcadia_SizeValue i = 0; i < 6; ++i) {
+    Arcadia_Real32Value length = sqrtf(frustum.planes[i][0] * frustum.planes[i][0] + frustum.planes[i][1] * frustum.planes[i][1] + frustum.planes[i][2] * frustum.planes[i][2]);
+    Arcadia_Tests_assertTrue(thread, fabsf(length - 1.f) < 1e-5f);
+  }
+  // Inside.
+  Arcadia_Tests_assertTrue(thread, intersectsSphere(thread, &frustum, 0.f, 0.f, -10.f, 0.f));
+  Arcadia_Tests_assertTrue(thread, intersectsSphere(thread, &frustum, 9.f, -9.f, -10.f, 0.f));
+  Arcadia_Tests_assertTrue(thread, intersectsSphere(thread, &frustum, 0.f, 0.f, -99.f, 0.f));
+  // Behind the viewer, before the near plane, beyond the far plane.
+  Arcadia_Tests_assertTrue(thread, !intersectsSphere(thread, &frustum, 0.f, 0.f, 10.f, 1.f));
+  Arcadia_Tests_assertTrue(thread, !intersectsSphere(thread, &frustum, 0.f, 0.f, -0.5f, 0.25f));
+  Arcadia_Tests_assertTrue(thread, !intersectsSphere(thread, &frustum, 0.f, 0.f, -200.f, 50.f));
+  // Left, right, bottom, top.
+  Arcadia_Tests_assertTrue(thread, !intersectsSphere(thread, &frustum, -20.f, 0.f, -10.f, 1.f));
+  Arcadia_Tests_assertTrue(thread, !intersectsSphere(thread, &frustum, +20.f, 0.f, -10.f, 1.f));
+  Arcadia_Tests_assertTrue(thread, !intersectsSphere(thread, &frustum, 0.f, -20.f, -10.f, 1.f));
+  Arcadia_Tests_assertTrue(thread, !intersectsSphere(thread, &frustum, 0.f, +20.f, -10.f, 1.f));
+  // The center is outside, the sphere reaches into the frustum.
+  // The distance of (11, 0, -10) to the right plane is 1 / sqrt(2).
+  Arcadia_Tests_assertTrue(thread, intersectsSphere(thread, &frustum, 11.f, 0.f, -10.f, 1.f));
+  Arcadia_Tests_assertTrue(thread, !intersectsSphere(thread, &frustum, 11.f, 0.f, -10.f, 0.5f));
+  Arcadia_Tests_assertTrue(thread, intersectsSphere(thread, &frustum, 0.f, 0.f, -150.f, 51.f));
+
+  // A viewer at (0, 0, 50) looking along the negative z-axis.
+  Arcadia_Math_Matrix4x4Real32Value worldToView;
+  Arcadia_Math_Matrix4x4Real32Value_setIdentity(thread, &worldToView);
+  worldToView.elements[2][3] = -50.f;
+  setFrustum(thread, &frustum, &worldToView);
+  Arcadia_Tests_assertTrue(thread, intersectsSphere(thread, &frustum, 0.f, 0.f, 0.f, 0.f));
+  Arcadia_Tests_assertTrue(thread, intersectsSphere(thread, &frustum, 0.f, 0.f, -49.f, 0.f));
+  Arcadia_Tests_assertTrue(thread, !intersectsSphere(thread, &frustum, 0.f, 0.f, 60.f, 1.f));
+  Arcadia_Tests_assertTrue(thread, !intersectsSphere(thread, &frustum, 0.f, 0.f, -60.f, 1.f));
+}
+
+static void
+boxTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Math_FrustumReal32Value frustum;
+  setFrustum(thread, &frustum, NULL);
+  Arcadia_Math_BoxReal32Value box;
+  // Contained.
+  setBox(&box, -1.f, -1.f, -11.f, 1.f, 1.f, -9.f);
+  Arcadia_Tests_assertTrue(thread, Arcadia_Math_FrustumReal32Value_intersectsBox(thread, &frustum, &box));
+  // Straddling the right plane.
+  setBox(&box, 5.f, -1.f, -12.f, 15.f, 1.f, -8.f);
+  Arcadia_Tests_assertTrue(thread, Arcadia_Math_FrustumReal32Value_intersectsBox(thread, &frustum, &box));
+  // Containing the frustum.
+  setBox(&box, -1000.f, -1000.f, -1000.f, 1000.f, 1000.f, 1000.f);
+  Arcadia_Tests_assertTrue(thread, Arcadia_Math_FrustumReal32Value_intersectsBox(thread, &frustum, &box));
+  // Outside.
+  setBox(&box, 30.f, -1.f, -12.f, 40.f, 1.f, -8.f);
+  Arcadia_Tests_assertTrue(thread, !Arcadia_Math_FrustumReal32Value_intersectsBox(thread, &frustum, &box));
+  setBox(&box, -1.f, -1.f, 1.f, 1.f, 1.f, 3.f);
+  Arcadia_Tests_assertTrue(thread, !Arcadia_Math_FrustumReal32Value_intersectsBox(thread, &frustum, &box));
+  setBox(&box, -1.f, -1.f, -300.f, 1.f, 1.f, -101.f);
+  Arcadia_Tests_assertTrue(thread, !Arcadia_Math_FrustumReal32Value_intersectsBox(thread, &frustum, &box));
+}
+
+static void
+boundingVolumeTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  // Points with a stride of 5 Real32 values.
+  Arcadia_Real32Value points[] = {
+    +1.f, +2.f, +3.f, 0.f, 0.f,
+    -4.f, +5.f, -6.f, 0.f, 0.f,
+    +7.f, -8.f, +9.f, 0.f, 0.f,
+  };
+  Arcadia_Math_BoxReal32Value box;
+  Arcadia_Math_BoxReal32Value_setFromPoints(thread, &box, points, sizeof(Arcadia_Real32Value) * 5, 3);
+  Arcadia_Tests_assertTrue(thread, box.minimum[0] == -4.f && box.minimum[1] == -8.f && box.minimum[2] == -6.f);
+  Arcadia_Tests_assertTrue(thread, box.maximum[0] == +7.f && box.maximum[1] == +5.f && box.maximum[2] == +9.f);
+  Arcadia_Math_BoxReal32Value_setFromPoints(thread, &box, points, sizeof(Arcadia_Real32Value) * 5, 0);
+  Arcadia_Tests_assertTrue(thread, box.minimum[0] == 0.f && box.maximum[2] == 0.f);
+
+  // Rotate by 90 degrees around the z-axis (x -> y, y -> -x) and translate by (10, 20, 30).
+  Arcadia_Math_Matrix4x4Real32Value m;
+  Arcadia_Math_Matrix4x4Real32Value_setIdentity(thread, &m);
+  m.elements[0][0] = 0.f; m.elements[0][1] = -1.f;
+  m.elements[1][0] = 1.f; m.elements[1][1] = 0.f;
+  m.elements[0][3] = 10.f; m.elements[1][3] = 20.f; m.elements[2][3] = 30.f;
+  setBox(&box, 1.f, 2.f, 3.f, 4.f, 6.f, 8.f);
+  Arcadia_Math_BoxReal32Value_transform(thread, &box, &box, &m);
+  Arcadia_Tests_assertTrue(thread, box.minimum[0] == 4.f && box.minimum[1] == 21.f && box.minimum[2] == 33.f);
+  Arcadia_Tests_assertTrue(thread, box.maximum[0] == 8.f && box.maximum[1] == 24.f && box.maximum[2] == 38.f);
+
+  Arcadia_Math_SphereReal32Value sphere;
+  setBox(&box, -1.f, -2.f, -2.f, 1.f, 2.f, 2.f);
+  Arcadia_Math_SphereReal32Value_setFromBox(thread, &sphere, &box);
+  Arcadia_Tests_assertTrue(thread, sphere.center[0] == 0.f && sphere.center[1] == 0.f && sphere.center[2] == 0.f);
+  Arcadia_Tests_assertTrue(thread, fabsf(sphere.radius - 3.f) < 1e-6f);
+}
+
+int
+main
+  (
+    int argc,
+    char **argv
+  )
+{
+  if (!Arcadia_Tests_safeExecute(&sphereTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&boxTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&boundingVolumeTests)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -13,16 +13,320 @@
 // REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
 // OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
 
+#include <math.h>
 #include <stdlib.h>
 
 #include "Arcadia/Math/Include.h"
 
+// Deterministic pseudo-random values in [-1, +1].
+static Arcadia_Real32Value
+nextValue
+  (
+    Arcadia_Natural32Value* state
+  )
+{
+  *state = *state * 1664525u + 1013904223u;
+  return (Arcadia_Real32Value)(*state >> 8) / (Arcadia_Real32Value)(1u << 23) - 1.f;
+}
+
+static void
+setRandom
+  (
+    Arcadia_Natural32Value* state,
+    Arcadia_Math_Matrix4x4Real32Value* target
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+    for (Arcadia_SizeValue j = 0; j < 4; ++j) {
+      target->elements[i][j] = nextValue(state);
+    }
+  }
+}
+
+static Arcadia_BooleanValue
+isClose
+  (
+    Arcadia_Math_Matrix4x4Real32Value const* x,
+    Arcadia_Math_Matrix4x4Real32Value const* y,
+    Arcadia_Real32Value epsilon
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+    for (Arcadia_SizeValue j = 0; j < 4; ++j) {
+      if (fabsf(x->elements[i][j] - y->elements[i][j]) > epsilon) {
+        return Arcadia_BooleanValue_False;
+      }
+    }
+  }
+  return Arcadia_BooleanValue_True;
+}
+
+// The product of two matrices computed by the textbook triple loop.
+static void
+referenceMultiply
+  (
+    Arcadia_Math_Matrix4x4Real32Value* target,
+    Arcadia_Math_Matrix4x4Real32Value const* a,
+    Arcadia_Math_Matrix4x4Real32Value const* b
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+    for (Arcadia_SizeValue j = 0; j < 4; ++j) {
+      Arcadia_Real32Value sum = 0.f;
+      for (Arcadia_SizeValue k = 0; k < 4; ++k) {
+        sum += a->elements[i][k] * b->elements[k][j];
+      }
+      target->elements[i][j] = sum;
+    }
+  }
+}
+
+static void
+multiplyTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Natural32Value state = 1;
+  for (Arcadia_SizeValue n = 0; n < 64; ++n) {
+    Arcadia_Math_Matrix4x4Real32Value a, b, expected, received;
+    setRandom(&state, &a);
+    setRandom(&state, &b);
+    referenceMultiply(&expected, &a, &b);
+    Arcadia_Math_Matrix4x4Real32Value_multiply(thread, &received, &a, &b);
+    Arcadia_Tests_assertTrue(thread, isClose(&expected, &received, 1e-5f));
+    // The target may be a factor.
+    Arcadia_Math_Matrix4x4Real32Value_multiply(thread, &a, &a, &b);
+    Arcadia_Tests_assertTrue(thread, isClose(&expected, &a, 1e-5f));
+  }
+  // The identity is the neutral element.
+  Arcadia_Math_Matrix4x4Real32Value a, i, received;
+  setRandom(&state, &a);
+  Arcadia_Math_Matrix4x4Real32Value_setIdentity(thread, &i);
+  Arcadia_Math_Matrix4x4Real32Value_multiply(thread, &received, &i, &a);
+  Arcadia_Tests_assertTrue(thread, isClose(&a, &received, 0.f));
+  Arcadia_Math_Matrix4x4Real32Value_multiply(thread, &received, &a, &i);
+  Arcadia_Tests_assertTrue(thread, isClose(&a, &received, 0.f));
+}
+
+static void
+transposeTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Natural32Value state = 2;
+  Arcadia_Math_Matrix4x4Real32Value a, received;
+  setRandom(&state, &a);
+  Arcadia_Math_Matrix4x4Real32Value_transpose(thread, &received, &a);
+  for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+    for (Arcadia_SizeValue j = 0; j < 4; ++j) {
+      Arcadia_Tests_assertTrue(thread, a.elements[i][j] == received.elements[j][i]);
+    }
+  }
+  // In-place.
+  Arcadia_Math_Matrix4x4Real32Value_transpose(thread, &received, &received);
+  Arcadia_Tests_assertTrue(thread, isClose(&a, &received, 0.f));
+}
+
 static void
-test1
+invertTests
   (
     Arcadia_Thread* thread
   )
-{/*@todo Add some tests.*/}
+{
+  Arcadia_Natural32Value state = 3;
+  Arcadia_Math_Matrix4x4Real32Value identity;
+  Arcadia_Math_Matrix4x4Real32Value_setIdentity(thread, &identity);
+  for (Arcadia_SizeValue n = 0; n < 64; ++n) {
+    Arcadia_Math_Matrix4x4Real32Value a, inverse, product;
+    setRandom(&state, &a);
+    // Make the matrix diagonally dominant and hence invertible.
+    for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+      a.elements[i][i] += 4.f;
+    }
+    Arcadia_Tests_assertTrue(thread, Arcadia_Math_Matrix4x4Real32Value_invert(thread, &inverse, &a));
+    Arcadia_Math_Matrix4x4Real32Value_multiply(thread, &product, &a, &inverse);
+    Arcadia_Tests_assertTrue(thread, isClose(&identity, &product, 1e-5f));
+    Arcadia_Math_Matrix4x4Real32Value_multiply(thread, &product, &inverse, &a);
+    Arcadia_Tests_assertTrue(thread, isClose(&identity, &product, 1e-5f));
+    // In-place.
+    Arcadia_Math_Matrix4x4Real32Value b = a;
+    Arcadia_Tests_assertTrue(thread, Arcadia_Math_Matrix4x4Real32Value_invert(thread, &b, &b));
+    Arcadia_Tests_assertTrue(thread, isClose(&inverse, &b, 0.f));
+  }
+  // A singular matrix is not inverted and the target is not modified.
+  Arcadia_Math_Matrix4x4Real32Value singular, target;
+  setRandom(&state, &singular);
+  for (Arcadia_SizeValue j = 0; j < 4; ++j) {
+    singular.elements[3][j] = 0.f;
+  }
+  target = identity;
+  Arcadia_Tests_assertTrue(thread, !Arcadia_Math_Matrix4x4Real32Value_invert(thread, &target, &singular));
+  Arcadia_Tests_assertTrue(thread, isClose(&identity, &target, 0.f));
+}
+
+// A vertex with a position and texture coordinates.
+typedef struct Vertex {
+  Arcadia_Real32Value position[3];
+  Arcadia_Real32Value uv[2];
+} Vertex;
+
+#define NumberOfVertices (37)
+
+static void
+transformPointsTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Natural32Value state = 4;
+  Arcadia_Math_Matrix4x4Real32Value m;
+  setRandom(&state, &m);
+  Vertex vertices[NumberOfVertices];
+  Arcadia_Real32Value points[NumberOfVertices][3];
+  for (Arcadia_SizeValue i = 0; i < NumberOfVertices; ++i) {
+    for (Arcadia_SizeValue j = 0; j < 3; ++j) {
+      vertices[i].position[j] = nextValue(&state);
+    }
+    vertices[i].uv[0] = 7.f;
+    vertices[i].uv[1] = 11.f;
+  }
+  Arcadia_Math_Matrix4x4Real32Value_transformPoints(thread, &m, points, sizeof(points[0]), vertices, sizeof(Vertex), NumberOfVertices);
+  for (Arcadia_SizeValue i = 0; i < NumberOfVertices; ++i) {
+    Arcadia_Real32Value const* p = vertices[i].position;
+    for (Arcadia_SizeValue j = 0; j < 3; ++j) {
+      Arcadia_Real32Value expected = m.elements[j][0] * p[0] + m.elements[j][1] * p[1] + m.elements[j][2] * p[2] + m.elements[j][3];
+      Arcadia_Tests_assertTrue(thread, fabsf(expected - points[i][j]) <= 1e-5f);
+    }
+  }
+  // In-place. The other members of the vertices are not modified.
+  Arcadia_Math_Matrix4x4Real32Value_transformPoints(thread, &m, vertices, sizeof(Vertex), vertices, sizeof(Vertex), NumberOfVertices);
+  for (Arcadia_SizeValue i = 0; i < NumberOfVertices; ++i) {
+    for (Arcadia_SizeValue j = 0; j < 3; ++j) {
+      Arcadia_Tests_assertTrue(thread, vertices[i].position[j] == points[i][j]);
+    }
+    Arcadia_Tests_assertTrue(thread, vertices[i].uv[0] == 7.f);
+    Arcadia_Tests_assertTrue(thread, vertices[i].uv[1] == 11.f);
+  }
+}
+
+static void
+transformDirectionsTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Natural32Value state = 6;
+  Arcadia_Math_Matrix4x4Real32Value a, linear;
+  setRandom(&state, &a);
+  // The same matrix without translation.
+  linear = a;
+  linear.elements[0][3] = 0.f;
+  linear.elements[1][3] = 0.f;
+  linear.elements[2][3] = 0.f;
+  Arcadia_Real32Value directions[4][3], expected[4][3], received[4][3];
+  for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+    for (Arcadia_SizeValue j = 0; j < 3; ++j) {
+      directions[i][j] = nextValue(&state);
+    }
+  }
+  // The translation does not apply to directions.
+  Arcadia_Math_Matrix4x4Real32Value_transformPoints(thread, &linear, expected, sizeof(expected[0]), directions, sizeof(directions[0]), 4);
+  Arcadia_Math_Matrix4x4Real32Value_transformDirections(thread, &a, received, sizeof(received[0]), directions, sizeof(directions[0]), 4);
+  for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+    for (Arcadia_SizeValue j = 0; j < 3; ++j) {
+      Arcadia_Tests_assertTrue(thread, fabsf(expected[i][j] - received[i][j]) <= 1e-5f);
+    }
+  }
+  // In-place.
+  Arcadia_Math_Matrix4x4Real32Value_transformDirections(thread, &a, directions, sizeof(directions[0]), directions, sizeof(directions[0]), 4);
+  for (Arcadia_SizeValue i = 0; i < 4; ++i) {
+    for (Arcadia_SizeValue j = 0; j < 3; ++j) {
+      Arcadia_Tests_assertTrue(thread, fabsf(expected[i][j] - directions[i][j]) <= 1e-5f);
+    }
+  }
+}
+
+static void
+transformationTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Math_Matrix4x4Real32Value a, b;
+  Arcadia_Real32Value point[3];
+
+  // A translation moves points but not directions.
+  Arcadia_Math_Matrix4x4Real32Value_setTranslationValue(thread, &a, 1.f, 2.f, 3.f);
+  point[0] = 1.f; point[1] = 1.f; point[2] = 1.f;
+  Arcadia_Math_Matrix4x4Real32Value_transformPoints(thread, &a, point, sizeof(point), point, sizeof(point), 1);
+  Arcadia_Tests_assertTrue(thread, 2.f == point[0] && 3.f == point[1] && 4.f == point[2]);
+  Arcadia_Math_Matrix4x4Real32Value_transformDirections(thread, &a, point, sizeof(point), point, sizeof(point), 1);
+  Arcadia_Tests_assertTrue(thread, 2.f == point[0] && 3.f == point[1] && 4.f == point[2]);
+
+  // Counter-clockwise rotations by 90 degrees around the x-, y-, and z-axis.
+  Arcadia_Math_Matrix4x4Real32Value_setRotationXValue(thread, &a, 90.f);
+  point[0] = 0.f; point[1] = 1.f; point[2] = 0.f;
+  Arcadia_Math_Matrix4x4Real32Value_transformDirections(thread, &a, point, sizeof(point), point, sizeof(point), 1);
+  Arcadia_Tests_assertTrue(thread, fabsf(point[0]) < 1e-6f && fabsf(point[1]) < 1e-6f && fabsf(point[2] - 1.f) < 1e-6f);
+
+  Arcadia_Math_Matrix4x4Real32Value_setRotationYValue(thread, &a, 90.f);
+  point[0] = 0.f; point[1] = 0.f; point[2] = -1.f;
+  Arcadia_Math_Matrix4x4Real32Value_transformDirections(thread, &a, point, sizeof(point), point, sizeof(point), 1);
+  Arcadia_Tests_assertTrue(thread, fabsf(point[0] + 1.f) < 1e-6f && fabsf(point[1]) < 1e-6f && fabsf(point[2]) < 1e-6f);
+
+  Arcadia_Math_Matrix4x4Real32Value_setRotationZValue(thread, &a, 90.f);
+  point[0] = 1.f; point[1] = 0.f; point[2] = 0.f;
+  Arcadia_Math_Matrix4x4Real32Value_transformDirections(thread, &a, point, sizeof(point), point, sizeof(point), 1);
+  Arcadia_Tests_assertTrue(thread, fabsf(point[0]) < 1e-6f && fabsf(point[1] - 1.f) < 1e-6f && fabsf(point[2]) < 1e-6f);
+
+  // The projections of values and objects are the same.
+  Arcadia_Math_Matrix4Real32* x = Arcadia_Math_Matrix4Real32_create(thread);
+  Arcadia_Math_Matrix4x4Real32Value_setPerspectiveProjection(thread, &a, 60.f, 4.f / 3.f, 0.1f, 100.f);
+  Arcadia_Math_Matrix4x4Real32_setPerspectiveProjection(thread, x, 60.f, 4.f / 3.f, 0.1f, 100.f);
+  Arcadia_Math_Matrix4Real32_getValue(thread, x, &b);
+  Arcadia_Tests_assertTrue(thread, isClose(&a, &b, 0.f));
+  Arcadia_Tests_assertTrue(thread, -1.f == a.elements[3][2] && 0.f == a.elements[3][3]);
+
+  Arcadia_Math_Matrix4x4Real32Value_setOrthographicProjection(thread, &a, -2.f, +2.f, -1.f, +1.f, -1.f, +1.f);
+  Arcadia_Math_Matrix4x4Real32_setOrthographicProjection(thread, x, -2.f, +2.f, -1.f, +1.f, -1.f, +1.f);
+  Arcadia_Math_Matrix4Real32_getValue(thread, x, &b);
+  Arcadia_Tests_assertTrue(thread, isClose(&a, &b, 0.f));
+  Arcadia_Tests_assertTrue(thread, 0.5f == a.elements[0][0] && 1.f == a.elements[1][1] && -1.f == a.elements[2][2]);
+}
+
+static void
+matrixObjectTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Natural32Value state = 5;
+  Arcadia_Math_Matrix4x4Real32Value a, b, expected, received;
+  setRandom(&state, &a);
+  setRandom(&state, &b);
+  referenceMultiply(&expected, &a, &b);
+
+  Arcadia_Math_Matrix4Real32* x = Arcadia_Math_Matrix4Real32_create(thread);
+  Arcadia_Math_Matrix4Real32* y = Arcadia_Math_Matrix4Real32_create(thread);
+  Arcadia_Math_Matrix4Real32_setValue(thread, x, &a);
+  Arcadia_Math_Matrix4Real32_setValue(thread, y, &b);
+
+  Arcadia_Math_Matrix4Real32* z = Arcadia_Math_Matrix4Real32_multiply(thread, x, y);
+  Arcadia_Math_Matrix4Real32_getValue(thread, z, &received);
+  Arcadia_Tests_assertTrue(thread, isClose(&expected, &received, 1e-5f));
+
+  // The product may be assigned to a factor.
+  Arcadia_Math_Matrix4Real32_setProduct(thread, x, x, y);
+  Arcadia_Math_Matrix4Real32_getValue(thread, x, &received);
+  Arcadia_Tests_assertTrue(thread, isClose(&expected, &received, 1e-5f));
+
+  Arcadia_Math_Matrix4Real32_setTranspose(thread, x, x);
+  Arcadia_Math_Matrix4x4Real32Value_transpose(thread, &expected, &expected);
+  Arcadia_Math_Matrix4Real32_getValue(thread, x, &received);
+  Arcadia_Tests_assertTrue(thread, isClose(&expected, &received, 1e-5f));
+}
 
 int
 main
@@ -31,7 +335,25 @@ main
     char **argv
   )
 {
-  if (!Arcadia_Tests_safeExecute(&test1)) {
+  if (!Arcadia_Tests_safeExecute(&multiplyTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&transposeTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&invertTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&transformPointsTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&transformDirectionsTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&transformationTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&matrixObjectTests)) {
     return EXIT_FAILURE;
   }
   return EXIT_SUCCESS;
@@ -36,6 +36,21 @@ if (Arcadia_Object_isEqualTo(thread, (Arcadia_Object*)u, &t)) {
   }
 }
 
+static void
+test2
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Real32Value values[] = { 1.f, 2.f, 2.f };
+  Arcadia_Math_Vector3Real32* u = Arcadia_Math_Vector3Real32_create(thread);
+  Arcadia_Math_Vector3Real32_setWithValues(thread, u, &values[0]);
+  Arcadia_Math_Vector3Real32* v = Arcadia_Math_Vector3Real32_createWithValues(thread, &values[0]);
+  Arcadia_Value t = Arcadia_Value_makeObjectReferenceValue(v);
+  Arcadia_Tests_assertTrue(thread, Arcadia_Object_isEqualTo(thread, (Arcadia_Object*)u, &t));
+  Arcadia_Tests_assertTrue(thread, 9.f == Arcadia_Math_Vector3Real32_getSquaredLength(thread, u));
+}
+
 int
 main
   (
@@ -46,5 +61,8 @@ main
   if (!Arcadia_Tests_safeExecute(&test1)) {
     return EXIT_FAILURE;
   }
+  if (!Arcadia_Tests_safeExecute(&test2)) {
+    return EXIT_FAILURE;
+  }
   return EXIT_SUCCESS;
 }
@@ -223,9 +223,17 @@ createProgramResourceImpl
     Arcadia_VPL_Symbols_Program* program
   )
 {
-  Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramResource* resource = Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramResource_create(thread, (Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext*)self, program);
+  // Equivalent VPL programs share one program resource.
+  Arcadia_String* key = Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_getKey(thread, self->programCache, program);
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramResource* resource = Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_getProgramResource(thread, self->programCache, key);
+  if (resource) {
+    return resource;
+  }
+  resource = Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramResource_create(thread, (Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext*)self, program);
   assert(((Arcadia_Engine_Visuals_Implementation_Resource*)resource)->referenceCount == 0);
+  resource->key = key;
   Arcadia_List_insertBackObjectReferenceValue(thread, self->resources, (Arcadia_Object*)resource);
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_setProgramResource(thread, self->programCache, key, resource);
   return resource;
 }
 
@@ -276,6 +284,18 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext_constructImpl
   self->resources = (Arcadia_List*)Arcadia_ArrayList_create(thread);
   Arcadia_Object_lock(thread, (Arcadia_Object*)self->resources);
 
+  // Create and lock the program cache.
+  self->programCache = Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_create(thread);
+  Arcadia_Object_lock(thread, (Arcadia_Object*)self->programCache);
+
+  // Create and lock the constant buffer allocator.
+  self->constantBufferAllocator = Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_create(thread);
+  Arcadia_Object_lock(thread, (Arcadia_Object*)self->constantBufferAllocator);
+
+  self->bound.program = 0;
+  self->bound.vertexArray = 0;
+  self->bound.texture = 0;
+
   Arcadia_LeaveConstructor(Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext);
 }
 
@@ -305,6 +325,23 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext_destructImpl
     Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext* self
   )
 {
+  // Report and unlock the constant buffer allocator.
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocatorStatistics constantBufferAllocatorStatistics;
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_getStatistics(thread, self->constantBufferAllocator, &constantBufferAllocatorStatistics);
+  Arcadia_logf(Arcadia_LogFlags_Info, "constant buffer allocator: %zu allocations, %zu bytes uploaded, %zu stalls, %zu orphans\n",
+               (size_t)constantBufferAllocatorStatistics.allocations, (size_t)constantBufferAllocatorStatistics.bytesUploaded,
+               (size_t)constantBufferAllocatorStatistics.stalls, (size_t)constantBufferAllocatorStatistics.orphans);
+  Arcadia_Object_unlock(thread, (Arcadia_Object*)self->constantBufferAllocator);
+  self->constantBufferAllocator = NULL;
+  // Report and unlock the program cache.
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCacheStatistics statistics;
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_getStatistics(thread, self->programCache, &statistics);
+  Arcadia_logf(Arcadia_LogFlags_Info, "program cache: %zu program hits, %zu program misses, %zu source hits, %zu source misses, %zu binary hits, %zu binary misses\n",
+               (size_t)statistics.programHits, (size_t)statistics.programMisses,
+               (size_t)statistics.sourceHits, (size_t)statistics.sourceMisses,
+               (size_t)statistics.binaryHits, (size_t)statistics.binaryMisses);
+  Arcadia_Object_unlock(thread, (Arcadia_Object*)self->programCache);
+  self->programCache = NULL;
   // Unlock the list of resources.
   Arcadia_Object_unlock(thread, (Arcadia_Object*)self->resources);
   self->resources = NULL;
@@ -17,7 +17,9 @@
 #define ARCADIA_ENGINE_VISUALS_IMPLEMENTATION_OPENGL4_BACKENDCONTEXT_H_INCLUDED
 
 #include "Arcadia/Engine/Include.h"
+#include "Arcadia/Visuals/Implementation/OpenGL4/ConstantBufferAllocator.h"
 #include "Arcadia/Visuals/Implementation/OpenGL4/Functions.h"
+#include "Arcadia/Visuals/Implementation/OpenGL4/ProgramCache.h"
 
 /// Base of all OpenGL4 backend contexts.
 Arcadia_declareObjectType(u8"Arcadia.Engine.Visuals.Implementation.OpenGL4.BackendContext", Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext,
@@ -39,6 +41,24 @@ struct Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext {
 
   // The list of resources.
   Arcadia_List* resources;
+
+  // The program cache.
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* programCache;
+
+  // The allocator of the ranges of constant buffers.
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* constantBufferAllocator;
+
+  // The names of the objects bound by this backend context.
+  // Used to avoid rebinding objects which are already bound.
+  // Zero if unknown. Reset when a pass is entered.
+  struct {
+    // The program.
+    GLuint program;
+    // The vertex array.
+    GLuint vertexArray;
+    // The 2D texture of texture unit 0.
+    GLuint texture;
+  } bound;
 };
 
 _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions*
@@ -0,0 +1,368 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/Visuals/Implementation/OpenGL4/ConstantBufferAllocator.h"
+
+#include <assert.h>
+#include <string.h>
+
+// The minimum size, in Bytes, of a range. Sizes of ranges are multiples of this value.
+#define MinimumSize (16)
+
+// The alignment, in Bytes, of offsets of ranges if the driver does not report a valid alignment.
+#define DefaultAlignment (256)
+
+// The timeout, in nanoseconds, of a single wait for a fence.
+#define WaitTimeout (1000000000)
+
+static void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* self
+  );
+
+static void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocatorDispatch* self
+  );
+
+static void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_destructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* self
+  );
+
+static Arcadia_BooleanValue
+createBuffer
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* self,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl
+  );
+
+static void
+waitFence
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* self,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl,
+    Arcadia_SizeValue region
+  );
+
+static Arcadia_BooleanValue
+nextRegion
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* self,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl
+  );
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_constructImpl,
+  .destruct = (Arcadia_Object_DestructCallbackFunction*)&Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_destructImpl,
+  .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_initializeDispatchImpl,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.Visuals.Implementation.OpenGL4.ConstantBufferAllocator", Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator,
+                         u8"Arcadia.Object", Arcadia_Object,
+                         &_typeOperations);
+
+static Arcadia_BooleanValue
+createBuffer
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* self,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl
+  )
+{
+  GLsizeiptr numberOfBytes = (GLsizeiptr)Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_NumberOfRegions
+                           * (GLsizeiptr)Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_RegionSize;
+  GLint alignment = 0;
+  while (gl->glGetError()) { }
+  gl->glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+  if (gl->glGetError() || alignment <= 0 || alignment > DefaultAlignment || (alignment & (alignment - 1))) {
+    alignment = DefaultAlignment;
+  }
+  self->alignment = (Arcadia_SizeValue)alignment;
+  // Try to create a persistently mapped buffer.
+  // This requires glBufferStorage (OpenGL 4.4 or ARB_buffer_storage) and fences (OpenGL 3.2 or ARB_sync).
+  if (gl->glBufferStorage && gl->glFenceSync && gl->glClientWaitSync && gl->glDeleteSync) {
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    gl->glGenBuffers(1, &self->bufferID);
+    gl->glBindBuffer(GL_UNIFORM_BUFFER, self->bufferID);
+    gl->glBufferStorage(GL_UNIFORM_BUFFER, numberOfBytes, NULL, flags);
+    if (!gl->glGetError()) {
+      self->bytes = (Arcadia_Natural8Value*)gl->glMapBufferRange(GL_UNIFORM_BUFFER, 0, numberOfBytes, flags);
+      if (!gl->glGetError() && self->bytes) {
+        return Arcadia_BooleanValue_True;
+      }
+      self->bytes = NULL;
+    }
+    // The storage of a buffer created by glBufferStorage is immutable: Delete the buffer and fall back.
+    gl->glDeleteBuffers(1, &self->bufferID);
+    self->bufferID = 0;
+    while (gl->glGetError()) { }
+  }
+  // Fall back to a buffer which is written to by glBufferSubData and orphaned when the ring wraps around.
+  gl->glGenBuffers(1, &self->bufferID);
+  gl->glBindBuffer(GL_UNIFORM_BUFFER, self->bufferID);
+  gl->glBufferData(GL_UNIFORM_BUFFER, numberOfBytes, NULL, GL_STREAM_DRAW);
+  if (gl->glGetError()) {
+    gl->glDeleteBuffers(1, &self->bufferID);
+    self->bufferID = 0;
+    return Arcadia_BooleanValue_False;
+  }
+  return Arcadia_BooleanValue_True;
+}
+
+static void
+waitFence
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* self,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl,
+    Arcadia_SizeValue region
+  )
+{
+  GLsync fence = self->regions[region].fence;
+  if (!fence) {
+    return;
+  }
+  GLenum result = gl->glClientWaitSync(fence, 0, 0);
+  if (GL_TIMEOUT_EXPIRED == result) {
+    // The GPU is not done with the region.
+    self->statistics.stalls++;
+    do {
+      result = gl->glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, WaitTimeout);
+    } while (GL_TIMEOUT_EXPIRED == result);
+  }
+  gl->glDeleteSync(fence);
+  self->regions[region].fence = NULL;
+}
+
+static Arcadia_BooleanValue
+nextRegion
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* self,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl
+  )
+{
+  Arcadia_SizeValue region = (self->region + 1) % Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_NumberOfRegions;
+  if (self->bytes) {
+    // Guard the current region by a fence and wait until the GPU is done with the next region.
+    self->regions[self->region].fence = gl->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    waitFence(thread, self, gl, region);
+    self->regions[region].generation++;
+  } else if (0 == region) {
+    // Orphan the buffer. This invalidates the ranges of all regions.
+    while (gl->glGetError()) { }
+    gl->glBindBuffer(GL_UNIFORM_BUFFER, self->bufferID);
+    gl->glBufferData(GL_UNIFORM_BUFFER, (GLsizeiptr)Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_NumberOfRegions
+                                        * (GLsizeiptr)Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_RegionSize, NULL, GL_STREAM_DRAW);
+    if (gl->glGetError()) {
+      return Arcadia_BooleanValue_False;
+    }
+    self->statistics.orphans++;
+    for (Arcadia_SizeValue i = 0; i < Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_NumberOfRegions; ++i) {
+      self->regions[i].generation++;
+    }
+  }
+  self->region = region;
+  self->offset = 0;
+  return Arcadia_BooleanValue_True;
+}
+
+static void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator);
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  if (0 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->bufferID = 0;
+  self->bytes = NULL;
+  self->alignment = DefaultAlignment;
+  self->region = 0;
+  self->offset = 0;
+  for (Arcadia_SizeValue i = 0; i < Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_NumberOfRegions; ++i) {
+    self->regions[i].fence = NULL;
+    self->regions[i].generation = 0;
+  }
+  self->statistics.allocations = 0;
+  self->statistics.bytesUploaded = 0;
+  self->statistics.stalls = 0;
+  self->statistics.orphans = 0;
+  Arcadia_LeaveConstructor(Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator);
+}
+
+static void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocatorDispatch* self
+  )
+{ }
+
+static void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_destructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* self
+  )
+{
+  // The buffer must have been deleted by Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_unload.
+  assert(0 == self->bufferID);
+}
+
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator*
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_create
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  Arcadia_ValueStack_pushNatural8Value(thread, 0);
+  ARCADIA_CREATEOBJECT(Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator);
+}
+
+Arcadia_BooleanValue
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_allocate
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* self,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl,
+    void const* bytes,
+    Arcadia_SizeValue numberOfBytes,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocation* allocation
+  )
+{
+  if (numberOfBytes > Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_RegionSize) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  allocation->bufferID = 0;
+  allocation->offset = 0;
+  allocation->size = 0;
+  allocation->region = 0;
+  allocation->generation = 0;
+  if (!self->bufferID) {
+    if (!createBuffer(thread, self, gl)) {
+      return Arcadia_BooleanValue_False;
+    }
+  }
+  Arcadia_SizeValue size = numberOfBytes < MinimumSize ? MinimumSize : (numberOfBytes + (MinimumSize - 1)) & ~(Arcadia_SizeValue)(MinimumSize - 1);
+  Arcadia_SizeValue offset = (self->offset + (self->alignment - 1)) & ~(self->alignment - 1);
+  if (offset > Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_RegionSize - size) {
+    if (!nextRegion(thread, self, gl)) {
+      return Arcadia_BooleanValue_False;
+    }
+    offset = 0;
+  }
+  Arcadia_SizeValue absoluteOffset = self->region * Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_RegionSize + offset;
+  if (self->bytes) {
+    // The buffer is coherently mapped: The data is visible to the GPU without further calls.
+    memcpy(self->bytes + absoluteOffset, bytes, numberOfBytes);
+  } else if (numberOfBytes) {
+    while (gl->glGetError()) { }
+    gl->glBindBuffer(GL_UNIFORM_BUFFER, self->bufferID);
+    gl->glBufferSubData(GL_UNIFORM_BUFFER, (GLintptr)absoluteOffset, (GLsizeiptr)numberOfBytes, bytes);
+    if (gl->glGetError()) {
+      return Arcadia_BooleanValue_False;
+    }
+  }
+  self->offset = offset + size;
+  self->statistics.allocations++;
+  self->statistics.bytesUploaded += numberOfBytes;
+  allocation->bufferID = self->bufferID;
+  allocation->offset = (GLintptr)absoluteOffset;
+  allocation->size = (GLsizeiptr)size;
+  allocation->region = self->region;
+  allocation->generation = self->regions[self->region].generation;
+  return Arcadia_BooleanValue_True;
+}
+
+Arcadia_BooleanValue
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_isValid
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* self,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocation const* allocation
+  )
+{
+  // If the buffer is persistently mapped, a range of an older region must be copied again:
+  // The fence of an older region was placed when the ring left that region and does not guard draws issued later.
+  return 0 != allocation->bufferID
+      && allocation->bufferID == self->bufferID
+      && allocation->generation == self->regions[allocation->region].generation
+      && (!self->bytes || allocation->region == self->region);
+}
+
+void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_unload
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* self,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl
+  )
+{
+  for (Arcadia_SizeValue i = 0; i < Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_NumberOfRegions; ++i) {
+    if (self->regions[i].fence) {
+      gl->glDeleteSync(self->regions[i].fence);
+      self->regions[i].fence = NULL;
+    }
+    // Invalidate all allocations of this region.
+    self->regions[i].generation++;
+  }
+  if (self->bufferID) {
+    if (self->bytes) {
+      gl->glBindBuffer(GL_UNIFORM_BUFFER, self->bufferID);
+      gl->glUnmapBuffer(GL_UNIFORM_BUFFER);
+      self->bytes = NULL;
+    }
+    gl->glDeleteBuffers(1, &self->bufferID);
+    self->bufferID = 0;
+  }
+  self->region = 0;
+  self->offset = 0;
+}
+
+void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_getStatistics
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* self,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocatorStatistics* statistics
+  )
+{ *statistics = self->statistics; }
@@ -0,0 +1,167 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_ENGINE_VISUALS_IMPLEMENTATION_OPENGL4_CONSTANTBUFFERALLOCATOR_H_INCLUDED)
+#define ARCADIA_ENGINE_VISUALS_IMPLEMENTATION_OPENGL4_CONSTANTBUFFERALLOCATOR_H_INCLUDED
+
+#include "Arcadia/Engine/Include.h"
+#include "Arcadia/Visuals/Implementation/OpenGL4/Functions.h"
+
+/// The number of regions of the ring buffer of a constant buffer allocator.
+#define Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_NumberOfRegions (4)
+
+/// The size, in Bytes, of a region of the ring buffer of a constant buffer allocator.
+#define Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_RegionSize (256 * 1024)
+
+/// The counters of a constant buffer allocator.
+typedef struct Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocatorStatistics {
+  /// The number of allocations.
+  Arcadia_SizeValue allocations;
+  /// The number of Bytes uploaded.
+  Arcadia_SizeValue bytesUploaded;
+  /// The number of times a region was reused before the GPU was done with it and the allocator had to wait.
+  Arcadia_SizeValue stalls;
+  /// The number of times the buffer was orphaned.
+  /// Only incremented if the buffer is not persistently mapped.
+  Arcadia_SizeValue orphans;
+} Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocatorStatistics;
+
+/// A range of the buffer of a constant buffer allocator.
+typedef struct Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocation {
+  /// The name of the buffer. Zero if this allocation is invalid.
+  GLuint bufferID;
+  /// The offset, in Bytes, of the range.
+  GLintptr offset;
+  /// The size, in Bytes, of the range.
+  GLsizeiptr size;
+  /// The region of the range.
+  Arcadia_SizeValue region;
+  /// The generation of the region when the range was allocated.
+  Arcadia_Natural32Value generation;
+} Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocation;
+
+/// An allocator of ranges of a single uniform buffer used by all constant buffers of a backend context.
+/// The buffer is a ring of #Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_NumberOfRegions regions.
+/// Ranges are allocated linearly from the current region.
+/// If the current region is exhausted, a fence is inserted for the current region and the next region becomes the current region.
+/// Before a region is reused, the allocator waits for its fence and increments the generation of the region.
+/// This invalidates all ranges allocated from the region before.
+/// - If the driver supports persistent mapping (OpenGL 4.4 or ARB_buffer_storage) and fences (OpenGL 3.2 or ARB_sync),
+///   the buffer is persistently mapped and the data is written directly into the mapped memory.
+/// - Otherwise the data is uploaded with glBufferSubData and the buffer is orphaned whenever the ring wraps around.
+Arcadia_declareObjectType(u8"Arcadia.Visuals.Implementation.OpenGL4.ConstantBufferAllocator", Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator,
+                          u8"Arcadia.Object");
+
+struct Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocatorDispatch {
+  Arcadia_ObjectDispatch _parent;
+};
+
+struct Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator {
+  Arcadia_Object _parent;
+  // The name of the buffer. Zero if the buffer was not created yet.
+  GLuint bufferID;
+  // A pointer to the persistently mapped memory of the buffer.
+  // Null if the buffer is not persistently mapped.
+  Arcadia_Natural8Value* bytes;
+  // The alignment, in Bytes, of offsets of ranges.
+  Arcadia_SizeValue alignment;
+  // The current region.
+  Arcadia_SizeValue region;
+  // The offset, in Bytes, of the next range relative to the start of the current region.
+  Arcadia_SizeValue offset;
+  // The fences and generations of the regions.
+  struct {
+    // The fence of the region. Null if the region is not guarded by a fence.
+    GLsync fence;
+    // The generation of the region.
+    Arcadia_Natural32Value generation;
+  } regions[Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_NumberOfRegions];
+  // The counters.
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocatorStatistics statistics;
+};
+
+/// @brief Create a constant buffer allocator.
+/// @param thread A pointer to this thread.
+/// @return A pointer to the constant buffer allocator.
+/// @remarks The buffer is created when the first range is allocated.
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator*
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_create
+  (
+    Arcadia_Thread* thread
+  );
+
+/// @brief Allocate a range and copy Bytes into it.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this constant buffer allocator.
+/// @param gl A pointer to the OpenGL functions.
+/// @param bytes A pointer to an array of @a numberOfBytes Bytes.
+/// @param numberOfBytes The number of Bytes in the array pointed to by @a bytes.
+/// @param allocation A pointer to the variable to which the allocation is assigned.
+/// @return #Arcadia_BooleanValue_True on success, #Arcadia_BooleanValue_False if the buffer could not be created or written to.
+/// If #Arcadia_BooleanValue_False is returned, an invalid allocation was assigned.
+/// @error #Arcadia_Status_ArgumentValueInvalid @a numberOfBytes is greater than #Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_RegionSize
+Arcadia_BooleanValue
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_allocate
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* self,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl,
+    void const* bytes,
+    Arcadia_SizeValue numberOfBytes,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocation* allocation
+  );
+
+/// @brief Get if an allocation is valid.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this constant buffer allocator.
+/// @param allocation A pointer to the allocation.
+/// @return #Arcadia_BooleanValue_True if the allocation is valid, #Arcadia_BooleanValue_False otherwise.
+/// An allocation is invalid if its region was reused or if the buffer was deleted.
+/// If the buffer is persistently mapped, an allocation is also invalid if its region is not the current region:
+/// Only the fence of the current region covers draws issued after the ring has left an older region.
+Arcadia_BooleanValue
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_isValid
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* self,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocation const* allocation
+  );
+
+/// @brief Delete the fences and the buffer of this constant buffer allocator.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this constant buffer allocator.
+/// @param gl A pointer to the OpenGL functions.
+/// @remarks All allocations become invalid.
+void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_unload
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* self,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl
+  );
+
+/// @brief Get the counters of this constant buffer allocator.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this constant buffer allocator.
+/// @param statistics A pointer to the variable to which the counters are assigned.
+void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_getStatistics
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* self,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocatorStatistics* statistics
+  );
+
+#endif // ARCADIA_ENGINE_VISUALS_IMPLEMENTATION_OPENGL4_CONSTANTBUFFERALLOCATOR_H_INCLUDED
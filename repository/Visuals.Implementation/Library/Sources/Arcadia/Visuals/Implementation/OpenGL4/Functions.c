@@ -10,7 +10,10 @@ _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions_initialize
 {
 #define Define(Type, Name) \
   functions->Name = NULL;
+#define DefineOptional(Type, Name) \
+  functions->Name = NULL;
   #include "Arcadia/Visuals/Implementation/OpenGL4/Functions.i"
+#undef DefineOptional
 #undef Define
 
 #define Define(Type, Name) \
@@ -19,9 +22,12 @@ _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions_initialize
     Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed); \
     Arcadia_Thread_jump(thread); \
   }
+#define DefineOptional(Type, Name) \
+  functions->Name = (Type)(*linker->link)(thread, linker, #Name);
 
   #include "Arcadia/Visuals/Implementation/OpenGL4/Functions.i"
 
+#undef DefineOptional
 #undef Define
 }
 
@@ -34,6 +40,9 @@ _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions_uninitialize
 {
 #define Define(Type, Name) \
   functions->Name = NULL;
+#define DefineOptional(Type, Name) \
+  functions->Name = NULL;
   #include "Arcadia/Visuals/Implementation/OpenGL4/Functions.i"
+#undef DefineOptional
 #undef Define
 }
@@ -16,7 +16,10 @@ struct _Arcadia_Engine_Visuals_Implementation_OpenGL4_Linker {
 struct _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions {
 #define Define(Type, Name) \
   Type Name;
+#define DefineOptional(Type, Name) \
+  Type Name;
 #include "Arcadia/Visuals/Implementation/OpenGL4/Functions.i"
+#undef DefineOptional
 #undef Define
 };
 
@@ -4,6 +4,10 @@ Define(PFNGLDELETEBUFFERSPROC, glDeleteBuffers)
 Define(PFNGLBINDBUFFERPROC, glBindBuffer)
 Define(PFNGLBINDBUFFERBASEPROC, glBindBufferBase)
 Define(PFNGLBUFFERDATAPROC, glBufferData)
+Define(PFNGLBUFFERSUBDATAPROC, glBufferSubData)
+Define(PFNGLBINDBUFFERRANGEPROC, glBindBufferRange)
+Define(PFNGLMAPBUFFERRANGEPROC, glMapBufferRange)
+Define(PFNGLUNMAPBUFFERPROC, glUnmapBuffer)
 
 // *Vertex Buffer*
 Define(PFNGLBINDVERTEXBUFFERPROC, glBindVertexBuffer)
@@ -39,6 +43,7 @@ Define(PFNGLGETUNIFORMLOCATIONPROC, glGetUniformLocation)
 Define(PFNGLGETACTIVEUNIFORMPROC, glGetActiveUniform)
 
 Define(PFNGLGETERRORPROC, glGetError)
+Define(PFNGLGETSTRINGPROC, glGetString)
 
 Define(PFNGLCLEARCOLORPROC, glClearColor)
 Define(PFNGLCLEARDEPTHPROC, glClearDepth)
@@ -56,7 +61,10 @@ Define(PFNGLACTIVETEXTUREPROC, glActiveTexture)
 
 Define(PFNGLBINDTEXTUREPROC, glBindTexture)
 Define(PFNGLTEXIMAGE2DPROC, glTexImage2D)
+Define(PFNGLTEXSUBIMAGE2DPROC, glTexSubImage2D)
 Define(PFNGLTEXPARAMETERIPROC, glTexParameteri)
+Define(PFNGLPIXELSTOREIPROC, glPixelStorei)
+Define(PFNGLGENERATEMIPMAPPROC, glGenerateMipmap)
 
 // *Framebuffer*
 Define(PFNGLGENFRAMEBUFFERSPROC, glGenFramebuffers)
@@ -77,3 +85,14 @@ Define(PFNGLGETBOOLEANVPROC, glGetBooleanv)
 
 Define(PFNGLGETFLOATVPROC, glGetFloatv)
 Define(PFNGLGETDOUBLEVPROC, glGetDoublev)
+
+// *Optional*
+// These functions are null if they are not supported.
+DefineOptional(PFNGLGETPROGRAMBINARYPROC, glGetProgramBinary)
+DefineOptional(PFNGLPROGRAMBINARYPROC, glProgramBinary)
+DefineOptional(PFNGLPROGRAMPARAMETERIPROC, glProgramParameteri)
+DefineOptional(PFNGLBUFFERSTORAGEPROC, glBufferStorage)
+DefineOptional(PFNGLFENCESYNCPROC, glFenceSync)
+DefineOptional(PFNGLCLIENTWAITSYNCPROC, glClientWaitSync)
+DefineOptional(PFNGLDELETESYNCPROC, glDeleteSync)
+DefineOptional(PFNGLTEXSTORAGE2DPROC, glTexStorage2D)
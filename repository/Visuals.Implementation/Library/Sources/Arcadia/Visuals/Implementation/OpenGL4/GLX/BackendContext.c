@@ -1270,6 +1270,8 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_GLX_BackendContext_destruct
   // (1) Update resources until no resources are left.
   while (updateResources(thread, self))
   {/*Intentionally empty.*/}
+  // (2) Delete the buffer of the constant buffer allocator.
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_unload(thread, ((Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext*)self)->constantBufferAllocator, &self->_functions);
   //
   _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions_uninitialize(thread, &self->_functions);
   //
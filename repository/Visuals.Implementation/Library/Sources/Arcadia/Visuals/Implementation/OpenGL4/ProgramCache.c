@@ -0,0 +1,886 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include "Arcadia/Visuals/Implementation/OpenGL4/ProgramCache.h"
+
+#include "Arcadia/Visuals/Implementation/OpenGL4/Resources/ProgramResource.h"
+#include "Arcadia/VPL/Include.h"
+#include <stdio.h>
+#include <string.h>
+
+// Increment if the description of a key or the format of the cache files changes.
+// Changes to the VPL program definitions and to the GLSL transpiler change the keys without incrementing this.
+#define CacheVersion (2)
+
+// The magic bytes of a GLSL source file.
+static const Arcadia_Natural8Value SourceMagic[8] = { 'A', 'R', 'C', 'G', 'L', 'S', 'L', '1' };
+
+// The magic bytes of a program binary file.
+static const Arcadia_Natural8Value BinaryMagic[8] = { 'A', 'R', 'C', 'G', 'L', 'P', 'B', '1' };
+
+// A reader of a cache file.
+// The reader only reads up to the checksum which is validated when the reader is opened.
+typedef struct Reader {
+  Arcadia_Natural8Value const* bytes;
+  Arcadia_SizeValue numberOfBytes;
+  Arcadia_SizeValue position;
+} Reader;
+
+static Arcadia_BooleanValue
+Reader_open
+  (
+    Arcadia_Thread* thread,
+    Reader* self,
+    Arcadia_ByteArrayBuilder* source,
+    Arcadia_Natural8Value const* magic
+  );
+
+static Arcadia_BooleanValue
+Reader_readNatural32
+  (
+    Reader* self,
+    Arcadia_Natural32Value* value
+  );
+
+static Arcadia_BooleanValue
+Reader_readNatural64
+  (
+    Reader* self,
+    Arcadia_Natural64Value* value
+  );
+
+static Arcadia_BooleanValue
+Reader_readBytes
+  (
+    Reader* self,
+    Arcadia_Natural8Value const** bytes,
+    Arcadia_Natural32Value* numberOfBytes
+  );
+
+static void
+writeNatural32
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_Natural32Value value
+  );
+
+static void
+writeNatural64
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_Natural64Value value
+  );
+
+static void
+writeBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    void const* bytes,
+    Arcadia_SizeValue numberOfBytes
+  );
+
+static void
+writeString
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_String* string
+  );
+
+static void
+writeStrings
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_List* strings
+  );
+
+static void
+writeNode
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_VPL_Tree_Node* node
+  );
+
+static void
+writeNodes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_List* nodes
+  );
+
+static void
+writeChecksum
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target
+  );
+
+static Arcadia_Natural64Value
+hashSources
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* vertexShader,
+    Arcadia_ByteArrayBuilder* fragmentShader
+  );
+
+static Arcadia_FilePath*
+getFilePath
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_String* key,
+    const char* extension
+  );
+
+static Arcadia_ByteArrayBuilder*
+readFile
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_String* key,
+    const char* extension
+  );
+
+static void
+writeFile
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_String* key,
+    const char* extension,
+    Arcadia_ByteArrayBuilder* contents
+  );
+
+static void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self
+  );
+
+static void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCacheDispatch* self
+  );
+
+static void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_visitImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self
+  );
+
+static const Arcadia_ObjectType_Operations _objectTypeOperations = {
+  Arcadia_ObjectType_Operations_Initializer,
+  .construct = (Arcadia_Object_ConstructCallbackFunction*)&Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_constructImpl,
+  .visit = (Arcadia_Object_VisitCallbackFunction*)&Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_visitImpl,
+  .initializeDispatch = (Arcadia_ObjectDispatch_InitializeCallbackFunction*)&Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_initializeDispatchImpl,
+};
+
+static const Arcadia_Type_Operations _typeOperations = {
+  Arcadia_Type_Operations_Initializer,
+  .objectTypeOperations = &_objectTypeOperations,
+};
+
+Arcadia_defineObjectType(u8"Arcadia.Visuals.Implementation.OpenGL4.ProgramCache", Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache,
+                         u8"Arcadia.Object", Arcadia_Object,
+                         &_typeOperations);
+
+static Arcadia_BooleanValue
+Reader_open
+  (
+    Arcadia_Thread* thread,
+    Reader* self,
+    Arcadia_ByteArrayBuilder* source,
+    Arcadia_Natural8Value const* magic
+  )
+{
+  self->bytes = Arcadia_ByteArrayBuilder_getBytes(thread, source);
+  self->numberOfBytes = Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, source);
+  self->position = 0;
+  if (self->numberOfBytes < 8 + 8) {
+    return Arcadia_BooleanValue_False;
+  }
+  self->numberOfBytes -= 8;
+  Arcadia_Natural64Value expected = 0;
+  for (Arcadia_SizeValue i = 0; i < 8; ++i) {
+    expected |= ((Arcadia_Natural64Value)self->bytes[self->numberOfBytes + i]) << (8 * i);
+  }
+  Arcadia_Natural64Value received = (Arcadia_Natural64Value)Arcadia_hashBytes(thread, self->bytes, self->numberOfBytes);
+  if (expected != received) {
+    return Arcadia_BooleanValue_False;
+  }
+  if (memcmp(self->bytes, magic, 8)) {
+    return Arcadia_BooleanValue_False;
+  }
+  self->position = 8;
+  return Arcadia_BooleanValue_True;
+}
+
+static Arcadia_BooleanValue
+Reader_readNatural32
+  (
+    Reader* self,
+    Arcadia_Natural32Value* value
+  )
+{
+  if (self->numberOfBytes - self->position < 4) {
+    return Arcadia_BooleanValue_False;
+  }
+  Arcadia_Natural8Value const* p = self->bytes + self->position;
+  *value = ((Arcadia_Natural32Value)p[0] << 0)
+         | ((Arcadia_Natural32Value)p[1] << 8)
+         | ((Arcadia_Natural32Value)p[2] << 16)
+         | ((Arcadia_Natural32Value)p[3] << 24);
+  self->position += 4;
+  return Arcadia_BooleanValue_True;
+}
+
+static Arcadia_BooleanValue
+Reader_readNatural64
+  (
+    Reader* self,
+    Arcadia_Natural64Value* value
+  )
+{
+  Arcadia_Natural32Value low, high;
+  if (!Reader_readNatural32(self, &low) || !Reader_readNatural32(self, &high)) {
+    return Arcadia_BooleanValue_False;
+  }
+  *value = ((Arcadia_Natural64Value)high << 32) | (Arcadia_Natural64Value)low;
+  return Arcadia_BooleanValue_True;
+}
+
+static Arcadia_BooleanValue
+Reader_readBytes
+  (
+    Reader* self,
+    Arcadia_Natural8Value const** bytes,
+    Arcadia_Natural32Value* numberOfBytes
+  )
+{
+  Arcadia_Natural32Value n;
+  if (!Reader_readNatural32(self, &n)) {
+    return Arcadia_BooleanValue_False;
+  }
+  if (self->numberOfBytes - self->position < n) {
+    return Arcadia_BooleanValue_False;
+  }
+  *bytes = self->bytes + self->position;
+  *numberOfBytes = n;
+  self->position += n;
+  return Arcadia_BooleanValue_True;
+}
+
+static void
+writeNatural32
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_Natural32Value value
+  )
+{
+  Arcadia_Natural8Value bytes[4] = {
+    (Arcadia_Natural8Value)(value >> 0),
+    (Arcadia_Natural8Value)(value >> 8),
+    (Arcadia_Natural8Value)(value >> 16),
+    (Arcadia_Natural8Value)(value >> 24),
+  };
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, bytes, 4);
+}
+
+static void
+writeNatural64
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_Natural64Value value
+  )
+{
+  writeNatural32(thread, target, (Arcadia_Natural32Value)(value >> 0));
+  writeNatural32(thread, target, (Arcadia_Natural32Value)(value >> 32));
+}
+
+static void
+writeBytes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    void const* bytes,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  if (numberOfBytes > Arcadia_Natural32Value_Maximum) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  writeNatural32(thread, target, (Arcadia_Natural32Value)numberOfBytes);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, bytes, numberOfBytes);
+}
+
+static void
+writeString
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_String* string
+  )
+{
+  // A null string and an empty string must be distinguished.
+  if (!string) {
+    writeNatural32(thread, target, 0);
+    return;
+  }
+  writeNatural32(thread, target, 1);
+  writeBytes(thread, target, Arcadia_String_getBytes(thread, string), Arcadia_String_getNumberOfBytes(thread, string));
+}
+
+static void
+writeStrings
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_List* strings
+  )
+{
+  Arcadia_SizeValue n = strings ? Arcadia_Collection_getSize(thread, (Arcadia_Collection*)strings) : 0;
+  writeNatural32(thread, target, (Arcadia_Natural32Value)n);
+  for (Arcadia_SizeValue i = 0; i < n; ++i) {
+    writeString(thread, target, (Arcadia_String*)Arcadia_List_getObjectReferenceValueCheckedAt(thread, strings, i, _Arcadia_String_getType(thread)));
+  }
+}
+
+// The tags of the nodes in a key description.
+#define NullTag (0)
+#define ProgramDefnTag (1)
+#define ConstantRecordDefnTag (2)
+#define VariableDefnTag (3)
+#define ProcedureDefnTag (4)
+#define BinaryExprTag (5)
+#define CallExprTag (6)
+#define NameExprTag (7)
+#define NumberExprTag (8)
+
+// Write the canonical description of a VPL tree.
+// Symbols are not written: They are derived from the tree.
+static void
+writeNode
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_VPL_Tree_Node* node
+  )
+{
+  if (!node) {
+    writeNatural32(thread, target, NullTag);
+  } else if (Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)node, _Arcadia_VPL_Tree_ProgramDefnNode_getType(thread))) {
+    Arcadia_VPL_Tree_ProgramDefnNode* programDefnNode = (Arcadia_VPL_Tree_ProgramDefnNode*)node;
+    writeNatural32(thread, target, ProgramDefnTag);
+    writeNodes(thread, target, programDefnNode->elements);
+  } else if (Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)node, _Arcadia_VPL_Tree_ConstantRecordDefnNode_getType(thread))) {
+    Arcadia_VPL_Tree_ConstantRecordDefnNode* constantRecordDefnNode = (Arcadia_VPL_Tree_ConstantRecordDefnNode*)node;
+    writeNatural32(thread, target, ConstantRecordDefnTag);
+    writeString(thread, target, constantRecordDefnNode->name);
+    writeNodes(thread, target, constantRecordDefnNode->fields);
+  } else if (Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)node, _Arcadia_VPL_Tree_VariableDefnNode_getType(thread))) {
+    Arcadia_VPL_Tree_VariableDefnNode* variableDefnNode = (Arcadia_VPL_Tree_VariableDefnNode*)node;
+    writeNatural32(thread, target, VariableDefnTag);
+    writeString(thread, target, variableDefnNode->name);
+    writeStrings(thread, target, variableDefnNode->modifiers);
+    writeString(thread, target, variableDefnNode->type);
+  } else if (Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)node, _Arcadia_VPL_Tree_ProcedureDefnNode_getType(thread))) {
+    Arcadia_VPL_Tree_ProcedureDefnNode* procedureDefnNode = (Arcadia_VPL_Tree_ProcedureDefnNode*)node;
+    writeNatural32(thread, target, ProcedureDefnTag);
+    writeStrings(thread, target, procedureDefnNode->modifiers);
+    writeNode(thread, target, (Arcadia_VPL_Tree_Node*)procedureDefnNode->returnValueType);
+    writeString(thread, target, procedureDefnNode->name);
+    writeNodes(thread, target, procedureDefnNode->parameters);
+    writeNodes(thread, target, procedureDefnNode->body);
+  } else if (Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)node, _Arcadia_VPL_Tree_BinaryExprNode_getType(thread))) {
+    Arcadia_VPL_Tree_BinaryExprNode* binaryExprNode = (Arcadia_VPL_Tree_BinaryExprNode*)node;
+    writeNatural32(thread, target, BinaryExprTag);
+    writeNatural32(thread, target, (Arcadia_Natural32Value)binaryExprNode->kind);
+    writeNode(thread, target, binaryExprNode->lhs);
+    writeNode(thread, target, binaryExprNode->rhs);
+  } else if (Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)node, _Arcadia_VPL_Tree_CallExprNode_getType(thread))) {
+    Arcadia_VPL_Tree_CallExprNode* callExprNode = (Arcadia_VPL_Tree_CallExprNode*)node;
+    writeNatural32(thread, target, CallExprTag);
+    writeNode(thread, target, callExprNode->target);
+    writeNodes(thread, target, callExprNode->arguments);
+  } else if (Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)node, _Arcadia_VPL_Tree_NameExprNode_getType(thread))) {
+    Arcadia_VPL_Tree_NameExprNode* nameExprNode = (Arcadia_VPL_Tree_NameExprNode*)node;
+    writeNatural32(thread, target, NameExprTag);
+    writeString(thread, target, nameExprNode->name);
+  } else if (Arcadia_Object_isInstanceOf(thread, (Arcadia_Object*)node, _Arcadia_VPL_Tree_NumberExprNode_getType(thread))) {
+    Arcadia_VPL_Tree_NumberExprNode* numberExprNode = (Arcadia_VPL_Tree_NumberExprNode*)node;
+    writeNatural32(thread, target, NumberExprTag);
+    writeString(thread, target, numberExprNode->literal);
+  } else {
+    // A node which can not be described can not be keyed.
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_ArgumentValueInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+}
+
+static void
+writeNodes
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target,
+    Arcadia_List* nodes
+  )
+{
+  Arcadia_SizeValue n = nodes ? Arcadia_Collection_getSize(thread, (Arcadia_Collection*)nodes) : 0;
+  writeNatural32(thread, target, (Arcadia_Natural32Value)n);
+  for (Arcadia_SizeValue i = 0; i < n; ++i) {
+    writeNode(thread, target, (Arcadia_VPL_Tree_Node*)Arcadia_List_getObjectReferenceValueCheckedAt(thread, nodes, i, _Arcadia_VPL_Tree_Node_getType(thread)));
+  }
+}
+
+static void
+writeChecksum
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* target
+  )
+{
+  Arcadia_Natural64Value checksum = (Arcadia_Natural64Value)Arcadia_hashBytes(thread, Arcadia_ByteArrayBuilder_getBytes(thread, target), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, target));
+  Arcadia_Natural8Value bytes[8];
+  for (Arcadia_SizeValue i = 0; i < 8; ++i) {
+    bytes[i] = (Arcadia_Natural8Value)(checksum >> (8 * i));
+  }
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, bytes, 8);
+}
+
+static Arcadia_Natural64Value
+hashSources
+  (
+    Arcadia_Thread* thread,
+    Arcadia_ByteArrayBuilder* vertexShader,
+    Arcadia_ByteArrayBuilder* fragmentShader
+  )
+{
+  Arcadia_ByteArrayBuilder* description = Arcadia_ByteArrayBuilder_create(thread);
+  writeBytes(thread, description, Arcadia_ByteArrayBuilder_getBytes(thread, vertexShader), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, vertexShader));
+  writeBytes(thread, description, Arcadia_ByteArrayBuilder_getBytes(thread, fragmentShader), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, fragmentShader));
+  return (Arcadia_Natural64Value)Arcadia_hashBytes(thread, Arcadia_ByteArrayBuilder_getBytes(thread, description), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, description));
+}
+
+static Arcadia_FilePath*
+getFilePath
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_String* key,
+    const char* extension
+  )
+{
+  Arcadia_StringBuilder* stringBuilder = Arcadia_StringBuilder_create(thread);
+  Arcadia_StringBuilder_insertBackString(thread, stringBuilder, key);
+  Arcadia_StringBuilder_insertBackCxxString(thread, stringBuilder, extension);
+  Arcadia_FilePath* filePath = Arcadia_FilePath_clone(thread, self->directory);
+  Arcadia_FilePath_append(thread, filePath, Arcadia_FilePath_parseGeneric(thread, Arcadia_String_create(thread, Arcadia_Value_makeObjectReferenceValue(stringBuilder))));
+  return filePath;
+}
+
+static Arcadia_ByteArrayBuilder*
+readFile
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_String* key,
+    const char* extension
+  )
+{
+  if (!self->directory) {
+    return NULL;
+  }
+  Arcadia_ByteArrayBuilder* contents = NULL;
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_FileSystem* fileSystem = Arcadia_FileSystem_getOrCreate(thread);
+    Arcadia_FilePath* filePath = getFilePath(thread, self, key, extension);
+    if (Arcadia_FileSystem_regularFileExists(thread, fileSystem, filePath)) {
+      contents = Arcadia_FileSystem_getFileContents(thread, fileSystem, filePath);
+    }
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    // A file which can not be read is a cache miss.
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+    contents = NULL;
+  }
+  return contents;
+}
+
+static void
+writeFile
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_String* key,
+    const char* extension,
+    Arcadia_ByteArrayBuilder* contents
+  )
+{
+  if (!self->directory) {
+    return;
+  }
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_FileSystem* fileSystem = Arcadia_FileSystem_getOrCreate(thread);
+    Arcadia_FilePath* filePath = getFilePath(thread, self, key, extension);
+    if (!Arcadia_FileSystem_directoryFileExists(thread, fileSystem, self->directory)) {
+      // Arcadia_FileSystem_createDirectoryFiles creates the directories of all components but the last one: Pass the path of the file.
+      Arcadia_FileSystem_createDirectoryFiles(thread, fileSystem, filePath);
+    }
+    Arcadia_FileSystem_setFileContents(thread, fileSystem, filePath, contents);
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    // If the cache can not be written to, disable the on-disk cache.
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+    self->directory = NULL;
+  }
+}
+
+static void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_constructImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self
+  )
+{
+  Arcadia_EnterConstructor(Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache);
+  {
+    Arcadia_ValueStack_pushNatural8Value(thread, 0);
+    Arcadia_superTypeConstructor(thread, _type, self);
+  }
+  if (0 != _numberOfArguments) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_NumberOfArgumentsInvalid);
+    Arcadia_Thread_jump(thread);
+  }
+  self->programResources = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
+  self->sources = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
+  self->directory = NULL;
+  self->statistics.programHits = 0;
+  self->statistics.programMisses = 0;
+  self->statistics.sourceHits = 0;
+  self->statistics.sourceMisses = 0;
+  self->statistics.binaryHits = 0;
+  self->statistics.binaryMisses = 0;
+
+  // If the save directory can not be determined, the on-disk cache is disabled.
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    Arcadia_FilePath* directory = Arcadia_FilePath_clone(thread, Arcadia_FileSystem_getSaveDirectory(thread, Arcadia_FileSystem_getOrCreate(thread)));
+    Arcadia_FilePath_append(thread, directory, Arcadia_FilePath_parseGeneric(thread, Arcadia_String_createFromCxxString(thread, u8"ProgramCache")));
+    self->directory = directory;
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_Success);
+  }
+
+  Arcadia_LeaveConstructor(Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache);
+}
+
+static void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_initializeDispatchImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCacheDispatch* self
+  )
+{ }
+
+static void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_visitImpl
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self
+  )
+{
+  if (self->programResources) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->programResources);
+  }
+  if (self->sources) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->sources);
+  }
+  if (self->directory) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->directory);
+  }
+}
+
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache*
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_create
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_SizeValue oldValueStackSize = Arcadia_ValueStack_getSize(thread);
+  Arcadia_ValueStack_pushNatural8Value(thread, 0);
+  ARCADIA_CREATEOBJECT(Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache);
+}
+
+Arcadia_String*
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_getKey
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_VPL_Symbols_Program* program
+  )
+{
+  // The key is the hash of a description of everything the GLSL sources are derived from:
+  // The fingerprint of the GLSL transpiler, the flags of the VPL program, and its definition (including the main procedures of its stages).
+  Arcadia_ByteArrayBuilder* description = Arcadia_ByteArrayBuilder_create(thread);
+  writeNatural32(thread, description, CacheVersion);
+  writeNatural32(thread, description, Arcadia_Configuration_Version_Major);
+  writeNatural32(thread, description, Arcadia_Configuration_Version_Minor);
+  writeBytes(thread, description, Arcadia_VPL_Configuration_GLSL_TranspilerFingerprint, sizeof(Arcadia_VPL_Configuration_GLSL_TranspilerFingerprint) - 1);
+  writeNatural32(thread, description, program->flags);
+  writeNode(thread, description, (Arcadia_VPL_Tree_Node*)program->programDefnNode);
+  Arcadia_List* constants = Arcadia_VPL_Symbols_Program_getConstants(thread, program);
+  for (Arcadia_SizeValue i = 0, n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)constants); i < n; ++i) {
+    Arcadia_VPL_Symbols_Constant* constant = (Arcadia_VPL_Symbols_Constant*)Arcadia_List_getObjectReferenceValueAt(thread, constants, i);
+    Arcadia_String* name = Arcadia_VPL_Symbols_Symbol_getName(thread, (Arcadia_VPL_Symbols_Symbol*)constant);
+    writeNatural32(thread, description, (Arcadia_Natural32Value)Arcadia_VPL_Symbols_Constant_getKind(thread, constant));
+    writeBytes(thread, description, Arcadia_String_getBytes(thread, name), Arcadia_String_getNumberOfBytes(thread, name));
+  }
+  Arcadia_Natural64Value hash = (Arcadia_Natural64Value)Arcadia_hashBytes(thread, Arcadia_ByteArrayBuilder_getBytes(thread, description), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, description));
+  char buffer[17];
+  snprintf(buffer, sizeof(buffer), "%016llx", (unsigned long long)hash);
+  return Arcadia_String_createFromCxxString(thread, buffer);
+}
+
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramResource*
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_getProgramResource
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_String* key
+  )
+{
+  Arcadia_Value value = Arcadia_Map_get(thread, self->programResources, Arcadia_Value_makeObjectReferenceValue(key));
+  if (Arcadia_Value_isObjectReferenceValue(&value)) {
+    Arcadia_Engine_Visuals_Implementation_Resource* resource = (Arcadia_Engine_Visuals_Implementation_Resource*)Arcadia_Value_getObjectReferenceValue(&value);
+    // An unlinked resource was removed from its backend context and must not be shared.
+    if (resource->context) {
+      self->statistics.programHits++;
+      return (Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramResource*)resource;
+    }
+    Arcadia_Map_remove(thread, self->programResources, Arcadia_Value_makeObjectReferenceValue(key), NULL, NULL);
+  }
+  self->statistics.programMisses++;
+  return NULL;
+}
+
+void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_setProgramResource
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_String* key,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramResource* programResource
+  )
+{
+  Arcadia_Map_set(thread, self->programResources, Arcadia_Value_makeObjectReferenceValue(key), Arcadia_Value_makeObjectReferenceValue(programResource), NULL, NULL);
+}
+
+Arcadia_BooleanValue
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_loadSource
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_String* key,
+    Arcadia_ByteArrayBuilder* vertexShader,
+    Arcadia_ByteArrayBuilder* fragmentShader,
+    Arcadia_Map* constantMapping,
+    Arcadia_String** fragmentColorOutput
+  )
+{
+  Arcadia_BooleanValue fromDisk = Arcadia_BooleanValue_False;
+  Arcadia_ByteArrayBuilder* record = NULL;
+  Arcadia_Value value = Arcadia_Map_get(thread, self->sources, Arcadia_Value_makeObjectReferenceValue(key));
+  if (Arcadia_Value_isObjectReferenceValue(&value)) {
+    record = (Arcadia_ByteArrayBuilder*)Arcadia_Value_getObjectReferenceValue(&value);
+  } else {
+    record = readFile(thread, self, key, u8".glsl");
+    fromDisk = Arcadia_BooleanValue_True;
+  }
+  // <magic> <number of constants> (<VPL name> <GLSL name>)* <fragment color output> <vertex shader> <fragment shader> <checksum>
+  Reader reader;
+  Arcadia_Natural32Value numberOfConstants;
+  if (!record || !Reader_open(thread, &reader, record, SourceMagic) || !Reader_readNatural32(&reader, &numberOfConstants)) {
+    self->statistics.sourceMisses++;
+    return Arcadia_BooleanValue_False;
+  }
+  // Validate the entire record before modifying the arguments.
+  Arcadia_SizeValue position = reader.position;
+  for (Arcadia_Natural32Value i = 0; i < 2 * numberOfConstants + 3; ++i) {
+    Arcadia_Natural8Value const* bytes;
+    Arcadia_Natural32Value numberOfBytes;
+    if (!Reader_readBytes(&reader, &bytes, &numberOfBytes)) {
+      self->statistics.sourceMisses++;
+      return Arcadia_BooleanValue_False;
+    }
+  }
+  if (reader.position != reader.numberOfBytes) {
+    self->statistics.sourceMisses++;
+    return Arcadia_BooleanValue_False;
+  }
+  reader.position = position;
+  for (Arcadia_Natural32Value i = 0; i < numberOfConstants; ++i) {
+    Arcadia_Natural8Value const* bytes;
+    Arcadia_Natural32Value numberOfBytes;
+    Reader_readBytes(&reader, &bytes, &numberOfBytes);
+    Arcadia_String* name = Arcadia_String_create_pn(thread, Arcadia_RuntimeByteArray_create(thread, bytes, numberOfBytes));
+    Reader_readBytes(&reader, &bytes, &numberOfBytes);
+    Arcadia_String* nameGL = Arcadia_String_create_pn(thread, Arcadia_RuntimeByteArray_create(thread, bytes, numberOfBytes));
+    Arcadia_Map_set(thread, constantMapping, Arcadia_Value_makeObjectReferenceValue(name), Arcadia_Value_makeObjectReferenceValue(nameGL), NULL, NULL);
+  }
+  Arcadia_Natural8Value const* bytes;
+  Arcadia_Natural32Value numberOfBytes;
+  Reader_readBytes(&reader, &bytes, &numberOfBytes);
+  *fragmentColorOutput = Arcadia_String_create_pn(thread, Arcadia_RuntimeByteArray_create(thread, bytes, numberOfBytes));
+  Reader_readBytes(&reader, &bytes, &numberOfBytes);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, vertexShader, bytes, numberOfBytes);
+  Reader_readBytes(&reader, &bytes, &numberOfBytes);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, fragmentShader, bytes, numberOfBytes);
+  if (fromDisk) {
+    Arcadia_Map_set(thread, self->sources, Arcadia_Value_makeObjectReferenceValue(key), Arcadia_Value_makeObjectReferenceValue(record), NULL, NULL);
+  }
+  self->statistics.sourceHits++;
+  return Arcadia_BooleanValue_True;
+}
+
+void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_storeSource
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_String* key,
+    Arcadia_ByteArrayBuilder* vertexShader,
+    Arcadia_ByteArrayBuilder* fragmentShader,
+    Arcadia_Map* constantMapping,
+    Arcadia_String* fragmentColorOutput
+  )
+{
+  Arcadia_ByteArrayBuilder* record = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, record, SourceMagic, 8);
+  Arcadia_List* names = Arcadia_Map_getKeys(thread, constantMapping);
+  Arcadia_SizeValue numberOfConstants = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)names);
+  writeNatural32(thread, record, (Arcadia_Natural32Value)numberOfConstants);
+  for (Arcadia_SizeValue i = 0; i < numberOfConstants; ++i) {
+    Arcadia_String* name = (Arcadia_String*)Arcadia_List_getObjectReferenceValueCheckedAt(thread, names, i, _Arcadia_String_getType(thread));
+    Arcadia_String* nameGL = (Arcadia_String*)Arcadia_Map_getObjectReferenceValueChecked(thread, constantMapping, Arcadia_Value_makeObjectReferenceValue(name), _Arcadia_String_getType(thread));
+    writeBytes(thread, record, Arcadia_String_getBytes(thread, name), Arcadia_String_getNumberOfBytes(thread, name));
+    writeBytes(thread, record, Arcadia_String_getBytes(thread, nameGL), Arcadia_String_getNumberOfBytes(thread, nameGL));
+  }
+  writeBytes(thread, record, Arcadia_String_getBytes(thread, fragmentColorOutput), Arcadia_String_getNumberOfBytes(thread, fragmentColorOutput));
+  writeBytes(thread, record, Arcadia_ByteArrayBuilder_getBytes(thread, vertexShader), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, vertexShader));
+  writeBytes(thread, record, Arcadia_ByteArrayBuilder_getBytes(thread, fragmentShader), Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, fragmentShader));
+  writeChecksum(thread, record);
+  Arcadia_Map_set(thread, self->sources, Arcadia_Value_makeObjectReferenceValue(key), Arcadia_Value_makeObjectReferenceValue(record), NULL, NULL);
+  writeFile(thread, self, key, u8".glsl", record);
+}
+
+Arcadia_BooleanValue
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_loadBinary
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_String* key,
+    Arcadia_String* driver,
+    Arcadia_ByteArrayBuilder* vertexShader,
+    Arcadia_ByteArrayBuilder* fragmentShader,
+    Arcadia_Natural32Value* format,
+    Arcadia_ByteArrayBuilder* binary
+  )
+{
+  // <magic> <driver> <sources hash> <format> <binary> <checksum>
+  Arcadia_ByteArrayBuilder* record = readFile(thread, self, key, u8".bin");
+  Reader reader;
+  Arcadia_Natural8Value const* bytes;
+  Arcadia_Natural32Value numberOfBytes;
+  Arcadia_Natural64Value sourcesHash;
+  Arcadia_Natural32Value temporary;
+  if (!record || !Reader_open(thread, &reader, record, BinaryMagic) || !Reader_readBytes(&reader, &bytes, &numberOfBytes)) {
+    self->statistics.binaryMisses++;
+    return Arcadia_BooleanValue_False;
+  }
+  if (numberOfBytes != Arcadia_String_getNumberOfBytes(thread, driver) || memcmp(bytes, Arcadia_String_getBytes(thread, driver), numberOfBytes)) {
+    self->statistics.binaryMisses++;
+    return Arcadia_BooleanValue_False;
+  }
+  // A program binary is only valid for the GLSL sources it was created from.
+  if (!Reader_readNatural64(&reader, &sourcesHash) || sourcesHash != hashSources(thread, vertexShader, fragmentShader)) {
+    self->statistics.binaryMisses++;
+    return Arcadia_BooleanValue_False;
+  }
+  if (!Reader_readNatural32(&reader, &temporary) || !Reader_readBytes(&reader, &bytes, &numberOfBytes) || reader.position != reader.numberOfBytes || !numberOfBytes) {
+    self->statistics.binaryMisses++;
+    return Arcadia_BooleanValue_False;
+  }
+  *format = temporary;
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, binary, bytes, numberOfBytes);
+  return Arcadia_BooleanValue_True;
+}
+
+void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_storeBinary
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_String* key,
+    Arcadia_String* driver,
+    Arcadia_ByteArrayBuilder* vertexShader,
+    Arcadia_ByteArrayBuilder* fragmentShader,
+    Arcadia_Natural32Value format,
+    void const* bytes,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  if (!self->directory) {
+    return;
+  }
+  Arcadia_ByteArrayBuilder* record = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, record, BinaryMagic, 8);
+  writeBytes(thread, record, Arcadia_String_getBytes(thread, driver), Arcadia_String_getNumberOfBytes(thread, driver));
+  writeNatural64(thread, record, hashSources(thread, vertexShader, fragmentShader));
+  writeNatural32(thread, record, format);
+  writeBytes(thread, record, bytes, numberOfBytes);
+  writeChecksum(thread, record);
+  writeFile(thread, self, key, u8".bin", record);
+}
+
+void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_getStatistics
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCacheStatistics* statistics
+  )
+{ *statistics = self->statistics; }
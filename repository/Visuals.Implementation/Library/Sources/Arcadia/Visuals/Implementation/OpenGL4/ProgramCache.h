@@ -0,0 +1,220 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#if !defined(ARCADIA_ENGINE_VISUALS_IMPLEMENTATION_OPENGL4_PROGRAMCACHE_H_INCLUDED)
+#define ARCADIA_ENGINE_VISUALS_IMPLEMENTATION_OPENGL4_PROGRAMCACHE_H_INCLUDED
+
+#include "Arcadia/Engine/Include.h"
+#include "Arcadia/FileSystem/Include.h"
+typedef struct Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramResource Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramResource;
+
+/// The hit and miss counters of a program cache.
+typedef struct Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCacheStatistics {
+  /// The number of program resources which were shared.
+  Arcadia_SizeValue programHits;
+  /// The number of program resources which had to be created.
+  Arcadia_SizeValue programMisses;
+  /// The number of GLSL sources which were found in memory or on disk.
+  Arcadia_SizeValue sourceHits;
+  /// The number of GLSL sources which had to be transpiled.
+  Arcadia_SizeValue sourceMisses;
+  /// The number of program binaries which were found on disk and accepted by the driver.
+  Arcadia_SizeValue binaryHits;
+  /// The number of program binaries which were not found on disk, were corrupted, were created by a different driver, or were rejected by the driver.
+  Arcadia_SizeValue binaryMisses;
+} Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCacheStatistics;
+
+/// A two level cache of programs.
+/// Programs are identified by a key computed from the definition of the VPL program, its variant flags, and the fingerprint of the GLSL transpiler.
+/// - In memory, the cache maps keys to program resources such that equivalent VPL programs share one OpenGL program.
+///   It also keeps the transpiled GLSL sources such that a program is transpiled at most once.
+/// - On disk, the cache stores the transpiled GLSL sources and, if the driver supports them, the program binaries in the directory "ProgramCache" of the save directory.
+///   Each file is validated by a checksum when it is loaded. Program binaries are in addition validated by the vendor, renderer, and version of the driver and by a hash of the GLSL sources they were created from.
+///   Invalid files are ignored and overwritten.
+Arcadia_declareObjectType(u8"Arcadia.Visuals.Implementation.OpenGL4.ProgramCache", Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache,
+                          u8"Arcadia.Object");
+
+struct Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCacheDispatch {
+  Arcadia_ObjectDispatch _parent;
+};
+
+struct Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache {
+  Arcadia_Object _parent;
+  // A map from keys to program resources.
+  Arcadia_Map* programResources;
+  // A map from keys to serialized GLSL sources.
+  Arcadia_Map* sources;
+  // The directory of the on-disk cache.
+  // Null if the on-disk cache is disabled.
+  Arcadia_FilePath* directory;
+  // The hit and miss counters.
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCacheStatistics statistics;
+};
+
+/// @brief Create a program cache.
+/// @param thread A pointer to this thread.
+/// @return A pointer to the program cache.
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache*
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_create
+  (
+    Arcadia_Thread* thread
+  );
+
+/// @brief Compute the key of a VPL program.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this program cache.
+/// @param program A pointer to the VPL program.
+/// @return The key, a string of 16 hexadecimal digits.
+/// @remarks The key changes if the definition of the VPL program (including the main procedures of its stages), its flags, or the GLSL transpiler change.
+Arcadia_String*
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_getKey
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_VPL_Symbols_Program* program
+  );
+
+/// @brief Get the program resource for a key.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this program cache.
+/// @param key A pointer to the key.
+/// @return A pointer to the program resource if a program resource for the key exists and was not unlinked, null otherwise.
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramResource*
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_getProgramResource
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_String* key
+  );
+
+/// @brief Set the program resource for a key.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this program cache.
+/// @param key A pointer to the key.
+/// @param programResource A pointer to the program resource.
+void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_setProgramResource
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_String* key,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramResource* programResource
+  );
+
+/// @brief Load the GLSL sources for a key from memory or from disk.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this program cache.
+/// @param key A pointer to the key.
+/// @param vertexShader A pointer to the byte array builder to which the zero-terminated vertex shader source is appended.
+/// @param fragmentShader A pointer to the byte array builder to which the zero-terminated fragment shader source is appended.
+/// @param constantMapping A pointer to the map to which the mapping from VPL constant names to GLSL names is added.
+/// @param fragmentColorOutput A pointer to a variable to which the GLSL name of the fragment color output is assigned.
+/// @return #Arcadia_BooleanValue_True if the sources were found, #Arcadia_BooleanValue_False otherwise.
+/// If #Arcadia_BooleanValue_False is returned, the arguments were not modified.
+Arcadia_BooleanValue
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_loadSource
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_String* key,
+    Arcadia_ByteArrayBuilder* vertexShader,
+    Arcadia_ByteArrayBuilder* fragmentShader,
+    Arcadia_Map* constantMapping,
+    Arcadia_String** fragmentColorOutput
+  );
+
+/// @brief Store the GLSL sources for a key in memory and on disk.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this program cache.
+/// @param key A pointer to the key.
+/// @param vertexShader A pointer to the byte array builder with the zero-terminated vertex shader source.
+/// @param fragmentShader A pointer to the byte array builder with the zero-terminated fragment shader source.
+/// @param constantMapping A pointer to the map from VPL constant names to GLSL names.
+/// @param fragmentColorOutput A pointer to the GLSL name of the fragment color output.
+/// @remarks Failures to write to disk are ignored.
+void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_storeSource
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_String* key,
+    Arcadia_ByteArrayBuilder* vertexShader,
+    Arcadia_ByteArrayBuilder* fragmentShader,
+    Arcadia_Map* constantMapping,
+    Arcadia_String* fragmentColorOutput
+  );
+
+/// @brief Load the program binary for a key from disk.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this program cache.
+/// @param key A pointer to the key.
+/// @param driver A pointer to the identification of the driver (its vendor, renderer, and version).
+/// @param vertexShader A pointer to the byte array builder with the zero-terminated vertex shader source.
+/// @param fragmentShader A pointer to the byte array builder with the zero-terminated fragment shader source.
+/// @param format A pointer to a variable to which the binary format is assigned.
+/// @param binary A pointer to the byte array builder to which the program binary is appended.
+/// @return #Arcadia_BooleanValue_True if a valid program binary created by the specified driver from the specified GLSL sources was found, #Arcadia_BooleanValue_False otherwise.
+/// If #Arcadia_BooleanValue_False is returned, the miss counter is incremented and the arguments were not modified.
+Arcadia_BooleanValue
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_loadBinary
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_String* key,
+    Arcadia_String* driver,
+    Arcadia_ByteArrayBuilder* vertexShader,
+    Arcadia_ByteArrayBuilder* fragmentShader,
+    Arcadia_Natural32Value* format,
+    Arcadia_ByteArrayBuilder* binary
+  );
+
+/// @brief Store the program binary for a key on disk.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this program cache.
+/// @param key A pointer to the key.
+/// @param driver A pointer to the identification of the driver (its vendor, renderer, and version).
+/// @param vertexShader A pointer to the byte array builder with the zero-terminated vertex shader source the program binary was created from.
+/// @param fragmentShader A pointer to the byte array builder with the zero-terminated fragment shader source the program binary was created from.
+/// @param format The binary format.
+/// @param bytes A pointer to an array of @a numberOfBytes Bytes, the program binary.
+/// @param numberOfBytes The number of Bytes in the array pointed to by @a bytes.
+/// @remarks Failures to write to disk are ignored.
+void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_storeBinary
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_String* key,
+    Arcadia_String* driver,
+    Arcadia_ByteArrayBuilder* vertexShader,
+    Arcadia_ByteArrayBuilder* fragmentShader,
+    Arcadia_Natural32Value format,
+    void const* bytes,
+    Arcadia_SizeValue numberOfBytes
+  );
+
+/// @brief Get the hit and miss counters of this program cache.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this program cache.
+/// @param statistics A pointer to the variable to which the counters are assigned.
+void
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_getStatistics
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* self,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCacheStatistics* statistics
+  );
+
+#endif // ARCADIA_ENGINE_VISUALS_IMPLEMENTATION_OPENGL4_PROGRAMCACHE_H_INCLUDED
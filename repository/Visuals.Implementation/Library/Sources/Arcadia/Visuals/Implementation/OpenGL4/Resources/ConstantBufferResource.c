@@ -147,7 +147,11 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource_constructIm
   }
   self->dirty = Arcadia_BooleanValue_True;
   self->byteBuffer = Arcadia_ByteArrayBuilder_create(thread);
-  self->bufferID = 0;
+  self->allocation.bufferID = 0;
+  self->allocation.offset = 0;
+  self->allocation.size = 0;
+  self->allocation.region = 0;
+  self->allocation.generation = 0;
   Arcadia_LeaveConstructor(Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource);
 }
 
@@ -175,9 +179,7 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource_destructImp
     Arcadia_Thread* thread,
     Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource* self
   )
-{
-  assert(0 == self->bufferID);
-}
+{/*Intentionally empty.*/}
 
 static void
 Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource_visitImpl
@@ -198,20 +200,7 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource_loadImpl
     Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource* self
   )
 {
-  Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext* context = (Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext*)((Arcadia_Engine_Visuals_Implementation_Resource*)self)->context;
-  _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl = Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext_getFunctions(thread, context);
-
-  if (0 == self->bufferID) {
-    gl->glGenBuffers(1, &self->bufferID);
-  }
-  if (self->dirty) {
-    gl->glBindBuffer(GL_UNIFORM_BUFFER, self->bufferID);
-    gl->glBufferData(GL_UNIFORM_BUFFER, Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, self->byteBuffer), Arcadia_ByteArrayBuilder_getBytes(thread, self->byteBuffer), GL_STATIC_DRAW);
-    if (gl->glGetError()) {
-      return;
-    }
-    self->dirty = Arcadia_BooleanValue_False;
-  }
+  // The Bytes are copied into a range of the buffer of the constant buffer allocator when this constant buffer resource is bound.
 }
 
 static void
@@ -221,12 +210,8 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource_unloadImpl
     Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource* self
   )
 {
-  if (self->bufferID) {
-    Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext* context = (Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext*)((Arcadia_Engine_Visuals_Implementation_Resource*)self)->context;
-    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl = Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext_getFunctions(thread, context);
-    gl->glDeleteBuffers(1, &self->bufferID);
-    self->bufferID = 0;
-  }
+  // The range is owned by the constant buffer allocator.
+  self->allocation.bufferID = 0;
 }
 
 static void
@@ -236,7 +221,6 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource_unlinkImpl
     Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource* self
   )
 {
-  assert(0 == self->bufferID);
   ((Arcadia_Engine_Visuals_Implementation_Resource*)self)->context = NULL;
 }
 
@@ -248,20 +232,7 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource_renderImpl
     Arcadia_Engine_Visuals_Implementation_EnterPassResource* enterPassResource
   )
 {
-  Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext* context = (Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext*)((Arcadia_Engine_Visuals_Implementation_Resource*)self)->context;
-  _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl = Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext_getFunctions(thread, context);
-
-  if (0 == self->bufferID) {
-    gl->glGenBuffers(1, &self->bufferID);
-  }
-  if (self->dirty) {
-    gl->glBindBuffer(GL_UNIFORM_BUFFER, self->bufferID);
-    gl->glBufferData(GL_UNIFORM_BUFFER, Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, self->byteBuffer), Arcadia_ByteArrayBuilder_getBytes(thread, self->byteBuffer), GL_STATIC_DRAW);
-    if (gl->glGetError()) {
-      return;
-    }
-    self->dirty = Arcadia_BooleanValue_False;
-  }
+  // The Bytes are copied into a range of the buffer of the constant buffer allocator when this constant buffer resource is bound.
 }
 
 static void
@@ -295,6 +266,7 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource_writeColor4
   )
 {
   Arcadia_ByteArrayBuilder_insertBackBytes(thread, self->byteBuffer, &(source->components[0]), sizeof(float) * 4);
+  self->dirty = Arcadia_BooleanValue_True;
 }
 
 static inline void
@@ -334,3 +306,43 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource_create
   Arcadia_ValueStack_pushNatural8Value(thread, 1);
   ARCADIA_CREATEOBJECT(Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource);
 }
+
+Arcadia_BooleanValue
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource_bind
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource* self,
+    GLuint index
+  )
+{
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext* context = (Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext*)((Arcadia_Engine_Visuals_Implementation_Resource*)self)->context;
+  _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl = Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext_getFunctions(thread, context);
+
+  // Copy the Bytes into a new range if they were modified or if their range was invalidated.
+  if (self->dirty || !Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_isValid(thread, context->constantBufferAllocator, &self->allocation)) {
+    if (!Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_allocate(thread, context->constantBufferAllocator, gl,
+                                                                                         Arcadia_ByteArrayBuilder_getBytes(thread, self->byteBuffer),
+                                                                                         Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, self->byteBuffer),
+                                                                                         &self->allocation)) {
+      return Arcadia_BooleanValue_False;
+    }
+    self->dirty = Arcadia_BooleanValue_False;
+  }
+  while (gl->glGetError()) { }
+  gl->glBindBufferRange(GL_UNIFORM_BUFFER, index, self->allocation.bufferID, self->allocation.offset, self->allocation.size);
+  if (gl->glGetError()) {
+    return Arcadia_BooleanValue_False;
+  }
+  return Arcadia_BooleanValue_True;
+}
+
+Arcadia_BooleanValue
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource_isValid
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource* self
+  )
+{
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext* context = (Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext*)((Arcadia_Engine_Visuals_Implementation_Resource*)self)->context;
+  return !self->dirty && Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_isValid(thread, context->constantBufferAllocator, &self->allocation);
+}
@@ -18,6 +18,7 @@
 
 #include "Arcadia/Engine/Include.h"
 #include "Arcadia/Visuals/Implementation/OpenGL4/BackendIncludes.h"
+#include "Arcadia/Visuals/Implementation/OpenGL4/ConstantBufferAllocator.h"
 typedef struct Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext;
 
 Arcadia_declareObjectType(u8"Arcadia.Visuals.Implementation.OpenGL4.ConstantBufferResource", Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource,
@@ -29,9 +30,12 @@ struct Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResourceDispa
 
 struct Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource {
   Arcadia_Engine_Visuals_Implementation_ConstantBufferResource _parent;
+  // If the Bytes were modified since they were last copied into a range.
   Arcadia_BooleanValue dirty;
+  // The Bytes.
   Arcadia_ByteArrayBuilder* byteBuffer;
-  GLuint bufferID;
+  // The range of the buffer of the constant buffer allocator to which the Bytes were last copied.
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocation allocation;
 };
 
 Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource*
@@ -41,4 +45,29 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource_create
     Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext* backendContext
   );
 
+/// @brief Bind this constant buffer resource to a uniform buffer binding point.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this constant buffer resource.
+/// @param index The index of the uniform buffer binding point.
+/// @return #Arcadia_BooleanValue_True on success, #Arcadia_BooleanValue_False on failure.
+/// @remarks If the Bytes were modified or their range was invalidated, a new range is allocated and the Bytes are copied into it.
+Arcadia_BooleanValue
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource_bind
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource* self,
+    GLuint index
+  );
+
+/// @brief Get if the range of this constant buffer resource is valid.
+/// @param thread A pointer to this thread.
+/// @param self A pointer to this constant buffer resource.
+/// @return #Arcadia_BooleanValue_True if the range is valid, #Arcadia_BooleanValue_False otherwise.
+Arcadia_BooleanValue
+Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource_isValid
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource* self
+  );
+
 #endif // ARCADIA_ENGINE_VISUALS_IMPLEMENTATION_OPENGL4_RESOURCES_CONSTANTBUFFERRESOURCE_H_INCLUDED
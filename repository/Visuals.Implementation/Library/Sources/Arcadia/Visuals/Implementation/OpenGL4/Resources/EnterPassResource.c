@@ -222,6 +222,10 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_EnterPassResource_renderImpl
                         - ((Arcadia_Engine_Visuals_Implementation_EnterPassResource*)self)->canvasSize.width * ((Arcadia_Engine_Visuals_Implementation_EnterPassResource*)self)->relativeViewportRectangle.left,
                       h = ((Arcadia_Engine_Visuals_Implementation_EnterPassResource*)self)->canvasSize.height * ((Arcadia_Engine_Visuals_Implementation_EnterPassResource*)self)->relativeViewportRectangle.top
                         - ((Arcadia_Engine_Visuals_Implementation_EnterPassResource*)self)->canvasSize.height * ((Arcadia_Engine_Visuals_Implementation_EnterPassResource*)self)->relativeViewportRectangle.bottom;
+  // Objects may have been bound or deleted outside of the draws of the previous pass.
+  context->bound.program = 0;
+  context->bound.vertexArray = 0;
+  context->bound.texture = 0;
   gl->glViewport(l, b, w, h);
   gl->glEnable(GL_SCISSOR_TEST);
   gl->glScissor(l, b, w, h);
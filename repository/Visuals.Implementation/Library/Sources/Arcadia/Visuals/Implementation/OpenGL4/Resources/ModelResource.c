@@ -190,40 +190,53 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_ModelResource_renderImpl
   Arcadia_Engine_Visuals_Implementation_Resource_render(thread, (Arcadia_Engine_Visuals_Implementation_Resource*)material, enterPassResource);
   Arcadia_Engine_Visuals_Implementation_Resource_render(thread, (Arcadia_Engine_Visuals_Implementation_Resource*)meshVertexBuffer, enterPassResource);
 
-  //
-  gl->glUseProgram(material->program->programID);
-  //
-  gl->glBindFragDataLocation(material->program->programID, 0, Arcadia_String_getBytes(thread, material->program->fragmentColorOutput));
-  gl->glBindVertexArray(meshVertexBuffer->vertexArrayID);
+  // Only bind the program, the vertex array, and the texture if they are not already bound.
+  // Consecutive draws of models with the same state (see Arcadia_Engine_Visuals_SceneNode) skip these.
+  if (context->bound.program != material->program->programID) {
+    gl->glUseProgram(material->program->programID);
+    //
+    gl->glBindFragDataLocation(material->program->programID, 0, Arcadia_String_getBytes(thread, material->program->fragmentColorOutput));
+    context->bound.program = material->program->programID;
+  }
+  if (context->bound.vertexArray != meshVertexBuffer->vertexArrayID) {
+    gl->glBindVertexArray(meshVertexBuffer->vertexArrayID);
+    context->bound.vertexArray = meshVertexBuffer->vertexArrayID;
+  }
 
   //
   if (material->ambientColorSource == Arcadia_Engine_Visuals_Implementation_MaterialResource_AmbientColorSource_Texture) {
-    while (gl->glGetError()) { }
     assert(0 != material->ambientColorTexture->id);
-    gl->glActiveTexture(GL_TEXTURE0);
-    gl->glBindTexture(GL_TEXTURE_2D, material->ambientColorTexture->id);
-    if (gl->glGetError()) {
-      return;
+    if (context->bound.texture != material->ambientColorTexture->id) {
+      while (gl->glGetError()) { }
+      gl->glActiveTexture(GL_TEXTURE0);
+      gl->glBindTexture(GL_TEXTURE_2D, material->ambientColorTexture->id);
+      if (gl->glGetError()) {
+        context->bound.texture = 0;
+        return;
+      }
+      context->bound.texture = material->ambientColorTexture->id;
     }
   }
-  GLuint uniformBlockBindingIndex;
-  // Bind the "viewer" constant block.
-  uniformBlockBindingIndex = getUniformBlockBindingIndex(thread, material->program, Arcadia_String_createFromCxxString(thread, u8"viewer"));
-  gl->glBindBufferBase(GL_UNIFORM_BUFFER, uniformBlockBindingIndex, viewerConstantBuffer->bufferID);
-  if (gl->glGetError()) {
-    return;
-  }
-  // Bind the "mesh" constant block.
-  uniformBlockBindingIndex = getUniformBlockBindingIndex(thread, material->program, Arcadia_String_createFromCxxString(thread, u8"mesh"));
-  gl->glBindBufferBase(GL_UNIFORM_BUFFER, uniformBlockBindingIndex, meshConstantBuffer->bufferID);
-  if (gl->glGetError()) {
-    return;
-  }
-  // Bind the "model" constant block.
-  uniformBlockBindingIndex = getUniformBlockBindingIndex(thread, material->program, Arcadia_String_createFromCxxString(thread, u8"model"));
-  gl->glBindBufferBase(GL_UNIFORM_BUFFER, uniformBlockBindingIndex, constantBuffer->bufferID);
-  if (gl->glGetError()) {
-    return;
+  GLuint viewerBindingIndex = getUniformBlockBindingIndex(thread, material->program, Arcadia_String_createFromCxxString(thread, u8"viewer")),
+         meshBindingIndex = getUniformBlockBindingIndex(thread, material->program, Arcadia_String_createFromCxxString(thread, u8"mesh")),
+         modelBindingIndex = getUniformBlockBindingIndex(thread, material->program, Arcadia_String_createFromCxxString(thread, u8"model"));
+  // Bind the "viewer", "mesh", and "model" constant blocks.
+  // If the buffer of the constant buffer allocator is orphaned while a constant buffer is bound, the ranges of the constant buffers bound before are invalidated.
+  // In that case, bind the constant buffers again. As the buffer was just orphaned, the second attempt does not orphan it again.
+  for (Arcadia_SizeValue attempt = 0; attempt < 2; ++attempt) {
+    if (!Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource_bind(thread, viewerConstantBuffer, viewerBindingIndex)) {
+      return;
+    }
+    if (!Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource_bind(thread, meshConstantBuffer, meshBindingIndex)) {
+      return;
+    }
+    if (!Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource_bind(thread, constantBuffer, modelBindingIndex)) {
+      return;
+    }
+    if (Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource_isValid(thread, viewerConstantBuffer) &&
+        Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferResource_isValid(thread, meshConstantBuffer)) {
+      break;
+    }
   }
   //
   gl->glDrawArrays(GL_TRIANGLES, 0, Arcadia_Engine_Visuals_Implementation_VertexBufferResource_getNumberOfVertices(thread, (Arcadia_Engine_Visuals_Implementation_VertexBufferResource*)((Arcadia_Engine_Visuals_Implementation_ModelResource*)self)->meshVertexBuffer));
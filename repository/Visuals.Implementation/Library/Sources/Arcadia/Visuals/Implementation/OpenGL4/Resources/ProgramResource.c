@@ -17,7 +17,9 @@
 
 #include "Arcadia/Visuals/Implementation/OpenGL4/BackendContext.h"
 #include "Arcadia/Visuals/Implementation/OpenGL4/BackendIncludes.h"
+#include "Arcadia/Visuals/Implementation/OpenGL4/ProgramCache.h"
 #include <assert.h>
+#include <limits.h>
 #include "Arcadia/VPL/Include.h"
 
 #define VertexShaderDirty (1)
@@ -57,16 +59,63 @@ typedef enum ShaderType {
   FragmentShader,
 } ShaderType;
 
+static void
+transpile
+  (
+    Arcadia_Thread* thread,
+    Arcadia_VPL_Symbols_Program* program,
+    Arcadia_Map* constantMapping,
+    Arcadia_String** fragmentColorOutput,
+    Arcadia_ByteArrayBuilder* vertexShader,
+    Arcadia_ByteArrayBuilder* fragmentShader
+  );
+
 static GLuint
 createShader
   (
     Arcadia_Thread* thread,
     _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl,
     ShaderType shaderType,
-    Arcadia_Map* constantMapping,
-    Arcadia_Map* variableScalarMapping,
-    Arcadia_String** fragmentColorOutput,
-    Arcadia_VPL_Symbols_Program* program
+    Arcadia_ByteArrayBuilder* code
+  );
+
+static Arcadia_BooleanValue
+isProgramBinarySupported
+  (
+    Arcadia_Thread* thread,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl
+  );
+
+static Arcadia_String*
+getDriver
+  (
+    Arcadia_Thread* thread,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl
+  );
+
+static GLuint
+createProgramFromBinary
+  (
+    Arcadia_Thread* thread,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* programCache,
+    Arcadia_String* key,
+    Arcadia_String* driver,
+    Arcadia_ByteArrayBuilder* vertexShader,
+    Arcadia_ByteArrayBuilder* fragmentShader
+  );
+
+static void
+storeProgramBinary
+  (
+    Arcadia_Thread* thread,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* programCache,
+    Arcadia_String* key,
+    Arcadia_String* driver,
+    Arcadia_ByteArrayBuilder* vertexShader,
+    Arcadia_ByteArrayBuilder* fragmentShader,
+    GLuint programID
   );
 
 static void
@@ -140,6 +189,7 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramResource_constructImpl
   self->fragmentShaderID = 0;
   self->programID = 0;
   self->program = Arcadia_ValueStack_getObjectReferenceValueChecked(thread, 1, _Arcadia_VPL_Symbols_Program_getType(thread));
+  self->key = NULL;
   self->constantMapping = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
   self->constantBindings = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
   self->fragmentColorOutput = NULL;
@@ -188,21 +238,40 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramResource_visitImpl
   if (self->fragmentColorOutput) {
     Arcadia_Object_visit(thread, (Arcadia_Object*)self->fragmentColorOutput);
   }
+  if (self->key) {
+    Arcadia_Object_visit(thread, (Arcadia_Object*)self->key);
+  }
   if (self->program) {
     Arcadia_Object_visit(thread, (Arcadia_Object*)self->program);
   }
 }
 
+static void
+transpile
+  (
+    Arcadia_Thread* thread,
+    Arcadia_VPL_Symbols_Program* program,
+    Arcadia_Map* constantMapping,
+    Arcadia_String** fragmentColorOutput,
+    Arcadia_ByteArrayBuilder* vertexShader,
+    Arcadia_ByteArrayBuilder* fragmentShader
+  )
+{
+  Arcadia_Map* vertexShaderVariableScalarMapping = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
+  Arcadia_Map* fragmentShaderVariableScalarMapping = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
+  Arcadia_VPL_Backends_GLSL_Transpiler* transpiler = Arcadia_VPL_Backends_GLSL_Transpiler_create(thread);
+  Arcadia_VPL_Backends_GLSL_Transpiler_writeDefaultVertexShader(thread, transpiler, program, constantMapping, vertexShaderVariableScalarMapping, vertexShader);
+  transpiler = Arcadia_VPL_Backends_GLSL_Transpiler_create(thread);
+  Arcadia_VPL_Backends_GLSL_Transpiler_writeDefaultFragmentShader(thread, transpiler, program, constantMapping, fragmentShaderVariableScalarMapping, fragmentColorOutput, fragmentShader);
+}
+
 static GLuint
 createShader
   (
     Arcadia_Thread* thread,
     _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl,
     ShaderType shaderType,
-    Arcadia_Map* constantMapping,
-    Arcadia_Map* variableScalarMapping,
-    Arcadia_String** fragmentColorOutput,
-    Arcadia_VPL_Symbols_Program* program
+    Arcadia_ByteArrayBuilder* code
   )
 {
   GLuint id = 0;
@@ -220,21 +289,6 @@ createShader
   if (0 == id) {
     return id;
   }
-  Arcadia_ByteArrayBuilder* code = Arcadia_ByteArrayBuilder_create(thread);
-  switch (shaderType) {
-    case VertexShader: {
-      Arcadia_VPL_Backends_GLSL_Transpiler* transpiler = Arcadia_VPL_Backends_GLSL_Transpiler_create(thread);
-      Arcadia_VPL_Backends_GLSL_Transpiler_writeDefaultVertexShader(thread, transpiler, program, constantMapping, variableScalarMapping, code);
-      *fragmentColorOutput = NULL;
-    } break;
-    case FragmentShader: {
-      Arcadia_VPL_Backends_GLSL_Transpiler* transpiler = Arcadia_VPL_Backends_GLSL_Transpiler_create(thread);
-      Arcadia_VPL_Backends_GLSL_Transpiler_writeDefaultFragmentShader(thread, transpiler, program, constantMapping, variableScalarMapping, fragmentColorOutput, code);
-    } break;
-    default: {
-      return Arcadia_BooleanValue_False;
-    } break;
-  };
   // (1) set shader source
   while (gl->glGetError()) { }
   const GLchar* temporary = Arcadia_ByteArrayBuilder_getBytes(thread, code);
@@ -274,6 +328,131 @@ createShader
   return id;
 }
 
+static Arcadia_BooleanValue
+isProgramBinarySupported
+  (
+    Arcadia_Thread* thread,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl
+  )
+{
+  if (!gl->glGetProgramBinary || !gl->glProgramBinary || !gl->glProgramParameteri) {
+    return Arcadia_BooleanValue_False;
+  }
+  // The entry points might be available even if the context does not support program binaries.
+  // If the query fails or the driver does not support any format, program binaries are not supported.
+  GLint numberOfFormats = 0;
+  while (gl->glGetError()) { }
+  gl->glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numberOfFormats);
+  if (gl->glGetError()) {
+    return Arcadia_BooleanValue_False;
+  }
+  return numberOfFormats > 0;
+}
+
+static Arcadia_String*
+getDriver
+  (
+    Arcadia_Thread* thread,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl
+  )
+{
+  static const GLenum names[] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+  Arcadia_StringBuilder* stringBuilder = Arcadia_StringBuilder_create(thread);
+  for (Arcadia_SizeValue i = 0; i < sizeof(names) / sizeof(names[0]); ++i) {
+    const GLubyte* value = gl->glGetString(names[i]);
+    if (i > 0) {
+      Arcadia_StringBuilder_insertBackCxxString(thread, stringBuilder, u8"\n");
+    }
+    if (value) {
+      Arcadia_StringBuilder_insertBackCxxString(thread, stringBuilder, (const char*)value);
+    }
+  }
+  return Arcadia_String_create(thread, Arcadia_Value_makeObjectReferenceValue(stringBuilder));
+}
+
+static GLuint
+createProgramFromBinary
+  (
+    Arcadia_Thread* thread,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* programCache,
+    Arcadia_String* key,
+    Arcadia_String* driver,
+    Arcadia_ByteArrayBuilder* vertexShader,
+    Arcadia_ByteArrayBuilder* fragmentShader
+  )
+{
+  Arcadia_Natural32Value format;
+  Arcadia_ByteArrayBuilder* binary = Arcadia_ByteArrayBuilder_create(thread);
+  if (!Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_loadBinary(thread, programCache, key, driver, vertexShader, fragmentShader, &format, binary)) {
+    return 0;
+  }
+  if (Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, binary) > INT_MAX) {
+    programCache->statistics.binaryMisses++;
+    return 0;
+  }
+  GLuint id = gl->glCreateProgram();
+  if (0 == id) {
+    programCache->statistics.binaryMisses++;
+    return 0;
+  }
+  // The driver validates the binary.
+  // It rejects binaries which were created by a different driver or are otherwise incompatible.
+  while (gl->glGetError()) { }
+  gl->glProgramBinary(id, (GLenum)format, Arcadia_ByteArrayBuilder_getBytes(thread, binary), (GLsizei)Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, binary));
+  GLint success = GL_FALSE;
+  if (!gl->glGetError()) {
+    gl->glGetProgramiv(id, GL_LINK_STATUS, &success);
+  }
+  if (!success) {
+    gl->glDeleteProgram(id);
+    programCache->statistics.binaryMisses++;
+    return 0;
+  }
+  programCache->statistics.binaryHits++;
+  return id;
+}
+
+static void
+storeProgramBinary
+  (
+    Arcadia_Thread* thread,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* programCache,
+    Arcadia_String* key,
+    Arcadia_String* driver,
+    Arcadia_ByteArrayBuilder* vertexShader,
+    Arcadia_ByteArrayBuilder* fragmentShader,
+    GLuint programID
+  )
+{
+  GLint numberOfBytes = 0;
+  while (gl->glGetError()) { }
+  gl->glGetProgramiv(programID, GL_PROGRAM_BINARY_LENGTH, &numberOfBytes);
+  if (gl->glGetError() || numberOfBytes <= 0) {
+    return;
+  }
+  void* bytes = Arcadia_Memory_allocateUnmanaged(thread, (Arcadia_SizeValue)numberOfBytes);
+  Arcadia_JumpTarget jumpTarget;
+  Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
+  if (Arcadia_JumpTarget_save(&jumpTarget)) {
+    GLenum format = 0;
+    GLsizei length = 0;
+    gl->glGetProgramBinary(programID, numberOfBytes, &length, &format, bytes);
+    if (!gl->glGetError() && length > 0) {
+      Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_storeBinary(thread, programCache, key, driver, vertexShader, fragmentShader, format, bytes, (Arcadia_SizeValue)length);
+    }
+    Arcadia_Thread_popJumpTarget(thread);
+  } else {
+    Arcadia_Thread_popJumpTarget(thread);
+    Arcadia_Memory_deallocateUnmanaged(thread, bytes);
+    bytes = NULL;
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Memory_deallocateUnmanaged(thread, bytes);
+  bytes = NULL;
+}
+
 // @return The OpenGL/GLSL uniform location for a VPL constant scalar.
 static GLuint
 getUniformLocation
@@ -315,9 +494,6 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramResource_loadImpl
     Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramResource* self
   )
 {
-  Arcadia_Map* vertexShaderVariableScalarMapping = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
-  Arcadia_Map* fragmentShaderVariableScalarMapping = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
-
   Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext* context = (Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext*)((Arcadia_Engine_Visuals_Implementation_Resource*)self)->context;
   _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl = Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext_getFunctions(thread, context);
 
@@ -331,6 +507,9 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramResource_loadImpl
     Arcadia_Collection_clear(thread, (Arcadia_Collection*)self->constantMapping);
 
     if (self->programID) {
+      if (context->bound.program == self->programID) {
+        context->bound.program = 0;
+      }
       gl->glDeleteProgram(self->programID);
       self->programID = 0;
     }
@@ -343,43 +522,65 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramResource_loadImpl
       self->vertexShaderID = 0;
     }
   }
-  if (0 == self->vertexShaderID) {
-    Arcadia_String* dummy = NULL;
-    self->vertexShaderID = createShader(thread, gl, VertexShader, self->constantMapping, vertexShaderVariableScalarMapping , &dummy, self->program);
-    if (!self->vertexShaderID) {
-      return;
-    }
-  }
-  if (0 == self->fragmentShaderID) {
-    self->fragmentShaderID = createShader(thread, gl, FragmentShader, self->constantMapping, fragmentShaderVariableScalarMapping, &self->fragmentColorOutput, self->program);
-    if (!self->fragmentShaderID) {
-      return;
-    }
-  }
   if (0 == self->programID) {
-    self->programID = gl->glCreateProgram();
-    if (0 == self->programID) {
-      return;
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* programCache = context->programCache;
+    if (!self->key) {
+      self->key = Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_getKey(thread, programCache, self->program);
     }
-    // (1) attach vertex program
-    while (gl->glGetError()) { }
-    gl->glAttachShader(self->programID, self->vertexShaderID);
-    if (gl->glGetError()) {
-      return;
+    // (1) Get the GLSL sources from the program cache or transpile the VPL program.
+    Arcadia_ByteArrayBuilder* vertexShader = Arcadia_ByteArrayBuilder_create(thread);
+    Arcadia_ByteArrayBuilder* fragmentShader = Arcadia_ByteArrayBuilder_create(thread);
+    Arcadia_Collection_clear(thread, (Arcadia_Collection*)self->constantMapping);
+    if (!Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_loadSource(thread, programCache, self->key, vertexShader, fragmentShader, self->constantMapping, &self->fragmentColorOutput)) {
+      transpile(thread, self->program, self->constantMapping, &self->fragmentColorOutput, vertexShader, fragmentShader);
+      Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_storeSource(thread, programCache, self->key, vertexShader, fragmentShader, self->constantMapping, self->fragmentColorOutput);
     }
-    // (2) attach fragment program
-    while (gl->glGetError()) { }
-    gl->glAttachShader(self->programID, self->fragmentShaderID);
-    if (gl->glGetError()) {
-      return;
+    // (2) Create the program from a program binary in the program cache.
+    // If this fails, compile and link the program and store its program binary in the program cache.
+    Arcadia_BooleanValue programBinarySupported = isProgramBinarySupported(thread, gl);
+    Arcadia_String* driver = programBinarySupported ? getDriver(thread, gl) : NULL;
+    if (programBinarySupported) {
+      self->programID = createProgramFromBinary(thread, gl, programCache, self->key, driver, vertexShader, fragmentShader);
     }
-    // (3) link program
-    while (gl->glGetError()) { }
-    gl->glLinkProgram(self->programID);
-    GLint success = GL_FALSE;
-    gl->glGetProgramiv(self->programID, GL_LINK_STATUS, &success);
-    if (!success) {
-      return;
+    if (0 == self->programID) {
+      self->vertexShaderID = createShader(thread, gl, VertexShader, vertexShader);
+      if (!self->vertexShaderID) {
+        return;
+      }
+      self->fragmentShaderID = createShader(thread, gl, FragmentShader, fragmentShader);
+      if (!self->fragmentShaderID) {
+        return;
+      }
+      self->programID = gl->glCreateProgram();
+      if (0 == self->programID) {
+        return;
+      }
+      if (programBinarySupported) {
+        gl->glProgramParameteri(self->programID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+      }
+      // (1) attach vertex program
+      while (gl->glGetError()) { }
+      gl->glAttachShader(self->programID, self->vertexShaderID);
+      if (gl->glGetError()) {
+        return;
+      }
+      // (2) attach fragment program
+      while (gl->glGetError()) { }
+      gl->glAttachShader(self->programID, self->fragmentShaderID);
+      if (gl->glGetError()) {
+        return;
+      }
+      // (3) link program
+      while (gl->glGetError()) { }
+      gl->glLinkProgram(self->programID);
+      GLint success = GL_FALSE;
+      gl->glGetProgramiv(self->programID, GL_LINK_STATUS, &success);
+      if (!success) {
+        return;
+      }
+      if (programBinarySupported) {
+        storeProgramBinary(thread, gl, programCache, self->key, driver, vertexShader, fragmentShader, self->programID);
+      }
     }
     // Rebuilt the bindings.
     Arcadia_List* constants = Arcadia_VPL_Symbols_Program_getConstants(thread, self->program);
@@ -428,6 +629,9 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramResource_unloadImpl
   if (self->programID) {
     Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext* context = (Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext*)((Arcadia_Engine_Visuals_Implementation_Resource*)self)->context;
     _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl = Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext_getFunctions(thread, context);
+    if (context->bound.program == self->programID) {
+      context->bound.program = 0;
+    }
     gl->glDeleteProgram(self->programID);
     self->programID = 0;
   }
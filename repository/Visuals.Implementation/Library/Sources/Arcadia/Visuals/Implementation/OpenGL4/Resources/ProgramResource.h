@@ -32,6 +32,9 @@ struct Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramResource {
   Arcadia_Natural8Value dirty;
   /// The underlaying VPL program.
   Arcadia_VPL_Symbols_Program* program;
+  /// The key of the VPL program in the program cache.
+  /// Null if the key was not computed yet.
+  Arcadia_String* key;
   // The OpenGL ID of the fragment shader.
   GLuint fragmentShaderID;
   // The OpenGL ID of the vertex shader.
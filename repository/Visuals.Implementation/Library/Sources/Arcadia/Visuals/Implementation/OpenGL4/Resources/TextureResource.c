@@ -22,7 +22,36 @@
 #define AddressModeVDirty (2)
 #define MagnificationFilterDirty (8)
 #define MinificationFilterDirty (16)
-#define PixelsDirty (64)
+
+static void
+getFormat
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_PixelFormat pixelFormat,
+    GLenum* internalFormat,
+    GLenum* format,
+    GLenum* type
+  );
+
+static void
+allocateStorage
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_TextureResource* self,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl
+  );
+
+static void
+uploadPixels
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_TextureResource* self,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl,
+    Arcadia_Integer32Value left,
+    Arcadia_Integer32Value top,
+    Arcadia_Integer32Value width,
+    Arcadia_Integer32Value height
+  );
 
 static void
 Arcadia_Engine_Visuals_Implementation_OpenGL4_TextureResource_constructImpl
@@ -196,6 +225,167 @@ Arcadia_defineObjectType(u8"Arcadia.Visuals.Implementation.OpenGL4.TextureResour
                          u8"Arcadia.Visuals.Implementation.TextureResource", Arcadia_Engine_Visuals_Implementation_TextureResource,
                          &_typeOperations);
 
+// Get the internal format, the format, and the type of a pixel format.
+// The format and the type are chosen such that the Bytes of the pixels are uploaded without conversion.
+static void
+getFormat
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Media_PixelFormat pixelFormat,
+    GLenum* internalFormat,
+    GLenum* format,
+    GLenum* type
+  )
+{
+  // The Bytes A, B, G, R (A, R, G, B) are a packed 32 bit value with the components R, G, B, A (B, G, R, A) from the most significant to the least significant Byte.
+#if Arcadia_Configuration_ByteOrder == Arcadia_Configuration_ByteOrder_LittleEndian
+  static const GLenum packedType = GL_UNSIGNED_INT_8_8_8_8;
+#else
+  static const GLenum packedType = GL_UNSIGNED_INT_8_8_8_8_REV;
+#endif
+  switch (pixelFormat) {
+    case Arcadia_Media_PixelFormat_AlphaBlueGreenRedNatural8: {
+      *internalFormat = GL_RGBA8;
+      *format = GL_RGBA;
+      *type = packedType;
+    } break;
+    case Arcadia_Media_PixelFormat_AlphaRedGreenBlueNatural8: {
+      *internalFormat = GL_RGBA8;
+      *format = GL_BGRA;
+      *type = packedType;
+    } break;
+    case Arcadia_Media_PixelFormat_BlueGreenRedNatural8: {
+      *internalFormat = GL_RGB8;
+      *format = GL_BGR;
+      *type = GL_UNSIGNED_BYTE;
+    } break;
+    case Arcadia_Media_PixelFormat_BlueGreenRedAlphaNatural8: {
+      *internalFormat = GL_RGBA8;
+      *format = GL_BGRA;
+      *type = GL_UNSIGNED_BYTE;
+    } break;
+    case Arcadia_Media_PixelFormat_RedGreenBlueNatural8: {
+      *internalFormat = GL_RGB8;
+      *format = GL_RGB;
+      *type = GL_UNSIGNED_BYTE;
+    } break;
+    case Arcadia_Media_PixelFormat_RedGreenBlueAlphaNatural8: {
+      *internalFormat = GL_RGBA8;
+      *format = GL_RGBA;
+      *type = GL_UNSIGNED_BYTE;
+    } break;
+    default: {
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+      Arcadia_Thread_jump(thread);
+    } break;
+  };
+}
+
+// Allocate the storage of the texture for the width, the height, and the pixel format of the pixel buffer.
+// The storage includes all mipmap levels.
+// If the driver supports glTexStorage2D (OpenGL 4.2 or ARB_texture_storage), the storage is immutable.
+static void
+allocateStorage
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_TextureResource* self,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl
+  )
+{
+  Arcadia_Integer32Value width = Arcadia_Media_PixelBuffer_getWidth(thread, self->pixelBuffer),
+                         height = Arcadia_Media_PixelBuffer_getHeight(thread, self->pixelBuffer);
+  Arcadia_Media_PixelFormat pixelFormat = Arcadia_Media_PixelBuffer_getPixelFormat(thread, self->pixelBuffer);
+  GLenum internalFormat, format, type;
+  getFormat(thread, pixelFormat, &internalFormat, &format, &type);
+  GLsizei levels = 1;
+  for (Arcadia_Integer32Value size = width > height ? width : height; size > 1; size /= 2) {
+    levels++;
+  }
+  while (gl->glGetError()) { }
+  if (gl->glTexStorage2D) {
+    gl->glTexStorage2D(GL_TEXTURE_2D, levels, internalFormat, width, height);
+  } else {
+    GLsizei levelWidth = width, levelHeight = height;
+    for (GLsizei level = 0; level < levels; ++level) {
+      gl->glTexImage2D(GL_TEXTURE_2D, level, internalFormat, levelWidth, levelHeight, 0, format, type, NULL);
+      levelWidth = levelWidth > 1 ? levelWidth / 2 : 1;
+      levelHeight = levelHeight > 1 ? levelHeight / 2 : 1;
+    }
+  }
+  gl->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+  if (gl->glGetError()) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  self->storage.width = width;
+  self->storage.height = height;
+  self->storage.pixelFormat = pixelFormat;
+  self->storage.levels = levels;
+}
+
+// Upload a rectangle of the pixel buffer to mipmap level 0 of the texture.
+// The rows of the rectangle are copied into the pixel unpack buffer and glTexSubImage2D sources from the pixel unpack buffer.
+// That is, the transfer to the GPU happens asynchronously.
+// The pixel unpack buffer is orphaned before it is written to such that the driver does not wait for the previous transfer to finish.
+static void
+uploadPixels
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_TextureResource* self,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl,
+    Arcadia_Integer32Value left,
+    Arcadia_Integer32Value top,
+    Arcadia_Integer32Value width,
+    Arcadia_Integer32Value height
+  )
+{
+  GLenum internalFormat, format, type;
+  getFormat(thread, Arcadia_Media_PixelBuffer_getPixelFormat(thread, self->pixelBuffer), &internalFormat, &format, &type);
+  Arcadia_SizeValue bytesPerPixel = Arcadia_Media_PixelBuffer_getBytesPerPixel(thread, self->pixelBuffer);
+  Arcadia_SizeValue lineStride = Arcadia_Media_PixelBuffer_getLineStride(thread, self->pixelBuffer);
+  Arcadia_SizeValue rowSize = (Arcadia_SizeValue)width * bytesPerPixel;
+  Arcadia_SizeValue numberOfBytes = rowSize * (Arcadia_SizeValue)height;
+
+  while (gl->glGetError()) { }
+  if (!self->pixelUnpackBufferID) {
+    gl->glGenBuffers(1, &self->pixelUnpackBufferID);
+    if (gl->glGetError()) {
+      self->pixelUnpackBufferID = 0;
+      Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+      Arcadia_Thread_jump(thread);
+    }
+  }
+  gl->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, self->pixelUnpackBufferID);
+  gl->glBufferData(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)numberOfBytes, NULL, GL_STREAM_DRAW);
+  Arcadia_Natural8Value* target = (Arcadia_Natural8Value*)gl->glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, (GLsizeiptr)numberOfBytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+  if (!target) {
+    gl->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  Arcadia_Natural8Value const* source = self->pixelBuffer->bytes + (Arcadia_SizeValue)top * lineStride + (Arcadia_SizeValue)left * bytesPerPixel; // @todo Proper encapsulation.
+  for (Arcadia_Integer32Value y = 0; y < height; ++y) {
+    Arcadia_Memory_copy(thread, target, source, rowSize);
+    target += rowSize;
+    source += lineStride;
+  }
+  // If the contents of the pixel unpack buffer were lost while it was mapped, glUnmapBuffer returns GL_FALSE.
+  if (GL_FALSE == gl->glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER)) {
+    gl->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+    Arcadia_Thread_jump(thread);
+  }
+  // The rows in the pixel unpack buffer are tightly packed.
+  gl->glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  gl->glTexSubImage2D(GL_TEXTURE_2D, 0, left, top, width, height, format, type, (void const*)0);
+  gl->glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+  gl->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+  if (gl->glGetError()) {
+    Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
+    Arcadia_Thread_jump(thread);
+  }
+}
+
 static void
 Arcadia_Engine_Visuals_Implementation_OpenGL4_TextureResource_constructImpl
   (
@@ -218,8 +408,13 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_TextureResource_constructImpl
   //
   self->addressModeU = Arcadia_Engine_Visuals_TextureAddressMode_Repeat;
   self->addressModeV = Arcadia_Engine_Visuals_TextureAddressMode_Repeat;
-  self->dirtyBits = AddressModeUDirty | AddressModeVDirty | MagnificationFilterDirty | MinificationFilterDirty | PixelsDirty;
+  self->dirtyBits = AddressModeUDirty | AddressModeVDirty | MagnificationFilterDirty | MinificationFilterDirty;
   self->id = 0;
+  self->storage.width = 0;
+  self->storage.height = 0;
+  self->storage.pixelFormat = Arcadia_Media_PixelFormat_AlphaRedGreenBlueNatural8;
+  self->storage.levels = 0;
+  self->pixelUnpackBufferID = 0;
   self->magnificationFilter = Arcadia_Engine_Visuals_TextureFilter_Linear;
   self->minificationFilter = Arcadia_Engine_Visuals_TextureFilter_Linear;
   //
@@ -265,6 +460,7 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_TextureResource_destructImpl
   )
 {
   assert(0 == self->id);
+  assert(0 == self->pixelUnpackBufferID);
 }
 
 static void
@@ -288,6 +484,23 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_TextureResource_loadImpl
 {
   Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext* context = (Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext*)((Arcadia_Engine_Visuals_Implementation_Resource*)self)->context;
   _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl = Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext_getFunctions(thread, context);
+  // The storage must be (re)allocated if its width, height, or pixel format does not match the pixel buffer.
+  Arcadia_BooleanValue storageDirty = !self->storage.levels
+                                   || self->storage.width != Arcadia_Media_PixelBuffer_getWidth(thread, self->pixelBuffer)
+                                   || self->storage.height != Arcadia_Media_PixelBuffer_getHeight(thread, self->pixelBuffer)
+                                   || self->storage.pixelFormat != Arcadia_Media_PixelBuffer_getPixelFormat(thread, self->pixelBuffer);
+  if (storageDirty && self->storage.levels) {
+    // The storage of the texture may be immutable: Create a new texture.
+    if (context->bound.texture == self->id) {
+      context->bound.texture = 0;
+    }
+    gl->glDeleteTextures(1, &self->id);
+    self->id = 0;
+    self->dirtyBits = AddressModeUDirty | AddressModeVDirty | MagnificationFilterDirty | MinificationFilterDirty;
+    self->storage.width = 0;
+    self->storage.height = 0;
+    self->storage.levels = 0;
+  }
   if (!self->id) {
     gl->glGenTextures(1, &self->id);
     if (gl->glGetError()) {
@@ -295,15 +508,19 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_TextureResource_loadImpl
     }
   }
 
-  if (self->dirtyBits & (AddressModeUDirty | AddressModeVDirty | MagnificationFilterDirty | MinificationFilterDirty | PixelsDirty)) {
+  Arcadia_Integer32Value left, top, width, height;
+  if ((self->dirtyBits & (AddressModeUDirty | AddressModeVDirty | MagnificationFilterDirty | MinificationFilterDirty)) || storageDirty ||
+      Arcadia_Media_PixelBuffer_getDirtyRectangle(thread, self->pixelBuffer, &left, &top, &width, &height)) {
     Arcadia_JumpTarget jumpTarget;
     Arcadia_Thread_pushJumpTarget(thread, &jumpTarget);
     if (Arcadia_JumpTarget_save(&jumpTarget)) {
+      gl->glActiveTexture(GL_TEXTURE0);
       gl->glBindTexture(GL_TEXTURE_2D, self->id);
       if (gl->glGetError()) {
         Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
         Arcadia_Thread_jump(thread);
       }
+      context->bound.texture = self->id;
       if (self->dirtyBits & AddressModeUDirty) {
         GLint addressMode;
         switch (self->addressModeU) {
@@ -382,11 +599,12 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_TextureResource_loadImpl
       if (self->dirtyBits & MinificationFilterDirty) {
         GLint minificationFilter;
         switch (self->minificationFilter) {
+          // The texture has mipmaps.
           case Arcadia_Engine_Visuals_TextureFilter_Linear: {
-            minificationFilter = GL_LINEAR;
+            minificationFilter = GL_LINEAR_MIPMAP_LINEAR;
           } break;
           case Arcadia_Engine_Visuals_TextureFilter_Nearest: {
-            minificationFilter = GL_NEAREST;
+            minificationFilter = GL_NEAREST_MIPMAP_NEAREST;
           } break;
           default: {
             Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
@@ -400,28 +618,31 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_TextureResource_loadImpl
         }
         self->dirtyBits &= ~MinificationFilterDirty;
       }
-      if (self->dirtyBits & PixelsDirty) {
-        gl->glTexImage2D(GL_TEXTURE_2D,
-                         0,
-                         GL_RGBA,
-                         Arcadia_Media_PixelBuffer_getWidth(thread, self->pixelBuffer),
-                         Arcadia_Media_PixelBuffer_getHeight(thread, self->pixelBuffer),
-                         0,
-                         GL_RGBA,
-                         GL_UNSIGNED_BYTE,
-                         self->pixelBuffer->bytes); // @todo Proper encapsulation.
+      if (storageDirty && Arcadia_Media_PixelBuffer_getWidth(thread, self->pixelBuffer) > 0 && Arcadia_Media_PixelBuffer_getHeight(thread, self->pixelBuffer) > 0) {
+        allocateStorage(thread, self, gl);
+        Arcadia_Media_PixelBuffer_addDirtyRectangle(thread, self->pixelBuffer, 0, 0, self->storage.width, self->storage.height);
+      }
+      if (self->storage.levels && Arcadia_Media_PixelBuffer_getDirtyRectangle(thread, self->pixelBuffer, &left, &top, &width, &height)) {
+        uploadPixels(thread, self, gl, left, top, width, height);
+        gl->glGenerateMipmap(GL_TEXTURE_2D);
         if (gl->glGetError()) {
           Arcadia_Thread_setStatus(thread, Arcadia_Status_EnvironmentFailed);
           Arcadia_Thread_jump(thread);
         }
-        self->dirtyBits &= ~PixelsDirty;
       }
+      Arcadia_Media_PixelBuffer_clearDirtyRectangle(thread, self->pixelBuffer);
       Arcadia_Thread_popJumpTarget(thread);
     } else {
       Arcadia_Thread_popJumpTarget(thread);
+      if (context->bound.texture == self->id) {
+        context->bound.texture = 0;
+      }
       gl->glDeleteTextures(1, &self->id);
       self->id = 0;
-      self->dirtyBits = AddressModeUDirty | AddressModeVDirty | MagnificationFilterDirty | MinificationFilterDirty | PixelsDirty;
+      self->dirtyBits = AddressModeUDirty | AddressModeVDirty | MagnificationFilterDirty | MinificationFilterDirty;
+      self->storage.width = 0;
+      self->storage.height = 0;
+      self->storage.levels = 0;
       Arcadia_Thread_jump(thread);
     }
   }
@@ -437,9 +658,19 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_TextureResource_unloadImpl
   Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext* context = (Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext*)((Arcadia_Engine_Visuals_Implementation_Resource*)self)->context;
   _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl = Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext_getFunctions(thread, context);
   if (self->id) {
+    if (context->bound.texture == self->id) {
+      context->bound.texture = 0;
+    }
     gl->glDeleteTextures(1, &self->id);
     self->id = 0;
-    self->dirtyBits = AddressModeUDirty | AddressModeVDirty | MagnificationFilterDirty | MinificationFilterDirty | PixelsDirty;
+    self->dirtyBits = AddressModeUDirty | AddressModeVDirty | MagnificationFilterDirty | MinificationFilterDirty;
+    self->storage.width = 0;
+    self->storage.height = 0;
+    self->storage.levels = 0;
+  }
+  if (self->pixelUnpackBufferID) {
+    gl->glDeleteBuffers(1, &self->pixelUnpackBufferID);
+    self->pixelUnpackBufferID = 0;
   }
 }
 
@@ -546,7 +777,6 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_TextureResource_setHeightImpl
 {
   if (height != Arcadia_Media_PixelBuffer_getHeight(thread, self->pixelBuffer)) {
     Arcadia_Media_PixelBuffer_setHeight(thread, self->pixelBuffer, height);
-    self->dirtyBits |= PixelsDirty;
   }
 }
 
@@ -586,9 +816,8 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_TextureResource_setWidthImpl
     Arcadia_Integer32Value width
   )
 {
-  if (width != Arcadia_Media_PixelBuffer_getHeight(thread, self->pixelBuffer)) {
+  if (width != Arcadia_Media_PixelBuffer_getWidth(thread, self->pixelBuffer)) {
     Arcadia_Media_PixelBuffer_setWidth(thread, self->pixelBuffer, width);
-    self->dirtyBits |= PixelsDirty;
   }
 }
 
@@ -600,7 +829,7 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_TextureResource_setPixelBufferImpl
     Arcadia_Media_PixelBuffer* pixelBuffer
   )
 {
-  self->dirtyBits |= PixelsDirty;
+  // Only the pixels which differ are added to the dirty rectangle.
   Arcadia_Media_PixelBuffer_assign(thread, self->pixelBuffer, pixelBuffer);
 }
 
@@ -44,6 +44,20 @@ struct Arcadia_Engine_Visuals_Implementation_OpenGL4_TextureResource {
   // The OpenGL ID of this texture.
   GLuint id;
 
+  // The storage of this texture.
+  // The width and the height are zero if no storage was allocated.
+  struct {
+    Arcadia_Integer32Value width;
+    Arcadia_Integer32Value height;
+    Arcadia_Media_PixelFormat pixelFormat;
+    // The number of mipmap levels.
+    GLsizei levels;
+  } storage;
+
+  // The OpenGL ID of the pixel unpack buffer to which pixels are copied before they are uploaded.
+  // Zero if no pixels were uploaded yet.
+  GLuint pixelUnpackBufferID;
+
   // The texture magnification filter.
   // @default Arcadia_Visuals_TextureFilter_Linear
   Arcadia_Engine_Visuals_TextureFilter magnificationFilter;
@@ -52,6 +66,7 @@ struct Arcadia_Engine_Visuals_Implementation_OpenGL4_TextureResource {
   Arcadia_Engine_Visuals_TextureFilter minificationFilter;
 
   /// @brief The pixel buffer storing the texture data.
+  /// Only the dirty rectangle of the pixel buffer is uploaded.
   Arcadia_Media_PixelBuffer* pixelBuffer;
 };
 
@@ -204,6 +204,7 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_VertexBufferResource_loadImpl
     if (GL_NO_ERROR != gl->glGetError()) {
       return;
     }
+    context->bound.vertexArray = self->vertexArrayID;
     // (2) specify the vertex element elements and the buffer they are originated from.
     for (Arcadia_SizeValue i = 0, n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)((Arcadia_Engine_Visuals_Implementation_VertexBufferResource*)self)->vertexDescriptor->vertexElementDescriptors); i < n; ++i) {
       Arcadia_Media_VertexElementDescriptor* vertexElementDescriptor = (Arcadia_Media_VertexElementDescriptor*)Arcadia_List_getObjectReferenceValueCheckedAt(thread, (Arcadia_List*)((Arcadia_Engine_Visuals_Implementation_VertexBufferResource*)self)->vertexDescriptor->vertexElementDescriptors, i, _Arcadia_Media_VertexElementDescriptor_getType(thread));
@@ -261,6 +262,9 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_VertexBufferResource_unloadImpl
   if (self->vertexArrayID) {
     Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext* context = (Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext*)((Arcadia_Engine_Visuals_Implementation_Resource*)self)->context;
     _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl = Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext_getFunctions(thread, context);
+    if (context->bound.vertexArray == self->vertexArrayID) {
+      context->bound.vertexArray = 0;
+    }
     gl->glDeleteVertexArrays(1, &self->vertexArrayID);
     self->vertexArrayID = 0;
   }
@@ -1220,6 +1220,9 @@ Arcadia_Engine_Visuals_Implementation_OpenGL4_WGL_BackendContext_destructImpl
   while (updateResources(thread, self, Arcadia_BooleanValue_True))
   {/*Intentionally empty.*/}
 
+  // (2) Delete the buffer of the constant buffer allocator.
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_unload(thread, ((Arcadia_Engine_Visuals_Implementation_OpenGL4_BackendContext*)self)->constantBufferAllocator, &self->_functions);
+
   _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions_uninitialize(thread, &self->_functions);
 
   if (self->glResourceContextHandle) {
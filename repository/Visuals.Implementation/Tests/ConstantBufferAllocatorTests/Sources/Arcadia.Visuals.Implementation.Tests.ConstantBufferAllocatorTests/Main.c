@@ -0,0 +1,343 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Arcadia/Visuals/Implementation/OpenGL4/ConstantBufferAllocator.h"
+
+#define RegionSize (Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_RegionSize)
+
+#define NumberOfRegions (Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_NumberOfRegions)
+
+// The functions below replace the OpenGL functions used by the constant buffer allocator.
+// They record the calls and keep the contents of the buffer in g_storage such that the bookkeeping can be tested without an OpenGL context.
+
+static Arcadia_Natural8Value g_storage[NumberOfRegions * RegionSize];
+
+// The name of the last buffer created.
+static GLuint g_lastBufferID = 0;
+
+// The number of buffers which were created but not deleted.
+static Arcadia_SizeValue g_numberOfBuffers = 0;
+
+// The number of calls to glBufferData.
+static Arcadia_SizeValue g_numberOfBufferDataCalls = 0;
+
+// The name of the last fence created.
+static uintptr_t g_lastFence = 0;
+
+// The number of fences which were created but not deleted.
+static Arcadia_SizeValue g_numberOfFences = 0;
+
+// The number of calls to glClientWaitSync which return GL_TIMEOUT_EXPIRED before the calls return GL_ALREADY_SIGNALED.
+static Arcadia_SizeValue g_numberOfTimeouts = 0;
+
+static GLenum APIENTRY
+fakeGetError
+  (
+  )
+{ return GL_NO_ERROR; }
+
+static void APIENTRY
+fakeGetIntegerv
+  (
+    GLenum pname,
+    GLint* data
+  )
+{ *data = 256; }
+
+static void APIENTRY
+fakeGenBuffers
+  (
+    GLsizei n,
+    GLuint* buffers
+  )
+{
+  for (GLsizei i = 0; i < n; ++i) {
+    buffers[i] = ++g_lastBufferID;
+    g_numberOfBuffers++;
+  }
+}
+
+static void APIENTRY
+fakeDeleteBuffers
+  (
+    GLsizei n,
+    GLuint const* buffers
+  )
+{ g_numberOfBuffers -= (Arcadia_SizeValue)n; }
+
+static void APIENTRY
+fakeBindBuffer
+  (
+    GLenum target,
+    GLuint buffer
+  )
+{ }
+
+static void APIENTRY
+fakeBufferData
+  (
+    GLenum target,
+    GLsizeiptr size,
+    void const* data,
+    GLenum usage
+  )
+{ g_numberOfBufferDataCalls++; }
+
+static void APIENTRY
+fakeBufferSubData
+  (
+    GLenum target,
+    GLintptr offset,
+    GLsizeiptr size,
+    void const* data
+  )
+{ memcpy(g_storage + offset, data, (size_t)size); }
+
+static void APIENTRY
+fakeBufferStorage
+  (
+    GLenum target,
+    GLsizeiptr size,
+    void const* data,
+    GLbitfield flags
+  )
+{ }
+
+static void* APIENTRY
+fakeMapBufferRange
+  (
+    GLenum target,
+    GLintptr offset,
+    GLsizeiptr length,
+    GLbitfield access
+  )
+{ return g_storage + offset; }
+
+static GLboolean APIENTRY
+fakeUnmapBuffer
+  (
+    GLenum target
+  )
+{ return GL_TRUE; }
+
+static GLsync APIENTRY
+fakeFenceSync
+  (
+    GLenum condition,
+    GLbitfield flags
+  )
+{
+  g_numberOfFences++;
+  return (GLsync)++g_lastFence;
+}
+
+static GLenum APIENTRY
+fakeClientWaitSync
+  (
+    GLsync sync,
+    GLbitfield flags,
+    GLuint64 timeout
+  )
+{
+  if (g_numberOfTimeouts) {
+    g_numberOfTimeouts--;
+    return GL_TIMEOUT_EXPIRED;
+  }
+  return GL_ALREADY_SIGNALED;
+}
+
+static void APIENTRY
+fakeDeleteSync
+  (
+    GLsync sync
+  )
+{ g_numberOfFences--; }
+
+static void
+initializeFunctions
+  (
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl,
+    Arcadia_BooleanValue persistent
+  )
+{
+  memset(gl, 0, sizeof(_Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions));
+  gl->glGetError = &fakeGetError;
+  gl->glGetIntegerv = &fakeGetIntegerv;
+  gl->glGenBuffers = &fakeGenBuffers;
+  gl->glDeleteBuffers = &fakeDeleteBuffers;
+  gl->glBindBuffer = &fakeBindBuffer;
+  gl->glBufferData = &fakeBufferData;
+  gl->glBufferSubData = &fakeBufferSubData;
+  gl->glMapBufferRange = &fakeMapBufferRange;
+  gl->glUnmapBuffer = &fakeUnmapBuffer;
+  if (persistent) {
+    // The optional functions are required for persistent mapping.
+    gl->glBufferStorage = &fakeBufferStorage;
+    gl->glFenceSync = &fakeFenceSync;
+    gl->glClientWaitSync = &fakeClientWaitSync;
+    gl->glDeleteSync = &fakeDeleteSync;
+  }
+  g_numberOfBuffers = 0;
+  g_numberOfBufferDataCalls = 0;
+  g_numberOfFences = 0;
+  g_numberOfTimeouts = 0;
+}
+
+static Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocation
+allocate
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* allocator,
+    _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions* gl,
+    Arcadia_Natural8Value value,
+    Arcadia_SizeValue numberOfBytes
+  )
+{
+  static Arcadia_Natural8Value bytes[RegionSize];
+  memset(bytes, value, numberOfBytes);
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocation allocation;
+  Arcadia_Tests_assertTrue(thread, Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_allocate(thread, allocator, gl, bytes, numberOfBytes, &allocation));
+  Arcadia_Tests_assertTrue(thread, 0 == allocation.offset % 256);
+  Arcadia_Tests_assertTrue(thread, allocation.size >= (GLsizeiptr)numberOfBytes && 0 == allocation.size % 16);
+  for (Arcadia_SizeValue i = 0; i < numberOfBytes; ++i) {
+    Arcadia_Tests_assertTrue(thread, value == g_storage[allocation.offset + i]);
+  }
+  return allocation;
+}
+
+static Arcadia_BooleanValue
+isValid
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* allocator,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocation const* allocation
+  )
+{ return Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_isValid(thread, allocator, allocation); }
+
+// The buffer is persistently mapped.
+// A range is valid only while its region is the current region.
+// Wrapping around waits for the fence of the next region and counts a stall if the fence is not signaled.
+static void
+persistentTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions gl;
+  initializeFunctions(&gl, Arcadia_BooleanValue_True);
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocatorStatistics statistics;
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* allocator = Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_create(thread);
+
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocation a = allocate(thread, allocator, &gl, 1, 12);
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocation b = allocate(thread, allocator, &gl, 2, 16);
+  Arcadia_Tests_assertTrue(thread, NULL != allocator->bytes && 1 == g_numberOfBuffers && 0 == g_numberOfBufferDataCalls);
+  Arcadia_Tests_assertTrue(thread, 0 == a.region && 0 == a.offset && 16 == a.size);
+  Arcadia_Tests_assertTrue(thread, 0 == b.region && 256 == b.offset);
+  Arcadia_Tests_assertTrue(thread, isValid(thread, allocator, &a) && isValid(thread, allocator, &b));
+
+  // The range does not fit into region 0: Region 0 is guarded by a fence and the ring moves to region 1.
+  // Draws issued from now on are not guarded by the fence of region 0: The ranges of region 0 must be copied again.
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocation c = allocate(thread, allocator, &gl, 3, RegionSize);
+  Arcadia_Tests_assertTrue(thread, 1 == c.region && RegionSize == c.offset && 1 == g_numberOfFences);
+  Arcadia_Tests_assertTrue(thread, !isValid(thread, allocator, &a) && !isValid(thread, allocator, &b) && isValid(thread, allocator, &c));
+
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocation d = allocate(thread, allocator, &gl, 4, RegionSize);
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocation e = allocate(thread, allocator, &gl, 5, RegionSize);
+  Arcadia_Tests_assertTrue(thread, 2 == d.region && 3 == e.region && 3 == g_numberOfFences);
+  Arcadia_Tests_assertTrue(thread, !isValid(thread, allocator, &c) && !isValid(thread, allocator, &d) && isValid(thread, allocator, &e));
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_getStatistics(thread, allocator, &statistics);
+  Arcadia_Tests_assertTrue(thread, 0 == statistics.stalls);
+
+  // The ring wraps around to region 0: The GPU is not done with region 0 and the allocator waits.
+  g_numberOfTimeouts = 2;
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocation f = allocate(thread, allocator, &gl, 6, 32);
+  Arcadia_Tests_assertTrue(thread, 0 == f.region && 0 == f.offset && 0 == g_numberOfTimeouts);
+  Arcadia_Tests_assertTrue(thread, f.generation == a.generation + 1);
+  // The fence of region 0 was deleted and the fence of region 3 was created.
+  Arcadia_Tests_assertTrue(thread, 3 == g_numberOfFences);
+  Arcadia_Tests_assertTrue(thread, !isValid(thread, allocator, &a) && isValid(thread, allocator, &f));
+
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_getStatistics(thread, allocator, &statistics);
+  Arcadia_Tests_assertTrue(thread, 6 == statistics.allocations);
+  Arcadia_Tests_assertTrue(thread, 12 + 16 + 3 * RegionSize + 32 == statistics.bytesUploaded);
+  Arcadia_Tests_assertTrue(thread, 1 == statistics.stalls);
+  Arcadia_Tests_assertTrue(thread, 0 == statistics.orphans);
+
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_unload(thread, allocator, &gl);
+  Arcadia_Tests_assertTrue(thread, 0 == g_numberOfBuffers && 0 == g_numberOfFences && NULL == allocator->bytes);
+  Arcadia_Tests_assertTrue(thread, !isValid(thread, allocator, &f));
+}
+
+// The buffer is not persistently mapped.
+// Ranges are written by glBufferSubData and remain valid until the buffer is orphaned when the ring wraps around.
+static void
+orphanTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  _Arcadia_Engine_Visuals_Implementation_OpenGL4_Functions gl;
+  initializeFunctions(&gl, Arcadia_BooleanValue_False);
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocatorStatistics statistics;
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator* allocator = Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_create(thread);
+
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocation a = allocate(thread, allocator, &gl, 1, 64);
+  Arcadia_Tests_assertTrue(thread, NULL == allocator->bytes && 1 == g_numberOfBuffers && 1 == g_numberOfBufferDataCalls);
+  Arcadia_Tests_assertTrue(thread, 0 == a.region && 0 == a.offset && 64 == a.size);
+
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocation b = allocate(thread, allocator, &gl, 2, RegionSize);
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocation c = allocate(thread, allocator, &gl, 3, RegionSize);
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocation d = allocate(thread, allocator, &gl, 4, RegionSize);
+  Arcadia_Tests_assertTrue(thread, 1 == b.region && 2 == c.region && 3 == d.region);
+  // The ranges of older regions remain valid as long as the buffer is not orphaned.
+  Arcadia_Tests_assertTrue(thread, isValid(thread, allocator, &a) && isValid(thread, allocator, &b) && isValid(thread, allocator, &c) && isValid(thread, allocator, &d));
+  Arcadia_Tests_assertTrue(thread, 1 == g_numberOfBufferDataCalls && 0 == g_numberOfFences);
+
+  // The ring wraps around to region 0: The buffer is orphaned and all ranges are invalidated.
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocation e = allocate(thread, allocator, &gl, 5, 16);
+  Arcadia_Tests_assertTrue(thread, 0 == e.region && 0 == e.offset && 2 == g_numberOfBufferDataCalls);
+  Arcadia_Tests_assertTrue(thread, !isValid(thread, allocator, &a) && !isValid(thread, allocator, &b) && !isValid(thread, allocator, &c) && !isValid(thread, allocator, &d));
+  Arcadia_Tests_assertTrue(thread, isValid(thread, allocator, &e));
+
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_getStatistics(thread, allocator, &statistics);
+  Arcadia_Tests_assertTrue(thread, 5 == statistics.allocations);
+  Arcadia_Tests_assertTrue(thread, 64 + 3 * RegionSize + 16 == statistics.bytesUploaded);
+  Arcadia_Tests_assertTrue(thread, 0 == statistics.stalls);
+  Arcadia_Tests_assertTrue(thread, 1 == statistics.orphans);
+
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ConstantBufferAllocator_unload(thread, allocator, &gl);
+  Arcadia_Tests_assertTrue(thread, 0 == g_numberOfBuffers);
+  Arcadia_Tests_assertTrue(thread, !isValid(thread, allocator, &e));
+}
+
+int
+main
+  (
+    int argc,
+    char **argv
+  )
+{
+  if (!Arcadia_Tests_safeExecute(&persistentTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&orphanTests)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,337 @@
+// The author of this software is Michael Heilmann (contact@michaelheilmann.com).
+//
+// Copyright(c) 2024-2026 Michael Heilmann (contact@michaelheilmann.com).
+//
+// Permission to use, copy, modify, and distribute this software for any
+// purpose without fee is hereby granted, provided that this entire notice
+// is included in all copies of any software which is or includes a copy
+// or modification of this software and in all copies of the supporting
+// documentation for such software.
+//
+// THIS SOFTWARE IS BEING PROVIDED "AS IS", WITHOUT ANY EXPRESS OR IMPLIED
+// WARRANTY.IN PARTICULAR, NEITHER THE AUTHOR NOR LUCENT MAKES ANY
+// REPRESENTATION OR WARRANTY OF ANY KIND CONCERNING THE MERCHANTABILITY
+// OF THIS SOFTWARE OR ITS FITNESS FOR ANY PARTICULAR PURPOSE.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "Arcadia/Visuals/Implementation/OpenGL4/ProgramCache.h"
+#include "Arcadia/VPL/Include.h"
+
+// The directory of the on-disk cache, relative to the working directory.
+#define Directory u8"ProgramCacheTests"
+
+#define VertexShader u8"void main() { gl_Position = vec4(0.0); }"
+
+#define FragmentShader u8"void main() { color = vec4(1.0); }"
+
+#define OtherFragmentShader u8"void main() { color = vec4(0.0); }"
+
+#define Driver u8"Arcadia Renderer 4.6"
+
+static Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache*
+createCache
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* cache = Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_create(thread);
+  cache->directory = Arcadia_FilePath_parseGeneric(thread, Arcadia_String_createFromCxxString(thread, Directory));
+  return cache;
+}
+
+static Arcadia_FilePath*
+getFilePath
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* key,
+    const char* extension
+  )
+{
+  Arcadia_StringBuilder* stringBuilder = Arcadia_StringBuilder_create(thread);
+  Arcadia_StringBuilder_insertBackCxxString(thread, stringBuilder, Directory);
+  Arcadia_StringBuilder_insertBackCxxString(thread, stringBuilder, u8"/");
+  Arcadia_StringBuilder_insertBackString(thread, stringBuilder, key);
+  Arcadia_StringBuilder_insertBackCxxString(thread, stringBuilder, extension);
+  return Arcadia_FilePath_parseGeneric(thread, Arcadia_String_create(thread, Arcadia_Value_makeObjectReferenceValue(stringBuilder)));
+}
+
+static void
+deleteFile
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* key,
+    const char* extension
+  )
+{
+  Arcadia_FileSystem* fileSystem = Arcadia_FileSystem_getOrCreate(thread);
+  Arcadia_FilePath* filePath = getFilePath(thread, key, extension);
+  if (Arcadia_FileSystem_regularFileExists(thread, fileSystem, filePath)) {
+    Arcadia_FileSystem_deleteRegularFile(thread, fileSystem, filePath);
+  }
+}
+
+// Replace the Byte at @a index of a cache file by @a value.
+// If @a updateChecksum is true, the checksum is recomputed such that only the contents of the file are invalid.
+static void
+modifyFile
+  (
+    Arcadia_Thread* thread,
+    Arcadia_String* key,
+    const char* extension,
+    Arcadia_SizeValue index,
+    Arcadia_Natural8Value value,
+    Arcadia_BooleanValue updateChecksum
+  )
+{
+  Arcadia_FileSystem* fileSystem = Arcadia_FileSystem_getOrCreate(thread);
+  Arcadia_FilePath* filePath = getFilePath(thread, key, extension);
+  Arcadia_ByteArrayBuilder* source = Arcadia_FileSystem_getFileContents(thread, fileSystem, filePath);
+  Arcadia_Natural8Value const* bytes = Arcadia_ByteArrayBuilder_getBytes(thread, source);
+  Arcadia_SizeValue numberOfBytes = Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, source);
+  Arcadia_Tests_assertTrue(thread, numberOfBytes > 8 && index < numberOfBytes - 8 && bytes[index] != value);
+  Arcadia_ByteArrayBuilder* target = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, bytes, index);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, &value, 1);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, bytes + index + 1, numberOfBytes - 8 - index - 1);
+  if (updateChecksum) {
+    Arcadia_Natural64Value checksum = (Arcadia_Natural64Value)Arcadia_hashBytes(thread, Arcadia_ByteArrayBuilder_getBytes(thread, target), numberOfBytes - 8);
+    for (Arcadia_SizeValue i = 0; i < 8; ++i) {
+      Arcadia_Natural8Value x = (Arcadia_Natural8Value)(checksum >> (8 * i));
+      Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, &x, 1);
+    }
+  } else {
+    Arcadia_ByteArrayBuilder_insertBackBytes(thread, target, bytes + numberOfBytes - 8, 8);
+  }
+  Arcadia_FileSystem_setFileContents(thread, fileSystem, filePath, target);
+}
+
+static Arcadia_BooleanValue
+loadSource
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* cache,
+    Arcadia_String* key
+  )
+{
+  Arcadia_ByteArrayBuilder* vertexShader = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ByteArrayBuilder* fragmentShader = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_Map* constantMapping = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
+  Arcadia_String* fragmentColorOutput = NULL;
+  if (!Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_loadSource(thread, cache, key, vertexShader, fragmentShader, constantMapping, &fragmentColorOutput)) {
+    // The arguments must not be modified.
+    Arcadia_Tests_assertTrue(thread, 0 == Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, vertexShader));
+    Arcadia_Tests_assertTrue(thread, 0 == Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, fragmentShader));
+    Arcadia_Tests_assertTrue(thread, 0 == Arcadia_Collection_getSize(thread, (Arcadia_Collection*)constantMapping));
+    Arcadia_Tests_assertTrue(thread, NULL == fragmentColorOutput);
+    return Arcadia_BooleanValue_False;
+  }
+  Arcadia_Tests_assertTrue(thread, Arcadia_ByteArrayBuilder_isEqualTo_pn(thread, vertexShader, VertexShader, sizeof(VertexShader)));
+  Arcadia_Tests_assertTrue(thread, Arcadia_ByteArrayBuilder_isEqualTo_pn(thread, fragmentShader, FragmentShader, sizeof(FragmentShader)));
+  Arcadia_Tests_assertTrue(thread, 2 == Arcadia_Collection_getSize(thread, (Arcadia_Collection*)constantMapping));
+  Arcadia_String* name = (Arcadia_String*)Arcadia_Map_getObjectReferenceValueChecked(thread, constantMapping, Arcadia_Value_makeObjectReferenceValue(Arcadia_String_createFromCxxString(thread, u8"modelToWorld")), _Arcadia_String_getType(thread));
+  Arcadia_Tests_assertTrue(thread, Arcadia_String_isEqualTo_pn(thread, name, u8"_0", sizeof(u8"_0") - 1));
+  name = (Arcadia_String*)Arcadia_Map_getObjectReferenceValueChecked(thread, constantMapping, Arcadia_Value_makeObjectReferenceValue(Arcadia_String_createFromCxxString(thread, u8"worldToView")), _Arcadia_String_getType(thread));
+  Arcadia_Tests_assertTrue(thread, Arcadia_String_isEqualTo_pn(thread, name, u8"_1", sizeof(u8"_1") - 1));
+  Arcadia_Tests_assertTrue(thread, Arcadia_String_isEqualTo_pn(thread, fragmentColorOutput, u8"_color", sizeof(u8"_color") - 1));
+  return Arcadia_BooleanValue_True;
+}
+
+static Arcadia_ByteArrayBuilder*
+createShader
+  (
+    Arcadia_Thread* thread,
+    const char* source
+  )
+{
+  Arcadia_ByteArrayBuilder* shader = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, shader, source, strlen(source) + 1);
+  return shader;
+}
+
+static void
+storeBinary
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* cache,
+    Arcadia_String* key
+  )
+{
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_storeBinary(thread, cache, key, Arcadia_String_createFromCxxString(thread, Driver),
+                                                                         createShader(thread, VertexShader), createShader(thread, FragmentShader),
+                                                                         0x8E21, VertexShader, sizeof(VertexShader));
+}
+
+static Arcadia_BooleanValue
+loadBinary
+  (
+    Arcadia_Thread* thread,
+    Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* cache,
+    Arcadia_String* key,
+    const char* driver,
+    const char* fragmentShader
+  )
+{
+  Arcadia_Natural32Value format = 0;
+  Arcadia_ByteArrayBuilder* binary = Arcadia_ByteArrayBuilder_create(thread);
+  if (!Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_loadBinary(thread, cache, key, Arcadia_String_createFromCxxString(thread, driver),
+                                                                             createShader(thread, VertexShader), createShader(thread, fragmentShader), &format, binary)) {
+    // The arguments must not be modified.
+    Arcadia_Tests_assertTrue(thread, 0 == format && 0 == Arcadia_ByteArrayBuilder_getNumberOfBytes(thread, binary));
+    return Arcadia_BooleanValue_False;
+  }
+  Arcadia_Tests_assertTrue(thread, 0x8E21 == format);
+  Arcadia_Tests_assertTrue(thread, Arcadia_ByteArrayBuilder_isEqualTo_pn(thread, binary, VertexShader, sizeof(VertexShader)));
+  return Arcadia_BooleanValue_True;
+}
+
+// Keys are strings of 16 hexadecimal digits.
+// Equivalent VPL programs have the same key, programs with different flags or different definitions have different keys.
+static void
+keyTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* cache = createCache(thread);
+  Arcadia_String* a = Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_getKey(thread, cache, Arcadia_VPL_Symbols_Program_createProgram(thread, Arcadia_VPL_Symbols_ProgramFlags_MeshAmbientColor));
+  Arcadia_String* b = Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_getKey(thread, cache, Arcadia_VPL_Symbols_Program_createProgram(thread, Arcadia_VPL_Symbols_ProgramFlags_MeshAmbientColor));
+  Arcadia_String* c = Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_getKey(thread, cache, Arcadia_VPL_Symbols_Program_createProgram(thread, Arcadia_VPL_Symbols_ProgramFlags_VertexAmbientColor));
+  Arcadia_Tests_assertTrue(thread, 16 == Arcadia_String_getNumberOfBytes(thread, a));
+  Arcadia_Natural8Value const* bytes = Arcadia_String_getBytes(thread, a);
+  for (Arcadia_SizeValue i = 0; i < 16; ++i) {
+    Arcadia_Tests_assertTrue(thread, (bytes[i] >= '0' && bytes[i] <= '9') || (bytes[i] >= 'a' && bytes[i] <= 'f'));
+  }
+  Arcadia_Tests_assertTrue(thread, Arcadia_String_isEqualTo_pn(thread, a, Arcadia_String_getBytes(thread, b), Arcadia_String_getNumberOfBytes(thread, b)));
+  Arcadia_Tests_assertTrue(thread, !Arcadia_String_isEqualTo_pn(thread, a, Arcadia_String_getBytes(thread, c), Arcadia_String_getNumberOfBytes(thread, c)));
+
+  // Change the body of the last procedure definition, the main procedure of the fragment stage.
+  Arcadia_VPL_Symbols_Program* program = Arcadia_VPL_Symbols_Program_createProgram(thread, Arcadia_VPL_Symbols_ProgramFlags_MeshAmbientColor);
+  Arcadia_List* elements = program->programDefnNode->elements;
+  Arcadia_VPL_Tree_ProcedureDefnNode* procedureDefnNode = NULL;
+  for (Arcadia_SizeValue i = 0, n = Arcadia_Collection_getSize(thread, (Arcadia_Collection*)elements); i < n; ++i) {
+    Arcadia_Object* element = Arcadia_List_getObjectReferenceValueAt(thread, elements, i);
+    if (Arcadia_Object_isInstanceOf(thread, element, _Arcadia_VPL_Tree_ProcedureDefnNode_getType(thread))) {
+      procedureDefnNode = (Arcadia_VPL_Tree_ProcedureDefnNode*)element;
+    }
+  }
+  Arcadia_Tests_assertTrue(thread, NULL != procedureDefnNode);
+  Arcadia_List_insertBackObjectReferenceValue(thread, procedureDefnNode->body, (Arcadia_Object*)Arcadia_VPL_Tree_NumberExprNode_create(thread, Arcadia_String_createFromCxxString(thread, u8"1")));
+  Arcadia_String* d = Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_getKey(thread, cache, program);
+  Arcadia_Tests_assertTrue(thread, !Arcadia_String_isEqualTo_pn(thread, a, Arcadia_String_getBytes(thread, d), Arcadia_String_getNumberOfBytes(thread, d)));
+}
+
+// GLSL sources are read back from memory and from disk.
+// Files with an invalid checksum or a different version are rejected.
+static void
+sourceTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_String* key = Arcadia_String_createFromCxxString(thread, u8"0123456789abcdef");
+  deleteFile(thread, key, u8".glsl");
+
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCacheStatistics statistics;
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* cache = createCache(thread);
+  Arcadia_Tests_assertTrue(thread, !loadSource(thread, cache, key));
+
+  Arcadia_ByteArrayBuilder* vertexShader = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, vertexShader, VertexShader, sizeof(VertexShader));
+  Arcadia_ByteArrayBuilder* fragmentShader = Arcadia_ByteArrayBuilder_create(thread);
+  Arcadia_ByteArrayBuilder_insertBackBytes(thread, fragmentShader, FragmentShader, sizeof(FragmentShader));
+  Arcadia_Map* constantMapping = (Arcadia_Map*)Arcadia_HashMap_create(thread, Arcadia_Value_makeVoidValue(Arcadia_VoidValue_Void));
+  Arcadia_Map_set(thread, constantMapping, Arcadia_Value_makeObjectReferenceValue(Arcadia_String_createFromCxxString(thread, u8"modelToWorld")),
+                  Arcadia_Value_makeObjectReferenceValue(Arcadia_String_createFromCxxString(thread, u8"_0")), NULL, NULL);
+  Arcadia_Map_set(thread, constantMapping, Arcadia_Value_makeObjectReferenceValue(Arcadia_String_createFromCxxString(thread, u8"worldToView")),
+                  Arcadia_Value_makeObjectReferenceValue(Arcadia_String_createFromCxxString(thread, u8"_1")), NULL, NULL);
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_storeSource(thread, cache, key, vertexShader, fragmentShader, constantMapping,
+                                                                         Arcadia_String_createFromCxxString(thread, u8"_color"));
+  Arcadia_Tests_assertTrue(thread, NULL != cache->directory);
+
+  // Read back from memory.
+  Arcadia_Tests_assertTrue(thread, loadSource(thread, cache, key));
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_getStatistics(thread, cache, &statistics);
+  Arcadia_Tests_assertTrue(thread, 1 == statistics.sourceHits && 1 == statistics.sourceMisses);
+
+  // Read back from disk.
+  cache = createCache(thread);
+  Arcadia_Tests_assertTrue(thread, loadSource(thread, cache, key));
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_getStatistics(thread, cache, &statistics);
+  Arcadia_Tests_assertTrue(thread, 1 == statistics.sourceHits && 0 == statistics.sourceMisses);
+
+  // A file with an invalid checksum is rejected.
+  modifyFile(thread, key, u8".glsl", 20, 'x', Arcadia_BooleanValue_False);
+  cache = createCache(thread);
+  Arcadia_Tests_assertTrue(thread, !loadSource(thread, cache, key));
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_getStatistics(thread, cache, &statistics);
+  Arcadia_Tests_assertTrue(thread, 0 == statistics.sourceHits && 1 == statistics.sourceMisses);
+
+  // A file of a different version is rejected even if its checksum is valid.
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_storeSource(thread, cache, key, vertexShader, fragmentShader, constantMapping,
+                                                                         Arcadia_String_createFromCxxString(thread, u8"_color"));
+  modifyFile(thread, key, u8".glsl", 7, '0', Arcadia_BooleanValue_True);
+  cache = createCache(thread);
+  Arcadia_Tests_assertTrue(thread, !loadSource(thread, cache, key));
+
+  deleteFile(thread, key, u8".glsl");
+}
+
+// Program binaries are read back from disk if they were created by the same driver from the same GLSL sources.
+// Files with an invalid checksum, a different version, created by a different driver, or created from different GLSL sources are rejected.
+static void
+binaryTests
+  (
+    Arcadia_Thread* thread
+  )
+{
+  Arcadia_String* key = Arcadia_String_createFromCxxString(thread, u8"fedcba9876543210");
+  deleteFile(thread, key, u8".bin");
+
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCacheStatistics statistics;
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache* cache = createCache(thread);
+  Arcadia_Tests_assertTrue(thread, !loadBinary(thread, cache, key, Driver, FragmentShader));
+
+  storeBinary(thread, cache, key);
+  Arcadia_Tests_assertTrue(thread, loadBinary(thread, cache, key, Driver, FragmentShader));
+  // A binary of a different driver version is rejected.
+  Arcadia_Tests_assertTrue(thread, !loadBinary(thread, cache, key, u8"Arcadia Renderer 4.7", FragmentShader));
+  // A binary created from different GLSL sources is rejected.
+  Arcadia_Tests_assertTrue(thread, !loadBinary(thread, cache, key, Driver, OtherFragmentShader));
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_getStatistics(thread, cache, &statistics);
+  Arcadia_Tests_assertTrue(thread, 3 == statistics.binaryMisses);
+
+  // A file with an invalid checksum is rejected.
+  modifyFile(thread, key, u8".bin", 20, 'x', Arcadia_BooleanValue_False);
+  Arcadia_Tests_assertTrue(thread, !loadBinary(thread, cache, key, Driver, FragmentShader));
+
+  // A file of a different version is rejected even if its checksum is valid.
+  storeBinary(thread, cache, key);
+  Arcadia_Tests_assertTrue(thread, loadBinary(thread, cache, key, Driver, FragmentShader));
+  modifyFile(thread, key, u8".bin", 7, '0', Arcadia_BooleanValue_True);
+  Arcadia_Tests_assertTrue(thread, !loadBinary(thread, cache, key, Driver, FragmentShader));
+  Arcadia_Engine_Visuals_Implementation_OpenGL4_ProgramCache_getStatistics(thread, cache, &statistics);
+  Arcadia_Tests_assertTrue(thread, 5 == statistics.binaryMisses);
+
+  deleteFile(thread, key, u8".bin");
+}
+
+int
+main
+  (
+    int argc,
+    char **argv
+  )
+{
+  if (!Arcadia_Tests_safeExecute(&keyTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&sourceTests)) {
+    return EXIT_FAILURE;
+  }
+  if (!Arcadia_Tests_safeExecute(&binaryTests)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}